@@ -0,0 +1,574 @@
+// allocators.m.cpp                                                   -*-C++-*-
+
+//@PURPOSE: Benchmark the BDE allocators on representative workloads.
+//
+//@DESCRIPTION: This program measures the time taken by a set of workloads
+// when their memory is supplied by each of a set of allocators, following the
+// methodology of the ISO WG21 papers N4468 and P0089 ("On Quantifying
+// Memory-Allocation Strategies").  The results are printed either as a table,
+// or, if `--json` is specified, as a single JSON document suitable for
+// tracking across releases.
+//
+///Workloads
+///---------
+// * `churn`: repeatedly build, and destroy, a small set of node-based and
+//   contiguous containers (`bsl::vector`, `bsl::list`, `bsl::set`,
+//   `bsl::unordered_map`, and `bsl::string`).
+//
+// * `mix`: grow a long-lived `bsl::list` of strings while creating, and
+//   destroying, short-lived vectors of strings, periodically trimming the
+//   long-lived list, so that long-lived and short-lived allocations are
+//   interleaved.
+//
+// * `threaded`: run `churn` concurrently on `--threads` threads.  Allocators
+//   that are thread-safe are shared by all threads; the others are created
+//   by each thread.
+//
+///Allocators
+///----------
+// Unless stated otherwise below, a new allocator is created for each
+// iteration of a workload, and destroyed (releasing its memory) at the end of
+// the iteration, which is the intended usage of the managed allocators:
+//
+// * `newdelete`: `bslma::NewDeleteAllocator` (a singleton).
+// * `sequential`: `bdlma::SequentialAllocator`.
+// * `buffered`: `bdlma::BufferedSequentialAllocator` on a local buffer.
+// * `local`: `bdlma::LocalSequentialAllocator`.
+// * `multipool`: `bdlma::MultipoolAllocator`.
+// * `concurrentmultipool`: `bdlma::ConcurrentMultipoolAllocator`.
+// * `threadcaching`: `bdlma::ThreadCachingMultipoolAllocator`.
+//
+///Usage
+///-----
+// ```
+// allocators [--workload <name>] [--allocator <name>] [--iterations <n>]
+//            [--scale <n>] [--threads <n>] [--json]
+// ```
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_assert.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+// ============================================================================
+//                           CONSTANTS AND TYPES
+// ----------------------------------------------------------------------------
+
+enum {
+    k_BUFFER_SIZE = 64 * 1024  // size of the buffer of the `buffered` and
+                               // `local` allocators
+};
+
+/// This enumeration identifies the allocators under test.
+enum Subject {
+    e_NEW_DELETE,
+    e_SEQUENTIAL,
+    e_BUFFERED_SEQUENTIAL,
+    e_LOCAL_SEQUENTIAL,
+    e_MULTIPOOL,
+    e_CONCURRENT_MULTIPOOL,
+    e_THREAD_CACHING_MULTIPOOL,
+    k_NUM_SUBJECTS
+};
+
+const char *const SUBJECT_NAMES[k_NUM_SUBJECTS] = {
+    "newdelete",
+    "sequential",
+    "buffered",
+    "local",
+    "multipool",
+    "concurrentmultipool",
+    "threadcaching"
+};
+
+/// Return `true` if the specified `subject` may be shared by several
+/// threads, and `false` otherwise.  Note that the `threaded` workload shares
+/// one allocator among all threads if and only if this function returns
+/// `true`.
+bool isThreadSafe(Subject subject)
+{
+    return e_NEW_DELETE               == subject
+        || e_CONCURRENT_MULTIPOOL     == subject
+        || e_THREAD_CACHING_MULTIPOOL == subject;
+}
+
+/// This `struct` holds the parameters of a run.
+struct Parameters {
+    int  d_iterations;  // iterations of each workload
+    int  d_scale;       // elements per iteration
+    int  d_numThreads;  // threads of the `threaded` workload
+};
+
+/// This type of function runs one iteration of a workload, with the
+/// specified `parameters`, using the specified `allocator`, and returns a
+/// value depending on the work done, to keep it from being optimized away.
+typedef bsls::Types::Uint64 (*WorkloadFunction)(
+                                          bslma::Allocator  *allocator,
+                                          const Parameters&  parameters);
+
+/// This `struct` holds the result of timing one workload with one
+/// allocator.
+struct Result {
+    const char *d_workload;
+    const char *d_allocator;
+    int         d_numThreads;
+    bool        d_isShared;        // `true` if one allocator is shared by
+                                   // all threads
+    double      d_seconds;
+    double      d_nsPerElement;
+};
+
+volatile bsls::Types::Uint64 g_sink;  // defeat dead-code elimination
+
+// ============================================================================
+//                               WORKLOADS
+// ----------------------------------------------------------------------------
+
+/// Return a string, having more characters than fit in the small-string
+/// buffer, for the specified `i`.
+const char *text(int i)
+{
+    static const char *const TEXTS[] = {
+        "the quick brown fox jumps over the lazy dog",
+        "pack my box with five dozen liquor jugs, quickly",
+        "how vexingly quick daft zebras jump over fences",
+        "sphinx of black quartz, judge my vow, said the clerk"
+    };
+    return TEXTS[i % (sizeof TEXTS / sizeof *TEXTS)];
+}
+
+/// Build, and destroy, a vector, a list, a set, and an unordered map of
+/// strings, each having `parameters.d_scale` elements, using the specified
+/// `allocator`.
+bsls::Types::Uint64 churn(bslma::Allocator  *allocator,
+                          const Parameters&  parameters)
+{
+    bsl::vector<int>                     vector(allocator);
+    bsl::list<int>                       list(allocator);
+    bsl::set<int>                        set(allocator);
+    bsl::unordered_map<int, bsl::string> map(allocator);
+
+    for (int i = 0; i < parameters.d_scale; ++i) {
+        vector.push_back(i);
+        list.push_back(i);
+        set.insert(i * 7919 % parameters.d_scale);
+        map.emplace(i, text(i));
+    }
+
+    return vector.size() + list.size() + set.size() + map.size();
+}
+
+/// Grow a long-lived list of strings by `parameters.d_scale` elements,
+/// removing one element for every four added, while creating, and
+/// destroying, a short-lived vector of eight strings for each element, using
+/// the specified `allocator`.
+bsls::Types::Uint64 mix(bslma::Allocator  *allocator,
+                        const Parameters&  parameters)
+{
+    bsl::list<bsl::string> longLived(allocator);
+    bsls::Types::Uint64    result = 0;
+
+    for (int i = 0; i < parameters.d_scale; ++i) {
+        {
+            bsl::vector<bsl::string> shortLived(allocator);
+            for (int j = 0; j < 8; ++j) {
+                shortLived.emplace_back(text(i + j));
+            }
+            result += shortLived.back().size();
+        }
+
+        longLived.emplace_back(text(i));
+
+        if (0 == i % 4) {
+            longLived.pop_front();
+        }
+    }
+
+    return result + longLived.size();
+}
+
+// ============================================================================
+//                                 TIMING
+// ----------------------------------------------------------------------------
+
+/// Run the specified `workload` the number of iterations indicated by the
+/// specified `parameters`.  If the specified `shared` is not 0, use it for
+/// every iteration; otherwise, use a new allocator of the type indicated by
+/// the specified `subject` for each iteration.
+void runIterations(WorkloadFunction   workload,
+                   Subject            subject,
+                   bslma::Allocator  *shared,
+                   const Parameters&  parameters)
+{
+    bsls::Types::Uint64 result = 0;
+
+    for (int i = 0; i < parameters.d_iterations; ++i) {
+        if (shared) {
+            result += workload(shared, parameters);
+            continue;
+        }
+
+        switch (subject) {
+          case e_NEW_DELETE: {
+            result += workload(&bslma::NewDeleteAllocator::singleton(),
+                               parameters);
+          } break;
+          case e_SEQUENTIAL: {
+            bdlma::SequentialAllocator allocator;
+            result += workload(&allocator, parameters);
+          } break;
+          case e_BUFFERED_SEQUENTIAL: {
+            bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+            bdlma::BufferedSequentialAllocator allocator(buffer.buffer(),
+                                                         k_BUFFER_SIZE);
+            result += workload(&allocator, parameters);
+          } break;
+          case e_LOCAL_SEQUENTIAL: {
+            bdlma::LocalSequentialAllocator<k_BUFFER_SIZE> allocator;
+            result += workload(&allocator, parameters);
+          } break;
+          case e_MULTIPOOL: {
+            bdlma::MultipoolAllocator allocator;
+            result += workload(&allocator, parameters);
+          } break;
+          case e_CONCURRENT_MULTIPOOL: {
+            bdlma::ConcurrentMultipoolAllocator allocator;
+            result += workload(&allocator, parameters);
+          } break;
+          case e_THREAD_CACHING_MULTIPOOL: {
+            bdlma::ThreadCachingMultipoolAllocator allocator;
+            result += workload(&allocator, parameters);
+          } break;
+          default: {
+            BSLS_ASSERT_INVOKE_NORETURN("unreachable");
+          }
+        }
+    }
+
+    g_sink = result;
+}
+
+/// This `struct` holds the arguments of a thread of the `threaded`
+/// workload.
+struct ThreadArgs {
+    Subject            d_subject;
+    bslma::Allocator  *d_shared_p;
+    const Parameters  *d_parameters_p;
+};
+
+extern "C" void *runThread(void *arg)
+{
+    const ThreadArgs& args = *static_cast<ThreadArgs *>(arg);
+
+    runIterations(churn,
+                  args.d_subject,
+                  args.d_shared_p,
+                  *args.d_parameters_p);
+    return 0;
+}
+
+/// Return the time, in seconds, taken by the specified `numThreads` threads
+/// to run `churn` using the specified `subject` with the specified
+/// `parameters`.
+double timeThreaded(Subject subject, int numThreads,
+                    const Parameters& parameters)
+{
+    bdlma::ConcurrentMultipoolAllocator    concurrentMultipool;
+    bdlma::ThreadCachingMultipoolAllocator threadCaching;
+
+    bslma::Allocator *shared = 0;
+    switch (subject) {
+      case e_NEW_DELETE: {
+        shared = &bslma::NewDeleteAllocator::singleton();
+      } break;
+      case e_CONCURRENT_MULTIPOOL: {
+        shared = &concurrentMultipool;
+      } break;
+      case e_THREAD_CACHING_MULTIPOOL: {
+        shared = &threadCaching;
+      } break;
+      default: {
+      } break;
+    }
+
+    ThreadArgs                             args = { subject,
+                                                    shared,
+                                                    &parameters };
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    for (int i = 0; i < numThreads; ++i) {
+        if (0 != bslmt::ThreadUtil::create(&handles[i], runThread, &args)) {
+            bsl::cerr << "Failed to create thread " << i << bsl::endl;
+            bsl::exit(1);
+        }
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    timer.stop();
+    return timer.accumulatedWallTime();
+}
+
+/// Return the time, in seconds, taken to run the specified `workload` using
+/// the specified `subject` with the specified `parameters`.
+double timeWorkload(WorkloadFunction  workload,
+                    Subject           subject,
+                    const Parameters& parameters)
+{
+    // Run one warm-up iteration, so that the singletons and the heap are
+    // initialized before measurement.
+
+    Parameters warmUp(parameters);
+    warmUp.d_iterations = 1;
+    runIterations(workload, subject, 0, warmUp);
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+    runIterations(workload, subject, 0, parameters);
+    timer.stop();
+
+    return timer.accumulatedWallTime();
+}
+
+// ============================================================================
+//                                 OUTPUT
+// ----------------------------------------------------------------------------
+
+/// Write the specified `results` of a run with the specified `parameters`
+/// as a JSON document to the standard output.
+void printJson(const bsl::vector<Result>& results,
+               const Parameters&          parameters)
+{
+    bsl::printf("{\n");
+    bsl::printf("  \"benchmark\": \"allocators\",\n");
+    bsl::printf("  \"version\": \"%s\",\n", bdlscm::Version::version());
+    bsl::printf("  \"iterations\": %d,\n", parameters.d_iterations);
+    bsl::printf("  \"scale\": %d,\n", parameters.d_scale);
+    bsl::printf("  \"results\": [\n");
+
+    for (bsl::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        bsl::printf("    {\"workload\": \"%s\", \"allocator\": \"%s\", "
+                    "\"threads\": %d, \"shared\": %s, \"seconds\": %.6f, "
+                    "\"ns_per_element\": %.3f}%s\n",
+                    r.d_workload,
+                    r.d_allocator,
+                    r.d_numThreads,
+                    r.d_isShared ? "true" : "false",
+                    r.d_seconds,
+                    r.d_nsPerElement,
+                    i + 1 < results.size() ? "," : "");
+    }
+
+    bsl::printf("  ]\n");
+    bsl::printf("}\n");
+}
+
+/// Write the specified `results` as a table to the standard output.
+void printTable(const bsl::vector<Result>& results)
+{
+    bsl::printf("%-10s %-20s %8s %7s %12s %12s\n",
+                "workload",
+                "allocator",
+                "threads",
+                "shared",
+                "seconds",
+                "ns/element");
+
+    for (bsl::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        bsl::printf("%-10s %-20s %8d %7s %12.6f %12.3f\n",
+                    r.d_workload,
+                    r.d_allocator,
+                    r.d_numThreads,
+                    r.d_isShared ? "yes" : "no",
+                    r.d_seconds,
+                    r.d_nsPerElement);
+    }
+}
+
+void usage(const char *program)
+{
+    bsl::cerr << "usage: " << program
+              << " [--workload churn|mix|threaded]"
+                 " [--allocator <name>]"
+                 " [--iterations <n>] [--scale <n>] [--threads <n>]"
+                 " [--json]\n"
+                 "allocators:";
+    for (int i = 0; i < k_NUM_SUBJECTS; ++i) {
+        bsl::cerr << ' ' << SUBJECT_NAMES[i];
+    }
+    bsl::cerr << bsl::endl;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Parameters parameters = { 200, 1000, 4 };
+
+    const char *workloadName  = 0;
+    const char *allocatorName = 0;
+    bool        json          = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg   = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : 0;
+
+        if (0 == bsl::strcmp(arg, "--json")) {
+            json = true;
+            continue;
+        }
+        if (0 == value) {
+            usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+        ++i;
+
+        if (0 == bsl::strcmp(arg, "--workload")) {
+            workloadName = value;
+        }
+        else if (0 == bsl::strcmp(arg, "--allocator")) {
+            allocatorName = value;
+        }
+        else if (0 == bsl::strcmp(arg, "--iterations")) {
+            parameters.d_iterations = bsl::atoi(value);
+        }
+        else if (0 == bsl::strcmp(arg, "--scale")) {
+            parameters.d_scale = bsl::atoi(value);
+        }
+        else if (0 == bsl::strcmp(arg, "--threads")) {
+            parameters.d_numThreads = bsl::atoi(value);
+        }
+        else {
+            usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    if (parameters.d_iterations <= 0
+     || parameters.d_scale      <= 0
+     || parameters.d_numThreads <= 0) {
+        usage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    bsl::vector<Result> results;
+
+    for (int s = 0; s < k_NUM_SUBJECTS; ++s) {
+        const Subject     subject = static_cast<Subject>(s);
+        const char *const name    = SUBJECT_NAMES[s];
+
+        if (allocatorName && 0 != bsl::strcmp(allocatorName, name)) {
+            continue;
+        }
+
+        const double numElements = static_cast<double>(
+                                                      parameters.d_iterations)
+                                 * parameters.d_scale;
+
+        if (!workloadName || 0 == bsl::strcmp(workloadName, "churn")) {
+            const double seconds = timeWorkload(churn, subject, parameters);
+            const Result result  = { "churn",
+                                     name,
+                                     1,
+                                     false,
+                                     seconds,
+                                     seconds * 1e9 / numElements };
+            results.push_back(result);
+        }
+
+        if (!workloadName || 0 == bsl::strcmp(workloadName, "mix")) {
+            const double seconds = timeWorkload(mix, subject, parameters);
+            const Result result  = { "mix",
+                                     name,
+                                     1,
+                                     false,
+                                     seconds,
+                                     seconds * 1e9 / numElements };
+            results.push_back(result);
+        }
+
+        if (!workloadName || 0 == bsl::strcmp(workloadName, "threaded")) {
+            const int    numThreads = parameters.d_numThreads;
+            const double seconds    = timeThreaded(subject,
+                                                   numThreads,
+                                                   parameters);
+            const Result result     = {
+                                  "threaded",
+                                  name,
+                                  numThreads,
+                                  isThreadSafe(subject),
+                                  seconds,
+                                  seconds * 1e9 / (numElements * numThreads)
+                                      };
+            results.push_back(result);
+        }
+    }
+
+    if (results.empty()) {
+        usage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    if (json) {
+        printJson(results, parameters);
+    }
+    else {
+        printTable(results);
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -380,14 +380,38 @@ int BerDecoder_Node::skipField()
     }
 
     if (BerUtil::k_INDEFINITE_LENGTH != d_expectedLength) {
-        // We would do this, but not every streambuf is seekable:
-        //..
-        //  d_decoder->d_streamBuf->pubseekoff(d_expectedLength,
-        //                                     bsl::ios_base::cur,
-        //..                                   bsl::ios_base::in);
+        int remainLength = d_expectedLength;
+
+        // Seek over the octets that the stream buffer guarantees to be
+        // available, so that a field held in memory is skipped in one step.
+        // Not every stream buffer is seekable, and seeking beyond the octets
+        // available might not detect a truncated field, so read whatever
+        // remains.
+
+        bsl::streambuf *streamBuf = d_decoder->d_streamBuf;
+
+        while (remainLength > 0) {
+            const bsl::streamsize numAvailable = streamBuf->in_avail();
+            if (numAvailable <= 0) {
+                break;
+            }
+
+            const int numSkipped = numAvailable < remainLength
+                                   ? static_cast<int>(numAvailable)
+                                   : remainLength;
+
+            if (bsl::streambuf::pos_type(-1) ==
+                           streamBuf->pubseekoff(numSkipped,
+                                                 bsl::ios_base::cur,
+                                                 bsl::ios_base::in)) {
+                break;
+            }
+
+            d_consumedBodyBytes += numSkipped;
+            remainLength -= numSkipped;
+        }
 
         char buffer[1024];
-        int  remainLength = d_expectedLength;
 
         while (remainLength > 0) {
             int numRead = remainLength < (int)sizeof(buffer)
@@ -20,6 +20,18 @@ BSLS_IDENT("$Id: $")
 // * `bsl::streambuf`
 // * `bsl::istream`
 //
+// and for two types of in-memory input:
+// * `bsl::string_view`, for data held in contiguous memory
+// * `bdlbb::Blob`
+//
+// The in-memory overloads read their input through a stream buffer over the
+// contiguous input, or over the data buffers of the blob, without first
+// copying it; they are otherwise equivalent to decoding from a `streambuf`
+// holding the same data.  When skipping an unknown element of definite length
+// (see `BerDecoderOptions::skipUnknownElements`), the decoder seeks over the
+// octets that its stream buffer reports as available rather than copying
+// them, if the stream buffer supports seeking.
+//
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the `bdlat` framework.
 //
@@ -101,6 +113,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_variant.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bslma_allocator.h>
@@ -115,6 +131,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_istream.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -273,6 +290,20 @@ class BerDecoder {
     template <typename TYPE>
     int decode(bsl::istream& stream, TYPE *variable);
 
+    /// Decode an object of parameterized `TYPE` from the specified `input`
+    /// and load the result into the specified `variable`.  Return 0 on
+    /// success, and a non-zero value otherwise.  Note that `input` is read
+    /// in place, without being copied.
+    template <typename TYPE>
+    int decode(const bsl::string_view& input, TYPE *variable);
+
+    /// Decode an object of parameterized `TYPE` from the data of the
+    /// specified `blob` and load the result into the specified `variable`.
+    /// Return 0 on success, and a non-zero value otherwise.  Note that the
+    /// data buffers of `blob` are read in place, without being copied.
+    template <typename TYPE>
+    int decode(const bdlbb::Blob& blob, TYPE *variable);
+
     /// Decode an object of parameterized `TYPE` from the specified `streamBuf`
     /// and load the result into the specified `variable`.  Return 0 on
     /// success, and a non-zero value otherwise.  Note that this function
@@ -670,6 +701,24 @@ int BerDecoder::decode(bsl::istream& stream, TYPE *variable)
     return 0;
 }
 
+template <typename TYPE>
+inline
+int BerDecoder::decode(const bsl::string_view& input, TYPE *variable)
+{
+    bdlsb::FixedMemInStreamBuf streamBuf(input.data(), input.length());
+
+    return decode(&streamBuf, variable);
+}
+
+template <typename TYPE>
+inline
+int BerDecoder::decode(const bdlbb::Blob& blob, TYPE *variable)
+{
+    bdlbb::InBlobStreamBuf streamBuf(&blob);
+
+    return decode(&streamBuf, variable);
+}
+
 template <typename TYPE>
 int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
 {
@@ -42,6 +42,10 @@
 #include <bdlsb_memoutstreambuf.h>      // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>  // for testing only
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlb_chartype.h>
 #include <bdlb_print.h>
 #include <bdlb_printmethods.h>
@@ -72,6 +76,9 @@
 #include <bsl_iostream.h>
 #include <bsl_iomanip.h>
 #include <bsl_iterator.h>
+#include <bsl_sstream.h>
+#include <bsl_streambuf.h>
+#include <bsl_string_view.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -91,6 +98,8 @@ namespace test = BloombergLP::s_baltst;
 //
 // [19] int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
 // [19] int BerDeocder::decode(bsl::istream&   stream   , TYPE *variable)
+// [26] int decode(const bsl::string_view& input, TYPE *variable);
+// [26] int decode(const bdlbb::Blob& blob, TYPE *variable);
 //
 // [20] int decode(bsl::streambuf *streamBuf, TYPE *variable)
 // ----------------------------------------------------------------------------
@@ -119,9 +128,12 @@ namespace test = BloombergLP::s_baltst;
 // [23] FUZZ TEST BUG (DRQS 175594554)
 // [24] FUZZ TEST BUG (DRQS 175741365)
 // [25] MAXDEPTH IS RESPECTED
-// [26] USAGE EXAMPLE
+// [26] DECODE FROM MEMORY AND BLOBS
+// [27] USAGE EXAMPLE
 //
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: DEFINITE-LENGTH ENCODING
+// [-3] PERFORMANCE TEST: DECODE FROM MEMORY AND BLOBS
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -568,6 +580,26 @@ void verifyTimeTypesLengthAnomalies(bsl::size_t             MAX_LEN,
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
 
+                         // ==========================
+                         // class NonSeekableStreamBuf
+                         // ==========================
+
+/// This class provides an input stream buffer over contiguous memory that,
+/// like a stream buffer reading from a pipe, does not support seeking.
+class NonSeekableStreamBuf : public bsl::streambuf {
+
+  public:
+    // CREATORS
+
+    /// Create a stream buffer reading the specified `length` bytes at the
+    /// specified `data`.
+    NonSeekableStreamBuf(const char *data, bsl::size_t length)
+    {
+        char *begin = const_cast<char *>(data);
+        setg(begin, begin, begin + length);
+    }
+};
+
 // BDE_VERIFY pragma: push
 // BDE_VERIFY pragma: -MR01
 
@@ -2411,7 +2443,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2435,6 +2467,231 @@ int main(int argc, char *argv[])
 
         if (verbose) cout << "\nEnd of test.\n";
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // DECODE FROM MEMORY AND BLOBS
+        //
+        // Concerns:
+        // 1. Decoding from a `bsl::string_view` or a `bdlbb::Blob` produces
+        //    the same value, and the same success or failure, as decoding
+        //    the same data from a `bsl::streambuf`.
+        //
+        // 2. A blob is decoded correctly however its data is divided among
+        //    its buffers, including when a tag, a length, or a value spans
+        //    buffers.
+        //
+        // 3. Truncated input is rejected.
+        //
+        // 4. Unknown elements of definite length, primitive or constructed,
+        //    are skipped, whether or not the stream buffer supports seeking
+        //    and however the skipped octets are divided among blob buffers.
+        //
+        // 5. Skipping an unknown element that is truncated fails.
+        //
+        // Plan:
+        // 1. For each message of the `s_baltst::DepthTestMessageUtil` test
+        //    vectors, encode it and decode it from a `bsl::string_view` and
+        //    from blobs having buffers of several sizes, and verify the
+        //    result against the decoded value from a `bsl::streambuf`.  Then
+        //    decode prefixes of the encoding and verify that each fails.
+        //    (C-1..3)
+        //
+        // 2. Insert unknown elements, one of them larger than the buffer used
+        //    to copy skipped octets, into the encoding of a sequence, and
+        //    decode it from a seekable and a non-seekable stream buffer, a
+        //    `bsl::string_view`, and blobs.  Verify the value and the number
+        //    of elements skipped.  Then decode the encoding truncated within
+        //    the unknown elements, and verify that it fails.  (C-4..5)
+        //
+        // Testing:
+        //   int decode(const bsl::string_view& input, TYPE *variable);
+        //   int decode(const bdlbb::Blob& blob, TYPE *variable);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDECODE FROM MEMORY AND BLOBS"
+                             "\n============================\n";
+
+        static const int BUFFER_SIZES[] = { 1, 2, 3, 7, 64, 1000 };
+        const int        NUM_BUFFER_SIZES = sizeof BUFFER_SIZES /
+                                                         sizeof *BUFFER_SIZES;
+
+        typedef s_baltst::DepthTestMessage     DepthTestMessage;
+        typedef s_baltst::DepthTestMessageUtil DTMU;
+
+        if (verbose) cout << "\nDecoding the test messages.\n";
+
+        for (int i = 0; i < DTMU::k_NUM_MESSAGES; ++i) {
+            const DepthTestMessage& TEST_MESSAGE = DTMU::s_TEST_MESSAGES[i];
+
+            const int LINE = i;
+
+            balb::FeatureTestMessage object;
+            {
+                balxml::MiniReader     reader;
+                balxml::ErrorInfo      errorInfo;
+                balxml::DecoderOptions xmlOptions;
+                xmlOptions.setSkipUnknownElements(true);
+                balxml::Decoder        xmlDecoder(&xmlOptions,
+                                                  &reader,
+                                                  &errorInfo);
+
+                bsl::istringstream ss(TEST_MESSAGE.d_XML_text_p);
+                ASSERTV(LINE, 0 == xmlDecoder.decode(ss.rdbuf(), &object));
+            }
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERTV(LINE, 0 == encoder.encode(&osb, object));
+
+            const bsl::string_view ENCODED(osb.data(), osb.length());
+
+            balber::BerDecoderOptions depthOptions(options);
+            depthOptions.setMaxDepth(TEST_MESSAGE.d_depthBER);
+
+            balber::BerDecoder mX(&depthOptions);
+
+            balb::FeatureTestMessage expected;
+            {
+                bdlsb::FixedMemInStreamBuf isb(ENCODED.data(),
+                                               ENCODED.length());
+                ASSERTV(LINE, 0 == mX.decode(&isb, &expected));
+                ASSERTV(LINE, object == expected);
+            }
+
+            {
+                balb::FeatureTestMessage value;
+                ASSERTV(LINE, 0 == mX.decode(ENCODED, &value));
+                ASSERTV(LINE, expected == value);
+            }
+
+            for (int j = 0; j < NUM_BUFFER_SIZES; ++j) {
+                const int BUFFER_SIZE = BUFFER_SIZES[j];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob,
+                                        ENCODED.data(),
+                                        static_cast<int>(ENCODED.length()));
+
+                balb::FeatureTestMessage value;
+                ASSERTV(LINE, BUFFER_SIZE, 0 == mX.decode(blob, &value));
+                ASSERTV(LINE, BUFFER_SIZE, expected == value);
+            }
+
+            // Truncated input.
+
+            const bsl::size_t PREFIXES[] = {
+                0, 1, ENCODED.length() / 2, ENCODED.length() - 1
+            };
+            const int NUM_PREFIXES = sizeof PREFIXES / sizeof *PREFIXES;
+
+            for (int j = 0; j < NUM_PREFIXES; ++j) {
+                const bsl::string_view PREFIX = ENCODED.substr(0, PREFIXES[j]);
+
+                balb::FeatureTestMessage value;
+                ASSERTV(LINE, PREFIX.length(), 0 != mX.decode(PREFIX, &value));
+
+                bdlbb::SimpleBlobBufferFactory factory(3, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob,
+                                        PREFIX.data(),
+                                        static_cast<int>(PREFIX.length()));
+                ASSERTV(LINE, PREFIX.length(), 0 != mX.decode(blob, &value));
+            }
+        }
+
+        if (verbose) cout << "\nSkipping unknown elements.\n";
+        {
+            test::MySequence object;
+            object.attribute1() = 17;
+            object.attribute2() = "Hello";
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == encoder.encode(&osb, object));
+
+            // The sequence is encoded with indefinite length.  Insert after
+            // its identifier and length octets an unknown primitive element
+            // (context-specific tag 5) of 3000 octets, and an unknown
+            // constructed element (context-specific tag 6) of definite
+            // length holding a primitive element.
+
+            bsl::string encoded(osb.data(), osb.length(), &ta);
+            ASSERT(2 < encoded.length());
+            ASSERT('\x30' == encoded[0]);
+            ASSERT('\x80' == encoded[1]);
+
+            bsl::string unknown(&ta);
+            unknown.append("\x85\x82\x0b\xb8", 4);
+            unknown.append(3000, 'x');
+            unknown.append("\xa6\x05\x87\x03" "abc", 7);
+
+            encoded.insert(2, unknown);
+
+            const bsl::string_view ENCODED(encoded);
+
+            {
+                test::MySequence value;
+                ASSERT(0 == decoder.decode(ENCODED, &value));
+                ASSERT(object == value);
+                ASSERT(2 == decoder.numUnknownElementsSkipped());
+            }
+
+            {
+                test::MySequence   value;
+                bsl::istringstream iss(encoded);
+                ASSERT(0 == decoder.decode(iss, &value));
+                ASSERT(object == value);
+                ASSERT(2 == decoder.numUnknownElementsSkipped());
+            }
+
+            {
+                test::MySequence     value;
+                NonSeekableStreamBuf isb(ENCODED.data(), ENCODED.length());
+                ASSERT(0 == decoder.decode(&isb, &value));
+                ASSERT(object == value);
+                ASSERT(2 == decoder.numUnknownElementsSkipped());
+            }
+
+            for (int j = 0; j < NUM_BUFFER_SIZES; ++j) {
+                const int BUFFER_SIZE = BUFFER_SIZES[j];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob,
+                                        ENCODED.data(),
+                                        static_cast<int>(ENCODED.length()));
+
+                test::MySequence value;
+                ASSERTV(BUFFER_SIZE, 0 == decoder.decode(blob, &value));
+                ASSERTV(BUFFER_SIZE, object == value);
+                ASSERTV(BUFFER_SIZE,
+                        2 == decoder.numUnknownElementsSkipped());
+            }
+
+            // Truncated within the first, and within the second, unknown
+            // element.
+
+            const bsl::size_t PREFIXES[] = { 1000, 2 + unknown.length() - 2 };
+            const int         NUM_PREFIXES = sizeof PREFIXES /
+                                                             sizeof *PREFIXES;
+
+            for (int j = 0; j < NUM_PREFIXES; ++j) {
+                const bsl::string_view PREFIX = ENCODED.substr(0, PREFIXES[j]);
+
+                test::MySequence value;
+                ASSERTV(PREFIX.length(), 0 != decoder.decode(PREFIX, &value));
+
+                NonSeekableStreamBuf isb(PREFIX.data(), PREFIX.length());
+                ASSERTV(PREFIX.length(), 0 != decoder.decode(&isb, &value));
+
+                bdlbb::SimpleBlobBufferFactory factory(7, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob,
+                                        PREFIX.data(),
+                                        static_cast<int>(PREFIX.length()));
+                ASSERTV(PREFIX.length(), 0 != decoder.decode(blob, &value));
+            }
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // MAXDEPTH IS RESPECTED
@@ -8626,6 +8883,248 @@ int main(int argc, char *argv[])
              << elapsed          << " seconds, "
              << (reps / elapsed) << " reps/sec\n";
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DEFINITE-LENGTH ENCODING
+        //   Compare the indefinite-length and definite-length encodings of a
+        //   large message: the cost of encoding, the size of the output, the
+        //   cost of decoding, and the cost of decoding when the bulk of the
+        //   message is an element unknown to the decoder that must be
+        //   skipped.
+        //
+        // Plan:
+        // 1. Create a `BigRecord` having a large array of `BasicRecord`
+        //    objects.
+        //
+        // 2. For each encoding mode, encode the record repeatedly and report
+        //    the elapsed time and the size of the output.
+        //
+        // 3. Decode the output repeatedly and verify the decoded value.
+        //
+        // 4. Change the tag number of the encoded array element to one that
+        //    is unknown to `BigRecord`, decode the output repeatedly having
+        //    the `skipUnknownElements` option set, and verify that the array
+        //    is skipped.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: DEFINITE-LENGTH ENCODING
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE TEST: DEFINITE-LENGTH ENCODING"
+                "\n==========================================\n";
+
+        const int reps      = argc > 2 ? bsl::atoi(argv[2]) : 100;
+        const int arraySize = argc > 3 ? bsl::atoi(argv[3]) : 10000;
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 22;
+        basicRec.dt() = bdlt::DatetimeTz(
+                                  bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                 bdlt::Time(16, 30)), 0);
+        basicRec.s() = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        bigRec.array().resize(arraySize, basicRec);
+
+        cout << "bigRecord with array size of " << arraySize << ", "
+             << reps << " repetitions\n";
+
+        bsls::Stopwatch stopwatch;
+
+        for (int definite = 0; definite < 2; ++definite) {
+            cout << (definite ? "  definite length:\n"
+                              : "  indefinite length:\n");
+
+            balber::BerEncoderOptions encoderOptions;
+            encoderOptions.setEncodeDefiniteLength(definite);
+
+            bdlsb::MemOutStreamBuf osb;
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < reps; ++i) {
+                osb.pubseekpos(0);
+                balber::BerEncoder encoder(&encoderOptions);
+                ASSERT(0 == encoder.encode(&osb, bigRec));
+            }
+            stopwatch.stop();
+
+            cout << "    encode:               "
+                 << stopwatch.elapsedTime() << " seconds, "
+                 << osb.length()            << " bytes\n";
+
+            bsl::string encoded(osb.data(), osb.length());
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < reps; ++i) {
+                test::BigRecord    value;
+                balber::BerDecoder decoder;
+                ASSERT(0 == decoder.decode(encoded, &value));
+                if (0 == i) {
+                    ASSERT(bigRec == value);
+                }
+            }
+            stopwatch.stop();
+
+            cout << "    decode:               "
+                 << stopwatch.elapsedTime() << " seconds\n";
+
+            // Retag the array element (context-specific, constructed, tag
+            // number 1) as tag number 5, which `BigRecord` does not have.
+            // The array follows the outer identifier and length octets and
+            // the `name` element, whose length is below 128.
+
+            bsl::size_t pos = 1;
+            const unsigned char lengthOctet =
+                                 static_cast<unsigned char>(encoded[pos]);
+            pos += 1 + (lengthOctet > 0x80 ? lengthOctet & 0x7F : 0);
+            ASSERT(0x80 == static_cast<unsigned char>(encoded[pos]));
+            pos += 2 + static_cast<unsigned char>(encoded[pos + 1]);
+            ASSERT(0xA1 == static_cast<unsigned char>(encoded[pos]));
+            encoded[pos] = static_cast<char>(0xA5);
+
+            balber::BerDecoderOptions decoderOptions;
+            decoderOptions.setSkipUnknownElements(true);
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < reps; ++i) {
+                test::BigRecord    value;
+                balber::BerDecoder decoder(&decoderOptions);
+                ASSERT(0 == decoder.decode(encoded, &value));
+                if (0 == i) {
+                    ASSERT(bigRec.name() == value.name());
+                    ASSERT(value.array().empty());
+                    ASSERT(1 == decoder.numUnknownElementsSkipped());
+                }
+            }
+            stopwatch.stop();
+
+            cout << "    skip unknown element: "
+                 << stopwatch.elapsedTime() << " seconds\n";
+        }
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DECODE FROM MEMORY AND BLOBS
+        //   Compare the cost of decoding a message held in memory through a
+        //   `bsl::streambuf`, a `bsl::string_view`, and `bdlbb::Blob` objects
+        //   having buffers of several sizes.
+        //
+        // Plan:
+        // 1. Create a `BigRecord` having a large array of `BasicRecord`
+        //    objects, and encode it with indefinite (the default) and with
+        //    definite lengths.
+        //
+        // 2. For each encoding, decode the output repeatedly from a
+        //    `bdlsb::FixedMemInStreamBuf`, from a `bsl::string_view`, and
+        //    from blobs having buffers of 64, 1024, and 65536 bytes, verify
+        //    the decoded value, and report the elapsed time.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: DECODE FROM MEMORY AND BLOBS
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE TEST: DECODE FROM MEMORY AND BLOBS"
+                "\n==============================================\n";
+
+        const int reps      = argc > 2 ? bsl::atoi(argv[2]) : 100;
+        const int arraySize = argc > 3 ? bsl::atoi(argv[3]) : 10000;
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 22;
+        basicRec.dt() = bdlt::DatetimeTz(
+                                  bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                 bdlt::Time(16, 30)), 0);
+        basicRec.s() = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        bigRec.array().resize(arraySize, basicRec);
+
+        cout << "bigRecord with array size of " << arraySize << ", "
+             << reps << " repetitions\n";
+
+        static const int BUFFER_SIZES[] = { 64, 1024, 65536 };
+        enum { NUM_BUFFER_SIZES = sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES };
+
+        bsls::Stopwatch stopwatch;
+
+        for (int definite = 0; definite < 2; ++definite) {
+            cout << (definite ? "  definite length:\n"
+                              : "  indefinite length:\n");
+
+            balber::BerEncoderOptions encoderOptions;
+            encoderOptions.setEncodeDefiniteLength(definite);
+
+            bdlsb::MemOutStreamBuf osb;
+            balber::BerEncoder     encoder(&encoderOptions);
+            ASSERT(0 == encoder.encode(&osb, bigRec));
+
+            const bsl::string_view encoded(osb.data(), osb.length());
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < reps; ++i) {
+                bdlsb::FixedMemInStreamBuf isb(encoded.data(),
+                                               encoded.length());
+                test::BigRecord            value;
+                balber::BerDecoder         decoder;
+                ASSERT(0 == decoder.decode(&isb, &value));
+                if (0 == i) {
+                    ASSERT(bigRec == value);
+                }
+            }
+            stopwatch.stop();
+
+            cout << "    streambuf:   "
+                 << stopwatch.elapsedTime() << " seconds\n";
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < reps; ++i) {
+                test::BigRecord    value;
+                balber::BerDecoder decoder;
+                ASSERT(0 == decoder.decode(encoded, &value));
+                if (0 == i) {
+                    ASSERT(bigRec == value);
+                }
+            }
+            stopwatch.stop();
+
+            cout << "    string_view: "
+                 << stopwatch.elapsedTime() << " seconds\n";
+
+            for (int j = 0; j < NUM_BUFFER_SIZES; ++j) {
+                const int BUFFER_SIZE = BUFFER_SIZES[j];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+                bdlbb::Blob                    blob(&factory);
+                bdlbb::BlobUtil::append(&blob,
+                                        encoded.data(),
+                                        static_cast<int>(encoded.length()));
+
+                stopwatch.reset();
+                stopwatch.start();
+                for (int i = 0; i < reps; ++i) {
+                    test::BigRecord    value;
+                    balber::BerDecoder decoder;
+                    ASSERT(0 == decoder.decode(blob, &value));
+                    if (0 == i) {
+                        ASSERT(bigRec == value);
+                    }
+                }
+                stopwatch.stop();
+
+                cout << "    blob (" << BUFFER_SIZE << "): "
+                     << stopwatch.elapsedTime() << " seconds\n";
+            }
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
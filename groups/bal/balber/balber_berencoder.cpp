@@ -19,6 +19,44 @@ balber::BerEncoder::MemOutStream::~MemOutStream()
 {
 }
 
+                 // -------------------------------------------
+                 // class balber::BerEncoder::CountingStreamBuf
+                 // -------------------------------------------
+
+// CREATORS
+balber::BerEncoder::CountingStreamBuf::CountingStreamBuf()
+: d_count(0)
+{
+    setp(d_buffer, d_buffer + k_BUFFER_SIZE);
+}
+
+balber::BerEncoder::CountingStreamBuf::~CountingStreamBuf()
+{
+}
+
+// PROTECTED MANIPULATORS
+balber::BerEncoder::CountingStreamBuf::int_type
+balber::BerEncoder::CountingStreamBuf::overflow(int_type c)
+{
+    d_count += pptr() - pbase();
+    setp(d_buffer, d_buffer + k_BUFFER_SIZE);
+
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+
+    return traits_type::not_eof(c);
+}
+
+bsl::streamsize
+balber::BerEncoder::CountingStreamBuf::xsputn(const char      *,
+                                              bsl::streamsize  length)
+{
+    d_count += length;
+    return length;
+}
+
 namespace balber {
 
                               // ----------------
@@ -35,6 +73,10 @@ BerEncoder::BerEncoder(const BerEncoderOptions *options,
 , d_streamBuf          (0)
 , d_currentDepth       (0)
 , d_useArrayLengthHint (true)
+, d_lengthMode         (e_INDEFINITE_LENGTH)
+, d_lengths            (d_allocator)
+, d_openLengths        (d_allocator)
+, d_nextLength         (0)
 {
 }
 
@@ -25,6 +25,29 @@ BSLS_IDENT("$Id: $")
 // Note that encoding top-level `array` objects (a.k.a. `sequence-of` types, in
 // the X.680-X.693 specs) is not allowed.
 //
+///Definite-Length Encoding
+///------------------------
+// By default, constructed elements (sequences, choices, arrays, and nillable
+// values) are written using the indefinite-length form: an indefinite-length
+// octet, followed by the contents, followed by two end-of-contents octets.
+// This allows the encoder to write its output in a single pass, but requires
+// a decoder to parse the entire contents of an element, recursively, in order
+// to find its end, which is expensive when skipping unknown elements.
+//
+// If the `encodeDefiniteLength` attribute of the supplied `BerEncoderOptions`
+// is `true`, the encoder instead writes each constructed element with an
+// explicit length.  Since a `bsl::streambuf` cannot, in general, be
+// repositioned to back-patch a length once the contents have been written,
+// the encoder first traverses `value` writing to an internal streambuf that
+// only counts the octets it is given, recording the length of the contents of
+// every constructed element in the order in which the elements are started.
+// The encoder then traverses `value` a second time, writing to the supplied
+// streambuf and taking each length from the recorded sequence.  Nothing is
+// written to the supplied streambuf if the first traversal fails.  The output
+// is slightly smaller (definite lengths below 128 octets take a single octet,
+// whereas an indefinite-length element requires three), but encoding costs
+// roughly twice as much as in the default mode.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -187,8 +210,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_keyword.h>
 #include <bsls_objectbuffer.h>
+#include <bsls_types.h>
 
 #include <bsl_ostream.h>
+#include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bsl_typeinfo.h>
@@ -266,6 +291,62 @@ class BerEncoder {
         int length() const;
     };
 
+    /// This class provides a stream buffer that discards the characters
+    /// written to it, keeping only a count of them.  It is used to compute
+    /// the encoded length of constructed elements when encoding in the
+    /// definite-length mode.
+    class CountingStreamBuf : public bsl::streambuf {
+
+        // PRIVATE CONSTANTS
+        enum { k_BUFFER_SIZE = 256 };
+
+        // DATA
+        char                d_buffer[k_BUFFER_SIZE];  // scratch put area
+        bsls::Types::Int64  d_count;                  // number of characters
+                                                      // flushed from the put
+                                                      // area
+
+      private:
+        // NOT IMPLEMENTED
+        CountingStreamBuf(const CountingStreamBuf&);             // = delete;
+        CountingStreamBuf& operator=(const CountingStreamBuf&);  // = delete;
+
+      protected:
+        // PROTECTED MANIPULATORS
+
+        /// Count the characters in the put area, reset the put area, and
+        /// then append the specified `c` unless it is end-of-file.  Return
+        /// `traits_type::not_eof(c)`.
+        int_type overflow(int_type c) BSLS_KEYWORD_OVERRIDE;
+
+        /// Count the specified `length` characters at the specified
+        /// `source` without storing them, and return `length`.
+        bsl::streamsize xsputn(const char      *source,
+                               bsl::streamsize  length) BSLS_KEYWORD_OVERRIDE;
+
+      public:
+        // CREATORS
+
+        /// Create a `CountingStreamBuf` object having a count of 0.
+        CountingStreamBuf();
+
+        /// Destroy this object.
+        ~CountingStreamBuf() BSLS_KEYWORD_OVERRIDE;
+
+        // ACCESSORS
+
+        /// Return the number of characters written to this stream buffer.
+        bsls::Types::Int64 position() const;
+    };
+
+    /// This enumeration defines the way the length of constructed elements
+    /// is written during the current traversal of the value being encoded.
+    enum LengthMode {
+        e_INDEFINITE_LENGTH,  // write the indefinite-length form
+        e_MEASURE_LENGTH,     // compute the contents length of each element
+        e_DEFINITE_LENGTH     // write the lengths computed earlier
+    };
+
   public:
     // PUBLIC TYPES
     enum ErrorSeverity {
@@ -299,6 +380,27 @@ class BerEncoder {
                                                         // encode the array
                                                         // length hint
 
+    LengthMode                        d_lengthMode;     // how lengths of
+                                                        // constructed
+                                                        // elements are
+                                                        // written
+
+    bsl::vector<bsls::Types::Int64>   d_lengths;        // contents lengths
+                                                        // (or, while open,
+                                                        // start positions) of
+                                                        // constructed elements
+                                                        // in the order they
+                                                        // are started
+
+    bsl::vector<bsl::size_t>          d_openLengths;    // indices in
+                                                        // 'd_lengths' of the
+                                                        // elements being
+                                                        // measured
+
+    bsl::size_t                       d_nextLength;     // index in
+                                                        // 'd_lengths' of the
+                                                        // next length to write
+
   private:
     // NOT IMPLEMENTED
     BerEncoder(const BerEncoder&);             // = delete;
@@ -324,6 +426,27 @@ class BerEncoder {
     /// created yet, it will be created during this call.
     bsl::ostream& logStream();
 
+    /// Write the length octets that start the contents of a constructed
+    /// element according to the current length mode: the indefinite-length
+    /// octet, nothing (while measuring), or the next recorded definite
+    /// length.  Return 0 on success, and a non-zero value otherwise.  Each
+    /// call must be matched by a call to `endContents`.
+    int beginContents();
+
+    /// Finish the contents of the constructed element most recently started
+    /// by `beginContents` according to the current length mode: write the
+    /// end-of-contents octets, record the length of the contents (while
+    /// measuring), or do nothing.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    int endContents();
+
+    /// Encode the specified `value` to the specified `streamBuf` using the
+    /// options held by this object, traversing `value` twice if the
+    /// definite-length encoding is requested.  Return 0 on success, and a
+    /// non-zero value otherwise.
+    template <typename TYPE>
+    int encodeValue(bsl::streambuf *streamBuf, const TYPE& value);
+
     int encodeImpl(const bsl::vector<char>&  value,
                    BerConstants::TagClass    tagClass,
                    int                       tagNumber,
@@ -634,6 +757,17 @@ int balber::BerEncoder::MemOutStream::length() const
     return static_cast<int>(d_sb.length());
 }
 
+                 // -------------------------------------------
+                 // class balber::BerEncoder::CountingStreamBuf
+                 // -------------------------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 balber::BerEncoder::CountingStreamBuf::position() const
+{
+    return d_count + (pptr() - pbase());
+}
+
 namespace balber {
 
                         // ----------------------------
@@ -747,36 +881,24 @@ int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
 {
     BSLS_ASSERT(!d_streamBuf);
 
-    d_streamBuf = streamBuf;
     d_severity  = e_BER_SUCCESS;
 
     if (d_logStream != 0) {
         d_logStream->reset();
     }
 
-    d_currentDepth = 0;
-
     int rc;
 
     if (! d_options) {
         BerEncoderOptions options;  // temporary options object
         d_options = &options;
-        BerEncoder_UniversalElementVisitor visitor(
-                                              this,
-                                              bdlat_FormattingMode::e_DEFAULT);
-
-        rc = visitor(value);
+        rc = encodeValue(streamBuf, value);
         d_options = 0;
     }
     else {
-        BerEncoder_UniversalElementVisitor visitor(
-                                              this,
-                                              bdlat_FormattingMode::e_DEFAULT);
-        rc = visitor(value);
+        rc = encodeValue(streamBuf, value);
     }
 
-    d_streamBuf = 0;
-
     streamBuf->pubsync();
 
     return rc;
@@ -811,6 +933,111 @@ int BerEncoder::encodeAny(bsl::ostream& stream, const TYPE& value)
 }
 
 // PRIVATE MANIPULATORS
+inline
+int BerEncoder::beginContents()
+{
+    switch (d_lengthMode) {
+      case e_INDEFINITE_LENGTH: {
+        return BerUtil::putIndefiniteLengthOctet(d_streamBuf);        // RETURN
+      }
+      case e_MEASURE_LENGTH: {
+        d_openLengths.push_back(d_lengths.size());
+        d_lengths.push_back(
+                 static_cast<CountingStreamBuf *>(d_streamBuf)->position());
+        return 0;                                                     // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        BSLS_ASSERT(d_nextLength < d_lengths.size());
+
+        const int length = static_cast<int>(d_lengths[d_nextLength++]);
+        return BerUtil::putLength(d_streamBuf, length);               // RETURN
+      }
+    }
+    return -1;
+}
+
+inline
+int BerEncoder::endContents()
+{
+    switch (d_lengthMode) {
+      case e_INDEFINITE_LENGTH: {
+        return BerUtil::putEndOfContentOctets(d_streamBuf);           // RETURN
+      }
+      case e_MEASURE_LENGTH: {
+        BSLS_ASSERT(!d_openLengths.empty());
+
+        CountingStreamBuf *counter =
+                                 static_cast<CountingStreamBuf *>(d_streamBuf);
+
+        bsls::Types::Int64& length = d_lengths[d_openLengths.back()];
+        d_openLengths.pop_back();
+
+        length = counter->position() - length;
+        if (length > 0x7FFFFFFF) {
+            return -1;                                                // RETURN
+        }
+
+        // Account for the length octets of this element, which will precede
+        // its contents in the output, by writing them to the counter.
+
+        const int intLength = static_cast<int>(length);
+        return BerUtil::putLength(counter, intLength);                // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        return 0;                                                     // RETURN
+      }
+    }
+    return -1;
+}
+
+template <typename TYPE>
+int BerEncoder::encodeValue(bsl::streambuf *streamBuf, const TYPE& value)
+{
+    BSLS_ASSERT(!d_streamBuf);
+
+    int rc;
+
+    if (d_options->encodeDefiniteLength()) {
+        CountingStreamBuf counter;
+
+        d_lengths.clear();
+        d_openLengths.clear();
+        d_lengthMode   = e_MEASURE_LENGTH;
+        d_streamBuf    = &counter;
+        d_currentDepth = 0;
+
+        BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+        rc = visitor(value);
+
+        d_streamBuf = 0;
+
+        if (0 != rc) {
+            d_lengthMode = e_INDEFINITE_LENGTH;
+            return rc;                                                // RETURN
+        }
+
+        BSLS_ASSERT(d_openLengths.empty());
+
+        d_lengthMode = e_DEFINITE_LENGTH;
+        d_nextLength = 0;
+    }
+
+    d_streamBuf    = streamBuf;
+    d_currentDepth = 0;
+
+    BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+    rc = visitor(value);
+
+    d_streamBuf  = 0;
+    d_lengthMode = e_INDEFINITE_LENGTH;
+
+    return rc;
+}
+
 template <typename TYPE>
 int BerEncoder::encodeImpl(const TYPE&                value,
                            BerConstants::TagClass     tagClass,
@@ -828,7 +1055,7 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+    if (rc | beginContents()) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -843,7 +1070,7 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           BerConstants::e_CONTEXT_SPECIFIC,
                                           tagType,
                                           0);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | beginContents()) {
             return k_FAILURE;
         }
     }
@@ -877,10 +1104,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // Don't waste time checking the result of this call -- the only thing
         // that can go wrong is eof, which will happen again when we call it
         // again below.
-        BerUtil::putEndOfContentOctets(d_streamBuf);
+        endContents();
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return endContents();
 }
 
 template <typename TYPE>
@@ -904,7 +1131,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
                                               tagClass,
                                               BerConstants::e_CONSTRUCTED,
                                               tagNumber);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | beginContents()) {
             return k_FAILURE;
         }
 
@@ -922,7 +1149,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
             }
         } // end of bdlat_NullableValueFunctions::isNull(...)
 
-        return BerUtil::putEndOfContentOctets(d_streamBuf);
+        return endContents();
     } // end of isNillable
 
     if (!bdlat_NullableValueFunctions::isNull(value)) {
@@ -998,13 +1225,13 @@ int BerEncoder::encodeImpl(const TYPE&                  value,
                                           tagClass,
                                           BerConstants::e_CONSTRUCTED,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= beginContents();
     if (rc) {
         return rc;
     }
 
     rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
-    rc |= BerUtil::putEndOfContentOctets(d_streamBuf);
+    rc |= endContents();
 
     return rc;
 }
@@ -1079,7 +1306,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
                                        tagClass,
                                        tagType,
                                        tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= beginContents();
     if (rc) {
         return k_FAILURE;                                             // RETURN
     }
@@ -1098,7 +1325,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
         }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return endContents();
 }
 
 template <typename TYPE>
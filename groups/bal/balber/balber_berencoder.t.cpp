@@ -91,7 +91,8 @@ using bsl::flush;
 // [12] ARRAYS WITH `encodeEmptyArrays` OPTION {DRQS 29114951 <GO>}
 // [13] ARRAYS WITH `encodeArrayLengthHints` OPTION
 // [14] DATE/TIME COMPONENTS
-// [15] USAGE EXAMPLE
+// [15] DEFINITE-LENGTH ENCODING
+// [16] USAGE EXAMPLE
 //
 // [-1] PERFORMANCE TEST
 
@@ -253,6 +254,50 @@ void printDiagnostic(balber::BerEncoder & encoder)
     }
 }
 
+/// Verify that the specified `length` octets at the specified `data` consist
+/// of complete BER elements that all use the definite-length form, descending
+/// into the contents of constructed elements.  Return the number of
+/// constructed elements found on success, and -1 otherwise.
+int countDefiniteLengthElements(const char *data, int length)
+{
+    bdlsb::FixedMemInStreamBuf isb(data, length);
+
+    int numConstructed = 0;
+    int offset         = 0;
+
+    while (offset < length) {
+        balber::BerConstants::TagClass tagClass;
+        balber::BerConstants::TagType  tagType;
+        int                            tagNumber;
+        int                            contentsLength;
+
+        if (0 != balber::BerUtil::getIdentifierOctets(&isb,
+                                                      &tagClass,
+                                                      &tagType,
+                                                      &tagNumber,
+                                                      &offset)
+         || 0 != balber::BerUtil::getLength(&isb, &contentsLength, &offset)
+         || contentsLength < 0
+         || contentsLength > length - offset) {
+            return -1;                                                // RETURN
+        }
+
+        if (balber::BerConstants::e_CONSTRUCTED == tagType) {
+            const int numNested = countDefiniteLengthElements(data + offset,
+                                                              contentsLength);
+            if (numNested < 0) {
+                return -1;                                            // RETURN
+            }
+            numConstructed += 1 + numNested;
+        }
+
+        offset += contentsLength;
+        isb.pubseekpos(offset);
+    }
+
+    return numConstructed;
+}
+
 // ============================================================================
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -835,7 +880,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -857,6 +902,264 @@ int main(int argc, char *argv[])
                              "\n=============\n";
         usageExample();
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // DEFINITE-LENGTH ENCODING
+        //
+        // Concerns:
+        // 1. If the `encodeDefiniteLength` option is not set, constructed
+        //    elements are encoded using the indefinite-length form, exactly
+        //    as before.
+        //
+        // 2. If the `encodeDefiniteLength` option is set, every constructed
+        //    element (sequence, choice, array, and nillable value) is
+        //    encoded using the definite-length form, and its length is the
+        //    exact size of its contents.
+        //
+        // 3. Lengths of 128 octets or more are encoded using the long form.
+        //
+        // 4. Array length hints are encoded correctly in both modes.
+        //
+        // 5. The same encoder object can be used to encode several values.
+        //
+        // 6. If encoding fails, nothing is written to the output stream
+        //    buffer in the definite-length mode.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, encode `MySequenceWithArray`
+        //    objects having arrays of several sizes with and without array
+        //    length hints, and verify the output.  (C-2, 4)
+        //
+        // 2. For a set of values of different constructed types, encode each
+        //    value with and without the option, verify that the default
+        //    output is unchanged, and verify that every element of the
+        //    definite-length output has a definite length that spans exactly
+        //    its contents.  Encode each value twice with the same encoder
+        //    and verify that the output is the same.  (C-1..3, 5)
+        //
+        // 3. Encode an unselected choice with the
+        //    `disableUnselectedChoiceEncoding` option set and verify that
+        //    encoding fails and nothing is written.  (C-6)
+        //
+        // Testing:
+        //   DEFINITE-LENGTH ENCODING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDEFINITE-LENGTH ENCODING"
+                             "\n========================\n";
+
+        if (verbose) cout << "\tVerify encoding of `MySequenceWithArray`.\n";
+        {
+            static const struct {
+                int         d_lineNum;   // source line number
+                int         d_size;      // size of array
+                bool        d_useHints;  // whether to use array length hints
+                const char *d_exp;       // expected output
+            } DATA[] = {
+    //----------^
+    //ln  size  hints  exp
+    //--  ----  -----  -----------------------------------------------------
+    { L_,    0,     0, "30058001 17a100"                                     },
+    { L_,    0,     1, "30058001 17a100"                                     },
+    { L_,    1,     0, "30078001 17a1020c 00"                                },
+    { L_,    1,     1, "30078001 17a1020c 00"                                },
+    { L_,    2,     0, "30098001 17a1040c 000c00"                            },
+    { L_,    2,     1, "30118001 179f87ff ffff7f01 02a1040c 000c00"          },
+    //----------v
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_lineNum;
+                const int   SIZE  = DATA[i].d_size;
+                const bool  HINTS = DATA[i].d_useHints;
+                const char *EXP   = DATA[i].d_exp;
+                const int   LEN   = numOctets(EXP);
+
+                if (veryVerbose) { P_(SIZE) P(EXP) }
+
+                balber::BerEncoderOptions options;
+                options.setEncodeArrayLengthHints(HINTS);
+                options.setEncodeDefiniteLength(true);
+
+                test::MySequenceWithArray VALUE;
+                VALUE.attribute1() = 23;
+                VALUE.attribute2().resize(SIZE);
+
+                bdlsb::MemOutStreamBuf osb;
+                balber::BerEncoder encoder(&options);
+                ASSERTV(LINE, 0 == encoder.encode(&osb, VALUE));
+                ASSERTV(LINE, LEN, osb.length(), LEN == (int)osb.length());
+                ASSERTV(LINE,
+                        EXP,
+                        0 == compareBuffers(osb.data(), EXP));
+
+                if (veryVerbose) {
+                    cout << "Output Buffer:";
+                    printBuffer(osb.data(), osb.length());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tVerify lengths of constructed elements.\n";
+        {
+            test::MySequenceWithArray longArray;
+            longArray.attribute1() = 7;
+            longArray.attribute2().resize(3, bsl::string(200, 'x'));
+
+            test::MyChoice choice;
+            choice.makeSelection2("choice");
+
+            test::MySequenceWithNillable nillable;
+            nillable.attribute1() = 5;
+            nillable.myNillable().makeValue("nillable");
+            nillable.attribute2() = "attribute2";
+
+            test::MySequenceWithAnonymousChoice anonymous;
+            anonymous.attribute1().makeValue(11);
+            anonymous.choice().makeMyChoice2("anonymous");
+
+            test::Employee employee;
+            employee.name() = "Bob";
+            employee.homeAddress().street() = "Some Street";
+            employee.homeAddress().city()   = "Some City";
+            employee.homeAddress().state()  = "Some State";
+            employee.age() = 56;
+
+            test::BasicRecord basicRec;
+            basicRec.i1() = 11;
+            basicRec.i2() = 22;
+            basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+            test::BigRecord bigRec;
+            bigRec.name() = "This record is so big, it has its own gravity.";
+            bigRec.array().resize(1000, basicRec);
+
+            balber::BerEncoderOptions definiteOptions;
+            definiteOptions.setEncodeDefiniteLength(true);
+            definiteOptions.setEncodeArrayLengthHints(true);
+
+            balber::BerEncoderOptions indefiniteOptions;
+            indefiniteOptions.setEncodeArrayLengthHints(true);
+
+            balber::BerEncoder definiteEncoder(&definiteOptions);
+            balber::BerEncoder indefiniteEncoder(&indefiniteOptions);
+            balber::BerEncoder defaultEncoder;
+
+            for (int i = 0; i < 6; ++i) {
+                bdlsb::MemOutStreamBuf definite;
+                bdlsb::MemOutStreamBuf definite2;
+                bdlsb::MemOutStreamBuf indefinite;
+                bdlsb::MemOutStreamBuf indefinite2;
+
+                int rc = 0;
+                switch (i) {
+                  case 0: {
+                    rc |= definiteEncoder.encode(&definite, longArray);
+                    rc |= definiteEncoder.encode(&definite2, longArray);
+                    rc |= indefiniteEncoder.encode(&indefinite, longArray);
+                    rc |= indefiniteEncoder.encode(&indefinite2, longArray);
+                  } break;
+                  case 1: {
+                    rc |= definiteEncoder.encode(&definite, choice);
+                    rc |= definiteEncoder.encode(&definite2, choice);
+                    rc |= indefiniteEncoder.encode(&indefinite, choice);
+                    rc |= indefiniteEncoder.encode(&indefinite2, choice);
+                  } break;
+                  case 2: {
+                    rc |= definiteEncoder.encode(&definite, nillable);
+                    rc |= definiteEncoder.encode(&definite2, nillable);
+                    rc |= indefiniteEncoder.encode(&indefinite, nillable);
+                    rc |= indefiniteEncoder.encode(&indefinite2, nillable);
+                  } break;
+                  case 3: {
+                    rc |= definiteEncoder.encode(&definite, anonymous);
+                    rc |= definiteEncoder.encode(&definite2, anonymous);
+                    rc |= indefiniteEncoder.encode(&indefinite, anonymous);
+                    rc |= indefiniteEncoder.encode(&indefinite2, anonymous);
+                  } break;
+                  case 4: {
+                    rc |= definiteEncoder.encode(&definite, employee);
+                    rc |= definiteEncoder.encode(&definite2, employee);
+                    rc |= indefiniteEncoder.encode(&indefinite, employee);
+
+                    // `Employee` has no arrays, so the output of an encoder
+                    // having the default options must be the same.
+
+                    rc |= defaultEncoder.encode(&indefinite2, employee);
+                  } break;
+                  case 5: {
+                    rc |= definiteEncoder.encode(&definite, bigRec);
+                    rc |= definiteEncoder.encode(&definite2, bigRec);
+                    rc |= indefiniteEncoder.encode(&indefinite, bigRec);
+                    rc |= indefiniteEncoder.encode(&indefinite2, bigRec);
+                  } break;
+                }
+                ASSERTV(i, 0 == rc);
+
+                if (veryVerbose) {
+                    P_(i) P_(definite.length()) P(indefinite.length())
+                }
+
+                ASSERTV(i, definite.length() == definite2.length());
+                ASSERTV(i, 0 == memcmp(definite.data(),
+                                       definite2.data(),
+                                       definite.length()));
+                ASSERTV(i, indefinite.length() == indefinite2.length());
+                ASSERTV(i, 0 == memcmp(indefinite.data(),
+                                       indefinite2.data(),
+                                       indefinite.length()));
+
+                // Long-form lengths can take as many octets as the
+                // indefinite-length octet and the end-of-contents octets.
+
+                ASSERTV(i, definite.length(),   indefinite.length(),
+                        definite.length() <= indefinite.length());
+
+                const int numDefinite = countDefiniteLengthElements(
+                                          definite.data(),
+                                          static_cast<int>(definite.length()));
+
+                const int numIndefinite = countDefiniteLengthElements(
+                                        indefinite.data(),
+                                        static_cast<int>(indefinite.length()));
+
+                ASSERTV(i, numDefinite, 0 < numDefinite);
+                ASSERTV(i, numIndefinite, -1 == numIndefinite);
+
+                if (0 == i) {
+                    // The contents of the outer sequence and of the array
+                    // are longer than 127 octets.
+
+                    ASSERTV(i, 0x30 == (unsigned char)definite.data()[0]);
+                    ASSERTV(i, 0x82 == (unsigned char)definite.data()[1]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tVerify nothing is written on failure.\n";
+        {
+            balber::BerEncoderOptions options;
+            options.setDisableUnselectedChoiceEncoding(true);
+
+            test::MySequenceWithAnonymousChoice value;
+            value.attribute1().makeValue(11);
+
+            for (int definite = 0; definite < 2; ++definite) {
+                options.setEncodeDefiniteLength(definite);
+
+                bdlsb::MemOutStreamBuf osb;
+                balber::BerEncoder     encoder(&options);
+
+                ASSERTV(definite, 0 != encoder.encode(&osb, value));
+                ASSERTV(definite,
+                        osb.length(),
+                        !definite || 0 == osb.length());
+
+                printDiagnostic(encoder);
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // DATE/TIME COMPONENTS
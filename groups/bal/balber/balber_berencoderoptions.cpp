@@ -47,6 +47,8 @@ const bool BerEncoderOptions::DEFAULT_INITIALIZER_PRESERVE_SIGN_OF_NEGATIVE_ZERO
 
 const bool BerEncoderOptions::DEFAULT_INITIALIZER_ENCODE_ARRAY_LENGTH_HINTS = false;
 
+const bool BerEncoderOptions::DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH = false;
+
 const bdlat_AttributeInfo BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
         ATTRIBUTE_ID_TRACE_LEVEL,
@@ -103,6 +105,13 @@ const bdlat_AttributeInfo BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("EncodeArrayLengthHints") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH,
+        "EncodeDefiniteLength",
+        sizeof("EncodeDefiniteLength") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -145,6 +154,8 @@ const bdlat_AttributeInfo *BerEncoderOptions::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRESERVE_SIGN_OF_NEGATIVE_ZERO];
       case ATTRIBUTE_ID_ENCODE_ARRAY_LENGTH_HINTS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_ARRAY_LENGTH_HINTS];
+      case ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH];
       default:
         return 0;
     }
@@ -161,6 +172,7 @@ BerEncoderOptions::BerEncoderOptions()
 , d_disableUnselectedChoiceEncoding(DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCODING)
 , d_preserveSignOfNegativeZero(DEFAULT_INITIALIZER_PRESERVE_SIGN_OF_NEGATIVE_ZERO)
 , d_encodeArrayLengthHints(DEFAULT_INITIALIZER_ENCODE_ARRAY_LENGTH_HINTS)
+, d_encodeDefiniteLength(DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH)
 {
 }
 
@@ -176,6 +188,7 @@ void BerEncoderOptions::reset()
     d_disableUnselectedChoiceEncoding = DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCODING;
     d_preserveSignOfNegativeZero = DEFAULT_INITIALIZER_PRESERVE_SIGN_OF_NEGATIVE_ZERO;
     d_encodeArrayLengthHints = DEFAULT_INITIALIZER_ENCODE_ARRAY_LENGTH_HINTS;
+    d_encodeDefiniteLength = DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH;
 }
 
 // ACCESSORS
@@ -194,6 +207,7 @@ bsl::ostream& BerEncoderOptions::print(bsl::ostream& stream,
     printer.printAttribute("disableUnselectedChoiceEncoding", this->disableUnselectedChoiceEncoding());
     printer.printAttribute("preserveSignOfNegativeZero", this->preserveSignOfNegativeZero());
     printer.printAttribute("encodeArrayLengthHints", this->encodeArrayLengthHints());
+    printer.printAttribute("encodeDefiniteLength", this->encodeDefiniteLength());
     printer.end();
     return stream;
 }
@@ -98,6 +98,18 @@ class BerEncoderOptions {
         // 'true' requires the receiving decoder to come from BDE release
         // '4.27.x' or later, or have the 'SkipUnknownElements' decoder option
         // set to 'true'.
+    bool  d_encodeDefiniteLength;
+        // This option controls whether or not constructed types (sequences,
+        // choices, arrays, and nillable values) are encoded using the
+        // definite-length form rather than the indefinite-length form.  If
+        // this option is 'true', the encoder first computes the encoded size
+        // of every constructed element and then writes each element with an
+        // explicit length, such that no end-of-contents octets are emitted
+        // and a decoder can skip an unknown element without parsing its
+        // contents.  Encoding in this mode traverses the value twice.  The
+        // default value of this option is 'false'.  Any conforming BER
+        // decoder, including all releases of the 'balber' BER decoder, can
+        // decode data encoded with either setting of this option.
 
     // PRIVATE ACCESSORS
     bool isEqualTo(const BerEncoderOptions& rhs) const;
@@ -113,10 +125,11 @@ class BerEncoderOptions {
       , ATTRIBUTE_ID_DISABLE_UNSELECTED_CHOICE_ENCODING   = 5
       , ATTRIBUTE_ID_PRESERVE_SIGN_OF_NEGATIVE_ZERO       = 6
       , ATTRIBUTE_ID_ENCODE_ARRAY_LENGTH_HINTS            = 7
+      , ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH               = 8
     };
 
     enum {
-        NUM_ATTRIBUTES = 8
+        NUM_ATTRIBUTES = 9
     };
 
     enum {
@@ -128,6 +141,7 @@ class BerEncoderOptions {
       , ATTRIBUTE_INDEX_DISABLE_UNSELECTED_CHOICE_ENCODING   = 5
       , ATTRIBUTE_INDEX_PRESERVE_SIGN_OF_NEGATIVE_ZERO       = 6
       , ATTRIBUTE_INDEX_ENCODE_ARRAY_LENGTH_HINTS            = 7
+      , ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH               = 8
     };
 
     // CONSTANTS
@@ -149,6 +163,8 @@ class BerEncoderOptions {
 
     static const bool DEFAULT_INITIALIZER_ENCODE_ARRAY_LENGTH_HINTS;
 
+    static const bool DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -255,6 +271,10 @@ class BerEncoderOptions {
         // Set the "EncodeArrayLengthHints" attribute of this object to the
         // specified 'value'.
 
+    void setEncodeDefiniteLength(bool value);
+        // Set the "EncodeDefiniteLength" attribute of this object to the
+        // specified 'value'.
+
     // ACCESSORS
     bsl::ostream& print(bsl::ostream& stream,
                         int           level          = 0,
@@ -339,6 +359,10 @@ class BerEncoderOptions {
         // Return the value of the "EncodeArrayLengthHints" attribute of this
         // object.
 
+    bool encodeDefiniteLength() const;
+        // Return the value of the "EncodeDefiniteLength" attribute of this
+        // object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const BerEncoderOptions& lhs,
                            const BerEncoderOptions& rhs)
@@ -392,13 +416,17 @@ bool BerEncoderOptions::isEqualTo(const BerEncoderOptions& rhs) const
            this->datetimeFractionalSecondPrecision() == rhs.datetimeFractionalSecondPrecision() &&
            this->disableUnselectedChoiceEncoding() == rhs.disableUnselectedChoiceEncoding() &&
            this->preserveSignOfNegativeZero() == rhs.preserveSignOfNegativeZero() &&
-           this->encodeArrayLengthHints() == rhs.encodeArrayLengthHints();
+           this->encodeArrayLengthHints() == rhs.encodeArrayLengthHints() &&
+           this->encodeDefiniteLength() == rhs.encodeDefiniteLength();
 }
 
 // CLASS METHODS
 inline
 int BerEncoderOptions::maxSupportedBdexVersion(int versionSelector)
 {
+    if (versionSelector >= 20261018) {
+        return 4;                                                     // RETURN
+    }
     if (versionSelector >= 20250615) {
         return 3;                                                     // RETURN
     }
@@ -415,6 +443,17 @@ t_STREAM& BerEncoderOptions::bdexStreamIn(t_STREAM& stream, int version)
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
         switch (version) {
+          case 4: {
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_traceLevel, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_bdeVersionConformance, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_encodeEmptyArrays, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_encodeDateAndTimeTypesAsBinary, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_datetimeFractionalSecondPrecision, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_disableUnselectedChoiceEncoding, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_preserveSignOfNegativeZero, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_encodeArrayLengthHints, 1);
+            bslx::InStreamFunctions::bdexStreamIn(stream, d_encodeDefiniteLength, 1);
+          } break;
           case 3: {
             bslx::InStreamFunctions::bdexStreamIn(stream, d_traceLevel, 1);
             bslx::InStreamFunctions::bdexStreamIn(stream, d_bdeVersionConformance, 1);
@@ -424,6 +463,7 @@ t_STREAM& BerEncoderOptions::bdexStreamIn(t_STREAM& stream, int version)
             bslx::InStreamFunctions::bdexStreamIn(stream, d_disableUnselectedChoiceEncoding, 1);
             bslx::InStreamFunctions::bdexStreamIn(stream, d_preserveSignOfNegativeZero, 1);
             bslx::InStreamFunctions::bdexStreamIn(stream, d_encodeArrayLengthHints, 1);
+            d_encodeDefiniteLength = false;
           } break;
           case 2: {
             bslx::InStreamFunctions::bdexStreamIn(stream, d_traceLevel, 1);
@@ -434,6 +474,7 @@ t_STREAM& BerEncoderOptions::bdexStreamIn(t_STREAM& stream, int version)
             bslx::InStreamFunctions::bdexStreamIn(stream, d_disableUnselectedChoiceEncoding, 1);
             bslx::InStreamFunctions::bdexStreamIn(stream, d_preserveSignOfNegativeZero, 1);
             d_encodeArrayLengthHints = false;
+            d_encodeDefiniteLength = false;
           } break;
           case 1: {
             reset();
@@ -501,6 +542,11 @@ int BerEncoderOptions::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_encodeDefiniteLength, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -534,6 +580,9 @@ int BerEncoderOptions::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
       case ATTRIBUTE_ID_ENCODE_ARRAY_LENGTH_HINTS: {
         return manipulator(&d_encodeArrayLengthHints, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_ARRAY_LENGTH_HINTS]);
       }
+      case ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH: {
+        return manipulator(&d_encodeDefiniteLength, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+      }
       default:
         return NOT_FOUND;
     }
@@ -604,11 +653,28 @@ void BerEncoderOptions::setEncodeArrayLengthHints(bool value)
     d_encodeArrayLengthHints = value;
 }
 
+inline
+void BerEncoderOptions::setEncodeDefiniteLength(bool value)
+{
+    d_encodeDefiniteLength = value;
+}
+
 // ACCESSORS
 template <typename t_STREAM>
 t_STREAM& BerEncoderOptions::bdexStreamOut(t_STREAM& stream, int version) const
 {
     switch (version) {
+      case 4: {
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->traceLevel(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->bdeVersionConformance(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->encodeEmptyArrays(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->encodeDateAndTimeTypesAsBinary(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->datetimeFractionalSecondPrecision(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->disableUnselectedChoiceEncoding(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->preserveSignOfNegativeZero(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->encodeArrayLengthHints(), 1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream, this->encodeDefiniteLength(), 1);
+      } break;
       case 3: {
         bslx::OutStreamFunctions::bdexStreamOut(stream, this->traceLevel(), 1);
         bslx::OutStreamFunctions::bdexStreamOut(stream, this->bdeVersionConformance(), 1);
@@ -685,6 +751,11 @@ int BerEncoderOptions::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_encodeDefiniteLength, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -718,6 +789,9 @@ int BerEncoderOptions::accessAttribute(t_ACCESSOR& accessor, int id) const
       case ATTRIBUTE_ID_ENCODE_ARRAY_LENGTH_HINTS: {
         return accessor(d_encodeArrayLengthHints, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_ARRAY_LENGTH_HINTS]);
       }
+      case ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH: {
+        return accessor(d_encodeDefiniteLength, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+      }
       default:
         return NOT_FOUND;
     }
@@ -788,6 +862,12 @@ bool BerEncoderOptions::encodeArrayLengthHints() const
     return d_encodeArrayLengthHints;
 }
 
+inline
+bool BerEncoderOptions::encodeDefiniteLength() const
+{
+    return d_encodeDefiniteLength;
+}
+
 }  // close package namespace
 
 // FREE FUNCTIONS
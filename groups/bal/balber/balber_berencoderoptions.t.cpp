@@ -699,6 +699,7 @@ int main(int argc, char *argv[])
         const int   D6   = false;        // `disableUnselectedChoiceEncoding`
         const bool  D7   = false;        // `preserveSignOfNegativeZero`
         const bool  D8   = false;        // `encodeArrayLengthHints`
+        const bool  D9   = false;        // `encodeDefiniteLength`
 
         if (verbose) cout <<
                      "Create an object using the default constructor." << endl;
@@ -724,6 +725,8 @@ int main(int argc, char *argv[])
                      D7 == X.preserveSignOfNegativeZero());
         LOOP2_ASSERT(D8, X.encodeArrayLengthHints(),
                      D8 == X.encodeArrayLengthHints());
+        LOOP2_ASSERT(D9, X.encodeDefiniteLength(),
+                     D9 == X.encodeDefiniteLength());
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -763,6 +766,7 @@ int main(int argc, char *argv[])
         typedef int   T6;        // `disableUnselectedChoiceEncoding`
         typedef bool  T7;        // `preserveSignOfNegativeZero`
         typedef bool  T8;        // `encodeArrayLengthHints`
+        typedef bool  T9;        // `encodeDefiniteLength`
 
         // Attribute 1 Values: `traceLevel`
 
@@ -804,6 +808,11 @@ int main(int argc, char *argv[])
         const T8 D8 = false;    // default value
         const T8 A8 = true;
 
+        // Attribute 9 Values: `encodeDefiniteLength`
+
+        const T9 D9 = false;    // default value
+        const T9 A9 = true;
+
         // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
         if (verbose) cout << "\n 1. Create an object `w` (default ctor)."
@@ -822,6 +831,7 @@ int main(int argc, char *argv[])
         ASSERT(D6 == W.disableUnselectedChoiceEncoding());
         ASSERT(D7 == W.preserveSignOfNegativeZero());
         ASSERT(D8 == W.encodeArrayLengthHints());
+        ASSERT(D9 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
                   "\tb. Try equality operators: `w` <op> `w`." << endl;
@@ -846,6 +856,7 @@ int main(int argc, char *argv[])
         ASSERT(D6 == X.disableUnselectedChoiceEncoding());
         ASSERT(D7 == X.preserveSignOfNegativeZero());
         ASSERT(D8 == X.encodeArrayLengthHints());
+        ASSERT(D9 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
                    "\tb. Try equality operators: `x` <op> `w`, `x`." << endl;
@@ -866,6 +877,7 @@ int main(int argc, char *argv[])
         mX.setDisableUnselectedChoiceEncoding(A6);
         mX.setPreserveSignOfNegativeZero(A7);
         mX.setEncodeArrayLengthHints(A8);
+        mX.setEncodeDefiniteLength(A9);
 
         if (veryVerbose) cout << "\ta. Check new value of `x`." << endl;
         if (veryVeryVerbose) { T_ T_ P(X) }
@@ -878,6 +890,7 @@ int main(int argc, char *argv[])
         ASSERT(A6 == X.disableUnselectedChoiceEncoding());
         ASSERT(A7 == X.preserveSignOfNegativeZero());
         ASSERT(A8 == X.encodeArrayLengthHints());
+        ASSERT(A9 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
              "\tb. Try equality operators: `x` <op> `w`, `x`." << endl;
@@ -899,6 +912,7 @@ int main(int argc, char *argv[])
         mY.setDisableUnselectedChoiceEncoding(A6);
         mY.setPreserveSignOfNegativeZero(A7);
         mY.setEncodeArrayLengthHints(A8);
+        mY.setEncodeDefiniteLength(A9);
 
         if (veryVerbose) cout << "\ta. Check initial value of `y`." << endl;
         if (veryVeryVerbose) { T_ T_ P(Y) }
@@ -911,6 +925,7 @@ int main(int argc, char *argv[])
         ASSERT(A6 == Y.disableUnselectedChoiceEncoding());
         ASSERT(A7 == Y.preserveSignOfNegativeZero());
         ASSERT(A8 == Y.encodeArrayLengthHints());
+        ASSERT(A9 == Y.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
              "\tb. Try equality operators: `y` <op> `w`, `x`, `y`" << endl;
@@ -937,6 +952,7 @@ int main(int argc, char *argv[])
         ASSERT(A6 == Z.disableUnselectedChoiceEncoding());
         ASSERT(A7 == Z.preserveSignOfNegativeZero());
         ASSERT(A8 == Z.encodeArrayLengthHints());
+        ASSERT(A9 == Z.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `z` <op> `w`, `x`, `y`, `z`." << endl;
@@ -959,6 +975,7 @@ int main(int argc, char *argv[])
         mZ.setDisableUnselectedChoiceEncoding(D6);
         mZ.setPreserveSignOfNegativeZero(D7);
         mZ.setEncodeArrayLengthHints(D8);
+        mZ.setEncodeDefiniteLength(D9);
 
         if (veryVerbose) cout << "\ta. Check new value of `z`." << endl;
         if (veryVeryVerbose) { T_ T_ P(Z) }
@@ -971,6 +988,7 @@ int main(int argc, char *argv[])
         ASSERT(D6 == Z.disableUnselectedChoiceEncoding());
         ASSERT(D7 == Z.preserveSignOfNegativeZero());
         ASSERT(D8 == Z.encodeArrayLengthHints());
+        ASSERT(D9 == Z.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `z` <op> `w`, `x`, `y`, `z`." << endl;
@@ -997,6 +1015,7 @@ int main(int argc, char *argv[])
         ASSERT(A6 == W.disableUnselectedChoiceEncoding());
         ASSERT(A7 == W.preserveSignOfNegativeZero());
         ASSERT(A8 == W.encodeArrayLengthHints());
+        ASSERT(A9 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `w` <op> `w`, `x`, `y`, `z`." << endl;
@@ -1023,6 +1042,7 @@ int main(int argc, char *argv[])
         ASSERT(D6 == W.disableUnselectedChoiceEncoding());
         ASSERT(D7 == W.preserveSignOfNegativeZero());
         ASSERT(D8 == W.encodeArrayLengthHints());
+        ASSERT(D9 == W.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `x` <op> `w`, `x`, `y`, `z`." << endl;
@@ -1049,6 +1069,7 @@ int main(int argc, char *argv[])
         ASSERT(A6 == X.disableUnselectedChoiceEncoding());
         ASSERT(A7 == X.preserveSignOfNegativeZero());
         ASSERT(A8 == X.encodeArrayLengthHints());
+        ASSERT(A9 == X.encodeDefiniteLength());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: `x` <op> `w`, `x`, `y`, `z`." << endl;
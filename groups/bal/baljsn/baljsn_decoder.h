@@ -264,6 +264,13 @@ class Decoder {
     template <class TYPE, class ANY_CATEGORY>
     int decodeImp(TYPE *value, ANY_CATEGORY category);
 
+    /// Decode into the specified `value`, of a (template parameter) `TYPE`,
+    /// the JSON data read by the tokenizer owned by this object, which must
+    /// have been reset to its input, using the specified `options`.  Return
+    /// 0 on success and a non-zero value otherwise.
+    template <class TYPE>
+    int decodeTokenizerInput(TYPE *value, const DecoderOptions& options);
+
     /// Log the latest tokenizer error to `d_logStream`.  If the tokenizer
     /// did not have an error, log the specified `alternateString`.  Return
     /// a reference to `d_logStream`.
@@ -327,6 +334,24 @@ class Decoder {
                TYPE                  *value,
                const DecoderOptions  *options);
 
+    /// Decode into the specified `value`, of a (template parameter) `TYPE`,
+    /// the JSON data held in the specified `input` and using the specified
+    /// `options`.  Specifying a nullptr `options` is equivalent to passing a
+    /// default-constructed `DecoderOptions` in `options`.  `TYPE` shall be a
+    /// `bdeat`-compatible sequence, choice, or array type, or a
+    /// `bdeat`-compatible dynamic type referring to one of those types.
+    /// Return 0 on success, and a non-zero value otherwise.  Note that
+    /// `input` is tokenized in place, without first being copied to an
+    /// internal buffer.
+    template <class TYPE>
+    int decode(const bsl::string_view&  input,
+               TYPE                    *value,
+               const DecoderOptions&    options);
+    template <class TYPE>
+    int decode(const bsl::string_view&  input,
+               TYPE                    *value,
+               const DecoderOptions    *options);
+
     /// Decode an object of (template parameter) `TYPE` from the specified
     /// `streamBuf` and load the result into the specified modifiable `value`.
     /// Return 0 on success, and a non-zero value otherwise.
@@ -1056,30 +1081,10 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-, d_numUnknownElementsSkipped(0)
-, d_allowMissingRequiredAttributes(
-         DecoderOptions::DEFAULT_INITIALIZER_ALLOW_MISSING_REQUIRED_ATTRIBUTES)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeTokenizerInput(TYPE                  *value,
+                                  const DecoderOptions&  options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -1102,7 +1107,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer
     .setAllowStandAloneValues(false)
     .setAllowHeterogenousArrays(true) // needed for nillable arrays
@@ -1131,6 +1135,34 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     return rc;
 }
 
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+, d_numUnknownElementsSkipped(0)
+, d_allowMissingRequiredAttributes(
+         DecoderOptions::DEFAULT_INITIALIZER_ALLOW_MISSING_REQUIRED_ATTRIBUTES)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+    return decodeTokenizerInput(value, options);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf        *streamBuf,
                     TYPE                  *value,
@@ -1172,6 +1204,26 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const bsl::string_view&  input,
+                    TYPE                    *value,
+                    const DecoderOptions&    options)
+{
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(input);
+    return decodeTokenizerInput(value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const bsl::string_view&  input,
+                    TYPE                    *value,
+                    const DecoderOptions    *options)
+{
+    DecoderOptions localOpts;
+    return decode(input, value, options ? *options : localOpts);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
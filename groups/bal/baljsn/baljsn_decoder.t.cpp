@@ -97,6 +97,7 @@
 #include <bsl_limits.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 #include <bsl_vector.h>
 
@@ -130,6 +131,7 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [ 4] int decode(const bsl::string_view& input, TYPE *v, options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
@@ -6410,6 +6412,20 @@ int main(int argc, char *argv[])
                                     (0 == decoder.decode(iss, &bob, options)));
                 const bsl::string& logMsg = decoder.loggedMessages();
 
+                {
+                    test::Employee  viewBob;
+                    baljsn::Decoder viewDecoder;
+                    ASSERTV(FIND_STR, USEQ, str, FINAL ==
+                          (0 == viewDecoder.decode(bsl::string_view(str),
+                                                   &viewBob,
+                                                   options)));
+                    const bsl::string& viewMsg =
+                                                viewDecoder.loggedMessages();
+                    ASSERTV(ULINE, UMSG, viewMsg,
+                            FINAL ? viewMsg.empty()
+                                  : npos != viewMsg.find(UMSG));
+                }
+
                 if (FINAL) {
                     ASSERT(logMsg.empty());
                 }
@@ -6999,11 +7015,15 @@ int main(int argc, char *argv[])
         //
         //   5. Verify that the return code from `decode` is *not* 0.
         //
+        //   6. Repeat P-2.4 and P-2.5 decoding the JSON text directly from a
+        //      `bsl::string_view`.
+        //
         // Testing:
         //   int decode(bsl::streambuf *streamBuf, TYPE *v, options);
         //   int decode(bsl::istream& stream, TYPE *v, options);
         //   int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
         //   int decode(bsl::istream& stream, TYPE *v, &options);
+        //   int decode(const bsl::string_view& input, TYPE *v, options);
         //   bsl::string loggedMessages() const;
         // --------------------------------------------------------------------
 
@@ -7056,6 +7076,9 @@ int main(int argc, char *argv[])
                     bsl::istringstream iss(INPUT);
                     ASSERT(decoder.decodeAny(iss, &value, mO) != 0);
                 }
+
+                ASSERTV(LINE, 0 != decoder.decode(bsl::string_view(INPUT),
+                                                  &value, mO));
             }
         }
 
@@ -7979,6 +8002,9 @@ int main(int argc, char *argv[])
                     bsl::istringstream iss(INPUT);
                     ASSERT(decoder.decodeAny(iss, &bob, options) != 0);
                 }
+
+                ASSERTV(LINE, 0 != decoder.decode(bsl::string_view(INPUT),
+                                                  &bob, options));
             }
         }
 
@@ -8009,6 +8035,9 @@ int main(int argc, char *argv[])
                     bsl::istringstream iss(INPUT);
                     ASSERT(decoder.decodeAny(iss, &bob, options) != 0);
                 }
+
+                ASSERTV(LINE, 0 != decoder.decode(bsl::string_view(INPUT),
+                                                  &bob, options));
             }
         }
 
@@ -8157,6 +8186,9 @@ int main(int argc, char *argv[])
                     bsl::istringstream iss(INPUT);
                     ASSERT(decoder.decodeAny(iss, &bob, options) != 0);
                 }
+
+                ASSERTV(LINE, 0 != decoder.decode(bsl::string_view(INPUT),
+                                                  &bob, options));
             }
         }
       } break;
@@ -9142,6 +9174,12 @@ int main(int argc, char *argv[])
             ASSERT("Some City"   == bob.homeAddress().city());
             ASSERT("Some State"  == bob.homeAddress().state());
             ASSERT(21            == bob.age());
+
+            test::Employee viewBob;
+            ASSERTV(0 == decoder.decode(bsl::string_view(jsonText),
+                                        &viewBob,
+                                        options));
+            ASSERT(bob == viewBob);
         }
       } break;
       default: {
@@ -27,10 +27,16 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_time.h>
 
+#include <bslma_default.h>
+
 #include <bslmt_lockguard.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
 #include <bsls_log.h>
+#include <bsls_performancehint.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -42,8 +48,10 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_iomanip.h>
 #include <bsl_ios.h>
 #include <bsl_memory.h>
+#include <bsl_new.h>            // placement 'new' syntax
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_utility.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -52,6 +60,7 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
@@ -62,6 +71,41 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #define snprintf _snprintf
 #endif
 
+// IMPLEMENTATION NOTES
+// --------------------
+// Once a publication thread is running, each thread that publishes a record
+// owns a `FileObserver2_StagingBuffer`, found through thread-specific
+// storage, into which it formats the record, and to which it appends the
+// formatted text under the (normally uncontended) lock of the buffer.  Each
+// staged record is assigned a sequence number, from `d_numStaged`, while the
+// lock of the buffer is held, so that the sequence numbers of the records in
+// a buffer are ascending.
+//
+// The publication thread reads `d_numStaged`, then locks each buffer in turn
+// and takes the records having a smaller sequence number: since a record is
+// assigned its sequence number and appended to its buffer under the same
+// lock, all of those records are found, and the records taken form a
+// contiguous range of sequence numbers.  The records taken are then merged,
+// by sequence number, into a single batch that is written to the log file.
+//
+// The publication thread sets `d_threadWaitingFlag` before checking
+// `d_numStaged` one last time and waiting, and a publishing thread reads the
+// flag after incrementing `d_numStaged`, so that either the publishing thread
+// wakes the publication thread, or the publication thread observes the
+// record (both operations being sequentially consistent).
+//
+// A publishing thread reads `d_asyncFlag` under the lock of its buffer.
+// Once a stop is requested, the publication thread therefore locks each
+// buffer before checking for staged records one last time, so that a record
+// staged by a thread that observed `d_asyncFlag` as `true` is not missed.
+//
+// Staging buffers are never deallocated before the file observer is
+// destroyed; when a thread terminates, its buffer is released (`d_isClaimed`
+// is reset) and may be claimed by the next thread that publishes a record.
+// The list of buffers (`d_stagingBuffers`) only grows, by prepending with a
+// compare-and-swap, so that the publication thread can traverse it without
+// a lock.
+
 namespace BloombergLP {
 namespace ball {
 
@@ -79,6 +123,14 @@ enum {
     k_ERROR_BUFFER_SIZE   = 1280  // 1024 (max path) + 256
 };
 
+enum {
+    k_MAX_STAGED_BYTES    = 16 * 1024 * 1024  // size of the text staged by a
+                                              // thread above which `publish`
+                                              // blocks in that thread
+};
+
+static const char *const k_THREAD_NAME = "fileobserver2";
+
 #define LOG_PLATFORM_MESSAGE(severity, formatStr, ...) \
     {\
         char message[k_ERROR_BUFFER_SIZE]; \
@@ -98,6 +150,20 @@ static int getErrorCode(void)
 #endif
 }
 
+/// Request that the operating system transfer the data written to the
+/// specified `fd` to the storage device.  Return 0 on success, and a non-zero
+/// value otherwise.
+static int syncFileData(bdls::FilesystemUtil::FileDescriptor fd)
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    return FlushFileBuffers(fd) ? 0 : -1;
+#elif defined(BSLS_PLATFORM_OS_LINUX)
+    return ::fdatasync(fd);
+#else
+    return ::fsync(fd);
+#endif
+}
+
 /// Return the specified `timestamp` in the `YYYYMMDD_hhmmss` format.
 static bsl::string getTimestampSuffix(const bdlt::Datetime& timestamp)
 {
@@ -351,11 +417,201 @@ static bdlt::Datetime computeNextRotationTime(
 
 }  // close unnamed namespace
 
+                    // =================================
+                    // class FileObserver2_StagingBuffer
+                    // =================================
+
+/// This component-private class holds the records staged by a thread that
+/// publishes records to a `FileObserver2` having a publication thread, and
+/// the records most recently taken from them by the publication thread.
+class FileObserver2_StagingBuffer {
+
+  public:
+    // PUBLIC TYPES
+
+    /// An `Entry` describes a formatted record held in a staging buffer.
+    struct Entry {
+        bsls::Types::Uint64 d_sequence;      // sequence number of the record
+
+        bsl::size_t         d_end;           // offset, within the text of the
+                                             // buffer, of the end of the
+                                             // formatted record
+
+        bdlt::Datetime      d_timestampUtc;  // timestamp of the record
+    };
+
+    typedef bsl::vector<Entry> Entries;
+
+    // PUBLIC DATA
+    bslmt::Mutex                 d_mutex;         // serialize access to
+                                                  // `d_text` and `d_entries`
+
+    bsl::string                  d_text;          // formatted text of the
+                                                  // staged records
+
+    Entries                      d_entries;       // staged records
+
+    FileObserver2_RecordBuffer   d_formatBuffer;  // buffer into which the
+                                                  // owning thread formats
+                                                  // records
+
+    bsl::string                  d_takenText;     // formatted text of the
+                                                  // taken records (used only
+                                                  // by the publication
+                                                  // thread)
+
+    Entries                      d_takenEntries;  // taken records (used only
+                                                  // by the publication
+                                                  // thread)
+
+    bsls::AtomicInt              d_isClaimed;     // 1 if owned by a thread
+
+    FileObserver2_StagingBuffer *d_next_p;        // next buffer of the file
+                                                  // observer
+
+  private:
+    // NOT IMPLEMENTED
+    FileObserver2_StagingBuffer(const FileObserver2_StagingBuffer&);
+    FileObserver2_StagingBuffer& operator=(
+                                           const FileObserver2_StagingBuffer&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty staging buffer, claimed by the calling thread, using
+    /// the specified `allocator` to supply memory.
+    explicit FileObserver2_StagingBuffer(bslma::Allocator *allocator);
+
+    // MANIPULATORS
+
+    /// Move the staged records having a sequence number less than the
+    /// specified `numStaged` to `d_takenText` and `d_takenEntries`.  The
+    /// behavior is undefined unless `d_mutex` is locked by the calling
+    /// thread, and `d_takenText` and `d_takenEntries` are empty.
+    void take(bsls::Types::Uint64 numStaged);
+};
+
+                    // ---------------------------------
+                    // class FileObserver2_StagingBuffer
+                    // ---------------------------------
+
+// CREATORS
+FileObserver2_StagingBuffer::FileObserver2_StagingBuffer(
+                                                   bslma::Allocator *allocator)
+: d_text(allocator)
+, d_entries(allocator)
+, d_formatBuffer(allocator)
+, d_takenText(allocator)
+, d_takenEntries(allocator)
+, d_isClaimed(1)
+, d_next_p(0)
+{
+}
+
+// MANIPULATORS
+void FileObserver2_StagingBuffer::take(bsls::Types::Uint64 numStaged)
+{
+    BSLS_ASSERT(d_takenText.empty());
+    BSLS_ASSERT(d_takenEntries.empty());
+
+    if (d_entries.empty() || numStaged <= d_entries.front().d_sequence) {
+        return;                                                       // RETURN
+    }
+
+    if (d_entries.back().d_sequence < numStaged) {
+        // Swapping the staged and taken records retains the capacity of
+        // both, so that, in a steady state, neither the owning thread nor
+        // the publication thread allocate memory.
+
+        d_text.swap(d_takenText);
+        d_entries.swap(d_takenEntries);
+        return;                                                       // RETURN
+    }
+
+    // Records were staged after `numStaged` was read by the publication
+    // thread; they are left for the next batch.
+
+    Entries::iterator split = d_entries.begin();
+    while (split->d_sequence < numStaged) {
+        ++split;
+    }
+
+    const bsl::size_t length = (split - 1)->d_end;
+
+    d_takenText.assign(d_text, 0, length);
+    d_takenEntries.assign(d_entries.begin(), split);
+
+    d_text.erase(0, length);
+    d_entries.erase(d_entries.begin(), split);
+
+    for (Entries::iterator it = d_entries.begin(); it != d_entries.end();
+                                                                        ++it) {
+        it->d_end -= length;
+    }
+}
+
                           // -------------------
                           // class FileObserver2
                           // -------------------
 
+// PRIVATE CLASS METHODS
+void FileObserver2::releaseStagingBuffer(void *buffer)
+{
+    FileObserver2_StagingBuffer *released =
+                            static_cast<FileObserver2_StagingBuffer *>(buffer);
+    if (released) {
+        released->d_isClaimed.storeRelease(0);
+    }
+}
+
 // PRIVATE MANIPULATORS
+FileObserver2_StagingBuffer *FileObserver2::localStagingBuffer()
+{
+    FileObserver2_StagingBuffer *buffer =
+                                  static_cast<FileObserver2_StagingBuffer *>(
+                                bslmt::ThreadUtil::getSpecific(d_stagingKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != buffer)) {
+        return buffer;                                                // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // Claim a buffer released by a terminated thread, if any, and otherwise
+    // create (and publish) a new one.
+
+    for (buffer = d_stagingBuffers.loadAcquire();
+         buffer;
+         buffer = buffer->d_next_p) {
+        if (0 == buffer->d_isClaimed.testAndSwap(0, 1)) {
+            break;
+        }
+    }
+
+    if (!buffer) {
+        buffer = new (*d_allocator_p) FileObserver2_StagingBuffer(
+                                                                d_allocator_p);
+
+        FileObserver2_StagingBuffer *head = d_stagingBuffers.loadRelaxed();
+        for (;;) {
+            buffer->d_next_p = head;
+
+            FileObserver2_StagingBuffer *previous =
+                              d_stagingBuffers.testAndSwapAcqRel(head, buffer);
+            if (previous == head) {
+                break;
+            }
+            head = previous;
+        }
+    }
+
+    int rc = bslmt::ThreadUtil::setSpecific(d_stagingKey, buffer);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+
+    return buffer;
+}
+
 int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 {
     BSLS_ASSERT(rotatedLogFileName);
@@ -467,26 +723,301 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
         return 1;                                                     // RETURN
     }
 
-    if (d_rotationSize) {
-        // 'tellp' returns -1 on failure.  Rotate the log file if either
-        // 'tellp' fails, or the rotation size is exceeded.
+    // 'tellp' returns -1 on failure, which is converted to the largest
+    // unsigned value, so that the log file is rotated if either 'tellp'
+    // fails, or the rotation size is exceeded.  Note that 'tellp' is called
+    // only if rotation-on-size is in effect.
+
+    const bsls::Types::Uint64 fileSize = d_rotationSize
+                   ? static_cast<bsls::Types::Uint64>(d_logOutStream.tellp())
+                   : 0;
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
-            static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
+    if (isRotationNecessary(fileSize, currentLogTimeUtc)) {
+        return rotateFile(rotatedLogFileName);                        // RETURN
+    }
 
-            return rotateFile(rotatedLogFileName);                    // RETURN
+    return 1;
+}
+
+void FileObserver2::publishBatch()
+{
+    typedef bsl::pair<int, bsl::string> Rotation;
+
+    bsl::vector<Rotation> rotations;  // rotations attempted in this batch
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        // Rather than calling 'rotateIfNecessary', which would require
+        // writing each record separately for 'tellp' to account for it, we
+        // track the size of the log file as the records are accumulated into
+        // runs that are each written to the file in a single call.  As in
+        // 'rotateIfNecessary', a failure of 'tellp' (-1, converted to the
+        // largest unsigned value) causes a rotation.
+
+        const bsls::Types::Uint64 k_TELLP_FAILED = ~bsls::Types::Uint64();
+
+        const char  *text     = d_batchText.data();
+        bsl::size_t  runBegin = 0;
+        bsl::size_t  begin    = 0;
+
+        bsls::Types::Uint64 fileSize =
+                                  d_rotationSize && d_logStreamBuf.isOpened()
+                   ? static_cast<bsls::Types::Uint64>(d_logOutStream.tellp())
+                   : 0;
+
+        for (PendingRecords::const_iterator it  = d_batchRecords.begin();
+                                            it != d_batchRecords.end();
+                                            ++it) {
+            const bsls::Types::Uint64 currentSize =
+                                               k_TELLP_FAILED == fileSize
+                                               ? fileSize
+                                               : fileSize + (begin - runBegin);
+
+            if (d_logStreamBuf.isOpened()
+             && isRotationNecessary(currentSize, it->d_timestampUtc)) {
+                writeToLogFile(text + runBegin, begin - runBegin);
+
+                bsl::string rotatedFileName;
+                const int   status = rotateFile(&rotatedFileName);
+
+                if (0 >= status) {
+                    rotations.push_back(Rotation(status, rotatedFileName));
+                }
+
+                runBegin = begin;
+                fileSize = d_rotationSize && d_logStreamBuf.isOpened()
+                   ? static_cast<bsls::Types::Uint64>(d_logOutStream.tellp())
+                   : 0;
+            }
+
+            begin = it->d_end;
+        }
+
+        writeToLogFile(text + runBegin, begin - runBegin);
+
+        if (d_logStreamBuf.isOpened()) {
+            if (d_dataSyncFlag) {
+                syncLogFile();
+            }
+            else {
+                d_logOutStream.flush();
+            }
         }
     }
 
-    if (d_rotationInterval.totalSeconds()
-        && d_nextRotationTimeUtc <= currentLogTimeUtc) {
-        return rotateFile(rotatedLogFileName);                        // RETURN
+    // The file-rotation callback must be invoked without a lock on 'd_mutex'
+    // to allow the callback to invoke other manipulators on this object.
+
+    if (!rotations.empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+        if (d_onRotationCb) {
+            for (bsl::size_t i = 0; i < rotations.size(); ++i) {
+                d_onRotationCb(rotations[i].first, rotations[i].second);
+            }
+        }
+    }
+}
+
+void FileObserver2::publicationThreadEntryPoint()
+{
+    bsls::Types::Uint64 numTaken;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+        d_threadId = bslmt::ThreadUtil::selfIdAsUint64();
+        numTaken   = d_numWritten;
     }
 
-    return 1;
+    while (true) {
+        const bsls::Types::Uint64 numStaged = d_numStaged.load();
+
+        if (numTaken == numStaged) {
+            bool stop;
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+
+                d_threadWaitingFlag = true;
+                while (numTaken == d_numStaged.load() && !d_stopFlag) {
+                    d_stagedCondition.wait(&d_stagingMutex);
+                    d_threadWaitingFlag = true;
+                }
+                d_threadWaitingFlag = false;
+
+                stop = d_stopFlag;
+            }
+
+            if (stop) {
+                // Wait for any thread staging a record, having observed
+                // `d_asyncFlag` as `true`, to finish doing so.
+
+                for (FileObserver2_StagingBuffer *buffer =
+                                               d_stagingBuffers.loadAcquire();
+                     buffer;
+                     buffer = buffer->d_next_p) {
+                    bslmt::LockGuard<bslmt::Mutex> guard(&buffer->d_mutex);
+                }
+
+                if (numTaken == d_numStaged.load()) {
+                    break;                                             // BREAK
+                }
+            }
+            continue;
+        }
+
+        takeStagedRecords(numTaken, numStaged);
+        numTaken = numStaged;
+
+        {
+            // Publishing threads may be blocked on a full staging buffer.
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+            d_writtenCondition.broadcast();
+        }
+
+        publishBatch();
+
+        d_batchText.clear();
+        d_batchRecords.clear();
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+            d_numWritten = numTaken;
+        }
+        d_writtenCondition.broadcast();
+    }
+}
+
+void FileObserver2::syncLogFile()
+{
+    if (!d_logStreamBuf.isOpened()) {
+        return;                                                       // RETURN
+    }
+
+    d_logOutStream.flush();
+
+    if (0 != syncFileData(d_logStreamBuf.fileDescriptor())) {
+        LOG_PLATFORM_MESSAGE(bsls::LogSeverity::e_WARN,
+                             "Cannot sync log file %s to storage: %s.",
+                             d_logFileName.c_str(),
+                             bsl::strerror(getErrorCode()));
+    }
+}
+
+void FileObserver2::takeStagedRecords(bsls::Types::Uint64 numTaken,
+                                      bsls::Types::Uint64 numStaged)
+{
+    BSLS_ASSERT(numTaken < numStaged);
+
+    typedef FileObserver2_StagingBuffer::Entries Entries;
+
+    // Every record having a sequence number in '[numTaken, numStaged)' is
+    // taken from exactly one buffer, so that the records taken can be merged
+    // by placing each of them at the index given by its sequence number.
+
+    const TakenRecord none = { 0, 0 };
+    d_takenRecords.assign(static_cast<bsl::size_t>(numStaged - numTaken),
+                          none);
+
+    for (FileObserver2_StagingBuffer *buffer = d_stagingBuffers.loadAcquire();
+         buffer;
+         buffer = buffer->d_next_p) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&buffer->d_mutex);
+            buffer->take(numStaged);
+        }
+
+        const Entries& entries = buffer->d_takenEntries;
+        for (bsl::size_t i = 0; i < entries.size(); ++i) {
+            BSLS_ASSERT(numTaken  <= entries[i].d_sequence);
+            BSLS_ASSERT(numStaged >  entries[i].d_sequence);
+
+            TakenRecord& taken = d_takenRecords[static_cast<bsl::size_t>(
+                                            entries[i].d_sequence - numTaken)];
+            taken.d_buffer_p = buffer;
+            taken.d_index    = i;
+        }
+    }
+
+    for (bsl::vector<TakenRecord>::const_iterator it  = d_takenRecords.begin();
+                                                  it != d_takenRecords.end();
+                                                  ++it) {
+        BSLS_ASSERT(it->d_buffer_p);
+
+        const Entries&     entries = it->d_buffer_p->d_takenEntries;
+        const bsl::size_t  begin   = it->d_index
+                                   ? entries[it->d_index - 1].d_end
+                                   : 0;
+
+        d_batchText.append(it->d_buffer_p->d_takenText.data() + begin,
+                           entries[it->d_index].d_end - begin);
+
+        PendingRecord pending;
+        pending.d_end          = d_batchText.size();
+        pending.d_timestampUtc = entries[it->d_index].d_timestampUtc;
+        d_batchRecords.push_back(pending);
+    }
+
+    for (FileObserver2_StagingBuffer *buffer = d_stagingBuffers.loadAcquire();
+         buffer;
+         buffer = buffer->d_next_p) {
+        buffer->d_takenText.clear();
+        buffer->d_takenEntries.clear();
+    }
+}
+
+void FileObserver2::waitUntilStagedRecordsWritten()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle
+     || bslmt::ThreadUtil::selfIdAsUint64() == d_threadId) {
+        return;                                                       // RETURN
+    }
+
+    // Note that, unlike waiting for the staging buffers to be empty, waiting
+    // for the records staged so far cannot be delayed indefinitely by other
+    // publishing threads.
+
+    const bsls::Types::Uint64 numStaged = d_numStaged.load();
+
+    while (d_numWritten < numStaged) {
+        d_writtenCondition.wait(&d_stagingMutex);
+    }
+}
+
+void FileObserver2::writeToLogFile(const char *data, bsl::size_t length)
+{
+    if (0 == length || !d_logStreamBuf.isOpened()) {
+        return;                                                       // RETURN
+    }
+
+    d_logOutStream.write(data, static_cast<bsl::streamsize>(length));
+
+    if (!d_logOutStream) {
+        LOG_PLATFORM_MESSAGE(bsls::LogSeverity::e_ERROR,
+                             "Error on file stream for %s: %s.",
+                             d_logFileName.c_str(),
+                             bsl::strerror(getErrorCode()));
+
+        d_logStreamBuf.clear();
+    }
 }
 
 // PRIVATE ACCESSORS
+bool FileObserver2::isRotationNecessary(
+                                 bsls::Types::Uint64   fileSize,
+                                 const bdlt::Datetime& timestampUtc) const
+{
+    if (d_rotationSize
+     && fileSize > static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
+        return true;                                                  // RETURN
+    }
+
+    return d_rotationInterval.totalSeconds()
+        && d_nextRotationTimeUtc <= timestampUtc;
+}
+
 template <class STRING>
 bool FileObserver2::isFileLoggingEnabledImpl(STRING *result) const
 {
@@ -522,19 +1053,55 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  bsl::allocator<FileObserver2::OnFileRotationCallback>(
                                                                basicAllocator))
 , d_rotationCbMutex()
+, d_dataSyncFlag(false)
+, d_asyncFlag(false)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_threadId(0)
+, d_stopFlag(false)
+, d_threadWaitingFlag(false)
+, d_hasStagingKey(false)
+, d_stagingBuffers(0)
+, d_numStaged(0)
+, d_numWritten(0)
+, d_takenRecords(basicAllocator)
+, d_batchText(basicAllocator)
+, d_batchRecords(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
 FileObserver2::~FileObserver2()
 {
+    stopPublicationThread();
+
+    if (d_hasStagingKey) {
+        bslmt::ThreadUtil::deleteKey(d_stagingKey);
+    }
+
+    FileObserver2_StagingBuffer *buffer = d_stagingBuffers.loadAcquire();
+    while (buffer) {
+        FileObserver2_StagingBuffer *next = buffer->d_next_p;
+        d_allocator_p->deleteObject(buffer);
+        buffer = next;
+    }
+
     if (d_logStreamBuf.isOpened()) {
         d_logStreamBuf.clear();
     }
 }
 
 // MANIPULATORS
+void FileObserver2::disableDataSyncOnWrite()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_dataSyncFlag = false;
+}
+
 void FileObserver2::disableFileLogging()
 {
+    waitUntilStagedRecordsWritten();
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
     if (d_logStreamBuf.isOpened()) {
@@ -550,6 +1117,8 @@ void FileObserver2::disableLifetimeRotation()
 void FileObserver2::disablePublishInLocalTime()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> formatterGuard(
+                                                             &d_formatterLock);
     d_observerFormatterImp.setTimezoneDefault(RecordFormatterTimezone::e_UTC);
 }
 
@@ -567,6 +1136,13 @@ void FileObserver2::disableTimeIntervalRotation()
     d_rotationInterval.setTotalSeconds(0);
 }
 
+void FileObserver2::enableDataSyncOnWrite()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_dataSyncFlag = true;
+}
+
 int FileObserver2::enableFileLogging(const char *logFilenamePattern)
 {
     BSLS_ASSERT(logFilenamePattern);
@@ -621,6 +1197,8 @@ int FileObserver2::enableFileLogging(const char *logFilenamePattern,
 
 void FileObserver2::forceRotation()
 {
+    waitUntilStagedRecordsWritten();
+
     bsl::string rotatedLogFileName;
     int         rotationStatus;
     {
@@ -642,6 +1220,8 @@ void FileObserver2::forceRotation()
 void FileObserver2::enablePublishInLocalTime()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> formatterGuard(
+                                                             &d_formatterLock);
     d_observerFormatterImp.setTimezoneDefault(
                                            RecordFormatterTimezone::e_LOCAL);
 }
@@ -649,6 +1229,90 @@ void FileObserver2::enablePublishInLocalTime()
 void FileObserver2::publish(const bsl::shared_ptr<const Record>& record,
                             const Context&)
 {
+    if (d_asyncFlag) {
+        // Format the record into a buffer owned by this thread, so that the
+        // lock of its staging buffer is held only while the formatted text is
+        // copied.
+
+        FileObserver2_StagingBuffer *buffer    = localStagingBuffer();
+        FileObserver2_RecordBuffer&  formatted = buffer->d_formatBuffer;
+
+        formatted.reset();
+        {
+            bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                             &d_formatterLock);
+            d_observerFormatterImp.formatLogRecord(formatted.stream(), record);
+        }
+
+        bool isStaged = false;
+
+        while (true) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&buffer->d_mutex);
+
+                if (!d_asyncFlag) {
+                    break;                                             // BREAK
+                }
+
+                if (buffer->d_text.size() < k_MAX_STAGED_BYTES) {
+                    buffer->d_text.append(formatted.data(),
+                                          formatted.length());
+
+                    FileObserver2_StagingBuffer::Entry entry;
+                    entry.d_sequence     = 0;
+                    entry.d_end          = buffer->d_text.size();
+                    entry.d_timestampUtc = record->fixedFields().timestamp();
+                    buffer->d_entries.push_back(entry);
+
+                    // The sequence number is assigned last, so that no
+                    // sequence number is lost if an exception is thrown.
+
+                    buffer->d_entries.back().d_sequence =
+                                                       d_numStaged.add(1) - 1;
+                    isStaged = true;
+                    break;                                             // BREAK
+                }
+            }
+
+            // Wait for the publication thread to take the records staged by
+            // this thread.
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+
+            while (d_asyncFlag) {
+                bsl::size_t length;
+                {
+                    bslmt::LockGuard<bslmt::Mutex> bufferGuard(
+                                                             &buffer->d_mutex);
+                    length = buffer->d_text.size();
+                }
+                if (length < k_MAX_STAGED_BYTES) {
+                    break;                                             // BREAK
+                }
+                d_writtenCondition.wait(&d_stagingMutex);
+            }
+        }
+
+        if (isStaged) {
+            // The publication thread sets `d_threadWaitingFlag` before
+            // checking for staged records, and so need be woken only if the
+            // flag is set.
+
+            if (d_threadWaitingFlag) {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+
+                if (d_threadWaitingFlag) {
+                    d_threadWaitingFlag = false;
+                    d_stagedCondition.signal();
+                }
+            }
+            return;                                                   // RETURN
+        }
+
+        // The publication thread was stopped after the record was formatted;
+        // publish the record synchronously.
+    }
+
     bsl::string rotatedFileName;
     int         rotationStatus;
 
@@ -668,6 +1332,9 @@ void FileObserver2::publish(const bsl::shared_ptr<const Record>& record,
 
                 d_logStreamBuf.clear();
             }
+            else if (d_dataSyncFlag) {
+                syncLogFile();
+            }
         }
     }
 
@@ -741,6 +1408,8 @@ void FileObserver2::rotateOnSize(int size)
 void FileObserver2::setLogFileFunctor(const RecordFormatter& logFileFunctor)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> formatterGuard(
+                                                             &d_formatterLock);
 
     d_observerFormatterImp.setFormatFunctor(logFileFunctor);
 }
@@ -748,6 +1417,8 @@ void FileObserver2::setLogFileFunctor(const RecordFormatter& logFileFunctor)
 int FileObserver2::setFormat(const bsl::string_view& format)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> formatterGuard(
+                                                             &d_formatterLock);
     return d_observerFormatterImp.setFormat(format);
 }
 
@@ -758,7 +1429,87 @@ void FileObserver2::setOnFileRotationCallback(
     d_onRotationCb = onRotationCallback;
 }
 
+int FileObserver2::startPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> threadGuard(&d_threadMutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
+        return 0;                                                     // RETURN
+    }
+
+    if (!d_hasStagingKey) {
+        const int rc = bslmt::ThreadUtil::createKey(&d_stagingKey,
+                                                    &releaseStagingBuffer);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+        d_hasStagingKey = true;
+    }
+
+    bslmt::ThreadAttributes attr;
+    attr.setThreadName(k_THREAD_NAME);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+
+    d_stopFlag = false;
+
+    const int rc = bslmt::ThreadUtil::create(
+        &d_threadHandle,
+        attr,
+        bdlf::MemFnUtil::memFn(&FileObserver2::publicationThreadEntryPoint,
+                               this));
+    if (0 != rc) {
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+        return rc;                                                    // RETURN
+    }
+
+    d_asyncFlag = true;
+
+    return 0;
+}
+
+int FileObserver2::stopPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> threadGuard(&d_threadMutex);
+
+    bslmt::ThreadUtil::Handle handle;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+
+        if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle) {
+            return 0;                                                 // RETURN
+        }
+
+        // Once 'd_asyncFlag' is 'false' no further records are staged, so
+        // that the publication thread terminates after writing the records
+        // already staged.
+
+        d_asyncFlag = false;
+        d_stopFlag  = true;
+        handle      = d_threadHandle;
+
+        d_stagedCondition.signal();
+        d_writtenCondition.broadcast();
+    }
+
+    const int rc = bslmt::ThreadUtil::join(handle);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_stagingMutex);
+
+    d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+    d_threadId     = 0;
+
+    return rc;
+}
+
 // ACCESSORS
+bool FileObserver2::isDataSyncOnWriteEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_dataSyncFlag;
+}
+
 bool FileObserver2::isFileLoggingEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -783,6 +1534,11 @@ bool FileObserver2::isFileLoggingEnabled(std::pmr::string *result) const
 }
 #endif  //BSLS_LIBRARYFEATURES_HAS_CPP17_PMR_STRING
 
+bool FileObserver2::isPublicationThreadRunning() const
+{
+    return d_asyncFlag;
+}
+
 bool FileObserver2::isPublishInLocalTimeEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -23,10 +23,12 @@ BSLS_IDENT("$Id: $")
 //              ( ball::FileObserver2 )
 //               `-------------------'
 //                        |              ctor
+//                        |              disableDataSyncOnWrite
 //                        |              disableFileLogging
 //                        |              disableTimeIntervalRotation
 //                        |              disableSizeRotation
 //                        |              disablePublishInLocalTime
+//                        |              enableDataSyncOnWrite
 //                        |              enableFileLogging
 //                        |              enablePublishInLocalTime
 //                        |              forceRotation
@@ -35,9 +37,13 @@ BSLS_IDENT("$Id: $")
 //                        |              setFormat
 //                        |              setLogFileFunctor
 //                        |              setOnFileRotationCallback
+//                        |              startPublicationThread
+//                        |              stopPublicationThread
 //                        |              suppressUniqueFileNameOnRotation
 //                        |              getFormat
+//                        |              isDataSyncOnWriteEnabled
 //                        |              isFileLoggingEnabled
+//                        |              isPublicationThreadRunning
 //                        |              isPublishInLocalTimeEnabled
 //                        |              isSuppressUniqueFileNameOnRotation
 //                        |              rotationLifetime
@@ -90,6 +96,14 @@ BSLS_IDENT("$Id: $")
 // |             | rotationLifetime                   |
 // |             | isSuppressUniqueFileNameOnRotation |
 // +-------------+------------------------------------+
+// | Publication | startPublicationThread             |
+// | Thread      | stopPublicationThread              |
+// | Management  | isPublicationThreadRunning         |
+// +-------------+------------------------------------+
+// | Data        | enableDataSyncOnWrite              |
+// | Durability  | disableDataSyncOnWrite             |
+// |             | isDataSyncOnWriteEnabled           |
+// +-------------+------------------------------------+
 // ```
 // In general, a `ball::FileObserver2` object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -302,6 +316,54 @@ BSLS_IDENT("$Id: $")
 // the period is one day), then a unique name on each rotation is produced with
 // the (local) time at which file rotation occurred embedded in the filename.
 //
+///Asynchronous Publication
+///-------------------------
+// By default, the `publish` method of `ball::FileObserver2` formats each
+// record and writes it to the log file in the calling thread, holding a lock
+// that serializes all publishing threads, so that a logging thread may stall
+// while another thread waits on the file system, or rotates the log file.
+//
+// Once the `startPublicationThread` method has been called, `publish` instead
+// formats each record and appends the formatted text to a staging buffer
+// owned by the calling thread, and returns.  Since each publishing thread
+// stages records in its own buffer, publishing threads do not contend with
+// each other, and contend with the publication thread only while it takes
+// the records staged in their buffers.  A publication thread owned by the
+// file observer repeatedly takes the records staged so far by all threads,
+// and writes them to the log file as a single batch, so that the cost of a
+// write (and of a flush, or a data sync) is shared by all of the records in
+// the batch.  Log file rotation is performed by the publication thread,
+// which checks the rotation rules (see {Log File Rotation}) before each
+// record exactly as `publish` does otherwise: a record is written to the new
+// log file if the log file is larger than the allowable size, or if the
+// timestamp of the record is not earlier than the scheduled rotation time,
+// when the record is reached.  The rotation callback (see
+// `setOnFileRotationCallback`) is invoked by the publication thread.
+//
+// Records are written to the log file in the order in which they are staged,
+// by all threads, and a record staged before a call to `disableFileLogging`
+// or `forceRotation` is written to the log file before that call takes
+// effect.  The `stopPublicationThread` method writes all of the records
+// staged before it was called, then stops the publication thread; `publish`
+// then reverts to synchronous publication.  If the records staged by a
+// thread have reached a fixed limit (16 megabytes of formatted text),
+// `publish` blocks in that thread until the publication thread has taken
+// them.  Staging buffers retain their memory until the file observer is
+// destroyed, and the buffer of a thread that has terminated is reused by the
+// next thread to publish a record.
+//
+// Note that in asynchronous mode the formatting functor of the file observer
+// (see `setFormat` and `setLogFileFunctor`) may be invoked concurrently by
+// multiple publishing threads.
+//
+///Data Durability
+///---------------
+// If `enableDataSyncOnWrite` has been called, the file observer flushes the
+// records that it writes to the log file, and requests that the operating
+// system transfer them to the storage device (e.g., using `fdatasync`),
+// before considering them written: after each record in synchronous mode,
+// and after each batch of records when a publication thread is running.
+//
 ///Thread Safety
 ///-------------
 // All methods of `ball::FileObserver2` are thread-safe, and can be called
@@ -373,6 +435,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdls_fdstreambuf.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -383,16 +447,24 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_condition.h>
 #include <bslmt_mutex.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
 
 #include <bsls_keyword.h>
 #include <bsls_libraryfeatures.h>
+#include <bsls_types.h>
 
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
 #include <bsl_memory.h>
+#include <bsl_ostream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <string>           // `std::string`, `std::pmr::string`
 
@@ -400,8 +472,59 @@ namespace BloombergLP {
 namespace ball {
 
 class Context;
+class FileObserver2_StagingBuffer;
 class Record;
 
+                      // ================================
+                      // class FileObserver2_RecordBuffer
+                      // ================================
+
+/// This component-private class provides an output stream that writes to an
+/// in-memory buffer, and retains the capacity of the buffer when it is reset.
+/// It is used by threads that format records to be written asynchronously.
+class FileObserver2_RecordBuffer {
+
+    // DATA
+    bdlsb::MemOutStreamBuf d_buffer;  // buffer holding the formatted text
+
+    bsl::ostream           d_stream;  // stream writing to `d_buffer`
+
+  private:
+    // NOT IMPLEMENTED
+    FileObserver2_RecordBuffer(const FileObserver2_RecordBuffer&);
+    FileObserver2_RecordBuffer& operator=(const FileObserver2_RecordBuffer&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FileObserver2_RecordBuffer,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an empty record buffer.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    explicit FileObserver2_RecordBuffer(bslma::Allocator *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Remove the contents of this buffer, and clear the state of its
+    /// stream, without releasing memory.
+    void reset();
+
+    /// Return a reference providing modifiable access to the stream that
+    /// writes to this buffer.
+    bsl::ostream& stream();
+
+    // ACCESSORS
+
+    /// Return the address of the text held in this buffer.
+    const char *data() const;
+
+    /// Return the number of characters held in this buffer.
+    bsl::size_t length() const;
+};
+
                           // ===================
                           // class FileObserver2
                           // ===================
@@ -436,6 +559,31 @@ class FileObserver2 : public Observer {
                                                         OnFileRotationCallback;
 
   private:
+    // PRIVATE TYPES
+
+    /// This `struct` describes a record that has been formatted by a
+    /// publishing thread, but not yet written to the log file.
+    struct PendingRecord {
+        bsl::size_t    d_end;           // offset, within the batch text, of
+                                        // the end of the formatted record
+
+        bdlt::Datetime d_timestampUtc;  // timestamp of the record
+    };
+
+    typedef bsl::vector<PendingRecord> PendingRecords;
+
+    /// This `struct` identifies a record taken from a staging buffer by the
+    /// publication thread.
+    struct TakenRecord {
+        const FileObserver2_StagingBuffer *d_buffer_p;  // buffer from which
+                                                        // the record was
+                                                        // taken
+
+        bsl::size_t                        d_index;     // index of the record
+                                                        // among those taken
+                                                        // from the buffer
+    };
+
     // DATA
     bdls::FdStreamBuf      d_logStreamBuf;             // stream buffer for
                                                        // file logging
@@ -495,14 +643,123 @@ class FileObserver2 : public Observer {
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    bslmt::ReaderWriterMutex
+                           d_formatterLock;            // serialize changes to
+                                                       // the formatter with
+                                                       // formatting by
+                                                       // publishing threads
+
+    bool                   d_dataSyncFlag;             // `true` if written
+                                                       // data is synchronized
+                                                       // to storage
+
+    bsls::AtomicBool       d_asyncFlag;                // `true` if `publish`
+                                                       // stages records for
+                                                       // the publication
+                                                       // thread
+
+    bslmt::ThreadUtil::Handle
+                           d_threadHandle;             // handle of the
+                                                       // publication thread
+
+    bsls::Types::Uint64    d_threadId;                 // id of the
+                                                       // publication thread
+
+    bool                   d_stopFlag;                 // `true` if the
+                                                       // publication thread
+                                                       // is to stop once the
+                                                       // staged records are
+                                                       // written
+
+    bsls::AtomicBool       d_threadWaitingFlag;        // `true` if the
+                                                       // publication thread
+                                                       // is waiting for
+                                                       // staged records
+
+    bool                   d_hasStagingKey;            // `true` if
+                                                       // `d_stagingKey` has
+                                                       // been created
+
+    bslmt::ThreadUtil::Key d_stagingKey;               // thread-specific
+                                                       // staging buffer of
+                                                       // the calling thread
+
+    bsls::AtomicPointer<FileObserver2_StagingBuffer>
+                           d_stagingBuffers;           // list of all staging
+                                                       // buffers (never
+                                                       // shrinks)
+
+    bsls::AtomicUint64     d_numStaged;                // number of records
+                                                       // ever staged, which
+                                                       // is the sequence
+                                                       // number of the next
+                                                       // record staged
+
+    bsls::Types::Uint64    d_numWritten;               // number of staged
+                                                       // records ever written
+                                                       // (or dropped)
+
+    bslmt::Mutex           d_stagingMutex;             // serialize waiting
+                                                       // for staged records
+                                                       // with staging them,
+                                                       // and waiting for
+                                                       // records to be taken
+                                                       // or written with
+                                                       // taking or writing
+                                                       // them
+
+    bslmt::Condition       d_stagedCondition;          // signaled when
+                                                       // records are staged,
+                                                       // or a stop is
+                                                       // requested
+
+    bslmt::Condition       d_writtenCondition;         // signaled when staged
+                                                       // records are taken,
+                                                       // or written
+
+    bslmt::Mutex           d_threadMutex;              // serialize starting
+                                                       // and stopping the
+                                                       // publication thread
+
+    bsl::vector<TakenRecord>
+                           d_takenRecords;             // records taken from
+                                                       // the staging buffers,
+                                                       // indexed by sequence
+                                                       // number (used only by
+                                                       // the publication
+                                                       // thread)
+
+    bsl::string            d_batchText;                // batch being written
+                                                       // (used only by the
+                                                       // publication thread)
+
+    PendingRecords         d_batchRecords;             // records described by
+                                                       // `d_batchText`
+
+    bslma::Allocator      *d_allocator_p;              // memory allocator
+                                                       // (held, not owned)
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
     FileObserver2& operator=(const FileObserver2&);
 
   private:
+    // PRIVATE CLASS METHODS
+
+    /// Release the specified staging `buffer` for reuse by another thread.
+    /// This method is invoked when a thread that has staged records
+    /// terminates.
+    static void releaseStagingBuffer(void *buffer);
+
     // PRIVATE MANIPULATORS
 
+    /// Return the staging buffer associated with the calling thread,
+    /// creating (or claiming an unused) buffer if the calling thread does
+    /// not have one.  The behavior is undefined unless `d_stagingKey` has
+    /// been created.
+    FileObserver2_StagingBuffer *localStagingBuffer();
+
     /// Perform a log file rotation by closing the current log file of this
     /// file observer, renaming the closed log file if necessary, and
     /// opening a new log file.  Load, into the specified
@@ -526,8 +783,57 @@ class FileObserver2 : public Observer {
     int rotateIfNecessary(bsl::string           *rotatedLogFileName,
                           const bdlt::Datetime&  currentLogTimeUtc);
 
+    /// Write the records held in `d_batchText` to the log file, performing
+    /// log file rotation before each record as `publish` would (see
+    /// `rotateIfNecessary`), flush the log file, and synchronize it to
+    /// storage if `isDataSyncOnWriteEnabled` is `true`.  Invoke the rotation
+    /// callback, without holding the lock for this object, for every
+    /// attempted rotation.  The behavior is undefined unless this method is
+    /// called by the publication thread.
+    void publishBatch();
+
+    /// Repeatedly take the records staged by `publish` and write them to the
+    /// log file until a stop is requested and no staged records remain.
+    void publicationThreadEntryPoint();
+
+    /// Take, from the staging buffers, the records having a sequence number
+    /// at least the specified `numTaken` and less than the specified
+    /// `numStaged`, and load them into `d_batchText` and `d_batchRecords` in
+    /// order of sequence number.  The behavior is undefined unless every
+    /// record having a sequence number less than `numTaken` has already
+    /// been taken, `numTaken < numStaged`, `numStaged` records have been
+    /// staged, and this method is called by the publication thread.
+    void takeStagedRecords(bsls::Types::Uint64 numTaken,
+                           bsls::Types::Uint64 numStaged);
+
+    /// Write the specified `length` characters starting at the specified
+    /// `data` to the log file if it is open, and close the log file on
+    /// error.  The behavior is undefined unless the caller acquired the lock
+    /// for this object.
+    void writeToLogFile(const char *data, bsl::size_t length);
+
+    /// Flush the log file and request that the operating system transfer its
+    /// contents to the storage device, if the log file is open.  The
+    /// behavior is undefined unless the caller acquired the lock for this
+    /// object.
+    void syncLogFile();
+
+    /// Block until every record staged for the publication thread before
+    /// this call has been written to the log file (or dropped).  Return
+    /// immediately if there is no publication thread, or if called by the
+    /// publication thread (e.g., from the rotation callback).
+    void waitUntilStagedRecordsWritten();
+
     // PRIVATE ACCESSORS
 
+    /// Return `true` if the log file must be rotated before writing a record
+    /// having the specified `timestampUtc` to it, given that the log file
+    /// holds the specified `fileSize` bytes, and `false` otherwise.  The
+    /// behavior is undefined unless the log file is open and the caller
+    /// acquired the lock for this object.
+    bool isRotationNecessary(bsls::Types::Uint64   fileSize,
+                             const bdlt::Datetime& timestampUtc) const;
+
     /// Return `true` if file logging is enabled for this file observer, and
     /// `false` otherwise.  Load the specified `result` with the name of the
     /// current log file if file logging is enabled, and leave `result`
@@ -551,16 +857,24 @@ class FileObserver2 : public Observer {
     /// is in effect for file logging (see `setLogFileFunctor`).
     explicit FileObserver2(bslma::Allocator *basicAllocator = 0);
 
-    /// Close the log file of this file observer if file logging is enabled,
-    /// and destroy this file observer.
+    /// Stop the publication thread, if any, after writing the records staged
+    /// for it, close the log file of this file observer if file logging is
+    /// enabled, and destroy this file observer.
     ~FileObserver2() BSLS_KEYWORD_OVERRIDE;
 
     // MANIPULATORS
 
+    /// Disable synchronizing the log file to storage after writing records
+    /// to it.  This method has no effect if data sync on write is not
+    /// enabled.
+    void disableDataSyncOnWrite();
+
     /// Disable file logging for this file observer.  This method has no
-    /// effect if file logging is not enabled.  Note that records
-    /// subsequently received through the `publish` method will be dropped
-    /// until file logging is re-enabled.
+    /// effect if file logging is not enabled.  If a publication thread is
+    /// running, records staged before this call are written to the log file
+    /// before it is closed.  Note that records subsequently received
+    /// through the `publish` method will be dropped until file logging is
+    /// re-enabled.
     void disableFileLogging();
 
     /// Disable log file rotation based on a periodic time interval for this
@@ -587,6 +901,13 @@ class FileObserver2 : public Observer {
     /// rotation-on-time-interval is not enabled.
     void disableTimeIntervalRotation();
 
+    /// Enable synchronizing the log file to storage after writing records to
+    /// it: after each record in synchronous mode, and after each batch of
+    /// records when a publication thread is running.  This method has no
+    /// effect if data sync on write is already enabled.  See {Data
+    /// Durability}.
+    void enableDataSyncOnWrite();
+
     /// Enable logging of all records published to this file observer to a
     /// file whose name is derived from the specified `logFilenamePattern`.
     /// Return 0 on success, a positive value if file logging is already
@@ -648,7 +969,9 @@ class FileObserver2 : public Observer {
     /// pointer having the specified publishing `context` by writing the
     /// record and `context` to the current log file if file logging is
     /// enabled for this file observer.  The method has no effect if file
-    /// logging is not enabled, in which case `record` is dropped.
+    /// logging is not enabled, in which case `record` is dropped.  If a
+    /// publication thread is running, format `record` and stage it to be
+    /// written by the publication thread (see {Asynchronous Publication}).
     void publish(const bsl::shared_ptr<const Record>& record,
                  const Context&                       context)
                                                          BSLS_KEYWORD_OVERRIDE;
@@ -662,8 +985,9 @@ class FileObserver2 : public Observer {
     /// Forcefully perform a log file rotation by this file observer.  Close
     /// the current log file, rename the log file if necessary, and open a
     /// new log file.  This method has no effect if file logging is not
-    /// enabled.  See {Rotated File Naming} for details on filenames of
-    /// rotated log files.
+    /// enabled.  If a publication thread is running, records staged before
+    /// this call are written to the log file before it is rotated.  See
+    /// {Rotated File Naming} for details on filenames of rotated log files.
     void forceRotation();
 
     /// Set this file observer to perform log file rotation when the size of
@@ -733,6 +1057,25 @@ class FileObserver2 : public Observer {
     void setOnFileRotationCallback(
                              const OnFileRotationCallback& onRotationCallback);
 
+    /// Start a publication thread to asynchronously write the records
+    /// received by `publish` to the log file (see {Asynchronous
+    /// Publication}).  If a publication thread is already running, this
+    /// operation has no effect.  Return 0 on success, and a non-zero value
+    /// if there is an error creating the publication thread, or the
+    /// thread-specific storage that identifies the staging buffer of each
+    /// publishing thread.
+    int startPublicationThread();
+
+    /// Block until all records staged for the publication thread upon entry
+    /// have been written to the log file, then stop the publication thread.
+    /// If there is no publication thread this operation has no effect.
+    /// Return 0 on success, and a non-zero value if there is an error
+    /// joining the publication thread.  Note that records received by
+    /// `publish` after this method returns are written by the calling
+    /// thread.  The behavior is undefined if this method is called from the
+    /// rotation callback.
+    int stopPublicationThread();
+
     /// Suppress generating a unique log file name upon rotation if the
     /// specified `suppress` is `true`, and generate a unique filename
     /// otherwise.  See {Rotated File Naming} for details.
@@ -740,6 +1083,10 @@ class FileObserver2 : public Observer {
 
     // ACCESSORS
 
+    /// Return `true` if this file observer synchronizes the log file to
+    /// storage after writing records to it, and `false` otherwise.
+    bool isDataSyncOnWriteEnabled() const;
+
     /// Return `true` if file logging is enabled for this file observer, and
     /// `false` otherwise.  Load the optionally specified `result` with the
     /// name of the current log file if file logging is enabled, and leave
@@ -758,6 +1105,10 @@ class FileObserver2 : public Observer {
     bool isFileLoggingEnabled(std::pmr::string *result) const;
 #endif  // BSLS_LIBRARYFEATURES_HAS_CPP17_PMR_STRING
 
+    /// Return `true` if a publication thread is running, and `false`
+    /// otherwise.
+    bool isPublicationThreadRunning() const;
+
     /// Return `true` if this file observer writes the timestamp attribute
     /// of records that it publishes in local time, and `false` otherwise
     /// (in which case timestamps are written in UTC time).  Note that the
@@ -797,6 +1148,46 @@ class FileObserver2 : public Observer {
 //                              INLINE DEFINITIONS
 // ============================================================================
 
+                      // --------------------------------
+                      // class FileObserver2_RecordBuffer
+                      // --------------------------------
+
+// CREATORS
+inline
+FileObserver2_RecordBuffer::FileObserver2_RecordBuffer(
+                                              bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_stream(&d_buffer)
+{
+}
+
+// MANIPULATORS
+inline
+void FileObserver2_RecordBuffer::reset()
+{
+    d_buffer.pubseekpos(0, bsl::ios_base::out);
+    d_stream.clear();
+}
+
+inline
+bsl::ostream& FileObserver2_RecordBuffer::stream()
+{
+    return d_stream;
+}
+
+// ACCESSORS
+inline
+const char *FileObserver2_RecordBuffer::data() const
+{
+    return d_buffer.data();
+}
+
+inline
+bsl::size_t FileObserver2_RecordBuffer::length() const
+{
+    return d_buffer.length();
+}
+
                           // -------------------
                           // class FileObserver2
                           // -------------------
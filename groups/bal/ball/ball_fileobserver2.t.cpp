@@ -41,6 +41,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
@@ -90,13 +91,16 @@ using bsl::flush;
 // CREATORS
 // [ 1] FileObserver2(bslma::Allocator *);
 // [ 1] ~FileObserver2();
+// [14] ~FileObserver2();
 //
 // MANIPULATORS
+// [14] void disableDataSyncOnWrite();
 // [ 1] void disableFileLogging();
 // [ 2] void disableLifetimeRotation();
 // [ 1] void disablePublishInLocalTime();
 // [ 2] void disableSizeRotation();
 // [ 8] void disableTimeIntervalRotation();
+// [14] void enableDataSyncOnWrite();
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
 // [ 1] void enablePublishInLocalTime();
@@ -110,18 +114,23 @@ using bsl::flush;
 // [ 1] void setLogFileFunctor(const logRecordFunctor& logFileFunctor);
 // [ 1] int setFormat(const bsl::string_view& format);
 // [ 5] void setOnFileRotationCallback(const OnFileRotationCallback&);
+// [14] int startPublicationThread();
+// [14] int stopPublicationThread();
 //
 // ACCESSORS
 // [ 1] const bsl::string& getFormat() const;
+// [14] bool isDataSyncOnWriteEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 1] bool isFileLoggingEnabled(std::string *result) const;
 // [ 1] bool isFileLoggingEnabled(std::pmr::string *result) const;
+// [14] bool isPublicationThreadRunning() const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
+// [14] CONCERN: ASYNCHRONOUS PUBLICATION
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -488,6 +497,77 @@ void publishRecord(Obj *observer, const char *message)
     observer->publish(record, context);
 }
 
+/// Publish the specified `message` having the specified `timestampUtc` to the
+/// specified `observer` object.
+void publishRecordAt(Obj                   *observer,
+                     const char            *message,
+                     const bdlt::Datetime&  timestampUtc)
+{
+    ball::RecordAttributes attr(timestampUtc,
+                                1,
+                                2,
+                                3,
+                                "FILENAME",
+                                4,
+                                "CATEGORY",
+                                32,
+                                message);
+
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace(bslma::Default::allocator(),
+                         attr,
+                         ball::UserFields());
+    ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    observer->publish(record, context);
+}
+
+/// This class provides a functor that publishes a sequence of records, whose
+/// messages identify the publishing thread and the position of the record in
+/// the sequence, to the file observer supplied at construction.
+class PublishJob {
+
+    // DATA
+    Obj *d_observer_p;
+    int  d_threadIndex;
+    int  d_numRecords;
+
+  public:
+    // CREATORS
+
+    /// Create a job that publishes the specified `numRecords` records to
+    /// the specified `observer` on behalf of the thread having the specified
+    /// `threadIndex`.
+    PublishJob(Obj *observer, int threadIndex, int numRecords)
+    : d_observer_p(observer)
+    , d_threadIndex(threadIndex)
+    , d_numRecords(numRecords)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Publish the records of this job.
+    void operator()() const
+    {
+        for (int i = 0; i < d_numRecords; ++i) {
+            char message[32];
+            snprintf(message, sizeof message, "%d:%d", d_threadIndex, i);
+            publishRecord(d_observer_p, message);
+        }
+    }
+};
+
+/// Return the contents of the file with the specified `fileName`.
+bsl::string loadFile(const bsl::string& fileName)
+{
+    bsl::ifstream fs(fileName.c_str(), bsl::ifstream::in);
+    ASSERTV(fileName, fs.is_open());
+
+    bsl::ostringstream contents;
+    contents << fs.rdbuf();
+    return contents.str();
+}
 
 /// Return the number of lines in the file with the specified `fileName`.
 int getNumLines(const char *fileName)
@@ -705,7 +785,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -780,6 +860,433 @@ int main(int argc, char *argv[])
         ASSERT(0 == rc);
 // ```
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // CONCERN: ASYNCHRONOUS PUBLICATION
+        //
+        // Concerns:
+        // 1. `startPublicationThread` starts a publication thread, and has no
+        //    effect if one is already running; `stopPublicationThread` stops
+        //    it, and has no effect if none is running.
+        //
+        // 2. Records published while a publication thread is running are
+        //    written to the log file exactly as they are without one, in the
+        //    order in which they are published by each thread, and none are
+        //    lost when records are published by several threads.
+        //
+        // 3. Rotation on size and rotation on time interval take place before
+        //    the same records, and invoke the rotation callback with the same
+        //    arguments, with and without a publication thread.
+        //
+        // 4. Records published before `disableFileLogging` or
+        //    `forceRotation` are written before that call takes effect.
+        //
+        // 5. A rotation callback invoked by the publication thread may call
+        //    `disableFileLogging` on the observer.
+        //
+        // 6. The destructor writes the staged records.
+        //
+        // 7. Data sync on write can be enabled and disabled, and does not
+        //    affect the records written.
+        //
+        // 8. Records published by different threads are written in the order
+        //    in which they are published, including the records of a thread
+        //    that terminates before they are written, whose staging buffer is
+        //    then reused by another thread.
+        //
+        // Plan:
+        // 1. Start and stop the publication thread repeatedly, checking
+        //    `isPublicationThreadRunning`.  (C-1)
+        //
+        // 2. Publish the same records to two observers, one of which has a
+        //    publication thread, and compare the resulting log files.  Then
+        //    publish records from several threads, and verify that each
+        //    appears exactly once, after the preceding records published by
+        //    the same thread.  (C-2)
+        //
+        // 3. For each mode, configure rotation on a size of 1K, publish three
+        //    records of 600 bytes, and verify that exactly one rotation takes
+        //    place, before the third record.  Repeat for rotation on time
+        //    interval, publishing a record with a timestamp beyond the next
+        //    rotation time.  (C-3)
+        //
+        // 4. Publish records asynchronously, immediately call
+        //    `forceRotation` and `disableFileLogging`, and verify the
+        //    contents of the log files.  (C-4)
+        //
+        // 5. Install a `ReentrantRotationCallback`, and cause a rotation on
+        //    size in the publication thread.  (C-5)
+        //
+        // 6. Destroy an observer without stopping its publication thread and
+        //    verify the log file.  (C-6)
+        //
+        // 7. Repeat P-2 with data sync on write enabled.  (C-7)
+        //
+        // 8. Publish records from a succession of threads, each of which is
+        //    joined before the next is created, and verify that the records
+        //    are written in the order in which they are published.  (C-8)
+        //
+        // Testing:
+        //   ~FileObserver2();
+        //   void disableDataSyncOnWrite();
+        //   void enableDataSyncOnWrite();
+        //   int startPublicationThread();
+        //   int stopPublicationThread();
+        //   bool isDataSyncOnWriteEnabled() const;
+        //   bool isPublicationThreadRunning() const;
+        //   CONCERN: ASYNCHRONOUS PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: ASYNCHRONOUS PUBLICATION"
+                          << "\n=================================" << endl;
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+        const bsl::string        dirName(tempDirGuard.getTempDirName());
+
+        if (verbose) cout << "Starting and stopping the thread." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isPublicationThreadRunning());
+            ASSERT(0     == mX.stopPublicationThread());
+            ASSERT(false == X.isPublicationThreadRunning());
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(0     == mX.startPublicationThread());
+                ASSERT(true  == X.isPublicationThreadRunning());
+                ASSERT(0     == mX.startPublicationThread());
+                ASSERT(true  == X.isPublicationThreadRunning());
+                ASSERT(0     == mX.stopPublicationThread());
+                ASSERT(false == X.isPublicationThreadRunning());
+                ASSERT(0     == mX.stopPublicationThread());
+            }
+
+            ASSERT(false == X.isDataSyncOnWriteEnabled());
+            mX.enableDataSyncOnWrite();
+            ASSERT(true  == X.isDataSyncOnWriteEnabled());
+            mX.enableDataSyncOnWrite();
+            ASSERT(true  == X.isDataSyncOnWriteEnabled());
+            mX.disableDataSyncOnWrite();
+            ASSERT(false == X.isDataSyncOnWriteEnabled());
+        }
+
+        if (verbose) cout << "Comparing with synchronous publication."
+                          << endl;
+
+        for (int dataSync = 0; dataSync < 2; ++dataSync) {
+            bsl::string syncFileName(dirName);
+            bsl::string asyncFileName(dirName);
+            bdls::PathUtil::appendRaw(&syncFileName,
+                                      dataSync ? "sync_ds" : "sync");
+            bdls::PathUtil::appendRaw(&asyncFileName,
+                                      dataSync ? "async_ds" : "async");
+
+            Obj mS(&ta);
+            Obj mA(&ta);  const Obj& A = mA;
+
+            if (dataSync) {
+                mS.enableDataSyncOnWrite();
+                mA.enableDataSyncOnWrite();
+            }
+
+            ASSERT(0 == mS.enableFileLogging(syncFileName.c_str()));
+            ASSERT(0 == mA.enableFileLogging(asyncFileName.c_str()));
+            ASSERT(0 == mA.startPublicationThread());
+
+            for (int i = 0; i < 500; ++i) {
+                const bsl::string    message(i % 97,
+                                             static_cast<char>('a' + i % 26));
+                const bdlt::Datetime now = bdlt::CurrentTime::utc();
+
+                publishRecordAt(&mS, message.c_str(), now);
+                publishRecordAt(&mA, message.c_str(), now);
+            }
+
+            ASSERT(0     == mA.stopPublicationThread());
+            ASSERT(false == A.isPublicationThreadRunning());
+
+            // Records published with no publication thread are written
+            // synchronously.
+
+            const bdlt::Datetime now = bdlt::CurrentTime::utc();
+
+            publishRecordAt(&mS, "after", now);
+            publishRecordAt(&mA, "after", now);
+
+            mS.disableFileLogging();
+            mA.disableFileLogging();
+
+            const bsl::string syncContents  = loadFile(syncFileName);
+            const bsl::string asyncContents = loadFile(asyncFileName);
+
+            ASSERTV(dataSync, 501 * 2 == getNumLines(syncFileName.c_str()));
+            ASSERTV(dataSync, syncContents == asyncContents);
+        }
+
+        if (verbose) cout << "Publishing from several threads." << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 2000 };
+
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "threads");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.setFormat("%m\n"));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.startPublicationThread());
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                         &handles[i],
+                                         PublishJob(&mX, i, k_NUM_RECORDS)));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            bsl::ifstream fs(fileName.c_str());
+            int           next[k_NUM_THREADS] = { 0 };
+            int           numLines            = 0;
+            bsl::string   line;
+
+            while (getline(fs, line)) {
+                int threadIndex = -1;
+                int recordIndex = -1;
+                ASSERTV(line, 2 == sscanf(line.c_str(),
+                                          "%d:%d",
+                                          &threadIndex,
+                                          &recordIndex));
+                if (0 <= threadIndex && threadIndex < k_NUM_THREADS) {
+                    ASSERTV(line, next[threadIndex] == recordIndex);
+                    next[threadIndex] = recordIndex + 1;
+                }
+                ++numLines;
+            }
+
+            ASSERTV(numLines, k_NUM_THREADS * k_NUM_RECORDS == numLines);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, next[i], k_NUM_RECORDS == next[i]);
+            }
+        }
+
+        if (verbose) cout << "Publishing from successive threads." << endl;
+        {
+            enum { k_NUM_THREADS = 20, k_NUM_RECORDS = 50 };
+
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "successive");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.setFormat("%m\n"));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.startPublicationThread());
+
+            // The staging buffer of each thread is released when the thread
+            // terminates, typically before its records are written, and is
+            // then claimed by the next thread.
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                         &handle,
+                                         PublishJob(&mX, i, k_NUM_RECORDS)));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                if (k_NUM_THREADS / 2 == i) {
+                    ASSERT(0 == mX.stopPublicationThread());
+                    ASSERT(0 == mX.startPublicationThread());
+                }
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            bsl::ifstream fs(fileName.c_str());
+            int           numLines = 0;
+            bsl::string   line;
+
+            while (getline(fs, line)) {
+                int threadIndex = -1;
+                int recordIndex = -1;
+                ASSERTV(line, 2 == sscanf(line.c_str(),
+                                          "%d:%d",
+                                          &threadIndex,
+                                          &recordIndex));
+                ASSERTV(line, numLines / k_NUM_RECORDS == threadIndex);
+                ASSERTV(line, numLines % k_NUM_RECORDS == recordIndex);
+                ++numLines;
+            }
+
+            ASSERTV(numLines, k_NUM_THREADS * k_NUM_RECORDS == numLines);
+        }
+
+        if (verbose) cout << "Rotating on size." << endl;
+
+        for (int async = 0; async < 2; ++async) {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName,
+                                      async ? "size_async" : "size_sync");
+
+            RotCb cb(&ta);
+            Obj   mX(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+            ASSERT(0 == mX.setFormat("%m\n"));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            mX.rotateOnSize(1);
+
+            if (async) {
+                ASSERT(0 == mX.startPublicationThread());
+            }
+
+            const bsl::string message1(600, '1');
+            const bsl::string message2(600, '2');
+            const bsl::string message3(600, '3');
+
+            // The first two records, 1202 bytes in total, are written before
+            // the size of the log file exceeds 1024 bytes.
+
+            publishRecord(&mX, message1.c_str());
+            publishRecord(&mX, message2.c_str());
+            publishRecord(&mX, message3.c_str());
+
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            ASSERTV(async, cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(async, cb.status(),         0 == cb.status());
+            ASSERTV(async,
+                    message1 + "\n" + message2 + "\n" ==
+                                               loadFile(cb.rotatedFileName()));
+            ASSERTV(async, message3 + "\n" == loadFile(fileName));
+        }
+
+        if (verbose) cout << "Rotating on time interval." << endl;
+
+        for (int async = 0; async < 2; ++async) {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName,
+                                      async ? "time_async" : "time_sync");
+
+            RotCb cb(&ta);
+            Obj   mX(&ta);
+
+            const bdlt::Datetime now = bdlt::CurrentTime::utc();
+
+            mX.setOnFileRotationCallback(cb);
+            ASSERT(0 == mX.setFormat("%m\n"));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            mX.rotateOnTimeInterval(bdlt::DatetimeInterval(0, 1), now);
+
+            if (async) {
+                ASSERT(0 == mX.startPublicationThread());
+            }
+
+            bdlt::Datetime later(now);
+            later.addHours(2);
+
+            publishRecordAt(&mX, "before", now);
+            publishRecordAt(&mX, "after", later);
+
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            ASSERTV(async, cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(async, cb.status(),         0 == cb.status());
+            ASSERTV(async, "before\n" == loadFile(cb.rotatedFileName()));
+            ASSERTV(async, "after\n"  == loadFile(fileName));
+        }
+
+        if (verbose) cout << "Draining on `forceRotation` and "
+                             "`disableFileLogging`." << endl;
+        {
+            enum { k_NUM_RECORDS = 1000 };
+
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "drain");
+
+            RotCb cb(&ta);
+            Obj   mX(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+            ASSERT(0 == mX.setFormat("%m\n"));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.startPublicationThread());
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                publishRecord(&mX, "old");
+            }
+            mX.forceRotation();
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+            ASSERT(k_NUM_RECORDS == getNumLines(cb.rotatedFileName().c_str()));
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                publishRecord(&mX, "new");
+            }
+            mX.disableFileLogging();
+
+            ASSERT(k_NUM_RECORDS == getNumLines(fileName.c_str()));
+
+            // Records published with file logging disabled are dropped.
+
+            publishRecord(&mX, "dropped");
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(k_NUM_RECORDS == getNumLines(fileName.c_str()));
+        }
+
+        if (verbose) cout << "Reentrant rotation callback." << endl;
+        {
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "reentrant");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.setOnFileRotationCallback(ReentrantRotationCallback(&mX));
+            ASSERT(0 == mX.setFormat("%m\n"));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            mX.rotateOnSize(1);
+            ASSERT(0 == mX.startPublicationThread());
+
+            const bsl::string message(2000, 'x');
+
+            publishRecord(&mX, message.c_str());
+            publishRecord(&mX, message.c_str());
+
+            ASSERT(0     == mX.stopPublicationThread());
+            ASSERT(false == X.isFileLoggingEnabled());
+        }
+
+        if (verbose) cout << "Writing staged records on destruction."
+                          << endl;
+        {
+            enum { k_NUM_RECORDS = 1000 };
+
+            bsl::string fileName(dirName);
+            bdls::PathUtil::appendRaw(&fileName, "destroy");
+            {
+                Obj mX(&ta);
+
+                ASSERT(0 == mX.setFormat("%m\n"));
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+                ASSERT(0 == mX.startPublicationThread());
+
+                for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                    publishRecord(&mX, "record");
+                }
+            }
+            ASSERT(k_NUM_RECORDS == getNumLines(fileName.c_str()));
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
@@ -4140,6 +4647,101 @@ int main(int argc, char *argv[])
         // Deregister here as we used local allocator for the observer.
         ASSERT(0 == manager.deregisterObserver("testObserver"));
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ASYNCHRONOUS PUBLICATION
+        //
+        // Concern:
+        // 1. Publishing records with a publication thread running costs the
+        //    publishing threads less than publishing them synchronously.
+        //
+        // Plan:
+        // 1. For several numbers of publishing threads, publish a fixed number
+        //    of records from each thread, with and without a publication
+        //    thread, and with and without data sync on write, and report the
+        //    rate at which records are published, both as seen by the
+        //    publishing threads and including the time taken by
+        //    `stopPublicationThread` to write the staged records.
+        //
+        // Testing:
+        //   PERFORMANCE: ASYNCHRONOUS PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: ASYNCHRONOUS PUBLICATION"
+                             "\n=====================================\n";
+
+        enum { k_MAX_THREADS = 8 };
+
+        const int numRecords = 100000;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+
+        cout << "threads\tdata sync\tsync\tasync (publish)\tasync (total)"
+                " (records/s)" << endl;
+
+        for (int dataSync = 0; dataSync < 2; ++dataSync) {
+            for (int numThreads = 1;
+                 numThreads <= k_MAX_THREADS;
+                 numThreads *= 2) {
+                double publishRates[2];  // as seen by publishing threads
+                double totalRates[2];    // including writing staged records
+
+                for (int async = 0; async < 2; ++async) {
+                    bsl::string fileName(tempDirGuard.getTempDirName());
+                    bdls::PathUtil::appendRaw(&fileName, "perf");
+
+                    Obj mX;
+
+                    ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+                    if (dataSync) {
+                        mX.enableDataSyncOnWrite();
+                    }
+                    if (async) {
+                        ASSERT(0 == mX.startPublicationThread());
+                    }
+
+                    // Data sync on write after each record is slow; publish
+                    // fewer records in that configuration.
+
+                    const int perThread = dataSync && !async
+                                        ? numRecords / 100
+                                        : numRecords;
+
+                    bsls::Stopwatch timer;
+                    timer.start(true);
+
+                    bslmt::ThreadUtil::Handle handles[k_MAX_THREADS];
+                    for (int i = 0; i < numThreads; ++i) {
+                        ASSERT(0 == bslmt::ThreadUtil::create(
+                                               &handles[i],
+                                               PublishJob(&mX, i, perThread)));
+                    }
+                    for (int i = 0; i < numThreads; ++i) {
+                        ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                    }
+                    const double publishTime = timer.elapsedTime();
+
+                    ASSERT(0 == mX.stopPublicationThread());
+
+                    timer.stop();
+
+                    publishRates[async] = numThreads * perThread
+                                                                / publishTime;
+                    totalRates[async]   = numThreads * perThread
+                                                        / timer.elapsedTime();
+
+                    mX.disableFileLogging();
+                    ASSERT(0 == FsUtil::remove(fileName));
+                }
+
+                cout << numThreads      << '\t'
+                     << dataSync        << '\t'
+                     << totalRates[0]   << '\t'
+                     << publishRates[1] << '\t'
+                     << totalRates[1]   << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
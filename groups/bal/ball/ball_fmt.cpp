@@ -4,6 +4,20 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ball_fmt_cpp,"$Id$ $CSID$")
 
+namespace BloombergLP {
+namespace ball {
+
+                               // --------------
+                               // struct FmtUtil
+                               // --------------
+
+// CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int
+                                  FmtUtil::s_deferredFormattingEnabled = {0};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2025 Bloomberg Finance L.P.
 //
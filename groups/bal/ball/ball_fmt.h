@@ -7,6 +7,9 @@ BSLS_IDENT("$Id: $")
 
 //@PURPOSE: Provide macros to facilitate `bsl::format` logging.
 //
+//@CLASSES:
+//  ball::FmtUtil: namespace for configuring the `BALL_FMT_*` macros
+//
 //@MACROS:
 //  BALL_FMT: format a log record within a `*_BLOCK`
 //  BALL_FMT_TRACE: format a log record with the `e_TRACE` level
@@ -90,6 +93,41 @@ BSLS_IDENT("$Id: $")
 // BALL_FMT(format-string-literal, X, Y, ...)
 // ```
 //
+///Deferred Formatting
+///-------------------
+// Formatting a message on the thread that logs it can cost more than the
+// work being logged.  If deferred formatting is enabled (by calling
+// `ball::FmtUtil::setDeferredFormattingEnabled(true)`), the single-statement
+// `BALL_FMT_*` macros (e.g., `BALL_FMT_INFO`) do not format the message.
+// Instead, they capture the address of the format string and a compact
+// binary encoding of the arguments in the log record, and the message is
+// formatted by the first thread that accesses the message attribute of the
+// record (see `ball_recordattributes`) -- typically the thread that
+// publishes the record, such as the publication thread of a
+// `ball::AsyncFileObserver`.  The formatted message is identical to the one
+// that would be produced were formatting not deferred.
+//
+// Formatting of a message is deferred only if the format string is a
+// character array (e.g., a string literal) and each argument is of one of the
+// following types:
+//
+// * an arithmetic type (including `bool` and `char`), or
+// * `const char *` (which must not be null), a character array, `bsl::string`,
+//   `std::string`, or `bsl::string_view`.
+//
+// Other messages (e.g., those having arguments of user-defined types, or
+// wrapped by `bslfmt::streamed`) are formatted on the logging thread, as are
+// the messages written by `BALL_FMT` within a logging code block.  Note that
+// the format string and string arguments are copied into the record, so that
+// they need not outlive the logging statement.
+//
+// Deferred formatting is disabled by default, and is not available on
+// platforms lacking support for variadic templates and `decltype`.  Note that
+// an error in a format string that is detected only when the message is
+// formatted (which is not possible if the format string is checked at compile
+// time) results in an exception thrown by the logging macro if formatting is
+// not deferred, but results in a truncated message if it is.
+//
 ///Usage
 ///-----
 // The following code fragments illustrate the standard pattern of macro usage.
@@ -183,13 +221,65 @@ BSLS_IDENT("$Id: $")
 // Note that the wrapper created by `bslfmt::streamed` uses the `ostream`
 // insert `operator<<` of `abc::Identifier` to get the characters to print and
 // uses the syntax of string formatting for the format specification.
+//
+///Example 3: Deferring the Formatting of Messages
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// The following example shows how a latency-sensitive application can move
+// the formatting of its log messages off of its critical threads.
+//
+// First, we enable deferred formatting, typically once, early in `main`, and
+// in conjunction with an observer that publishes records on a thread of its
+// own (e.g., `ball::AsyncFileObserver`):
+// ```
+// ball::FmtUtil::setDeferredFormattingEnabled(true);
+// ```
+// Then, we log messages as usual:
+// ```
+// BALL_LOG_SET_CATEGORY("EXAMPLE.CATEGORY");
+//
+// const bsl::string symbol("IBM");
+// const double      price    = 187.5;
+// const int         quantity = 300;
+//
+// BALL_FMT_INFO("Filled {} {} @ {:.2f}", quantity, symbol, price);
+// // Logs: `Filled 300 IBM @ 187.50`
+// ```
+// The logging thread copies `quantity`, `symbol`, and `price` into the log
+// record, and the message is formatted when the observer first reads it.
+//
+// Finally, we note that messages having arguments that cannot be deferred are
+// still formatted immediately, with no change in the message logged:
+// ```
+// const abc::Identifier id(12345);
+// BALL_FMT_WARN("Item {:0>10} is stale.", bslfmt::streamed(id));
+// // Logs: `Item 0000012345 is stale.`
+// ```
 
 #include <balscm_version.h>
 
 #include <ball_log.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+
+#include <bdlsb_memoutstreambuf.h>
+#include <bdlsb_streambufoutputiterator.h>
 
+#include <bslmf_enableif.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isarithmetic.h>
+#include <bslmf_removecvref.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_compilerfeatures.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
 #include <bsl_format.h>
-#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+#include <string>
 
                          // =========================
                          // Logging Macro Definitions
@@ -197,33 +287,615 @@ BSLS_IDENT("$Id: $")
 
 #define BALL_FMT(...)                                                         \
     bsl::format_to(                                                           \
-        bsl::ostreambuf_iterator<char>(                                       \
+        BloombergLP::ball::Fmt_OutputIterator(                                \
             &BALL_LOG_RECORD->fixedFields().messageStreamBuf()),              \
         __VA_ARGS__)
 
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_DECLTYPE)
+
+#define BALL_FMT_DEFERRED_FORMATTING_SUPPORTED 1
+
+// `BALL_FMT_IMP` formats the message of the log record of the enclosing
+// `BALL_LOG_STREAM_CONST_IMP` statement, deferring the formatting (see
+// [](#Deferred Formatting)) if it is enabled and the arguments permit.  Note
+// that the arguments appear only in an unevaluated operand of the condition,
+// so that each is evaluated exactly once.
+
+#define BALL_FMT_IMP(...)                                                     \
+    if (BloombergLP::ball::Fmt_DeferUtil::isDeferred<decltype(                \
+                  BloombergLP::ball::Fmt_DeferUtil::probe(__VA_ARGS__))>()) { \
+        BloombergLP::ball::Fmt_DeferUtil::defer(BALL_LOG_RECORD,              \
+                                                __VA_ARGS__);                 \
+    }                                                                         \
+    else BALL_FMT(__VA_ARGS__)
+
+#else
+
+#define BALL_FMT_IMP(...) BALL_FMT(__VA_ARGS__)
+
+#endif
+
 #define BALL_FMT_TRACE(...)                                                   \
     BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_TRACE)           \
-    BALL_FMT(__VA_ARGS__)
+    BALL_FMT_IMP(__VA_ARGS__)
 
 #define BALL_FMT_DEBUG(...)                                                   \
     BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_DEBUG)           \
-    BALL_FMT(__VA_ARGS__)
+    BALL_FMT_IMP(__VA_ARGS__)
 
 #define BALL_FMT_INFO(...)                                                    \
     BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_INFO)            \
-    BALL_FMT(__VA_ARGS__)
+    BALL_FMT_IMP(__VA_ARGS__)
 
 #define BALL_FMT_WARN(...)                                                    \
     BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_WARN)            \
-    BALL_FMT(__VA_ARGS__)
+    BALL_FMT_IMP(__VA_ARGS__)
 
 #define BALL_FMT_ERROR(...)                                                   \
     BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_ERROR)           \
-    BALL_FMT(__VA_ARGS__)
+    BALL_FMT_IMP(__VA_ARGS__)
 
 #define BALL_FMT_FATAL(...)                                                   \
     BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_FATAL)           \
-    BALL_FMT(__VA_ARGS__)
+    BALL_FMT_IMP(__VA_ARGS__)
+
+namespace BloombergLP {
+namespace ball {
+
+/// This component-private type is the output iterator through which the
+/// logging macros format into the message buffer of a record.  Literal text
+/// and the bodies of strings and numbers are copied into the buffer as whole
+/// spans.
+typedef bdlsb::StreamBufOutputIterator<bdlsb::MemOutStreamBuf>
+                                                            Fmt_OutputIterator;
+
+                               // ==============
+                               // struct FmtUtil
+                               // ==============
+
+/// This `struct` provides a namespace for functions that configure the
+/// logging macros defined in this component.
+struct FmtUtil {
+
+  private:
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int
+                                        s_deferredFormattingEnabled;
+
+  public:
+    // CLASS METHODS
+
+    /// Enable deferred formatting by the `BALL_FMT_*` macros (see
+    /// [](#Deferred Formatting)) if the specified `enabled` is `true`, and
+    /// disable it otherwise.  Deferred formatting is initially disabled.
+    static void setDeferredFormattingEnabled(bool enabled);
+
+    /// Return `true` if deferred formatting by the `BALL_FMT_*` macros is
+    /// enabled, and `false` otherwise.  Note that this method returns
+    /// `false` if deferred formatting is not supported by the compiler.
+    static bool isDeferredFormattingEnabled();
+};
+
+#ifdef BALL_FMT_DEFERRED_FORMATTING_SUPPORTED
+
+                     // ================================
+                     // struct Fmt_DeferredArgument<...>
+                     // ================================
+
+/// This component-private class template describes how an argument of the
+/// (template parameter) `TYPE` is encoded for deferred formatting.  This
+/// primary template describes types that cannot be deferred, whose
+/// arguments are formatted eagerly.  A specialization for a deferrable type
+/// provides an `encode` method that appends the binary encoding of an
+/// argument to a stream buffer, a `DecodedType` that is formatted
+/// identically to `TYPE`, and a `decode` method that loads a `DecodedType`
+/// from an encoding and returns the address of the byte following it.
+template <class TYPE, class = void>
+struct Fmt_DeferredArgument {
+
+    // TYPES
+    typedef bsl::false_type IsDeferrable;
+};
+
+/// This component-private class template describes arithmetic types
+/// (including `bool` and `char`), which are encoded as their object
+/// representation.
+template <class TYPE>
+struct Fmt_DeferredScalar {
+
+    // TYPES
+    typedef bsl::true_type IsDeferrable;
+    typedef TYPE           DecodedType;
+
+    // CLASS METHODS
+
+    /// Append the encoding of the specified `value` to the specified
+    /// `buffer`.
+    static void encode(bdlsb::MemOutStreamBuf *buffer, TYPE value);
+
+    /// Load into the specified `value` the value encoded at the specified
+    /// `cursor`, and return the address of the byte following the encoding.
+    static const char *decode(DecodedType *value, const char *cursor);
+};
+
+/// This specialization of `Fmt_DeferredArgument` describes arithmetic
+/// types.
+template <class TYPE>
+struct Fmt_DeferredArgument<
+                TYPE,
+                typename bsl::enable_if<bsl::is_arithmetic<TYPE>::value>::type>
+: Fmt_DeferredScalar<TYPE> {
+};
+
+/// This component-private class describes string types, which are encoded as
+/// their length followed by their characters, and are decoded as
+/// `bsl::string_view` objects referring to the encoded characters.
+struct Fmt_DeferredString {
+
+    // TYPES
+    typedef bsl::true_type   IsDeferrable;
+    typedef bsl::string_view DecodedType;
+
+    // CLASS METHODS
+
+    /// Append the encoding of the string of the specified `length` at the
+    /// specified `data` address to the specified `buffer`.
+    static void encodeString(bdlsb::MemOutStreamBuf *buffer,
+                             const char             *data,
+                             bsl::size_t             length);
+
+    /// Load into the specified `value` a reference to the string encoded at
+    /// the specified `cursor`, and return the address of the byte following
+    /// the encoding.
+    static const char *decode(DecodedType *value, const char *cursor);
+};
+
+/// This specialization of `Fmt_DeferredArgument` describes null-terminated
+/// strings.
+template <>
+struct Fmt_DeferredArgument<const char *> : Fmt_DeferredString {
+
+    // CLASS METHODS
+
+    /// Append the encoding of the specified `value` to the specified
+    /// `buffer`.  The behavior is undefined unless `value` is not 0.
+    static void encode(bdlsb::MemOutStreamBuf *buffer, const char *value);
+};
+
+/// This specialization of `Fmt_DeferredArgument` describes null-terminated
+/// strings.
+template <>
+struct Fmt_DeferredArgument<char *>
+: Fmt_DeferredArgument<const char *> {
+};
+
+/// This specialization of `Fmt_DeferredArgument` describes character arrays,
+/// which are formatted as null-terminated strings.
+template <bsl::size_t SIZE>
+struct Fmt_DeferredArgument<char[SIZE]>
+: Fmt_DeferredArgument<const char *> {
+};
+
+/// This specialization of `Fmt_DeferredArgument` describes character arrays,
+/// which are formatted as null-terminated strings.
+template <bsl::size_t SIZE>
+struct Fmt_DeferredArgument<const char[SIZE]>
+: Fmt_DeferredArgument<const char *> {
+};
+
+/// This specialization of `Fmt_DeferredArgument` describes `bsl::string`.
+template <>
+struct Fmt_DeferredArgument<bsl::string> : Fmt_DeferredString {
+
+    // CLASS METHODS
+
+    /// Append the encoding of the specified `value` to the specified
+    /// `buffer`.
+    static void encode(bdlsb::MemOutStreamBuf *buffer,
+                       const bsl::string&      value);
+};
+
+/// This specialization of `Fmt_DeferredArgument` describes `std::string`.
+template <>
+struct Fmt_DeferredArgument<std::string> : Fmt_DeferredString {
+
+    // CLASS METHODS
+
+    /// Append the encoding of the specified `value` to the specified
+    /// `buffer`.
+    static void encode(bdlsb::MemOutStreamBuf *buffer,
+                       const std::string&      value);
+};
+
+/// This specialization of `Fmt_DeferredArgument` describes
+/// `bsl::string_view`.
+template <>
+struct Fmt_DeferredArgument<bsl::string_view> : Fmt_DeferredString {
+
+    // CLASS METHODS
+
+    /// Append the encoding of the specified `value` to the specified
+    /// `buffer`.
+    static void encode(bdlsb::MemOutStreamBuf  *buffer,
+                       const bsl::string_view&  value);
+};
+
+                    // ====================================
+                    // struct Fmt_AreArgumentsDeferrable<...>
+                    // ====================================
+
+/// This component-private meta-function derives from `bsl::true_type` if
+/// each of the (template parameter) `ARGS` types, ignoring references and
+/// cv-qualifiers, is deferrable, and from `bsl::false_type` otherwise.
+template <class... ARGS>
+struct Fmt_AreArgumentsDeferrable;
+
+template <>
+struct Fmt_AreArgumentsDeferrable<> : bsl::true_type {
+};
+
+template <class HEAD, class... TAIL>
+struct Fmt_AreArgumentsDeferrable<HEAD, TAIL...>
+: bsl::integral_constant<
+           bool,
+           Fmt_DeferredArgument<typename bsl::remove_cvref<HEAD>::type>::
+                                                       IsDeferrable::value &&
+           Fmt_AreArgumentsDeferrable<TAIL...>::value> {
+};
+
+                        // ===========================
+                        // struct Fmt_IsDeferrable<...>
+                        // ===========================
+
+/// This component-private meta-function derives from `bsl::true_type` if a
+/// message having a format of the (template parameter) `FORMAT` type and
+/// arguments of the (template parameter) `ARGS` types can be deferred,
+/// i.e., if `FORMAT` is a reference to a `const` character array (as is a
+/// string literal) and all `ARGS` are deferrable, and from
+/// `bsl::false_type` otherwise.  Note that the format string is copied into
+/// the record, as nothing guarantees that the array outlives it.
+template <class FORMAT, class... ARGS>
+struct Fmt_IsDeferrable : bsl::false_type {
+};
+
+template <bsl::size_t SIZE, class... ARGS>
+struct Fmt_IsDeferrable<const char (&)[SIZE], ARGS...>
+: Fmt_AreArgumentsDeferrable<ARGS...> {
+};
+
+                       // ==============================
+                       // struct Fmt_DeferredExpander<...>
+                       // ==============================
+
+/// This component-private class template provides a function that decodes
+/// arguments of the (template parameter) `TYPES` types, and formats them,
+/// together with any previously decoded arguments, as a message.
+template <class... TYPES>
+struct Fmt_DeferredExpander;
+
+template <>
+struct Fmt_DeferredExpander<> {
+
+    // CLASS METHODS
+
+    /// Write to the specified `streamBuf` the result of formatting the
+    /// specified `values` using the specified `format`.
+    template <class... DECODED>
+    static void expand(bdlsb::MemOutStreamBuf *streamBuf,
+                       bsl::string_view        format,
+                       const char             *cursor,
+                       DECODED&...             values);
+};
+
+template <class HEAD, class... TAIL>
+struct Fmt_DeferredExpander<HEAD, TAIL...> {
+
+    // CLASS METHODS
+
+    /// Decode an argument of the (template parameter) `HEAD` type at the
+    /// specified `cursor`, and the arguments of the `TAIL` types following
+    /// it, and write to the specified `streamBuf` the result of formatting
+    /// the specified `values`, followed by the decoded arguments, using the
+    /// specified `format`.
+    template <class... DECODED>
+    static void expand(bdlsb::MemOutStreamBuf *streamBuf,
+                       bsl::string_view        format,
+                       const char             *cursor,
+                       DECODED&...             values);
+};
+
+                            // ====================
+                            // struct Fmt_DeferUtil
+                            // ====================
+
+/// This component-private `struct` provides a namespace for the functions
+/// used by `BALL_FMT_IMP` to defer the formatting of a message.
+struct Fmt_DeferUtil {
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Encode the specified `format` and `args` into the message stream
+    /// buffer of the specified `record`, and arrange for the arguments to be
+    /// formatted using `format` when the message is first accessed.
+    template <class... ARGS>
+    static void deferImp(bsl::true_type,
+                         Record         *record,
+                         const char     *format,
+                         const ARGS&...  args);
+
+    /// Do nothing.  Note that this overload is never invoked, and exists
+    /// only so that `BALL_FMT_IMP` compiles for arguments that cannot be
+    /// deferred.
+    template <class FORMAT, class... ARGS>
+    static void deferImp(bsl::false_type,
+                         Record         *,
+                         const FORMAT&,
+                         const ARGS&...);
+
+    /// Write to the specified `streamBuf` the result of formatting the
+    /// arguments of the (template parameter) `TYPES` types encoded in the
+    /// specified `arguments` using the format string encoded ahead of them.
+    /// Note that the address of an instantiation of this function is a
+    /// `RecordAttributes::MessageExpander`, and that the format string
+    /// passed to it is not used.
+    template <class... TYPES>
+    static void expand(bdlsb::MemOutStreamBuf *streamBuf,
+                       const char             *format,
+                       const char             *arguments,
+                       bsl::size_t             length);
+
+  public:
+    // CLASS METHODS
+
+    /// Encode the specified `format` and `args` into the message stream
+    /// buffer of the specified `record`, and arrange for the arguments to be
+    /// formatted using `format` when the message is first accessed.  The
+    /// behavior is undefined unless the message of `record` is empty and
+    /// `Fmt_IsDeferrable<FORMAT, ARGS...>::value` is `true`.
+    template <class FORMAT, class... ARGS>
+    static void defer(Record *record, FORMAT&& format, ARGS&&... args);
+
+    /// Return `true` if the (template parameter) `IS_DEFERRABLE` type is
+    /// `bsl::true_type` and deferred formatting is enabled, and `false`
+    /// otherwise.
+    template <class IS_DEFERRABLE>
+    static bool isDeferred();
+
+    /// Return `Fmt_IsDeferrable<FORMAT, ARGS...>`.  Note that this function
+    /// is declared, but not defined, and is meant to be used only in
+    /// unevaluated operands.
+    template <class FORMAT, class... ARGS>
+    static typename Fmt_IsDeferrable<FORMAT, ARGS...>::type probe(
+                                                           FORMAT&&,
+                                                           ARGS&&...);
+};
+
+#endif  // BALL_FMT_DEFERRED_FORMATTING_SUPPORTED
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                               // --------------
+                               // struct FmtUtil
+                               // --------------
+
+// CLASS METHODS
+inline
+void FmtUtil::setDeferredFormattingEnabled(bool enabled)
+{
+    bsls::AtomicOperations::setIntRelaxed(&s_deferredFormattingEnabled,
+                                          enabled);
+}
+
+inline
+bool FmtUtil::isDeferredFormattingEnabled()
+{
+#ifdef BALL_FMT_DEFERRED_FORMATTING_SUPPORTED
+    return bsls::AtomicOperations::getIntRelaxed(
+                                               &s_deferredFormattingEnabled);
+#else
+    return false;
+#endif
+}
+
+#ifdef BALL_FMT_DEFERRED_FORMATTING_SUPPORTED
+
+                       // ------------------------------
+                       // struct Fmt_DeferredScalar<TYPE>
+                       // ------------------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+void Fmt_DeferredScalar<TYPE>::encode(bdlsb::MemOutStreamBuf *buffer,
+                                      TYPE                    value)
+{
+    buffer->sputn(reinterpret_cast<const char *>(&value), sizeof value);
+}
+
+template <class TYPE>
+inline
+const char *Fmt_DeferredScalar<TYPE>::decode(DecodedType *value,
+                                             const char  *cursor)
+{
+    bsl::memcpy(value, cursor, sizeof *value);
+    return cursor + sizeof *value;
+}
+
+                         // ------------------------
+                         // struct Fmt_DeferredString
+                         // ------------------------
+
+// CLASS METHODS
+inline
+void Fmt_DeferredString::encodeString(bdlsb::MemOutStreamBuf *buffer,
+                                      const char             *data,
+                                      bsl::size_t             length)
+{
+    buffer->sputn(reinterpret_cast<const char *>(&length), sizeof length);
+    buffer->sputn(data, static_cast<bsl::streamsize>(length));
+}
+
+inline
+const char *Fmt_DeferredString::decode(DecodedType *value, const char *cursor)
+{
+    bsl::size_t length;
+    bsl::memcpy(&length, cursor, sizeof length);
+    cursor += sizeof length;
+
+    *value = DecodedType(cursor, length);
+    return cursor + length;
+}
+
+inline
+void Fmt_DeferredArgument<const char *>::encode(
+                                            bdlsb::MemOutStreamBuf *buffer,
+                                            const char             *value)
+{
+    BSLS_ASSERT(value);
+
+    encodeString(buffer, value, bsl::strlen(value));
+}
+
+inline
+void Fmt_DeferredArgument<bsl::string>::encode(
+                                            bdlsb::MemOutStreamBuf *buffer,
+                                            const bsl::string&      value)
+{
+    encodeString(buffer, value.data(), value.length());
+}
+
+inline
+void Fmt_DeferredArgument<std::string>::encode(
+                                            bdlsb::MemOutStreamBuf *buffer,
+                                            const std::string&      value)
+{
+    encodeString(buffer, value.data(), value.length());
+}
+
+inline
+void Fmt_DeferredArgument<bsl::string_view>::encode(
+                                           bdlsb::MemOutStreamBuf  *buffer,
+                                           const bsl::string_view&  value)
+{
+    encodeString(buffer, value.data(), value.length());
+}
+
+                       // ------------------------------
+                       // struct Fmt_DeferredExpander<...>
+                       // ------------------------------
+
+// CLASS METHODS
+template <class... DECODED>
+inline
+void Fmt_DeferredExpander<>::expand(bdlsb::MemOutStreamBuf *streamBuf,
+                                    bsl::string_view        format,
+                                    const char             *,
+                                    DECODED&...             values)
+{
+    bsl::vformat_to(Fmt_OutputIterator(streamBuf),
+                    format,
+                    bsl::make_format_args(values...));
+}
+
+template <class HEAD, class... TAIL>
+template <class... DECODED>
+inline
+void Fmt_DeferredExpander<HEAD, TAIL...>::expand(
+                                             bdlsb::MemOutStreamBuf *streamBuf,
+                                             bsl::string_view        format,
+                                             const char             *cursor,
+                                             DECODED&...             values)
+{
+    typedef Fmt_DeferredArgument<HEAD> Argument;
+
+    typename Argument::DecodedType value;
+    cursor = Argument::decode(&value, cursor);
+
+    Fmt_DeferredExpander<TAIL...>::expand(streamBuf,
+                                          format,
+                                          cursor,
+                                          values...,
+                                          value);
+}
+
+                            // --------------------
+                            // struct Fmt_DeferUtil
+                            // --------------------
+
+// PRIVATE CLASS METHODS
+template <class... ARGS>
+inline
+void Fmt_DeferUtil::deferImp(bsl::true_type,
+                             Record         *record,
+                             const char     *format,
+                             const ARGS&...  args)
+{
+    RecordAttributes&       attributes = record->fixedFields();
+    bdlsb::MemOutStreamBuf& buffer     = attributes.messageStreamBuf();
+
+    BSLS_ASSERT(0 == buffer.length());
+
+    // Encode the format string, which need not outlive the record (e.g., it
+    // may be a local array), followed by the arguments in order (the elements
+    // of a braced initializer list are evaluated left to right).
+
+    Fmt_DeferredString::encodeString(&buffer, format, bsl::strlen(format));
+
+    const int dummy[] = {
+        0, (Fmt_DeferredArgument<ARGS>::encode(&buffer, args), 0)...
+    };
+    (void)dummy;
+
+    attributes.deferMessage(&Fmt_DeferUtil::expand<ARGS...>, "");
+}
+
+template <class FORMAT, class... ARGS>
+inline
+void Fmt_DeferUtil::deferImp(bsl::false_type,
+                             Record         *,
+                             const FORMAT&,
+                             const ARGS&...)
+{
+}
+
+template <class... TYPES>
+void Fmt_DeferUtil::expand(bdlsb::MemOutStreamBuf *streamBuf,
+                           const char             *,
+                           const char             *arguments,
+                           bsl::size_t             )
+{
+    bsl::string_view format;
+    arguments = Fmt_DeferredString::decode(&format, arguments);
+
+    Fmt_DeferredExpander<TYPES...>::expand(streamBuf, format, arguments);
+}
+
+// CLASS METHODS
+template <class FORMAT, class... ARGS>
+inline
+void Fmt_DeferUtil::defer(Record *record, FORMAT&& format, ARGS&&... args)
+{
+    deferImp(typename Fmt_IsDeferrable<FORMAT, ARGS...>::type(),
+             record,
+             format,
+             args...);
+}
+
+template <class IS_DEFERRABLE>
+inline
+bool Fmt_DeferUtil::isDeferred()
+{
+    return IS_DEFERRABLE::value && FmtUtil::isDeferredFormattingEnabled();
+}
+
+#endif  // BALL_FMT_DEFERRED_FORMATTING_SUPPORTED
+
+}  // close package namespace
+}  // close enterprise namespace
 
 #endif  // INCLUDED_BALL_FMT
 
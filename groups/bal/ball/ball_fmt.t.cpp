@@ -2,19 +2,31 @@
 #include <ball_fmt.h>
 
 #include <ball_administration.h>
+#include <ball_asyncfileobserver.h>
+#include <ball_fileobserver2.h>
 #include <ball_log.h>
+#include <ball_observer.h>
+#include <ball_recordstringformatter.h>
 #include <ball_testobserver.h>
 #include <ball_streamobserver.h>
 
+#include <bdls_pathutil.h>
+#include <bdls_tempdirectoryguard.h>
+
 #include <bslfmt_streamed.h>  // for testing only
 
 #include <bslim_testutil.h>
 
 #include <bslma_testallocator.h>
 
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
 #include <bsls_compilerfeatures.h>
 #include <bsls_keyword.h>
+#include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_vector.h>  // for testing only
 
@@ -22,6 +34,13 @@
 #include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>    // atoi()
 #include <bsl_cstring.h>    // strlen(), strcmp(), memset(), memcpy(), memcmp()
+#include <bsl_fstream.h>
+#include <bsl_iterator.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+#include <string>
 
 // Warning: the following `using` declarations interfere with the testing of
 // the macros defined in this component.  Please do not un-comment them.
@@ -52,9 +71,19 @@ using bsl::flush;
 // functions.  Each macro is individually tested to ensure that the macro's
 // arguments are correctly forwarded and that the side-effects of the macro
 // match the expected behavior.
+//
+// Deferred formatting is tested by logging each of a variety of messages
+// twice, once with deferred formatting disabled and once with it enabled, and
+// verifying that the records are identical.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static void setDeferredFormattingEnabled(bool enabled);
+// [ 2] static bool isDeferredFormattingEnabled();
 // ----------------------------------------------------------------------------
 // [ 1] BALL_FMT
-// [ 2] USAGE EXAMPLES
+// [ 2] CONCERN: DEFERRED FORMATTING
+// [ 3] USAGE EXAMPLES
+// [-1] PERFORMANCE: DEFERRED FORMATTING
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -172,6 +201,143 @@ static bool isRecordOkay(
     return status;
 }
 
+/// This class provides an observer that retains the last record published
+/// to it without accessing the record.
+class RetainingObserver : public BloombergLP::ball::Observer {
+
+    // DATA
+    bsl::shared_ptr<const BloombergLP::ball::Record> d_record;
+    int                                              d_numPublished;
+
+  public:
+    // CREATORS
+
+    /// Create an observer that has not retained a record.
+    RetainingObserver()
+    : d_numPublished(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Retain the specified `record`.
+    void publish(
+           const bsl::shared_ptr<const BloombergLP::ball::Record>& record,
+           const BloombergLP::ball::Context&) BSLS_KEYWORD_OVERRIDE
+    {
+        d_record = record;
+        ++d_numPublished;
+    }
+
+    /// Release the retained record, if any.
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE
+    {
+        d_record.reset();
+    }
+
+    // ACCESSORS
+
+    /// Return the fixed fields of the last record published to this
+    /// observer.  The behavior is undefined unless a record was published.
+    const BloombergLP::ball::RecordAttributes& lastFixedFields() const
+    {
+        return d_record->fixedFields();
+    }
+
+    /// Return the number of records published to this observer.
+    int numPublished() const
+    {
+        return d_numPublished;
+    }
+};
+
+/// This class provides a functor that loads the message of a record into a
+/// string, after waiting on a barrier, to test concurrent expansion.
+class MessageReader {
+
+    // DATA
+    const BloombergLP::ball::RecordAttributes *d_attributes_p;
+    BloombergLP::bslmt::Barrier               *d_barrier_p;
+    bsl::string                               *d_result_p;
+
+  public:
+    // CREATORS
+
+    /// Create a functor that loads into the specified `result` the message
+    /// of the specified `attributes` after waiting on the specified
+    /// `barrier`.
+    MessageReader(const BloombergLP::ball::RecordAttributes *attributes,
+                  BloombergLP::bslmt::Barrier               *barrier,
+                  bsl::string                               *result)
+    : d_attributes_p(attributes)
+    , d_barrier_p(barrier)
+    , d_result_p(result)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Wait on the barrier, then load the message.
+    void operator()()
+    {
+        d_barrier_p->wait();
+        *d_result_p = d_attributes_p->messageRef();
+    }
+};
+
+/// Log, to the category `"sieve"`, a fixed sequence of messages having
+/// deferrable arguments.
+void logDeferrableMessages()
+{
+    BALL_LOG_SET_CATEGORY("sieve");
+
+    const bsl::string      bslString("bsl::string");
+    const std::string      stdString("std::string");
+    const bsl::string_view stringView("string_view");
+    const char            *cString = "char *";
+
+    for (int i = 0; i < 10; ++i) {
+        BALL_FMT_INFO("{}: {:>6.2f} {:#x} {} {}", i, i / 3.0, i * 37U, true,
+                      'c');
+        BALL_FMT_WARN("{1} {0} {2:*^15} {3}", bslString, stdString,
+                      stringView, cString);
+        BALL_FMT_ERROR("no arguments");
+    }
+}
+
+/// Log, to the category `"sieve"`, a message having the specified `value`
+/// argument and a format string that is a local array, which goes out of
+/// scope before the message is accessed.  Note that, in C++20, the format
+/// string must be a constant expression, so that the array must be `static`.
+void logWithLocalFormat(int value)
+{
+    BALL_LOG_SET_CATEGORY("sieve");
+
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP20_BASELINE_LIBRARY)
+    static constexpr char format[] = "local {}";
+#else
+    const char format[] = "local {}";
+#endif
+    BALL_FMT_INFO(format, value);
+}
+
+/// Overwrite the stack memory below the frame of the caller.
+void overwriteStack()
+{
+    volatile char buffer[1024];
+    for (int i = 0; i < 1024; ++i) {
+        buffer[i] = 'X';
+    }
+}
+
+/// Return the contents of the file having the specified `path`.
+bsl::string loadFile(const bsl::string& path)
+{
+    bsl::ifstream stream(path.c_str());
+    return bsl::string(bsl::istreambuf_iterator<char>(stream),
+                       bsl::istreambuf_iterator<char>());
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -242,7 +408,7 @@ int main(int argc, char *argv[])
     TestAllocator ta("test", veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLES
         //
@@ -365,6 +531,400 @@ int main(int argc, char *argv[])
 // insert `operator<<` of `abc::Identifier` to get the characters to print and
 // uses the syntax of string formatting for the format specification.
         }
+
+        {
+///Example 3: Deferring the Formatting of Messages
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// The following example shows how a latency-sensitive application can move
+// the formatting of its log messages off of its critical threads.
+//
+// First, we enable deferred formatting, typically once, early in `main`, and
+// in conjunction with an observer that publishes records on a thread of its
+// own (e.g., `ball::AsyncFileObserver`):
+// ```
+   ball::FmtUtil::setDeferredFormattingEnabled(true);
+// ```
+// Then, we log messages as usual:
+// ```
+   BALL_LOG_SET_CATEGORY("EXAMPLE.CATEGORY");
+
+   const bsl::string symbol("IBM");
+   const double      price    = 187.5;
+   const int         quantity = 300;
+
+   BALL_FMT_INFO("Filled {} {} @ {:.2f}", quantity, symbol, price);
+   // Logs: `Filled 300 IBM @ 187.50`
+// ```
+// The logging thread copies `quantity`, `symbol`, and `price` into the log
+// record, and the message is formatted when the observer first reads it.
+//
+// Finally, we note that messages having arguments that cannot be deferred are
+// still formatted immediately, with no change in the message logged:
+// ```
+   const abc::Identifier id(12345);
+   BALL_FMT_WARN("Item {:0>10} is stale.", bslfmt::streamed(id));
+   // Logs: `Item 0000012345 is stale.`
+// ```
+            ball::FmtUtil::setDeferredFormattingEnabled(false);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONCERN: DEFERRED FORMATTING
+        //
+        // Concerns:
+        // 1. Deferred formatting is initially disabled, and can be enabled
+        //    and disabled.
+        //
+        // 2. If deferred formatting is enabled, a `BALL_FMT_*` macro having a
+        //    string literal format and deferrable arguments publishes a
+        //    record whose message is not yet formatted, and is formatted
+        //    when first accessed.
+        //
+        // 3. The formatted message is identical to the message formatted
+        //    when deferred formatting is disabled, for each deferrable
+        //    argument type, and for various format specifications.
+        //
+        // 4. Each argument is evaluated exactly once.
+        //
+        // 5. String arguments are copied, and need not outlive the logging
+        //    statement.
+        //
+        // 6. The format string is copied, and need not outlive the logging
+        //    statement, even if it is a character array that is not a string
+        //    literal.
+        //
+        // 7. Messages having arguments that are not deferrable are formatted
+        //    immediately.
+        //
+        // 8. A deferred message accessed concurrently by several threads is
+        //    formatted once, and the same message is seen by every thread.
+        //
+        // 9. The records written by `ball::FileObserver2` and by
+        //    `ball::AsyncFileObserver` (whose messages are formatted on its
+        //    publication thread) are identical whether or not formatting is
+        //    deferred.
+        //
+        // 10. `BALL_FMT_*` macros are single statements, even when used as
+        //     the body of an `if` having an `else`.
+        //
+        // Plan:
+        // 1. Verify the initial value of `isDeferredFormattingEnabled`, and
+        //    that it reflects calls to `setDeferredFormattingEnabled`.  (C-1)
+        //
+        // 2. Using an observer that retains the last record published to it
+        //    without accessing it, log each of a variety of messages twice,
+        //    with deferred formatting disabled, then enabled.  Verify that
+        //    the second record is deferred until its message is accessed,
+        //    and that both messages are equal.  (C-2..3)
+        //
+        // 3. Log a message whose argument is a pre-increment expression, and
+        //    verify that the variable was incremented once.  (C-4)
+        //
+        // 4. Log a message whose argument is a string that is modified
+        //    before the message is accessed.  (C-5)
+        //
+        // 5. Log, from a function, a message whose format string is a local
+        //    array, and overwrite the stack memory that the array occupied
+        //    before the message is accessed.  (C-6)
+        //
+        // 6. Log a message whose argument is wrapped by `bslfmt::streamed`,
+        //    and verify that the record is not deferred.  (C-7)
+        //
+        // 7. Repeatedly log a deferred message and access it from several
+        //    threads released by a barrier.  (C-8)
+        //
+        // 8. For each kind of file observer, log the same sequence of
+        //    messages to a file twice, with deferred formatting disabled,
+        //    then enabled, and compare the two halves of the file.  (C-9)
+        //
+        // 9. Use `BALL_FMT_INFO` as the body of an `if` having an `else`, and
+        //    verify that the `else` branch is taken.  (C-10)
+        //
+        // Testing:
+        //   static void setDeferredFormattingEnabled(bool enabled);
+        //   static bool isDeferredFormattingEnabled();
+        //   CONCERN: DEFERRED FORMATTING
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nCONCERN: DEFERRED FORMATTING"
+                               << "\n============================\n";
+
+        using namespace BloombergLP;
+
+        typedef ball::FmtUtil Util;
+
+        if (veryVerbose) bsl::cout << "\tTesting the switch." << bsl::endl;
+        {
+            ASSERT(false == Util::isDeferredFormattingEnabled());
+
+            Util::setDeferredFormattingEnabled(true);
+#ifdef BALL_FMT_DEFERRED_FORMATTING_SUPPORTED
+            ASSERT(true  == Util::isDeferredFormattingEnabled());
+#else
+            ASSERT(false == Util::isDeferredFormattingEnabled());
+#endif
+
+            Util::setDeferredFormattingEnabled(false);
+            ASSERT(false == Util::isDeferredFormattingEnabled());
+        }
+
+        ball::LoggerManagerConfiguration lmc;
+        ball::LoggerManagerScopedGuard   lmg(lmc, &ta);
+
+        bsl::shared_ptr<u::RetainingObserver> observer =
+                                      bsl::make_shared<u::RetainingObserver>();
+
+        ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+        ASSERT(0 == manager.registerObserver(observer, "retain"));
+
+        ball::Administration::addCategory("sieve",
+                                          ball::Severity::e_TRACE,
+                                          ball::Severity::e_TRACE,
+                                          0,
+                                          0);
+        BALL_LOG_SET_CATEGORY("sieve");
+
+#ifdef BALL_FMT_DEFERRED_FORMATTING_SUPPORTED
+        const bool DEFERRED = true;
+#else
+        const bool DEFERRED = false;
+#endif
+
+        if (veryVerbose) bsl::cout << "\tTesting messages." << bsl::endl;
+        {
+            const bsl::string      bslString("bsl");
+            const std::string      stdString("std");
+            const bsl::string_view stringView("view");
+            const char            *cString   = "cstr";
+            char                   array[]   = "array";
+            const unsigned char    uchar     = 200;
+            const short            shortValue = -12;
+
+#define TEST_MESSAGE(EXPECTED, ...)                                           \
+            do {                                                              \
+                Util::setDeferredFormattingEnabled(false);                    \
+                BALL_FMT_INFO(__VA_ARGS__);                                   \
+                const ball::RecordAttributes& EAGER =                         \
+                                                observer->lastFixedFields();  \
+                ASSERTV(L_, !EAGER.isMessageDeferred());                      \
+                const bsl::string EXP = EAGER.messageRef();                   \
+                ASSERTV(L_, EXPECTED, EXP, EXPECTED == EXP);                  \
+                                                                              \
+                Util::setDeferredFormattingEnabled(true);                     \
+                BALL_FMT_INFO(__VA_ARGS__);                                   \
+                Util::setDeferredFormattingEnabled(false);                    \
+                const ball::RecordAttributes& LAZY =                          \
+                                                observer->lastFixedFields();  \
+                ASSERTV(L_, DEFERRED == LAZY.isMessageDeferred());            \
+                const bsl::string MSG = LAZY.messageRef();                    \
+                ASSERTV(L_, !LAZY.isMessageDeferred());                       \
+                ASSERTV(L_, EXP, MSG, EXP == MSG);                            \
+                if (veryVeryVerbose) { P(MSG); }                              \
+            } while (false)
+
+            TEST_MESSAGE("no arguments", "no arguments");
+            TEST_MESSAGE("{}", "{{}}");
+            TEST_MESSAGE("42", "{}", 42);
+            TEST_MESSAGE("-0007", "{:05d}", -7);
+            TEST_MESSAGE("+0xff", "{:+#x}", 255);
+            TEST_MESSAGE("4294967295", "{}", 4294967295U);
+            TEST_MESSAGE("-1234567890123", "{}", -1234567890123LL);
+            TEST_MESSAGE("200 -12", "{} {}", uchar, shortValue);
+            TEST_MESSAGE("3.142", "{:.3f}", 3.14159);
+            TEST_MESSAGE("1.500000e+00", "{:e}", 1.5f);
+            TEST_MESSAGE("true false", "{} {}", true, false);
+            TEST_MESSAGE("x 120", "{} {:d}", 'x', 'x');
+            TEST_MESSAGE("  lit", "{:>5}", "lit");
+            TEST_MESSAGE("cstr|array", "{}|{}", cString, array);
+            TEST_MESSAGE("***bsl***", "{:*^9}", bslString);
+            TEST_MESSAGE("std  ", "{:<5}", stdString);
+            TEST_MESSAGE("vi", "{:.2}", stringView);
+            TEST_MESSAGE("std bsl 1 std",
+                         "{1} {0} {2} {1}",
+                         bslString,
+                         stdString,
+                         1);
+            TEST_MESSAGE("1:2.5:a:b:c:d:true",
+                         "{}:{}:{}:{}:{}:{}:{}",
+                         1,
+                         2.5,
+                         'a',
+                         "b",
+                         cString[0] == 'c' ? "c" : "?",
+                         bsl::string("d"),
+                         true);
+
+#undef TEST_MESSAGE
+        }
+
+        if (veryVerbose) bsl::cout << "\tTesting argument evaluation."
+                                   << bsl::endl;
+        {
+            Util::setDeferredFormattingEnabled(true);
+
+            int count = 0;
+            BALL_FMT_INFO("{}", ++count);
+            ASSERTV(count, 1 == count);
+            ASSERT(DEFERRED ==
+                           observer->lastFixedFields().isMessageDeferred());
+            ASSERT("1" == observer->lastFixedFields().messageRef());
+
+            {
+                bsl::string transient("transient");
+                BALL_FMT_INFO("{}", transient);
+                transient.assign(transient.length(), 'X');
+            }
+            ASSERTV(observer->lastFixedFields().messageRef(),
+                    "transient" == observer->lastFixedFields().messageRef());
+
+            u::logWithLocalFormat(7);
+            u::overwriteStack();
+            ASSERT(DEFERRED ==
+                           observer->lastFixedFields().isMessageDeferred());
+            ASSERTV(observer->lastFixedFields().messageRef(),
+                    "local 7" == observer->lastFixedFields().messageRef());
+
+            Util::setDeferredFormattingEnabled(false);
+        }
+
+        if (veryVerbose) bsl::cout << "\tTesting non-deferrable arguments."
+                                   << bsl::endl;
+        {
+            Util::setDeferredFormattingEnabled(true);
+
+            const abc::Identifier id(17);
+            BALL_FMT_INFO("id={:0>4}", bslfmt::streamed(id));
+            ASSERT(!observer->lastFixedFields().isMessageDeferred());
+            ASSERTV(observer->lastFixedFields().messageRef(),
+                    "id=0017" == observer->lastFixedFields().messageRef());
+
+            Util::setDeferredFormattingEnabled(false);
+        }
+
+        if (veryVerbose) bsl::cout << "\tTesting `if`/`else`." << bsl::endl;
+        {
+            Util::setDeferredFormattingEnabled(true);
+
+            const int numPublished = observer->numPublished();
+
+            bool elseTaken = false;
+            if (numPublished < 0)
+                BALL_FMT_INFO("{}", numPublished);
+            else
+                elseTaken = true;
+
+            ASSERT(elseTaken);
+            ASSERT(numPublished == observer->numPublished());
+
+            Util::setDeferredFormattingEnabled(false);
+        }
+
+        if (veryVerbose) bsl::cout << "\tTesting concurrent expansion."
+                                   << bsl::endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 100 };
+
+            Util::setDeferredFormattingEnabled(true);
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                BALL_FMT_INFO("{} {:>8.3f} {}", i, i / 7.0, "concurrent");
+
+                const ball::RecordAttributes& attributes =
+                                                  observer->lastFixedFields();
+                ASSERTV(i, DEFERRED == attributes.isMessageDeferred());
+
+                bslmt::Barrier                    barrier(k_NUM_THREADS);
+                bsl::string                       results[k_NUM_THREADS];
+                bslmt::ThreadUtil::Handle         handles[k_NUM_THREADS];
+
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                       &handles[j],
+                                       u::MessageReader(&attributes,
+                                                        &barrier,
+                                                        &results[j])));
+                }
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    bslmt::ThreadUtil::join(handles[j]);
+                }
+
+                const bsl::string EXP = bsl::format("{} {:>8.3f} {}",
+                                                    i,
+                                                    i / 7.0,
+                                                    "concurrent");
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    ASSERTV(i, j, EXP, results[j], EXP == results[j]);
+                }
+            }
+
+            Util::setDeferredFormattingEnabled(false);
+        }
+
+        if (veryVerbose) bsl::cout << "\tTesting file observers."
+                                   << bsl::endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_fmt_");
+
+            for (int kind = 0; kind < 2; ++kind) {
+                bsl::string fileName(tempDirGuard.getTempDirName());
+                bdls::PathUtil::appendRaw(&fileName,
+                                          0 == kind ? "fileobserver2.log"
+                                                    : "asyncfileobserver.log");
+
+                bsl::shared_ptr<ball::FileObserver2>     fileObserver;
+                bsl::shared_ptr<ball::AsyncFileObserver> asyncObserver;
+                bsl::shared_ptr<ball::Observer>          fileBase;
+
+                if (0 == kind) {
+                    fileObserver = bsl::make_shared<ball::FileObserver2>();
+                    fileObserver->setLogFileFunctor(
+                                       ball::RecordStringFormatter("%m\n"));
+                    ASSERT(0 == fileObserver->enableFileLogging(
+                                                           fileName.c_str()));
+                    fileBase = fileObserver;
+                }
+                else {
+                    asyncObserver = bsl::make_shared<ball::AsyncFileObserver>(
+                                                      ball::Severity::e_OFF);
+                    asyncObserver->setLogFormat("%m\n", "%m\n");
+                    ASSERT(0 == asyncObserver->enableFileLogging(
+                                                           fileName.c_str()));
+                    ASSERT(0 == asyncObserver->startPublicationThread());
+                    fileBase = asyncObserver;
+                }
+
+                ASSERT(0 == manager.registerObserver(fileBase, "file"));
+
+                Util::setDeferredFormattingEnabled(false);
+                u::logDeferrableMessages();
+
+                Util::setDeferredFormattingEnabled(true);
+                u::logDeferrableMessages();
+
+                Util::setDeferredFormattingEnabled(false);
+
+                if (asyncObserver) {
+                    ASSERT(0 == asyncObserver->stopPublicationThread());
+                    asyncObserver->disableFileLogging();
+                }
+                else {
+                    fileObserver->disableFileLogging();
+                }
+                ASSERT(0 == manager.deregisterObserver("file"));
+
+                const bsl::string contents = u::loadFile(fileName);
+                const bsl::size_t half     = contents.length() / 2;
+
+                ASSERTV(kind, contents.length(), 0 < half);
+                ASSERTV(kind,
+                        contents.substr(0, half) == contents.substr(half));
+                if (veryVeryVerbose) {
+                    P(contents);
+                }
+            }
+        }
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -643,6 +1203,72 @@ int main(int argc, char *argv[])
             ASSERT(u::isRecordOkay(observer, CAT, FATAL, FILE, LINE, MESSAGE));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DEFERRED FORMATTING
+        //
+        // Concerns:
+        // 1. Deferring the formatting of a message reduces the time spent by
+        //    the logging thread.
+        //
+        // Plan:
+        // 1. Using an observer that does not access the records published to
+        //    it, time the logging of a message having several numeric and
+        //    string arguments, with deferred formatting disabled and enabled,
+        //    and report the average time per message.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: DEFERRED FORMATTING
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nPERFORMANCE: DEFERRED FORMATTING"
+                               << "\n================================\n";
+
+        using namespace BloombergLP;
+
+        enum { k_NUM_MESSAGES = 200000 };
+
+        ball::LoggerManagerConfiguration lmc;
+        ball::LoggerManagerScopedGuard   lmg(lmc);
+
+        bsl::shared_ptr<u::RetainingObserver> observer =
+                                      bsl::make_shared<u::RetainingObserver>();
+
+        ball::LoggerManager::singleton().registerObserver(observer, "retain");
+
+        ball::Administration::addCategory("bench",
+                                          ball::Severity::e_OFF,
+                                          ball::Severity::e_TRACE,
+                                          0,
+                                          0);
+        BALL_LOG_SET_CATEGORY("bench");
+
+        const bsl::string symbol("BBG000BLNNH6");
+
+        for (int deferred = 0; deferred < 2; ++deferred) {
+            ball::FmtUtil::setDeferredFormattingEnabled(deferred);
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+            for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+                BALL_FMT_INFO("order {} {} qty={} px={:.4f} side={}",
+                              i,
+                              symbol,
+                              i * 100,
+                              i * 0.01,
+                              'B');
+            }
+            timer.stop();
+
+            bsl::cout << (deferred ? "deferred: " : "eager:    ")
+                      << timer.accumulatedWallTime() * 1e9 / k_NUM_MESSAGES
+                      << " ns/message (wall), "
+                      << timer.accumulatedUserTime() * 1e9 / k_NUM_MESSAGES
+                      << " ns/message (user)" << bsl::endl;
+        }
+
+        ball::FmtUtil::setDeferredFormattingEnabled(false);
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
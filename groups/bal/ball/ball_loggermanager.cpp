@@ -330,6 +330,7 @@ void copyAttributesWithoutMessage(ball::Record                  *record,
 // PRIVATE CREATORS
 Logger::Logger(const bsl::shared_ptr<Observer>&            observer,
                RecordBuffer                               *recordBuffer,
+               RecordStage                                *recordStage,
                const UserFieldsPopulatorCallback&          userFieldsPopulator,
                const AttributeCollectorRegistry           *attributeCollectors,
                const PublishAllTriggerCallback&            publishAllCallback,
@@ -340,6 +341,7 @@ Logger::Logger(const bsl::shared_ptr<Observer>&            observer,
 : d_recordPool(-1, globalAllocator)
 , d_observer(observer)
 , d_recordBuffer_p(recordBuffer)
+, d_recordStage_p(recordStage)
 , d_userFieldsPopulator(userFieldsPopulator)
 , d_attributeCollectors_p(attributeCollectors)
 , d_publishAll(publishAllCallback)
@@ -373,52 +375,21 @@ Logger::~Logger()
     d_allocator_p->deallocate(d_scratchBuffer_p);
 }
 
-// PRIVATE MANIPULATORS
-bsl::shared_ptr<Record> Logger::getRecordPtr(
-                                            const bsl::string_view& fileName,
-                                            int                     lineNumber)
+// PRIVATE CLASS METHODS
+void Logger::dispatchStagedRecord(const bsl::shared_ptr<Record>& record,
+                                  void                          *logger,
+                                  const ThresholdAggregate&      levels)
 {
-    bsl::shared_ptr<Record> record = d_recordPool.getObject();
+    BSLS_ASSERT(logger);
 
-    // Note that the records obtained from the record pool are guaranteed to
-    // have all custom fields removed and the message stream cleared.  So only
-    // the filename and line number fields are initialized here.
-
-    record->fixedFields().setFileName(fileName);
-    record->fixedFields().setLineNumber(lineNumber);
-
-    return record;
+    static_cast<Logger *>(logger)->dispatchRecord(record, levels);
 }
 
-void Logger::logMessage(const Category&                category,
-                        int                            severity,
-                        const bsl::shared_ptr<Record>& record,
-                        const ThresholdAggregate&      levels)
+// PRIVATE MANIPULATORS
+void Logger::dispatchRecord(const bsl::shared_ptr<Record>& record,
+                            const ThresholdAggregate&      levels)
 {
-    record->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
-
-    record->fixedFields().setCategory(category.categoryName());
-    record->fixedFields().setSeverity(severity);
-
-    static int pid = bdls::ProcessUtil::getProcessId();
-    record->fixedFields().setProcessID(pid);
-
-    record->fixedFields().setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
-    record->fixedFields().setKernelThreadID(
-                                    bslmt::ThreadUtil::selfKernelIdAsUint64());
-
-    // Invoke legacy user fields populator callback.
-    if (d_userFieldsPopulator) {
-        d_userFieldsPopulator(&record->customFields());
-    }
-
-    // Invoke all collectors with a functor that adds the attribute to the log
-    // record.
-
-    d_attributeCollectors_p->collect(
-        bdlf::BindUtil::bind(&ball::Record::addAttribute,
-                             record.get(),
-                             bdlf::PlaceHolders::_1));
+    const int severity = record->fixedFields().severity();
 
     if (levels.recordLevel() >= severity) {
         d_recordBuffer_p->pushBack(record);
@@ -502,6 +473,61 @@ void Logger::logMessage(const Category&                category,
     }
 }
 
+bsl::shared_ptr<Record> Logger::getRecordPtr(
+                                            const bsl::string_view& fileName,
+                                            int                     lineNumber)
+{
+    bsl::shared_ptr<Record> record = d_recordPool.getObject();
+
+    // Note that the records obtained from the record pool are guaranteed to
+    // have all custom fields removed and the message stream cleared.  So only
+    // the filename and line number fields are initialized here.
+
+    record->fixedFields().setFileName(fileName);
+    record->fixedFields().setLineNumber(lineNumber);
+
+    return record;
+}
+
+void Logger::logMessage(const Category&                category,
+                        int                            severity,
+                        const bsl::shared_ptr<Record>& record,
+                        const ThresholdAggregate&      levels)
+{
+    prepareRecord(record.get(), category, severity);
+    dispatchRecord(record, levels);
+}
+
+void Logger::prepareRecord(Record          *record,
+                           const Category&  category,
+                           int              severity)
+{
+    record->fixedFields().setTimestamp(bdlt::CurrentTime::utc());
+
+    record->fixedFields().setCategory(category.categoryName());
+    record->fixedFields().setSeverity(severity);
+
+    static int pid = bdls::ProcessUtil::getProcessId();
+    record->fixedFields().setProcessID(pid);
+
+    record->fixedFields().setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+    record->fixedFields().setKernelThreadID(
+                                    bslmt::ThreadUtil::selfKernelIdAsUint64());
+
+    // Invoke legacy user fields populator callback.
+    if (d_userFieldsPopulator) {
+        d_userFieldsPopulator(&record->customFields());
+    }
+
+    // Invoke all collectors with a functor that adds the attribute to the log
+    // record.
+
+    d_attributeCollectors_p->collect(
+        bdlf::BindUtil::bind(&ball::Record::addAttribute,
+                             record,
+                             bdlf::PlaceHolders::_1));
+}
+
 void Logger::publish(Transmission::Cause cause)
 {
     d_recordBuffer_p->beginSequence();
@@ -547,6 +573,18 @@ void Logger::publish(const bsl::shared_ptr<Record>& record,
 // MANIPULATORS
 Record *Logger::getRecord(const bsl::string_view& fileName, int lineNumber)
 {
+    if (d_recordStage_p) {
+        // The record is handed off (or discarded) in the 3-argument
+        // 'logMessage' method.
+
+        Record *record = d_recordStage_p->getRecord();
+
+        record->fixedFields().setFileName(fileName);
+        record->fixedFields().setLineNumber(lineNumber);
+
+        return record;                                                // RETURN
+    }
+
    // The shared pointer returned by 'getRecordPtr' is reconstituted in the
    // 3-argument 'logMessage' method.
 
@@ -565,6 +603,15 @@ void Logger::logMessage(const Category&         category,
         return;                                                       // RETURN
     }
 
+    if (d_recordStage_p) {
+        Record *record = getRecord(fileName, lineNumber);
+
+        record->fixedFields().setMessage(message);
+        prepareRecord(record, category, severity);
+        d_recordStage_p->stageRecord(record, this, thresholds);
+        return;                                                       // RETURN
+    }
+
     bsl::shared_ptr<Record> record = getRecordPtr(fileName, lineNumber);
 
     record->fixedFields().setMessage(message);
@@ -575,6 +622,17 @@ void Logger::logMessage(const Category&  category,
                         int              severity,
                         Record          *record)
 {
+    if (d_recordStage_p) {
+        ThresholdAggregate thresholds;
+        if (!isCategoryEnabled(&thresholds, category, severity)) {
+            d_recordStage_p->discardRecord(record);
+            return;                                                   // RETURN
+        }
+        prepareRecord(record, category, severity);
+        d_recordStage_p->stageRecord(record, this, thresholds);
+        return;                                                       // RETURN
+    }
+
     // Reconstitute the shared pointer that was disassembled in the
     // 'getRecord' method.
 
@@ -691,6 +749,7 @@ LoggerManager::LoggerManager(
                     bslma::Default::globalAllocator(globalAllocator))
 , d_loggers(bslma::Default::globalAllocator(globalAllocator))
 , d_recordBuffer_p(0)
+, d_recordStage_p(0)
 , d_scratchBufferSize(configuration.defaults().defaultLoggerBufferSize())
 , d_defaultLoggers(bslma::Default::globalAllocator(globalAllocator))
 , d_logOrder(configuration.logOrder())
@@ -729,8 +788,25 @@ void LoggerManager::constructObject(
                                                               recordBufferSize,
                                                               d_allocator_p);
 
+    if (LoggerManagerConfiguration::e_STAGED
+                                          == configuration.publicationMode()) {
+        d_recordStage_p = new(*d_allocator_p) RecordStage(
+               RecordStage::DispatchCallback(
+                     bsl::allocator_arg_t(),
+                     bsl::allocator<RecordStage::DispatchCallback>(
+                                                                d_allocator_p),
+                     &Logger::dispatchStagedRecord),
+               d_allocator_p);
+
+        // If the publication thread cannot be created, staged records are
+        // dispatched by the logging threads.
+
+        d_recordStage_p->startPublicationThread();
+    }
+
     d_logger_p = new(*d_allocator_p) Logger(d_observer,
                                             d_recordBuffer_p,
+                                            d_recordStage_p,
                                             d_userFieldsPopulator,
                                             &d_attributeCollectors,
                                             d_publishAllCallback,
@@ -1087,6 +1163,7 @@ LoggerManager::LoggerManager(
                     bslma::Default::globalAllocator(globalAllocator))
 , d_loggers(bslma::Default::globalAllocator(globalAllocator))
 , d_recordBuffer_p(0)
+, d_recordStage_p(0)
 , d_scratchBufferSize(configuration.defaults().defaultLoggerBufferSize())
 , d_defaultLoggers(bslma::Default::globalAllocator(globalAllocator))
 , d_logOrder(configuration.logOrder())
@@ -1105,6 +1182,13 @@ LoggerManager::~LoggerManager()
     BSLS_ASSERT(d_allocator_p);
     BSLS_ASSERT( 0 < d_loggers.size());
 
+    // Publish the records staged for the publication thread while the
+    // observers are still registered.
+
+    if (d_recordStage_p) {
+        d_recordStage_p->stopPublicationThread();
+    }
+
     // To minimize the chance that one thread is destroying the singleton
     // while another is still accessing the data members, immediately reset
     // all category holders to their default value.
@@ -1120,6 +1204,13 @@ LoggerManager::~LoggerManager()
     }
     d_recordBuffer_p->~RecordBuffer();
     d_allocator_p->deallocate(d_recordBuffer_p);
+
+    // Records obtained from the stage may have been held by the loggers and
+    // the record buffer destroyed above, so the stage is destroyed last.
+
+    if (d_recordStage_p) {
+        d_allocator_p->deleteObject(d_recordStage_p);
+    }
 }
 
 // MANIPULATORS
@@ -1131,6 +1222,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer)
 
     Logger *logger = new(*d_allocator_p) Logger(d_observer,
                                                 buffer,
+                                                d_recordStage_p,
                                                 d_userFieldsPopulator,
                                                 &d_attributeCollectors,
                                                 d_publishAllCallback,
@@ -1150,6 +1242,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
 
     Logger *logger = new(*d_allocator_p) Logger(d_observer,
                                                 buffer,
+                                                d_recordStage_p,
                                                 d_userFieldsPopulator,
                                                 &d_attributeCollectors,
                                                 d_publishAllCallback,
@@ -1174,6 +1267,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
 
     Logger *logger = new(*d_allocator_p) Logger(observerWrapper,
                                                 buffer,
+                                                d_recordStage_p,
                                                 d_userFieldsPopulator,
                                                 &d_attributeCollectors,
                                                 d_publishAllCallback,
@@ -1198,6 +1292,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
 
     Logger *logger = new(*d_allocator_p) Logger(observerWrapper,
                                                 buffer,
+                                                d_recordStage_p,
                                                 d_userFieldsPopulator,
                                                 &d_attributeCollectors,
                                                 d_publishAllCallback,
@@ -1220,6 +1315,7 @@ Logger *LoggerManager::allocateLogger(
 
     Logger *logger = new(*d_allocator_p) Logger(observer,
                                                 buffer,
+                                                d_recordStage_p,
                                                 d_userFieldsPopulator,
                                                 &d_attributeCollectors,
                                                 d_publishAllCallback,
@@ -1241,6 +1337,7 @@ Logger *LoggerManager::allocateLogger(
 
     Logger *logger = new(*d_allocator_p) Logger(observer,
                                                 buffer,
+                                                d_recordStage_p,
                                                 d_userFieldsPopulator,
                                                 &d_attributeCollectors,
                                                 d_publishAllCallback,
@@ -1256,6 +1353,12 @@ Logger *LoggerManager::allocateLogger(
 
 void LoggerManager::deallocateLogger(Logger *logger)
 {
+    if (d_recordStage_p) {
+        // Dispatch the records staged for 'logger' before destroying it.
+
+        d_recordStage_p->drain();
+    }
+
     d_loggersLock.lockWrite();
     d_loggers.erase(logger);
     d_loggersLock.unlock();
@@ -356,6 +356,27 @@ BSLS_IDENT("$Id: $")
 // have them share a common logger so that the trace-back log *does* include
 // all relevant records.
 //
+///Staged Publication
+///- - - - - - - - -
+// By default, a log record is stored, published to the observers, and (on a
+// Trigger or Trigger-All event) used to publish the record buffers by the
+// thread that logs it, so that concurrent logging threads contend on the
+// record pool, the record buffer, and the observers.  If the logger manager
+// is configured with the `e_STAGED` publication mode (see
+// `ball::LoggerManagerConfiguration::setPublicationMode`), each logging
+// thread instead fills in a record from a thread-local cache and hands it
+// off through a thread-local ring to a single publication thread owned by
+// the logger manager (see `ball_recordstage`), which stores and publishes
+// the record exactly as the logging thread would have.  The fixed fields
+// (including the timestamp and the thread ids) and the attributes of the
+// record are still populated by the logging thread.
+//
+// Note that in the `e_STAGED` mode, observers are invoked on the publication
+// thread, and records are published asynchronously with respect to the
+// logging call.  `ball::Logger::publish`, `ball::LoggerManager::publishAll`,
+// and the destruction of the logger manager first dispatch all records
+// staged so far.
+//
 ///`bsls::Log` Logging Redirection
 ///-------------------------------
 // The `ball::LoggerManager` singleton, on construction, redirects `bsls::Log`
@@ -900,6 +921,7 @@ BSLS_IDENT("$Id: $")
 #include <ball_loggermanagerconfiguration.h>
 #include <ball_record.h>
 #include <ball_recordbuffer.h>
+#include <ball_recordstage.h>
 #include <ball_thresholdaggregate.h>
 #include <ball_thresholddefaults.h>
 #include <ball_transmission.h>
@@ -971,6 +993,12 @@ class Logger {
     RecordBuffer *d_recordBuffer_p;             // holds log record buffer
                                                 // (not owned)
 
+    RecordStage  *d_recordStage_p;              // per-thread staging of log
+                                                // records for the publication
+                                                // thread, or 0 if records are
+                                                // published by the caller
+                                                // (held, not owned)
+
     UserFieldsPopulatorCallback
                   d_userFieldsPopulator;        // user fields populator
                                                 // functor
@@ -1026,11 +1054,15 @@ class Logger {
     /// the internal message buffer accessible via `obtainMessageBuffer`,
     /// and the specified `globalAllocator` used to supply memory.  On a
     /// Trigger or Trigger-All event, the messages are published in the
-    /// specified `logOrder`.  Note that this constructor is `private` since
-    /// the creation of instances of `Logger` is managed by its `friend`
-    /// `LoggerManager`.
+    /// specified `logOrder`.  If the specified `recordStage` is not 0, log
+    /// records are obtained from, and handed off through, `recordStage`
+    /// and are published on its publication thread; otherwise, records are
+    /// published by the thread that logs them.  Note that this constructor
+    /// is `private` since the creation of instances of `Logger` is managed
+    /// by its `friend` `LoggerManager`.
     Logger(const bsl::shared_ptr<Observer>&            observer,
            RecordBuffer                               *recordBuffer,
+           RecordStage                                *recordStage,
            const UserFieldsPopulatorCallback&          userFieldsPopulator,
            const AttributeCollectorRegistry           *attributeCollectors,
            const PublishAllTriggerCallback&            publishAllCallback,
@@ -1042,8 +1074,28 @@ class Logger {
     /// Destroy this logger.
     ~Logger();
 
+    // PRIVATE CLASS METHODS
+
+    /// Dispatch the specified `record`, staged by the `Logger` at the
+    /// specified `logger` address, based on the threshold levels of the
+    /// specified `levels`.  This function is the dispatch callback of the
+    /// `RecordStage` held by the logger manager, and is invoked on its
+    /// publication thread.
+    static void dispatchStagedRecord(const bsl::shared_ptr<Record>& record,
+                                     void                          *logger,
+                                     const ThresholdAggregate&      levels);
+
     // PRIVATE MANIPULATORS
 
+    /// Dispatch the specified `record`, whose fixed fields have been set by
+    /// `prepareRecord`, based on the threshold levels of the specified
+    /// `levels`: store `record` in the buffer held by this logger, pass it
+    /// to the observer, and publish the records of this logger or of all
+    /// loggers as indicated by the severity of `record` (see the 4-argument
+    /// `logMessage`).
+    void dispatchRecord(const bsl::shared_ptr<Record>& record,
+                        const ThresholdAggregate&      levels);
+
     /// Return a shared pointer to a modifiable record having the specified
     /// `fileName` and `lineNumber` attributes, and retrieved from the
     /// shared object pool managed by this logger.
@@ -1077,6 +1129,15 @@ class Logger {
                     const bsl::shared_ptr<Record>& record,
                     const ThresholdAggregate&      levels);
 
+    /// Set the category field of the specified `record` to the specified
+    /// `category`, the severity field to the specified `severity`, and the
+    /// rest of the fixed fields (except `fileName`, `lineNumber`, and
+    /// `message`) and the attributes of `record` based on the calling
+    /// thread.
+    void prepareRecord(Record          *record,
+                       const Category&  category,
+                       int              severity);
+
     /// Publish to the observer held by this logger all records stored in
     /// the record buffer of this logger and indicate to the observer the
     /// specified publication `cause`.
@@ -1178,7 +1239,8 @@ class Logger {
 
     /// Publish to the observer held by this logger all records stored in
     /// the record buffer of this logger and indicate to the observer that
-    /// the cause is `MANUAL_PUBLISH`.
+    /// the cause is `MANUAL_PUBLISH`.  If records are staged for a
+    /// publication thread, first dispatch all records staged so far.
     void publish();
 
     /// Remove all log records from the record buffer of this logger.
@@ -1192,7 +1254,8 @@ class Logger {
 
     /// Return a *snapshot* of number of records that have been dispensed by
     /// `getRecord` but have not yet been supplied (returned) using
-    /// `logRecord`.
+    /// `logRecord`.  Note that records dispensed for a publication thread
+    /// (see `LoggerManagerConfiguration::e_STAGED`) are not counted.
     int numRecordsInUse() const;
 };
 
@@ -1301,6 +1364,12 @@ class LoggerManager {
 
     RecordBuffer          *d_recordBuffer_p;     // holds record buffer (owned)
 
+    RecordStage           *d_recordStage_p;      // per-thread staging of log
+                                                 // records for the
+                                                 // publication thread, or 0 if
+                                                 // records are published by
+                                                 // the caller (owned)
+
     PublishAllTriggerCallback
                            d_publishAllCallback; // self-installed callback
                                                  // functor to publish all
@@ -1860,7 +1929,8 @@ class LoggerManager {
     /// Transmit to the observers registered with this logger manager all
     /// log records accumulated in the record buffers of all loggers managed
     /// by this logger manager, and indicate the publication cause to be
-    /// `MANUAL_PUBLISH_ALL`.
+    /// `MANUAL_PUBLISH_ALL`.  If records are staged for a publication
+    /// thread, first dispatch all records staged so far.
     void publishAll();
 
     /// Invoke the specified `visitor` functor on each category managed by
@@ -2208,6 +2278,9 @@ char *Logger::messageBuffer()
 inline
 void Logger::publish()
 {
+    if (d_recordStage_p) {
+        d_recordStage_p->drain();
+    }
     publish(Transmission::e_MANUAL_PUBLISH);
 }
 
@@ -2497,6 +2570,9 @@ int LoggerManager::removeRules(const RuleSet& ruleSet)
 inline
 void LoggerManager::publishAll()
 {
+    if (d_recordStage_p) {
+        d_recordStage_p->drain();
+    }
     publishAllImp(Transmission::e_MANUAL_PUBLISH_ALL);
 }
 
@@ -216,6 +216,7 @@ using namespace bdlf::PlaceHolders;
 // [50] USAGE EXAMPLE #4
 // [44] CONCERN: `obtainMessageBuffer` USES GLOBAL ALLOCATOR
 // [37] CONCERN: RECORD POOL MEMORY CONSUMPTION
+// [38] CONCERN: STAGED PUBLICATION
 // [19] CONCERN: PERFORMANCE IMPLICATIONS
 // [12] CONCERN: LOG RECORD POPULATOR CALLBACKS
 // [11] CONCERN: INTERNAL BROADCAST OBSERVER
@@ -224,6 +225,7 @@ using namespace bdlf::PlaceHolders;
 // [ 5] CONCERN: DEFAULT THRESHOLD LEVELS
 // [ 3] CONCERN: LOGGER MANAGER DEFAULTS
 // [-1] CONCERN: LEGACY OBSERVERS LIFETIME
+// [-3] CONCERN: STAGED PUBLICATION THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1626,6 +1628,118 @@ extern "C" {
 
 }  // close namespace BALL_LOGGERMANAGER_CONCURRENT_TESTS
 
+namespace BALL_LOGGERMANAGER_STAGED_PUBLICATION {
+
+enum {
+    k_NUM_THREADS = 4,       // number of logging threads
+    k_NUM_RECORDS = 1000     // number of records logged by each thread
+};
+
+/// This struct describes a record published to a `RecordingObserver`.
+struct Publication {
+
+    // DATA
+    bsls::Types::Uint64       d_recordThreadId;     // thread id of record
+    bsls::Types::Uint64       d_publisherThreadId;  // publishing thread
+    int                       d_lineNumber;         // line of record
+    bsl::string               d_message;            // message of record
+    ball::Transmission::Cause d_cause;              // publication cause
+};
+
+/// This concrete implementation of `ball::Observer` records the salient
+/// attributes of each record published to it, as well as the thread on
+/// which each record was published.
+class RecordingObserver : public ball::Observer {
+
+    // DATA
+    mutable bslmt::Mutex     d_mutex;         // protects `d_publications`
+    bsl::vector<Publication> d_publications;  // published records
+
+  public:
+    // MANIPULATORS
+    using Observer::publish;  // avoid hiding base class method
+
+    /// Record the specified `record` and `context`.
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context&                       context)
+                                                          BSLS_KEYWORD_OVERRIDE
+    {
+        Publication publication;
+        publication.d_recordThreadId    = record->fixedFields().threadID();
+        publication.d_publisherThreadId =
+                                         bslmt::ThreadUtil::selfIdAsUint64();
+        publication.d_lineNumber        = record->fixedFields().lineNumber();
+        publication.d_message           = record->fixedFields().message();
+        publication.d_cause             = context.transmissionCause();
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_publications.push_back(publication);
+    }
+
+    /// Discard all recorded publications.
+    void reset()
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_publications.clear();
+    }
+
+    // ACCESSORS
+
+    /// Return a copy of the publications recorded by this observer.
+    bsl::vector<Publication> publications() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_publications;
+    }
+};
+
+const ball::Category *g_category_p;  // category used by the worker threads
+
+bsls::Types::Uint64   g_threadIds[k_NUM_THREADS];
+                                     // thread ids of the worker threads
+
+int                   g_numRecords = k_NUM_RECORDS;
+                                     // number of records logged per thread
+
+bslmt::Barrier        g_barrier(k_NUM_THREADS);
+
+extern "C" {
+
+    /// Log `g_numRecords` records with increasing line numbers to
+    /// `g_category_p`, alternating between the 5-argument `logMessage` and
+    /// the `getRecord` and 3-argument `logMessage` pair.
+    void *workerThreadStaged(void *arg)
+    {
+        const int index = static_cast<int>(
+                                      reinterpret_cast<bsls::Types::IntPtr>(
+                                                                        arg));
+        g_threadIds[index] = bslmt::ThreadUtil::selfIdAsUint64();
+
+        ball::Logger& logger = Obj::singleton().getLogger();
+
+        g_barrier.wait();
+        for (int i = 0; i < g_numRecords; ++i) {
+            if (i % 2) {
+                logger.logMessage(*g_category_p,
+                                  ball::Severity::e_INFO,
+                                  __FILE__,
+                                  i,
+                                  "staged");
+            }
+            else {
+                ball::Record *record = logger.getRecord(__FILE__, i);
+                record->fixedFields().setMessage("staged");
+                logger.logMessage(*g_category_p,
+                                  ball::Severity::e_INFO,
+                                  record);
+            }
+        }
+        return 0;
+    }
+}  // extern "C"
+
+}  // close namespace BALL_LOGGERMANAGER_STAGED_PUBLICATION
+
 namespace BALL_LOGGERMANAGER_TEST_DEFAULTTHRESHOLDLEVELSCALLBACK {
 enum {
     k_NUM_THREADS = 4  // number of threads
@@ -2555,6 +2669,220 @@ int main(int argc, char *argv[])
         ASSERT(0 == nameCatMap.size())
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
       } break;
+      case 38: {
+        // --------------------------------------------------------------------
+        // CONCERN: STAGED PUBLICATION
+        //
+        // Concerns:
+        // 1. In the `e_STAGED` publication mode, every record logged by
+        //    several concurrent threads, through either `logMessage`
+        //    overload, is published exactly once, in the order in which each
+        //    thread logged it.
+        //
+        // 2. The fixed fields of a staged record describe the logging thread,
+        //    but the record is published on a different (single) thread.
+        //
+        // 3. `publishAll` and `publish` first dispatch all staged records.
+        //
+        // 4. Records that are below every threshold are discarded.
+        //
+        // 5. Trigger events, including trigger markers, behave as in the
+        //    default publication mode.
+        //
+        // 6. Destroying the logger manager publishes all staged records.
+        //
+        // Plan:
+        // 1. Configure a logger manager with the `e_STAGED` publication mode,
+        //    log from several threads concurrently, call `publishAll`, and
+        //    verify the published records.  (C-1..3)
+        //
+        // 2. Log a record below every threshold of its category using
+        //    `getRecord` and the 3-argument `logMessage`, and verify that
+        //    nothing is published.  (C-4)
+        //
+        // 3. Log several records that are stored in the record buffer,
+        //    followed by a record that triggers the publication of the
+        //    buffer, call `publish`, and verify the sequence of published
+        //    records.  (C-3, 5)
+        //
+        // 4. Log records and destroy the logger manager without publishing
+        //    them explicitly; verify that the records are published.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: STAGED PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: STAGED PUBLICATION"
+                          << "\n===========================" << endl;
+
+        using namespace BALL_LOGGERMANAGER_STAGED_PUBLICATION;
+
+        const bsls::Types::Uint64 mainThreadId =
+                                          bslmt::ThreadUtil::selfIdAsUint64();
+
+        ball::LoggerManagerConfiguration mLMC;
+        mLMC.setPublicationMode(ball::LoggerManagerConfiguration::e_STAGED);
+
+        bsl::shared_ptr<RecordingObserver> observer =
+                                         bsl::make_shared<RecordingObserver>();
+
+        {
+            ball::LoggerManagerScopedGuard lmGuard(mLMC);
+
+            Obj& mX = Obj::singleton();
+            ASSERT(0 == mX.registerObserver(observer, "recording"));
+
+            if (veryVerbose) cout << "\tConcurrent logging." << endl;
+            {
+                g_category_p = mX.setCategory("STAGED",
+                                              0,
+                                              ball::Severity::e_INFO,
+                                              0,
+                                              0);
+                ASSERT(g_category_p);
+
+                executeInParallel(k_NUM_THREADS, workerThreadStaged);
+
+                mX.publishAll();
+
+                const bsl::vector<Publication> PUBS =
+                                                      observer->publications();
+                ASSERTV(PUBS.size(),
+                        k_NUM_THREADS * k_NUM_RECORDS == PUBS.size());
+
+                int                 nextLine[k_NUM_THREADS] = { 0 };
+                bsls::Types::Uint64 publisherId = 0;
+
+                for (bsl::size_t i = 0; i < PUBS.size(); ++i) {
+                    const Publication& PUB = PUBS[i];
+
+                    int t = 0;
+                    while (t < k_NUM_THREADS &&
+                           g_threadIds[t] != PUB.d_recordThreadId) {
+                        ++t;
+                    }
+                    ASSERTV(i, t < k_NUM_THREADS);
+                    if (t == k_NUM_THREADS) {
+                        continue;                                   // CONTINUE
+                    }
+
+                    ASSERTV(i, t, nextLine[t], PUB.d_lineNumber,
+                            nextLine[t] == PUB.d_lineNumber);
+                    nextLine[t] = PUB.d_lineNumber + 1;
+
+                    ASSERTV(i, "staged" == PUB.d_message);
+                    ASSERTV(i, PUB.d_cause,
+                            ball::Transmission::e_PASSTHROUGH == PUB.d_cause);
+
+                    // Records still staged when `publishAll` is called are
+                    // published by the calling (main) thread; all others are
+                    // published by the single publication thread.
+
+                    for (int j = 0; j < k_NUM_THREADS; ++j) {
+                        ASSERTV(i, j,
+                                g_threadIds[j] != PUB.d_publisherThreadId);
+                    }
+                    if (mainThreadId != PUB.d_publisherThreadId) {
+                        if (0 == publisherId) {
+                            publisherId = PUB.d_publisherThreadId;
+                        }
+                        ASSERTV(i, publisherId == PUB.d_publisherThreadId);
+                    }
+                }
+            }
+
+            ball::Logger& logger = mX.getLogger();
+
+            if (veryVerbose) cout << "\tDiscarded records." << endl;
+            {
+                observer->reset();
+
+                ball::Record *record = logger.getRecord(__FILE__, __LINE__);
+                record->fixedFields().setMessage("discarded");
+                logger.logMessage(*g_category_p,
+                                  ball::Severity::e_DEBUG,
+                                  record);
+
+                mX.publishAll();
+
+                ASSERTV(observer->publications().size(),
+                        0 == observer->publications().size());
+            }
+
+            if (veryVerbose) cout << "\tTrigger." << endl;
+            {
+                observer->reset();
+
+                const ball::Category *category =
+                                   mX.setCategory("STAGED.TRIGGER",
+                                                  ball::Severity::e_TRACE,
+                                                  0,
+                                                  ball::Severity::e_ERROR,
+                                                  0);
+                ASSERT(category);
+
+                for (int i = 0; i < 3; ++i) {
+                    logger.logMessage(*category,
+                                      ball::Severity::e_TRACE,
+                                      __FILE__,
+                                      i,
+                                      "stored");
+                }
+                logger.logMessage(*category,
+                                  ball::Severity::e_ERROR,
+                                  __FILE__,
+                                  3,
+                                  "trigger");
+
+                logger.publish();
+
+                const bsl::vector<Publication> PUBS =
+                                                      observer->publications();
+                ASSERTV(PUBS.size(), 6 == PUBS.size());
+
+                if (6 == PUBS.size()) {
+                    ASSERTV(PUBS[0].d_message,
+                            bsl::string::npos !=
+                                 PUBS[0].d_message.find("BEGIN RECORD DUMP"));
+                    ASSERTV(PUBS[5].d_message,
+                            bsl::string::npos !=
+                                   PUBS[5].d_message.find("END RECORD DUMP"));
+
+                    // The default log order is LIFO.
+
+                    for (int i = 0; i < 4; ++i) {
+                        const Publication& PUB = PUBS[4 - i];
+
+                        ASSERTV(i, PUB.d_lineNumber, i == PUB.d_lineNumber);
+                        ASSERTV(i, PUB.d_cause,
+                                ball::Transmission::e_TRIGGER == PUB.d_cause);
+                        ASSERTV(i, mainThreadId == PUB.d_recordThreadId);
+                    }
+                    ASSERT("trigger" == PUBS[1].d_message);
+                }
+            }
+
+            if (veryVerbose) cout << "\tDestruction." << endl;
+            {
+                observer->reset();
+
+                for (int i = 0; i < 100; ++i) {
+                    logger.logMessage(*g_category_p,
+                                      ball::Severity::e_INFO,
+                                      __FILE__,
+                                      i,
+                                      "destruction");
+                }
+            }
+        }
+
+        const bsl::vector<Publication> PUBS = observer->publications();
+        ASSERTV(PUBS.size(), 100 == PUBS.size());
+        for (bsl::size_t i = 0; i < PUBS.size(); ++i) {
+            ASSERTV(i, PUBS[i].d_lineNumber,
+                    static_cast<int>(i) == PUBS[i].d_lineNumber);
+        }
+      } break;
       case 37: {
         // --------------------------------------------------------------------
         // TESTING RECORD POOL MEMORY CONSUMPTION
@@ -7544,6 +7872,84 @@ int main(int argc, char *argv[])
         if (verbose) cout << "-----------------------------\n\n" << endl;
 
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // CONCERN: STAGED PUBLICATION THROUGHPUT
+        //
+        // Concerns:
+        //   Logging from several threads concurrently should scale better in
+        //   the `e_STAGED` publication mode than in the `e_CALLER_THREAD`
+        //   mode.
+        //
+        // Plan:
+        //   For each publication mode, log records that are passed through to
+        //   a cheap counting observer from several threads concurrently, and
+        //   report the elapsed time and the logging rate.  The number of
+        //   records logged by each thread may be specified by the second
+        //   argument (`argv[2]`) to the executable.
+        //
+        // Testing:
+        //   CONCERN: STAGED PUBLICATION THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: STAGED PUBLICATION THROUGHPUT"
+                          << "\n======================================"
+                          << endl;
+
+        using namespace BALL_LOGGERMANAGER_STAGED_PUBLICATION;
+        using BALL_LOGGERMANAGER_CONCURRENT_TESTS::PublishCountingObserver;
+
+        typedef ball::LoggerManagerConfiguration Config;
+
+        g_numRecords = verbose && atoi(argv[2]) > 0 ? atoi(argv[2]) : 100000;
+
+        const Config::PublicationMode MODES[] = { Config::e_CALLER_THREAD,
+                                                  Config::e_STAGED };
+        const char *const             NAMES[] = { "CALLER_THREAD",
+                                                  "STAGED" };
+
+        for (int m = 0; m < 2; ++m) {
+            Config mLMC;
+            mLMC.setPublicationMode(MODES[m]);
+
+            ball::LoggerManagerScopedGuard lmGuard(mLMC);
+
+            Obj& mX = Obj::singleton();
+
+            bsl::shared_ptr<PublishCountingObserver> observer =
+                                   bsl::make_shared<PublishCountingObserver>();
+            ASSERT(0 == mX.registerObserver(observer, "counting"));
+
+            g_category_p = mX.setCategory("THROUGHPUT",
+                                          0,
+                                          ball::Severity::e_INFO,
+                                          0,
+                                          0);
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            executeInParallel(k_NUM_THREADS, workerThreadStaged);
+
+            const double logTime = timer.elapsedTime();
+
+            mX.publishAll();
+
+            const double totalTime = timer.elapsedTime();
+            const int    total     = k_NUM_THREADS * g_numRecords;
+
+            ASSERTV(NAMES[m], observer->publishCount(),
+                    total == observer->publishCount());
+
+            if (verbose) {
+                cout << NAMES[m] << ": " << k_NUM_THREADS << " threads x "
+                     << g_numRecords << " records: logging " << logTime
+                     << "s (" << static_cast<double>(total) / logTime
+                     << " records/s), published after " << totalTime
+                     << "s" << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
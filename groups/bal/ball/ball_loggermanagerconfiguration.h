@@ -54,6 +54,8 @@ BSLS_IDENT("$Id: $")
 //
 // TriggerMarkers                               triggerMarkers
 //
+// PublicationMode                              publicationMode
+//
 // NAME                            DESCRIPTION
 // -------------------             -------------------------------------------
 // defaults                        constrained defaults for buffer size and
@@ -82,6 +84,14 @@ BSLS_IDENT("$Id: $")
 //                                 sequence of records logged due to a Trigger
 //                                 or Trigger-All event; default is
 //                                 'e_BEGIN_END_MARKERS'.
+//
+// publicationMode                 defines the thread on which log records are
+//                                 published to the observers; if this
+//                                 attribute is 'e_STAGED', records are handed
+//                                 off through per-thread staging buffers to a
+//                                 dedicated publication thread (see
+//                                 {`ball_recordstage`}); default is
+//                                 'e_CALLER_THREAD'.
 // ```
 // The constraints are as follows:
 // ```
@@ -99,6 +109,8 @@ BSLS_IDENT("$Id: $")
 // +--------------------------------+--------------------------------+
 // | triggerMarkers                 | (none)                         |
 // +--------------------------------+--------------------------------+
+// | publicationMode                | (none)                         |
+// +--------------------------------+--------------------------------+
 // ```
 // For convenience, the `ball::LoggerManagerConfiguration` interface contains
 // manipulators and accessors to configure and inspect the value of its
@@ -163,12 +175,15 @@ BSLS_IDENT("$Id: $")
 //   config.setUserFieldsPopulatorCallback(&exampleCallback);
 //   config.setLogOrder(ball::LoggerManagerConfiguration::e_FIFO);
 //   config.setTriggerMarkers(ball::LoggerManagerConfiguration::e_NO_MARKERS);
+//   config.setPublicationMode(ball::LoggerManagerConfiguration::e_STAGED);
 // ```
 // Now, we verify the options are configured correctly:
 // ```
 //   assert(ball::LoggerManagerConfiguration::e_FIFO == config.logOrder());
 //   assert(ball::LoggerManagerConfiguration::e_NO_MARKERS
 //                                                == config.triggerMarkers());
+//   assert(ball::LoggerManagerConfiguration::e_STAGED
+//                                               == config.publicationMode());
 // ```
 // Finally, we print the configuration value to `stdout` and return:
 // ```
@@ -194,6 +209,7 @@ BSLS_IDENT("$Id: $")
 //     Default Threshold Callback functor is null
 //     Logging order is FIFO
 //     Trigger markers are NO_MARKERS
+//     Publication mode is STAGED
 // ]
 // ```
 
@@ -295,6 +311,19 @@ class LoggerManagerConfiguration {
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
+    /// The `PublicationMode` enumeration defines the thread on which log
+    /// records are published to the observers.  If this attribute is
+    /// `e_CALLER_THREAD`, records are published by the thread that logs
+    /// them.  If this attribute is `e_STAGED`, each logging thread hands
+    /// its records off, without contention, to a dedicated publication
+    /// thread that publishes them (see `ball_recordstage`).  The default
+    /// value of this attribute is `e_CALLER_THREAD`.
+    enum PublicationMode {
+        e_CALLER_THREAD,  // publish records on the logging thread (default)
+
+        e_STAGED          // publish records on a dedicated thread
+    };
+
   private:
     // DATA
     LoggerManagerDefaults d_defaults;             // default buffer size for
@@ -322,6 +351,8 @@ class LoggerManagerConfiguration {
 
     TriggerMarkers        d_triggerMarkers;       // trigger marker
 
+    PublicationMode       d_publicationMode;      // publication mode
+
     bslma::Allocator     *d_allocator_p;          // memory allocator (held,
                                                   // not owned)
 
@@ -447,6 +478,10 @@ class LoggerManagerConfiguration {
     /// `value`.
     void setTriggerMarkers(TriggerMarkers value);
 
+    /// Set the publication mode attribute of this object to the specified
+    /// `value`.
+    void setPublicationMode(PublicationMode value);
+
     // ACCESSORS
 
     /// Return a reference to the non-modifiable defaults object attribute
@@ -498,6 +533,10 @@ class LoggerManagerConfiguration {
     /// description for effects of the trigger markers.
     TriggerMarkers triggerMarkers() const;
 
+    /// Return the publication mode attribute of this object.  See
+    /// attributes description for effects of the publication mode.
+    PublicationMode publicationMode() const;
+
     /// Format a reasonable representation of this object to the specified
     /// output `stream` at the (absolute value of) the optionally specified
     /// indentation `level` and return a reference to `stream`.  If `level`
@@ -44,6 +44,7 @@ using namespace bsl;
 // [ 1] void setDefaultValues(const ball::LMD& defaults);
 // [ 5] void setLogOrder(LogOrder value);
 // [ 6] void setTriggerMarkers(TriggerMarkers value);
+// [ 7] void setPublicationMode(PublicationMode value);
 // [ 1] void setUserFieldsPopulatorCallback(const Populator&);
 // [ 1] void setCategoryNameFilterCallback(const CNF& nameFilter);
 // [ 1] void setDefaultThresholdLevelsCallback(const DTC& );
@@ -51,6 +52,7 @@ using namespace bsl;
 // [ 1] const ball::LMD& defaults() const;
 // [ 5] const LogOrder logOrder() const;
 // [ 6] const TriggerMarkers triggerMarkers() const;
+// [ 7] PublicationMode publicationMode() const;
 // [ 1] const Populator& userFieldsPopulatorCallback() const;
 // [ 1] const CNF& categoryNameFilterCallback() const;
 // [ 1] const DTC& defaultThresholdLevelsCallback() const;
@@ -60,7 +62,7 @@ using namespace bsl;
 // [ 1] bool operator!=(const ball::LMC& lhs, const ball::LMC& rhs);
 // [ 1] bsl::ostream& operator<<(bsl::ostream&, const ball::LMC);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -182,12 +184,15 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)> DtCb;
       config.setUserFieldsPopulatorCallback(&exampleCallback);
       config.setLogOrder(ball::LoggerManagerConfiguration::e_FIFO);
       config.setTriggerMarkers(ball::LoggerManagerConfiguration::e_NO_MARKERS);
+      config.setPublicationMode(ball::LoggerManagerConfiguration::e_STAGED);
 // ```
 // Now, we verify the options are configured correctly:
 // ```
       ASSERT(ball::LoggerManagerConfiguration::e_FIFO == config.logOrder());
       ASSERT(ball::LoggerManagerConfiguration::e_NO_MARKERS
                                                    == config.triggerMarkers());
+      ASSERT(ball::LoggerManagerConfiguration::e_STAGED
+                                                  == config.publicationMode());
 // ```
 // Finally, we print the configuration value to `stdout` and return:
 // ```
@@ -213,6 +218,7 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)> DtCb;
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Publication mode is STAGED
 //  ]
 // ```
 
@@ -299,7 +305,7 @@ int main(int argc, char *argv[])
     const DtCb   DTCB1(dtCb1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -318,6 +324,73 @@ int main(int argc, char *argv[])
 
         initializeConfiguration(verbose);
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING  `setPublicationMode` AND `publicationMode`:
+        //   Verify `setPublicationMode` and `publicationMode`.
+        //
+        // Concern:
+        //   1. That the default publication mode is `e_CALLER_THREAD`.
+        //
+        //   2. That `setPublicationMode` and `publicationMode` work
+        //      correctly.
+        //
+        //   3. That the publication mode participates in copying, equality,
+        //      and printing.
+        //
+        // Plan:
+        //   1. Create a configuration and verify `publicationMode`.  (C-1)
+        //
+        //   2. Invoke `setPublicationMode` with `e_STAGED` and then
+        //      `e_CALLER_THREAD` and verify `publicationMode`.  (C-2)
+        //
+        //   3. Copy and assign a staged configuration, compare it to a
+        //      default configuration, and verify the printed output.  (C-3)
+        //
+        // Testing:
+        //   void setPublicationMode(PublicationMode value);
+        //   PublicationMode publicationMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING  `setPublicationMode` AND `publicationMode`"
+                 << "\n===================================================\n";
+
+        Obj lmc;
+        ASSERT(lmc.publicationMode() == Obj::e_CALLER_THREAD);
+
+        lmc.setPublicationMode(Obj::e_STAGED);
+        ASSERT(lmc.publicationMode() == Obj::e_STAGED);
+
+        lmc.setPublicationMode(Obj::e_CALLER_THREAD);
+        ASSERT(lmc.publicationMode() == Obj::e_CALLER_THREAD);
+
+        Obj mX;  const Obj& X = mX;
+        mX.setPublicationMode(Obj::e_STAGED);
+        ASSERT(X != lmc);
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(Obj::e_STAGED == Y.publicationMode());
+        ASSERT(X == Y);
+
+        Obj mZ;  const Obj& Z = mZ;
+        mZ = X;
+        ASSERT(Obj::e_STAGED == Z.publicationMode());
+        ASSERT(X == Z);
+
+        bsl::ostringstream oss;
+        oss << X;
+        ASSERTV(oss.str(),
+                bsl::string::npos !=
+                               oss.str().find("Publication mode is STAGED"));
+
+        oss.str("");
+        oss << lmc;
+        ASSERTV(oss.str(),
+                bsl::string::npos !=
+                        oss.str().find("Publication mode is CALLER_THREAD"));
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -6,12 +6,18 @@ BSLS_IDENT_RCSID(ball_recordattributes_cpp,"$Id$ $CSID$")
 
 #include <bdlb_print.h>
 
+#include <bdlma_localsequentialallocator.h>
+
 #include <bslma_default.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
 
 #include <bsl_cstring.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
 
 namespace BloombergLP {
 namespace ball {
@@ -32,6 +38,9 @@ RecordAttributes::RecordAttributes(bslma::Allocator *basicAllocator)
 , d_severity(0)
 , d_messageStreamBuf(basicAllocator)
 , d_messageStream(&d_messageStreamBuf)
+, d_messageExpander(0)
+, d_messageFormat_p(0)
+, d_messageState(e_MESSAGE_EXPANDED)
 {
 }
 
@@ -54,6 +63,9 @@ RecordAttributes::RecordAttributes(const bdlt::Datetime&    timestamp,
 , d_severity(severity)
 , d_messageStreamBuf(basicAllocator)
 , d_messageStream(&d_messageStreamBuf)
+, d_messageExpander(0)
+, d_messageFormat_p(0)
+, d_messageState(e_MESSAGE_EXPANDED)
 {
     setMessage(message);
 }
@@ -78,6 +90,9 @@ RecordAttributes::RecordAttributes(const bdlt::Datetime&    timestamp,
 , d_severity(severity)
 , d_messageStreamBuf(basicAllocator)
 , d_messageStream(&d_messageStreamBuf)
+, d_messageExpander(0)
+, d_messageFormat_p(0)
+, d_messageState(e_MESSAGE_EXPANDED)
 {
     setMessage(message);
 }
@@ -94,7 +109,12 @@ RecordAttributes::RecordAttributes(const RecordAttributes&  original,
 , d_severity(original.d_severity)
 , d_messageStreamBuf(basicAllocator)
 , d_messageStream(&d_messageStreamBuf)
+, d_messageExpander(0)
+, d_messageFormat_p(0)
+, d_messageState(e_MESSAGE_EXPANDED)
 {
+    original.resolveMessage();
+
     d_messageStreamBuf.pubseekpos(0);
     d_messageStreamBuf.sputn(original.d_messageStreamBuf.data(),
                              original.d_messageStreamBuf.length());
@@ -103,6 +123,8 @@ RecordAttributes::RecordAttributes(const RecordAttributes&  original,
 // MANIPULATORS
 void RecordAttributes::setMessage(const bsl::string_view& message)
 {
+    d_messageState.storeRelaxed(e_MESSAGE_EXPANDED);
+
     d_messageStreamBuf.pubseekpos(0);
     d_messageStreamBuf.sputn(message.data(), message.length());
     resetMessageStreamState();
@@ -111,6 +133,9 @@ void RecordAttributes::setMessage(const bsl::string_view& message)
 RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
 {
     if (this != &rhs) {
+        rhs.resolveMessage();
+        d_messageState.storeRelaxed(e_MESSAGE_EXPANDED);
+
         d_timestamp      = rhs.d_timestamp;
         d_processID      = rhs.d_processID;
         d_threadID       = rhs.d_threadID;
@@ -127,9 +152,64 @@ RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
     return *this;
 }
 
+void RecordAttributes::deferMessage(MessageExpander  expander,
+                                    const char      *format)
+{
+    BSLS_ASSERT(expander);
+    BSLS_ASSERT(format);
+    BSLS_ASSERT(e_MESSAGE_EXPANDED == d_messageState.loadRelaxed());
+
+    d_messageExpander = expander;
+    d_messageFormat_p = format;
+    d_messageState.storeRelease(e_MESSAGE_DEFERRED);
+}
+
+// PRIVATE ACCESSORS
+void RecordAttributes::expandDeferredMessage() const
+{
+    if (e_MESSAGE_DEFERRED != d_messageState.testAndSwap(
+                                                        e_MESSAGE_DEFERRED,
+                                                        e_MESSAGE_EXPANDING)) {
+        // Another thread is expanding the message (or has just done so).
+
+        while (e_MESSAGE_EXPANDED != d_messageState.loadAcquire()) {
+            bslmt::ThreadUtil::yield();
+        }
+        return;                                                       // RETURN
+    }
+
+    // The encoded arguments are copied out of the stream buffer, which is
+    // then rewound to receive the expanded message.
+
+    bdlma::LocalSequentialAllocator<k_RESET_MESSAGE_STREAM_CAPACITY>
+                        localAllocator(d_fileName.get_allocator().mechanism());
+    const bsl::string arguments(d_messageStreamBuf.data(),
+                                d_messageStreamBuf.length(),
+                                &localAllocator);
+
+    RecordAttributes       *mutableThis = const_cast<RecordAttributes *>(this);
+    bdlsb::MemOutStreamBuf& streamBuf   = mutableThis->d_messageStreamBuf;
+    streamBuf.pubseekpos(0);
+
+    BSLS_TRY {
+        d_messageExpander(&streamBuf,
+                          d_messageFormat_p,
+                          arguments.data(),
+                          arguments.length());
+    }
+    BSLS_CATCH(...) {
+        // The exception cannot be reported to the thread that created the
+        // message; keep whatever was written before it was thrown.
+    }
+
+    d_messageState.storeRelease(e_MESSAGE_EXPANDED);
+}
+
 // ACCESSORS
 const char *RecordAttributes::message() const
 {
+    resolveMessage();
+
     const bsl::size_t length = d_messageStreamBuf.length();
     if (0 == length || '\0' != *(d_messageStreamBuf.data() + length - 1)) {
         // Null terminate the string.
@@ -145,6 +225,8 @@ const char *RecordAttributes::message() const
 
 bslstl::StringRef RecordAttributes::messageRef() const
 {
+    resolveMessage();
+
     const bsl::size_t length = d_messageStreamBuf.length();
     const char *str = d_messageStreamBuf.data();
 #if defined(BSLS_PLATFORM_OS_SOLARIS)
@@ -71,6 +71,27 @@ BSLS_IDENT("$Id: $")
 // respective attributes by the default constructor of
 // `ball::RecordAttributes`.
 //
+///Deferred Messages
+///-----------------
+// The message attribute may also be supplied in a *deferred* form: a binary
+// encoding of the arguments of a message, written to `messageStreamBuf`,
+// together with a format string and a `MessageExpander` function that knows
+// how to decode the arguments and format them (see `deferMessage`).  The
+// message is then expanded, in place, by the first call to any method that
+// provides access to the message attribute (`message`, `messageRef`,
+// `messageStreamBuf`, `messageStream`, `print`, copy construction,
+// assignment, and equality comparison), on whichever thread makes that call.
+// This allows the (comparatively expensive) formatting of a log message to be
+// moved from the thread that creates a log record to the thread that
+// publishes it (see `ball_fmt`).  Note that expansion is performed at most
+// once, and that concurrent calls to the `const` accessors of a
+// `RecordAttributes` object holding a deferred message are safe: one caller
+// expands the message, and the others wait for the expansion to complete.
+// If a `MessageExpander` throws an exception, the exception is discarded and
+// the message attribute holds whatever was written to `messageStreamBuf`
+// before the exception was thrown.  Calls to `setMessage`, `clearMessage`,
+// and `operator=` discard a deferred message that was not yet expanded.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -197,10 +218,12 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_atomic.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_string_view.h>
@@ -230,6 +253,19 @@ namespace ball {
 /// both source and destination) is supported in all cases.
 class RecordAttributes {
 
+  public:
+    // TYPES
+
+    /// `MessageExpander` is an alias for the type of a function that writes
+    /// to the specified `streamBuf` the message described by the specified
+    /// `format` and the encoded message arguments held in the specified
+    /// `arguments` buffer of the specified `length` (see `deferMessage`).
+    typedef void (*MessageExpander)(bdlsb::MemOutStreamBuf *streamBuf,
+                                    const char             *format,
+                                    const char             *arguments,
+                                    bsl::size_t             length);
+
+  private:
     // PRIVATE TYPES
     typedef bsls::Types::Uint64 Uint64;
 
@@ -240,6 +276,15 @@ class RecordAttributes {
                                                // (and not rewound)
     };
 
+    enum MessageState {
+        // states of the message attribute
+
+        e_MESSAGE_EXPANDED = 0,  // `d_messageStreamBuf` holds the message
+        e_MESSAGE_DEFERRED = 1,  // `d_messageStreamBuf` holds the encoded
+                                 // arguments of a deferred message
+        e_MESSAGE_EXPANDING = 2  // a deferred message is being expanded
+    };
+
     // DATA
     bdlt::Datetime d_timestamp;       // creation date and time
     int            d_processID;       // process id of creator
@@ -256,6 +301,16 @@ class RecordAttributes {
     bsl::ostream           d_messageStream;     // stream associated with the
                                                 // message attribute
 
+    MessageExpander        d_messageExpander;   // expander of a deferred
+                                                // message
+
+    const char            *d_messageFormat_p;   // format of a deferred
+                                                // message (held, not owned)
+
+    mutable bsls::AtomicInt
+                           d_messageState;      // `MessageState` of the
+                                                // message attribute
+
     // FRIENDS
     friend bool operator==(const RecordAttributes&, const RecordAttributes&);
 
@@ -267,6 +322,16 @@ class RecordAttributes {
     /// the first place).
     void resetMessageStreamState();
 
+    // PRIVATE ACCESSORS
+
+    /// Expand the deferred message held by this object, if any, or wait
+    /// until an expansion in progress on another thread completes.  Note
+    /// that this method modifies `d_messageStreamBuf`.
+    void expandDeferredMessage() const;
+
+    /// Expand the deferred message held by this object, if any.
+    void resolveMessage() const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecordAttributes,
@@ -327,12 +392,25 @@ class RecordAttributes {
     /// and `messageStream` methods.
     void clearMessage();
 
+    /// Defer the formatting of the message attribute of this record
+    /// attributes object, whose stream buffer holds the binary encoding of
+    /// the arguments of the message, until the message attribute is first
+    /// accessed, at which point the specified `expander` is invoked with the
+    /// stream buffer (rewound), the specified `format`, and a copy of the
+    /// encoded arguments.  The behavior is undefined unless `expander` is
+    /// not 0, `format` remains valid for the lifetime of this object (e.g.,
+    /// it is a string literal), and no deferred message is already held.
+    /// See [](#Deferred Messages).
+    void deferMessage(MessageExpander expander, const char *format);
+
     /// Return a reference to the modifiable stream buffer associated with
-    /// the message attribute of this record attributes object.
+    /// the message attribute of this record attributes object.  Any deferred
+    /// message is expanded first.
     bdlsb::MemOutStreamBuf& messageStreamBuf();
 
     /// Return a reference to the modifiable stream associated with the
-    /// message attribute of this record attributes object.
+    /// message attribute of this record attributes object.  Any deferred
+    /// message is expanded first.
     bsl::ostream& messageStream();
 
     /// Set the category attribute of this record attributes object to the
@@ -414,12 +492,18 @@ class RecordAttributes {
     /// Return the timestamp attribute of this record attributes object.
     const bdlt::Datetime& timestamp() const;
 
+    /// Return `true` if this record attributes object holds a deferred
+    /// message that has not yet been expanded, and `false` otherwise.
+    bool isMessageDeferred() const;
+
     /// Return a reference to the non-modifiable stream buffer associated
-    /// with the message attribute of this record attributes object.
+    /// with the message attribute of this record attributes object.  Any
+    /// deferred message is expanded first.
     const bdlsb::MemOutStreamBuf& messageStreamBuf() const;
 
     /// Return a reference to the non-modifiable stream associated with the
-    /// message attribute of this record attributes object.
+    /// message attribute of this record attributes object.  Any deferred
+    /// message is expanded first.
     const bsl::ostream& messageStream() const;
 
     /// Format this object to the specified output `stream` at the
@@ -483,10 +567,23 @@ void RecordAttributes::resetMessageStreamState()
     d_messageStream.width(0);
 }
 
+// PRIVATE ACCESSORS
+inline
+void RecordAttributes::resolveMessage() const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                       e_MESSAGE_EXPANDED != d_messageState.loadAcquire())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        expandDeferredMessage();
+    }
+}
+
 // MANIPULATORS
 inline
 void RecordAttributes::clearMessage()
 {
+    d_messageState.storeRelaxed(e_MESSAGE_EXPANDED);
+
     // Note that the stream buffer holding the message attribute has initial
     // capacity of 256 bytes (by implementation).  Reset those stream buffers
     // that are bigger than the default and "rewind" those that are smaller or
@@ -505,12 +602,14 @@ void RecordAttributes::clearMessage()
 inline
 bdlsb::MemOutStreamBuf& RecordAttributes::messageStreamBuf()
 {
+    resolveMessage();
     return d_messageStreamBuf;
 }
 
 inline
 bsl::ostream& RecordAttributes::messageStream()
 {
+    resolveMessage();
     return d_messageStream;
 }
 
@@ -605,15 +704,23 @@ bsls::Types::Uint64 RecordAttributes::kernelThreadID() const
     return d_kernelThreadID;
 }
 
+inline
+bool RecordAttributes::isMessageDeferred() const
+{
+    return e_MESSAGE_EXPANDED != d_messageState.loadAcquire();
+}
+
 inline
 const bdlsb::MemOutStreamBuf& RecordAttributes::messageStreamBuf() const
 {
+    resolveMessage();
     return d_messageStreamBuf;
 }
 
 inline
 const bsl::ostream& RecordAttributes::messageStream() const
 {
+    resolveMessage();
     return d_messageStream;
 }
 
@@ -17,6 +17,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_exceptionutil.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -61,7 +62,12 @@ using namespace bsl;
 //    This tests `setMessage` and `clearMessage`, and, in particular, their
 //    interaction with the `messageStream` and `messageStreamBuf` accessors.
 //
-// 4. *Usage Test*
+// 4. `deferMessage`
+//    This tests that a deferred message is expanded exactly once, by the
+//    first access to the message attribute, and is discarded by the
+//    manipulators that replace the message.
+//
+// 5. *Usage Test*
 //    This illustrates simple usage examples, taken from the component
 //    header file.
 //-----------------------------------------------------------------------------
@@ -91,6 +97,8 @@ using namespace bsl;
 // [ 4] void clearMessage();
 // [ 2] bdlsb::MemOutStreamBuf& messageStreamBuf();
 // [ 2] bsl::ostream& messageStream();
+// [ 5] void deferMessage(MessageExpander expander, const char *format);
+// [ 5] bool isMessageDeferred() const;
 // [ 2] ostream& print(ostream& os, int level = 0, int spl = 4) const;
 //
 // [ 2] bool operator==(const Obj& lhs, const Obj& rhs);
@@ -98,8 +106,8 @@ using namespace bsl;
 // [ 2] ostream& operator<<(ostream& os, const ball::RecordAttributes&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 5] USAGE EXAMPLE 1
-// [ 6] USAGE EXAMPLE 2
+// [ 6] USAGE EXAMPLE 1
+// [ 7] USAGE EXAMPLE 2
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -275,6 +283,44 @@ using namespace bsl;  // automatically added by script
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+static int numExpansions = 0;  // number of calls to the test expanders
+
+/// Write to the specified `streamBuf` the specified `format` followed by the
+/// specified `arguments` of the specified `length` in parentheses, and
+/// increment `numExpansions`.
+void testExpander(bdlsb::MemOutStreamBuf *streamBuf,
+                  const char             *format,
+                  const char             *arguments,
+                  bsl::size_t             length)
+{
+    ++numExpansions;
+    streamBuf->sputn(format, strlen(format));
+    streamBuf->sputc('(');
+    streamBuf->sputn(arguments, length);
+    streamBuf->sputc(')');
+}
+
+/// Write to the specified `streamBuf` the specified `format`, increment
+/// `numExpansions`, and throw an exception.
+void throwingExpander(bdlsb::MemOutStreamBuf *streamBuf,
+                      const char             *format,
+                      const char             *,
+                      bsl::size_t             )
+{
+    ++numExpansions;
+    streamBuf->sputn(format, strlen(format));
+    BSLS_THROW(numExpansions);
+}
+
+/// Load into the specified `object` the encoded arguments `"args"` of a
+/// message deferred with `testExpander` and the format `"fmt"`.
+void deferTestMessage(Obj *object)
+{
+    object->clearMessage();
+    object->messageStreamBuf().sputn("args", 4);
+    object->deferMessage(&testExpander, "fmt");
+}
+
 void initRecordAttributes(ball::RecordAttributes&    lhs,
                           const my_RecordAttributes& rhs)
 {
@@ -332,7 +378,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
         //
@@ -360,7 +406,7 @@ int main(int argc, char *argv[])
 
       } break;
 
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -408,6 +454,188 @@ int main(int argc, char *argv[])
         }
       } break;
 
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `deferMessage`
+        //
+        // Concerns:
+        // 1. An object does not hold a deferred message until `deferMessage`
+        //    is called.
+        //
+        // 2. Each method providing access to the message attribute expands a
+        //    deferred message first, passing the format and a copy of the
+        //    encoded arguments to the expander, and the expanded message
+        //    replaces the encoded arguments.
+        //
+        // 3. A deferred message is expanded once.
+        //
+        // 4. `setMessage`, `clearMessage`, and assignment discard a deferred
+        //    message without expanding it.
+        //
+        // 5. An exception thrown by the expander is discarded, and the
+        //    message holds the characters written before it was thrown.
+        //
+        // 6. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For each accessor of the message attribute, defer a message
+        //    using an expander that counts its invocations, and verify the
+        //    message and the count after two calls to the accessor.
+        //    (C-1..3)
+        //
+        // 2. Defer a message, call `setMessage`, `clearMessage`, or assign
+        //    to the object, and verify that the expander is not invoked.
+        //    (C-4)
+        //
+        // 3. Defer a message using an expander that throws.  (C-5)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void deferMessage(MessageExpander expander, const char *format);
+        //   bool isMessageDeferred() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING `deferMessage`" << endl
+                                  << "======================" << endl;
+
+        const bsl::string EXPECTED = "fmt(args)";
+
+        enum {
+            e_MESSAGE,
+            e_MESSAGE_REF,
+            e_STREAMBUF,
+            e_CONST_STREAMBUF,
+            e_STREAM,
+            e_CONST_STREAM,
+            e_PRINT,
+            e_COPY,
+            e_ASSIGN_FROM,
+            e_EQUAL,
+            e_NUM_ACCESSORS
+        };
+
+        for (int ti = 0; ti < e_NUM_ACCESSORS; ++ti) {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            ASSERTV(ti, !X.isMessageDeferred());
+
+            numExpansions = 0;
+            deferTestMessage(&mX);
+            ASSERTV(ti, X.isMessageDeferred());
+            ASSERTV(ti, 0 == numExpansions);
+
+            for (int j = 0; j < 2; ++j) {
+                switch (ti) {
+                  case e_MESSAGE: {
+                    ASSERTV(ti, EXPECTED == X.message());
+                  } break;
+                  case e_MESSAGE_REF: {
+                    ASSERTV(ti, EXPECTED == X.messageRef());
+                  } break;
+                  case e_STREAMBUF: {
+                    mX.messageStreamBuf();
+                  } break;
+                  case e_CONST_STREAMBUF: {
+                    X.messageStreamBuf();
+                  } break;
+                  case e_STREAM: {
+                    mX.messageStream();
+                  } break;
+                  case e_CONST_STREAM: {
+                    X.messageStream();
+                  } break;
+                  case e_PRINT: {
+                    bsl::ostringstream oss;
+                    X.print(oss, 0, -1);
+                    ASSERTV(ti, oss.str(),
+                            bsl::string::npos != oss.str().find(EXPECTED));
+                  } break;
+                  case e_COPY: {
+                    Obj mY(X, &testAllocator);  const Obj& Y = mY;
+                    ASSERTV(ti, !Y.isMessageDeferred());
+                    ASSERTV(ti, EXPECTED == Y.messageRef());
+                  } break;
+                  case e_ASSIGN_FROM: {
+                    Obj mY(&testAllocator);  const Obj& Y = mY;
+                    mY = X;
+                    ASSERTV(ti, EXPECTED == Y.messageRef());
+                  } break;
+                  case e_EQUAL: {
+                    Obj mY(&testAllocator);  const Obj& Y = mY;
+                    mY.setTimestamp(X.timestamp());
+                    mY.setMessage(EXPECTED);
+                    ASSERTV(ti, Y == X);
+                  } break;
+                }
+                ASSERTV(ti, j, !X.isMessageDeferred());
+                ASSERTV(ti, j, numExpansions, 1 == numExpansions);
+            }
+
+            ASSERTV(ti, X.messageRef(), EXPECTED == X.messageRef());
+
+            // Streaming after expansion extends the message.
+
+            mX.messageStream() << '!';
+            ASSERTV(ti, X.messageRef(), EXPECTED + '!' == X.messageRef());
+        }
+
+        if (verbose) cout << "\nDiscarding deferred messages." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            Obj mY(&testAllocator);  const Obj& Y = mY;
+
+            numExpansions = 0;
+
+            deferTestMessage(&mX);
+            mX.setMessage("replaced");
+            ASSERT(!X.isMessageDeferred());
+            ASSERT("replaced" == X.messageRef());
+
+            deferTestMessage(&mX);
+            mX.clearMessage();
+            ASSERT(!X.isMessageDeferred());
+            ASSERT(X.messageRef().empty());
+
+            deferTestMessage(&mX);
+            mY.setMessage("assigned");
+            mX = Y;
+            ASSERT(!X.isMessageDeferred());
+            ASSERT("assigned" == X.messageRef());
+
+            ASSERTV(numExpansions, 0 == numExpansions);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nThrowing expanders." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            numExpansions = 0;
+
+            mX.messageStreamBuf().sputn("args", 4);
+            mX.deferMessage(&throwingExpander, "partial");
+
+            ASSERT("partial" == X.messageRef());
+            ASSERT(!X.isMessageDeferred());
+            ASSERT(1 == numExpansions);
+        }
+#endif
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&testAllocator);
+
+            ASSERT_FAIL(mX.deferMessage(0, "fmt"));
+            ASSERT_FAIL(mX.deferMessage(&testExpander, 0));
+            ASSERT_PASS(mX.deferMessage(&testExpander, "fmt"));
+            ASSERT_FAIL(mX.deferMessage(&testExpander, "fmt"));
+        }
+      } break;
+
       case 4: {
         // --------------------------------------------------------------------
         // TESTING `setMessage`, `clearMessage` METHODS
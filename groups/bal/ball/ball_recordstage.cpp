@@ -0,0 +1,781 @@
+// ball_recordstage.cpp                                               -*-C++-*-
+#include <ball_recordstage.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_recordstage_cpp,"$Id$ $CSID$")
+
+#include <bdlf_memfn.h>
+
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_new.h>            // placement 'new' syntax
+#include <bsl_typeinfo.h>
+#include <bsl_vector.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Each thread that uses a `RecordStage` owns a `RecordStage_Cache`, found
+// through thread-specific storage, holding:
+//
+// * a free list of records (`d_free_p`) accessed only by the owning thread,
+// * a return stack of records (`d_returned`) onto which a record is pushed,
+//   by whichever thread releases its last reference, and which the owning
+//   thread empties with a single `swap` when its free list is exhausted, and
+// * a single-producer/single-consumer ring buffer of staged records, in
+//   which the owning thread advances the tail index (`d_tail`) with a release
+//   store, and the (mutex-serialized) consumer advances the head index
+//   (`d_head`) with a release store.  The producer re-reads the head index
+//   only when its cached copy (`d_cachedHead`) indicates the ring is full.
+//
+// Consequently, obtaining, populating, and staging a record performs no
+// allocation in the steady state, and a single atomic read-modify-write
+// operation, on `d_isIdle`, with which the producer learns whether the
+// publisher thread must be woken.  That test is a store-then-load handshake
+// (the producer stores `d_tail` then loads `d_isIdle`, while the publisher
+// stores `d_isIdle` then loads `d_tail`), which acquire loads and release
+// stores alone do not order: either load could see a stale value, leaving the
+// record waiting until the publisher times out.  Performing both accesses to
+// `d_isIdle` as read-modify-write operations orders them with respect to each
+// other, so that either the producer sees that the publisher is idle, or the
+// publisher sees the record.
+//
+// The fields written by the producer, the fields written by the consumer,
+// and the return stack are separated by padding so that they do not share a
+// cache line.
+//
+// Caches are never deallocated before the stage is destroyed; when a thread
+// terminates, its cache is released (`d_isClaimed` is reset) and may be
+// claimed by the next thread that uses the stage.  The list of caches
+// (`d_caches`) only grows, by prepending with a compare-and-swap, so that the
+// consumer can traverse it without a lock.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+const char *const k_THREAD_NAME = "ball.recstage";
+
+enum {
+    k_BATCH_SIZE        = 32,  // number of records allocated when a cache
+                               // runs out
+
+    k_IDLE_WAIT_MILLISECONDS = 10
+                               // upper bound on the time the publisher
+                               // thread waits for a signal
+};
+
+/// Return the smallest power of 2 that is not less than the specified
+/// `value`.
+bsl::size_t roundUpToPowerOfTwo(bsl::size_t value)
+{
+    bsl::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+                           // =====================
+                           // class RecordStage_Rep
+                           // =====================
+
+/// This component-private class provides a shared pointer representation
+/// holding a `Record` in-place, that returns itself to a
+/// `RecordStage_Cache` when the last reference to it is released.
+class RecordStage_Rep : public bslma::SharedPtrRep {
+
+  public:
+    // PUBLIC DATA
+    Record             d_record;          // staged record
+
+    RecordStage_Rep   *d_next_p;          // next rep in a free list or return
+                                          // stack
+
+    RecordStage_Rep   *d_nextAllocated_p; // next rep allocated by the same
+                                          // cache
+
+    RecordStage_Cache *d_cache_p;         // cache to which this rep returns
+
+    // CREATORS
+
+    /// Create a representation holding a default record that is returned to
+    /// the specified `cache`, using the specified `allocator` to supply
+    /// memory for the record.
+    RecordStage_Rep(RecordStage_Cache *cache, bslma::Allocator *allocator);
+
+    /// Destroy this representation.
+    ~RecordStage_Rep() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Clear the record held by this representation.
+    void disposeObject() BSLS_KEYWORD_OVERRIDE;
+
+    /// Push this representation onto the return stack of its cache.
+    void disposeRep() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return 0.  Note that a record stage representation has no deleter.
+    void *getDeleter(const std::type_info&) BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the address of the record held by this representation.
+    void *originalPtr() const BSLS_KEYWORD_OVERRIDE;
+};
+
+                          // =======================
+                          // class RecordStage_Cache
+                          // =======================
+
+/// This component-private class holds the per-thread state of a
+/// `RecordStage`: a free list and a return stack of records, and a ring
+/// buffer of staged records.
+class RecordStage_Cache {
+
+  public:
+    // PUBLIC TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    /// An `Entry` is a record staged in the ring buffer.
+    struct Entry {
+        RecordStage_Rep    *d_rep_p;     // staged record
+        void               *d_target_p;  // target supplied to `stageRecord`
+        ThresholdAggregate  d_levels;    // levels supplied to `stageRecord`
+    };
+
+    // PUBLIC DATA
+    bsls::AtomicUint64                    d_head;         // next entry to
+                                                          // consume (written
+                                                          // by the consumer)
+
+    const char                            d_consumerPad[
+                                           bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                          // padding
+
+    bsls::AtomicUint64                    d_tail;         // next entry to
+                                                          // produce (written
+                                                          // by the producer)
+
+    Uint64                                d_cachedHead;   // producer's last
+                                                          // read of `d_head`
+
+    RecordStage_Rep                      *d_free_p;       // free list
+                                                          // (producer only)
+
+    RecordStage_Rep                      *d_allocated_p;  // list of all reps
+                                                          // allocated by this
+                                                          // cache
+
+    bool                                  d_isConsumer;   // `true` while the
+                                                          // owning thread
+                                                          // dispatches
+
+    const char                            d_producerPad[
+                                           bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                          // padding
+
+    bsls::AtomicPointer<RecordStage_Rep>  d_returned;     // return stack
+
+    const char                            d_returnPad[
+                                           bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                          // padding
+
+    bsls::AtomicInt                       d_isClaimed;    // 1 if owned by a
+                                                          // thread
+
+    RecordStage_Cache                    *d_nextCache_p;  // next cache of the
+                                                          // stage
+
+    RecordStage                          *d_stage_p;      // owning stage
+
+    const Uint64                          d_mask;         // ring capacity - 1
+
+    bsl::vector<Entry>                    d_ring;         // ring buffer
+
+    bslma::Allocator                     *d_allocator_p;  // memory allocator
+                                                          // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RecordStage_Cache(const RecordStage_Cache&);
+    RecordStage_Cache& operator=(const RecordStage_Cache&);
+
+  public:
+    // CREATORS
+
+    /// Create a cache, claimed by the calling thread, for the specified
+    /// `stage` having a ring buffer of the specified `capacity`, using the
+    /// specified `allocator` to supply memory.  The behavior is undefined
+    /// unless `capacity` is a power of 2.
+    RecordStage_Cache(RecordStage      *stage,
+                      bsl::size_t       capacity,
+                      bslma::Allocator *allocator);
+
+    /// Destroy this cache and all the records allocated by it.
+    ~RecordStage_Cache();
+
+    // MANIPULATORS
+
+    /// Replenish the free list of this cache from the return stack or, if
+    /// the return stack is empty, by allocating a batch of records.  The
+    /// behavior is undefined unless the free list is empty and this method
+    /// is called by the thread that has claimed this cache.
+    void replenish();
+
+    /// Append an entry having the specified `rep`, `target`, and `levels`
+    /// to the ring buffer of this cache.  Return `true` on success, and
+    /// `false` if the ring buffer is full.  The behavior is undefined
+    /// unless this method is called by the thread that has claimed this
+    /// cache.
+    bool tryPush(RecordStage_Rep           *rep,
+                 void                      *target,
+                 const ThresholdAggregate&  levels);
+};
+
+                           // ---------------------
+                           // class RecordStage_Rep
+                           // ---------------------
+
+// CREATORS
+RecordStage_Rep::RecordStage_Rep(RecordStage_Cache *cache,
+                                 bslma::Allocator  *allocator)
+: d_record(allocator)
+, d_next_p(0)
+, d_nextAllocated_p(0)
+, d_cache_p(cache)
+{
+}
+
+RecordStage_Rep::~RecordStage_Rep()
+{
+}
+
+// MANIPULATORS
+void RecordStage_Rep::disposeObject()
+{
+    d_record.clear();
+}
+
+void RecordStage_Rep::disposeRep()
+{
+    bsls::AtomicPointer<RecordStage_Rep>& stack = d_cache_p->d_returned;
+
+    RecordStage_Rep *head = stack.loadRelaxed();
+    for (;;) {
+        d_next_p = head;
+
+        RecordStage_Rep *previous = stack.testAndSwapAcqRel(head, this);
+        if (previous == head) {
+            break;
+        }
+        head = previous;
+    }
+}
+
+void *RecordStage_Rep::getDeleter(const std::type_info&)
+{
+    return 0;
+}
+
+// ACCESSORS
+void *RecordStage_Rep::originalPtr() const
+{
+    return const_cast<void *>(static_cast<const void *>(&d_record));
+}
+
+                          // -----------------------
+                          // class RecordStage_Cache
+                          // -----------------------
+
+// CREATORS
+RecordStage_Cache::RecordStage_Cache(RecordStage      *stage,
+                                     bsl::size_t       capacity,
+                                     bslma::Allocator *allocator)
+: d_head(0)
+, d_consumerPad()
+, d_tail(0)
+, d_cachedHead(0)
+, d_free_p(0)
+, d_allocated_p(0)
+, d_isConsumer(false)
+, d_producerPad()
+, d_returned(0)
+, d_returnPad()
+, d_isClaimed(1)
+, d_nextCache_p(0)
+, d_stage_p(stage)
+, d_mask(capacity - 1)
+, d_ring(capacity, allocator)
+, d_allocator_p(allocator)
+{
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+}
+
+RecordStage_Cache::~RecordStage_Cache()
+{
+    while (d_allocated_p) {
+        RecordStage_Rep *rep = d_allocated_p;
+        d_allocated_p = rep->d_nextAllocated_p;
+
+        rep->~RecordStage_Rep();
+        d_allocator_p->deallocate(rep);
+    }
+}
+
+// MANIPULATORS
+void RecordStage_Cache::replenish()
+{
+    BSLS_ASSERT(0 == d_free_p);
+
+    d_free_p = d_returned.swapAcqRel(0);
+    if (d_free_p) {
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < k_BATCH_SIZE; ++i) {
+        RecordStage_Rep *rep = new (*d_allocator_p) RecordStage_Rep(
+                                                                this,
+                                                                d_allocator_p);
+        rep->d_nextAllocated_p = d_allocated_p;
+        d_allocated_p          = rep;
+
+        rep->d_next_p = d_free_p;
+        d_free_p      = rep;
+    }
+}
+
+inline
+bool RecordStage_Cache::tryPush(RecordStage_Rep           *rep,
+                                void                      *target,
+                                const ThresholdAggregate&  levels)
+{
+    const Uint64 tail = d_tail.loadRelaxed();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(tail - d_cachedHead > d_mask)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_cachedHead = d_head.loadAcquire();
+        if (tail - d_cachedHead > d_mask) {
+            return false;                                             // RETURN
+        }
+    }
+
+    Entry& entry = d_ring[static_cast<bsl::size_t>(tail & d_mask)];
+
+    entry.d_rep_p    = rep;
+    entry.d_target_p = target;
+    entry.d_levels   = levels;
+
+    d_tail.storeRelease(tail + 1);
+
+    return true;
+}
+
+                             // -----------------
+                             // class RecordStage
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+void RecordStage::releaseCache(void *cache)
+{
+    RecordStage_Cache *released = static_cast<RecordStage_Cache *>(cache);
+    if (released) {
+        released->d_isConsumer = false;
+        released->d_isClaimed.storeRelease(0);
+    }
+}
+
+// PRIVATE MANIPULATORS
+int RecordStage::consumeAll()
+{
+    typedef RecordStage_Cache::Uint64 Uint64;
+
+    int numDispatched = 0;
+
+    for (RecordStage_Cache *cache = d_caches.loadAcquire();
+         cache;
+         cache = cache->d_nextCache_p) {
+        Uint64       head = cache->d_head.loadRelaxed();
+        const Uint64 tail = cache->d_tail.loadAcquire();
+
+        while (head != tail) {
+            const RecordStage_Cache::Entry& entry =
+                      cache->d_ring[static_cast<bsl::size_t>(head & (
+                                                            cache->d_mask))];
+
+            RecordStage_Rep          *rep    = entry.d_rep_p;
+            void                     *target = entry.d_target_p;
+            const ThresholdAggregate  levels(entry.d_levels);
+
+            // Release the entry before dispatching, so that the producer can
+            // reuse it as early as possible.
+
+            cache->d_head.storeRelease(++head);
+
+            dispatch(rep, target, levels);
+            ++numDispatched;
+        }
+    }
+
+    return numDispatched;
+}
+
+inline
+void RecordStage::dispatch(RecordStage_Rep           *rep,
+                           void                      *target,
+                           const ThresholdAggregate&  levels)
+{
+    // The shared pointer adopts the reference set by `getRecord`.
+
+    bsl::shared_ptr<Record> handle(&rep->d_record, rep);
+    d_dispatchCallback(handle, target, levels);
+}
+
+RecordStage_Cache *RecordStage::localCache()
+{
+    RecordStage_Cache *cache = static_cast<RecordStage_Cache *>(
+                                  bslmt::ThreadUtil::getSpecific(d_cacheKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        return cache;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // Claim a cache released by a terminated thread, if any, and otherwise
+    // create (and publish) a new one.
+
+    for (cache = d_caches.loadAcquire(); cache; cache = cache->d_nextCache_p) {
+        if (0 == cache->d_isClaimed.testAndSwap(0, 1)) {
+            break;
+        }
+    }
+
+    if (!cache) {
+        cache = new (*d_allocator_p) RecordStage_Cache(this,
+                                                       d_ringCapacity,
+                                                       d_allocator_p);
+
+        RecordStage_Cache *head = d_caches.loadRelaxed();
+        for (;;) {
+            cache->d_nextCache_p = head;
+
+            RecordStage_Cache *previous = d_caches.testAndSwapAcqRel(head,
+                                                                     cache);
+            if (previous == head) {
+                break;
+            }
+            head = previous;
+        }
+    }
+
+    int rc = bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+
+    return cache;
+}
+
+void RecordStage::publicationThreadMain()
+{
+    RecordStage_Cache *cache = localCache();
+    cache->d_isConsumer = true;
+
+    while (e_RUNNING == d_state.loadAcquire()) {
+        int numDispatched;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_consumerMutex);
+            numDispatched = consumeAll();
+        }
+        if (0 < numDispatched) {
+            continue;
+        }
+
+        // Advertise that this thread is about to wait, then look for records
+        // one last time.  A producer whose read-modify-write of `d_isIdle`
+        // (see `stageRecord`) precedes this one staged its record before it,
+        // and the record is consumed below; any other producer observes
+        // `d_isIdle` and wakes this thread.
+
+        d_isIdle.swap(1);
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_consumerMutex);
+            numDispatched = consumeAll();
+        }
+        if (0 == numDispatched) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_idleMutex);
+            if (e_RUNNING == d_state.loadAcquire() && d_isIdle) {
+                d_idleCondition.timedWait(
+                          &d_idleMutex,
+                          bsls::SystemTime::nowRealtimeClock()
+                            .addMilliseconds(k_IDLE_WAIT_MILLISECONDS));
+            }
+        }
+        d_isIdle = 0;
+    }
+
+    cache->d_isConsumer = false;
+}
+
+void RecordStage::wakePublisher()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_idleMutex);
+        d_isIdle = 0;
+    }
+    d_idleCondition.signal();
+}
+
+// CREATORS
+RecordStage::RecordStage(const DispatchCallback&  dispatchCallback,
+                         bslma::Allocator        *basicAllocator)
+: d_dispatchCallback(bsl::allocator_arg_t(),
+                     bslma::Default::allocator(basicAllocator),
+                     dispatchCallback)
+, d_ringCapacity(k_DEFAULT_RING_CAPACITY)
+, d_recordOffset(0)
+, d_caches(0)
+, d_state(e_STOPPED)
+, d_isIdle(0)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(d_dispatchCallback);
+
+    RecordStage_Rep probe(0, d_allocator_p);
+    d_recordOffset = reinterpret_cast<char *>(&probe.d_record)
+                   - reinterpret_cast<char *>(&probe);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_cacheKey, &releaseCache);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+}
+
+RecordStage::RecordStage(const DispatchCallback&  dispatchCallback,
+                         int                      ringCapacity,
+                         bslma::Allocator        *basicAllocator)
+: d_dispatchCallback(bsl::allocator_arg_t(),
+                     bslma::Default::allocator(basicAllocator),
+                     dispatchCallback)
+, d_ringCapacity(roundUpToPowerOfTwo(static_cast<bsl::size_t>(ringCapacity)))
+, d_recordOffset(0)
+, d_caches(0)
+, d_state(e_STOPPED)
+, d_isIdle(0)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < ringCapacity);
+    BSLS_ASSERT(d_dispatchCallback);
+
+    RecordStage_Rep probe(0, d_allocator_p);
+    d_recordOffset = reinterpret_cast<char *>(&probe.d_record)
+                   - reinterpret_cast<char *>(&probe);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_cacheKey, &releaseCache);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+}
+
+RecordStage::~RecordStage()
+{
+    stopPublicationThread();
+    drain();
+
+    bslmt::ThreadUtil::deleteKey(d_cacheKey);
+
+    RecordStage_Cache *cache = d_caches.loadAcquire();
+    while (cache) {
+        RecordStage_Cache *next = cache->d_nextCache_p;
+        d_allocator_p->deleteObject(cache);
+        cache = next;
+    }
+}
+
+// MANIPULATORS
+void RecordStage::drain()
+{
+    RecordStage_Cache *cache = localCache();
+    if (cache->d_isConsumer) {
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_consumerMutex);
+
+    cache->d_isConsumer = true;
+    consumeAll();
+    cache->d_isConsumer = false;
+}
+
+Record *RecordStage::getRecord()
+{
+    RecordStage_Cache *cache = localCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache->d_free_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        cache->replenish();
+    }
+
+    RecordStage_Rep *rep = cache->d_free_p;
+    cache->d_free_p = rep->d_next_p;
+
+    rep->d_cache_p = cache;
+    rep->resetCountsRaw(1, 0);
+
+    return &rep->d_record;
+}
+
+void RecordStage::discardRecord(Record *record)
+{
+    BSLS_ASSERT(record);
+
+    RecordStage_Rep *rep = reinterpret_cast<RecordStage_Rep *>(
+                         reinterpret_cast<char *>(record) - d_recordOffset);
+
+    rep->d_record.clear();
+
+    RecordStage_Cache *cache = localCache();
+
+    rep->d_cache_p  = cache;
+    rep->d_next_p   = cache->d_free_p;
+    cache->d_free_p = rep;
+}
+
+void RecordStage::stageRecord(Record                    *record,
+                              void                      *target,
+                              const ThresholdAggregate&  levels)
+{
+    BSLS_ASSERT(record);
+
+    RecordStage_Rep *rep = reinterpret_cast<RecordStage_Rep *>(
+                         reinterpret_cast<char *>(record) - d_recordOffset);
+
+    RecordStage_Cache *cache = localCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(cache->d_isConsumer)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // This thread is already dispatching (i.e., this method is called
+        // from within the dispatch callback); dispatch directly rather than
+        // wait on a ring buffer that only this thread consumes.
+
+        dispatch(rep, target, levels);
+        return;                                                       // RETURN
+    }
+
+    while (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                       e_RUNNING != d_state.loadAcquire()
+                                    || !cache->tryPush(rep, target, levels))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (e_RUNNING != d_state.loadAcquire()) {
+            // Dispatch on this thread, after any records staged earlier.
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_consumerMutex);
+
+            cache->d_isConsumer = true;
+            consumeAll();
+            dispatch(rep, target, levels);
+            cache->d_isConsumer = false;
+            return;                                                   // RETURN
+        }
+
+        // The ring buffer is full: wait for the publisher thread.
+
+        wakePublisher();
+        bslmt::ThreadUtil::yield();
+    }
+
+    // An acquire load of `d_isIdle` could be satisfied before the release
+    // store of `d_tail` in `tryPush` is visible to the publisher thread (see
+    // the implementation notes).
+
+    if (d_isIdle.add(0)) {
+        wakePublisher();
+    }
+}
+
+int RecordStage::startPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadMutex);
+
+    if (e_STOPPED != d_state.loadAcquire()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_state.storeRelease(e_RUNNING);
+
+    bslmt::ThreadAttributes attributes;
+    attributes.setThreadName(k_THREAD_NAME);
+
+    int rc = bslmt::ThreadUtil::createWithAllocator(
+                   &d_threadHandle,
+                   attributes,
+                   bdlf::MemFnUtil::memFn(&RecordStage::publicationThreadMain,
+                                          this),
+                   d_allocator_p);
+    if (0 != rc) {
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+        d_state.storeRelease(e_STOPPED);
+    }
+
+    return rc;
+}
+
+int RecordStage::stopPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadMutex);
+
+    if (e_RUNNING != d_state.loadAcquire()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_state.storeRelease(e_STOPPING);
+    wakePublisher();
+
+    int rc = bslmt::ThreadUtil::join(d_threadHandle);
+
+    d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+    d_state.storeRelease(e_STOPPED);
+
+    // Dispatch the records staged before the publisher thread stopped.
+
+    drain();
+
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
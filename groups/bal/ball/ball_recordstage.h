@@ -0,0 +1,414 @@
+// ball_recordstage.h                                                 -*-C++-*-
+#ifndef INCLUDED_BALL_RECORDSTAGE
+#define INCLUDED_BALL_RECORDSTAGE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide per-thread record caches handing off to a publisher thread.
+//
+//@CLASSES:
+//  ball::RecordStage: per-thread record cache and hand-off to a publisher
+//
+//@SEE_ALSO: ball_loggermanager, ball_loggermanagerconfiguration
+//
+//@DESCRIPTION: This component provides a mechanism, `ball::RecordStage`, that
+// supplies log records to logging threads from a per-thread cache, and hands
+// populated records off to a single publisher thread that invokes a
+// user-supplied dispatch callback on each of them.  A `ball::LoggerManager`
+// configured with the `e_STAGED` publication mode (see
+// `ball_loggermanagerconfiguration`) uses a `ball::RecordStage` to move the
+// publication of log records (i.e., the invocation of the registered
+// observers) off the logging threads.
+//
+// The purpose of the stage is to make the logging fast path free of
+// contention.  A thread logging a message through a stage:
+//
+// * takes a record from a free list private to the thread (no atomic
+//   operation),
+// * populates the record,
+// * appends the record to a single-producer/single-consumer ring buffer
+//   private to the thread, which is published to the consumer with a single
+//   release store, and
+// * tests, with a single atomic read-modify-write operation, whether the
+//   publisher thread is idle and must be woken.
+//
+// Records are handed to the dispatch callback as `bsl::shared_ptr<Record>`
+// objects whose representation is embedded with the record, so that no
+// allocation is needed to create the shared pointer.  When the last reference
+// to a dispatched record is released (on whichever thread that happens to be),
+// the record is cleared and pushed onto a lock-free return stack of the cache
+// it came from; the owning thread reclaims the entire return stack with a
+// single atomic exchange only when its private free list is exhausted, and
+// allocates a new batch of records only if the return stack is also empty.
+// The memory for the records is therefore allocated once, and reused for the
+// lifetime of the stage.
+//
+///Publication Thread
+///------------------
+// The publisher thread is started by `startPublicationThread` and stopped by
+// `stopPublicationThread`.  The publisher thread repeatedly visits the ring
+// buffers of all threads that have used the stage and dispatches the records
+// it finds, preserving the order in which each individual thread staged its
+// records (no ordering is defined between records staged by different
+// threads).  When no records are available, the publisher thread waits for a
+// signal from a logging thread; to keep the logging fast path free of
+// contention, that signal is sent only when the publisher thread has
+// advertised that it is idle.  The wait is bounded, so that publication
+// proceeds even if no further record is staged.
+//
+// If a thread stages a record when its ring buffer is full, the thread yields
+// until the publisher thread has made room (i.e., the stage applies
+// back-pressure rather than dropping records).  If the publisher thread is
+// not running, or if a record is staged from within the dispatch callback
+// (e.g., by an observer that itself logs), the record is dispatched
+// immediately on the calling thread.
+//
+// `drain` dispatches, on the calling thread, every record that was staged
+// before the call and has not yet been dispatched.
+//
+///Thread Safety
+///-------------
+// `ball::RecordStage` is *fully thread-safe*, meaning that all non-creator
+// methods can be safely invoked concurrently from multiple threads.  The
+// dispatch callback is never invoked concurrently with itself, except when
+// a record is staged from within the dispatch callback (see above).  The
+// behavior is undefined if the dispatch callback throws an exception, or if
+// it calls `startPublicationThread` or `stopPublicationThread` on the stage
+// invoking it.
+//
+// The behavior is undefined if a record obtained from a stage (or a shared
+// pointer to such a record supplied to the dispatch callback) is still in use
+// when the stage is destroyed.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handing Records Off to a Publisher Thread
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we stage records on a logging thread and have them
+// delivered to a callback on the publisher thread of the stage.
+//
+// First, we define a dispatch callback that counts the records it receives
+// and checks the target address supplied with each record:
+// ```
+// static int s_numDispatched = 0;
+//
+// void countRecord(const bsl::shared_ptr<ball::Record>&  record,
+//                  void                                 *target,
+//                  const ball::ThresholdAggregate&       )
+// {
+//     assert(record);
+//     assert(&s_numDispatched == target);
+//
+//     ++*static_cast<int *>(target);
+// }
+// ```
+// Then, we create a stage supplying our callback, and start its publisher
+// thread:
+// ```
+// ball::RecordStage stage(&countRecord);
+//
+// int rc = stage.startPublicationThread();
+// assert(0 == rc);
+// ```
+// Next, we obtain a record from the stage, populate it, and stage it for
+// publication; note that the record is no longer accessible to the logging
+// thread after `stageRecord` is called:
+// ```
+// ball::ThresholdAggregate levels(0, 255, 0, 0);
+//
+// for (int i = 0; i < 10; ++i) {
+//     ball::Record *record = stage.getRecord();
+//
+//     record->fixedFields().setSeverity(ball::Severity::e_INFO);
+//     record->fixedFields().setMessage("Hello, world!");
+//
+//     stage.stageRecord(record, &s_numDispatched, levels);
+// }
+// ```
+// Finally, we wait for all staged records to be dispatched, and stop the
+// publisher thread:
+// ```
+// stage.drain();
+// assert(10 == s_numDispatched);
+//
+// stage.stopPublicationThread();
+// ```
+
+#include <balscm_version.h>
+
+#include <ball_record.h>
+#include <ball_thresholdaggregate.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class RecordStage_Cache;
+class RecordStage_Rep;
+
+                             // =================
+                             // class RecordStage
+                             // =================
+
+/// This class provides a mechanism that supplies log records from
+/// per-thread caches, and hands staged records off, through per-thread
+/// single-producer/single-consumer ring buffers, to a publisher thread
+/// that invokes a dispatch callback on each of them.
+class RecordStage {
+
+  public:
+    // TYPES
+
+    /// `DispatchCallback` is the type of the functor invoked for each
+    /// staged record, supplied with the record, the target address
+    /// supplied to `stageRecord`, and the threshold levels supplied to
+    /// `stageRecord`.
+    typedef bsl::function<void(const bsl::shared_ptr<Record>&,
+                               void *,
+                               const ThresholdAggregate&)> DispatchCallback;
+
+    // CONSTANTS
+    enum {
+        k_DEFAULT_RING_CAPACITY = 1024  // default capacity (in records) of
+                                        // the ring buffer of each thread
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum State {
+        e_STOPPED,   // publisher thread is not running
+        e_RUNNING,   // publisher thread is running
+        e_STOPPING   // publisher thread has been asked to stop
+    };
+
+    // DATA
+    DispatchCallback           d_dispatchCallback;
+                                               // invoked on each staged
+                                               // record
+
+    const bsl::size_t          d_ringCapacity; // capacity of each ring (a
+                                               // power of 2)
+
+    bsl::ptrdiff_t             d_recordOffset; // offset of the record within
+                                               // its shared pointer rep
+
+    bslmt::ThreadUtil::Key     d_cacheKey;     // thread-specific cache of the
+                                               // calling thread
+
+    bsls::AtomicPointer<RecordStage_Cache>
+                               d_caches;       // list of all caches (never
+                                               // shrinks)
+
+    bsls::AtomicInt            d_state;        // `State` of the publisher
+                                               // thread
+
+    bsls::AtomicInt            d_isIdle;       // 1 if the publisher thread
+                                               // is about to wait, 0
+                                               // otherwise
+
+    bslmt::Mutex               d_consumerMutex;// serializes the consumers of
+                                               // the ring buffers
+
+    bslmt::Mutex               d_idleMutex;    // used with `d_idleCondition`
+
+    bslmt::Condition           d_idleCondition;// signaled to wake up the
+                                               // publisher thread
+
+    bslmt::Mutex               d_threadMutex;  // serializes starting and
+                                               // stopping the publisher
+                                               // thread
+
+    bslmt::ThreadUtil::Handle  d_threadHandle; // handle of the publisher
+                                               // thread
+
+    bslma::Allocator          *d_allocator_p;  // memory allocator (held, not
+                                               // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RecordStage(const RecordStage&);
+    RecordStage& operator=(const RecordStage&);
+
+    // PRIVATE CLASS METHODS
+
+    /// Release the specified `cache` for reuse by another thread.  This
+    /// method is invoked when a thread that has used a stage terminates.
+    static void releaseCache(void *cache);
+
+    // PRIVATE MANIPULATORS
+
+    /// Dispatch the records in the ring buffers of all caches of this
+    /// stage, and return the number of records dispatched.  The behavior is
+    /// undefined unless `d_consumerMutex` is locked by the calling thread.
+    int consumeAll();
+
+    /// Dispatch the specified `rep` with the specified `target` and
+    /// `levels` on the calling thread.
+    void dispatch(RecordStage_Rep           *rep,
+                  void                      *target,
+                  const ThresholdAggregate&  levels);
+
+    /// Return the cache associated with the calling thread, creating (or
+    /// claiming an unused) cache if the calling thread does not have one.
+    RecordStage_Cache *localCache();
+
+    /// Run the publisher thread of this stage until `stopPublicationThread`
+    /// is called.
+    void publicationThreadMain();
+
+    /// Wake up the publisher thread if it is waiting for records.
+    void wakePublisher();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RecordStage, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a record stage that invokes the specified `dispatchCallback`
+    /// on each staged record.  Optionally specify a `ringCapacity`
+    /// indicating the minimum number of records each thread may stage
+    /// before being made to wait for the publisher thread; if
+    /// `ringCapacity` is not specified, `k_DEFAULT_RING_CAPACITY` is used.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `0 < ringCapacity`.  Note
+    /// that the publisher thread is not started by this constructor (see
+    /// `startPublicationThread`).
+    explicit RecordStage(const DispatchCallback&  dispatchCallback,
+                         bslma::Allocator        *basicAllocator = 0);
+    RecordStage(const DispatchCallback&  dispatchCallback,
+                int                      ringCapacity,
+                bslma::Allocator        *basicAllocator = 0);
+
+    /// Stop the publisher thread (if it is running), dispatch all records
+    /// that remain staged, and destroy this stage.  The behavior is
+    /// undefined unless every record obtained from this stage has been
+    /// released.
+    ~RecordStage();
+
+    // MANIPULATORS
+
+    /// Dispatch, on the calling thread, every record that was staged
+    /// before this call and has not yet been dispatched.  This method has
+    /// no effect if called from within the dispatch callback.
+    void drain();
+
+    /// Return the address of a modifiable record, having default field
+    /// values, taken from the cache of the calling thread.  The returned
+    /// record must subsequently be supplied to `stageRecord` or
+    /// `discardRecord` on this stage.
+    Record *getRecord();
+
+    /// Return the specified `record` to this stage without dispatching it.
+    /// The behavior is undefined unless `record` was obtained from
+    /// `getRecord` on this stage and has not since been supplied to
+    /// `stageRecord` or `discardRecord`.
+    void discardRecord(Record *record);
+
+    /// Stage the specified `record` for dispatch, with the specified
+    /// `target` and `levels`, by the publisher thread of this stage.  If
+    /// the ring buffer of the calling thread is full, yield until the
+    /// publisher thread makes room.  If the publisher thread is not
+    /// running, or if this method is called from within the dispatch
+    /// callback, dispatch `record` on the calling thread before returning.  The
+    /// behavior is undefined unless `record` was obtained from `getRecord`
+    /// on this stage and has not since been supplied to `stageRecord` or
+    /// `discardRecord`.  Note that `record` must not be accessed by the
+    /// caller after this method is called.
+    void stageRecord(Record                    *record,
+                     void                      *target,
+                     const ThresholdAggregate&  levels);
+
+    /// Start the publisher thread of this stage, if it is not already
+    /// running.  Return 0 on success, and a non-zero value otherwise.
+    int startPublicationThread();
+
+    /// Stop the publisher thread of this stage, if it is running, and
+    /// dispatch on the calling thread any records remaining staged.
+    /// Return 0 on success, and a non-zero value otherwise.
+    int stopPublicationThread();
+
+    // ACCESSORS
+
+    /// Return `true` if the publisher thread of this stage is running, and
+    /// `false` otherwise.
+    bool isPublicationThreadRunning() const;
+
+    /// Return the capacity (in records) of the ring buffer of each thread.
+    /// Note that this value may exceed the capacity supplied at
+    /// construction.
+    int ringCapacity() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class RecordStage
+                             // -----------------
+
+// ACCESSORS
+inline
+bool RecordStage::isPublicationThreadRunning() const
+{
+    return e_RUNNING == d_state.loadAcquire();
+}
+
+inline
+int RecordStage::ringCapacity() const
+{
+    return static_cast<int>(d_ringCapacity);
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *RecordStage::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
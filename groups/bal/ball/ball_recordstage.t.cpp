@@ -0,0 +1,872 @@
+// ball_recordstage.t.cpp                                             -*-C++-*-
+#include <ball_recordstage.h>
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_thresholdaggregate.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that supplies records from
+// per-thread caches, and hands staged records off to a publisher thread.  We
+// verify that records are recycled (without further allocation) once they are
+// released, that every staged record is dispatched exactly once with the
+// supplied target and levels, that the records staged by a single thread are
+// dispatched in order, and that records are dispatched on the calling thread
+// when the publisher thread is not running or is itself the caller.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] RecordStage(const DispatchCallback&, Allocator * = 0);
+// [ 3] RecordStage(const DispatchCallback&, int, Allocator * = 0);
+// [ 1] ~RecordStage();
+//
+// MANIPULATORS
+// [ 3] void drain();
+// [ 2] Record *getRecord();
+// [ 2] void discardRecord(Record *record);
+// [ 3] void stageRecord(Record *, void *, const ThresholdAggregate&);
+// [ 1] int startPublicationThread();
+// [ 1] int stopPublicationThread();
+//
+// ACCESSORS
+// [ 1] bool isPublicationThreadRunning() const;
+// [ 3] int ringCapacity() const;
+// [ 1] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef ball::RecordStage Obj;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// This class records the records dispatched by a `ball::RecordStage`.
+class Recorder {
+
+  public:
+    // PUBLIC TYPES
+
+    /// A `Dispatch` describes one invocation of `dispatch`.
+    struct Dispatch {
+        bsl::shared_ptr<ball::Record> d_record;    // dispatched record
+        void                         *d_target_p;  // dispatched target
+        ball::ThresholdAggregate      d_levels;    // dispatched levels
+        bsls::Types::Uint64           d_threadId;  // dispatching thread
+    };
+
+  private:
+    // DATA
+    bslmt::Mutex          d_mutex;         // protects `d_dispatches`
+    bsl::vector<Dispatch> d_dispatches;    // dispatched records (retained
+                                           // only if `d_retain`)
+    bsls::AtomicInt       d_count;         // number of dispatches
+    bool                  d_retain;        // retain dispatched records
+
+  public:
+    // CREATORS
+
+    /// Create a recorder that retains the dispatched records if the
+    /// specified `retain` is `true`.
+    explicit Recorder(bool retain)
+    : d_count(0)
+    , d_retain(retain)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Record the dispatch of the specified `record` with the specified
+    /// `target` and `levels`.
+    void dispatch(const bsl::shared_ptr<ball::Record>&  record,
+                  void                                 *target,
+                  const ball::ThresholdAggregate&       levels)
+    {
+        ++d_count;
+        if (d_retain) {
+            Dispatch dispatch;
+            dispatch.d_record   = record;
+            dispatch.d_target_p = target;
+            dispatch.d_levels   = levels;
+            dispatch.d_threadId = bslmt::ThreadUtil::selfIdAsUint64();
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            d_dispatches.push_back(dispatch);
+        }
+    }
+
+    /// Release the retained records.
+    void reset()
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_dispatches.clear();
+        d_count = 0;
+    }
+
+    // ACCESSORS
+
+    /// Return the number of dispatches.
+    int count() const
+    {
+        return d_count;
+    }
+
+    /// Return a reference to the retained dispatches.
+    const bsl::vector<Dispatch>& dispatches() const
+    {
+        return d_dispatches;
+    }
+};
+
+/// Return a dispatch callback that forwards to the specified `recorder`.
+Obj::DispatchCallback makeCallback(Recorder *recorder)
+{
+    return bdlf::BindUtil::bind(&Recorder::dispatch,
+                                recorder,
+                                bdlf::PlaceHolders::_1,
+                                bdlf::PlaceHolders::_2,
+                                bdlf::PlaceHolders::_3);
+}
+
+/// Stage, on the specified `stage`, the specified `numRecords` records
+/// whose line numbers are `0 .. numRecords - 1` and whose target is the
+/// specified `target`, after waiting on the specified `barrier`.
+void stageRecords(Obj            *stage,
+                  int             numRecords,
+                  void           *target,
+                  bslmt::Barrier *barrier)
+{
+    const ball::ThresholdAggregate levels(1, 2, 3, 4);
+
+    barrier->wait();
+    for (int i = 0; i < numRecords; ++i) {
+        ball::Record *record = stage->getRecord();
+        record->fixedFields().setLineNumber(i);
+        record->fixedFields().setMessage("staged");
+        stage->stageRecord(record, target, levels);
+    }
+}
+
+/// Stage one record on the specified `stage` with the specified `target`.
+void stageOne(Obj *stage, void *target)
+{
+    ball::Record *record = stage->getRecord();
+    record->fixedFields().setMessage("one");
+    stage->stageRecord(record, target, ball::ThresholdAggregate(0, 0, 0, 0));
+}
+
+/// Stage, from within a dispatch, a second record on the stage addressed
+/// by the specified `target` unless `record` is itself that second record,
+/// and count the dispatch in the specified `count`.
+void reentrantDispatch(bsls::AtomicInt                      *count,
+                       const bsl::shared_ptr<ball::Record>&  record,
+                       void                                 *target,
+                       const ball::ThresholdAggregate&       )
+{
+    ++*count;
+    if (0 != bsl::strcmp("nested", record->fixedFields().message())) {
+        Obj          *stage  = static_cast<Obj *>(target);
+        ball::Record *nested = stage->getRecord();
+        nested->fixedFields().setMessage("nested");
+        stage->stageRecord(nested,
+                           target,
+                           ball::ThresholdAggregate(0, 0, 0, 0));
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handing Records Off to a Publisher Thread
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we stage records on a logging thread and have them
+// delivered to a callback on the publisher thread of the stage.
+//
+// First, we define a dispatch callback that counts the records it receives
+// and checks the target address supplied with each record:
+// ```
+    static int s_numDispatched = 0;
+
+    void countRecord(const bsl::shared_ptr<ball::Record>&  record,
+                     void                                 *target,
+                     const ball::ThresholdAggregate&       )
+    {
+        ASSERT(record);
+        ASSERT(&s_numDispatched == target);
+
+        ++*static_cast<int *>(target);
+    }
+// ```
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+// Then, we create a stage supplying our callback, and start its publisher
+// thread:
+// ```
+    ball::RecordStage stage(&countRecord);
+
+    int rc = stage.startPublicationThread();
+    ASSERT(0 == rc);
+// ```
+// Next, we obtain a record from the stage, populate it, and stage it for
+// publication; note that the record is no longer accessible to the logging
+// thread after `stageRecord` is called:
+// ```
+    ball::ThresholdAggregate levels(0, 255, 0, 0);
+
+    for (int i = 0; i < 10; ++i) {
+        ball::Record *record = stage.getRecord();
+
+        record->fixedFields().setSeverity(ball::Severity::e_INFO);
+        record->fixedFields().setMessage("Hello, world!");
+
+        stage.stageRecord(record, &s_numDispatched, levels);
+    }
+// ```
+// Finally, we wait for all staged records to be dispatched, and stop the
+// publisher thread:
+// ```
+    stage.drain();
+    ASSERT(10 == s_numDispatched);
+
+    stage.stopPublicationThread();
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `stageRecord` AND `drain`
+        //
+        // Concerns:
+        // 1. Every staged record is dispatched exactly once, with the target
+        //    and levels supplied to `stageRecord`.
+        //
+        // 2. The records staged by a thread are dispatched in the order in
+        //    which they were staged.
+        //
+        // 3. When the publisher thread is running, records are dispatched by
+        //    the publisher thread, unless `drain` dispatches them first.
+        //
+        // 4. `drain` dispatches every record staged before the call.
+        //
+        // 5. A thread whose ring buffer is full waits for the publisher
+        //    thread rather than dropping records.
+        //
+        // 6. A record staged by the publisher thread (i.e., from within the
+        //    dispatch callback) is dispatched immediately.
+        //
+        // 7. The cache of a terminated thread is reused by a later thread.
+        //
+        // 8. The ring capacity is rounded up to a power of 2.
+        //
+        // Plan:
+        // 1. Using a stage with a small ring capacity, and its publisher
+        //    thread running, stage a large number of records from several
+        //    threads, each using its own target.  `drain` the stage, and
+        //    verify the total count, the targets and levels, the per-thread
+        //    order of the line numbers, and that no record was dispatched by
+        //    a producer thread.  (C-1..5)
+        //
+        // 2. Stage a record whose dispatch stages another record, and verify
+        //    both are dispatched.  (C-6)
+        //
+        // 3. Create and join threads that each stage a record, and verify the
+        //    memory allocated by the stage after the first such thread grows
+        //    by less than the size of a cache.  (C-7)
+        //
+        // 4. Verify `ringCapacity` for several construction arguments.  (C-8)
+        //
+        // Testing:
+        //   RecordStage(const DispatchCallback&, int, Allocator * = 0);
+        //   void drain();
+        //   void stageRecord(Record *, void *, const ThresholdAggregate&);
+        //   int ringCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING `stageRecord` AND `drain`"
+                          << endl << "=================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tConcurrent staging." << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 5000 };
+
+            u::Recorder recorder(true);
+            Obj         mX(u::makeCallback(&recorder), 4, &ta);
+            const Obj&  X = mX;
+
+            ASSERT(4 == X.ringCapacity());
+            ASSERT(0 == mX.startPublicationThread());
+
+            bslmt::Barrier            barrier(k_NUM_THREADS);
+            int                       targets[k_NUM_THREADS];
+            bsls::Types::Uint64       producerIds[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                 &handles[i],
+                                 bdlf::BindUtil::bind(&u::stageRecords,
+                                                      &mX,
+                                                      +k_NUM_RECORDS,
+                                                      &targets[i],
+                                                      &barrier),
+                                 &ta));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                producerIds[i] = bslmt::ThreadUtil::idAsUint64(
+                                bslmt::ThreadUtil::handleToId(handles[i]));
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            mX.drain();
+
+            const bsl::vector<u::Recorder::Dispatch>& D =
+                                                         recorder.dispatches();
+
+            ASSERTV(recorder.count(),
+                    k_NUM_THREADS * k_NUM_RECORDS == recorder.count());
+            ASSERT(k_NUM_THREADS * k_NUM_RECORDS == static_cast<int>(
+                                                                   D.size()));
+
+            int nextLine[k_NUM_THREADS] = { 0 };
+            for (bsl::size_t i = 0; i < D.size(); ++i) {
+                int t = 0;
+                while (t < k_NUM_THREADS && &targets[t] != D[i].d_target_p) {
+                    ++t;
+                }
+                ASSERTV(i, t < k_NUM_THREADS);
+                if (t == k_NUM_THREADS) {
+                    continue;
+                }
+                ASSERTV(i, t, nextLine[t], D[i].d_record->fixedFields()
+                                                               .lineNumber(),
+                        nextLine[t] ==
+                                  D[i].d_record->fixedFields().lineNumber());
+                ++nextLine[t];
+
+                ASSERT(ball::ThresholdAggregate(1, 2, 3, 4) == D[i].d_levels);
+                ASSERT(0 == bsl::strcmp("staged",
+                                      D[i].d_record->fixedFields().message()));
+
+                for (int p = 0; p < k_NUM_THREADS; ++p) {
+                    ASSERTV(i, p, producerIds[p] != D[i].d_threadId);
+                }
+            }
+
+            recorder.reset();
+            ASSERT(0 == mX.stopPublicationThread());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tStaging from the publisher thread." << endl;
+        {
+            bsls::AtomicInt count(0);
+
+            Obj mX(bdlf::BindUtil::bind(&u::reentrantDispatch,
+                                        &count,
+                                        bdlf::PlaceHolders::_1,
+                                        bdlf::PlaceHolders::_2,
+                                        bdlf::PlaceHolders::_3),
+                   &ta);
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            u::stageOne(&mX, &mX);
+
+            while (2 > count) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            ASSERT(2 == count);
+
+            // Staging with the publisher thread stopped dispatches on this
+            // thread.
+
+            ASSERT(0 == mX.stopPublicationThread());
+
+            u::stageOne(&mX, &mX);
+            ASSERT(4 == count);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tCache reuse across threads." << endl;
+        {
+            // A cache holds a ring buffer of 4096 entries, each larger than
+            // 8 bytes, so creating a cache allocates more than 32K bytes.
+            // Note that the first use of a record allocates its message
+            // buffer, which accounts for a small growth on each iteration.
+
+            enum { k_RING_CAPACITY = 4096, k_CACHE_SIZE = 8 * 4096 };
+
+            u::Recorder recorder(false);
+            Obj         mX(u::makeCallback(&recorder), k_RING_CAPACITY, &ta);
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            // Make sure this thread and the publisher thread have claimed
+            // their caches before measuring.
+
+            u::stageOne(&mX, 0);
+            while (1 > recorder.count()) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+
+            bsls::Types::Int64 numBytes = 0;
+            for (int i = 0; i < 10; ++i) {
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                      &handle,
+                                      bdlf::BindUtil::bind(&u::stageOne,
+                                                           &mX,
+                                                           (void *)0),
+                                      &ta));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                mX.drain();
+
+                if (0 == i) {
+                    numBytes = ta.numBytesInUse();
+                }
+            }
+            ASSERTV(numBytes, ta.numBytesInUse(),
+                    ta.numBytesInUse() - numBytes < k_CACHE_SIZE);
+            ASSERT(11 == recorder.count());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tRing capacity." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_capacity;
+                int d_expected;
+            } DATA[] = {
+                { L_,    1,    1 },
+                { L_,    2,    2 },
+                { L_,    3,    4 },
+                { L_,  100,  128 },
+                { L_, 1024, 1024 },
+                { L_, 1025, 2048 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            u::Recorder recorder(false);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int CAPACITY = DATA[ti].d_capacity;
+                const int EXPECTED = DATA[ti].d_expected;
+
+                Obj mX(u::makeCallback(&recorder), CAPACITY, &ta);
+                ASSERTV(LINE, EXPECTED == mX.ringCapacity());
+            }
+
+            Obj mX(u::makeCallback(&recorder), &ta);
+            ASSERT(Obj::k_DEFAULT_RING_CAPACITY == mX.ringCapacity());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            u::Recorder recorder(false);
+
+            ASSERT_PASS(Obj(u::makeCallback(&recorder), 1, &ta));
+            ASSERT_FAIL(Obj(u::makeCallback(&recorder), 0, &ta));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `getRecord` AND `discardRecord`
+        //
+        // Concerns:
+        // 1. `getRecord` returns a record having default field values.
+        //
+        // 2. A discarded record is reused by `getRecord`.
+        //
+        // 3. A dispatched record is returned to its cache when the last
+        //    reference to it is released, and is cleared.
+        //
+        // 4. Once records are recycled, `getRecord` and `stageRecord` do not
+        //    allocate memory.
+        //
+        // 5. All memory is supplied by the allocator supplied at
+        //    construction, and is released on destruction.
+        //
+        // Plan:
+        // 1. Obtain a record, verify its fields, populate it, and discard it;
+        //    verify the next record obtained has the same address and no
+        //    message.  (C-1..2)
+        //
+        // 2. Stage and dispatch more records than fit in one batch, release
+        //    them, and verify the records are reused and cleared.  (C-3)
+        //
+        // 3. Repeatedly obtain and stage records (without a publisher
+        //    thread, so that each record is released before the next is
+        //    obtained) and verify the allocator supplied at construction is
+        //    not used once the stage is warm, and that the default allocator
+        //    is never used.  (C-4..5)
+        //
+        // Testing:
+        //   Record *getRecord();
+        //   void discardRecord(Record *record);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING `getRecord` AND `discardRecord`"
+                          << endl << "======================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            u::Recorder recorder(true);
+            Obj         mX(u::makeCallback(&recorder), &ta);
+
+            if (verbose) cout << "\tDiscarding." << endl;
+
+            ball::Record *record = mX.getRecord();
+            ASSERT(record);
+            ASSERT(0 == record->fixedFields().messageRef().length());
+            ASSERT(0 == record->customFields().length());
+            ASSERT(0 == record->attributes().size());
+
+            record->fixedFields().setMessage("discarded");
+            mX.discardRecord(record);
+
+            ball::Record *again = mX.getRecord();
+            ASSERT(record == again);
+            ASSERT(0 == again->fixedFields().messageRef().length());
+            mX.discardRecord(again);
+
+            if (verbose) cout << "\tRecycling." << endl;
+
+            enum { k_NUM_RECORDS = 100 };
+
+            bsl::vector<ball::Record *> addresses;
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                ball::Record *record = mX.getRecord();
+                record->fixedFields().setMessage("recycled");
+                addresses.push_back(record);
+                mX.stageRecord(record, 0, ball::ThresholdAggregate());
+            }
+            ASSERT(k_NUM_RECORDS == recorder.count());
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                ASSERTV(i, recorder.dispatches()[i].d_record.get() ==
+                                                                addresses[i]);
+                ASSERTV(i, 1 == recorder.dispatches()[i].d_record.use_count());
+            }
+            recorder.reset();
+
+            // The free list of this thread is used up first, then the
+            // released records are taken back from the return stack.
+
+            bsl::sort(addresses.begin(), addresses.end());
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            bsl::vector<ball::Record *> obtained;
+            int                         numRecycled = 0;
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                ball::Record *record = mX.getRecord();
+                if (bsl::binary_search(addresses.begin(),
+                                       addresses.end(),
+                                       record)) {
+                    ++numRecycled;
+                }
+                ASSERTV(i, 0 == record->fixedFields().messageRef().length());
+                obtained.push_back(record);
+            }
+            ASSERTV(numRecycled, 0 < numRecycled);
+            ASSERT(numAllocations == ta.numAllocations());
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mX.discardRecord(obtained[i]);
+            }
+
+            if (verbose) cout << "\tSteady state allocation." << endl;
+
+            // The publisher thread is not started, so that each record is
+            // released before the next one is obtained.
+
+            u::Recorder counter(false);
+            Obj         mY(u::makeCallback(&counter), &ta);
+
+            for (int pass = 0; pass < 3; ++pass) {
+                const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+                for (int i = 0; i < 1000; ++i) {
+                    ball::Record *record = mY.getRecord();
+                    record->fixedFields().setMessage("steady");
+                    mY.stageRecord(record, 0, ball::ThresholdAggregate());
+                }
+                mY.drain();
+
+                if (0 < pass) {
+                    ASSERTV(pass, numAllocations, ta.numAllocations(),
+                            numAllocations == ta.numAllocations());
+                }
+            }
+            ASSERT(3000 == counter.count());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a stage, stage records with and without the publisher
+        //    thread running, and verify they are dispatched.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   RecordStage(const DispatchCallback&, Allocator * = 0);
+        //   ~RecordStage();
+        //   int startPublicationThread();
+        //   int stopPublicationThread();
+        //   bool isPublicationThreadRunning() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            u::Recorder recorder(true);
+            Obj         mX(u::makeCallback(&recorder), &ta);
+            const Obj&  X = mX;
+
+            ASSERT(&ta   == X.allocator());
+            ASSERT(false == X.isPublicationThreadRunning());
+
+            // Without a publisher thread, records are dispatched on the
+            // calling thread.
+
+            int target = 0;
+            u::stageOne(&mX, &target);
+            ASSERT(1 == recorder.count());
+            ASSERT(&target == recorder.dispatches()[0].d_target_p);
+            ASSERT(bslmt::ThreadUtil::selfIdAsUint64() ==
+                                       recorder.dispatches()[0].d_threadId);
+
+            ASSERT(0    == mX.startPublicationThread());
+            ASSERT(true == X.isPublicationThreadRunning());
+            ASSERT(0    == mX.startPublicationThread());
+
+            u::stageOne(&mX, &target);
+
+            while (2 > recorder.count()) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            ASSERT(bslmt::ThreadUtil::selfIdAsUint64() !=
+                                       recorder.dispatches()[1].d_threadId);
+
+            ASSERT(0     == mX.stopPublicationThread());
+            ASSERT(false == X.isPublicationThreadRunning());
+            ASSERT(0     == mX.stopPublicationThread());
+
+            recorder.reset();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        // Records staged and not yet dispatched when the stage is destroyed
+        // are dispatched by the destructor.
+
+        {
+            u::Recorder recorder(false);
+            {
+                Obj mX(u::makeCallback(&recorder), &ta);
+                ASSERT(0 == mX.startPublicationThread());
+
+                for (int i = 0; i < 100; ++i) {
+                    u::stageOne(&mX, 0);
+                }
+            }
+            ASSERT(100 == recorder.count());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
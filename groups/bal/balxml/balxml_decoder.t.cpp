@@ -20,6 +20,8 @@
 #include <balxml_minireader.h>
 
 #include <s_baltst_address.h>
+#include <s_baltst_basicrecord.h>
+#include <s_baltst_bigrecord.h>
 #include <s_baltst_customint.h>
 #include <s_baltst_customstring.h>
 #include <s_baltst_customizedbase64binary.h>
@@ -109,6 +111,7 @@
 #include <bsls_keyword.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstddef.h>
 #include <bsl_fstream.h>
@@ -211,6 +214,7 @@ namespace Test = s_baltst;
 // [-1] TESTING VALID & INVALID UTF-8: e_STREAMBUF
 // [-1] TESTING VALID & INVALID UTF-8: e_ISTREAM
 // [-1] TESTING VALID & INVALID UTF-8: e_FILE
+// [-2] PERFORMANCE TEST: DECODING LARGE DOCUMENTS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -17649,6 +17653,94 @@ int main(int argc, char *argv[])
 
         TC::validAndInvalidUtf8Test(TC::e_FILE, true);
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DECODING LARGE DOCUMENTS
+        //   Measure the throughput of decoding a large document from a stream
+        //   buffer using `balxml::Decoder` and `balxml::MiniReader`.
+        //
+        // Plan:
+        // 1. Generate an indented document holding a `BigRecord` whose array
+        //    has a large number of `BasicRecord` elements, each having a
+        //    long string value, one in four of which contains entity
+        //    references.
+        //
+        // 2. Decode the document repeatedly from a
+        //    `bdlsb::FixedMemInStreamBuf`, verify the decoded value, and
+        //    report the elapsed time and throughput.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: DECODING LARGE DOCUMENTS
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE TEST: DECODING LARGE DOCUMENTS\n"
+                "==========================================\n";
+
+        const int reps      = argc > 2 ? bsl::atoi(argv[2]) : 20;
+        const int arraySize = argc > 3 ? bsl::atoi(argv[3]) : 20000;
+        const int textSize  = argc > 4 ? bsl::atoi(argv[4]) : 400;
+
+        const bsl::string plain(textSize, 'x');
+        const bsl::string escaped = plain + " &lt;&amp;&gt; " + plain;
+
+        Test::BigRecord expected;
+        expected.name() = "This record is so big, it has its own gravity.";
+
+        bsl::ostringstream oss;
+        oss << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+               "<BigRecord"
+               " xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\">\n"
+               "  <name>" << expected.name() << "</name>\n";
+
+        for (int i = 0; i < arraySize; ++i) {
+            const bool hasEntities = 0 == i % 4;
+
+            Test::BasicRecord record;
+            record.i1() = i;
+            record.i2() = -i;
+            record.dt() = bdlt::DatetimeTz(
+                                  bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                 bdlt::Time(16, 30)), 0);
+            record.s()  = hasEntities ? plain + " <&> " + plain : plain;
+            expected.array().push_back(record);
+
+            oss << "  <array>\n"
+                   "    <i1>" << i << "</i1>\n"
+                   "    <i2>" << -i << "</i2>\n"
+                   "    <dt>2007-09-03T16:30:00.000+00:00</dt>\n"
+                   "    <s>" << (hasEntities ? escaped : plain) << "</s>\n"
+                   "  </array>\n";
+        }
+        oss << "</BigRecord>\n";
+
+        const bsl::string document = oss.str();
+
+        cout << "document of " << document.size() << " bytes, "
+             << arraySize << " records, " << reps << " repetitions\n";
+
+        bsls::Stopwatch stopwatch;
+        stopwatch.start();
+        for (int i = 0; i < reps; ++i) {
+            balxml::DecoderOptions options;
+            balxml::MiniReader     reader;
+            balxml::ErrorInfo      errInfo;
+            balxml::Decoder        decoder(&options, &reader, &errInfo);
+
+            bdlsb::FixedMemInStreamBuf isb(document.data(), document.size());
+
+            Test::BigRecord value;
+            ASSERTV(errInfo, 0 == decoder.decode(&isb, &value));
+            if (0 == i) {
+                ASSERT(expected == value);
+            }
+        }
+        stopwatch.stop();
+
+        const double elapsed = stopwatch.elapsedTime();
+        cout << "  balxml::Decoder: " << elapsed << " seconds, "
+             << static_cast<double>(document.size()) * reps / elapsed / 1e6
+             << " MB/s\n";
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -6,13 +6,29 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 
 #include <balxml_errorinfo.h>
 
+#include <bdlb_bitutil.h>
+
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>  // for 'swap'
 #include <bsl_cctype.h>
 #include <bsl_climits.h>
-#include <bsl_cstring.h>    // for 'strlen', 'strcspn', 'memcmp'
+#include <bsl_cstring.h>    // for 'strlen', 'memcmp'
+
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BALXML_MINIREADER_SIMD_ENABLED
+# define BALXML_MINIREADER_SSE2_TARGET __attribute__((target("sse2")))
+# define BALXML_MINIREADER_AVX2_TARGET __attribute__((target("avx2")))
+#endif
 
 // IMPLEMENTATION NOTES
 // --------------------
@@ -99,6 +115,17 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 //     v
 //    END
 //..
+//
+// The scanning primitives ('scanForSymbol', 'scanForSymbolOrSpace') search
+// the parse buffer for the first character of a small set using
+// 'findFirstOf', which compares 16 (SSE2) or 32 (AVX2) characters at a time
+// against every member of the set, the kernel being selected once, at run
+// time, according to the capabilities of the processor.  The null character
+// is always a member of the set, so that a search never goes past the null
+// terminator that 'readInput' places after the data in the buffer.  Text and
+// attribute values are left in the parse buffer; while scanning them the
+// reader notes whether an ampersand was seen, so that the in-place
+// replacement of character references is skipped for values that have none.
 
 namespace {
 
@@ -279,6 +306,177 @@ void replaceCharReferences(char *text)
 
 namespace BloombergLP  {
 
+namespace {
+
+/// This `struct` describes a set of characters searched for by
+/// `findFirstOf`.  The null character is always a member of the set.
+struct CharSet {
+
+    // PUBLIC TYPES
+    enum { k_MAX_SIZE = 8 };  // maximum number of members, including '\0'
+
+    // PUBLIC DATA
+    char                d_chars[k_MAX_SIZE];  // members, padded with '\0'
+    bsls::Types::Uint64 d_bits[4];            // membership bit map
+};
+
+/// Load into the specified `result` the set of characters consisting of the
+/// null character and the characters of the specified null-terminated
+/// `chars`.  The behavior is undefined unless `chars` has fewer than
+/// `CharSet::k_MAX_SIZE` characters.
+inline
+void makeCharSet(CharSet *result, const char *chars)
+{
+    bsl::memset(result, 0, sizeof *result);
+    result->d_bits[0] = 1;
+
+    for (int i = 1; *chars; ++i, ++chars) {
+        BSLS_ASSERT(i < CharSet::k_MAX_SIZE);
+
+        const unsigned char c = static_cast<unsigned char>(*chars);
+
+        result->d_chars[i]     = *chars;
+        result->d_bits[c >> 6] |= 1ULL << (c & 63);
+    }
+}
+
+/// Return the address of the first character in the specified range
+/// `[begin, end)` that is a member of the specified `set`, or `end` if there
+/// is no such character.
+const char *findFirstOfScalar(const char    *begin,
+                              const char    *end,
+                              const CharSet& set)
+{
+    for (; begin != end; ++begin) {
+        const unsigned char c = static_cast<unsigned char>(*begin);
+        if ((set.d_bits[c >> 6] >> (c & 63)) & 1) {
+            break;
+        }
+    }
+    return begin;
+}
+
+#if defined(BALXML_MINIREADER_SIMD_ENABLED)
+
+/// Return `true` if the running processor supports the SSE2 instructions,
+/// and `false` otherwise.
+bool detectSse2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+/// Return `true` if the running processor and operating system support the
+/// AVX2 instructions, and `false` otherwise.
+bool detectAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+/// Return the address of the first character in the specified range
+/// `[begin, end)` that is a member of the specified `set`, or `end` if there
+/// is no such character.  This kernel examines 16 characters at a time.
+BALXML_MINIREADER_SSE2_TARGET
+const char *findFirstOfSse2(const char    *begin,
+                            const char    *end,
+                            const CharSet& set)
+{
+    __m128i members[CharSet::k_MAX_SIZE];
+    for (int i = 0; i < CharSet::k_MAX_SIZE; ++i) {
+        members[i] = _mm_set1_epi8(set.d_chars[i]);
+    }
+
+    for (; end - begin >= 16; begin += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(begin));
+
+        __m128i found = _mm_cmpeq_epi8(input, members[0]);
+        for (int i = 1; i < CharSet::k_MAX_SIZE; ++i) {
+            found = _mm_or_si128(found, _mm_cmpeq_epi8(input, members[i]));
+        }
+
+        const int mask = _mm_movemask_epi8(found);
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(
+                                     static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+    }
+
+    return findFirstOfScalar(begin, end, set);
+}
+
+/// Return the address of the first character in the specified range
+/// `[begin, end)` that is a member of the specified `set`, or `end` if there
+/// is no such character.  This kernel examines 32 characters at a time.
+BALXML_MINIREADER_AVX2_TARGET
+const char *findFirstOfAvx2(const char    *begin,
+                            const char    *end,
+                            const CharSet& set)
+{
+    __m256i members[CharSet::k_MAX_SIZE];
+    for (int i = 0; i < CharSet::k_MAX_SIZE; ++i) {
+        members[i] = _mm256_set1_epi8(set.d_chars[i]);
+    }
+
+    for (; end - begin >= 32; begin += 32) {
+        const __m256i input = _mm256_loadu_si256(
+                                     reinterpret_cast<const __m256i *>(begin));
+
+        __m256i found = _mm256_cmpeq_epi8(input, members[0]);
+        for (int i = 1; i < CharSet::k_MAX_SIZE; ++i) {
+            found = _mm256_or_si256(found,
+                                    _mm256_cmpeq_epi8(input, members[i]));
+        }
+
+        const int mask = _mm256_movemask_epi8(found);
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(
+                                     static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+    }
+
+    return findFirstOfSse2(begin, end, set);
+}
+
+#endif
+
+typedef const char *(*FindFirstOfFn)(const char *,
+                                     const char *,
+                                     const CharSet&);
+
+/// Return the fastest implementation of `findFirstOf` available on the
+/// running platform.
+FindFirstOfFn findFirstOfFunction()
+{
+    static FindFirstOfFn findFirstOfFn = 0;
+
+    BSLMT_ONCE_DO {
+#if defined(BALXML_MINIREADER_SIMD_ENABLED)
+        findFirstOfFn = detectAvx2() ? &findFirstOfAvx2
+                      : detectSse2() ? &findFirstOfSse2
+                      :                &findFirstOfScalar;
+#else
+        findFirstOfFn = &findFirstOfScalar;
+#endif
+    }
+
+    return findFirstOfFn;
+}
+
+/// Return the address of the first character in the specified range
+/// `[begin, end)` that is a member of the specified `set`, or `end` if there
+/// is no such character.
+inline
+const char *findFirstOf(const char *begin, const char *end, const CharSet& set)
+{
+    return findFirstOfFunction()(begin, end, set);
+}
+
+}  // close unnamed namespace
+
                        // ------------------------------
                        // class balxml::MiniReader::Node
                        // ------------------------------
@@ -1293,9 +1491,11 @@ MiniReader::skipSpaces()
 {
     while (1) {
 
-        // skip SPACE, TAB, CR chars
-        size_t len = bsl::strspn(d_scanPtr, "\r\t ");
-        d_scanPtr +=len;
+        // skip SPACE, TAB, CR chars; runs of them are short, and the null
+        // terminator of the buffer stops the loop
+        while (' ' == *d_scanPtr || '\t' == *d_scanPtr || '\r' == *d_scanPtr) {
+            ++d_scanPtr;
+        }
 
         if (checkForNewLine()) {
             ++d_scanPtr;          //skip NL
@@ -1316,12 +1516,14 @@ MiniReader::skipSpaces()
 int
 MiniReader::scanForSymbol(char symbol)
 {
-    char strSet [] = { symbol, '\n', '\0' };
+    const char strSet[] = { symbol, '\n', '\0' };
+
+    CharSet set;
+    makeCharSet(&set, strSet);
 
     while (1) {
         // find 'symbol' or NL
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(findFirstOf(d_scanPtr, d_endPtr, set));
 
         if (symbol == *d_scanPtr) {
             return symbol;                                            // RETURN
@@ -1344,15 +1546,61 @@ MiniReader::scanForSymbol(char symbol)
     return *d_scanPtr;
 }
 
+int
+MiniReader::scanForSymbol(char symbol, bool *hasReference)
+{
+    BSLS_ASSERT(hasReference);
+    BSLS_ASSERT('&' != symbol);
+
+    const char strSet[] = { symbol, '\n', '&', '\0' };
+
+    CharSet set;
+    makeCharSet(&set, strSet);
+
+    *hasReference = false;
+
+    while (1) {
+        // find 'symbol', NL, or '&'
+        d_scanPtr = const_cast<char *>(findFirstOf(d_scanPtr, d_endPtr, set));
+
+        if (symbol == *d_scanPtr) {
+            return symbol;                                            // RETURN
+        }
+
+        if ('&' == *d_scanPtr) {
+            *hasReference = true;
+            ++d_scanPtr;        //skip '&'
+            continue;
+        }
+
+        if (checkForNewLine()) {
+            ++d_scanPtr;        //skip NL
+            continue;
+        }
+
+        if (d_scanPtr < d_endPtr) {
+            break;
+        }
+
+        if (readInput() == 0) {
+            return 0;                                                 // RETURN
+        }
+    }
+
+    return *d_scanPtr;
+}
+
 int
 MiniReader::scanForSymbolOrSpace(char symbol)
 {
-    char strSet[] = { symbol, '\n', '\r', '\t', ' ', '\0' };
+    const char strSet[] = { symbol, '\n', '\r', '\t', ' ', '\0' };
+
+    CharSet set;
+    makeCharSet(&set, strSet);
 
     while (1) {
         // find 'symbol' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(findFirstOf(d_scanPtr, d_endPtr, set));
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1368,14 +1616,16 @@ MiniReader::scanForSymbolOrSpace(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol1, char symbol2)
 {
-    char strSet [] = {
+    const char strSet[] = {
         symbol1, symbol2,  '\n', '\r', '\t', ' ', '\0'
     };
 
+    CharSet set;
+    makeCharSet(&set, strSet);
+
     while (1) {
         // find 'symbol1' or 'symbol2' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(findFirstOf(d_scanPtr, d_endPtr, set));
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1534,7 +1784,8 @@ MiniReader::scanText()
         return 0;                                                     // RETURN
     }
 
-    ch = scanForSymbol('<');
+    bool hasReference;
+    ch = scanForSymbol('<', &hasReference);
     if (ch == '<') {
 
         node.d_endPos = getCurrentPosition();
@@ -1545,7 +1796,9 @@ MiniReader::scanText()
         node.d_type = e_NODE_TYPE_TEXT;
         d_state = ST_TAG_BEGIN;
 
-        replaceCharReferences(const_cast<char *>(node.d_value));
+        if (hasReference) {
+            replaceCharReferences(const_cast<char *>(node.d_value));
+        }
         return 0;                                                     // RETURN
     }
 
@@ -1968,7 +2221,8 @@ MiniReader::scanAttributes()
         }
 
         d_attrValPtr = d_scanPtr;
-        int ch2 = scanForSymbol(static_cast<char>(ch));
+        bool hasReference;
+        int  ch2 = scanForSymbol(static_cast<char>(ch), &hasReference);
         if (ch2 != ch) {       // not the same delimiter
             return setParseError("Attribute value must end with ' or \"",
                                  0,
@@ -1978,6 +2232,10 @@ MiniReader::scanAttributes()
         // make attribute qualified name as C-string.
         getCharAndSet(0);
 
+        if (hasReference) {
+            replaceCharReferences(d_attrValPtr);
+        }
+
         rc = addAttribute();
 
         separator = peekChar(); // Get separator between attributes
@@ -2071,8 +2329,6 @@ MiniReader::addAttribute()
     const char *namespaceUri = "";
     int         namespaceId = INT_MIN;
 
-    replaceCharReferences(d_attrValPtr);
-
     char* colon = bsl::strchr(d_attrNamePtr, ':');
 
     if (colon == 0) {
@@ -528,6 +528,14 @@ class MiniReader :  public Reader {
     /// returned value is zero.
     int   scanForSymbol(char symbol);
 
+    /// Scan for the specified `symbol` and set the current position to the
+    /// found symbol, loading into the specified `hasReference` a flag
+    /// indicating whether an `&` character was passed over.  Return the
+    /// character at the new current position.  If the symbol is not found,
+    /// the current position is set to end and returned value is zero.  The
+    /// behavior is undefined unless `symbol` is not `&`.
+    int   scanForSymbol(char symbol, bool *hasReference);
+
     /// Scan one of the specified `symbol`, `symbol1`, or `symbol2`
     /// characters or any space character and set the current position to
     /// the found symbol.  Return the character at the new current position.
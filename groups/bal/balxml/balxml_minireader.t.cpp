@@ -77,26 +77,26 @@ using bsl::flush;
 //
 // [14] advanceToEndNodeRawBare()
 //
-// [18] MiniReader(basicAllocator)
-// [18] MiniReader(bufSize, basicAllocator)
-// [18] ~MiniReader()
-// [18] setPrefixStack(balxml::PrefixStack *prefixes)
-// [18] prefixStack()
-// [18] open()
-// [18] isOpen()
-// [18] documentEncoding()
-// [18] nodeType()
-// [18] nodeName()
-// [18] nodeHasValue()
-// [18] nodeValue()
-// [18] nodeDepth()
-// [18] numAttributes()
-// [18] isEmptyElement()
-// [18] advanceToNextNode()
-// [18] lookupAttribute(ElemAtt a, int index)
-// [18] lookupAttribute(ElemAtt a, char *qname)
-// [18] lookupAttribute(ElemAtt a, char *localname, char *nsUri)
-// [18] lookupAttribute(ElemAtt a, char *localname, int nsId)
+// [19] MiniReader(basicAllocator)
+// [19] MiniReader(bufSize, basicAllocator)
+// [19] ~MiniReader()
+// [19] setPrefixStack(balxml::PrefixStack *prefixes)
+// [19] prefixStack()
+// [19] open()
+// [19] isOpen()
+// [19] documentEncoding()
+// [19] nodeType()
+// [19] nodeName()
+// [19] nodeHasValue()
+// [19] nodeValue()
+// [19] nodeDepth()
+// [19] numAttributes()
+// [19] isEmptyElement()
+// [19] advanceToNextNode()
+// [19] lookupAttribute(ElemAtt a, int index)
+// [19] lookupAttribute(ElemAtt a, char *qname)
+// [19] lookupAttribute(ElemAtt a, char *localname, char *nsUri)
+// [19] lookupAttribute(ElemAtt a, char *localname, int nsId)
 // [15] getCurrentPosition();
 // [15] ErrorInfo::lineNumber();
 // [15] ErrorInfo::columnNumber();
@@ -106,7 +106,8 @@ using bsl::flush;
 // [15] UNEXPECTED EOF TEST
 // [16] FUZZ TEST
 // [17] BOM Handling
-// [18] USAGE EXAMPLE
+// [18] LONG TEXT AND ATTRIBUTE VALUES
+// [19] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1057,7 +1058,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1101,6 +1102,151 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case 18: {
+        // --------------------------------------------------------------------
+        // LONG TEXT AND ATTRIBUTE VALUES
+        //
+        // Concerns:
+        // 1. Text and attribute values of any length, in particular lengths
+        //    around and well beyond the 16- and 32-character blocks examined
+        //    by the vectorized scanning, are returned intact.
+        //
+        // 2. Character references anywhere in a value, including its first
+        //    and last characters, are replaced, and values without character
+        //    references are returned unchanged.
+        //
+        // 3. Other markup delimiters allowed within a value (`>` in text,
+        //    `"` in an attribute value delimited by `'`) do not terminate
+        //    the value.
+        //
+        // 4. Newlines within values are counted in the line number.
+        //
+        // 5. Values spanning the boundary of the input buffer are read
+        //    correctly when the input is read from a stream.
+        //
+        // Plan:
+        // 1. For a set of value lengths, and for each of several placements
+        //    of character references, generate a document having an element
+        //    with an attribute value and a text value of that length, and a
+        //    child element following the text.  (C-1..4)
+        //
+        // 2. Parse each document from memory and from a `streambuf`, using a
+        //    reader having the minimum buffer size (1 KB), and verify the
+        //    values and the line number of the child element.  (C-1..5)
+        //
+        // Testing:
+        //   LONG TEXT AND ATTRIBUTE VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nLONG TEXT AND ATTRIBUTE VALUES"
+                               << "\n==============================\n";
+
+        static const int LENGTHS[] = {
+            1, 2, 15, 16, 17, 31, 32, 33, 47, 63, 64, 65, 100, 1000, 1023,
+            1024, 1025, 3000
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        enum RefPlacement { e_NONE, e_FIRST, e_LAST, e_EVERY_40, e_END };
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+        for (int ri = e_NONE; ri < e_END; ++ri) {
+            const int LENGTH = LENGTHS[li];
+
+            if (veryVerbose) { T_ P_(LENGTH) P(ri) }
+
+            // Generate `LENGTH` value characters for both the text and the
+            // attribute value, each of which is either a plain character, a
+            // newline, another delimiter, or a character reference.
+
+            bsl::string textRaw,  textExp;
+            bsl::string attrRaw,  attrExp;
+            int         numNewlines = 0;
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const bool isRef = (e_FIRST    == ri && 0 == i)
+                                || (e_LAST     == ri && LENGTH - 1 == i)
+                                || (e_EVERY_40 == ri && 39 == i % 40);
+
+                if (isRef) {
+                    textRaw += "&lt;";    textExp += '<';
+                    attrRaw += "&amp;";   attrExp += '&';
+                }
+                else if (0 < i && i < LENGTH - 1 && 36 == i % 37) {
+                    textRaw += '\n';      textExp += '\n';
+                    attrRaw += '\n';      attrExp += '\n';
+                    numNewlines += 2;
+                }
+                else if (0 < i && 52 == i % 53) {
+                    textRaw += '>';       textExp += '>';
+                    attrRaw += '"';       attrExp += '"';
+                }
+                else {
+                    const char ch = static_cast<char>('a' + i % 26);
+                    textRaw += ch;        textExp += ch;
+                    attrRaw += ch;        attrExp += ch;
+                }
+            }
+
+            const bsl::string xml = "<?xml version='1.0' encoding='UTF-8'?>\n"
+                                    "<root a='" + attrRaw + "'>" +
+                                    textRaw +
+                                    "<child/></root>\n";
+
+            for (int mode = 0; mode < 2; ++mode) {
+                bdlsb::FixedMemInStreamBuf sb(xml.data(), xml.length());
+
+                Obj mX(1024);  Obj& reader = mX;
+
+                int rc = 0 == mode ? reader.open(xml.data(), xml.length())
+                                   : reader.open(&sb);
+                ASSERTV(LENGTH, ri, mode, 0 == rc);
+
+                // <?xml ... ?>
+
+                rc = reader.advanceToNextNode();
+                ASSERTV(LENGTH, ri, mode, rc, 0 == rc);
+
+                do {
+                    rc = reader.advanceToNextNode();
+                } while (0 == rc
+                      && balxml::Reader::e_NODE_TYPE_ELEMENT !=
+                                                          reader.nodeType());
+                ASSERTV(LENGTH, ri, mode, rc, 0 == rc);
+                ASSERTV(LENGTH, ri, mode,
+                        bsl::string("root") == reader.nodeName());
+                ASSERTV(LENGTH, ri, mode, 1 == reader.numAttributes());
+
+                balxml::ElementAttribute attr;
+                rc = reader.lookupAttribute(&attr, 0);
+                ASSERTV(LENGTH, ri, mode, rc, 0 == rc);
+                ASSERTV(LENGTH, ri, mode, attrExp == attr.value());
+
+                rc = reader.advanceToNextNode();
+                ASSERTV(LENGTH, ri, mode, rc, 0 == rc);
+                ASSERTV(LENGTH, ri, mode, reader.nodeType(),
+                        balxml::Reader::e_NODE_TYPE_TEXT == reader.nodeType());
+                ASSERTV(LENGTH, ri, mode, textExp == reader.nodeValue());
+
+                rc = reader.advanceToNextNode();
+                ASSERTV(LENGTH, ri, mode, rc, 0 == rc);
+                ASSERTV(LENGTH, ri, mode,
+                        bsl::string("child") == reader.nodeName());
+                ASSERTV(LENGTH, ri, mode, numNewlines,
+                        reader.getLineNumber(),
+                        2 + numNewlines == reader.getLineNumber());
+
+                do {
+                    rc = reader.advanceToNextNode();
+                } while (0 == rc);
+                ASSERTV(LENGTH, ri, mode, rc, 1 == rc);
+
+                reader.close();
+            }
+        }
+        }
+      } break;
+
       case 17: {
         // --------------------------------------------------------------------
         // BOM TEST
@@ -25,6 +25,56 @@ BSLS_IDENT("$Id: $")
 // behaves logically as a single indexed buffer.  `bdlbb::InBlobStreamBuf` and
 // `bdlbb::OutBlobStreamBuf` can therefore respectively read from and write to
 // this buffer as if there were a single continuous index.
+//
+// `bdlbb::OutBlobStreamBuf` writes directly into the buffers of the blob,
+// copying each span passed to `sputn` with one `memcpy` per blob buffer, and
+// acquiring new buffers from the blob's factory as needed.  Formatting into a
+// blob through a `bdlsb::StreamBufOutputIterator` over an `OutBlobStreamBuf`
+// therefore avoids formatting into an intermediate string first.  Note that
+// the length of the blob is updated when the stream buffer is synchronized
+// (e.g., by `pubsync`) or destroyed.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting Directly into a Blob
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are building a wire message in a `bdlbb::Blob`, and want to
+// format a text payload into it without first formatting into a string.
+//
+// First, we create a blob that uses small buffers, so that the payload spans
+// several of them:
+// ```
+// bdlbb::SimpleBlobBufferFactory factory(16);
+// bdlbb::Blob                    blob(&factory);
+// ```
+// Then, we format the payload into the blob through an output iterator over an
+// `OutBlobStreamBuf`, and synchronize the stream buffer so that the length of
+// the blob reflects what was written:
+// ```
+// bdlbb::OutBlobStreamBuf streamBuf(&blob);
+//
+// bdlsb::StreamBufOutputIterator<bdlbb::OutBlobStreamBuf> it(&streamBuf);
+// it = bsl::format_to(it,
+//                     "{}: {} messages pending for {}",
+//                     "QUEUE-7",
+//                     1234,
+//                     "subscriber-42");
+// streamBuf.pubsync();
+// ```
+// Finally, we read the payload back and check it:
+// ```
+// assert(!it.failed());
+// assert(48 == blob.length());
+// assert( 3 == blob.numDataBuffers());
+//
+// bsl::string             payload(blob.length(), ' ');
+// bdlbb::InBlobStreamBuf  inStreamBuf(&blob);
+// inStreamBuf.sgetn(&payload[0], blob.length());
+//
+// assert("QUEUE-7: 1234 messages pending for subscriber-42" == payload);
+// ```
 
 #include <bdlscm_version.h>
 
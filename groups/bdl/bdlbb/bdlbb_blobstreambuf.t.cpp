@@ -2,6 +2,9 @@
 #include <bdlbb_blobstreambuf.h>
 
 #include <bdlbb_blob.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bdlsb_streambufoutputiterator.h>
 
 #include <bslim_testutil.h>
 
@@ -19,6 +22,7 @@
 #include <bsl_cctype.h>      // `isdigit` `isupper` `islower`
 #include <bsl_cstdlib.h>     // `atoi`
 #include <bsl_cstring.h>     // `memset`/memcmp()
+#include <bsl_format.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
@@ -53,6 +57,7 @@ using bsl::cerr;
 // FREE OPERATORS
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [ 9] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -182,6 +187,66 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Formatting Directly into a Blob
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are building a wire message in a `bdlbb::Blob`, and want to
+// format a text payload into it without first formatting into a string.
+//
+// First, we create a blob that uses small buffers, so that the payload spans
+// several of them:
+// ```
+        bdlbb::SimpleBlobBufferFactory factory(16);
+        bdlbb::Blob                    blob(&factory);
+// ```
+// Then, we format the payload into the blob through an output iterator over an
+// `OutBlobStreamBuf`, and synchronize the stream buffer so that the length of
+// the blob reflects what was written:
+// ```
+        bdlbb::OutBlobStreamBuf streamBuf(&blob);
+
+        bdlsb::StreamBufOutputIterator<bdlbb::OutBlobStreamBuf> it(&streamBuf);
+        it = bsl::format_to(it,
+                            "{}: {} messages pending for {}",
+                            "QUEUE-7",
+                            1234,
+                            "subscriber-42");
+        streamBuf.pubsync();
+// ```
+// Finally, we read the payload back and check it:
+// ```
+        ASSERT(!it.failed());
+        ASSERT(48 == blob.length());
+        ASSERT( 3 == blob.numDataBuffers());
+
+        bsl::string             payload(blob.length(), ' ');
+        bdlbb::InBlobStreamBuf  inStreamBuf(&blob);
+        inStreamBuf.sgetn(&payload[0], blob.length());
+
+        ASSERT("QUEUE-7: 1234 messages pending for subscriber-42" == payload);
+// ```
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING CONCERN: EOF IS STREAMED CORRECTLY
@@ -883,6 +883,97 @@ void BlobUtil::prependWithCapacityBuffer(Blob       *dest,
                        bslmf::MovableRefUtil::move(nextBuffer));
 }
 
+int BlobUtil::readFromFile(Blob                                 *dest,
+                           bdls::FilesystemUtil::FileDescriptor  descriptor,
+                           int                                   numBytes)
+{
+    BSLS_ASSERT(dest);
+    BSLS_ASSERT(0 <= numBytes);
+
+    typedef bdls::FilesystemUtil::IoBuffer IoBuffer;
+    typedef bdls::FilesystemUtil::Offset   Offset;
+
+    enum { k_MAX_IO_BUFFERS = 64 };  // buffers transferred per call
+
+    IoBuffer ioBuffers[k_MAX_IO_BUFFERS];
+
+    dest->setLength(numBytes);
+
+    const int numDataBuffers = dest->numDataBuffers();
+
+    int total = 0;
+    for (int index = 0; index < numDataBuffers;) {
+        int    numIoBuffers = 0;
+        Offset length       = 0;
+        for (; index < numDataBuffers && numIoBuffers < k_MAX_IO_BUFFERS;
+             ++index, ++numIoBuffers) {
+            IoBuffer& ioBuffer = ioBuffers[numIoBuffers];
+
+            ioBuffer.d_buffer_p = dest->buffer(index).data();
+            ioBuffer.d_length   = index == numDataBuffers - 1
+                                ? dest->lastDataBufferLength()
+                                : dest->buffer(index).size();
+            length += ioBuffer.d_length;
+        }
+
+        const Offset rc = bdls::FilesystemUtil::readv(descriptor,
+                                                      ioBuffers,
+                                                      numIoBuffers);
+        if (rc < 0) {
+            if (0 == total) {
+                dest->setLength(0);
+                return -1;                                            // RETURN
+            }
+            break;
+        }
+
+        total += static_cast<int>(rc);
+
+        if (rc < length) {
+            break;
+        }
+    }
+
+    dest->setLength(total);
+    return total;
+}
+
+int BlobUtil::writeToFile(bdls::FilesystemUtil::FileDescriptor  descriptor,
+                          const Blob&                           source)
+{
+    typedef bdls::FilesystemUtil::IoBuffer IoBuffer;
+    typedef bdls::FilesystemUtil::Offset   Offset;
+
+    enum { k_MAX_IO_BUFFERS = 64 };  // buffers transferred per call
+
+    IoBuffer ioBuffers[k_MAX_IO_BUFFERS];
+
+    const int numDataBuffers = source.numDataBuffers();
+
+    for (int index = 0; index < numDataBuffers;) {
+        int    numIoBuffers = 0;
+        Offset length       = 0;
+        for (; index < numDataBuffers && numIoBuffers < k_MAX_IO_BUFFERS;
+             ++index, ++numIoBuffers) {
+            IoBuffer& ioBuffer = ioBuffers[numIoBuffers];
+
+            ioBuffer.d_buffer_p = source.buffer(index).data();
+            ioBuffer.d_length   = index == numDataBuffers - 1
+                                ? source.lastDataBufferLength()
+                                : source.buffer(index).size();
+            length += ioBuffer.d_length;
+        }
+
+        if (length != bdls::FilesystemUtil::writev(descriptor,
+                                                   ioBuffers,
+                                                   numIoBuffers)) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    return 0;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -17,11 +17,18 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This `struct` provides a variety of utilities for `bdlbb::Blob`
 // objects, `bdlbb::BlobUtil`, such as I/O functions, comparison functions, and
 // streaming functions.
+//
+// The `readFromFile` and `writeToFile` functions transfer the data of a blob
+// to or from a file using the vectored I/O of `bdls::FilesystemUtil`, so that
+// a blob consisting of many buffers is transferred in a few system calls,
+// without first copying its data into a contiguous buffer.
 
 #include <bdlscm_version.h>
 
 #include <bdlbb_blob.h>
 
+#include <bdls_filesystemutil.h>
+
 #include <bslma_allocator.h>
 
 #include <bsls_assert.h>
@@ -263,6 +270,20 @@ struct BlobUtil {
                                           const char *source,
                                           int         length);
 
+    /// Read up to the specified `numBytes` bytes, beginning at the file
+    /// pointer of the file with the specified `descriptor`, and load them
+    /// into the specified `dest`, replacing its data, using as few vectored
+    /// reads as the buffers of `dest` allow.  Return the number of bytes
+    /// read, which is less than `numBytes` only if the end of the file was
+    /// reached or an error occurred after some bytes were read, or a
+    /// negative value if an error occurred before any bytes were read.  On
+    /// return, the length of `dest` is the number of bytes read (0 on
+    /// error).  The behavior is undefined unless `0 <= numBytes`, and
+    /// `dest` has a blob buffer factory or sufficient capacity.
+    static int readFromFile(Blob                                 *dest,
+                            bdls::FilesystemUtil::FileDescriptor  descriptor,
+                            int                                   numBytes);
+
     /// Read the specified `numBytes` from the specified `stream` and load
     /// it into the specified `dest`, and return a reference to the
     /// modifiable `stream`.
@@ -285,6 +306,14 @@ struct BlobUtil {
                      int         sourcePosition,
                      int         numBytes);
 
+    /// Write the data of the specified `source` to the file with the
+    /// specified `descriptor`, beginning at its file pointer, using as few
+    /// vectored writes as the buffers of `source` allow.  Return 0 on
+    /// success, and a non-zero value otherwise.  Note that, on failure, an
+    /// unspecified prefix of the data of `source` may have been written.
+    static int writeToFile(bdls::FilesystemUtil::FileDescriptor  descriptor,
+                           const Blob&                           source);
+
     /// Compare, lexicographically, the data (data length and character data
     /// values at each index position) stored by the specified `a` and `b`
     /// blobs.  Return 0 if the data stored by `a` is lexicographically
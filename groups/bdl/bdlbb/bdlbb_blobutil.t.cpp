@@ -4,6 +4,7 @@
 #include <bdlbb_blob.h>
 #include <bdlbb_simpleblobbufferfactory.h>
 
+#include <bdls_filesystemutil.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
 #include <bslim_testutil.h>
@@ -18,6 +19,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_keyword.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>     // `INT_MIN`
@@ -35,6 +37,8 @@ using namespace bsl;
 //=============================================================================
 //                                  TEST PLAN
 //-----------------------------------------------------------------------------
+// [20] int readFromFile(Blob *, FileDescriptor, int);
+// [20] int writeToFile(FileDescriptor, const Blob&);
 // [19] BlobUtilAsciiDumper(const Blob *blob);
 // [19] BlobUtilAsciiDumper(const Blob *blob, int length);
 // [19] BlobUtilAsciiDumper(const Blob *blob, int offset, int length);
@@ -69,6 +73,7 @@ using namespace bsl;
 // [ 1] Testing "write special cases"
 //-----------------------------------------------------------------------------
 // [11] CONCERN: append doesn't do excessive `reserveBufferCapacity`.
+// [-1] PERFORMANCE TEST: writeToFile
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -573,6 +578,141 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING `readFromFile` AND `writeToFile`
+        //
+        // Concerns:
+        // 1. `writeToFile` writes the data of the blob, in order, at the file
+        //    pointer, including the partial last data buffer, and not the
+        //    capacity beyond the length of the blob.
+        //
+        // 2. `writeToFile` handles blobs having more buffers than are
+        //    transferred in one call, and empty blobs.
+        //
+        // 3. `readFromFile` replaces the data of the blob with the bytes
+        //    read from the file pointer, and returns the number of bytes
+        //    read, setting the length of the blob accordingly when the end
+        //    of the file is reached.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For a set of buffer sizes and blob lengths, create a blob
+        //    having a pattern of data and some extra capacity, write it to a
+        //    temporary file with `writeToFile`, and verify the file size.
+        //    (C-1..2)
+        //
+        // 2. Read the file back with `readFromFile` into a blob having a
+        //    different buffer size, both with exactly the file size and
+        //    with more bytes than the file has, and verify the data.  (C-3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int readFromFile(Blob *, FileDescriptor, int);
+        //   int writeToFile(FileDescriptor, const Blob&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `readFromFile` AND `writeToFile`"
+                          << "\n========================================"
+                          << endl;
+
+        typedef bdls::FilesystemUtil FsUtil;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        bsl::string            fileName(&ta);
+        FsUtil::FileDescriptor fd = FsUtil::createTemporaryFile(
+                                                            &fileName,
+                                                            "bdlbb_blobutil");
+        ASSERT(FsUtil::k_INVALID_FD != fd);
+
+        static const int BUFFER_SIZES[] = { 1, 7, 64, 1000 };
+        static const int LENGTHS[]      = { 0, 1, 63, 64, 65, 500, 10000 };
+
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES /
+                                                         sizeof *BUFFER_SIZES;
+        const int NUM_LENGTHS      = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+        for (int li = 0; li < NUM_LENGTHS;      ++li) {
+            const int BUFFER_SIZE = BUFFER_SIZES[bi];
+            const int LENGTH      = LENGTHS[li];
+
+            if (veryVerbose) { T_ P_(BUFFER_SIZE) P(LENGTH) }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+            bdlbb::Blob                    source(&factory, &ta);
+
+            bsl::string data(&ta);
+            for (int i = 0; i < LENGTH; ++i) {
+                data.push_back(static_cast<char>(i * 7 + i / 256));
+            }
+
+            // Fill the capacity with 'x' before setting the length, so that
+            // writing capacity beyond the length would be detected.
+
+            source.setLength(LENGTH + BUFFER_SIZE);
+            for (int i = 0; i < source.numDataBuffers(); ++i) {
+                bsl::memset(source.buffer(i).data(),
+                            'x',
+                            source.buffer(i).size());
+            }
+            source.setLength(LENGTH);
+            if (LENGTH) {
+                bdlbb::BlobUtil::copy(&source, 0, data.data(), LENGTH);
+            }
+
+            ASSERT(0 == FsUtil::truncateFileSize(fd, 0));
+            ASSERT(0 == FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING));
+
+            int rc = bdlbb::BlobUtil::writeToFile(fd, source);
+            ASSERTV(BUFFER_SIZE, LENGTH, rc, 0 == rc);
+            ASSERTV(BUFFER_SIZE, LENGTH, LENGTH == FsUtil::getFileSize(fd));
+
+            for (int extra = 0; extra < 2; ++extra) {
+                const int NUM_BYTES = LENGTH + extra * 100;
+
+                bdlbb::SimpleBlobBufferFactory readFactory(BUFFER_SIZE * 3 + 1,
+                                                           &ta);
+                bdlbb::Blob                    dest(&readFactory, &ta);
+                bdlbb::BlobUtil::append(&dest, "previous", 8);
+
+                ASSERT(0 == FsUtil::seek(fd,
+                                         0,
+                                         FsUtil::e_SEEK_FROM_BEGINNING));
+
+                rc = bdlbb::BlobUtil::readFromFile(&dest, fd, NUM_BYTES);
+                ASSERTV(BUFFER_SIZE, LENGTH, extra, rc, LENGTH == rc);
+                ASSERTV(BUFFER_SIZE, LENGTH, extra, LENGTH == dest.length());
+
+                bsl::string result(LENGTH, '\0', &ta);
+                if (LENGTH) {
+                    bdlbb::BlobUtil::copy(&result[0], dest, 0, LENGTH);
+                }
+                ASSERTV(BUFFER_SIZE, LENGTH, extra, data == result);
+            }
+        }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(16, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            ASSERT_PASS(bdlbb::BlobUtil::readFromFile(&blob, fd, 0));
+            ASSERT_FAIL(bdlbb::BlobUtil::readFromFile(0, fd, 0));
+            ASSERT_FAIL(bdlbb::BlobUtil::readFromFile(&blob, fd, -1));
+        }
+
+        ASSERT(0 == FsUtil::close(fd));
+        ASSERT(0 == FsUtil::remove(fileName));
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // TESTING `BlobUtilAsciiDumper`
@@ -5247,6 +5387,72 @@ int main(int argc, char *argv[])
 
         if (verbose) cout << "\nEnd of Test." << endl;
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: writeToFile
+        //
+        // Concerns:
+        // 1. Writing a blob of many small buffers with `writeToFile` takes
+        //    fewer system calls, and less time, than writing each buffer
+        //    with `bdls::FilesystemUtil::write`.
+        //
+        // Plan:
+        // 1. Write a blob of the specified number of buffers of the specified
+        //    size to a temporary file, repeatedly, both ways, and report the
+        //    elapsed time of each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: writeToFile
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: writeToFile"
+                          << "\n=============================" << endl;
+
+        typedef bdls::FilesystemUtil FsUtil;
+
+        const int reps       = argc > 2 ? atoi(argv[2]) : 100;
+        const int numBuffers = argc > 3 ? atoi(argv[3]) : 4096;
+        const int bufferSize = argc > 4 ? atoi(argv[4]) : 256;
+
+        bdlbb::SimpleBlobBufferFactory factory(bufferSize);
+        bdlbb::Blob                    blob(&factory);
+        bdlbb::BlobUtil::append(&blob, numBuffers * bufferSize, 'a');
+
+        bsl::string            fileName;
+        FsUtil::FileDescriptor fd = FsUtil::createTemporaryFile(
+                                                            &fileName,
+                                                            "bdlbb_blobutil");
+        ASSERT(FsUtil::k_INVALID_FD != fd);
+
+        cout << "blob of " << blob.numDataBuffers() << " buffers of "
+             << bufferSize << " bytes, " << reps << " repetitions" << endl;
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < reps; ++i) {
+            FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+            for (int j = 0; j < blob.numDataBuffers(); ++j) {
+                FsUtil::write(fd, blob.buffer(j).data(), bufferSize);
+            }
+        }
+        timer.stop();
+        cout << "  FilesystemUtil::write per buffer: "
+             << timer.accumulatedWallTime() << " seconds" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < reps; ++i) {
+            FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+            ASSERT(0 == bdlbb::BlobUtil::writeToFile(fd, blob));
+        }
+        timer.stop();
+        cout << "  BlobUtil::writeToFile:            "
+             << timer.accumulatedWallTime() << " seconds" << endl;
+
+        ASSERT(0 == FsUtil::close(fd));
+        ASSERT(0 == FsUtil::remove(fileName));
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
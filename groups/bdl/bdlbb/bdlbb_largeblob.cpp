@@ -0,0 +1,404 @@
+// bdlbb_largeblob.cpp                                                -*-C++-*-
+#include <bdlbb_largeblob.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_largeblob_cpp, "$Id$ $CSID$")
+
+#include <bslalg_swaputil.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>    // INT_MAX
+#include <bsl_memory.h>
+
+// Note: on Windows -> WinDef.h:#define min(a,b) ...
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(min)
+#undef min
+#endif
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                              // ---------------
+                              // class LargeBlob
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+void LargeBlob::updateOffsets(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index <= numBuffers());
+
+    const int numBuffers = this->numBuffers();
+
+    d_offsets.resize(numBuffers + 1);
+    for (int i = index; i < numBuffers; ++i) {
+        d_offsets[i + 1] = d_offsets[i] + d_buffers[i].size();
+    }
+}
+
+// PRIVATE ACCESSORS
+int LargeBlob::bufferIndexAt(bsl::size_t position) const
+{
+    BSLS_ASSERT(position < totalSize());
+
+    // Find the first offset exceeding 'position'; the buffer holding
+    // 'position' is the one preceding it, which skips any empty buffers
+    // sharing its offset.
+
+    bsl::vector<bsl::size_t>::const_iterator it =
+               bsl::upper_bound(d_offsets.begin(), d_offsets.end(), position);
+
+    return static_cast<int>(it - d_offsets.begin()) - 1;
+}
+
+// CREATORS
+LargeBlob::LargeBlob(bslma::Allocator *basicAllocator)
+: d_buffers(basicAllocator)
+, d_offsets(1, 0, basicAllocator)
+, d_dataLength(0)
+, d_dataIndex(-1)
+, d_bufferFactory_p(0)
+{
+}
+
+LargeBlob::LargeBlob(BlobBufferFactory *factory,
+                     bslma::Allocator  *basicAllocator)
+: d_buffers(basicAllocator)
+, d_offsets(1, 0, basicAllocator)
+, d_dataLength(0)
+, d_dataIndex(-1)
+, d_bufferFactory_p(factory)
+{
+}
+
+LargeBlob::LargeBlob(const Blob& original, bslma::Allocator *basicAllocator)
+: d_buffers(basicAllocator)
+, d_offsets(1, 0, basicAllocator)
+, d_dataLength(original.length())
+, d_dataIndex(original.numDataBuffers() - 1)
+, d_bufferFactory_p(original.factory())
+{
+    const int numBuffers = original.numBuffers();
+
+    d_buffers.reserve(numBuffers);
+    for (int i = 0; i < numBuffers; ++i) {
+        d_buffers.push_back(original.buffer(i));
+    }
+    updateOffsets(0);
+}
+
+LargeBlob::LargeBlob(const LargeBlob&  original,
+                     bslma::Allocator *basicAllocator)
+: d_buffers(original.d_buffers, basicAllocator)
+, d_offsets(original.d_offsets, basicAllocator)
+, d_dataLength(original.d_dataLength)
+, d_dataIndex(original.d_dataIndex)
+, d_bufferFactory_p(original.d_bufferFactory_p)
+{
+}
+
+LargeBlob::~LargeBlob()
+{
+}
+
+// MANIPULATORS
+LargeBlob& LargeBlob::operator=(const LargeBlob& rhs)
+{
+    if (this != &rhs) {
+        LargeBlob(rhs, allocator()).swap(*this);
+    }
+    return *this;
+}
+
+void LargeBlob::appendDataBuffer(const BlobBuffer& buffer)
+{
+    BSLS_ASSERT(numBuffers() < INT_MAX);
+
+    // Trim the last data buffer so that the new buffer immediately follows
+    // the last data byte.  Note that this has no effect if the last data
+    // buffer is full, or if there is no data buffer.
+
+    trimLastDataBuffer();
+
+    const int index = d_dataIndex + 1;
+
+    d_buffers.insert(d_buffers.begin() + index, buffer);
+    d_dataIndex   = index;
+    d_dataLength += buffer.size();
+
+    if (index + 1 == numBuffers()) {
+        // Fast path: no capacity buffers follow the new data buffer.
+
+        d_offsets.push_back(d_offsets[index] + buffer.size());
+    }
+    else {
+        updateOffsets(index);
+    }
+}
+
+void LargeBlob::insertBuffer(int index, const BlobBuffer& buffer)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index <= numBuffers());
+    BSLS_ASSERT(numBuffers() < INT_MAX);
+
+    d_buffers.insert(d_buffers.begin() + index, buffer);
+    updateOffsets(index);
+
+    if (index <= d_dataIndex) {
+        d_dataLength += buffer.size();
+        ++d_dataIndex;
+    }
+}
+
+void LargeBlob::prependDataBuffer(const BlobBuffer& buffer)
+{
+    BSLS_ASSERT(numBuffers() < INT_MAX);
+
+    d_buffers.insert(d_buffers.begin(), buffer);
+    updateOffsets(0);
+
+    d_dataLength += buffer.size();
+    ++d_dataIndex;
+}
+
+void LargeBlob::removeAll()
+{
+    d_buffers.clear();
+    d_offsets.resize(1);
+    d_dataLength = 0;
+    d_dataIndex  = -1;
+}
+
+void LargeBlob::removeBuffers(int index, int numBuffers)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(0 <= numBuffers);
+    BSLS_ASSERT(index + numBuffers <= this->numBuffers());
+
+    if (0 == numBuffers) {
+        return;                                                       // RETURN
+    }
+
+    const int end = index + numBuffers;
+
+    if (index <= d_dataIndex) {
+        if (d_dataIndex < end) {
+            // The last data buffer is removed: the data now ends with the
+            // buffer preceding the removed range.
+
+            d_dataLength = d_offsets[index];
+            d_dataIndex  = index - 1;
+        }
+        else {
+            d_dataLength -= d_offsets[end] - d_offsets[index];
+            d_dataIndex  -= numBuffers;
+        }
+    }
+
+    d_buffers.erase(d_buffers.begin() + index, d_buffers.begin() + end);
+    updateOffsets(index);
+}
+
+void LargeBlob::removeUnusedBuffers()
+{
+    const int numDataBuffers = this->numDataBuffers();
+
+    d_buffers.erase(d_buffers.begin() + numDataBuffers, d_buffers.end());
+    d_offsets.resize(numDataBuffers + 1);
+}
+
+void LargeBlob::replaceDataBuffer(int index, const BlobBuffer& buffer)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index <= d_dataIndex);
+
+    if (index == d_dataIndex) {
+        d_dataLength = d_offsets[index] + buffer.size();
+    }
+    else {
+        d_dataLength = d_dataLength - d_buffers[index].size() + buffer.size();
+    }
+
+    d_buffers[index] = buffer;
+    updateOffsets(index);
+}
+
+void LargeBlob::setLength(bsl::size_t length)
+{
+    if (d_dataLength == length) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == length) {
+        d_dataLength = 0;
+        d_dataIndex  = -1;
+        return;                                                       // RETURN
+    }
+
+    while (totalSize() < length) {
+        BSLS_ASSERT(0 != d_bufferFactory_p);
+
+        BlobBuffer buffer;
+        d_bufferFactory_p->allocate(&buffer);
+        BSLS_ASSERT(0 < buffer.size());
+
+        appendBuffer(buffer);
+    }
+
+    if (0 <= d_dataIndex
+     && d_offsets[d_dataIndex] < length
+     && length <= d_offsets[d_dataIndex + 1]) {
+        // Fast path: the new length lies within the current last data buffer.
+
+        d_dataLength = length;
+        return;                                                       // RETURN
+    }
+
+    int index = bufferIndexAt(length - 1);
+
+    if (length < d_dataLength) {
+        // As with 'Blob', empty buffers immediately following the new end of
+        // the data remain data buffers when decreasing the length.
+
+        while (index + 1 < d_dataIndex && length == d_offsets[index + 2]) {
+            ++index;
+        }
+    }
+
+    d_dataIndex  = index;
+    d_dataLength = length;
+}
+
+void LargeBlob::swap(LargeBlob& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_buffers.swap(other.d_buffers);
+    d_offsets.swap(other.d_offsets);
+    bslalg::SwapUtil::swap(&d_dataLength, &other.d_dataLength);
+    bslalg::SwapUtil::swap(&d_dataIndex, &other.d_dataIndex);
+    bslalg::SwapUtil::swap(&d_bufferFactory_p, &other.d_bufferFactory_p);
+}
+
+BlobBuffer LargeBlob::trimLastDataBuffer()
+{
+    if (0 == d_dataLength) {
+        return BlobBuffer();                                          // RETURN
+    }
+
+    BlobBuffer& lastBuffer = d_buffers[d_dataIndex];
+    BlobBuffer  leftover   = lastBuffer.trim(lastDataBufferLength());
+
+    if (0 == leftover.size()) {
+        return leftover;                                              // RETURN
+    }
+
+    if (d_dataIndex + 1 == numBuffers()) {
+        d_offsets.back() = d_dataLength;
+    }
+    else {
+        updateOffsets(d_dataIndex);
+    }
+    return leftover;
+}
+
+// ACCESSORS
+void LargeBlob::appendDataTo(Blob        *dest,
+                             bsl::size_t  position,
+                             int          length) const
+{
+    BSLS_ASSERT(0 != dest);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= d_dataLength);
+    BSLS_ASSERT(static_cast<bsl::size_t>(length) <= d_dataLength - position);
+    BSLS_ASSERT(length <= INT_MAX - dest->length());
+
+    if (0 == length) {
+        return;                                                       // RETURN
+    }
+
+    bsl::pair<int, int> place  = findBufferIndexAndOffset(position);
+    int                 index  = place.first;
+    int                 offset = place.second;
+
+    dest->trimLastDataBuffer();
+    dest->removeUnusedBuffers();
+
+    {
+        const int lastIndex = bufferIndexAt(position + length - 1);
+        dest->reserveBufferCapacity(dest->numDataBuffers() +
+                                    (lastIndex - index) + 1);
+    }
+
+    int numBytesRemaining = length;
+
+    while (0 < numBytesRemaining) {
+        BSLS_ASSERT(index < numBuffers());
+
+        BlobBuffer src = d_buffers[index];
+
+        if (0 < offset) {
+            src.buffer().loadAlias(src.buffer(), src.data() + offset);
+            src.setSize(src.size() - offset);
+            offset = 0;
+        }
+
+        if (src.size() > numBytesRemaining) {
+            src.setSize(numBytesRemaining);
+        }
+
+        if (0 < src.size()) {
+            dest->appendDataBuffer(src);
+        }
+
+        ++index;
+        numBytesRemaining -= src.size();
+    }
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool bdlbb::operator==(const LargeBlob& lhs, const LargeBlob& rhs)
+{
+    return lhs.d_buffers    == rhs.d_buffers
+        && lhs.d_dataLength == rhs.d_dataLength
+        && lhs.d_dataIndex  == rhs.d_dataIndex;
+}
+
+// FREE FUNCTIONS
+void bdlbb::swap(LargeBlob& a, LargeBlob& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+    }
+    else {
+        LargeBlob tmpA(b, a.allocator());
+        LargeBlob tmpB(a, b.allocator());
+
+        a.swap(tmpA);
+        b.swap(tmpB);
+    }
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
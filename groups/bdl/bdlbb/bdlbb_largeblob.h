@@ -0,0 +1,517 @@
+// bdlbb_largeblob.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLBB_LARGEBLOB
+#define INCLUDED_BDLBB_LARGEBLOB
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an indexed set of buffers having a 64-bit data length.
+//
+//@CLASSES:
+//  bdlbb::LargeBlob: indexed sequence of buffers with `bsl::size_t` lengths
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_blobutil
+//
+//@DESCRIPTION: This component provides an indexed sequence
+// (`bdlbb::LargeBlob`) of `bdlbb::BlobBuffer` objects having the same
+// semantics as `bdlbb::Blob` (data buffers, capacity buffers, data length,
+// and growth through a `bdlbb::BlobBufferFactory`), except that the data
+// length and the total size of a `bdlbb::LargeBlob` are expressed as
+// `bsl::size_t` and are therefore not limited to `INT_MAX` bytes on 64-bit
+// platforms.  The size of each individual buffer is still an `int`, so the
+// buffers of a `bdlbb::LargeBlob` are interchangeable with those of a
+// `bdlbb::Blob`.
+//
+///Locating a Byte
+///---------------
+// In addition to the buffers themselves, a `bdlbb::LargeBlob` maintains the
+// offset of the first byte of each buffer.  The buffer holding any byte
+// position is located with a binary search over these offsets
+// (`findBufferIndexAndOffset`), in `O(log(numBuffers()))` time, whereas
+// `bdlbb::BlobUtil::findBufferIndexAndOffset` walks the buffers of a
+// `bdlbb::Blob` linearly.  This matters for large messages assembled from
+// thousands of buffers that are accessed at arbitrary positions.  The cost is
+// that inserting or removing a buffer, or changing the size of a buffer that
+// is not the last one, updates the offsets of all subsequent buffers.
+// Appending buffers remains an amortized constant time operation, and setting
+// the length takes at most logarithmic time (not counting the growth of the
+// blob).
+//
+///Interoperation with `bdlbb::Blob`
+///---------------------------------
+// A `bdlbb::LargeBlob` can be created from a `bdlbb::Blob`, sharing its
+// buffers.  Conversely, any range of the data of a `bdlbb::LargeBlob` holding
+// no more than `INT_MAX` bytes can be appended to a `bdlbb::Blob` with
+// `appendDataTo`, which aliases the underlying buffers rather than copying the
+// bytes.  Code operating on `bdlbb::Blob` can therefore process a large
+// message one window at a time.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Accessing a Large Message in Windows
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a message made of many small buffers, and we need to
+// hand selected fragments of it to code operating on `bdlbb::Blob`.
+//
+// First, we create a `bdlbb::LargeBlob` that uses a blob buffer factory and
+// set its length, which allocates the buffers:
+// ```
+// bdlbb::SimpleBlobBufferFactory factory(16);
+// bdlbb::LargeBlob               message(&factory);
+//
+// message.setLength(4000);
+// assert(4000 == message.length());
+// assert( 250 == message.numDataBuffers());
+// ```
+// Then, we fill the message with some data, one buffer at a time:
+// ```
+// for (int i = 0; i < message.numDataBuffers(); ++i) {
+//     const bdlbb::BlobBuffer& buffer = message.buffer(i);
+//     bsl::memset(buffer.data(), 'a' + i % 26, buffer.size());
+// }
+// ```
+// Next, we locate the buffer holding the byte at position 3000, which is
+// found by a binary search rather than a linear walk over the buffers:
+// ```
+// bsl::pair<int, int> place = message.findBufferIndexAndOffset(3000);
+// assert(187 == place.first);
+// assert(  8 == place.second);
+// assert('f' == message.buffer(place.first).data()[place.second]);
+// ```
+// Finally, we append a 100 byte fragment of the message, starting at the same
+// position, to a `bdlbb::Blob`.  The fragment shares the buffers of `message`
+// and no bytes are copied:
+// ```
+// bdlbb::Blob fragment;
+// message.appendDataTo(&fragment, 3000, 100);
+//
+// assert(100 == fragment.length());
+// assert(  7 == fragment.numDataBuffers());
+// assert('f' == fragment.buffer(0).data()[0]);
+// assert(message.buffer(place.first).data() + place.second ==
+//                                                 fragment.buffer(0).data());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                              // ===============
+                              // class LargeBlob
+                              // ===============
+
+/// `LargeBlob` is an in-core container for `BlobBuffer` objects whose data
+/// length and total size are not limited to `INT_MAX`.  This class is
+/// exception-neutral with no guarantee of rollback: if an exception is
+/// thrown during the invocation of a method on a pre-existing instance, the
+/// container is left in a valid state, but its value is undefined.  In no
+/// event is memory leaked.
+class LargeBlob {
+
+    // DATA
+    bsl::vector<BlobBuffer>   d_buffers;          // buffer sequence
+
+    bsl::vector<bsl::size_t>  d_offsets;          // offset of the first byte
+                                                  // of each buffer, followed
+                                                  // by the total size
+
+    bsl::size_t               d_dataLength;       // length (in bytes) of
+                                                  // user-managed data
+
+    int                       d_dataIndex;        // index of the last data
+                                                  // buffer, or -1 if the blob
+                                                  // has no data buffers
+
+    BlobBufferFactory        *d_bufferFactory_p;  // factory used to grow blob
+                                                  // (held)
+
+    // FRIENDS
+    friend bool operator==(const LargeBlob&, const LargeBlob&);
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Recompute the offsets of the buffers following the buffer at the
+    /// specified `index`, and the total size of this blob.  The behavior is
+    /// undefined unless `0 <= index <= numBuffers()` and the offset of the
+    /// buffer at `index` is correct.
+    void updateOffsets(int index);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the last buffer whose offset does not exceed the
+    /// specified `position`.  The behavior is undefined unless
+    /// `position < totalSize()`.
+    int bufferIndexAt(bsl::size_t position) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LargeBlob, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an empty blob having no factory to allocate blob buffers.
+    /// Since there is no factory, the behavior is undefined if the length
+    /// of the blob is set beyond the total size.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit LargeBlob(bslma::Allocator *basicAllocator = 0);
+
+    /// Create an empty blob using the specified `factory` to allocate blob
+    /// buffers.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.
+    explicit LargeBlob(BlobBufferFactory *factory,
+                       bslma::Allocator  *basicAllocator = 0);
+
+    /// Create a blob that holds the same buffers, and has the same length,
+    /// as the specified `original` blob, and that uses the factory of
+    /// `original` to allocate blob buffers.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit LargeBlob(const Blob&       original,
+                       bslma::Allocator *basicAllocator = 0);
+
+    /// Create a blob that holds the same buffers, has the same length, and
+    /// uses the same factory as the specified `original` blob.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    LargeBlob(const LargeBlob& original, bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this blob.
+    ~LargeBlob();
+
+    // MANIPULATORS
+
+    /// Assign to this blob the value of the specified `rhs` blob, and
+    /// return a reference to this modifiable blob.
+    LargeBlob& operator=(const LargeBlob& rhs);
+
+    /// Append the specified `buffer` after the last buffer of this blob.
+    /// The length of this blob is unaffected.  The behavior is undefined
+    /// unless the total number of buffers in the resulting blob does not
+    /// exceed `INT_MAX`.  Note that this operation is equivalent to
+    /// `insertBuffer(numBuffers(), buffer)`, but is more efficient.
+    void appendBuffer(const BlobBuffer& buffer);
+
+    /// Append the specified `buffer` after the last *data* buffer of this
+    /// blob; the last data buffer is trimmed, if necessary.  The length of
+    /// this blob is incremented by the size of `buffer`.  The behavior is
+    /// undefined unless the total number of buffers in the resulting blob
+    /// does not exceed `INT_MAX`.  Note that this operation is equivalent
+    /// to:
+    /// ```
+    /// const bsl::size_t n = length();
+    /// trimLastDataBuffer();
+    /// insertBuffer(numDataBuffers(), buffer);
+    /// setLength(n + buffer.size());
+    /// ```
+    /// but is more efficient.
+    void appendDataBuffer(const BlobBuffer& buffer);
+
+    /// Insert the specified `buffer` at the specified `index` in this blob.
+    /// Increment the length of this blob by the size of `buffer` if
+    /// `buffer` is inserted *before* the logical end of this blob.  The
+    /// length of this blob is unchanged if inserting at a position
+    /// following all data buffers (e.g., inserting into an empty blob or
+    /// inserting a buffer to increase capacity); in that case, the blob
+    /// length remains unchanged.  The behavior is undefined unless
+    /// `0 <= index <= numBuffers()` and the total number of buffers in the
+    /// resulting blob does not exceed `INT_MAX`.
+    void insertBuffer(int index, const BlobBuffer& buffer);
+
+    /// Insert the specified `buffer` before the beginning of this blob.
+    /// The length of this blob is incremented by the length of the
+    /// prepended buffer.  The behavior is undefined unless the total number
+    /// of buffers in the resulting blob does not exceed `INT_MAX`.  Note
+    /// that this operation is equivalent to:
+    /// ```
+    /// const bsl::size_t n = length();
+    /// insertBuffer(0, buffer);
+    /// setLength(n + buffer.size());
+    /// ```
+    /// but is more efficient.
+    void prependDataBuffer(const BlobBuffer& buffer);
+
+    /// Remove all blob buffers from this blob, and set its length to 0.
+    void removeAll();
+
+    /// Remove the buffer at the specified `index` from this blob.  If the
+    /// buffer at `index` contains data, decrement the length of this blob
+    /// by the number of data bytes contained in the removed buffer.  The
+    /// behavior is undefined unless `0 <= index < numBuffers()`.
+    void removeBuffer(int index);
+
+    /// Remove the specified `numBuffers` starting at the specified `index`
+    /// from this blob.  Buffers contributing data to this blob reduce its
+    /// length by the number of data bytes they contain.  The behavior is
+    /// undefined unless `0 <= index`, `0 <= numBuffers`, and
+    /// `index + numBuffers <= numBuffers()`.
+    void removeBuffers(int index, int numBuffers);
+
+    /// Remove any unused capacity buffers from this blob.  Note that this
+    /// method does not trim the last data buffer, and that the resulting
+    /// total size of the blob may thus be larger than its length.
+    void removeUnusedBuffers();
+
+    /// Replace the data buffer at the specified `index` with the specified
+    /// `buffer`.  The behavior is undefined unless
+    /// `0 <= index < numDataBuffers()`.  Note that the length of this blob
+    /// is adjusted by the difference in size between `buffer` and the
+    /// replaced buffer, or, if `index` is the last data buffer, the data
+    /// of this blob ends with the last byte of `buffer`.
+    void replaceDataBuffer(int index, const BlobBuffer& buffer);
+
+    /// Allocate sufficient capacity to store at least the specified
+    /// `numBuffers` buffers.  The behavior is undefined unless
+    /// `0 <= numBuffers`.  Note that this method does not change the length
+    /// of this blob or add any buffers to it.
+    void reserveBufferCapacity(int numBuffers);
+
+    /// Set the length of this blob to the specified `length` and, if
+    /// `length` is greater than its total size, grow this blob by appending
+    /// buffers allocated using this object's underlying
+    /// `BlobBufferFactory`.  The behavior is undefined if the new length
+    /// requires growing the blob and this blob has no underlying factory.
+    void setLength(bsl::size_t length);
+
+    /// Swap the contents of this blob with the specified `other` blob.
+    /// This method provides the no-throw exception-safety guarantee.  The
+    /// behavior is undefined unless this object was created with the same
+    /// allocator as `other`.
+    void swap(LargeBlob& other);
+
+    /// Set the size of the last data buffer to `lastDataBufferLength()`.
+    /// If there are no data buffers, or if the last data buffer is full
+    /// (i.e., its size is `lastDataBufferLength()`), then this method has
+    /// no effect.  Return the leftover of the trimmed buffer or default
+    /// constructed `BlobBuffer` if nothing to trim.  Note that the length
+    /// of the blob is unchanged, and that capacity buffers (i.e., of
+    /// indices `numDataBuffers()` and higher) are *not* removed.
+    BlobBuffer trimLastDataBuffer();
+
+    // ACCESSORS
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+
+    /// Append to the specified `dest` the specified `length` bytes of the
+    /// data of this blob starting at the specified `position`, trimming the
+    /// last data buffer of `dest` first if necessary.  The appended buffers
+    /// share (alias) the memory of the buffers of this blob; no bytes are
+    /// copied.  The behavior is undefined unless `0 <= length`,
+    /// `position + length <= this->length()`, and the length of `dest`
+    /// after the operation does not exceed `INT_MAX`.
+    void appendDataTo(Blob *dest, bsl::size_t position, int length) const;
+
+    /// Return a reference to the non-modifiable blob buffer at the
+    /// specified `index` in this blob.  The behavior is undefined unless
+    /// `0 <= index < numBuffers()`.
+    const BlobBuffer& buffer(int index) const;
+
+    /// Return the offset, in this blob, of the first byte of the buffer at
+    /// the specified `index`.  The behavior is undefined unless
+    /// `0 <= index <= numBuffers()`.  Note that `bufferOffset(numBuffers())`
+    /// is the total size of this blob.
+    bsl::size_t bufferOffset(int index) const;
+
+    /// Return the factory used by this object.
+    BlobBufferFactory *factory() const;
+
+    /// Return a pair of integers, the first being the index of the buffer
+    /// holding the byte at the specified `position` in this blob, and the
+    /// second being the offset of that byte within that buffer.  The
+    /// behavior is undefined unless `position < totalSize()`.  Note that
+    /// this operation takes time logarithmic in the number of buffers of
+    /// this blob.
+    bsl::pair<int, int> findBufferIndexAndOffset(bsl::size_t position) const;
+
+    /// Return the length of the last blob buffer in this blob, or 0 if this
+    /// blob is of 0 length.
+    int lastDataBufferLength() const;
+
+    /// Return the length of this blob.
+    bsl::size_t length() const;
+
+    /// Return the number of blob buffers containing data in this blob.
+    int numDataBuffers() const;
+
+    /// Return the number of blob buffers held by this blob.
+    int numBuffers() const;
+
+    /// Return the sum of the sizes of all blob buffers in this blob (i.e.,
+    /// the capacity of this blob).
+    bsl::size_t totalSize() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` blobs have the same
+/// value, and `false` otherwise.  Two blobs have the same value if they
+/// hold the same buffers, and have the same length.
+bool operator==(const LargeBlob& lhs, const LargeBlob& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` blobs do not have the
+/// same value, and `false` otherwise.  Two blobs do not have the same value
+/// if they do not hold the same buffers, or do not have the same length.
+bool operator!=(const LargeBlob& lhs, const LargeBlob& rhs);
+
+// FREE FUNCTIONS
+
+/// Efficiently exchange the values of the specified `a` and `b` objects.
+/// This method provides the no-throw exception-safety guarantee if both
+/// objects were created with the same allocator.
+void swap(LargeBlob& a, LargeBlob& b);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class LargeBlob
+                              // ---------------
+
+// MANIPULATORS
+inline
+void LargeBlob::appendBuffer(const BlobBuffer& buffer)
+{
+    d_buffers.push_back(buffer);
+    d_offsets.push_back(d_offsets.back() + buffer.size());
+}
+
+inline
+void LargeBlob::removeBuffer(int index)
+{
+    removeBuffers(index, 1);
+}
+
+inline
+void LargeBlob::reserveBufferCapacity(int numBuffers)
+{
+    BSLS_ASSERT(0 <= numBuffers);
+
+    d_buffers.reserve(numBuffers);
+    d_offsets.reserve(numBuffers + 1);
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *LargeBlob::allocator() const
+{
+    return d_buffers.get_allocator().mechanism();
+}
+
+inline
+const BlobBuffer& LargeBlob::buffer(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < static_cast<int>(d_buffers.size()));
+
+    return d_buffers[index];
+}
+
+inline
+bsl::size_t LargeBlob::bufferOffset(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < static_cast<int>(d_offsets.size()));
+
+    return d_offsets[index];
+}
+
+inline
+BlobBufferFactory *LargeBlob::factory() const
+{
+    return d_bufferFactory_p;
+}
+
+inline
+bsl::pair<int, int>
+LargeBlob::findBufferIndexAndOffset(bsl::size_t position) const
+{
+    BSLS_ASSERT(position < totalSize());
+
+    const int index = bufferIndexAt(position);
+    return bsl::pair<int, int>(
+                         index,
+                         static_cast<int>(position - d_offsets[index]));
+}
+
+inline
+int LargeBlob::lastDataBufferLength() const
+{
+    return d_dataIndex < 0
+           ? 0
+           : static_cast<int>(d_dataLength - d_offsets[d_dataIndex]);
+}
+
+inline
+bsl::size_t LargeBlob::length() const
+{
+    return d_dataLength;
+}
+
+inline
+int LargeBlob::numBuffers() const
+{
+    return static_cast<int>(d_buffers.size());
+}
+
+inline
+int LargeBlob::numDataBuffers() const
+{
+    return d_dataIndex + 1;
+}
+
+inline
+bsl::size_t LargeBlob::totalSize() const
+{
+    return d_offsets.back();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlbb::operator!=(const LargeBlob& lhs, const LargeBlob& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1166 @@
+// bdlbb_largeblob.t.cpp                                              -*-C++-*-
+#include <bdlbb_largeblob.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_keyword.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>     // `INT_MAX`
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>     // `atoi`
+#include <bsl_cstring.h>     // `memset`
+#include <bsl_deque.h>
+#include <bsl_iostream.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// `bdlbb::LargeBlob` has the same semantics as `bdlbb::Blob`, except for the
+// type of its lengths, so most manipulators are tested by applying the same
+// sequence of operations to a `bdlbb::LargeBlob` and to a `bdlbb::Blob`
+// oracle, and comparing the two after each operation.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] LargeBlob(bslma::Allocator *basicAllocator = 0);
+// [ 2] LargeBlob(BlobBufferFactory *factory, bslma::Allocator *ba = 0);
+// [ 2] LargeBlob(const Blob& original, bslma::Allocator *ba = 0);
+// [ 2] LargeBlob(const LargeBlob& original, bslma::Allocator *ba = 0);
+// [ 2] ~LargeBlob();
+//
+// MANIPULATORS
+// [ 2] LargeBlob& operator=(const LargeBlob& rhs);
+// [ 3] void appendBuffer(const BlobBuffer& buffer);
+// [ 3] void appendDataBuffer(const BlobBuffer& buffer);
+// [ 3] void insertBuffer(int index, const BlobBuffer& buffer);
+// [ 3] void prependDataBuffer(const BlobBuffer& buffer);
+// [ 3] void removeAll();
+// [ 3] void removeBuffer(int index);
+// [ 3] void removeBuffers(int index, int numBuffers);
+// [ 3] void removeUnusedBuffers();
+// [ 3] void replaceDataBuffer(int index, const BlobBuffer& buffer);
+// [ 3] void reserveBufferCapacity(int numBuffers);
+// [ 3] void setLength(bsl::size_t length);
+// [ 2] void swap(LargeBlob& other);
+// [ 3] BlobBuffer trimLastDataBuffer();
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 5] void appendDataTo(Blob *dest, bsl::size_t position, int length) const;
+// [ 3] const BlobBuffer& buffer(int index) const;
+// [ 4] bsl::size_t bufferOffset(int index) const;
+// [ 2] BlobBufferFactory *factory() const;
+// [ 4] bsl::pair<int, int> findBufferIndexAndOffset(bsl::size_t) const;
+// [ 3] int lastDataBufferLength() const;
+// [ 3] bsl::size_t length() const;
+// [ 3] int numDataBuffers() const;
+// [ 3] int numBuffers() const;
+// [ 3] bsl::size_t totalSize() const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const LargeBlob& lhs, const LargeBlob& rhs);
+// [ 2] bool operator!=(const LargeBlob& lhs, const LargeBlob& rhs);
+//
+// FREE FUNCTIONS
+// [ 2] void swap(LargeBlob& a, LargeBlob& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: lengths may exceed `INT_MAX`
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: findBufferIndexAndOffset
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr)      BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr)      BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+#define ASSERT_SAFE_FAIL(expr) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(expr)
+#define ASSERT_SAFE_PASS(expr) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(expr)
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::LargeBlob Obj;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+
+// ============================================================================
+//                            CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                       // =============================
+                       // class ReplayBlobBufferFactory
+                       // =============================
+
+/// This class implements a blob buffer factory that lets two blobs grow
+/// with the same buffers: a recording factory allocates each buffer from a
+/// source factory and appends it to a queue, and a replaying factory
+/// returns the queued buffers in the same order.
+class ReplayBlobBufferFactory : public bdlbb::BlobBufferFactory {
+
+    // DATA
+    bdlbb::BlobBufferFactory      *d_source_p;  // source factory, or 0 if
+                                                // replaying (held)
+
+    bsl::deque<bdlbb::BlobBuffer> *d_queue_p;   // recorded buffers (held)
+
+  public:
+    // CREATORS
+
+    /// Create a factory that records in the specified `queue` the buffers
+    /// allocated from the specified `source` factory if `source` is not 0,
+    /// and that replays the buffers of `queue` otherwise.
+    ReplayBlobBufferFactory(bdlbb::BlobBufferFactory      *source,
+                            bsl::deque<bdlbb::BlobBuffer> *queue)
+    : d_source_p(source)
+    , d_queue_p(queue)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Load into the specified `buffer` a recorded buffer, or a new buffer
+    /// that is recorded.
+    void allocate(bdlbb::BlobBuffer *buffer) BSLS_KEYWORD_OVERRIDE
+    {
+        if (d_source_p) {
+            d_source_p->allocate(buffer);
+            d_queue_p->push_back(*buffer);
+        }
+        else {
+            ASSERT(!d_queue_p->empty());
+
+            *buffer = d_queue_p->front();
+            d_queue_p->pop_front();
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return `true` if the specified `largeBlob` has the same buffers, length,
+/// and data buffers as the specified `blob`, and if the buffer offsets of
+/// `largeBlob` are consistent with its buffers, and `false` otherwise.
+bool isEquivalent(const Obj& largeBlob, const bdlbb::Blob& blob)
+{
+    if (largeBlob.numBuffers()           != blob.numBuffers()
+     || largeBlob.numDataBuffers()       != blob.numDataBuffers()
+     || largeBlob.length()               != bsl::size_t(blob.length())
+     || largeBlob.totalSize()            != bsl::size_t(blob.totalSize())
+     || largeBlob.lastDataBufferLength() != blob.lastDataBufferLength()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t offset = 0;
+    for (int i = 0; i < blob.numBuffers(); ++i) {
+        if (largeBlob.buffer(i) != blob.buffer(i)
+         || largeBlob.bufferOffset(i) != offset) {
+            return false;                                             // RETURN
+        }
+        offset += blob.buffer(i).size();
+    }
+    return largeBlob.bufferOffset(blob.numBuffers()) == offset;
+}
+
+/// Return a pseudo-random number in the range `[0 .. 32767]` derived from
+/// the specified `seed`, and update `seed`.
+int nextRandom(unsigned *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Accessing a Large Message in Windows
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a message made of many small buffers, and we need to
+// hand selected fragments of it to code operating on `bdlbb::Blob`.
+//
+// First, we create a `bdlbb::LargeBlob` that uses a blob buffer factory and
+// set its length, which allocates the buffers:
+// ```
+    bdlbb::SimpleBlobBufferFactory factory(16);
+    bdlbb::LargeBlob               message(&factory);
+
+    message.setLength(4000);
+    ASSERT(4000 == message.length());
+    ASSERT( 250 == message.numDataBuffers());
+// ```
+// Then, we fill the message with some data, one buffer at a time:
+// ```
+    for (int i = 0; i < message.numDataBuffers(); ++i) {
+        const bdlbb::BlobBuffer& buffer = message.buffer(i);
+        bsl::memset(buffer.data(), 'a' + i % 26, buffer.size());
+    }
+// ```
+// Next, we locate the buffer holding the byte at position 3000, which is
+// found by a binary search rather than a linear walk over the buffers:
+// ```
+    bsl::pair<int, int> place = message.findBufferIndexAndOffset(3000);
+    ASSERT(187 == place.first);
+    ASSERT(  8 == place.second);
+    ASSERT('f' == message.buffer(place.first).data()[place.second]);
+// ```
+// Finally, we append a 100 byte fragment of the message, starting at the same
+// position, to a `bdlbb::Blob`.  The fragment shares the buffers of `message`
+// and no bytes are copied:
+// ```
+    bdlbb::Blob fragment;
+    message.appendDataTo(&fragment, 3000, 100);
+
+    ASSERT(100 == fragment.length());
+    ASSERT(  7 == fragment.numDataBuffers());
+    ASSERT('f' == fragment.buffer(0).data()[0]);
+    ASSERT(message.buffer(place.first).data() + place.second ==
+                                                   fragment.buffer(0).data());
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: LENGTHS MAY EXCEED `INT_MAX`
+        //
+        // Concerns:
+        // 1. The length and total size of a blob may exceed `INT_MAX` on
+        //    platforms where `bsl::size_t` is wider than `int`.
+        //
+        // 2. `findBufferIndexAndOffset`, `setLength`, and `appendDataTo`
+        //    operate correctly on positions beyond `INT_MAX`.
+        //
+        // Plan:
+        // 1. Append buffers of 1GB that alias a small array (their contents
+        //    are never accessed, except for the first bytes), so that no
+        //    large allocation is needed, and verify the length, the offsets,
+        //    and the results of lookups past `INT_MAX`.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: lengths may exceed `INT_MAX`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: LENGTHS MAY EXCEED `INT_MAX`"
+                          << "\n=====================================" << endl;
+
+        if (sizeof(bsl::size_t) <= sizeof(int)) {
+            if (verbose) cout << "\tSkipped on 32-bit platforms." << endl;
+            break;
+        }
+
+        const int k_GB = 1 << 30;
+
+        char storage[4][8];
+        bsl::memset(storage, 0, sizeof storage);
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int i = 0; i < 4; ++i) {
+            storage[i][0] = static_cast<char>('0' + i);
+
+            bsl::shared_ptr<char> data(storage[i],
+                                       bslstl::SharedPtrNilDeleter(),
+                                       bslma::Default::defaultAllocator());
+            mX.appendDataBuffer(bdlbb::BlobBuffer(data, k_GB));
+        }
+
+        const bsl::size_t LENGTH = 4 * bsl::size_t(k_GB);
+
+        ASSERTV(X.length(),    LENGTH == X.length());
+        ASSERTV(X.totalSize(), LENGTH == X.totalSize());
+        ASSERT(4     == X.numDataBuffers());
+        ASSERT(k_GB  == X.lastDataBufferLength());
+        ASSERT(3 * bsl::size_t(k_GB) == X.bufferOffset(3));
+
+        {
+            bsl::pair<int, int> place =
+                         X.findBufferIndexAndOffset(3 * bsl::size_t(k_GB) + 5);
+            ASSERT(3 == place.first);
+            ASSERT(5 == place.second);
+
+            place = X.findBufferIndexAndOffset(LENGTH - 1);
+            ASSERT(3        == place.first);
+            ASSERT(k_GB - 1 == place.second);
+        }
+
+        mX.setLength(2 * bsl::size_t(k_GB) + 1);
+        ASSERT(3 == X.numDataBuffers());
+        ASSERT(1 == X.lastDataBufferLength());
+        ASSERT(LENGTH == X.totalSize());
+
+        {
+            bdlbb::Blob dest;
+            X.appendDataTo(&dest, 2 * bsl::size_t(k_GB), 1);
+            ASSERT(1   == dest.length());
+            ASSERT('2' == dest.buffer(0).data()[0]);
+        }
+
+        mX.setLength(LENGTH);
+        ASSERT(4 == X.numDataBuffers());
+
+        mX.removeBuffer(0);
+        ASSERT(3 * bsl::size_t(k_GB) == X.length());
+        ASSERT('1' == X.buffer(0).data()[0]);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `appendDataTo`
+        //
+        // Concerns:
+        // 1. `appendDataTo` appends to the destination blob the same buffers,
+        //    having the same contents and aliasing the same memory, as
+        //    `bdlbb::BlobUtil::append` does for an equivalent `bdlbb::Blob`.
+        //
+        // 2. Empty buffers in the source are skipped, and the last data
+        //    buffer of the destination is trimmed first.
+        //
+        // 3. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For blobs of buffers of various sizes, and for every position
+        //    and length, append the range to a `bdlbb::Blob` holding some
+        //    data, and compare the result with `bdlbb::BlobUtil::append`
+        //    applied to the equivalent `bdlbb::Blob`.  (C-1..2)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   void appendDataTo(Blob *dest, bsl::size_t position, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `appendDataTo`"
+                          << "\n======================" << endl;
+
+        static const int SIZES[] = { 1, 3, 0, 5, 2, 0, 7 };
+        enum { NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+        bdlbb::SimpleBlobBufferFactory factory(8);
+
+        bdlbb::Blob blob(&factory);
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            bdlbb::BlobBuffer buffer;
+            factory.allocate(&buffer);
+            buffer.setSize(SIZES[i]);
+            for (int j = 0; j < SIZES[i]; ++j) {
+                buffer.data()[j] = static_cast<char>('a' + i * 8 + j);
+            }
+            blob.appendDataBuffer(buffer);
+        }
+
+        const Obj X(blob);
+        ASSERT(isEquivalent(X, blob));
+
+        const int LENGTH = blob.length();
+
+        for (int pos = 0; pos <= LENGTH; ++pos) {
+            for (int len = 0; len <= LENGTH - pos; ++len) {
+                bdlbb::Blob expected(&factory);
+                bdlbb::Blob result(&factory);
+
+                expected.setLength(3);
+                result.appendBuffer(expected.buffer(0));
+                result.setLength(3);
+
+                bdlbb::BlobUtil::append(&expected, blob, pos, len);
+                X.appendDataTo(&result, pos, len);
+
+                ASSERTV(pos, len, expected.length() == result.length());
+                ASSERTV(pos, len, 0 == bdlbb::BlobUtil::compare(expected,
+                                                                 result));
+
+                int resultIndex = 1;
+                for (int i = 1; i < expected.numDataBuffers(); ++i) {
+                    if (0 == expected.buffer(i).size()) {
+                        continue;
+                    }
+                    ASSERTV(pos, len, i, resultIndex < result.numBuffers());
+                    if (resultIndex >= result.numBuffers()) {
+                        break;
+                    }
+                    ASSERTV(pos, len, i,
+                            expected.buffer(i).data() ==
+                                          result.buffer(resultIndex).data());
+                    ++resultIndex;
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::Blob dest;
+
+            ASSERT_PASS(X.appendDataTo(&dest, LENGTH, 0));
+            ASSERT_FAIL(X.appendDataTo(0, 0, 1));
+            ASSERT_FAIL(X.appendDataTo(&dest, 0, -1));
+            ASSERT_FAIL(X.appendDataTo(&dest, LENGTH + 1, 0));
+            ASSERT_FAIL(X.appendDataTo(&dest, 1, LENGTH));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `findBufferIndexAndOffset`
+        //
+        // Concerns:
+        // 1. `findBufferIndexAndOffset` returns the index of the buffer
+        //    holding the specified position, and the offset of the position
+        //    in that buffer, for every position in the blob, including the
+        //    capacity beyond its length.
+        //
+        // 2. Empty buffers are never returned.
+        //
+        // 3. `bufferOffset` returns the offset of the first byte of each
+        //    buffer, and the total size for `numBuffers()`.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For blobs of buffers of various sizes, including empty ones,
+        //    compare the result of `findBufferIndexAndOffset` with
+        //    `bdlbb::BlobUtil::findBufferIndexAndOffset` for every position.
+        //    (C-1..3)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   bsl::pair<int, int> findBufferIndexAndOffset(bsl::size_t) const;
+        //   bsl::size_t bufferOffset(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `findBufferIndexAndOffset`"
+                          << "\n==================================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_sizes;  // buffer sizes, as decimal digits
+            int         d_length;
+        } DATA[] = {
+            //LINE  SIZES       LENGTH
+            //----  ----------  ------
+            { L_,   "1",             1 },
+            { L_,   "5",             2 },
+            { L_,   "11",            1 },
+            { L_,   "123",           4 },
+            { L_,   "0120",          3 },
+            { L_,   "00300",         0 },
+            { L_,   "4040404",      12 },
+            { L_,   "9999999",      30 },
+            { L_,   "1000000002",    1 },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        char storage[16];
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SIZES  = DATA[ti].d_sizes;
+            const int         LENGTH = DATA[ti].d_length;
+
+            bsl::shared_ptr<char> data(storage,
+                                       bslstl::SharedPtrNilDeleter(),
+                                       bslma::Default::defaultAllocator());
+
+            bdlbb::Blob blob;
+            Obj         mX;  const Obj& X = mX;
+
+            for (const char *s = SIZES; *s; ++s) {
+                bdlbb::BlobBuffer buffer(data, *s - '0');
+                blob.appendBuffer(buffer);
+                mX.appendBuffer(buffer);
+            }
+            blob.setLength(LENGTH);
+            mX.setLength(LENGTH);
+
+            ASSERTV(LINE, isEquivalent(X, blob));
+
+            for (int pos = 0; pos < blob.totalSize(); ++pos) {
+                const bsl::pair<int, int> EXP =
+                          bdlbb::BlobUtil::findBufferIndexAndOffset(blob, pos);
+                const bsl::pair<int, int> RESULT =
+                                              X.findBufferIndexAndOffset(pos);
+
+                ASSERTV(LINE, pos, EXP.first,  RESULT.first,
+                        EXP.first  == RESULT.first);
+                ASSERTV(LINE, pos, EXP.second, RESULT.second,
+                        EXP.second == RESULT.second);
+                ASSERTV(LINE, pos,
+                        0 < X.buffer(RESULT.first).size());
+                ASSERTV(LINE, pos,
+                        X.bufferOffset(RESULT.first) + RESULT.second ==
+                                                     bsl::size_t(pos));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(4);
+
+            Obj mX(&factory);  const Obj& X = mX;
+
+            ASSERT_FAIL(X.findBufferIndexAndOffset(0));
+            ASSERT_SAFE_PASS(X.bufferOffset(0));
+            ASSERT_SAFE_FAIL(X.bufferOffset(1));
+
+            mX.setLength(3);
+
+            ASSERT_PASS(X.findBufferIndexAndOffset(3));
+            ASSERT_FAIL(X.findBufferIndexAndOffset(4));
+            ASSERT_SAFE_PASS(X.bufferOffset(1));
+            ASSERT_SAFE_FAIL(X.bufferOffset(2));
+            ASSERT_SAFE_FAIL(X.bufferOffset(-1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS
+        //
+        // Concerns:
+        // 1. Each manipulator changes the buffers, the length, the number of
+        //    data buffers, and the total size of the blob exactly as the
+        //    corresponding manipulator of `bdlbb::Blob` does.
+        //
+        // 2. The buffer offsets are kept consistent with the buffers.
+        //
+        // 3. `trimLastDataBuffer` returns the same leftover as
+        //    `bdlbb::Blob::trimLastDataBuffer`.
+        //
+        // 4. `reserveBufferCapacity` does not change the value of the blob.
+        //
+        // Plan:
+        // 1. Apply a long pseudo-random sequence of manipulators, with
+        //    pseudo-random arguments (including empty buffers), to a
+        //    `bdlbb::LargeBlob` and to a `bdlbb::Blob`, and verify after each
+        //    operation that the two blobs are equivalent.  (C-1..4)
+        //
+        // Testing:
+        //   void appendBuffer(const BlobBuffer& buffer);
+        //   void appendDataBuffer(const BlobBuffer& buffer);
+        //   void insertBuffer(int index, const BlobBuffer& buffer);
+        //   void prependDataBuffer(const BlobBuffer& buffer);
+        //   void removeAll();
+        //   void removeBuffer(int index);
+        //   void removeBuffers(int index, int numBuffers);
+        //   void removeUnusedBuffers();
+        //   void replaceDataBuffer(int index, const BlobBuffer& buffer);
+        //   void reserveBufferCapacity(int numBuffers);
+        //   void setLength(bsl::size_t length);
+        //   BlobBuffer trimLastDataBuffer();
+        //   const BlobBuffer& buffer(int index) const;
+        //   int lastDataBufferLength() const;
+        //   bsl::size_t length() const;
+        //   int numDataBuffers() const;
+        //   int numBuffers() const;
+        //   bsl::size_t totalSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING MANIPULATORS"
+                          << "\n====================" << endl;
+
+        enum {
+            e_APPEND_BUFFER,
+            e_APPEND_DATA_BUFFER,
+            e_INSERT_BUFFER,
+            e_PREPEND_DATA_BUFFER,
+            e_REMOVE_ALL,
+            e_REMOVE_BUFFER,
+            e_REMOVE_BUFFERS,
+            e_REMOVE_UNUSED_BUFFERS,
+            e_REPLACE_DATA_BUFFER,
+            e_RESERVE_BUFFER_CAPACITY,
+            e_SET_LENGTH,
+            e_TRIM_LAST_DATA_BUFFER,
+            e_NUM_OPERATIONS
+        };
+
+        const int NUM_ITERATIONS = 20000;
+
+        bslma::TestAllocator           ta("object", veryVeryVerbose);
+        bdlbb::SimpleBlobBufferFactory factory(5, &ta);
+
+        // Both blobs must grow with the same buffers to remain equivalent.
+
+        bsl::deque<bdlbb::BlobBuffer> queue(&ta);
+        ReplayBlobBufferFactory       recorder(&factory, &queue);
+        ReplayBlobBufferFactory       replayer(0, &queue);
+
+        bdlbb::Blob blob(&recorder, &ta);
+        Obj         mX(&replayer, &ta);  const Obj& X = mX;
+
+        unsigned seed = 0;
+
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            int operation = nextRandom(&seed) % e_NUM_OPERATIONS;
+
+            // Keep the blobs small, so that every operation is exercised on
+            // every kind of position.
+
+            if (e_REMOVE_ALL == operation && 0 != nextRandom(&seed) % 8) {
+                operation = e_REMOVE_BUFFER;
+            }
+
+            bdlbb::BlobBuffer buffer;
+            factory.allocate(&buffer);
+            buffer.setSize(nextRandom(&seed) % 6);
+
+            const int NUM_BUFFERS = blob.numBuffers();
+
+            if (veryVerbose) {
+                T_ P_(i) P_(operation) P_(blob.length()) P(NUM_BUFFERS)
+            }
+
+            switch (operation) {
+              case e_APPEND_BUFFER: {
+                blob.appendBuffer(buffer);
+                mX.appendBuffer(buffer);
+              } break;
+              case e_APPEND_DATA_BUFFER: {
+                blob.appendDataBuffer(buffer);
+                mX.appendDataBuffer(buffer);
+              } break;
+              case e_INSERT_BUFFER: {
+                const int index = nextRandom(&seed) % (NUM_BUFFERS + 1);
+
+                // A `bdlbb::Blob` of length 0 may still hold empty data
+                // buffers, but does not count a buffer inserted before them
+                // as data (leaving its last data buffer past its data); this
+                // case is tested separately below.
+
+                if (0 == blob.length() && index < blob.numDataBuffers()) {
+                    break;
+                }
+                blob.insertBuffer(index, buffer);
+                mX.insertBuffer(index, buffer);
+              } break;
+              case e_PREPEND_DATA_BUFFER: {
+                blob.prependDataBuffer(buffer);
+                mX.prependDataBuffer(buffer);
+              } break;
+              case e_REMOVE_ALL: {
+                blob.removeAll();
+                mX.removeAll();
+              } break;
+              case e_REMOVE_BUFFER: {
+                if (0 < NUM_BUFFERS) {
+                    const int index = nextRandom(&seed) % NUM_BUFFERS;
+                    blob.removeBuffer(index);
+                    mX.removeBuffer(index);
+                }
+              } break;
+              case e_REMOVE_BUFFERS: {
+                const int index = nextRandom(&seed) % (NUM_BUFFERS + 1);
+                const int count = nextRandom(&seed)
+                                                % (NUM_BUFFERS - index + 1);
+                blob.removeBuffers(index, count);
+                mX.removeBuffers(index, count);
+              } break;
+              case e_REMOVE_UNUSED_BUFFERS: {
+                blob.removeUnusedBuffers();
+                mX.removeUnusedBuffers();
+              } break;
+              case e_REPLACE_DATA_BUFFER: {
+                if (0 < blob.numDataBuffers()) {
+                    const int index = nextRandom(&seed)
+                                                    % blob.numDataBuffers();
+                    blob.replaceDataBuffer(index, buffer);
+                    mX.replaceDataBuffer(index, buffer);
+                }
+              } break;
+              case e_RESERVE_BUFFER_CAPACITY: {
+                const int capacity = nextRandom(&seed) % 64;
+                blob.reserveBufferCapacity(capacity);
+                mX.reserveBufferCapacity(capacity);
+              } break;
+              case e_SET_LENGTH: {
+                const int length = nextRandom(&seed)
+                                                  % (blob.totalSize() + 12);
+                blob.setLength(length);
+                mX.setLength(length);
+              } break;
+              case e_TRIM_LAST_DATA_BUFFER: {
+                const bdlbb::BlobBuffer EXP    = blob.trimLastDataBuffer();
+                const bdlbb::BlobBuffer RESULT = mX.trimLastDataBuffer();
+                ASSERTV(i, EXP.data() == RESULT.data());
+                ASSERTV(i, EXP.size() == RESULT.size());
+              } break;
+            }
+
+            ASSERTV(i, operation, queue.empty());
+            ASSERTV(i, operation, isEquivalent(X, blob));
+            if (!isEquivalent(X, blob)) {
+                break;
+            }
+        }
+
+        if (verbose) cout << "\nInserting before empty data buffers." << endl;
+        {
+            bdlbb::BlobBuffer empty;
+            bdlbb::BlobBuffer buffer;
+            factory.allocate(&buffer);
+
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            mY.appendDataBuffer(empty);
+            ASSERT(0 == Y.length());
+            ASSERT(1 == Y.numDataBuffers());
+
+            mY.insertBuffer(0, buffer);
+            ASSERT(5 == Y.length());
+            ASSERT(2 == Y.numDataBuffers());
+            ASSERT(0 == Y.lastDataBufferLength());
+            ASSERT(5 == Y.bufferOffset(1));
+
+            mY.removeBuffer(1);
+            ASSERT(5 == Y.length());
+            ASSERT(1 == Y.numDataBuffers());
+            ASSERT(5 == Y.lastDataBufferLength());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, VALUE SEMANTICS, AND SWAP
+        //
+        // Concerns:
+        // 1. Each constructor creates a blob having the expected value,
+        //    factory, and allocator.
+        //
+        // 2. A blob created from a `bdlbb::Blob` shares its buffers and has
+        //    the same length.
+        //
+        // 3. The copy constructor, the copy-assignment operator, and `swap`
+        //    produce objects having the expected value, and equality
+        //    compares buffers and length.
+        //
+        // 4. All memory is supplied by the object allocator.
+        //
+        // Plan:
+        // 1. Create objects with each constructor, using a test allocator,
+        //    and verify their value, and the memory used.  (C-1..2, 4)
+        //
+        // 2. Copy, assign, and swap objects, and verify the results with the
+        //    equality operators.  (C-3)
+        //
+        // Testing:
+        //   LargeBlob(bslma::Allocator *basicAllocator = 0);
+        //   LargeBlob(BlobBufferFactory *factory, bslma::Allocator *ba = 0);
+        //   LargeBlob(const Blob& original, bslma::Allocator *ba = 0);
+        //   LargeBlob(const LargeBlob& original, bslma::Allocator *ba = 0);
+        //   ~LargeBlob();
+        //   LargeBlob& operator=(const LargeBlob& rhs);
+        //   void swap(LargeBlob& other);
+        //   bslma::Allocator *allocator() const;
+        //   BlobBufferFactory *factory() const;
+        //   bool operator==(const LargeBlob& lhs, const LargeBlob& rhs);
+        //   bool operator!=(const LargeBlob& lhs, const LargeBlob& rhs);
+        //   void swap(LargeBlob& a, LargeBlob& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING CREATORS, VALUE SEMANTICS, AND SWAP"
+                          << "\n==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator oa("other",  veryVeryVerbose);
+
+        bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   == X.factory());
+            ASSERT(0   == X.length());
+            ASSERT(0   == X.totalSize());
+            ASSERT(0   == X.numBuffers());
+            ASSERT(0   == X.numDataBuffers());
+            ASSERT(0   == X.lastDataBufferLength());
+            ASSERT(0   == X.bufferOffset(0));
+        }
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(&factory, &ta);  const Obj& X = mX;
+
+            ASSERT(&ta      == X.allocator());
+            ASSERT(&factory == X.factory());
+            ASSERT(0        == X.length());
+
+            mX.setLength(20);
+
+            ASSERT(20 == X.length());
+            ASSERT(24 == X.totalSize());
+            ASSERT(3  == X.numDataBuffers());
+            ASSERT(4  == X.lastDataBufferLength());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nConstruction from `bdlbb::Blob`." << endl;
+        {
+            bdlbb::Blob blob(&factory, &ta);
+            blob.setLength(21);
+            bdlbb::BlobBuffer capacity;
+            factory.allocate(&capacity);
+            blob.appendBuffer(capacity);
+
+            const bsls::Types::Int64 NUM_DEFAULT =
+                                          defaultAllocator.numBlocksTotal();
+
+            Obj mX(blob, &ta);  const Obj& X = mX;
+
+            ASSERT(NUM_DEFAULT == defaultAllocator.numBlocksTotal());
+            ASSERT(&factory    == X.factory());
+            ASSERT(isEquivalent(X, blob));
+            ASSERT(X.buffer(0).data() == blob.buffer(0).data());
+
+            const bdlbb::Blob EMPTY;
+            const Obj         Y(EMPTY, &ta);
+
+            ASSERT(isEquivalent(Y, EMPTY));
+            ASSERT(X != Y);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nCopy, assignment, and equality." << endl;
+        {
+            Obj mX(&factory, &ta);  const Obj& X = mX;
+            mX.setLength(17);
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            ASSERT(&oa      == Y.allocator());
+            ASSERT(&factory == Y.factory());
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+
+            mY.setLength(16);
+            ASSERT(X != Y);
+            ASSERT(!(X == Y));
+
+            mY.setLength(17);
+            ASSERT(X == Y);
+
+            bdlbb::BlobBuffer buffer;
+            factory.allocate(&buffer);
+            mY.appendBuffer(buffer);
+            ASSERT(X != Y);
+
+            Obj mZ(&ta);  const Obj& Z = mZ;
+            mZ = Y;
+            ASSERT(Y == Z);
+            ASSERT(&ta == Z.allocator());
+
+            mZ = Z;
+            ASSERT(Y == Z);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nSwap." << endl;
+        {
+            Obj mX(&factory, &ta);  const Obj& X = mX;
+            Obj mY(&ta);            const Obj& Y = mY;
+            Obj mZ(&factory, &oa);  const Obj& Z = mZ;
+
+            mX.setLength(30);
+
+            const Obj XX(X, &ta);
+            const Obj YY(Y, &ta);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+            ASSERT(0        == X.factory());
+            ASSERT(&factory == Y.factory());
+
+            bdlbb::swap(mY, mZ);
+            ASSERT(XX == Z);
+            ASSERT(0  == Y.length());
+            ASSERT(&ta == Y.allocator());
+            ASSERT(&oa == Z.allocator());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Grow a blob, append and remove buffers, and look up positions.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bdlbb::SimpleBlobBufferFactory factory(10);
+
+        Obj mX(&factory);  const Obj& X = mX;
+
+        mX.setLength(25);
+        ASSERT(25 == X.length());
+        ASSERT(30 == X.totalSize());
+        ASSERT(3  == X.numDataBuffers());
+        ASSERT(5  == X.lastDataBufferLength());
+
+        bsl::pair<int, int> place = X.findBufferIndexAndOffset(17);
+        ASSERT(1 == place.first);
+        ASSERT(7 == place.second);
+
+        bdlbb::BlobBuffer buffer;
+        factory.allocate(&buffer);
+        mX.appendDataBuffer(buffer);
+        ASSERT(35 == X.length());
+        ASSERT(35 == X.totalSize());
+        ASSERT(4  == X.numDataBuffers());
+        ASSERT(25 == X.bufferOffset(3));
+
+        mX.removeBuffer(0);
+        ASSERT(25 == X.length());
+        ASSERT(0  == X.bufferOffset(0));
+        ASSERT(15 == X.bufferOffset(2));
+
+        place = X.findBufferIndexAndOffset(17);
+        ASSERT(2 == place.first);
+        ASSERT(2 == place.second);
+
+        mX.setLength(0);
+        ASSERT(0  == X.length());
+        ASSERT(0  == X.numDataBuffers());
+        ASSERT(25 == X.totalSize());
+
+        mX.removeAll();
+        ASSERT(0 == X.totalSize());
+        ASSERT(0 == X.numBuffers());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: findBufferIndexAndOffset
+        //
+        // Concerns:
+        // 1. Locating positions in a blob of thousands of buffers with
+        //    `LargeBlob::findBufferIndexAndOffset` is substantially faster
+        //    than with `bdlbb::BlobUtil::findBufferIndexAndOffset`.
+        //
+        // Plan:
+        // 1. Build equivalent `bdlbb::Blob` and `bdlbb::LargeBlob` objects of
+        //    the specified number of buffers, look up pseudo-random positions
+        //    in each, and report the elapsed time of each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: findBufferIndexAndOffset
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: findBufferIndexAndOffset"
+                          << "\n=========================================="
+                          << endl;
+
+        const int numLookups = argc > 2 ? atoi(argv[2]) : 100000;
+        const int numBuffers = argc > 3 ? atoi(argv[3]) : 4096;
+        const int bufferSize = argc > 4 ? atoi(argv[4]) : 256;
+
+        bdlbb::SimpleBlobBufferFactory factory(bufferSize);
+        bdlbb::Blob                    blob(&factory);
+        blob.setLength(numBuffers * bufferSize);
+
+        const Obj X(blob);
+
+        cout << "blob of " << numBuffers << " buffers of " << bufferSize
+             << " bytes, " << numLookups << " lookups" << endl;
+
+        const int totalSize = blob.totalSize();
+
+        bsls::Stopwatch timer;
+        unsigned        seed = 0;
+        bsls::Types::Int64 checksum = 0;
+
+        timer.start();
+        for (int i = 0; i < numLookups; ++i) {
+            const int position = (nextRandom(&seed) << 15 | nextRandom(&seed))
+                                                                  % totalSize;
+            checksum += bdlbb::BlobUtil::findBufferIndexAndOffset(
+                                                        blob, position).first;
+        }
+        timer.stop();
+        cout << "  BlobUtil::findBufferIndexAndOffset:  "
+             << timer.accumulatedWallTime() << " seconds" << endl;
+
+        timer.reset();
+        seed = 0;
+
+        timer.start();
+        for (int i = 0; i < numLookups; ++i) {
+            const int position = (nextRandom(&seed) << 15 | nextRandom(&seed))
+                                                                  % totalSize;
+            checksum -= X.findBufferIndexAndOffset(position).first;
+        }
+        timer.stop();
+        cout << "  LargeBlob::findBufferIndexAndOffset: "
+             << timer.accumulatedWallTime() << " seconds" << endl;
+
+        ASSERTV(checksum, 0 == checksum);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
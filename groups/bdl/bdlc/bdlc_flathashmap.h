@@ -783,6 +783,22 @@ class FlatHashMap {
         return iterator(d_impl.find(key));
     }
 
+    /// Load into consecutive positions starting at the specified `result`,
+    /// for each key in the specified range [`first`, `last`), in order, an
+    /// iterator referring to the modifiable element in this map having that
+    /// key, or `end()` if no such entry exists in this map, and return an
+    /// iterator one past the last position written.  The keys are searched
+    /// for in batches, and the memory the searches of a batch examine is
+    /// prefetched before any key of the batch is compared, so that the
+    /// cache misses incurred by looking up many keys overlap.  `KEY_ITERATOR`
+    /// shall meet the requirements of a forward iterator whose `value_type`
+    /// is convertible to `KEY`, and `OUTPUT_ITERATOR` shall meet the
+    /// requirements of an output iterator accepting `iterator` values.
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result);
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class VALUE_TYPE>
     bsl::pair<iterator, bool>
@@ -1218,6 +1234,22 @@ class FlatHashMap {
         return const_iterator(d_impl.find(key));
     }
 
+    /// Load into consecutive positions starting at the specified `result`,
+    /// for each key in the specified range [`first`, `last`), in order, a
+    /// `const_iterator` referring to the element in this map having that
+    /// key, or `end()` if no such entry exists in this map, and return an
+    /// iterator one past the last position written.  The keys are searched
+    /// for in batches, and the memory the searches of a batch examine is
+    /// prefetched before any key of the batch is compared, so that the
+    /// cache misses incurred by looking up many keys overlap.  `KEY_ITERATOR`
+    /// shall meet the requirements of a forward iterator whose `value_type`
+    /// is convertible to `KEY`, and `OUTPUT_ITERATOR` shall meet the
+    /// requirements of an output iterator accepting `const_iterator` values.
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result) const;
+
 
     /// Return (a copy of) the unary hash functor used by this map to
     /// generate a hash value (of type `bsl::size_t`) for a `KEY` object.
@@ -1743,6 +1775,17 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR FlatHashMap<KEY, VALUE, HASH, EQUAL>::findMany(
+                                                        KEY_ITERATOR    first,
+                                                        KEY_ITERATOR    last,
+                                                        OUTPUT_ITERATOR result)
+{
+    return d_impl.findMany(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
@@ -1992,6 +2035,17 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR FlatHashMap<KEY, VALUE, HASH, EQUAL>::findMany(
+                                                  KEY_ITERATOR    first,
+                                                  KEY_ITERATOR    last,
+                                                  OUTPUT_ITERATOR result) const
+{
+    return d_impl.findMany(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
@@ -147,6 +147,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [24] iterator find(const KEY& key);
+// [34] OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) entry)
 // [28] iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) entry)
 // [16] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
@@ -180,6 +181,7 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [34] OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -200,7 +202,7 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashMap&, FlatHashMap&);
 // ----------------------------------------------------------------------------
-// [34] USAGE EXAMPLE
+// [35] USAGE EXAMPLE
 // [32] CONCERN: `find`             handles transparent comparators
 // [32] CONCERN: `contains`         handles transparent comparators
 // [32] CONCERN: `count`            handles transparent comparators
@@ -215,6 +217,7 @@ using namespace bsl;
 // [30] DRQS 169531176: bsl::inserter compatibility on Sun
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: `findMany` ON LARGE TABLES
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -278,6 +281,10 @@ void aSsErT(bool condition, const char *message, int line)
 
 const bsl::uint8_t k_SIZE = bdlc::FlatHashTable_GroupControl::k_SIZE;
 
+// The capacity of a table created with a capacity of 32 (a table with a
+// non-zero capacity has at least two groups).
+const bsl::size_t k_CAPACITY_32 = 32 < 2 * k_SIZE ? 2 * k_SIZE : 32;
+
 // ============================================================================
 //                     GLOBAL VARIABLES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -968,6 +975,56 @@ bsls::TimeInterval performanceFindNotPresent(MAP *map)
     return results[NUM_TRIAL / 2];
 }
 
+/// Return the time taken to look up, in the specified `map`, each of the
+/// specified `keys` with `find`.
+template <class MAP>
+bsls::TimeInterval performanceFindLarge(
+                                  const MAP&                              map,
+                                  const bsl::vector<bsls::Types::Uint64>& keys)
+{
+    bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        typename MAP::const_iterator it = map.find(keys[i]);
+        if (it != map.end()) {
+            s_antiOptimization += static_cast<unsigned int>(it->second);
+        }
+    }
+
+    return bsls::SystemTime::nowMonotonicClock() - start;
+}
+
+/// Return the time taken to look up, in the specified `map`, each of the
+/// specified `keys` with `findMany`, in runs of the specified `runLength`
+/// keys.
+template <class MAP>
+bsls::TimeInterval performanceFindManyLarge(
+                             const MAP&                              map,
+                             const bsl::vector<bsls::Types::Uint64>& keys,
+                             bsl::size_t                             runLength)
+{
+    typedef typename MAP::const_iterator ConstIterator;
+
+    bsl::vector<ConstIterator> results(runLength, map.end());
+
+    bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+    for (bsl::size_t i = 0; i < keys.size(); i += runLength) {
+        const bsl::size_t n = bsl::min(runLength, keys.size() - i);
+
+        map.findMany(keys.begin() + i, keys.begin() + i + n, results.data());
+
+        for (bsl::size_t j = 0; j < n; ++j) {
+            if (results[j] != map.end()) {
+                s_antiOptimization +=
+                                static_cast<unsigned int>(results[j]->second);
+            }
+        }
+    }
+
+    return bsls::SystemTime::nowMonotonicClock() - start;
+}
+
                     // =============================
                     // class TransparentlyComparable
                     // =============================
@@ -1455,7 +1512,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 34: {
+      case 35: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1604,6 +1661,88 @@ int main(int argc, char *argv[])
 //  among         3
 // ```
       } break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // `findMany`
+        //   Ensure the `findMany` methods operate as expected.
+        //
+        // Concerns:
+        // 1. The `findMany` methods correctly forward to the underlying
+        //    implementation and correctly forward the return value.
+        //
+        // 2. The iterators loaded by the manipulator are not
+        //    `const_iterator`s.
+        //
+        // Plan:
+        // 1. Verify the results of `findMany` on an empty object and on an
+        //    object with several contained elements, for keys that are and
+        //    are not present, using both the manipulator and the accessor.
+        //    (C-1)
+        //
+        // 2. Assign a value to the `second` of an iterator loaded by the
+        //    manipulator to ensure the iterator is not a `const_iterator`.
+        //    (C-2)
+        //
+        // Testing:
+        //   OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER);
+        //   OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`findMany`" << endl
+                          << "==========" << endl;
+
+        if (verbose) cout << "Testing `findMany`." << endl;
+        {
+            typedef bdlc::FlatHashMap<int, int> Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int KEYS[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+            enum { NUM_KEYS = sizeof KEYS / sizeof *KEYS };
+
+            Obj::iterator       mResults[NUM_KEYS + 1];
+            Obj::const_iterator results[NUM_KEYS + 1];
+
+            ASSERT(mResults + NUM_KEYS == mX.findMany(KEYS,
+                                                      KEYS + NUM_KEYS,
+                                                      mResults));
+            ASSERT(results + NUM_KEYS ==  X.findMany(KEYS,
+                                                     KEYS + NUM_KEYS,
+                                                     results));
+            ASSERT(mResults == mX.findMany(KEYS, KEYS, mResults));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                LOOP_ASSERT(i, mX.end() == mResults[i]);
+                LOOP_ASSERT(i,  X.end() == results[i]);
+            }
+
+            mX.insert(bsl::make_pair(1, 10));
+            mX.insert(bsl::make_pair(2, 20));
+            mX.insert(bsl::make_pair(5, 50));
+            mX.insert(bsl::make_pair(7, 70));
+
+            ASSERT(mResults + NUM_KEYS == mX.findMany(KEYS,
+                                                      KEYS + NUM_KEYS,
+                                                      mResults));
+            ASSERT(results + NUM_KEYS ==  X.findMany(KEYS,
+                                                     KEYS + NUM_KEYS,
+                                                     results));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                LOOP_ASSERT(i, mX.find(KEYS[i]) == mResults[i]);
+                LOOP_ASSERT(i,  X.find(KEYS[i]) == results[i]);
+            }
+
+            ASSERT(10 == mResults[1]->second);
+
+            mResults[1]->second = 11;
+
+            ASSERT(11 == X.find(1)->second);
+        }
+      } break;
       case 33: {
         // --------------------------------------------------------------------
         // TESTING 'INSERT_OR_ASSIGN'
@@ -2825,15 +2964,15 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2876,15 +3015,15 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2925,15 +3064,15 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                         Key;
@@ -2976,15 +3115,15 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                                Key;
@@ -3178,15 +3317,15 @@ int main(int argc, char *argv[])
                 Obj        mX(IDATA.begin(), ++IDATA.begin(), 32);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -3234,15 +3373,15 @@ int main(int argc, char *argv[])
                               (bslma::Allocator *)0);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -3285,15 +3424,15 @@ int main(int argc, char *argv[])
                 Obj        mX(IDATA.begin(), ++IDATA.begin(), 32, hasher);
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                         Key;
@@ -3346,15 +3485,15 @@ int main(int argc, char *argv[])
                               Equal());
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                                Key;
@@ -3422,7 +3561,7 @@ int main(int argc, char *argv[])
 
             mX.rehash(32);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.rehash(64);
 
@@ -3439,7 +3578,7 @@ int main(int argc, char *argv[])
 
             mX.reserve(28);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.reserve(56);
 
@@ -5022,12 +5161,12 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, Hash(1), Equal(), &oa);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.hash_function()(0));
-                ASSERT(false == X.key_eq()(0, 0));
-                ASSERT( true == X.key_eq()(0, 1));
-                ASSERT(0.875 == X.max_load_factor());
-                ASSERT(  &oa == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.hash_function()(0));
+                ASSERT(        false == X.key_eq()(0, 0));
+                ASSERT(         true == X.key_eq()(0, 1));
+                ASSERT(        0.875 == X.max_load_factor());
+                ASSERT(          &oa == X.allocator());
             }
         }
 
@@ -5250,13 +5389,13 @@ int main(int argc, char *argv[])
 
                 Obj mX(32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -5301,13 +5440,13 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -5350,13 +5489,13 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -5401,13 +5540,13 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -5542,16 +5681,16 @@ int main(int argc, char *argv[])
 
             mX.clear();
 
-            ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(            0 == X.size());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.insert(bsl::make_pair(1, 1));
             mX.insert(bsl::make_pair(2, 2));
 
             mX.clear();
 
-            ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(            0 == X.size());
+            ASSERT(k_CAPACITY_32 == X.capacity());
         }
 
         if (verbose) cout << "Testing `reset`." << endl;
@@ -5733,6 +5872,110 @@ int main(int argc, char *argv[])
             cout << "anti-optimization: " << s_antiOptimization << endl;
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: `findMany` ON LARGE TABLES
+        //   Compare the lookup performance of `find` and `findMany` with
+        //   that of `bsl::unordered_map` on tables that do not fit in the
+        //   last-level cache.
+        //
+        // Concerns:
+        // 1. When most lookups miss the cache, `findMany` outperforms `find`,
+        //    since the cache misses of the searches of a batch overlap.
+        //
+        // 2. `bdlc::FlatHashMap` outperforms `bsl::unordered_map` on such
+        //    tables.
+        //
+        // Plan:
+        // 1. Populate a `bdlc::FlatHashMap` and a `bsl::unordered_map` with
+        //    the same `NUM_ENTRIES` elements, many times the size of a typical
+        //    last-level cache, and report the time taken to look up a
+        //    pseudo-random sequence of keys, half of which are present, with
+        //    `find` on both containers and with `findMany`, for several run
+        //    lengths, on the flat hash map.  (C-1,2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: `findMany` ON LARGE TABLES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: `findMany` ON LARGE TABLES"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        typedef bsls::Types::Uint64 Key;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        // Approximately 128MB of entries and controls for the flat hash map,
+        // and more for the unordered map.
+
+        const bsl::size_t NUM_ENTRIES = 6 * 1024 * 1024;
+        const bsl::size_t NUM_LOOKUP  = 4 * 1024 * 1024;
+
+        // Keys are scattered by a multiplicative hash so that neither table
+        // benefits from locality between consecutive lookups.
+
+        const Key MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+        bdlc::FlatHashMap<Key, Key>  mX;
+        bsl::unordered_map<Key, Key> mY;
+
+        mY.max_load_factor(mX.max_load_factor());
+
+        mX.reserve(NUM_ENTRIES);
+        mY.reserve(NUM_ENTRIES);
+
+        for (bsl::size_t i = 0; i < NUM_ENTRIES; ++i) {
+            const Key key = (2 * i) * MULTIPLIER;
+
+            mX.insert(bsl::make_pair(key, static_cast<Key>(i)));
+            mY.insert(bsl::make_pair(key, static_cast<Key>(i)));
+        }
+
+        bsl::vector<Key> keys;
+        keys.reserve(NUM_LOOKUP);
+        for (bsl::size_t i = 0; i < NUM_LOOKUP; ++i) {
+            const Key k = (i * 2654435761u) % NUM_ENTRIES;
+
+            keys.push_back((2 * k + (i & 1)) * MULTIPLIER);
+        }
+
+        const double y = static_cast<double>(
+                             performanceFindLarge(mY, keys).totalNanoseconds())
+                                                                  / NUM_LOOKUP;
+        const double x = static_cast<double>(
+                             performanceFindLarge(mX, keys).totalNanoseconds())
+                                                                  / NUM_LOOKUP;
+
+        cout << "bsl::unordered_map::find:  " << y << " ns/lookup" << endl;
+        cout << "bdlc::FlatHashMap::find:   " << x << " ns/lookup" << endl;
+
+        ASSERT(x < y);
+
+        const bsl::size_t RUN_LENGTHS[] = { 16, 64, 1024 };
+        enum { NUM_RUN_LENGTHS = sizeof RUN_LENGTHS / sizeof *RUN_LENGTHS };
+
+        for (int ti = 0; ti < NUM_RUN_LENGTHS; ++ti) {
+            const bsl::size_t RUN_LENGTH = RUN_LENGTHS[ti];
+
+            const double z = static_cast<double>(
+                                 performanceFindManyLarge(mX, keys, RUN_LENGTH)
+                                                          .totalNanoseconds())
+                                                                  / NUM_LOOKUP;
+
+            cout << "bdlc::FlatHashMap::findMany (runs of " << RUN_LENGTH
+                 << "): " << z << " ns/lookup, "
+                 << 100.0 * (x - z) / z << "% faster than `find`" << endl;
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
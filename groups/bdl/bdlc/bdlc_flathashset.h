@@ -1043,6 +1043,22 @@ class FlatHashSet {
         return iterator(d_impl.find(key));
     }
 
+    /// Load into consecutive positions starting at the specified `result`,
+    /// for each key in the specified range [`first`, `last`), in order, a
+    /// `const_iterator` referring to the element in this set having that
+    /// key, or `end()` if no such entry exists in this set, and return an
+    /// iterator one past the last position written.  The keys are searched
+    /// for in batches, and the memory the searches of a batch examine is
+    /// prefetched before any key of the batch is compared, so that the
+    /// cache misses incurred by looking up many keys overlap.  `KEY_ITERATOR`
+    /// shall meet the requirements of a forward iterator whose `value_type`
+    /// is convertible to `KEY`, and `OUTPUT_ITERATOR` shall meet the
+    /// requirements of an output iterator accepting `const_iterator` values.
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result) const;
+
 
     /// Return (a copy of) the unary hash functor used by this set to
     /// generate a hash value (of type `bsl::size_t`) for a `KEY` object.
@@ -1589,6 +1605,17 @@ typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
     return d_impl.find(key);
 }
 
+template <class KEY, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR FlatHashSet<KEY, HASH, EQUAL>::findMany(
+                                                  KEY_ITERATOR    first,
+                                                  KEY_ITERATOR    last,
+                                                  OUTPUT_ITERATOR result) const
+{
+    return d_impl.findMany(first, last, result);
+}
+
 template <class KEY, class HASH, class EQUAL>
 inline
 HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
@@ -156,6 +156,7 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [30] OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -176,7 +177,7 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashSet&, FlatHashSet&);
 // ----------------------------------------------------------------------------
-// [30] USAGE EXAMPLE
+// [31] USAGE EXAMPLE
 // [29] CONCERN: `find`        properly handles transparent comparators
 // [29] CONCERN: `count`       properly handles transparent comparators
 // [29] CONCERN: `contains`    properly handles transparent comparators
@@ -249,6 +250,10 @@ void aSsErT(bool condition, const char *message, int line)
 
 const bsl::uint8_t k_SIZE = bdlc::FlatHashTable_GroupControl::k_SIZE;
 
+// The capacity of a table created with a capacity of 32 (a table with a
+// non-zero capacity has at least two groups).
+const bsl::size_t k_CAPACITY_32 = 32 < 2 * k_SIZE ? 2 * k_SIZE : 32;
+
 // ============================================================================
 //                     GLOBAL VARIABLES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1570,7 +1575,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 30: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1618,6 +1623,64 @@ int main(int argc, char *argv[])
 //  100 84
 // ```
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // `findMany`
+        //   Ensure the `findMany` method operates as expected.
+        //
+        // Concerns:
+        // 1. The `findMany` method correctly forwards to the underlying
+        //    implementation and correctly forwards the return value.
+        //
+        // Plan:
+        // 1. Verify the results of `findMany` on an empty object and on an
+        //    object with several contained elements, for keys that are and
+        //    are not present.  (C-1)
+        //
+        // Testing:
+        //   OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`findMany`" << endl
+                          << "==========" << endl;
+
+        if (verbose) cout << "Testing `findMany`." << endl;
+        {
+            typedef bdlc::FlatHashSet<int> Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int KEYS[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+            enum { NUM_KEYS = sizeof KEYS / sizeof *KEYS };
+
+            Obj::const_iterator results[NUM_KEYS + 1];
+
+            ASSERT(results + NUM_KEYS == X.findMany(KEYS,
+                                                    KEYS + NUM_KEYS,
+                                                    results));
+            ASSERT(results == X.findMany(KEYS, KEYS, results));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                LOOP_ASSERT(i, X.end() == results[i]);
+            }
+
+            mX.insert(1);
+            mX.insert(2);
+            mX.insert(5);
+            mX.insert(7);
+
+            ASSERT(results + NUM_KEYS == X.findMany(KEYS,
+                                                    KEYS + NUM_KEYS,
+                                                    results));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                LOOP_ASSERT(i, X.find(KEYS[i]) == results[i]);
+            }
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // TESTING TRANSPARENT COMPARATOR
@@ -2283,15 +2346,15 @@ cout << endl
 
                 Obj mX(IDATA, 32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2332,15 +2395,15 @@ cout << endl
 
                 Obj mX(IDATA, 32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2379,15 +2442,15 @@ cout << endl
 
                 Obj mX(IDATA, 32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                  Key;
@@ -2428,15 +2491,15 @@ cout << endl
 
                 Obj mX(IDATA, 32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                         Key;
@@ -2624,15 +2687,15 @@ cout << endl
                 Obj        mX(IDATA.begin(), IDATA.begin() + 1, 32);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2678,15 +2741,15 @@ cout << endl
                               (bslma::Allocator *)0);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2727,15 +2790,15 @@ cout << endl
                 Obj        mX(IDATA.begin(), IDATA.begin() + 1, 32, hasher);
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                  Key;
@@ -2786,15 +2849,15 @@ cout << endl
                               Equal());
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.size());
+                ASSERT(         true == X.contains(1));
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
             }
             {
                 typedef bsl::string                         Key;
@@ -2862,7 +2925,7 @@ cout << endl
 
             mX.rehash(32);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.rehash(64);
 
@@ -2879,7 +2942,7 @@ cout << endl
 
             mX.reserve(28);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.reserve(56);
 
@@ -4205,12 +4268,12 @@ cout << endl
 
                 Obj mX(32, Hash(1), Equal(), &oa);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.hash_function()(0));
-                ASSERT(false == X.key_eq()(0, 0));
-                ASSERT( true == X.key_eq()(0, 1));
-                ASSERT(0.875 == X.max_load_factor());
-                ASSERT(  &oa == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            1 == X.hash_function()(0));
+                ASSERT(        false == X.key_eq()(0, 0));
+                ASSERT(         true == X.key_eq()(0, 1));
+                ASSERT(        0.875 == X.max_load_factor());
+                ASSERT(          &oa == X.allocator());
             }
         }
 
@@ -4425,13 +4488,13 @@ cout << endl
 
                 Obj mX(32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4474,13 +4537,13 @@ cout << endl
 
                 Obj mX(32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT( ExpHash()(0) == X.hash_function()(0));
+                ASSERT( ExpHash()(1) == X.hash_function()(1));
+                ASSERT( ExpHash()(7) == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4521,13 +4584,13 @@ cout << endl
 
                 Obj mX(32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4570,13 +4633,13 @@ cout << endl
 
                 Obj mX(32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(k_CAPACITY_32 == X.capacity());
+                ASSERT(            7 == X.hash_function()(0));
+                ASSERT(            7 == X.hash_function()(1));
+                ASSERT(            7 == X.hash_function()(7));
+                ASSERT(         true == X.key_eq()(0, 0));
+                ASSERT(        false == X.key_eq()(0, 1));
+                ASSERT(          &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4708,16 +4771,16 @@ cout << endl
 
             mX.clear();
 
-            ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(            0 == X.size());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.insert(1);
             mX.insert(2);
 
             mX.clear();
 
-            ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(            0 == X.size());
+            ASSERT(k_CAPACITY_32 == X.capacity());
         }
 
         if (verbose) cout << "Testing `reset`." << endl;
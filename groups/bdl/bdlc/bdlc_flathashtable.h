@@ -384,6 +384,23 @@ class FlatHashTable
     /// unless `hashValue == d_hasher(key)`.
     bsl::size_t findKey(const KEY& key, bsl::size_t hashValue) const;
 
+    /// Load into the specified `indices` the index within `d_entries_p` of
+    /// the entry containing each key in the range starting at the specified
+    /// `first` and ending at the earlier of the specified `last` and
+    /// `k_FIND_MANY_BATCH_SIZE` keys past `first`, or `d_capacity` for a key
+    /// that is not present, load the number of keys in the range into the
+    /// specified `numKeys`, and return an iterator referring to the end of
+    /// the range.  All the keys in the range are hashed, and the control
+    /// values and entries their searches examine first are prefetched,
+    /// before any key is compared.  The behavior is undefined unless
+    /// `first != last` and `indices` has at least `k_FIND_MANY_BATCH_SIZE`
+    /// elements.
+    template <class KEY_ITERATOR>
+    KEY_ITERATOR findKeys(bsl::size_t  *indices,
+                          bsl::size_t  *numKeys,
+                          KEY_ITERATOR  first,
+                          KEY_ITERATOR  last) const;
+
     /// Return the index of the entry within `d_entries_p` containing a key
     /// equivalent to the specified `key`, which has the specified `hashValue`,
     /// or `d_capacity` if a key equivalent to `key` is not present.  The
@@ -458,6 +475,11 @@ class FlatHashTable
                                                       // specifies the maximum
                                                       // load factor
 
+    static const bsl::size_t  k_FIND_MANY_BATCH_SIZE = 16;
+                                                      // number of keys whose
+                                                      // searches `findMany`
+                                                      // overlaps
+
     // CREATORS
 
     /// Create an empty table having at least the specified `capacity`, that
@@ -659,6 +681,24 @@ class FlatHashTable
         return end();
     }
 
+    /// Load into consecutive positions starting at the specified `result`,
+    /// for each key in the specified range [`first`, `last`), in order, an
+    /// iterator providing modifiable access to the object in this flat hash
+    /// table having that key, if such an entry exists, and `end()`
+    /// otherwise.  Return an iterator one past the last position written.
+    /// The keys are searched for in batches of up to
+    /// `k_FIND_MANY_BATCH_SIZE` keys: every key of a batch is hashed, and
+    /// the memory its search examines first is prefetched, before any key
+    /// of the batch is compared, so that the cache misses incurred by the
+    /// searches of a batch overlap.  `KEY_ITERATOR` shall meet the
+    /// requirements of a forward iterator whose `value_type` is convertible
+    /// to `KEY`, and `OUTPUT_ITERATOR` shall meet the requirements of an
+    /// output iterator accepting `iterator` values.
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result);
+
     /// Insert the specified `entry` into this table if the key of the
     /// `entry` does not already exist in this table; otherwise, this method
     /// has no effect.  Return a `pair` whose `first` member is an iterator
@@ -937,6 +977,24 @@ class FlatHashTable
             return end();
         }
 
+    /// Load into consecutive positions starting at the specified `result`,
+    /// for each key in the specified range [`first`, `last`), in order, an
+    /// iterator providing non-modifiable access to the object in this flat
+    /// hash table having that key, if such an entry exists, and `end()`
+    /// otherwise.  Return an iterator one past the last position written.
+    /// The keys are searched for in batches of up to
+    /// `k_FIND_MANY_BATCH_SIZE` keys: every key of a batch is hashed, and
+    /// the memory its search examines first is prefetched, before any key
+    /// of the batch is compared, so that the cache misses incurred by the
+    /// searches of a batch overlap.  `KEY_ITERATOR` shall meet the
+    /// requirements of a forward iterator whose `value_type` is convertible
+    /// to `KEY`, and `OUTPUT_ITERATOR` shall meet the requirements of an
+    /// output iterator accepting `const_iterator` values.
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result) const;
+
     /// Return (a copy of) the unary hash functor used by this flat hash
     /// table to generate a hash value (of type `bsl::size_t) for a `KEY'
     /// object.
@@ -1518,6 +1576,63 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
     return d_capacity;
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY_ITERATOR>
+KEY_ITERATOR FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKeys(
+                                               bsl::size_t  *indices,
+                                               bsl::size_t  *numKeys,
+                                               KEY_ITERATOR  first,
+                                               KEY_ITERATOR  last) const
+{
+    BSLS_ASSERT_SAFE(indices);
+    BSLS_ASSERT_SAFE(numKeys);
+    BSLS_ASSERT_SAFE(first != last);
+
+    bsl::size_t hashValues[k_FIND_MANY_BATCH_SIZE];
+
+    // Hash the keys, prefetching the first group of control values each
+    // search will examine.
+
+    bsl::size_t  n  = 0;
+    KEY_ITERATOR it = first;
+    for (; n < k_FIND_MANY_BATCH_SIZE && it != last; ++n, ++it) {
+        hashValues[n] = d_hasher(*it);
+        indices[n]    = (hashValues[n] >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+        if (d_capacity) {
+            bsls::PerformanceHint::prefetchForReading(
+                                                   d_controls_p + indices[n]);
+        }
+    }
+    *numKeys = n;
+
+    // Match the hashlets against the prefetched control values, prefetching
+    // the first candidate entry of each search.
+
+    if (d_capacity) {
+        for (bsl::size_t i = 0; i < n; ++i) {
+            bsl::uint8_t  hashlet = static_cast<bsl::uint8_t>(
+                                               hashValues[i] & k_HASHLET_MASK);
+            GroupControl  groupControl(d_controls_p + indices[i]);
+            bsl::uint32_t candidates = groupControl.match(hashlet);
+            if (candidates) {
+                bsls::PerformanceHint::prefetchForReading(
+                           d_entries_p
+                         + indices[i]
+                         + bdlb::BitUtil::numTrailingUnsetBits(candidates));
+            }
+        }
+    }
+
+    // Search for the keys, now that the memory is (likely) in the cache.
+
+    for (bsl::size_t i = 0; i < n; ++i, ++first) {
+        indices[i] = findKey(*first, hashValues[i]);
+    }
+
+    return it;
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 bsl::size_t FlatHashTable<KEY,
                           ENTRY,
@@ -1962,6 +2077,34 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
     return end();
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findMany(
+                                                        KEY_ITERATOR    first,
+                                                        KEY_ITERATOR    last,
+                                                        OUTPUT_ITERATOR result)
+{
+    bsl::size_t indices[k_FIND_MANY_BATCH_SIZE];
+
+    while (first != last) {
+        bsl::size_t numKeys;
+        first = findKeys(indices, &numKeys, first, last);
+
+        for (bsl::size_t i = 0; i < numKeys; ++i, ++result) {
+            const bsl::size_t index = indices[i];
+            if (index < d_capacity) {
+                *result = iterator(IteratorImp(d_entries_p  + index,
+                                               d_controls_p + index,
+                                               d_capacity   - index - 1));
+            }
+            else {
+                *result = end();
+            }
+        }
+    }
+    return result;
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
 bsl::pair<typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator, bool>
@@ -2286,6 +2429,35 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
     return end();
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findMany(
+                                                  KEY_ITERATOR    first,
+                                                  KEY_ITERATOR    last,
+                                                  OUTPUT_ITERATOR result) const
+{
+    bsl::size_t indices[k_FIND_MANY_BATCH_SIZE];
+
+    while (first != last) {
+        bsl::size_t numKeys;
+        first = findKeys(indices, &numKeys, first, last);
+
+        for (bsl::size_t i = 0; i < numKeys; ++i, ++result) {
+            const bsl::size_t index = indices[i];
+            if (index < d_capacity) {
+                *result = const_iterator(IteratorImp(
+                                                  d_entries_p  + index,
+                                                  d_controls_p + index,
+                                                  d_capacity   - index - 1));
+            }
+            else {
+                *result = end();
+            }
+        }
+    }
+    return result;
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
 HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
@@ -41,6 +41,7 @@
 
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 
@@ -128,6 +129,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [12] iterator find(const KEY&);
+// [24] OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry)
 // [16] void insert(INPUT_IT, INPUT_IT);
 // [19] void rehash(size_t);
@@ -150,6 +152,7 @@ using namespace bsl;
 // [ 4] const ENTRY *entries() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [12] const_iterator find(const KEY&) const;
+// [24] OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -250,6 +253,10 @@ const bsl::uint8_t k_SIZE   = GroupControl::k_SIZE;
 const bsl::uint8_t k_EMPTY  = GroupControl::k_EMPTY;
 const bsl::uint8_t k_ERASED = GroupControl::k_ERASED;
 
+// The capacity of a table created with a capacity of 32 (a table with a
+// non-zero capacity has at least two groups).
+const bsl::size_t k_CAPACITY_32 = 32 < 2 * k_SIZE ? 2 * k_SIZE : 32;
+
 // ============================================================================
 //                     GLOBAL VARIABLES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -263,7 +270,11 @@ bool veryVeryVeryVerbose;
 //                             GLOBAL TEST DATA
 // ----------------------------------------------------------------------------
 
-// Define `DEFAULT_DATA` used by test cases.
+// Define `DEFAULT_DATA` used by test cases.  When the control groups are 32
+// entries wide (see `bdlc_flathashtable_groupcontrol`), the minimum capacity
+// of a table is 64, and each specification is the one used for 16-wide
+// groups with every run of 16 entries followed by 16 empty entries; the
+// entries then have the same keys, and so the same value identifiers.
 
 struct DefaultDataRow {
     int         d_lineNum;  // source line number
@@ -278,6 +289,88 @@ static const DefaultDataRow DEFAULT_DATA[] = {
 // -^
 //LN                              spec                                    VI
 //--  ------------------------------------------------------------------  --
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+{ L_, ""                                                                ,  0 },
+
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  0 },
+{ L_, "xxxxxxxxxxxxxxxxeeeeeeeeeeeeeeeexxxxxxxxxxxxxxxxeeeeeeeeeeeeeeee",  0 },
+{ L_, "Aeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  1 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeAeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  2 },
+{ L_, "xAeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  1 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexAeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  2 },
+{ L_, "xxAeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  1 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxAeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  2 },
+{ L_, "ABeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  3 },
+{ L_, "xABeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  3 },
+{ L_, "xxABeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  3 },
+{ L_, "xxBAeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  3 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxABeeeeeeeeeeeeeeeeeeeeeeeeeeee",  4 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxBAeeeeeeeeeeeeeeeeeeeeeeeeeeee",  4 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxCDxxxxxxeeeeeeeeeeeeeeee", 12 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxxxxxxxCDeeeeeeeeeeeeeeee", 12 },
+{ L_, "xxABCeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  9 },
+{ L_, "xxBACeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  9 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxABCeeeeeeeeeeeeeeeeeeeeeeeeeee", 11 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxBACeeeeeeeeeeeeeeeeeeeeeeeeeee", 11 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxCBDeeeeeeeeeeeeeeeeeeeee", 13 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxxxxxxCBDeeeeeeeeeeeeeeee", 13 },
+{ L_, "xxxxxxxAxxxxxxxxeeeeeeeeeeeeeeeexxxxxxxxBxxxxxxxeeeeeeeeeeeeeeee",  5 },
+
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  0 },
+{ L_, "xxxxxxxxxxxxxxxxeeeeeeeeeeeeeeeexxxxxxxxxxxxxxxxeeeeeeeeeeeeeeee"
+      "xxxxxxxxxxxxxxxxeeeeeeeeeeeeeeeexxxxxxxxxxxxxxxxeeeeeeeeeeeeeeee",  0 },
+{ L_, "Aeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  1 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeAeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  6 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "Aeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  2 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeAeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  7 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexAeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  7 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxAeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  7 },
+{ L_, "ABeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  3 },
+{ L_, "xABeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  3 },
+{ L_, "xxABeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  3 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeABeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  8 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexABeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  8 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxABeeeeeeeeeeeeeeeeeeeeeeeeeeee",  8 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxCDxxxxxxeeeeeeeeeeeeeeee", 14 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxxxxxxxCDeeeeeeeeeeeeeeee", 14 },
+{ L_, "ABCeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  9 },
+{ L_, "xABCeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  9 },
+{ L_, "xxABCeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  9 },
+{ L_, "BACeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  9 },
+{ L_, "xBACeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  9 },
+{ L_, "xxBACeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee",  9 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeABCeeeeeeeeeeeeeeeeeeeeeeeeeeeee", 10 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexABCeeeeeeeeeeeeeeeeeeeeeeeeeeee", 10 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxABCeeeeeeeeeeeeeeeeeeeeeeeeeee", 10 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxADCeeeeeeeeeeeeeeeeeeeee", 15 },
+{ L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+      "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxxxxxxADCeeeeeeeeeeeeeeee", 15 },
+#else
 { L_, ""                                                                ,  0 },
 
 { L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"                                ,  0 },
@@ -331,6 +424,7 @@ static const DefaultDataRow DEFAULT_DATA[] = {
 { L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxABCeeeeeeeeeee", 10 },
 { L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxADCeeeee", 15 },
 { L_, "eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeexxxxxxxxxxxxxADC", 15 },
+#endif
 // -v
 };
 
@@ -3458,7 +3552,7 @@ void testCase2EraseAndReInsert(int id)
             }
 
             // store `controls` for later comparison
-            bsl::uint8_t originalControls[128];
+            bsl::uint8_t originalControls[8 * k_SIZE];
             bsl::memcpy(originalControls, X.controls(), X.capacity());
 
             // erase the `key`
@@ -3521,6 +3615,73 @@ void testCase2EraseAndReInsert(int id)
     }
 }
 
+/// Verify, for a table using the (template parameter) `HASH`, that
+/// `findMany` loads the same iterators as `find` for a permutation of the
+/// specified `numKeys` keys `[0 .. numKeys)`, of which the odd keys are
+/// present in the table.  Note that, in case of a test failure, the
+/// specified `id` can be used to determine `HASH`.
+template <class HASH>
+void testCase24FindMany(int id, int numKeys)
+{
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    typedef TestEntryUtil<int>                                    EntryUtil;
+    typedef bsl::equal_to<int>                                    Equal;
+    typedef bdlc::FlatHashTable<int, int, EntryUtil, HASH, Equal> Obj;
+
+    Obj mX(0, HASH(), Equal(), &oa);  const Obj& X = mX;
+
+    bsl::vector<int> keys(&oa);
+    for (int i = 0; i < numKeys; ++i) {
+        if (i % 2) {
+            mX.insert(i);
+        }
+
+        // Query the keys in an order unrelated to their insertion.
+
+        keys.push_back((i * 7) % numKeys);
+    }
+
+    // Test the manipulator.
+
+    {
+        typedef typename Obj::iterator Iterator;
+
+        bsl::vector<Iterator> results(&oa);
+        mX.findMany(keys.begin(), keys.end(), bsl::back_inserter(results));
+
+        LOOP2_ASSERT(id, numKeys, keys.size() == results.size());
+
+        for (bsl::size_t i = 0; i < results.size(); ++i) {
+            LOOP3_ASSERT(id, numKeys, i, mX.find(keys[i]) == results[i]);
+            LOOP3_ASSERT(id,
+                         numKeys,
+                         i,
+                         (keys[i] % 2 != 0) == (mX.end() != results[i]));
+        }
+    }
+
+    // Test the accessor, writing through a pointer.
+
+    {
+        typedef typename Obj::const_iterator ConstIterator;
+
+        bsl::vector<ConstIterator> results(keys.size() + 1, X.end(), &oa);
+
+        ConstIterator *end = X.findMany(keys.begin(),
+                                        keys.end(),
+                                        results.data());
+
+        LOOP2_ASSERT(id,
+                     numKeys,
+                     results.data() + keys.size() == end);
+
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            LOOP3_ASSERT(id, numKeys, i, X.find(keys[i]) == results[i]);
+        }
+    }
+}
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -3553,6 +3714,67 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 24: {
+        // --------------------------------------------------------------------
+        // TESTING `findMany`
+        //
+        // Concerns:
+        // 1. `findMany` loads, for each key in the range and in order, the
+        //    iterator that `find` returns for the key, whether or not the key
+        //    is present.
+        //
+        // 2. `findMany` returns an iterator one past the last position
+        //    written, and writes nothing for an empty range.
+        //
+        // 3. Ranges shorter than, equal to, and longer than (including not a
+        //    multiple of) `k_FIND_MANY_BATCH_SIZE` are handled.
+        //
+        // 4. Tables in the zero-capacity state, and tables whose keys collide
+        //    (so that searches examine several groups), are handled.
+        //
+        // 5. The manipulator and the accessor behave the same.
+        //
+        // Plan:
+        // 1. For hash functors producing well-distributed, clustered, and
+        //    identical hash values, and for various numbers of keys, create a
+        //    table holding every second key, invoke `findMany` on a
+        //    permutation of the keys, and compare the results with those of
+        //    `find`.  (C-1..5)
+        //
+        // Testing:
+        //   OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER);
+        //   OUTPUT_ITER findMany(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n" "TESTING `findMany`" "\n"
+                                 "==================" "\n");
+
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    TestEntryUtil<int>,
+                                    bsl::hash<int>,
+                                    bsl::equal_to<int> > Obj;
+
+        const int BATCH = static_cast<int>(Obj::k_FIND_MANY_BATCH_SIZE);
+
+        const int NUM_KEYS[] = { 0, 1, 2, BATCH - 1, BATCH, BATCH + 1,
+                                 2 * BATCH, 3 * BATCH + 5, 1000 };
+        enum { NUM_NUM_KEYS = sizeof NUM_KEYS / sizeof *NUM_KEYS };
+
+        for (int ti = 0; ti < NUM_NUM_KEYS; ++ti) {
+            const int N = NUM_KEYS[ti];
+
+            if (veryVerbose) {
+                printf("\tTesting %d keys.\n", N);
+            }
+
+            testCase24FindMany<bsl::hash<int> >(0, N);
+            testCase24FindMany<IntValueIsHash>(1, N);
+            if (N <= 2 * BATCH) {
+                testCase24FindMany<IntZeroHash>(2, N);
+            }
+        }
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // TESTING TRANSPARENT OPERATIONS
@@ -4312,7 +4534,7 @@ int main(int argc, char *argv[])
 
             mX.reserve(16);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.insert(0);
 
@@ -6035,9 +6257,9 @@ int main(int argc, char *argv[])
                 {
                     Obj mX(32, Hash(), Equal());  const Obj& X = mX;
 
-                    ASSERT(   32 == X.capacity());
-                    ASSERT(0.875 == X.max_load_factor());
-                    ASSERT(  &da == X.allocator());
+                    ASSERT(k_CAPACITY_32 == X.capacity());
+                    ASSERT(        0.875 == X.max_load_factor());
+                    ASSERT(          &da == X.allocator());
                 }
                 ASSERT(2 == da.numAllocations());
                 ASSERT(0 == da.numBytesInUse());
@@ -6059,9 +6281,9 @@ int main(int argc, char *argv[])
                 {
                     Obj mX(32, Hash(), Equal(), &oa);  const Obj& X = mX;
 
-                    ASSERT(   32 == X.capacity());
-                    ASSERT(0.875 == X.max_load_factor());
-                    ASSERT(  &oa == X.allocator());
+                    ASSERT(k_CAPACITY_32 == X.capacity());
+                    ASSERT(        0.875 == X.max_load_factor());
+                    ASSERT(          &oa == X.allocator());
                 }
                 ASSERT(4 == da.numAllocations());
                 ASSERT(0 == da.numBytesInUse());
@@ -6105,7 +6327,32 @@ int main(int argc, char *argv[])
                 ASSERT(k_EMPTY == X.controls()[16]);
                 ASSERT(k_EMPTY == X.controls()[24]);
 
-                if (16 == k_SIZE) {
+                if (32 == k_SIZE) {
+                    mX.insert(0x0021);
+                    ASSERT(     1 == X.size());
+                    ASSERT(  0x21 == X.controls()[ 0]);
+                    ASSERT(0x0021 == X.entries()[ 0]);
+
+                    mX.insert(0x4022);
+                    ASSERT(     2 == X.size());
+                    ASSERT(  0x22 == X.controls()[ 1]);
+                    ASSERT(0x4022 == X.entries()[ 1]);
+
+                    mX.insert(0x8023);
+                    ASSERT(     3 == X.size());
+                    ASSERT(  0x23 == X.controls()[32]);
+                    ASSERT(0x8023 == X.entries()[32]);
+
+                    mX.insert(0xC024);
+                    ASSERT(     4 == X.size());
+                    ASSERT(  0x24 == X.controls()[33]);
+                    ASSERT(0xC024 == X.entries()[33]);
+
+                    mX.erase(0x4022);
+                    ASSERT(       3 == X.size());
+                    ASSERT(k_ERASED == X.controls()[ 1]);
+                }
+                else if (16 == k_SIZE) {
                     mX.insert(0x0021);
                     ASSERT(     1 == X.size());
                     ASSERT(  0x21 == X.controls()[ 0]);
@@ -6547,8 +6794,8 @@ int main(int argc, char *argv[])
 
                 {
                     Obj mX(31, Hash(), Equal());  const Obj& X = mX;
-                    ASSERT( 32 == X.capacity());
-                    ASSERT(&da == X.allocator());
+                    ASSERT(k_CAPACITY_32 == X.capacity());
+                    ASSERT(          &da == X.allocator());
                 }
                 ASSERT(2 == da.numAllocations());
                 ASSERT(0 == da.numBytesInUse());
@@ -6557,8 +6804,8 @@ int main(int argc, char *argv[])
 
                 {
                     Obj mX(32, Hash(), Equal(), 0);  const Obj& X = mX;
-                    ASSERT( 32 == X.capacity());
-                    ASSERT(&da == X.allocator());
+                    ASSERT(k_CAPACITY_32 == X.capacity());
+                    ASSERT(          &da == X.allocator());
                 }
                 ASSERT(4 == da.numAllocations());
                 ASSERT(0 == da.numBytesInUse());
@@ -6588,13 +6835,26 @@ int main(int argc, char *argv[])
 
             Obj mX(32, Hash(), Equal(), &oa);  const Obj& X = mX;
 
-            ASSERT(     32 == X.capacity());
-            ASSERT(k_EMPTY == X.controls()[ 0]);
-            ASSERT(k_EMPTY == X.controls()[ 8]);
-            ASSERT(k_EMPTY == X.controls()[16]);
-            ASSERT(k_EMPTY == X.controls()[24]);
+            ASSERT(k_CAPACITY_32 == X.capacity());
+            ASSERT(      k_EMPTY == X.controls()[ 0]);
+            ASSERT(      k_EMPTY == X.controls()[ 8]);
+            ASSERT(      k_EMPTY == X.controls()[16]);
+            ASSERT(      k_EMPTY == X.controls()[24]);
 
-            if (16 == k_SIZE) {
+            if (32 == k_SIZE) {
+                mX.insert(0x0021);
+                ASSERT(0x21 == X.controls()[ 0]);
+
+                mX.insert(0x4022);
+                ASSERT(0x22 == X.controls()[ 1]);
+
+                mX.insert(0x8023);
+                ASSERT(0x23 == X.controls()[32]);
+
+                mX.insert(0xC024);
+                ASSERT(0x24 == X.controls()[33]);
+            }
+            else if (16 == k_SIZE) {
                 mX.insert(0x0021);
                 ASSERT(0x21 == X.controls()[ 0]);
 
@@ -15,6 +15,25 @@ BSLS_IDENT("$Id: $")
 // of flat hash table control values.  Note that the number of entries in a
 // group control and the inquiry performance is platform dependant.
 //
+///Group Width
+///-----------
+// On platforms supporting SSE2 a group control has 16 entries, and the
+// inquiries are implemented with SSE2 instructions; on other platforms a group
+// control has 8 entries, and the inquiries are implemented with portable
+// 64-bit arithmetic.
+//
+// If the macro `BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2` is defined and the
+// build targets a platform supporting AVX2 (i.e., `BSLS_PLATFORM_CPU_AVX2` is
+// defined), a group control has 32 entries, and the inquiries are implemented
+// with AVX2 instructions.  Wider groups let a flat hash table examine more
+// candidate entries per probe, which reduces the number of probes on tables
+// with long collision runs.
+//
+// Note that the number of entries in a group control determines where entries
+// are placed in a flat hash table, so the group width is selected at compile
+// time, and the choice must be the same for every translation unit in a
+// program; consequently, the AVX2 implementation is enabled only on request.
+//
 // The flat hash map/set/table data structures are inspired by Google's
 // flat_hash_map CppCon presentations (available on youtube).  The
 // implementations draw from Google's open source `raw_hash_set.h` file at:
@@ -35,6 +54,11 @@ BSLS_IDENT("$Id: $")
 #include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2) &&                    \
+    defined(BSLS_PLATFORM_CPU_AVX2)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2 1
+#endif
+
 #if defined(BSLS_PLATFORM_CPU_SSE2)
 #include <immintrin.h>
 #include <emmintrin.h>
@@ -53,7 +77,9 @@ class FlatHashTable_GroupControl
 {
   public:
     // TYPES
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    typedef __m256i       Storage;
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
     typedef __m128i       Storage;
 #else
     typedef bsl::uint64_t Storage;
@@ -131,7 +157,11 @@ class FlatHashTable_GroupControl
 inline
 bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                                    _mm256_set1_epi8(static_cast<char>(value)),
+                                    d_value)));
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
     return _mm_movemask_epi8(_mm_cmpeq_epi8(
                                        _mm_set1_epi8(static_cast<char>(value)),
                                        d_value));
@@ -152,7 +182,10 @@ inline
 FlatHashTable_GroupControl::FlatHashTable_GroupControl(
                                                       const bsl::uint8_t *data)
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    d_value = _mm256_loadu_si256(static_cast<const Storage *>(
+                                             static_cast<const void *>(data)));
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
     d_value = _mm_loadu_si128(static_cast<const Storage *>(
                                              static_cast<const void *>(data)));
 #else
@@ -165,7 +198,9 @@ FlatHashTable_GroupControl::FlatHashTable_GroupControl(
 inline
 bsl::uint32_t FlatHashTable_GroupControl::available() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(d_value));
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
     return _mm_movemask_epi8(d_value);
 #else
     return static_cast<bsl::uint32_t>(
@@ -176,7 +211,9 @@ bsl::uint32_t FlatHashTable_GroupControl::available() const
 inline
 bsl::uint32_t FlatHashTable_GroupControl::inUse() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return ~available();
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
     return (~available()) & 0xFFFF;
 #else
     return (~available()) & 0xFF;
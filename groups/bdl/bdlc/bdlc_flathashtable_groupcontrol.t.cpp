@@ -117,6 +117,14 @@ const bsl::uint8_t VC = 0x01;
 const bsl::uint8_t VD = 0x10;
 const bsl::uint8_t VE = 0x11;
 
+// The maximum number of entries in a group control, over all platforms and
+// build configurations; test data arrays have this many entries so that they
+// can be used whatever the value of `Obj::k_SIZE`.
+
+const bsl::size_t k_MAX_SIZE = 32;
+
+BSLMF_ASSERT(Obj::k_SIZE <= k_MAX_SIZE);
+
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -271,10 +279,12 @@ int main(int argc, char *argv[])
         if (verbose) cout << "\nTesting accessors." << endl;
 
         {
-            bsl::uint8_t BACKGROUND[][16] =
+            bsl::uint8_t BACKGROUND[][k_MAX_SIZE] =
                        {
-                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
-                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
+                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
+                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,
+                             XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
                        };
             const bsl::size_t NUM_BACKGROUND
                                       = sizeof BACKGROUND / sizeof *BACKGROUND;
@@ -289,8 +299,8 @@ int main(int argc, char *argv[])
             }
             { // depth 1
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 
                     for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                         for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -303,8 +313,8 @@ int main(int argc, char *argv[])
             }
             { // depth 2
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
             //------^
             for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                 for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -324,8 +334,8 @@ int main(int argc, char *argv[])
             }
             { // depth 3
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
         //----------^
         for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -351,8 +361,8 @@ int main(int argc, char *argv[])
             }
             { // depth 4
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 //------------------^
 for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
     for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -388,8 +398,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
         {
             bsls::AssertTestHandlerGuard hG;
 
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -426,8 +437,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "========" << endl;
 
         {
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -440,8 +452,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
-                           { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -454,8 +467,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,
+                             XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -488,8 +502,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "BREATHING TEST" << endl
                           << "==============" << endl;
 
-        bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+        bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
         Obj mX(data);  const Obj& X = mX;
 
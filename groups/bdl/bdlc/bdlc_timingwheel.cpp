@@ -0,0 +1,325 @@
+// bdlc_timingwheel.cpp                                               -*-C++-*-
+#include <bdlc_timingwheel.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlc_timingwheel_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+///Implementation Notes
+///--------------------
+// A link is placed at the level numbered by the most significant group of
+// `k_BITS_PER_LEVEL` bits in which its (biased) time differs from the current
+// time, and in the slot of that level numbered by the value of that group of
+// bits of its time.  Because the current time never exceeds the time of any
+// link (other than an overdue one), the links of level `L` agree with the
+// current time above group `L` and exceed it in group `L` (or, for level 0,
+// equal or exceed it).  It follows that:
+//
+// * every link at a level precedes every link at a higher level, and
+// * the slots of a level are in ascending order of time, so the earliest
+//   non-empty slot of the lowest non-empty level holds the earliest links.
+//
+// When the current time is advanced to the start of the earliest non-empty
+// slot of level `L`, the placement of every other link remains valid, and the
+// links of that slot now agree with the current time in group `L`, so they
+// are re-placed at lower levels.
+//
+// The earliest link of a slot above level 0 is therefore the earliest link of
+// the wheel whenever its slot is the earliest non-empty one.  Rather than
+// cascade the slot to find it, which would advance the current time beyond
+// the time reached by the client and make later insertions overdue, `front`
+// returns the earliest link cached for the slot.  The cache is maintained on
+// insertion and invalidated when the cached link is removed; `front` then
+// finds it again by examining the slot.
+
+namespace BloombergLP {
+namespace bdlc {
+
+                             // -----------------
+                             // class TimingWheel
+                             // -----------------
+
+// PRIVATE MANIPULATORS
+void TimingWheel::cascade(int slot)
+{
+    BSLS_ASSERT(k_SLOTS_PER_LEVEL <= slot);
+    BSLS_ASSERT(slot == earliestSlot());
+
+    d_currentTick = slotStart(slot);
+
+    TimingWheelLink *link = d_slots[slot];
+    TimingWheelLink *last = link->d_prev_p;
+
+    d_slots[slot]    = 0;
+    d_earliest[slot] = 0;
+    d_occupied[slot / k_SLOTS_PER_LEVEL] &=
+                                 ~(1ULL << (slot & (k_SLOTS_PER_LEVEL - 1)));
+
+    // Re-place the links in their original order, so that links having the
+    // same time remain in the order they were inserted.
+
+    while (true) {
+        TimingWheelLink *next = link->d_next_p;
+        place(link);
+        if (link == last) {
+            break;
+        }
+        link = next;
+    }
+}
+
+void TimingWheel::linkOverdue(TimingWheelLink *link)
+{
+    TimingWheelLink *first = d_slots[k_OVERDUE_SLOT];
+
+    if (0 == first || first->d_tick > link->d_tick) {
+        linkToSlot(link, k_OVERDUE_SLOT);
+        d_slots[k_OVERDUE_SLOT] = link;
+        return;                                                       // RETURN
+    }
+
+    // Search backwards from the last overdue link, so that links inserted in
+    // ascending order of time are appended in constant time.
+
+    TimingWheelLink *prev = first->d_prev_p;
+    while (prev->d_tick > link->d_tick) {
+        prev = prev->d_prev_p;
+    }
+
+    link->d_prev_p           = prev;
+    link->d_next_p           = prev->d_next_p;
+    prev->d_next_p->d_prev_p = link;
+    prev->d_next_p           = link;
+    link->d_slot             = k_OVERDUE_SLOT;
+}
+
+void TimingWheel::place(TimingWheelLink *link)
+{
+    const bsls::Types::Uint64 tick = link->d_tick;
+
+    if (tick < d_currentTick) {
+        linkOverdue(link);
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Uint64 diff = tick ^ d_currentTick;
+
+    int level = 0;
+    if (diff) {
+        level = (63 - bdlb::BitUtil::numLeadingUnsetBits(diff)) /
+                                                              k_BITS_PER_LEVEL;
+    }
+
+    const int index = static_cast<int>((tick >> (level * k_BITS_PER_LEVEL)) &
+                                       (k_SLOTS_PER_LEVEL - 1));
+
+    linkToSlot(link, level * k_SLOTS_PER_LEVEL + index);
+}
+
+TimingWheelLink *TimingWheel::takeFirst(int slot)
+{
+    TimingWheelLink *link = d_slots[slot];
+
+    BSLS_ASSERT(link);
+
+    unlinkFromSlot(link);
+    return link;
+}
+
+// PRIVATE ACCESSORS
+int TimingWheel::earliestSlot() const
+{
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        const bsls::Types::Uint64 occupied = d_occupied[level];
+        if (occupied) {
+            return level * k_SLOTS_PER_LEVEL +                        // RETURN
+                                bdlb::BitUtil::numTrailingUnsetBits(occupied);
+        }
+    }
+    return -1;
+}
+
+bsls::Types::Uint64 TimingWheel::slotStart(int slot) const
+{
+    const int level = slot / k_SLOTS_PER_LEVEL;
+    const int shift = level * k_BITS_PER_LEVEL;
+    const int width = shift + k_BITS_PER_LEVEL;
+
+    const bsls::Types::Uint64 index = slot & (k_SLOTS_PER_LEVEL - 1);
+    const bsls::Types::Uint64 above = width < 64
+                                    ? d_currentTick & ~((1ULL << width) - 1)
+                                    : 0;
+
+    return above | (index << shift);
+}
+
+// CREATORS
+TimingWheel::TimingWheel(bsls::Types::Int64 currentTime)
+: d_currentTick(toTick(currentTime))
+, d_length(0)
+{
+    for (int i = 0; i <= k_NUM_SLOTS; ++i) {
+        d_slots[i]    = 0;
+        d_earliest[i] = 0;
+    }
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        d_occupied[i] = 0;
+    }
+}
+
+// MANIPULATORS
+void TimingWheel::advance(bsls::Types::Int64 time)
+{
+    const bsls::Types::Uint64 limit = toTick(time);
+
+    while (true) {
+        const int slot = earliestSlot();
+        if (slot < k_SLOTS_PER_LEVEL || slotStart(slot) > limit) {
+            break;
+        }
+        cascade(slot);
+    }
+}
+
+TimingWheelLink *TimingWheel::front()
+{
+    if (d_slots[k_OVERDUE_SLOT]) {
+        return d_slots[k_OVERDUE_SLOT];                               // RETURN
+    }
+
+    const int slot = earliestSlot();
+    if (slot < 0) {
+        return 0;                                                     // RETURN
+    }
+
+    TimingWheelLink *earliest = d_earliest[slot];
+    if (0 == earliest) {
+        // The earliest link of the slot was removed.  Find the new one,
+        // preferring the first of links having the same time.
+
+        TimingWheelLink *first = d_slots[slot];
+
+        earliest = first;
+        for (TimingWheelLink *link = first->d_next_p;
+             link != first;
+             link = link->d_next_p) {
+            if (link->d_tick < earliest->d_tick) {
+                earliest = link;
+            }
+        }
+        d_earliest[slot] = earliest;
+    }
+    return earliest;
+}
+
+TimingWheelLink *TimingWheel::popLE(bsls::Types::Int64 time)
+{
+    const bsls::Types::Uint64   limit = toTick(time);
+    TimingWheelLink            *head  = 0;
+    TimingWheelLink           **tail  = &head;
+
+    // Overdue links precede every other link.
+
+    while (d_slots[k_OVERDUE_SLOT] &&
+                                 d_slots[k_OVERDUE_SLOT]->d_tick <= limit) {
+        TimingWheelLink *link = takeFirst(k_OVERDUE_SLOT);
+        *tail = link;
+        tail  = &link->d_next_p;
+        --d_length;
+    }
+
+    while (true) {
+        const int slot = earliestSlot();
+        if (slot < 0 || slotStart(slot) > limit) {
+            break;
+        }
+        if (k_SLOTS_PER_LEVEL <= slot) {
+            cascade(slot);
+            continue;
+        }
+
+        // Every link of a slot of level 0 has the time at which the slot
+        // starts, so the whole slot expires.
+
+        d_currentTick = slotStart(slot);
+
+        TimingWheelLink *link = d_slots[slot];
+        TimingWheelLink *last = link->d_prev_p;
+
+        d_slots[slot]    = 0;
+        d_earliest[slot] = 0;
+        d_occupied[0] &= ~(1ULL << slot);
+
+        *tail = link;
+        while (true) {
+            link->d_prev_p = 0;
+            link->d_slot   = k_UNLINKED;
+            --d_length;
+            if (link == last) {
+                break;
+            }
+            link = link->d_next_p;
+        }
+        tail = &last->d_next_p;
+    }
+
+    *tail = 0;
+    return head;
+}
+
+TimingWheelLink *TimingWheel::removeAll()
+{
+    TimingWheelLink  *head = 0;
+    TimingWheelLink **tail = &head;
+
+    for (int slot = 0; slot <= k_NUM_SLOTS; ++slot) {
+        TimingWheelLink *link = d_slots[slot];
+        if (0 == link) {
+            continue;
+        }
+
+        TimingWheelLink *last = link->d_prev_p;
+
+        d_slots[slot]    = 0;
+        d_earliest[slot] = 0;
+
+        *tail = link;
+        while (true) {
+            link->d_prev_p = 0;
+            link->d_slot   = k_UNLINKED;
+            if (link == last) {
+                break;
+            }
+            link = link->d_next_p;
+        }
+        tail = &last->d_next_p;
+    }
+    *tail = 0;
+
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        d_occupied[i] = 0;
+    }
+    d_length = 0;
+
+    return head;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
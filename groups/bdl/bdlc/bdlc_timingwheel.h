@@ -0,0 +1,588 @@
+// bdlc_timingwheel.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_TIMINGWHEEL
+#define INCLUDED_BDLC_TIMINGWHEEL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hierarchical timing wheel of intrusive timer links.
+//
+//@CLASSES:
+//  bdlc::TimingWheel: hierarchical timing wheel with O(1) insert and remove
+//  bdlc::TimingWheelLink: intrusive link stored in a `bdlc::TimingWheel`
+//  bdlc::TimerStoreType: namespace for an enumeration of timer stores
+//
+//@SEE_ALSO: bdlcc_timequeue, bdlmt_eventscheduler
+//
+//@DESCRIPTION: This component provides a mechanism, `bdlc::TimingWheel`, that
+// orders intrusive `bdlc::TimingWheelLink` objects by an associated 64-bit
+// integral time, such as the number of microseconds since some epoch.  Links
+// are inserted and removed in constant time, and all links that have expired
+// by a given time are removed as a batch, in ascending order of time, by
+// `popLE`.  The wheel does not allocate memory: links are supplied, and
+// owned, by the client, typically as a base class or member of the client's
+// own node type.
+//
+// This component also provides `bdlc::TimerStoreType`, an enumeration that
+// timer mechanisms, such as `bdlcc::TimeQueue` and `bdlmt::EventScheduler`,
+// accept at construction to select between their ordered (tree or skip list)
+// store and a store based on `bdlc::TimingWheel`.
+//
+///Structure
+///---------
+// The wheel consists of 11 levels of 64 slots each; every level covers 64
+// times the range of the level below it, so that together the levels span
+// the full range of a 64-bit time.  The wheel maintains a *current* *time*
+// that never exceeds the time of any link in the wheel.  A link is placed at
+// the lowest level whose range, relative to the current time, contains the
+// link's time; every link in a slot of level 0 therefore has the same time.
+// As the current time advances (see `advance` and `popLE`), the links in a
+// slot of a higher level are redistributed, or *cascaded*, to lower levels;
+// each link is cascaded at most once per level.  A bit mask per level records
+// which of its slots are occupied, so that the earliest occupied slot is
+// found without scanning empty ones, and the earliest link of each slot is
+// cached, so that `front` need not cascade.
+//
+// A link inserted with a time earlier than the current time is placed in a
+// separate list of *overdue* links, which is kept in order of time.  The
+// current time advances only when `advance` or `popLE` is called, and never
+// beyond the time supplied to them, so this is uncommon: it happens only for
+// times that the client has already reported as reached.  Inserting an
+// overdue link takes time linear in the number of overdue links later than
+// it, which is constant when overdue links are inserted in ascending order of
+// time.
+//
+// Links having the same time are returned in the order they were inserted.
+//
+///Performance
+///-----------
+// The following table characterizes the performance of the operations of
+// `bdlc::TimingWheel`, where `N` is the number of links in the wheel, `K` is
+// the number of links removed, and `L` is the number of levels of the wheel:
+// ```
+//  Operation           Complexity
+//  ---------           ----------
+//  insert              O[1] (1)
+//  remove              O[1]
+//  advance             O[1] amortized (2)
+//  front               O[1] (3)
+//  popLE               O[K] amortized (2)
+//  removeAll           O[N]
+//  length              O[1]
+// ```
+// 1. Inserting an overdue link is linear in the number of overdue links later
+//    than it; see {Structure}.
+//
+// 2. The cost of cascading a link, at most `L` times over its lifetime, is
+//    included in the amortized cost.
+//
+// 3. After the earliest link of a slot above level 0 is removed, the next
+//    call to `front` that returns a link of that slot examines each of its
+//    links.  Calling `advance` with the current time of the client before
+//    removing links that have expired avoids this.
+//
+///Thread Safety
+///-------------
+// `bdlc::TimingWheel` is *not* thread-safe; concurrent access to the same
+// wheel must be synchronized by the client.  Note that `front` is a
+// manipulator, since it maintains the cached earliest link of a slot.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Expiring Session Timeouts
+/// - - - - - - - - - - - - - - - - - -
+// Suppose a server tracks an idle timeout for each of its sessions.  Most
+// timeouts are cancelled and rescheduled as traffic arrives, and only a few
+// of them ever expire.  A `bdlc::TimingWheel` lets us schedule and cancel a
+// timeout in constant time.
+//
+// First, we define a session type that derives from `bdlc::TimingWheelLink`,
+// so that its link represents its idle timeout, and a function to recover the
+// session from its link:
+// ```
+// struct Session : bdlc::TimingWheelLink {
+//     int d_id;  // session id
+// };
+//
+// Session *sessionFromLink(bdlc::TimingWheelLink *link)
+// {
+//     return static_cast<Session *>(link);
+// }
+// ```
+// Then, we create a wheel whose current time is 0, measured in milliseconds,
+// and schedule a timeout for each of three sessions:
+// ```
+// bdlc::TimingWheel wheel;
+//
+// Session sessions[3];
+// for (int i = 0; i < 3; ++i) {
+//     sessions[i].d_id = i;
+//     wheel.insert(&sessions[i], 1000 + 100 * i);
+// }
+// assert(3 == wheel.length());
+// assert(&sessions[0] == wheel.front());
+// ```
+// Next, traffic arrives on session 0, so we push its timeout back:
+// ```
+// wheel.remove(&sessions[0]);
+// wheel.insert(&sessions[0], 1500);
+// ```
+// Now, at time 1200, we collect the timeouts that have expired:
+// ```
+// bdlc::TimingWheelLink *expired = wheel.popLE(1200);
+//
+// assert(1 == sessionFromLink(expired)->d_id);
+// expired = expired->next();
+// assert(2 == sessionFromLink(expired)->d_id);
+// assert(0 == expired->next());
+// ```
+// Finally, we observe that only the timeout of session 0 remains:
+// ```
+// assert(1 == wheel.length());
+// assert(1500 == wheel.front()->time());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+class TimingWheel;
+
+                            // =====================
+                            // struct TimerStoreType
+                            // =====================
+
+/// This `struct` provides a namespace for enumerating the kinds of store
+/// that timer mechanisms may use to order their timers.
+struct TimerStoreType {
+
+    // TYPES
+    enum Enum {
+        e_ORDERED,      // an ordered store (tree or skip list); O[log(N)]
+                        // insert and remove
+
+        e_TIMING_WHEEL  // a `bdlc::TimingWheel`; O[1] insert and remove
+    };
+};
+
+                           // =====================
+                           // class TimingWheelLink
+                           // =====================
+
+/// This class provides the intrusive link by which a client object is held
+/// in a `TimingWheel`.  A link is in at most one wheel at a time.  Links
+/// removed from a wheel as a batch (see `TimingWheel::popLE` and
+/// `TimingWheel::removeAll`) are chained together, and the chain is
+/// traversed with `next`.
+class TimingWheelLink {
+
+    // DATA
+    TimingWheelLink     *d_next_p;  // next link in the slot or chain
+
+    TimingWheelLink     *d_prev_p;  // previous link in the slot
+
+    bsls::Types::Uint64  d_tick;    // time, biased to order as unsigned
+
+    int                  d_slot;    // slot holding this link, or
+                                    // `k_UNLINKED`
+
+    // FRIENDS
+    friend class TimingWheel;
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheelLink(const TimingWheelLink&) BSLS_KEYWORD_DELETED;
+    TimingWheelLink& operator=(const TimingWheelLink&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a link that is not in any wheel.
+    TimingWheelLink();
+
+    /// Destroy this object.  The behavior is undefined unless this link is
+    /// not in a wheel.
+    ~TimingWheelLink();
+
+    // ACCESSORS
+
+    /// Return `true` if this link is in a wheel, and `false` otherwise.
+    bool isLinked() const;
+
+    /// Return the address of the link that follows this link in the chain
+    /// of links returned by the `TimingWheel` method that removed it, or 0
+    /// if this link is the last one in the chain or was removed by
+    /// `TimingWheel::remove`.  The behavior is undefined if this link is in
+    /// a wheel.
+    TimingWheelLink *next() const;
+
+    /// Return the time with which this link was most recently inserted into
+    /// a wheel.
+    bsls::Types::Int64 time() const;
+};
+
+                             // =================
+                             // class TimingWheel
+                             // =================
+
+/// This mechanism orders `TimingWheelLink` objects by their time using a
+/// hierarchical timing wheel.  See {Structure} in the component
+/// documentation.
+class TimingWheel {
+
+  public:
+    // CONSTANTS
+    enum {
+        k_BITS_PER_LEVEL  = 6,                        // bits of time decoded
+                                                      // by each level
+
+        k_SLOTS_PER_LEVEL = 1 << k_BITS_PER_LEVEL,    // slots in each level
+
+        k_NUM_LEVELS      = (64 + k_BITS_PER_LEVEL - 1) / k_BITS_PER_LEVEL
+                                                      // levels in the wheel
+    };
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_SLOTS    = k_NUM_LEVELS * k_SLOTS_PER_LEVEL,
+        k_OVERDUE_SLOT = k_NUM_SLOTS,   // index of the list of overdue links
+        k_UNLINKED     = -1             // slot of a link not in a wheel
+    };
+
+    // DATA
+    TimingWheelLink     *d_slots[k_NUM_SLOTS + 1];
+                                           // first link of each slot, and of
+                                           // the list of overdue links
+
+    TimingWheelLink     *d_earliest[k_NUM_SLOTS + 1];
+                                           // earliest link of each slot, or 0
+                                           // if the slot is empty or its
+                                           // earliest link is not known
+
+    bsls::Types::Uint64  d_occupied[k_NUM_LEVELS];
+                                           // bit mask of non-empty slots of
+                                           // each level
+
+    bsls::Types::Uint64  d_currentTick;    // current time, biased
+
+    bsl::size_t          d_length;         // number of links in the wheel
+
+    // FRIENDS
+    friend class TimingWheelLink;
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the specified `time` biased so that unsigned comparison of
+    /// biased times matches signed comparison of times.
+    static bsls::Types::Uint64 toTick(bsls::Types::Int64 time);
+
+    /// Return the time from which the specified `tick` was biased.
+    static bsls::Types::Int64 fromTick(bsls::Types::Uint64 tick);
+
+    // PRIVATE MANIPULATORS
+
+    /// Set the current time to the start of the specified `slot` and
+    /// redistribute the links of `slot` to lower levels.  The behavior is
+    /// undefined unless `slot` is the earliest non-empty slot and is not in
+    /// level 0.
+    void cascade(int slot);
+
+    /// Append the specified `link` to the specified `slot`.
+    void linkToSlot(TimingWheelLink *link, int slot);
+
+    /// Insert the specified `link` into the overdue list, after every
+    /// overdue link whose time is not later than that of `link`.
+    void linkOverdue(TimingWheelLink *link);
+
+    /// Insert the specified `link` into the slot, or the overdue list,
+    /// appropriate to its time and the current time.
+    void place(TimingWheelLink *link);
+
+    /// Remove the first link of the specified `slot` and return it.  The
+    /// behavior is undefined unless `slot` is non-empty.
+    TimingWheelLink *takeFirst(int slot);
+
+    /// Remove the specified `link` from the slot holding it.
+    void unlinkFromSlot(TimingWheelLink *link);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the earliest non-empty slot, or -1 if every slot
+    /// is empty.  Note that the overdue list is not considered.
+    int earliestSlot() const;
+
+    /// Return the biased time at which the specified `slot` starts, given
+    /// the current time.
+    bsls::Types::Uint64 slotStart(int slot) const;
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheel(const TimingWheel&) BSLS_KEYWORD_DELETED;
+    TimingWheel& operator=(const TimingWheel&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create an empty wheel whose current time is the optionally specified
+    /// `currentTime`, or 0 if `currentTime` is not specified.  Note that
+    /// links inserted with a time earlier than `currentTime` are overdue
+    /// (see {Structure}).
+    explicit TimingWheel(bsls::Types::Int64 currentTime = 0);
+
+    /// Destroy this object.  The behavior is undefined unless this wheel is
+    /// empty.
+    ~TimingWheel();
+
+    // MANIPULATORS
+
+    /// Advance the current time of this wheel toward the specified `time`,
+    /// cascading the links that are due by `time` to level 0, so that they
+    /// are removed in constant time.  The current time is not changed if it
+    /// is later than `time`.  Note that links subsequently inserted with a
+    /// time earlier than the current time are overdue (see {Structure}).
+    void advance(bsls::Types::Int64 time);
+
+    /// Return the address of the link in this wheel having the earliest
+    /// time, or 0 if this wheel is empty.  If several links have the
+    /// earliest time, return the one inserted first.  Note that this method
+    /// does not change the current time of this wheel.
+    TimingWheelLink *front();
+
+    /// Insert the specified `link` into this wheel with the specified
+    /// `time`.  The behavior is undefined unless `link` is not in a wheel.
+    void insert(TimingWheelLink *link, bsls::Types::Int64 time);
+
+    /// Remove from this wheel every link whose time is not later than the
+    /// specified `time`, and return the address of the first of them, or 0
+    /// if there are none.  The removed links are chained in ascending order
+    /// of time, links having the same time being in the order they were
+    /// inserted, and the chain is traversed with `TimingWheelLink::next`.
+    /// Note that this method may advance the current time of this wheel up
+    /// to `time`.
+    TimingWheelLink *popLE(bsls::Types::Int64 time);
+
+    /// Remove the specified `link` from this wheel.  The behavior is
+    /// undefined unless `link` is in this wheel.
+    void remove(TimingWheelLink *link);
+
+    /// Remove every link from this wheel, and return the address of the
+    /// first of them, or 0 if this wheel was empty.  The removed links are
+    /// chained in an unspecified order, and the chain is traversed with
+    /// `TimingWheelLink::next`.  Note that the current time of this wheel
+    /// is not changed.
+    TimingWheelLink *removeAll();
+
+    // ACCESSORS
+
+    /// Return the current time of this wheel.  See {Structure} in the
+    /// component documentation.
+    bsls::Types::Int64 currentTime() const;
+
+    /// Return `true` if this wheel contains no links, and `false`
+    /// otherwise.
+    bool isEmpty() const;
+
+    /// Return the number of links in this wheel.
+    bsl::size_t length() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class TimingWheelLink
+                           // ---------------------
+
+// CREATORS
+inline
+TimingWheelLink::TimingWheelLink()
+: d_next_p(0)
+, d_prev_p(0)
+, d_tick(0)
+, d_slot(TimingWheel::k_UNLINKED)
+{
+}
+
+inline
+TimingWheelLink::~TimingWheelLink()
+{
+    BSLS_ASSERT(!isLinked());
+}
+
+// ACCESSORS
+inline
+bool TimingWheelLink::isLinked() const
+{
+    return TimingWheel::k_UNLINKED != d_slot;
+}
+
+inline
+TimingWheelLink *TimingWheelLink::next() const
+{
+    BSLS_ASSERT(!isLinked());
+
+    return d_next_p;
+}
+
+inline
+bsls::Types::Int64 TimingWheelLink::time() const
+{
+    return TimingWheel::fromTick(d_tick);
+}
+
+                             // -----------------
+                             // class TimingWheel
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+inline
+bsls::Types::Uint64 TimingWheel::toTick(bsls::Types::Int64 time)
+{
+    return static_cast<bsls::Types::Uint64>(time) ^ (1ULL << 63);
+}
+
+inline
+bsls::Types::Int64 TimingWheel::fromTick(bsls::Types::Uint64 tick)
+{
+    return static_cast<bsls::Types::Int64>(tick ^ (1ULL << 63));
+}
+
+// PRIVATE MANIPULATORS
+inline
+void TimingWheel::linkToSlot(TimingWheelLink *link, int slot)
+{
+    TimingWheelLink *first = d_slots[slot];
+
+    if (first) {
+        TimingWheelLink *last = first->d_prev_p;
+
+        last->d_next_p  = link;
+        link->d_prev_p  = last;
+        link->d_next_p  = first;
+        first->d_prev_p = link;
+
+        TimingWheelLink *earliest = d_earliest[slot];
+        if (earliest && link->d_tick < earliest->d_tick) {
+            d_earliest[slot] = link;
+        }
+    }
+    else {
+        link->d_next_p   = link;
+        link->d_prev_p   = link;
+        d_slots[slot]    = link;
+        d_earliest[slot] = link;
+        if (k_OVERDUE_SLOT != slot) {
+            d_occupied[slot / k_SLOTS_PER_LEVEL] |=
+                                   1ULL << (slot & (k_SLOTS_PER_LEVEL - 1));
+        }
+    }
+    link->d_slot = slot;
+}
+
+inline
+void TimingWheel::unlinkFromSlot(TimingWheelLink *link)
+{
+    const int slot = link->d_slot;
+
+    if (d_earliest[slot] == link) {
+        d_earliest[slot] = 0;
+    }
+    if (link->d_next_p == link) {
+        d_slots[slot] = 0;
+        if (k_OVERDUE_SLOT != slot) {
+            d_occupied[slot / k_SLOTS_PER_LEVEL] &=
+                                 ~(1ULL << (slot & (k_SLOTS_PER_LEVEL - 1)));
+        }
+    }
+    else {
+        link->d_prev_p->d_next_p = link->d_next_p;
+        link->d_next_p->d_prev_p = link->d_prev_p;
+        if (d_slots[slot] == link) {
+            d_slots[slot] = link->d_next_p;
+        }
+    }
+    link->d_next_p = 0;
+    link->d_prev_p = 0;
+    link->d_slot   = k_UNLINKED;
+}
+
+// CREATORS
+inline
+TimingWheel::~TimingWheel()
+{
+    BSLS_ASSERT(isEmpty());
+}
+
+// MANIPULATORS
+inline
+void TimingWheel::insert(TimingWheelLink *link, bsls::Types::Int64 time)
+{
+    BSLS_ASSERT(link);
+    BSLS_ASSERT(!link->isLinked());
+
+    link->d_tick = toTick(time);
+    place(link);
+    ++d_length;
+}
+
+inline
+void TimingWheel::remove(TimingWheelLink *link)
+{
+    BSLS_ASSERT(link);
+    BSLS_ASSERT(link->isLinked());
+
+    unlinkFromSlot(link);
+    --d_length;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 TimingWheel::currentTime() const
+{
+    return fromTick(d_currentTick);
+}
+
+inline
+bool TimingWheel::isEmpty() const
+{
+    return 0 == d_length;
+}
+
+inline
+bsl::size_t TimingWheel::length() const
+{
+    return d_length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
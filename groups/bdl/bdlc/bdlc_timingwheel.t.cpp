@@ -0,0 +1,1244 @@
+// bdlc_timingwheel.t.cpp                                             -*-C++-*-
+#include <bdlc_timingwheel.h>
+
+#include <bdlb_random.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism, `bdlc::TimingWheel`, that orders
+// client-supplied intrusive links by time.  Its observable behavior is the
+// order in which links are returned by `front` and `popLE`, which must match
+// that of an ordered multimap keyed by time, whatever the sequence of
+// insertions and removals and however far apart the times are.  We verify
+// the primary manipulators, then `front`, `popLE`, and `removeAll` on
+// hand-picked times chosen to exercise every level of the wheel and the list
+// of overdue links, and finally compare the wheel against a `bsl::multimap`
+// over long random sequences of operations.
+// ----------------------------------------------------------------------------
+// TIMINGWHEELLINK
+// [ 2] TimingWheelLink();
+// [ 2] ~TimingWheelLink();
+// [ 2] bool isLinked() const;
+// [ 4] TimingWheelLink *next() const;
+// [ 2] bsls::Types::Int64 time() const;
+//
+// TIMINGWHEEL
+// [ 2] explicit TimingWheel(bsls::Types::Int64 currentTime = 0);
+// [ 2] ~TimingWheel();
+// [ 3] void advance(bsls::Types::Int64 time);
+// [ 3] TimingWheelLink *front();
+// [ 2] void insert(TimingWheelLink *link, bsls::Types::Int64 time);
+// [ 4] TimingWheelLink *popLE(bsls::Types::Int64 time);
+// [ 2] void remove(TimingWheelLink *link);
+// [ 5] TimingWheelLink *removeAll();
+// [ 2] bsls::Types::Int64 currentTime() const;
+// [ 2] bool isEmpty() const;
+// [ 2] bsl::size_t length() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: ORDER MATCHES THAT OF AN ORDERED MULTIMAP
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: SCHEDULE AND CANCEL
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::TimingWheel     Obj;
+typedef bdlc::TimingWheelLink Link;
+typedef bsls::Types::Int64    Int64;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+const Int64 k_MIN = bsl::numeric_limits<Int64>::min();
+const Int64 k_MAX = bsl::numeric_limits<Int64>::max();
+
+// ============================================================================
+//                       HELPER CLASSES AND FUNCTIONS
+// ----------------------------------------------------------------------------
+
+/// This `struct` is a test node identified by an id.
+struct Node : Link {
+    int d_id;
+};
+
+/// Return the id of the node having the specified `link`.
+int idOf(Link *link)
+{
+    return static_cast<Node *>(link)->d_id;
+}
+
+/// Remove the specified `nodes` from the specified `wheel`, if they are in
+/// it.
+void removeNodes(Obj *wheel, bsl::vector<Node> *nodes)
+{
+    for (bsl::size_t i = 0; i < nodes->size(); ++i) {
+        if ((*nodes)[i].isLinked()) {
+            wheel->remove(&(*nodes)[i]);
+        }
+    }
+}
+
+/// Remove the front link of the specified `wheel` until it is empty, and
+/// load the ids of the removed nodes, in order, into the specified
+/// `result`.
+void drain(bsl::vector<int> *result, Obj *wheel)
+{
+    result->clear();
+    while (Link *link = wheel->front()) {
+        result->push_back(idOf(link));
+        wheel->remove(link);
+    }
+}
+
+/// Load into the specified `result` the ids of the nodes of the chain
+/// starting at the specified `head`.
+void chainIds(bsl::vector<int> *result, Link *head)
+{
+    result->clear();
+    for (Link *link = head; link; link = link->next()) {
+        result->push_back(idOf(link));
+    }
+}
+
+/// Return a pseudo-random value in the range `[0, limit)` generated from
+/// the specified `seed`, and update `seed`.  The behavior is undefined
+/// unless `0 < limit`.
+Int64 randomValue(int *seed, Int64 limit)
+{
+    bsls::Types::Uint64 r = 0;
+    for (int i = 0; i < 5; ++i) {
+        r = (r << 15) | bdlb::Random::generate15(seed);
+    }
+    return static_cast<Int64>(r % static_cast<bsls::Types::Uint64>(limit));
+}
+
+                            // ==================
+                            // struct OracleWheel
+                            // ==================
+
+/// This `struct` maintains a `bdlc::TimingWheel` together with a
+/// `bsl::multimap` that is expected to order the same nodes identically.
+struct OracleWheel {
+
+    // TYPES
+    typedef bsl::multimap<Int64, int> Map;
+
+    // DATA
+    Obj                            d_wheel;
+    Map                            d_map;
+    bsl::vector<Node>              d_nodes;
+    bsl::vector<Map::iterator>     d_iterators;
+
+    // CREATORS
+    OracleWheel(int numNodes, Int64 currentTime, bslma::Allocator *allocator)
+    : d_wheel(currentTime)
+    , d_map(allocator)
+    , d_nodes(numNodes, allocator)
+    , d_iterators(numNodes, allocator)
+    {
+        for (int i = 0; i < numNodes; ++i) {
+            d_nodes[i].d_id = i;
+        }
+    }
+
+    ~OracleWheel()
+    {
+        removeNodes(&d_wheel, &d_nodes);
+    }
+
+    // MANIPULATORS
+
+    /// Insert the node having the specified `id` with the specified `time`.
+    void insert(int id, Int64 time)
+    {
+        d_wheel.insert(&d_nodes[id], time);
+        d_iterators[id] = d_map.insert(bsl::make_pair(time, id));
+    }
+
+    /// Remove the node having the specified `id`.
+    void remove(int id)
+    {
+        d_wheel.remove(&d_nodes[id]);
+        d_map.erase(d_iterators[id]);
+    }
+
+    /// Verify that the wheel and the map agree on their front element, and
+    /// on their length.
+    void verifyFront(int line)
+    {
+        LOOP_ASSERT(line, d_map.size() == d_wheel.length());
+
+        Link *link = d_wheel.front();
+        if (d_map.empty()) {
+            LOOP_ASSERT(line, 0 == link);
+            return;                                                   // RETURN
+        }
+        LOOP_ASSERT(line, link);
+        if (link) {
+            ASSERTV(line, d_map.begin()->second, idOf(link),
+                    d_map.begin()->second == idOf(link));
+            ASSERTV(line, d_map.begin()->first == link->time());
+        }
+    }
+
+    /// Pop the elements not later than the specified `time` from the wheel
+    /// and from the map, and verify that they agree.
+    void verifyPopLE(int line, Int64 time)
+    {
+        Link *head = d_wheel.popLE(time);
+
+        while (!d_map.empty() && d_map.begin()->first <= time) {
+            LOOP_ASSERT(line, head);
+            if (!head) {
+                return;                                               // RETURN
+            }
+            ASSERTV(line, d_map.begin()->second, idOf(head),
+                    d_map.begin()->second == idOf(head));
+            ASSERTV(line, d_map.begin()->first == head->time());
+            LOOP_ASSERT(line, !head->isLinked());
+            d_map.erase(d_map.begin());
+            head = head->next();
+        }
+        LOOP_ASSERT(line, 0 == head);
+        LOOP_ASSERT(line, d_map.size() == d_wheel.length());
+    }
+};
+
+// ============================================================================
+//                            USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Example 1: Expiring Session Timeouts
+/// - - - - - - - - - - - - - - - - - -
+// Suppose a server tracks an idle timeout for each of its sessions.  Most
+// timeouts are cancelled and rescheduled as traffic arrives, and only a few
+// of them ever expire.  A `bdlc::TimingWheel` lets us schedule and cancel a
+// timeout in constant time.
+//
+// First, we define a session type that derives from `bdlc::TimingWheelLink`,
+// so that its link represents its idle timeout, and a function to recover the
+// session from its link:
+// ```
+struct Session : bdlc::TimingWheelLink {
+    int d_id;  // session id
+};
+
+Session *sessionFromLink(bdlc::TimingWheelLink *link)
+{
+    return static_cast<Session *>(link);
+}
+// ```
+
+}  // close namespace usage
+
+// ============================================================================
+//                            PERFORMANCE HELPERS
+// ----------------------------------------------------------------------------
+
+namespace performance {
+
+/// Simulate the specified `numTimers` session timeouts, each of the
+/// specified `timeout`, over the specified `numSteps` steps of one time unit
+/// each, using a `bdlc::TimingWheel`.  At each step, reschedule the timeouts
+/// of the specified `numActive` sessions and expire the timeouts that are
+/// due.  Return the number of expired timeouts.
+int runWheel(int numTimers, int numSteps, int numActive, Int64 timeout)
+{
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    Obj               wheel;
+    bsl::vector<Node> nodes(numTimers, allocator);
+    int               seed    = 7;
+    int               expired = 0;
+
+    for (int i = 0; i < numTimers; ++i) {
+        nodes[i].d_id = i;
+        wheel.insert(&nodes[i], timeout);
+    }
+    for (Int64 now = 1; now <= numSteps; ++now) {
+        for (int i = 0; i < numActive; ++i) {
+            Node& node = nodes[bdlb::Random::generate15(&seed) % numTimers];
+            if (node.isLinked()) {
+                wheel.remove(&node);
+            }
+            wheel.insert(&node, now + timeout);
+        }
+        for (Link *link = wheel.popLE(now); link; link = link->next()) {
+            ++expired;
+        }
+    }
+    removeNodes(&wheel, &nodes);
+    return expired;
+}
+
+/// Perform the same simulation as `runWheel` using a `bsl::multimap`.
+int runMap(int numTimers, int numSteps, int numActive, Int64 timeout)
+{
+    typedef bsl::multimap<Int64, int> Map;
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    Map                        map(allocator);
+    bsl::vector<Map::iterator> iterators(numTimers, allocator);
+    bsl::vector<char>          isLinked(numTimers, 1, allocator);
+    int                        seed    = 7;
+    int                        expired = 0;
+
+    for (int i = 0; i < numTimers; ++i) {
+        iterators[i] = map.insert(bsl::make_pair(timeout, i));
+    }
+    for (Int64 now = 1; now <= numSteps; ++now) {
+        for (int i = 0; i < numActive; ++i) {
+            const int id = bdlb::Random::generate15(&seed) % numTimers;
+            if (isLinked[id]) {
+                map.erase(iterators[id]);
+            }
+            iterators[id] = map.insert(bsl::make_pair(now + timeout, id));
+            isLinked[id]  = 1;
+        }
+        Map::iterator end = map.upper_bound(now);
+        for (Map::iterator it = map.begin(); it != end; ++it) {
+            isLinked[it->second] = 0;
+            ++expired;
+        }
+        map.erase(map.begin(), end);
+    }
+    return expired;
+}
+
+}  // close namespace performance
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create a wheel whose current time is 0, measured in milliseconds,
+// and schedule a timeout for each of three sessions:
+// ```
+    bdlc::TimingWheel wheel;
+
+    Session sessions[3];
+    for (int i = 0; i < 3; ++i) {
+        sessions[i].d_id = i;
+        wheel.insert(&sessions[i], 1000 + 100 * i);
+    }
+    ASSERT(3 == wheel.length());
+    ASSERT(&sessions[0] == wheel.front());
+// ```
+// Next, traffic arrives on session 0, so we push its timeout back:
+// ```
+    wheel.remove(&sessions[0]);
+    wheel.insert(&sessions[0], 1500);
+// ```
+// Now, at time 1200, we collect the timeouts that have expired:
+// ```
+    bdlc::TimingWheelLink *expired = wheel.popLE(1200);
+
+    ASSERT(1 == sessionFromLink(expired)->d_id);
+    expired = expired->next();
+    ASSERT(2 == sessionFromLink(expired)->d_id);
+    ASSERT(0 == expired->next());
+// ```
+// Finally, we observe that only the timeout of session 0 remains:
+// ```
+    ASSERT(1 == wheel.length());
+    ASSERT(1500 == wheel.front()->time());
+// ```
+
+        wheel.remove(&sessions[0]);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: ORDER MATCHES THAT OF AN ORDERED MULTIMAP
+        //
+        // Concerns:
+        // 1. For any sequence of insertions, removals, and calls to `front`
+        //    and `popLE`, the links returned are those, and in the order,
+        //    that a `bsl::multimap` keyed by time would return.
+        //
+        // 2. This holds whether times are close together (exercising the low
+        //    levels of the wheel) or far apart (exercising the high levels
+        //    and cascading), and whether or not links are overdue.
+        //
+        // Plan:
+        // 1. For each of several ranges of time, perform a long random
+        //    sequence of operations on an `OracleWheel`, which applies each
+        //    operation to both a wheel and a multimap, and verify after each
+        //    operation that they agree.  Advance the time passed to `popLE`
+        //    steadily, and occasionally insert links with times earlier than
+        //    it.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: ORDER MATCHES THAT OF AN ORDERED MULTIMAP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                        << "CONCERN: ORDER MATCHES THAT OF AN ORDERED MULTIMAP"
+                        << endl
+                        << "=================================================="
+                        << endl;
+
+        static const struct {
+            int   d_line;
+            Int64 d_start;   // initial current time
+            Int64 d_span;    // range of times ahead of "now"
+            Int64 d_step;    // maximum advance of "now" per `popLE`
+        } DATA[] = {
+            //LINE  START                 SPAN              STEP
+            //----  -----                 ----              ----
+            { L_,   0,                    10,               1               },
+            { L_,   0,                    100,              5               },
+            { L_,   0,                    10000,            300             },
+            { L_,   -5000,                5000000,          100000          },
+            { L_,   1234567,              1LL << 40,        1LL << 33       },
+            { L_,   k_MIN,                1LL << 62,        1LL << 50       },
+            { L_,   k_MAX - (1LL << 42),  1LL << 40,        1LL << 29       },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        const int NUM_NODES = 200;
+        const int NUM_OPS   = 20000;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE  = DATA[ti].d_line;
+            const Int64 START = DATA[ti].d_start;
+            const Int64 SPAN  = DATA[ti].d_span;
+            const Int64 STEP  = DATA[ti].d_step;
+
+            if (veryVerbose) { T_ P_(LINE) P_(START) P_(SPAN) P(STEP) }
+
+            OracleWheel mX(NUM_NODES, START, &ta);
+            Int64       now  = START;
+            int         seed = LINE;
+
+            for (int op = 0; op < NUM_OPS; ++op) {
+                const int id     = static_cast<int>(randomValue(&seed,
+                                                                NUM_NODES));
+                const int choice = static_cast<int>(randomValue(&seed, 100));
+
+                if (choice < 45) {
+                    if (mX.d_nodes[id].isLinked()) {
+                        mX.remove(id);
+                    }
+
+                    // Occasionally insert a link that is earlier than "now",
+                    // or has the same time as the current front.
+
+                    Int64 time;
+                    if (choice < 3 && now - START >= SPAN / 2) {
+                        time = now - randomValue(&seed, SPAN / 2);
+                    }
+                    else if (choice < 8 && !mX.d_map.empty()) {
+                        time = mX.d_map.begin()->first;
+                    }
+                    else {
+                        time = now + randomValue(&seed, SPAN);
+                    }
+                    mX.insert(id, time);
+                }
+                else if (choice < 70) {
+                    if (mX.d_nodes[id].isLinked()) {
+                        mX.remove(id);
+                    }
+                }
+                else if (choice < 85) {
+                    mX.verifyFront(LINE);
+                }
+                else if (choice < 90) {
+                    mX.d_wheel.advance(now);
+                    mX.verifyFront(LINE);
+                }
+                else {
+                    now += randomValue(&seed, STEP) + 1;
+                    mX.verifyPopLE(LINE, now);
+                }
+                ASSERTV(LINE, op, mX.d_map.size() == mX.d_wheel.length());
+            }
+
+            // Drain in order.
+
+            while (!mX.d_map.empty()) {
+                mX.verifyFront(LINE);
+                mX.remove(mX.d_map.begin()->second);
+            }
+            ASSERTV(LINE, mX.d_wheel.isEmpty());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `removeAll`
+        //
+        // Concerns:
+        // 1. `removeAll` removes every link, including overdue links, and
+        //    returns them chained through `next`.
+        //
+        // 2. The wheel is empty afterwards, its current time is unchanged,
+        //    and it can be reused.
+        //
+        // 3. `removeAll` on an empty wheel returns 0.
+        //
+        // Plan:
+        // 1. Insert links at every level and an overdue link, call
+        //    `removeAll`, and verify that the chain contains every link, each
+        //    unlinked, and that the wheel is empty.  Then reuse the wheel.
+        //    (C-1..3)
+        //
+        // Testing:
+        //   TimingWheelLink *removeAll();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `removeAll`" << endl
+                          << "===================" << endl;
+
+        Obj mX(1000);  const Obj& X = mX;
+
+        ASSERT(0 == mX.removeAll());
+
+        const int         NUM_NODES = 12;
+        bsl::vector<Node> nodes(NUM_NODES, &ta);
+        for (int i = 0; i < NUM_NODES; ++i) {
+            nodes[i].d_id = i;
+            mX.insert(&nodes[i], 1000 + (1LL << (5 * i)));
+        }
+        mX.advance(1001);
+        ASSERT(&nodes[0] == mX.front());
+        mX.remove(&nodes[0]);
+        mX.insert(&nodes[0], 0);            // overdue
+        ASSERT(NUM_NODES == static_cast<int>(X.length()));
+
+        const Int64 currentTime = X.currentTime();
+
+        bsl::vector<int> ids(&ta);
+        chainIds(&ids, mX.removeAll());
+
+        ASSERT(NUM_NODES == static_cast<int>(ids.size()));
+        bsl::vector<char> seen(NUM_NODES, 0, &ta);
+        for (bsl::size_t i = 0; i < ids.size(); ++i) {
+            ASSERTV(ids[i], !seen[ids[i]]);
+            seen[ids[i]] = 1;
+            ASSERTV(ids[i], !nodes[ids[i]].isLinked());
+        }
+        ASSERT(X.isEmpty());
+        ASSERT(0 == X.length());
+        ASSERT(currentTime == X.currentTime());
+        ASSERT(0 == mX.front());
+
+        mX.insert(&nodes[3], currentTime + 5);
+        ASSERT(&nodes[3] == mX.front());
+        mX.remove(&nodes[3]);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `popLE`
+        //
+        // Concerns:
+        // 1. `popLE` removes exactly the links whose time is not later than
+        //    the specified time, including links having exactly that time.
+        //
+        // 2. The removed links are chained in ascending order of time, links
+        //    having the same time being in insertion order, and overdue links
+        //    come first.
+        //
+        // 3. The removed links are no longer linked, and `next` of the last
+        //    one is 0.
+        //
+        // 4. `popLE` returns 0 if no link has expired, and leaves the wheel
+        //    unchanged.
+        //
+        // 5. `popLE` cascades links of higher levels as needed, so that links
+        //    far apart in time are returned in order.
+        //
+        // Plan:
+        // 1. Insert links with times spanning several levels, including
+        //    duplicates, and pop them in several batches whose limits fall
+        //    before, on, and after link times.  Verify each chain against the
+        //    expected ids.  (C-1..5)
+        //
+        // 2. Advance the wheel by popping, insert links earlier than its
+        //    current time, and verify that they are popped first and in
+        //    order.  (C-2)
+        //
+        // Testing:
+        //   TimingWheelLink *popLE(bsls::Types::Int64 time);
+        //   TimingWheelLink *next() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `popLE`" << endl
+                          << "===============" << endl;
+
+        bsl::vector<int> ids(&ta);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.popLE(k_MAX));
+
+            static const Int64 TIMES[] = {
+                5, 64, 63, 5, 4096, 100000, 64, 1LL << 40, 0, 262144, 5
+            };
+            const int NUM_TIMES = static_cast<int>(sizeof TIMES /
+                                                   sizeof *TIMES);
+
+            bsl::vector<Node> nodes(NUM_TIMES, &ta);
+            for (int i = 0; i < NUM_TIMES; ++i) {
+                nodes[i].d_id = i;
+                mX.insert(&nodes[i], TIMES[i]);
+            }
+
+            ASSERT(0 == mX.popLE(-1));
+            ASSERT(NUM_TIMES == static_cast<int>(X.length()));
+
+            // Limit falls on a link time: 0, 5, 5, 5
+
+            chainIds(&ids, mX.popLE(5));
+            ASSERTV(ids.size(), 4 == ids.size());
+            if (4 == ids.size()) {
+                ASSERT(8 == ids[0]);
+                ASSERT(0 == ids[1]);
+                ASSERT(3 == ids[2]);
+                ASSERT(10 == ids[3]);
+            }
+            for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                ASSERTV(i, !nodes[ids[i]].isLinked());
+            }
+
+            // Limit falls between link times: 63, 64, 64
+
+            chainIds(&ids, mX.popLE(4000));
+            ASSERTV(ids.size(), 3 == ids.size());
+            if (3 == ids.size()) {
+                ASSERT(2 == ids[0]);
+                ASSERT(1 == ids[1]);
+                ASSERT(6 == ids[2]);
+            }
+
+            ASSERT(0 == mX.popLE(4095));
+
+            // Higher levels: 4096, 100000, 262144
+
+            chainIds(&ids, mX.popLE(1LL << 30));
+            ASSERTV(ids.size(), 3 == ids.size());
+            if (3 == ids.size()) {
+                ASSERT(4 == ids[0]);
+                ASSERT(5 == ids[1]);
+                ASSERT(9 == ids[2]);
+            }
+            ASSERT(1 == X.length());
+            ASSERT(X.currentTime() <= (1LL << 30));
+
+            chainIds(&ids, mX.popLE(k_MAX));
+            ASSERT(1 == ids.size() && 7 == ids[0]);
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\tOverdue links." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            Node nodes[6];
+            for (int i = 0; i < 6; ++i) {
+                nodes[i].d_id = i;
+            }
+
+            mX.insert(&nodes[0], 1000);
+            mX.insert(&nodes[1], 5000);
+
+            chainIds(&ids, mX.popLE(1000));
+            ASSERT(1 == ids.size() && 0 == ids[0]);
+            ASSERT(1000 == X.currentTime());
+
+            // Earlier than the current time: overdue.
+
+            mX.insert(&nodes[2], 700);
+            mX.insert(&nodes[3], 900);
+            mX.insert(&nodes[4], 700);
+            mX.insert(&nodes[5], 100);
+            ASSERT(&nodes[5] == mX.front());
+
+            chainIds(&ids, mX.popLE(800));
+            ASSERTV(ids.size(), 3 == ids.size());
+            if (3 == ids.size()) {
+                ASSERT(5 == ids[0]);
+                ASSERT(2 == ids[1]);
+                ASSERT(4 == ids[2]);
+            }
+
+            chainIds(&ids, mX.popLE(k_MAX));
+            ASSERTV(ids.size(), 2 == ids.size());
+            if (2 == ids.size()) {
+                ASSERT(3 == ids[0]);
+                ASSERT(1 == ids[1]);
+            }
+            ASSERT(X.isEmpty());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `front`
+        //
+        // Concerns:
+        // 1. `front` returns the link having the earliest time, and 0 if the
+        //    wheel is empty.
+        //
+        // 2. Of links having the same time, `front` returns the one inserted
+        //    first, even if they were inserted at different current times.
+        //
+        // 3. `front` is correct for times that are far apart, negative, or at
+        //    the extremes of the range of `Int64`.
+        //
+        // 4. `front` does not change the current time, and remains correct
+        //    after the earliest link of a slot above level 0 is removed.
+        //
+        // 5. `advance` advances the current time no further than the
+        //    specified time, and leaves the order of the links unchanged.
+        //
+        // 6. An overdue link precedes every other link.
+        //
+        // Plan:
+        // 1. Insert links in various orders and drain the wheel through
+        //    `front` and `remove`, verifying the order.  (C-1..3)
+        //
+        // 2. Verify `currentTime` after calls to `front`, and after removing
+        //    the earliest of several links sharing a slot.  (C-4)
+        //
+        // 3. Verify `currentTime` and `front` after calls to `advance`.
+        //    (C-5)
+        //
+        // 4. Advance the wheel, insert a link earlier than its current time,
+        //    and verify that it is returned by `front`.  (C-6)
+        //
+        // Testing:
+        //   void advance(bsls::Types::Int64 time);
+        //   TimingWheelLink *front();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `front`" << endl
+                          << "===============" << endl;
+
+        bsl::vector<int> ids(&ta);
+
+        static const struct {
+            int         d_line;
+            Int64       d_start;     // initial current time
+            const char *d_order;     // expected order of ids
+            Int64       d_times[8];  // times of nodes 0..7
+        } DATA[] = {
+            //LINE START  ORDER       TIMES
+            //---- -----  -----       -----
+            { L_,  0,     "76543210", { 7, 6, 5, 4, 3, 2, 1, 0 }          },
+            { L_,  0,     "01234567", { 0, 1, 2, 3, 4, 5, 6, 7 }          },
+            { L_,  0,     "30124567", { 9, 9, 9, 1, 9, 9, 9, 9 }          },
+            { L_,  0,     "71234560", { 1LL << 40, 1LL << 6, 1LL << 12,
+                                        1LL << 18, 1LL << 24, 1LL << 30,
+                                        1LL << 36, 63 }                   },
+            { L_,  0,     "76435102", { 4096, 4095, 4097, 64, 63, 65, 1, 0 }
+                                                                          },
+            { L_,  -100,  "46102375", { -1, -50, 0, 50, -100, 100, -99, 99 }
+                                                                          },
+            { L_,  k_MIN, "16324507", { k_MAX, k_MIN, 0, -1, 1, k_MAX - 1,
+                                        k_MIN + 1, k_MAX }                },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE  = DATA[ti].d_line;
+            const Int64 START = DATA[ti].d_start;
+
+            Obj mX(START);  const Obj& X = mX;
+
+            ASSERTV(LINE, 0 == mX.front());
+
+            Node nodes[8];
+            for (int i = 0; i < 8; ++i) {
+                nodes[i].d_id = i;
+                mX.insert(&nodes[i], DATA[ti].d_times[i]);
+            }
+
+            Link *front = mX.front();
+            ASSERTV(LINE, front);
+            ASSERTV(LINE, START == X.currentTime());
+
+            drain(&ids, &mX);
+
+            bsl::string order;
+            for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                order.push_back(static_cast<char>('0' + ids[i]));
+            }
+            ASSERTV(LINE, order, DATA[ti].d_order == order);
+        }
+
+        if (verbose) cout << "\tSame time inserted at different times."
+                          << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            Node nodes[4];
+            for (int i = 0; i < 4; ++i) {
+                nodes[i].d_id = i;
+            }
+
+            mX.insert(&nodes[0], 1000000);  // high level
+            mX.insert(&nodes[1], 10);
+            ASSERT(&nodes[1] == mX.front());
+            mX.remove(&nodes[1]);
+
+            ASSERT(&nodes[0] == mX.front());
+            ASSERT(0 == X.currentTime());
+
+            mX.advance(999999);
+            ASSERT(X.currentTime() <= 999999);
+
+            mX.advance(1000000);              // cascades node 0
+            ASSERT(1000000 == X.currentTime());
+            ASSERT(&nodes[0] == mX.front());
+
+            mX.advance(0);
+            ASSERT(1000000 == X.currentTime());
+
+            mX.insert(&nodes[2], 1000000);    // level 0
+            mX.insert(&nodes[3], 2000000);
+
+            drain(&ids, &mX);
+            ASSERT(3 == ids.size());
+            ASSERT(0 == ids[0]);
+            ASSERT(2 == ids[1]);
+            ASSERT(3 == ids[2]);
+        }
+
+        if (verbose) cout << "\tEarliest link of a slot removed." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            static const Int64 TIMES[] = { 5000, 4500, 4800, 4500, 4200 };
+            const int          NUM_TIMES = static_cast<int>(sizeof TIMES /
+                                                            sizeof *TIMES);
+
+            Node nodes[NUM_TIMES];
+            for (int i = 0; i < NUM_TIMES; ++i) {
+                nodes[i].d_id = i;
+                mX.insert(&nodes[i], TIMES[i]);
+            }
+
+            ASSERT(&nodes[4] == mX.front());
+            mX.remove(&nodes[4]);
+            ASSERT(&nodes[1] == mX.front());
+            mX.remove(&nodes[1]);
+            ASSERT(&nodes[3] == mX.front());
+            mX.remove(&nodes[2]);
+            ASSERT(&nodes[3] == mX.front());
+            ASSERT(0 == X.currentTime());
+
+            drain(&ids, &mX);
+            ASSERT(2 == ids.size());
+            ASSERT(3 == ids[0]);
+            ASSERT(0 == ids[1]);
+        }
+
+        if (verbose) cout << "\tOverdue link." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            Node a, b;
+            a.d_id = 0;
+            b.d_id = 1;
+
+            mX.insert(&a, 5000);
+            mX.advance(5000);
+            ASSERT(&a == mX.front());
+
+            const Int64 currentTime = X.currentTime();
+            ASSERTV(currentTime, 4000 < currentTime);
+            ASSERTV(currentTime, currentTime <= 5000);
+
+            mX.insert(&b, 4000);
+            ASSERT(&b == mX.front());
+            ASSERT(currentTime == X.currentTime());
+
+            mX.remove(&b);
+            ASSERT(&a == mX.front());
+            mX.remove(&a);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND PRIMARY MANIPULATORS
+        //
+        // Concerns:
+        // 1. A default-constructed link is not linked.
+        //
+        // 2. A wheel is created empty, with the specified current time, or 0
+        //    by default.
+        //
+        // 3. `insert` links the link, records its time, and increments the
+        //    length; `remove` unlinks it and decrements the length.
+        //
+        // 4. A link may be re-inserted after removal, with a different time.
+        //
+        // 5. Precondition violations are detected in appropriate build modes.
+        //
+        // Plan:
+        // 1. Create wheels with and without a current time and verify the
+        //    accessors.  (C-2)
+        //
+        // 2. Insert and remove links, verifying `isLinked`, `time`,
+        //    `length`, and `isEmpty` after each operation.  (C-1, 3..4)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   TimingWheelLink();
+        //   ~TimingWheelLink();
+        //   bool isLinked() const;
+        //   bsls::Types::Int64 time() const;
+        //   explicit TimingWheel(bsls::Types::Int64 currentTime = 0);
+        //   ~TimingWheel();
+        //   void insert(TimingWheelLink *link, bsls::Types::Int64 time);
+        //   void remove(TimingWheelLink *link);
+        //   bsls::Types::Int64 currentTime() const;
+        //   bool isEmpty() const;
+        //   bsl::size_t length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND PRIMARY MANIPULATORS" << endl
+                          << "=================================" << endl;
+
+        {
+            Node a;
+            ASSERT(!a.isLinked());
+
+            const Obj X;
+            ASSERT(0 == X.currentTime());
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.length());
+
+            const Obj Y(-17);
+            ASSERT(-17 == Y.currentTime());
+
+            const Obj Z(k_MAX);
+            ASSERT(k_MAX == Z.currentTime());
+        }
+
+        {
+            Obj mX(100);  const Obj& X = mX;
+
+            Node nodes[3];
+
+            static const Int64 TIMES[] = { 100, 1LL << 50, -3 };
+
+            for (int i = 0; i < 3; ++i) {
+                mX.insert(&nodes[i], TIMES[i]);
+                ASSERTV(i, nodes[i].isLinked());
+                ASSERTV(i, TIMES[i] == nodes[i].time());
+                ASSERTV(i, i + 1 == static_cast<int>(X.length()));
+                ASSERTV(i, !X.isEmpty());
+            }
+            ASSERT(100 == X.currentTime());
+
+            mX.remove(&nodes[1]);
+            ASSERT(!nodes[1].isLinked());
+            ASSERT(0 == nodes[1].next());
+            ASSERT(2 == X.length());
+
+            mX.insert(&nodes[1], 7);
+            ASSERT(nodes[1].isLinked());
+            ASSERT(7 == nodes[1].time());
+            ASSERT(3 == X.length());
+
+            for (int i = 0; i < 3; ++i) {
+                mX.remove(&nodes[i]);
+                ASSERTV(i, !nodes[i].isLinked());
+            }
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj  mX;
+            Node a, b;
+
+            ASSERT_FAIL(mX.insert(0, 5));
+            ASSERT_PASS(mX.insert(&a, 5));
+            ASSERT_FAIL(mX.insert(&a, 5));
+
+            ASSERT_FAIL(mX.remove(0));
+            ASSERT_FAIL(mX.remove(&b));
+            ASSERT_PASS(mX.remove(&a));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Insert, remove, and pop a few links.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        Node nodes[4];
+        for (int i = 0; i < 4; ++i) {
+            nodes[i].d_id = i;
+        }
+
+        mX.insert(&nodes[0], 300);
+        mX.insert(&nodes[1], 100);
+        mX.insert(&nodes[2], 200000);
+        mX.insert(&nodes[3], 200);
+        ASSERT(4 == X.length());
+        ASSERT(&nodes[1] == mX.front());
+
+        mX.remove(&nodes[1]);
+        ASSERT(&nodes[3] == mX.front());
+
+        Link *expired = mX.popLE(300);
+        ASSERT(&nodes[3] == expired);
+        ASSERT(&nodes[0] == expired->next());
+        ASSERT(0 == expired->next()->next());
+
+        ASSERT(1 == X.length());
+        ASSERT(&nodes[2] == mX.front());
+        mX.remove(&nodes[2]);
+        ASSERT(X.isEmpty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: SCHEDULE AND CANCEL
+        //
+        // Concerns:
+        // 1. Rescheduling a timer in a `bdlc::TimingWheel` is faster than in
+        //    an ordered map.
+        //
+        // Plan:
+        // 1. Simulate session timeouts that are usually rescheduled before
+        //    they expire, using a `bdlc::TimingWheel` and a `bsl::multimap`,
+        //    and report the time taken by each.  Optional arguments select
+        //    the number of timers, steps, reschedules per step, and the
+        //    timeout.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: SCHEDULE AND CANCEL
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: SCHEDULE AND CANCEL" << endl
+             << "=====================================" << endl;
+
+        const int   NUM_TIMERS = argc > 2 ? bsl::atoi(argv[2]) : 100000;
+        const int   NUM_STEPS  = argc > 3 ? bsl::atoi(argv[3]) : 2000;
+        const int   NUM_ACTIVE = argc > 4 ? bsl::atoi(argv[4]) : 500;
+        const Int64 TIMEOUT    = argc > 5 ? bsl::atoi(argv[5]) : 1000;
+
+        P_(NUM_TIMERS) P_(NUM_STEPS) P_(NUM_ACTIVE) P(TIMEOUT)
+
+        bslma::Default::setDefaultAllocatorRaw(
+                                      &bslma::NewDeleteAllocator::singleton());
+
+        bsls::Stopwatch timer;
+
+        timer.start(true);
+        const int expiredWheel = performance::runWheel(NUM_TIMERS,
+                                                       NUM_STEPS,
+                                                       NUM_ACTIVE,
+                                                       TIMEOUT);
+        timer.stop();
+        const double wheelTime = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start(true);
+        const int expiredMap = performance::runMap(NUM_TIMERS,
+                                                   NUM_STEPS,
+                                                   NUM_ACTIVE,
+                                                   TIMEOUT);
+        timer.stop();
+        const double mapTime = timer.accumulatedWallTime();
+
+        ASSERTV(expiredWheel, expiredMap, expiredWheel == expiredMap);
+
+        const double numOps = static_cast<double>(NUM_STEPS) * NUM_ACTIVE;
+
+        cout << "TimingWheel: " << wheelTime << "s, "
+             << numOps / wheelTime / 1e6 << " Mreschedules/s" << endl;
+        cout << "multimap:    " << mapTime << "s, "
+             << numOps / mapTime / 1e6 << " Mreschedules/s" << endl;
+        cout << "expired:     " << expiredWheel << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
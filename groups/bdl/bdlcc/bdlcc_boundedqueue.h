@@ -44,6 +44,19 @@ BSLS_IDENT("$Id: $")
 // `popFront` immediately and return an error code.  The queue may be restored
 // to normal operation with the `enablePopFront` method.
 //
+///Batch Operations
+///----------------
+// The `pushBackMany`, `popFrontMany`, and `tryPopFrontUpTo` methods transfer
+// a sequence of elements in one call.  A batch operation acquires as many
+// elements (or empty positions) as it can use from the queue's semaphores at
+// once, and completes the operations with a single update that makes the
+// transferred elements available to the complementary operation.  When many
+// elements are transferred between a small number of threads, this
+// substantially reduces the number of atomic operations and thread wake-ups
+// relative to invoking `pushBack` and `popFront` for each element.  Note that
+// the elements appended by one `pushBackMany` become visible to consumers
+// only after all of the elements acquired together have been written.
+//
 ///Comparison To FixedQueue
 ///------------------------
 // Both `bdlcc::FixedQueue` and `bdlcc::BoundedQueue` provide thread-aware
@@ -199,6 +212,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslalg_scalarprimitives.h>
 
+#include <bslma_destructionutil.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_isbitwisecopyable.h>
@@ -215,8 +229,11 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdint.h>
+#include <bsl_iterator.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -291,6 +308,99 @@ class BoundedQueue_PushExceptionCompleteProctor {
     void release();
 };
 
+                 // ========================================
+                 // class BoundedQueue_PopManyCompleteGuard
+                 // ========================================
+
+/// This class implements a guard that, upon destruction, destroys the value
+/// of the currently managed `NODE` (if any) and invokes
+/// `TYPE::popManyComplete` to account for the "pop" operations that were
+/// started by a batch removal.
+template <class TYPE, class NODE>
+class BoundedQueue_PopManyCompleteGuard {
+
+    // DATA
+    TYPE *d_queue_p;     // managed queue
+    NODE *d_node_p;      // node whose value is being removed, or 0
+    int   d_numStarted;  // number of started "pop" operations
+    int   d_numPopped;   // number of completed "pop" operations
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue_PopManyCompleteGuard();
+    BoundedQueue_PopManyCompleteGuard(
+                                     const BoundedQueue_PopManyCompleteGuard&);
+    BoundedQueue_PopManyCompleteGuard& operator=(
+                                     const BoundedQueue_PopManyCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `popManyComplete` guard managing the specified `queue` for
+    /// which the specified `numStarted` "pop" operations have been started.
+    BoundedQueue_PopManyCompleteGuard(TYPE *queue, int numStarted);
+
+    /// Destroy this object, destroy the value of the managed node (if any),
+    /// and invoke the `TYPE::popManyComplete` method with the number of
+    /// completed and the number of unused "pop" operations.
+    ~BoundedQueue_PopManyCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Destroy the value of the managed node, count the "pop" operation
+    /// associated with the node as completed, and manage no node.  The
+    /// behavior is undefined unless a node is managed by this guard.
+    void popComplete();
+
+    /// Manage the specified `node`, whose value is being removed.  The
+    /// behavior is undefined unless no node is managed by this guard.
+    void setNode(NODE *node);
+};
+
+                 // =========================================
+                 // class BoundedQueue_PushManyCompleteGuard
+                 // =========================================
+
+/// This class implements a guard that invokes `TYPE::pushManyComplete` upon
+/// destruction to account for the "push" operations that were started by a
+/// batch insertion.
+template <class TYPE>
+class BoundedQueue_PushManyCompleteGuard {
+
+    // DATA
+    TYPE *d_queue_p;     // managed queue
+    int   d_numStarted;  // number of started "push" operations
+    int   d_numPushed;   // number of completed "push" operations
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue_PushManyCompleteGuard();
+    BoundedQueue_PushManyCompleteGuard(
+                                    const BoundedQueue_PushManyCompleteGuard&);
+    BoundedQueue_PushManyCompleteGuard& operator=(
+                                    const BoundedQueue_PushManyCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `pushManyComplete` guard managing the specified `queue` for
+    /// which the specified `numStarted` "push" operations have been
+    /// started.
+    BoundedQueue_PushManyCompleteGuard(TYPE *queue, int numStarted);
+
+    /// Destroy this object and invoke the `TYPE::pushManyComplete` method
+    /// with the number of completed and the number of aborted "push"
+    /// operations.
+    ~BoundedQueue_PushManyCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Count one more "push" operation as completed.  The behavior is
+    /// undefined unless fewer than `numStarted` operations have been
+    /// counted as completed.
+    void pushComplete();
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -457,6 +567,12 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopManyCompleteGuard<
+                                            BoundedQueue<TYPE>,
+                                            typename BoundedQueue<TYPE>::Node>;
+
+    friend class BoundedQueue_PushManyCompleteGuard<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
 
     /// Return `true` if the specified `lhs` is circularly greater than the
@@ -529,10 +645,33 @@ class BoundedQueue {
     /// `tryPopFront` once an element is available.
     void popFrontHelper(TYPE *value);
 
+    /// Remove the specified `num` elements from the front of this queue and
+    /// assign them, in order, to successive positions of the specified
+    /// `output` iterator.  This method is invoked by `popFrontMany` and
+    /// `tryPopFrontUpTo` once `num` elements have been acquired from
+    /// `d_popSemaphore`.  The behavior is undefined unless `0 < num`.
+    template <class OUTPUT_ITER>
+    void popFrontManyHelper(int num, OUTPUT_ITER output);
+
+    /// Mark the specified `numPopped` "pop" operations as complete, return
+    /// the specified `numAborted` unused "pop" operations (and the elements
+    /// they acquired) to `d_popSemaphore`, and `post` to `d_pushSemaphore`
+    /// if appropriate.  This method is used within `popFrontManyHelper` by a
+    /// guard, and is also correct in the presence of an exception.
+    void popManyComplete(int numPopped, int numAborted);
+
     /// Mark a "push" operation as complete, and `post` to the `d_popSemaphore`
     /// if appropriate.
     void pushComplete();
 
+    /// Mark the specified `numPushed` "push" operations as complete, remove
+    /// the indicator for the specified `numAborted` started "push"
+    /// operations whose nodes were marked for reclamation, and `post` to
+    /// `d_popSemaphore` if appropriate.  This method is used within
+    /// `pushBackMany` by a guard, and is also correct in the presence of an
+    /// exception.
+    void pushManyComplete(int numPushed, int numAborted);
+
     /// Remove the indicator for a started push operation, and `post` to the
     /// `d_popSemaphore` if appropriate.  This method is used within
     /// `pushFront` by a proctor to complete the marking of a node to reclaim
@@ -610,6 +749,38 @@ class BoundedQueue {
     /// `disablePushBack` is invoked.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Remove at least one and at most the specified `maxNumItems` elements
+    /// from the front of this queue and assign them, in order, to successive
+    /// positions of the specified `output` iterator.  If the queue is empty,
+    /// block until it is not empty.  Return the number of elements removed,
+    /// or 0 if `isPopFrontDisabled()` or an error occurs.  Threads blocked
+    /// due to the queue being empty will return 0 if `disablePopFront` is
+    /// invoked.  The behavior is undefined unless `0 < maxNumItems`.  Note
+    /// that the synchronization with producers is performed once for the
+    /// batch rather than once per element.  Also note that if an exception
+    /// is thrown while assigning to `output`, the elements already assigned
+    /// and the element being assigned are removed from this queue, and the
+    /// remaining elements are left in the queue.
+    template <class OUTPUT_ITER>
+    bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
+    /// Append the elements in the specified range `[begin .. end)`, in
+    /// order, to the back of this queue.  If the queue is full, block until
+    /// it is not full.  Return 0 on success, and a non-zero value
+    /// otherwise.  Specifically, return `e_SUCCESS` on success,
+    /// `e_DISABLED` if `isPushBackDisabled()` and `e_FAILED` if an error
+    /// occurs.  On failure, the elements of the range preceding the first
+    /// element that could not be appended remain in this queue.  Threads
+    /// blocked due to the queue being full will return `e_DISABLED` if
+    /// `disablePushBack` is invoked.  Note that as much free capacity as is
+    /// needed by the range (and is available) is acquired at once, and the
+    /// appended elements are made available to consumers once per such
+    /// acquisition rather than once per element.  Also note that the items
+    /// in the range are treated as `const` objects, copied without being
+    /// modified.
+    template <class FORWARD_ITER>
+    int pushBackMany(FORWARD_ITER begin, FORWARD_ITER end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -625,6 +796,19 @@ class BoundedQueue {
     /// an error occurs.  On failure, `value` is not changed.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove, without blocking, up to the specified
+    /// `maxNumItems` elements from the front of this queue and assign them,
+    /// in order, to successive positions of the specified `output`
+    /// iterator.  Return the number of elements removed, which is 0 if
+    /// `isPopFrontDisabled()` or the queue was empty.  Note that the
+    /// synchronization with producers is performed once for the batch
+    /// rather than once per element.  Also note that if an exception is
+    /// thrown while assigning to `output`, the elements already assigned and
+    /// the element being assigned are removed from this queue, and the
+    /// remaining elements are left in the queue.
+    template <class OUTPUT_ITER>
+    bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_SUCCESS` on success, `e_DISABLED` if `isPushBackDisabled()`,
@@ -761,6 +945,88 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+                 // ----------------------------------------
+                 // class BoundedQueue_PopManyCompleteGuard
+                 // ----------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+inline
+BoundedQueue_PopManyCompleteGuard<TYPE, NODE>::
+              BoundedQueue_PopManyCompleteGuard(TYPE *queue, int numStarted)
+: d_queue_p(queue)
+, d_node_p(0)
+, d_numStarted(numStarted)
+, d_numPopped(0)
+{
+}
+
+template <class TYPE, class NODE>
+inline
+BoundedQueue_PopManyCompleteGuard<TYPE, NODE>::
+                                           ~BoundedQueue_PopManyCompleteGuard()
+{
+    if (d_node_p) {
+        popComplete();
+    }
+    d_queue_p->popManyComplete(d_numPopped, d_numStarted - d_numPopped);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void BoundedQueue_PopManyCompleteGuard<TYPE, NODE>::popComplete()
+{
+    BSLS_ASSERT(d_node_p);
+
+    bslma::DestructionUtil::destroy(d_node_p->d_value.address());
+
+    d_node_p = 0;
+    ++d_numPopped;
+}
+
+template <class TYPE, class NODE>
+inline
+void BoundedQueue_PopManyCompleteGuard<TYPE, NODE>::setNode(NODE *node)
+{
+    BSLS_ASSERT(!d_node_p);
+
+    d_node_p = node;
+}
+
+                 // -----------------------------------------
+                 // class BoundedQueue_PushManyCompleteGuard
+                 // -----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushManyCompleteGuard<TYPE>::
+             BoundedQueue_PushManyCompleteGuard(TYPE *queue, int numStarted)
+: d_queue_p(queue)
+, d_numStarted(numStarted)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushManyCompleteGuard<TYPE>::
+                                          ~BoundedQueue_PushManyCompleteGuard()
+{
+    d_queue_p->pushManyComplete(d_numPushed, d_numStarted - d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushManyCompleteGuard<TYPE>::pushComplete()
+{
+    BSLS_ASSERT(d_numPushed < d_numStarted);
+
+    ++d_numPushed;
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -930,6 +1196,96 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+void BoundedQueue<TYPE>::popFrontManyHelper(int num, OUTPUT_ITER output)
+{
+    BSLS_ASSERT(0 < num);
+
+    // Only one update of 'd_popCount' is needed to mark all 'num' operations
+    // started; the operations are completed, and the push semaphore is
+    // posted, once by the guard.
+
+    markStartedOperation(&d_popCount, num);
+
+    BoundedQueue_PopManyCompleteGuard<BoundedQueue<TYPE>, Node> guard(this,
+                                                                      num);
+
+    for (int i = 0; i < num; ++i) {
+        // 'd_popIndex' stores the next location to use (want the original
+        // value)
+
+        Uint64  index = (AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1)
+                                                                  % d_capacity;
+        Node   *node  = &d_element_p[index];
+
+        // See 'popFrontHelper' for the handling of nodes marked for
+        // reclamation.
+
+        while (node->isUnconstructed()) {
+            markReclaimed(&d_popCount);
+
+            index = (AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1)
+                                                                  % d_capacity;
+            node  = &d_element_p[index];
+        }
+
+        guard.setNode(node);
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        *output = bslmf::MovableRefUtil::move(node->d_value.object());
+#else
+        *output = node->d_value.object();
+#endif
+        ++output;
+
+        guard.popComplete();
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popManyComplete(int numPopped, int numAborted)
+{
+    if (numAborted) {
+        // The elements acquired by the aborted operations were not removed;
+        // make them available again.
+
+        d_popSemaphore.post(numAborted);
+    }
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                      &d_popCount,
+                        static_cast<Uint64>(numPopped)  * k_FINISHED_INC
+                      - static_cast<Uint64>(numAborted) * k_STARTED_INC);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.postWithRedundantSignal(
+                                                 numToPost,
+                                                 static_cast<int>(d_capacity),
+                                                 1);
+
+            Uint emptyCount = AtomicOp::getUintAcquire(&d_emptyWaiterCount);
+
+            if (isEmpty() && updateEmptyCountSeen(emptyCount)) {
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+                }
+                d_emptyCondition.broadcast();
+            }
+        }
+    }
+}
+
 template <class TYPE>
 inline
 void BoundedQueue<TYPE>::pushComplete()
@@ -952,6 +1308,33 @@ void BoundedQueue<TYPE>::pushComplete()
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushManyComplete(int numPushed, int numAborted)
+{
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                      &d_pushCount,
+                        static_cast<Uint64>(numPushed)  * k_FINISHED_INC
+                      - static_cast<Uint64>(numAborted) * k_STARTED_INC);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.postWithRedundantSignal(
+                                                 numToPost,
+                                                 static_cast<int>(d_capacity),
+                                                 1);
+        }
+    }
+}
+
 template <class TYPE>
 inline
 void BoundedQueue<TYPE>::pushExceptionComplete()
@@ -1124,6 +1507,94 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+bsl::size_t BoundedQueue<TYPE>::popFrontMany(bsl::size_t maxNumItems,
+                                             OUTPUT_ITER output)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+
+    if (d_popSemaphore.wait()) {
+        return 0;                                                     // RETURN
+    }
+
+    int num = 1;
+
+    if (1 < maxNumItems) {
+        num += d_popSemaphore.take(static_cast<int>(
+                                  bsl::min<Uint64>(maxNumItems - 1,
+                                                   d_capacity)));
+    }
+
+    popFrontManyHelper(num, output);
+
+    return static_cast<bsl::size_t>(num);
+}
+
+template <class TYPE>
+template <class FORWARD_ITER>
+int BoundedQueue<TYPE>::pushBackMany(FORWARD_ITER begin, FORWARD_ITER end)
+{
+    Uint64 remaining = static_cast<Uint64>(bsl::distance(begin, end));
+
+    while (remaining) {
+        int rv = d_pushSemaphore.wait();
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+
+        // Acquire, at once, as many empty elements as are needed and
+        // available.
+
+        int num = 1;
+
+        if (1 < remaining) {
+            num += d_pushSemaphore.take(static_cast<int>(
+                                        bsl::min(remaining - 1, d_capacity)));
+        }
+
+        markStartedOperation(&d_pushCount, num);
+
+        // 'd_pushIndex' stores the next location to use (want the original
+        // value)
+
+        Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, num) - num;
+
+        // Should an exception occur, the nodes not yet written must be
+        // skipped by "pop" operations.
+
+        for (int i = 0; i < num; ++i) {
+            d_element_p[(index + i) % d_capacity].setIsUnconstructed(true);
+        }
+
+        {
+            BoundedQueue_PushManyCompleteGuard<BoundedQueue<TYPE> > guard(
+                                                                         this,
+                                                                         num);
+
+            for (int i = 0; i < num; ++i, ++index, ++begin) {
+                Node& node = d_element_p[index % d_capacity];
+
+                bslalg::ScalarPrimitives::copyConstruct(
+                                                       node.d_value.address(),
+                                                       *begin,
+                                                       d_allocator_p);
+
+                node.setIsUnconstructed(false);
+
+                guard.pushComplete();
+            }
+        }
+
+        remaining -= num;
+    }
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::removeAll()
 {
@@ -1210,6 +1681,28 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+bsl::size_t BoundedQueue<TYPE>::tryPopFrontUpTo(bsl::size_t maxNumItems,
+                                                OUTPUT_ITER output)
+{
+    // Note that 'take' does not respect the disabled state of the semaphore.
+
+    if (0 == maxNumItems || d_popSemaphore.isDisabled()) {
+        return 0;                                                     // RETURN
+    }
+
+    int num = d_popSemaphore.take(static_cast<int>(
+                                      bsl::min<Uint64>(maxNumItems,
+                                                       d_capacity)));
+
+    if (num) {
+        popFrontManyHelper(num, output);
+    }
+
+    return static_cast<bsl::size_t>(num);
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
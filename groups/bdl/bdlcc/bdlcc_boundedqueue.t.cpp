@@ -24,6 +24,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -35,6 +36,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_format.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
@@ -84,8 +86,11 @@ using namespace bsl;
 // [ 2] int popFront(TYPE *value);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [16] size_t popFrontMany(size_t maxNumItems, OUTPUT_ITER output);
+// [16] int pushBackMany(FORWARD_ITER begin, FORWARD_ITER end);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [16] size_t tryPopFrontUpTo(size_t maxNumItems, OUTPUT_ITER output);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
 // [ 5] void disablePopFront();
@@ -102,7 +107,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [16] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -114,6 +119,8 @@ using namespace bsl;
 // [13] DRQS 164984269: `removeAll` STARTED/FINISHED ISSUE
 // [14] DRQS 153332608: `pushBack`, `pushBack`, `waitUntilEmpty`
 // [15] DRQS 168011541: `waitUntilEmpty` RACE WITH `disablePopFront`
+// [16] CONCERN: batch operations preserve per-producer ordering
+// [-1] BATCH OPERATIONS BENCHMARK
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -837,6 +844,160 @@ extern "C" void *case13_popFront(void *arg)
     return 0;
 }
 
+
+                        // =========================
+                        // BOUNDEDQUEUE_CASE_16 data
+                        // =========================
+
+namespace BOUNDEDQUEUE_CASE_16 {
+
+enum { k_SENTINEL = -1, k_PRODUCER_SHIFT = 20 };
+
+/// Append, using `pushBackMany` with ranges of at most the specified
+/// `batchSize` elements, the values `(id << k_PRODUCER_SHIFT) + i` for `i`
+/// in `[0 .. numValues)` to the specified `queue`, where `id` is the
+/// specified producer identifier.
+void producer(Obj *queue, int id, int numValues, int batchSize)
+{
+    bsl::vector<int> values;
+
+    for (int i = 0; i < numValues; i += batchSize) {
+        values.clear();
+        for (int j = i; j < numValues && j < i + batchSize; ++j) {
+            values.push_back((id << k_PRODUCER_SHIFT) + j);
+        }
+        int rc = queue->pushBackMany(values.begin(), values.end());
+        ASSERTV(rc, e_SUCCESS == rc);
+    }
+}
+
+/// Remove, using `popFrontMany` with at most the specified `batchSize`
+/// elements, values from the specified `queue` and append them to the
+/// specified `result` until `k_SENTINEL` is removed.
+void consumer(Obj *queue, bsl::vector<int> *result, int batchSize)
+{
+    bsl::vector<int> values;
+
+    while (true) {
+        values.clear();
+
+        bsl::size_t num = queue->popFrontMany(batchSize,
+                                              bsl::back_inserter(values));
+        ASSERT(0 < num);
+        ASSERT(num == values.size());
+
+        for (bsl::size_t i = 0; i < values.size(); ++i) {
+            if (k_SENTINEL == values[i]) {
+                // Return anything past the sentinel to the queue for the
+                // other consumers.
+
+                if (i + 1 < values.size()) {
+                    queue->pushBackMany(values.begin() + i + 1, values.end());
+                }
+                return;                                               // RETURN
+            }
+            result->push_back(values[i]);
+        }
+    }
+}
+
+/// Append the specified `numValues` values to the specified `queue` using
+/// `pushBack`.
+void singleProducer(Obj *queue, int numValues)
+{
+    for (int i = 0; i < numValues; ++i) {
+        queue->pushBack(i);
+    }
+}
+
+/// Remove values from the specified `queue` using `popFront` until
+/// `k_SENTINEL` is removed.
+void singleConsumer(Obj *queue)
+{
+    int value = 0;
+    while (k_SENTINEL != value) {
+        queue->popFront(&value);
+    }
+}
+
+/// Append the specified `numValues` values to the specified `queue` using
+/// `pushBackMany` with ranges of at most the specified `batchSize` elements.
+void batchProducer(Obj *queue, int numValues, int batchSize)
+{
+    bsl::vector<int> values(batchSize, 0);
+
+    for (int i = 0; i < numValues; i += batchSize) {
+        int num = bsl::min(batchSize, numValues - i);
+        queue->pushBackMany(values.begin(), values.begin() + num);
+    }
+}
+
+/// Remove values from the specified `queue` using `popFrontMany` with at
+/// most the specified `batchSize` elements until `k_SENTINEL` is removed.
+void batchConsumer(Obj *queue, int batchSize)
+{
+    bsl::vector<int> values(batchSize, 0);
+
+    while (true) {
+        bsl::size_t num = queue->popFrontMany(batchSize, values.begin());
+        for (bsl::size_t i = 0; i < num; ++i) {
+            if (k_SENTINEL == values[i]) {
+                if (i + 1 < num) {
+                    queue->pushBackMany(values.begin() + i + 1,
+                                        values.begin() + num);
+                }
+                return;                                               // RETURN
+            }
+        }
+    }
+}
+
+/// Transfer the specified `numValues` values through the specified `queue`
+/// from the specified `numProducers` threads to the specified
+/// `numConsumers` threads, using batch operations with the specified
+/// `batchSize` if `0 < batchSize`, and single-element operations otherwise.
+void transfer(Obj *queue,
+              int  numProducers,
+              int  numConsumers,
+              int  numValues,
+              int  batchSize)
+{
+    bslmt::ThreadGroup producers;
+    bslmt::ThreadGroup consumers;
+
+    int perProducer = numValues / numProducers;
+
+    if (0 < batchSize) {
+        consumers.addThreads(bdlf::BindUtil::bind(&batchConsumer,
+                                                  queue,
+                                                  batchSize),
+                             numConsumers);
+        producers.addThreads(bdlf::BindUtil::bind(&batchProducer,
+                                                  queue,
+                                                  perProducer,
+                                                  batchSize),
+                             numProducers);
+    }
+    else {
+        consumers.addThreads(bdlf::BindUtil::bind(&singleConsumer, queue),
+                             numConsumers);
+        producers.addThreads(bdlf::BindUtil::bind(&singleProducer,
+                                                  queue,
+                                                  perProducer),
+                             numProducers);
+    }
+
+    producers.joinAll();
+
+    for (int i = 0; i < numConsumers; ++i) {
+        queue->pushBack(k_SENTINEL);
+    }
+
+    consumers.joinAll();
+}
+
+}  // close namespace BOUNDEDQUEUE_CASE_16
+
 // ============================================================================
 //               GENERATOR FUNCTIONS `gg` AND `ggg` FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1065,7 +1226,7 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1091,6 +1252,307 @@ int main(int argc, char *argv[])
 
         myProducer(k_NUM_THREADS);
 
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. `pushBackMany` appends the elements of the range in order, and
+        //    `popFrontMany` and `tryPopFrontUpTo` remove up to the requested
+        //    number of elements in order.
+        //
+        // 2. `tryPopFrontUpTo` returns 0 if the queue is empty, and both
+        //    removal methods return 0 when the queue is dequeue disabled.
+        //
+        // 3. `pushBackMany` returns `e_DISABLED` when the queue is enqueue
+        //    disabled.
+        //
+        // 4. A range longer than the capacity of the queue is appended
+        //    completely, blocking until space is available.
+        //
+        // 5. When multiple producers and consumers use the batch methods, no
+        //    element is lost or duplicated, and the elements of each producer
+        //    are removed by each consumer in the order they were appended.
+        //
+        // 6. The batch methods are exception neutral: an exception while
+        //    writing an element leaves the preceding elements of the range in
+        //    the queue, and an exception while assigning a removed element
+        //    leaves the remaining elements in the queue.
+        //
+        // Plan:
+        // 1. Append a range with `pushBackMany`, remove elements with
+        //    `tryPopFrontUpTo` and `popFrontMany`, and verify the removed
+        //    values and the number of elements in the queue.  (C-1)
+        //
+        // 2. Invoke the methods on an empty, a dequeue disabled, and an
+        //    enqueue disabled queue and verify the results.  (C-2,3)
+        //
+        // 3. Append a range of 1000 elements to a queue of capacity 8 while
+        //    a consumer thread removes elements with `popFrontMany`; verify
+        //    the removed values.  (C-4)
+        //
+        // 4. Run several producer and consumer threads using the batch
+        //    methods, and verify every value is removed exactly once and that
+        //    the values of each producer are removed in order by each
+        //    consumer.  (C-5)
+        //
+        // 5. Use an allocating element type and the allocation limit of a
+        //    test allocator to inject exceptions, and verify the state of the
+        //    queue after each exception.  (C-6)
+        //
+        // Testing:
+        //   size_t popFrontMany(size_t maxNumItems, OUTPUT_ITER output);
+        //   int pushBackMany(FORWARD_ITER begin, FORWARD_ITER end);
+        //   size_t tryPopFrontUpTo(size_t maxNumItems, OUTPUT_ITER output);
+        //   CONCERN: batch operations preserve per-producer ordering
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        using namespace BOUNDEDQUEUE_CASE_16;
+
+        if (veryVerbose) cout << "Basic behavior" << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(16, &sa);  const Obj& X = mX;
+
+            int values[10];
+            for (int i = 0; i < 10; ++i) {
+                values[i] = i;
+            }
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(values, values + 10));
+            ASSERT(10 == X.numElements());
+
+            bsl::vector<int> result;
+
+            ASSERT(4 == mX.tryPopFrontUpTo(4, bsl::back_inserter(result)));
+            ASSERT(6 == X.numElements());
+
+            ASSERT(6 == mX.popFrontMany(100, bsl::back_inserter(result)));
+            ASSERT(0 == X.numElements());
+            ASSERT(X.isEmpty());
+
+            ASSERT(10 == result.size());
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, result[i], i == result[i]);
+            }
+
+            ASSERT(0 == mX.tryPopFrontUpTo(4, bsl::back_inserter(result)));
+            ASSERT(0 == mX.tryPopFrontUpTo(0, bsl::back_inserter(result)));
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(values, values));
+            ASSERT(0 == X.numElements());
+
+            // Capacity is used, and freed, exactly by the batch methods.
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(values, values + 10));
+            ASSERT(e_SUCCESS == mX.pushBackMany(values, values + 6));
+            ASSERT(X.isFull());
+            ASSERT(e_FULL == mX.tryPushBack(0));
+
+            result.clear();
+            ASSERT(16 == mX.tryPopFrontUpTo(20, bsl::back_inserter(result)));
+            ASSERT(X.isEmpty());
+            ASSERT(16 == result.size());
+
+            mX.disablePushBack();
+            ASSERT(e_DISABLED == mX.pushBackMany(values, values + 10));
+            ASSERT(0 == X.numElements());
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(values, values + 3));
+
+            mX.disablePopFront();
+            ASSERT(0 == mX.tryPopFrontUpTo(4, bsl::back_inserter(result)));
+            ASSERT(0 == mX.popFrontMany(4, bsl::back_inserter(result)));
+            ASSERT(3 == X.numElements());
+            mX.enablePopFront();
+
+            ASSERT(3 == mX.popFrontMany(4, bsl::back_inserter(result)));
+        }
+
+        if (veryVerbose) cout << "Range longer than capacity" << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(8, &sa);
+
+            bsl::vector<int> values;
+            for (int i = 0; i < 1000; ++i) {
+                values.push_back(i);
+            }
+            values.push_back(k_SENTINEL);
+
+            bsl::vector<int> result;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                          &handle,
+                                          bdlf::BindUtil::bind(&consumer,
+                                                               &mX,
+                                                               &result,
+                                                               5),
+                                          &defaultAllocator));
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(values.begin(),
+                                                values.end()));
+
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(1000 == result.size());
+            for (int i = 0; i < static_cast<int>(result.size()); ++i) {
+                ASSERTV(i, result[i], i == result[i]);
+            }
+        }
+
+        if (veryVerbose) cout << "Multiple producers and consumers" << endl;
+        {
+            enum {
+                k_NUM_PRODUCERS = 4,
+                k_NUM_CONSUMERS = 4,
+                k_NUM_VALUES    = 5000
+            };
+
+            const int BATCH_SIZES[] = { 1, 3, 16, 100 };
+            const int NUM_BATCH_SIZES = sizeof BATCH_SIZES
+                                                       / sizeof *BATCH_SIZES;
+
+            for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+                const int BATCH_SIZE = BATCH_SIZES[bi];
+
+                if (veryVeryVerbose) { T_ P(BATCH_SIZE); }
+
+                bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                Obj mX(32, &sa);
+
+                bsl::vector<int> results[k_NUM_CONSUMERS];
+
+                bslmt::ThreadGroup consumers;
+                bslmt::ThreadGroup producers;
+
+                for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                    consumers.addThread(bdlf::BindUtil::bind(&consumer,
+                                                             &mX,
+                                                             &results[i],
+                                                             BATCH_SIZE));
+                }
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(&producer,
+                                                             &mX,
+                                                             i,
+                                                             k_NUM_VALUES,
+                                                             BATCH_SIZE));
+                }
+
+                producers.joinAll();
+
+                int sentinels[k_NUM_CONSUMERS];
+                for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                    sentinels[i] = k_SENTINEL;
+                }
+                ASSERT(e_SUCCESS == mX.pushBackMany(
+                                              sentinels,
+                                              sentinels + k_NUM_CONSUMERS));
+
+                consumers.joinAll();
+
+                bsl::vector<int> count(k_NUM_PRODUCERS * k_NUM_VALUES, 0);
+
+                for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                    int last[k_NUM_PRODUCERS];
+                    for (int j = 0; j < k_NUM_PRODUCERS; ++j) {
+                        last[j] = -1;
+                    }
+
+                    for (bsl::size_t j = 0; j < results[i].size(); ++j) {
+                        const int id  = results[i][j] >> k_PRODUCER_SHIFT;
+                        const int seq = results[i][j]
+                                           & ((1 << k_PRODUCER_SHIFT) - 1);
+
+                        ASSERTV(BATCH_SIZE, id, last[id], seq,
+                                last[id] < seq);
+                        last[id] = seq;
+
+                        ++count[id * k_NUM_VALUES + seq];
+                    }
+                }
+
+                for (bsl::size_t i = 0; i < count.size(); ++i) {
+                    ASSERTV(BATCH_SIZE, i, count[i], 1 == count[i]);
+                }
+
+                ASSERT(mX.isEmpty());
+            }
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (veryVerbose) cout << "Exception neutrality" << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bdlcc::BoundedQueue<AllocExceptionHelper>        mX(8, &sa);
+            const bdlcc::BoundedQueue<AllocExceptionHelper>& X = mX;
+
+            bsl::vector<AllocExceptionHelper> values(3,
+                                                     AllocExceptionHelper(&sa),
+                                                     &sa);
+
+            int numException = 0;
+
+            // The second element's copy construction fails.
+
+            sa.setAllocationLimit(1);
+            try {
+                mX.pushBackMany(values.begin(), values.end());
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
+
+            ASSERT(1 == numException);
+            ASSERT(1 == X.numElements());
+
+            // The unwritten elements are reclaimed by removal operations.
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(values.begin(),
+                                                values.end()));
+            ASSERT(4 == X.numElements());
+
+            bsl::vector<AllocExceptionHelper> result(&sa);
+
+            ASSERT(4 == mX.tryPopFrontUpTo(8, bsl::back_inserter(result)));
+            ASSERT(0 == X.numElements());
+            ASSERT(e_SUCCESS == mX.pushBackMany(values.begin(),
+                                                values.end()));
+            ASSERT(3 == X.numElements());
+
+            // The assignment to the first element fails.
+
+            sa.setAllocationLimit(0);
+            try {
+                mX.popFrontMany(3, values.begin());
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
+
+            ASSERT(2 == numException);
+            ASSERT(2 == X.numElements());
+
+            ASSERT(2 == mX.popFrontMany(3, values.begin()));
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(values.begin(),
+                                                values.end()));
+            ASSERT(3 == X.numElements());
+        }
+#endif
       } break;
       case 15: {
         // --------------------------------------------------------------------
@@ -3164,6 +3626,73 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS BENCHMARK
+        //
+        // Concerns:
+        // 1. The batch methods provide higher throughput than the
+        //    single-element methods when transferring many elements.
+        //
+        // Plan:
+        // 1. For several thread configurations, transfer a fixed number of
+        //    elements using `pushBack`/`popFront` and using
+        //    `pushBackMany`/`popFrontMany` with several batch sizes, and
+        //    report the throughput of each run in CSV format.  (C-1)
+        //
+        // Testing:
+        //   BATCH OPERATIONS BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS BENCHMARK" << endl
+                          << "==========================" << endl;
+
+        using namespace BOUNDEDQUEUE_CASE_16;
+
+        const int numValues = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        const int CONFIGS[][2] = { { 1, 1 }, { 1, 4 }, { 4, 1 }, { 4, 4 } };
+        const int NUM_CONFIGS  = sizeof CONFIGS / sizeof *CONFIGS;
+
+        const int BATCH_SIZES[] = { 0, 4, 16, 64 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        cout << "producers,consumers,method,batch,seconds,elements_per_second"
+             << endl;
+
+        for (int ci = 0; ci < NUM_CONFIGS; ++ci) {
+            const int NUM_PRODUCERS = CONFIGS[ci][0];
+            const int NUM_CONSUMERS = CONFIGS[ci][1];
+
+            for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+                const int BATCH_SIZE = BATCH_SIZES[bi];
+
+                Obj mX(1024);
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                transfer(&mX,
+                         NUM_PRODUCERS,
+                         NUM_CONSUMERS,
+                         numValues,
+                         BATCH_SIZE);
+
+                timer.stop();
+
+                const double seconds = timer.elapsedTime();
+
+                cout << NUM_PRODUCERS << ','
+                     << NUM_CONSUMERS << ','
+                     << (BATCH_SIZE ? "batch" : "single") << ','
+                     << (BATCH_SIZE ? BATCH_SIZE : 1) << ','
+                     << seconds << ','
+                     << static_cast<bsls::Types::Int64>(numValues / seconds)
+                     << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -27,11 +27,20 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
-// order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// Three eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), and CLOCK.  With LRU, the item that has *not* been
+// accessed for the longest period of time will be evicted first.  With FIFO,
+// the eviction order is based on the order of insertion, with the earliest
+// inserted item being evicted first.
+//
+// CLOCK (also known as "second chance") approximates LRU without modifying
+// the eviction queue on a cache hit.  Instead, a successful `tryGetValue`
+// sets a "referenced" flag on the item.  When an item is to be evicted, the
+// items at the front of the eviction queue whose flag is set have the flag
+// cleared and are moved to the back of the queue (i.e., are given a second
+// chance), and the first item found whose flag is not set is evicted.  Items
+// that are accessed frequently therefore tend to remain in the cache, as with
+// LRU, but a cache hit needs only a read lock (see {Thread Contention}).
 //
 ///Thread Safety
 ///-------------
@@ -51,10 +60,14 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the `tryGetValue` method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means `tryGetValue`
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument `modifyEvictionQueue` is set to `false`.  For limited cases where
-// contention is likely, temporarily setting `modifyEvictionQueue` to `false`
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO or CLOCK, or
+// the argument `modifyEvictionQueue` is set to `false`.  For limited cases
+// where contention is likely, temporarily setting `modifyEvictionQueue` to
+// `false` might be of value.  For read-mostly workloads, where the LRU policy
+// serializes all readers on the write lock, the CLOCK policy usually provides
+// a similar hit rate with much higher throughput.  Contention on the lock
+// itself can be further reduced by partitioning the items across several
+// caches, as is done by `bdlcc::StripedCache`.
 //
 // The `visit` method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -91,7 +104,7 @@ BSLS_IDENT("$Id: $")
 // | tryGetValue                                        | Average: O[1]      |
 // |                                                    | Worst:   O[n]      |
 // +----------------------------------------------------+--------------------+
-// | popFront                                           | O[1]               |
+// | popFront                                           | O[1] (1)           |
 // +----------------------------------------------------+--------------------+
 // | erase                                              | Average: O[1]      |
 // |                                                    | Worst:   O[n]      |
@@ -99,6 +112,8 @@ BSLS_IDENT("$Id: $")
 // | visit                                              | O[n]               |
 // +----------------------------------------------------+--------------------+
 // ```
+// (1) With the CLOCK policy, eviction (by `popFront` or by an `insert` that
+// reaches the high watermark) is amortized O[1], and O[n] in the worst case.
 //
 ///Usage
 ///-----
@@ -312,6 +327,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_movableref.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_libraryfeatures.h>
 #include <bsls_review.h>
 
@@ -335,8 +351,9 @@ struct CacheEvictionPolicy {
     /// Enumeration of supported cache eviction policies.
     enum Enum {
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,   // Least Recently Used
+        e_FIFO,  // First In, First Out
+        e_CLOCK  // Second chance, approximating LRU
     };
 };
 
@@ -375,6 +392,42 @@ class Cache_QueueProctor {
     void release();
 };
 
+/// This component-private class template is the value type of the hash map
+/// of a `Cache`.  It holds the (template parameter) `VALUE_PTR` pointing to
+/// the cached value, the position of the key in the eviction queue, and the
+/// "referenced" flag used by the CLOCK eviction policy.  The flag may be set
+/// while only a read lock is held on the cache.
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct Cache_MapValue {
+
+    // PUBLIC DATA
+    VALUE_PTR                d_valuePtr;    // cached value
+
+    QUEUE_ITERATOR           d_queueIt;     // position in eviction queue
+
+    bsls::AtomicBool         d_referenced;  // `true` if accessed since last
+                                            // considered for eviction (CLOCK
+                                            // policy only)
+
+    // CREATORS
+
+    /// Create a `Cache_MapValue` object holding the specified `valuePtr`
+    /// and `queueIt`, and whose referenced flag is not set.
+    Cache_MapValue(const VALUE_PTR& valuePtr, const QUEUE_ITERATOR& queueIt);
+    Cache_MapValue(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                   const QUEUE_ITERATOR&        queueIt);
+
+    /// Create a `Cache_MapValue` object having the same value as the
+    /// specified `original` object.  In the second overload, `original` is
+    /// left in a valid but unspecified state.
+    Cache_MapValue(const Cache_MapValue& original);
+    Cache_MapValue(bslmf::MovableRef<Cache_MapValue> original);
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_MapValue& operator=(const Cache_MapValue&);
+};
+
 template <class KEY,
           class VALUE,
           class HASH  = bsl::hash<KEY>,
@@ -408,7 +461,8 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
 
     /// Value type of the hash map.
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
+    typedef Cache_MapValue<ValuePtrType, typename QueueType::iterator>
+                                                                  MapValue;
 
     /// Hash map type.
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
@@ -461,6 +515,13 @@ class Cache {
     /// callback for that item.
     void evictItem(const typename MapType::iterator& mapIt);
 
+    /// Return an iterator to the item in the hash map that is the next to be
+    /// evicted according to the eviction policy of this cache.  If the
+    /// policy is CLOCK, first move each item at the front of the eviction
+    /// queue whose referenced flag is set to the back of the queue, clearing
+    /// its flag.  The behavior is undefined if this cache is empty.
+    typename MapType::iterator evictionCandidate();
+
     /// Add a node with the specified `*key_p` and the specified `*valuePtr_p`
     /// to the cache.  If an entry already exists for `*key_p`, override its
     /// value with `*valuePtr_p`.  If the specified `moveKey` is `true`, move
@@ -585,7 +646,10 @@ class Cache {
 
     /// Remove the item at the front of the eviction queue.  Invoke the
     /// post-eviction callback for the removed item.  Return 0 on success,
-    /// and 1 if this cache is empty.
+    /// and 1 if this cache is empty.  Note that, if the eviction policy is
+    /// CLOCK, the items at the front of the queue whose referenced flag is
+    /// set are first given a second chance, so the removed item is the one
+    /// that would next be evicted.
     int popFront();
 
     /// Set the post-eviction callback to the specified
@@ -597,7 +661,9 @@ class Cache {
     /// Load, into the specified `value`, the value associated with the
     /// specified `key` in this cache.  If the optionally specified
     /// `modifyEvictionQueue` is `true` and the eviction policy is LRU, then
-    /// move the cached item to the back of the eviction queue.  Return 0 on
+    /// move the cached item to the back of the eviction queue; if
+    /// `modifyEvictionQueue` is `true` and the eviction policy is CLOCK,
+    /// then set the referenced flag of the cached item.  Return 0 on
     /// success, and 1 if `key` does not exist in this cache.  Note that a
     /// write lock is acquired only if this queue is modified.
     int tryGetValue(bsl::shared_ptr<VALUE> *value,
@@ -716,6 +782,55 @@ void Cache_QueueProctor<KEY>::release()
     d_queue_p = 0;
 }
 
+                        // --------------------
+                        // class Cache_MapValue
+                        // --------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                const VALUE_PTR&      valuePtr,
+                                                const QUEUE_ITERATOR& queueIt)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                  bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                  const QUEUE_ITERATOR&        queueIt)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                const Cache_MapValue& original)
+: d_valuePtr(original.d_valuePtr)
+, d_queueIt(original.d_queueIt)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                    bslmf::MovableRef<Cache_MapValue> original)
+: d_valuePtr(bslmf::MovableRefUtil::move(
+                          bslmf::MovableRefUtil::access(original).d_valuePtr))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_referenced(
+         bslmf::MovableRefUtil::access(original).d_referenced.loadRelaxed())
+{
+}
+
                         // -----------
                         // class Cache
                         // -----------
@@ -782,9 +897,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(evictionCandidate());
     }
 }
 
@@ -792,15 +905,41 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
 
-    d_queue.erase(mapIt->second.second);
+    d_queue.erase(mapIt->second.d_queueIt);
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
         d_postEvictionCallback(value);
     }
 }
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::evictionCandidate()
+{
+    BSLS_ASSERT(!d_queue.empty());
+
+    typename MapType::iterator mapIt = d_map.find(d_queue.front());
+    BSLS_ASSERT(mapIt != d_map.end());
+
+    if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy) {
+        // The write lock is held, so no flag can be set while we rotate the
+        // queue, and at most one full rotation is needed.
+
+        while (mapIt->second.d_referenced.loadRelaxed()) {
+            mapIt->second.d_referenced.storeRelaxed(false);
+            d_queue.splice(d_queue.end(), d_queue, d_queue.begin());
+
+            mapIt = d_map.find(d_queue.front());
+            BSLS_ASSERT(mapIt != d_map.end());
+        }
+    }
+
+    return mapIt;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
@@ -823,13 +962,13 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
         // Move 'queueIt' to the back of 'd_queue'.
 
@@ -848,13 +987,10 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
-                                      queueIt,
-                                      d_allocator_p);
+                                      queueIt);
         }
         else {
-            new (mapValue_p) MapValue(valuePtr,
-                                      queueIt,
-                                      d_allocator_p);
+            new (mapValue_p) MapValue(valuePtr, queueIt);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
@@ -1055,9 +1191,7 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(evictionCandidate());
         return 0;                                                     // RETURN
     }
 
@@ -1098,16 +1232,26 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    *value = mapIt->second.d_valuePtr;
 
     if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
         typename QueueType::iterator last = d_queue.end();
         --last;
         if (last != queueIt) {
             d_queue.splice(d_queue.end(), d_queue, queueIt);
         }
     }
+    else if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy &&
+             modifyEvictionQueue) {
+        // Only a read lock is held.  Test the flag first so that a frequently
+        // accessed item's node is not written to on every hit.
+
+        bsls::AtomicBool& referenced = mapIt->second.d_referenced;
+        if (!referenced.loadRelaxed()) {
+            referenced.storeRelaxed(true);
+        }
+    }
 
     return 0;
 }
@@ -1169,7 +1313,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
         const KEY&                             key = *queueIt;
         const typename MapType::const_iterator mapIt = d_map.find(key);
         BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+        const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
         if (!visitor(key, *valuePtr)) {
             break;
@@ -9,13 +9,19 @@
 #include <bdlb_random.h>
 #include <bdlb_randomdevice.h>
 
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
 #include <bslim_testutil.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_semaphore.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
@@ -38,10 +44,12 @@
 #include <bsls_atomic.h>
 #include <bsls_review.h>
 #include <bsls_nameof.h>
+#include <bsls_stopwatch.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>  // `CachePerformance`
 #include <bsls_types.h>     // `BloombergLP::bsls::Types::Int64`
 
+#include <bsl_algorithm.h>
 #include <bsl_format.h>
 #include <bsl_iostream.h>
 #include <bsl_vector.h>
@@ -137,11 +145,13 @@ using namespace bsl;
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
 // [19] CONCERN: USE `allocator_arg` CONSTRUCTORS
-// [20] USAGE EXAMPLE
+// [20] CLOCK EVICTION POLICY
+// [21] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
 // [-4] READ WRITE PERFORMANCE
+// [-5] HIT RATE AND THROUGHPUT OF EVICTION POLICIES
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1135,6 +1145,134 @@ extern "C" void *workFunc(void *arg)
 
 }  // close namespace cacheperf
 
+namespace policyperf {
+
+typedef bdlcc::Cache<int, int> CacheType;
+
+/// This class generates keys in `[0 .. numKeys)` following a Zipf
+/// distribution, in which the probability of the key `k` is proportional to
+/// `1 / (k + 1)^0.99`, as is typical of the popularity of cached items.
+class ZipfGenerator {
+
+    // DATA
+    bsl::vector<double> d_cdf;   // cumulative probability of each key
+
+    int                 d_seed;  // seed of `bdlb::Random`
+
+  public:
+    // CREATORS
+
+    /// Create a generator of keys in `[0 .. numKeys)` using the specified
+    /// `seed` and the specified `basicAllocator` to supply memory.
+    ZipfGenerator(int numKeys, int seed, bslma::Allocator *basicAllocator)
+    : d_cdf(basicAllocator)
+    , d_seed(seed)
+    {
+        d_cdf.reserve(numKeys);
+
+        double sum = 0;
+        for (int k = 0; k < numKeys; ++k) {
+            sum += 1 / bsl::pow(k + 1.0, 0.99);
+            d_cdf.push_back(sum);
+        }
+        for (int k = 0; k < numKeys; ++k) {
+            d_cdf[k] /= sum;
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Return the next key.
+    int operator()()
+    {
+        const double u = ((bdlb::Random::generate15(&d_seed) << 15) |
+                           bdlb::Random::generate15(&d_seed)) /
+                                                      double(1 << 30);
+        const int key = static_cast<int>(
+                  bsl::lower_bound(d_cdf.begin(), d_cdf.end(), u) -
+                                                              d_cdf.begin());
+        return key < static_cast<int>(d_cdf.size()) ? key : key - 1;
+    }
+};
+
+/// Look up, in the specified `cache`, the specified `numOps` keys generated
+/// by a `ZipfGenerator` over the specified `numKeys` keys using the
+/// specified `seed`, after waiting on the specified `barrier`.  Insert each
+/// key that is not found, and add the number of lookups that found their key
+/// to the specified `hits`.
+void worker(CacheType       *cache,
+            bslmt::Barrier  *barrier,
+            bsls::AtomicInt *hits,
+            int              numOps,
+            int              numKeys,
+            int              seed)
+{
+    bslma::NewDeleteAllocator na;
+    ZipfGenerator             generator(numKeys, seed, &na);
+
+    barrier->wait();
+
+    CacheType::ValuePtrType valuePtr;
+
+    int found = 0;
+    for (int i = 0; i < numOps; ++i) {
+        const int key = generator();
+        if (0 == cache->tryGetValue(&valuePtr, key)) {
+            ++found;
+        }
+        else {
+            cache->insert(key, key);
+        }
+    }
+    *hits += found;
+}
+
+/// Run the specified `numThreads` threads each looking up the specified
+/// `numOps` keys among the specified `numKeys` keys in an initially empty
+/// cache using the specified `evictionPolicy` and holding at most the
+/// specified `capacity` items.  Load into the specified `hitRate` the
+/// fraction of lookups that found their key, and return the wall time of the
+/// run, in seconds.
+double run(double                           *hitRate,
+           bdlcc::CacheEvictionPolicy::Enum  evictionPolicy,
+           int                               numThreads,
+           int                               numOps,
+           int                               numKeys,
+           int                               capacity)
+{
+    bslma::NewDeleteAllocator na;
+
+    CacheType          cache(evictionPolicy,
+                             capacity * 9 / 10,
+                             capacity,
+                             &na);
+    bsls::AtomicInt    hits(0);
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads(&na);
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(bdlf::BindUtil::bindS(&na,
+                                                &worker,
+                                                &cache,
+                                                &barrier,
+                                                &hits,
+                                                numOps,
+                                                numKeys,
+                                                i + 1));
+    }
+
+    bsls::Stopwatch timer;
+    barrier.wait();
+    timer.start(true);
+    threads.joinAll();
+    timer.stop();
+
+    *hitRate = static_cast<double>(hits) / (double(numThreads) * numOps);
+    return timer.accumulatedWallTime();
+}
+
+}  // close namespace policyperf
+
 namespace testLock {
 
 bslma::TestAllocator talloc("tl", veryVeryVeryVerbose);
@@ -1378,6 +1516,11 @@ void testLocking()
     //    eviction policy, run `tryGetValue` and measure how long it took to
     //    complete.  It should be less than sec.
     //
+    // 14. Spawn a thread that calls `lockRead`, sleep for 0.1sec, and calls
+    //    `unlock`.  On the main thread, use a `bdlcc:Cache` object with CLOCK
+    //    eviction policy, run `tryGetValue` on a key in the cache and measure
+    //    how long it took to complete.  It should be less than 0.1 sec.
+    //
     // Testing:
     //   void insert(const KEYTYPE& key, const VALUETYPE& value);
     //   void insert(const KEYTYPE& key, const ValuePtrType& valuePtr);
@@ -1656,6 +1799,33 @@ void testLocking()
         ASSERT(duration < k_SLEEP_PERIOD / 2);
     }
 
+    CacheType          clockCache(bdlcc::CacheEvictionPolicy::e_CLOCK, 10, 20,
+                                                                      &talloc);
+    Cache_TestUtilType clockCache_TestUtil(clockCache);
+    ThreadData         tdClockRead(&clockCache_TestUtil, k_SLEEP_PERIOD, 'R');
+
+    clockCache.insert(8, "Eight");
+
+    // LockRead / tryGetValue, CLOCK
+    {
+        // A hit sets the referenced flag of the item, which requires only a
+        // read lock.
+
+        bslmt::ThreadUtil::create(&handle, workThread, &tdClockRead);
+        smp.wait();
+        // Time the duration how long it took to run `tryGetValue`
+        TimeType startTime = bsls::TimeUtil::getTimer();
+
+        bsl::shared_ptr<bsl::string> valuePtr;
+        int                          rc = clockCache.tryGetValue(&valuePtr, 8);
+
+        TimeType endTime = bsls::TimeUtil::getTimer();
+        int      duration = static_cast<int>((endTime - startTime) / 1000);
+        bslmt::ThreadUtil::join(handle, &result);
+
+        ASSERT(0 == rc);
+        ASSERT(duration < k_SLEEP_PERIOD / 2);
+    }
 }
 }  // close namespace testLock
 
@@ -1781,6 +1951,244 @@ void threadedTest1()
 
 }  // close namespace threaded
 
+namespace testClock {
+
+bslma::TestAllocator talloc("tc", veryVeryVeryVerbose);
+
+bsls::AtomicInt nextSeed(1);  // seed of the next worker thread
+
+typedef bdlcc::Cache<int, int> CacheType;
+
+/// This visitor appends the keys of the visited items to a vector.
+struct KeyCollector {
+
+    bsl::vector<int> d_keys;
+
+    explicit KeyCollector(bslma::Allocator *basicAllocator)
+    : d_keys(basicAllocator)
+    {}
+
+    bool operator() (int key, int)
+    {
+        d_keys.push_back(key);
+        return true;
+    }
+};
+
+/// Return the keys of the items in the specified `cache`, in the order of its
+/// eviction queue, as a string of decimal digits.
+bsl::string keysOf(const CacheType& cache)
+{
+    KeyCollector collector(&talloc);
+    cache.visit(collector);
+
+    bsl::string result(&talloc);
+    for (bsl::size_t i = 0; i < collector.d_keys.size(); ++i) {
+        result.push_back(static_cast<char>('0' + collector.d_keys[i]));
+    }
+    return result;
+}
+
+/// Append the value pointed to by the specified `valuePtr` to the specified
+/// `evicted` vector.
+void recordEviction(bsl::vector<int>            *evicted,
+                    const bsl::shared_ptr<int>&  valuePtr)
+{
+    evicted->push_back(*valuePtr);
+}
+
+/// Until the specified `stop` is set, look up random keys less than the
+/// specified `numKeys` in the specified `cache`, and insert each key that is
+/// not found, using the specified `seed` to generate the keys.
+void worker(CacheType *cache, bsls::AtomicInt *stop, int numKeys, int seed)
+{
+    while (0 == *stop) {
+        const int key = bdlb::Random::generate15(&seed) % numKeys;
+
+        CacheType::ValuePtrType valuePtr;
+        if (0 != cache->tryGetValue(&valuePtr, key)) {
+            cache->insert(key, key);
+        }
+        else {
+            ASSERTV(key, *valuePtr, key == *valuePtr);
+        }
+    }
+}
+
+extern "C" void *clockWorkerThread(void *v_arg)
+{
+    typedef bsl::pair<CacheType *, bsls::AtomicInt *> Arg;
+
+    Arg *arg = static_cast<Arg *>(v_arg);
+
+    worker(arg->first, arg->second, 64, nextSeed++);
+    return 0;
+}
+
+void testClockPolicy()
+{
+    // ------------------------------------------------------------------------
+    // CLOCK EVICTION POLICY
+    //
+    // Concerns:
+    // 1. With the CLOCK policy, items that have not been accessed are evicted
+    //    in the order of insertion.
+    //
+    // 2. An item found by `tryGetValue` is not evicted the next time it is at
+    //    the front of the eviction queue; instead, it is moved to the back of
+    //    the queue and its referenced flag is cleared, so that it is evicted
+    //    after one more pass if it is not accessed again.
+    //
+    // 3. `tryGetValue` with `modifyEvictionQueue` set to `false` does not set
+    //    the referenced flag, and `tryGetValue` does not itself change the
+    //    order of the eviction queue.
+    //
+    // 4. `popFront` gives referenced items a second chance, and invokes the
+    //    post-eviction callback for the removed item.
+    //
+    // 5. If every item is referenced, the item at the front of the queue is
+    //    evicted after one full pass.
+    //
+    // 6. `erase` and `clear` behave as for the other policies.
+    //
+    // 7. Concurrent lookups and insertions, which evict items while other
+    //    threads set referenced flags, keep the cache consistent.
+    //
+    // Plan:
+    // 1. Create a CLOCK cache having both watermarks 3, perform sequences of
+    //    `insert`, `tryGetValue`, and `popFront`, and verify the items in the
+    //    cache, in the order of the eviction queue, using `visit`.  (C-1..6)
+    //
+    // 2. Run several threads looking up keys from a range larger than the
+    //    high watermark of a shared CLOCK cache, and inserting those not
+    //    found.  Then verify that the size of the cache does not exceed the
+    //    high watermark and that every item holds the value of its key.
+    //    (C-7)
+    //
+    // Testing:
+    //   CLOCK EVICTION POLICY
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator ta("clock", veryVeryVeryVerbose);
+
+    {
+        CacheType cache(bdlcc::CacheEvictionPolicy::e_CLOCK, 3, 3, &ta);
+        ASSERT(bdlcc::CacheEvictionPolicy::e_CLOCK == cache.evictionPolicy());
+
+        bsl::vector<int> evicted(&ta);
+        cache.setPostEvictionCallback(
+                          bdlf::BindUtil::bind(&recordEviction,
+                                               &evicted,
+                                               bdlf::PlaceHolders::_1));
+
+        CacheType::ValuePtrType valuePtr;
+
+        // C-1
+
+        cache.insert(0, 0);
+        cache.insert(1, 10);
+        cache.insert(2, 20);
+        ASSERTV(keysOf(cache), "012" == keysOf(cache));
+
+        cache.insert(3, 30);
+        ASSERTV(keysOf(cache), "123" == keysOf(cache));
+        ASSERTV(evicted.size(), 1 == evicted.size() && 0 == evicted.back());
+
+        // C-2, C-3
+
+        ASSERT(0 == cache.tryGetValue(&valuePtr, 1));
+        ASSERT(10 == *valuePtr);
+        ASSERTV(keysOf(cache), "123" == keysOf(cache));
+
+        cache.insert(4, 40);
+        ASSERTV(keysOf(cache), "314" == keysOf(cache));
+        ASSERTV(evicted.size(), 2 == evicted.size() && 20 == evicted.back());
+
+        cache.insert(5, 50);
+        ASSERTV(keysOf(cache), "145" == keysOf(cache));
+
+        cache.insert(6, 60);
+        ASSERTV(keysOf(cache), "456" == keysOf(cache));
+        ASSERTV(evicted.size(), 4 == evicted.size() && 10 == evicted.back());
+
+        ASSERT(0 == cache.tryGetValue(&valuePtr, 4, false));
+        cache.insert(7, 70);
+        ASSERTV(keysOf(cache), "567" == keysOf(cache));
+        ASSERTV(evicted.size(), 5 == evicted.size() && 40 == evicted.back());
+
+        ASSERT(1 == cache.tryGetValue(&valuePtr, 4));
+
+        // C-4
+
+        ASSERT(0 == cache.tryGetValue(&valuePtr, 5));
+        ASSERT(0 == cache.popFront());
+        ASSERTV(keysOf(cache), "75" == keysOf(cache));
+        ASSERTV(evicted.size(), 6 == evicted.size() && 60 == evicted.back());
+
+        // C-5
+
+        ASSERT(0 == cache.tryGetValue(&valuePtr, 7));
+        ASSERT(0 == cache.tryGetValue(&valuePtr, 5));
+        ASSERT(0 == cache.popFront());
+        ASSERTV(keysOf(cache), "5" == keysOf(cache));
+        ASSERTV(evicted.size(), 7 == evicted.size() && 70 == evicted.back());
+
+        // C-6
+
+        cache.insert(8, 80);
+        ASSERT(0 == cache.erase(5));
+        ASSERT(1 == cache.erase(5));
+        ASSERTV(keysOf(cache), "8" == keysOf(cache));
+        ASSERTV(evicted.size(), 8 == evicted.size() && 50 == evicted.back());
+
+        cache.clear();
+        ASSERT(0 == cache.size());
+        ASSERT(1 == cache.popFront());
+        ASSERTV(evicted.size(), 8 == evicted.size());
+    }
+    ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+    // C-7
+
+    {
+        const int k_NUM_WORKERS = 4;
+
+        CacheType       cache(bdlcc::CacheEvictionPolicy::e_CLOCK,
+                              16,
+                              32,
+                              &ta);
+        bsls::AtomicInt stop(0);
+
+        bsl::pair<CacheType *, bsls::AtomicInt *> arg(&cache, &stop);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_WORKERS];
+        for (int i = 0; i < k_NUM_WORKERS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  clockWorkerThread,
+                                                  &arg));
+        }
+
+        bslmt::ThreadUtil::microSleep(0, 1);
+        stop = 1;
+
+        for (int i = 0; i < k_NUM_WORKERS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        ASSERTV(cache.size(), 32 >= cache.size());
+
+        for (int key = 0; key < 64; ++key) {
+            CacheType::ValuePtrType valuePtr;
+            if (0 == cache.tryGetValue(&valuePtr, key, false)) {
+                ASSERTV(key, *valuePtr, key == *valuePtr);
+            }
+        }
+    }
+    ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+}
+
+}  // close namespace testClock
+
 namespace {
 
 class TypeWithAllocatorArg {
@@ -4305,7 +4713,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4326,6 +4734,9 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 20: {
+        testClock::testClockPolicy();
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // CONCERN: USE `allocator_arg` CONSTRUCTORS
@@ -4439,7 +4850,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to insert.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy; if C, CLOCK;
+        //   LRU othrwise.
         //
         // Concerns:
         // 1. Calculates wall time, user time, and system time for inserting
@@ -4461,6 +4873,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         cacheperf::CachePerformance cp("testInsert1", evictionPolicy,
@@ -4478,7 +4892,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to insert.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy; if C, CLOCK;
+        //   LRU othrwise.
         //   5th parameter: number of batches to divide the number of rows
         //   into.
         //
@@ -4502,6 +4917,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int numBatches = argc > 5 ? atoi(argv[5]) : 1;
@@ -4523,7 +4940,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to read.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy; if C, CLOCK;
+        //   LRU othrwise.
         //   5th parameter: sparsity of values loaded.  Sparsity is the
         //   distance between consecutive values inserted, and represents how
         //   likely is a read to find the key given. A value of 1 means
@@ -4553,6 +4971,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int sparsity = argc > 5 ? atoi(argv[5]) : 1;
@@ -4583,7 +5003,8 @@ int main(int argc, char *argv[])
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to read.
         //   4th parameter: number of writer threads.
-        //   5th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   5th parameter: if F, use FIFO for eviction policy; if C, CLOCK;
+        //   LRU othrwise.
         //   6th parameter: sparsity of values loaded.  Sparsity is the
         //   distance between consecutive values inserted, and represents how
         //   likely is a read to find the key given. A value of 1 means
@@ -4616,6 +5037,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 5 && argv[5][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 5 && argv[5][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int sparsity = argc > 6 ? atoi(argv[6]) : 1;
@@ -4637,6 +5060,64 @@ int main(int argc, char *argv[])
         times = cp.runTests(args, cacheperf::CachePerformance::testReadWrite);
         cp.printResult();
       } break;
+      case -5: {
+        // --------------------------------------------------------------------
+        // HIT RATE AND THROUGHPUT OF EVICTION POLICIES
+        //   Compares the eviction policies on a workload where the keys
+        //   looked up follow a Zipf distribution, and keys not found are
+        //   inserted.  To provide control over the test, command line
+        //   parameters are used.
+        //   2nd parameter: number of threads.
+        //   3rd parameter: number of lookups per thread.
+        //   4th parameter: number of distinct keys.
+        //   5th parameter: high watermark (the low watermark is 90% of it).
+        //
+        // Concerns:
+        // 1. Report, for each policy, the fraction of lookups that hit, and
+        //    the number of lookups per second with concurrent threads.
+        //
+        // Plan:
+        // 1. For each of LRU, FIFO, and CLOCK, run `policyperf::run` on an
+        //    empty cache and print the hit rate and throughput.  (C-1)
+        //
+        // Testing:
+        //   HIT RATE AND THROUGHPUT OF EVICTION POLICIES
+        // --------------------------------------------------------------------
+
+        const int numThreads = argc > 2 ? atoi(argv[2]) : 4;
+        const int numOps     = argc > 3 ? atoi(argv[3]) : 1000000;
+        const int numKeys    = argc > 4 ? atoi(argv[4]) : 100000;
+        const int capacity   = argc > 5 ? atoi(argv[5]) : 10000;
+
+        const struct {
+            bdlcc::CacheEvictionPolicy::Enum  d_policy;
+            const char                       *d_name;
+        } POLICIES[] = {
+            { bdlcc::CacheEvictionPolicy::e_LRU,   "LRU  " },
+            { bdlcc::CacheEvictionPolicy::e_FIFO,  "FIFO " },
+            { bdlcc::CacheEvictionPolicy::e_CLOCK, "CLOCK" },
+        };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        cout << "threads: " << numThreads << ", lookups per thread: "
+             << numOps << ", keys: " << numKeys << ", capacity: "
+             << capacity << endl;
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            double       hitRate;
+            const double time = policyperf::run(&hitRate,
+                                                POLICIES[ti].d_policy,
+                                                numThreads,
+                                                numOps,
+                                                numKeys,
+                                                capacity);
+
+            cout << POLICIES[ti].d_name << ": hit rate "
+                 << hitRate * 100 << "%, "
+                 << double(numThreads) * numOps / time / 1e6
+                 << " Mlookups/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
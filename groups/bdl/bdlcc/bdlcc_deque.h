@@ -100,6 +100,13 @@ BSLS_IDENT("$Id: $")
 // Note that the availability of force pushes means that the high-water mark is
 // a suggestion and not an invariant.
 //
+// `pushBackMany` is a blocking push of a range that appends as many items as
+// there is space available for each time it acquires the mutex, and
+// `popFrontMany` and `tryPopFrontUpTo` remove several items from the front of
+// the container under one acquisition of the mutex.  Note that these batch
+// methods provide only the basic exception guarantee: the items transferred
+// before an exception is thrown are not restored.
+//
 // The purpose of a high-water mark is to enable the client to use the
 // container as a fixed-length container, where pushes that will grow it above
 // a certain size will block.  The purpose of the force pushes is to allow
@@ -715,6 +722,18 @@ class Deque {
     /// is available.
     void popFront(TYPE *item);
 
+    /// Remove at least one and at most the specified `maxNumItems` items
+    /// from the front of this container and assign them, in order, to
+    /// successive positions of the specified `output` iterator.  If this
+    /// container is empty, block until an item is available.  Return the
+    /// number of items removed.  The behavior is undefined unless
+    /// `0 < maxNumItems`.  Note that the items are removed under one
+    /// acquisition of the mutex.  Also note that if an assignment to
+    /// `output` throws, the items previously assigned have been removed and
+    /// the item being assigned remains in the container.
+    template <class OUTPUT_ITER>
+    size_type popFrontMany(size_type maxNumItems, OUTPUT_ITER output);
+
     /// Block until space in this container becomes available (see
     /// {`High-Water Mark` Feature}), then append the specified `item` to
     /// the back of this container.
@@ -726,6 +745,16 @@ class Deque {
     /// left in a valid but unspecified state.
     void pushBack(bslmf::MovableRef<TYPE> item);
 
+    /// Append the items in the specified range `[begin .. end)`, in order,
+    /// to the back of this container, blocking while the container is full
+    /// (see {`High-Water Mark` Feature}).  As many items as there is space
+    /// available for are appended under each acquisition of the mutex, so
+    /// items pushed by other threads may be interleaved with the range when
+    /// this method blocks.  Note that the items in the range are treated as
+    /// `const` objects, copied without being modified.
+    template <class INPUT_ITER>
+    void pushBackMany(INPUT_ITER begin, INPUT_ITER end);
+
     /// Block until space in this container becomes available (see
     /// {`High-Water Mark` Feature}), then append the specified `item` to
     /// the front of this container.
@@ -882,6 +911,15 @@ class Deque {
                      std::pmr::vector<TYPE> *buffer);
 #endif
 
+    /// Remove up to the specified `maxNumItems` items from the front of this
+    /// container, without blocking, and assign them, in order, to successive
+    /// positions of the specified `output` iterator.  Return the number of
+    /// items removed.  Note that if an assignment to `output` throws, the
+    /// items previously assigned have been removed and the item being
+    /// assigned remains in the container.
+    template <class OUTPUT_ITER>
+    size_type tryPopFrontUpTo(size_type maxNumItems, OUTPUT_ITER output);
+
     /// If the container is not full (see {`High-Water Mark` Feature}),
     /// append the specified `item` to the back of the container, otherwise
     /// leave the container unchanged.  Return 0 if the container was
@@ -1972,6 +2010,34 @@ void Deque<TYPE>::popFront(TYPE *item)
     }
 }
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+typename Deque<TYPE>::size_type
+Deque<TYPE>::popFrontMany(size_type maxNumItems, OUTPUT_ITER output)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+
+    // A `Proctor` records the length of the container when the mutex is
+    // locked to determine the conditions to signal on release, so the wait
+    // for an item is done separately.  If another thread removes the items
+    // between the wait and the removal, wait again.
+
+    while (true) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+            while (d_monoDeque.empty()) {
+                d_notEmptyCondition.wait(&d_mutex);
+            }
+        }
+
+        const size_type numItems = tryPopFrontUpTo(maxNumItems, output);
+        if (numItems) {
+            return numItems;                                          // RETURN
+        }
+    }
+}
+
 template <class TYPE>
 void Deque<TYPE>::pushBack(const TYPE& item)
 {
@@ -2002,6 +2068,40 @@ void Deque<TYPE>::pushBack(bslmf::MovableRef<TYPE> item)
     d_notEmptyCondition.signal();
 }
 
+template <class TYPE>
+template <class INPUT_ITER>
+void Deque<TYPE>::pushBackMany(INPUT_ITER begin, INPUT_ITER end)
+{
+    while (end != begin) {
+        size_type growth;
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+            while (d_monoDeque.size() >= d_highWaterMark) {
+                d_notFullCondition.wait(&d_mutex);
+            }
+
+            DequeThrowGuard tg(&d_monoDeque);
+
+            const size_type startLength = d_monoDeque.size();
+            size_type       length      = startLength;
+
+            for (; length < d_highWaterMark && end != begin;
+                                                         ++length, ++begin) {
+                d_monoDeque.push_back(*begin);
+            }
+
+            tg.release();
+
+            growth = length - startLength;
+        }
+
+        for (size_type ii = 0; ii < growth; ++ii) {
+            d_notEmptyCondition.signal();
+        }
+    }
+}
+
 template <class TYPE>
 void Deque<TYPE>::pushFront(const TYPE& item)
 {
@@ -2318,6 +2418,31 @@ void Deque<TYPE>::tryPopFront(typename Deque<TYPE>::size_type  maxNumItems,
 }
 #endif
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+typename Deque<TYPE>::size_type
+Deque<TYPE>::tryPopFrontUpTo(size_type maxNumItems, OUTPUT_ITER output)
+{
+    Proctor proctor(this);
+
+    // Each item is removed after it is assigned, so an exception leaves the
+    // unassigned items in the container.  Signalling will happen
+    // automatically when proctor is destroyed.
+
+    size_type numItems = 0;
+    for (; numItems < maxNumItems && !d_monoDeque.empty(); ++numItems) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        *output = bslmf::MovableRefUtil::move(d_monoDeque.front());
+#else
+        *output = d_monoDeque.front();
+#endif
+        ++output;
+        d_monoDeque.pop_front();
+    }
+
+    return numItems;
+}
+
 template <class TYPE>
 int Deque<TYPE>::tryPushBack(const TYPE& item)
 {
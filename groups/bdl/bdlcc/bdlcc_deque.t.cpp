@@ -2,6 +2,8 @@
 
 #include <bdlcc_deque.h>
 
+#include <bdlf_bind.h>
+
 #include <bsla_maybeunused.h>
 
 #include <bslalg_typetraitbitwisecopyable.h>
@@ -51,6 +53,7 @@
 #include <bsl_iostream.h>
 #include <bsl_iterator.h>
 #include <bsl_limits.h>
+#include <bsl_list.h>
 
 #include <bsl_c_ctype.h>
 
@@ -208,6 +211,9 @@ enum { PLAT_EXC = 0 };
 // [26] int timedPopFront(TYPE *, const TimeInterval&); - move semantics
 // [26] int timedPushBack(TYPE&&, const TimeInterval&);
 // [26] int timedPushFront(TYPE&&, const TimeInterval&);
+// [27] size_type popFrontMany(size_type, OUTPUT_ITER);
+// [27] void pushBackMany(INPUT_ITER, INPUT_ITER);
+// [27] size_type tryPopFrontUpTo(size_type, OUTPUT_ITER);
 //
 // ACCESSORS
 // [23] bslma::Allocator *allocator() const;
@@ -217,8 +223,9 @@ enum { PLAT_EXC = 0 };
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [24] PROCTOR LIFETIME
-// [27] USAGE EXAMPLE 1
-// [28] USAGE EXAMPLE 2
+// [28] USAGE EXAMPLE 1
+// [29] USAGE EXAMPLE 2
+// [-1] BATCH OPERATIONS BENCHMARK
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
 // ----------------------------------------------------------------------------
@@ -1716,6 +1723,118 @@ namespace USAGE_EXAMPLE_1 {
 
 }  // close namespace USAGE_EXAMPLE_1
 
+//=============================================================================
+//                                  TEST CASE 27
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_27 {
+
+enum { k_PRODUCER_SHIFT = 20 };
+
+/// Push the specified `numValues` values, tagged with the specified
+/// `producerId`, to the specified `deque` in batches of the specified
+/// `batchSize`, or one at a time if `batchSize` is 0.
+void producer(Obj *deque, int producerId, int numValues, int batchSize)
+{
+    const int            tag = producerId << k_PRODUCER_SHIFT;
+    bsl::vector<Element> values(&nda);
+
+    for (int ii = 0; ii < numValues; ++ii) {
+        values.push_back(tag + ii);
+    }
+
+    if (0 == batchSize) {
+        for (int ii = 0; ii < numValues; ++ii) {
+            deque->pushBack(values[ii]);
+        }
+        return;                                                       // RETURN
+    }
+
+    for (int ii = 0; ii < numValues; ii += batchSize) {
+        const int end = bsl::min(numValues, ii + batchSize);
+
+        deque->pushBackMany(values.begin() + ii, values.begin() + end);
+    }
+}
+
+/// Pop the specified `numValues` values from the specified `deque` in
+/// batches of up to the specified `batchSize`, or one at a time if
+/// `batchSize` is 0, and verify that the values pushed by each of the
+/// specified `numProducers` producers are popped in order.
+void consumer(Obj *deque, int numProducers, int numValues, int batchSize)
+{
+    bsl::vector<int>     next(numProducers,
+                              0,
+                              &nda);
+    bsl::vector<Element> values(bsl::max(batchSize, 1),
+                                0.0,
+                                &nda);
+
+    int numPopped = 0;
+    while (numPopped < numValues) {
+        size_t num = 1;
+        if (0 == batchSize) {
+            values[0] = deque->popFront();
+        }
+        else {
+            num = deque->popFrontMany(bsl::min(batchSize,
+                                               numValues - numPopped),
+                                      values.begin());
+            ASSERTV(num, batchSize, 0 < num);
+            ASSERTV(num, batchSize, static_cast<int>(num) <= batchSize);
+        }
+
+        for (size_t ii = 0; ii < num; ++ii) {
+            const int value    = static_cast<int>(values[ii]);
+            const int producer = value >> k_PRODUCER_SHIFT;
+            const int index    = value & ((1 << k_PRODUCER_SHIFT) - 1);
+
+            ASSERTV(producer, numProducers, producer < numProducers);
+            if (producer < numProducers) {
+                ASSERTV(producer, index, next[producer],
+                        index == next[producer]);
+                next[producer] = index + 1;
+            }
+        }
+        numPopped += static_cast<int>(num);
+    }
+}
+
+/// Transfer the specified `numValues` values from each of the specified
+/// `numProducers` producer threads through a deque having the specified
+/// `highWaterMark` to a single consumer thread, pushing and popping in
+/// batches of the specified `batchSize`, or one at a time if `batchSize` is
+/// 0.  Return the elapsed time in seconds.
+double transfer(int    numProducers,
+                int    numValues,
+                int    batchSize,
+                size_t highWaterMark)
+{
+    Obj mX(highWaterMark, &nda);
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    bslmt::ThreadGroup tg(&nda);
+    for (int ii = 0; ii < numProducers; ++ii) {
+        tg.addThread(bdlf::BindUtil::bind(&producer,
+                                          &mX,
+                                          ii,
+                                          numValues,
+                                          batchSize));
+    }
+    consumer(&mX, numProducers, numProducers * numValues, batchSize);
+    tg.joinAll();
+
+    timer.stop();
+
+    ASSERT(0 == mX.length());
+
+    return timer.accumulatedWallTime();
+}
+
+}  // close namespace TEST_CASE_27
+
 //=============================================================================
 //                                  TEST CASE 26
 //-----------------------------------------------------------------------------
@@ -3525,7 +3644,7 @@ bsls::AtomicInt64 popperTotalsByPusher[NUM_PUSHERS];    // default 0
 Int64             pusherTotals[        NUM_PUSHERS];
 
 bdlcc::Deque<Item>          deque(HIGH_WATER_MARK,
-                                  &bslma::NewDeleteAllocator::singleton());
+                                  &nda);
 
 bsls::AtomicInt             seedMain(123456789);
 bsls::AtomicInt             pusherIdxMain(0);
@@ -5408,7 +5527,7 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 28: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -5485,7 +5604,7 @@ int main(int argc, char *argv[])
 // ```
         }
       } break;
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -5543,6 +5662,190 @@ int main(int argc, char *argv[])
     ASSERT(0 == deque.length());
 // ```
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. `pushBackMany` appends the range, in order, to the back of the
+        //    deque, and blocks while the deque is at its high-water mark.
+        //
+        // 2. `tryPopFrontUpTo` removes up to the requested number of items
+        //    from the front of the deque, in order, and does not block.
+        //
+        // 3. `popFrontMany` blocks until an item is available and then
+        //    removes at least one and up to the requested number of items.
+        //
+        // 4. The batch methods are exception-neutral: the items not yet
+        //    transferred when an exception is thrown remain in their source.
+        //
+        // 5. Items pushed by each producer are popped in order when the batch
+        //    methods are used concurrently.
+        //
+        // Plan:
+        // 1. Push ranges with `pushBackMany` and verify the contents of the
+        //    deque with `tryPopFrontUpTo` and `popFrontMany`.  (C-1..3)
+        //
+        // 2. Push a range longer than the high-water mark with a consumer
+        //    thread draining the deque, and pop from an empty deque with a
+        //    producer thread pushing later.  (C-1, 3)
+        //
+        // 3. Using `bslma::TestAllocator`, inject exceptions into the batch
+        //    methods on a deque of allocating elements and verify that no
+        //    items are lost or leaked.  (C-4)
+        //
+        // 4. Run several producers and a consumer concurrently with a range of
+        //    batch sizes and high-water marks, verifying the per-producer
+        //    order of the popped items.  (C-5)
+        //
+        // Testing:
+        //   size_type popFrontMany(size_type, OUTPUT_ITER);
+        //   void pushBackMany(INPUT_ITER, INPUT_ITER);
+        //   size_type tryPopFrontUpTo(size_type, OUTPUT_ITER);
+        // --------------------------------------------------------------------
+
+        using namespace TEST_CASE_27;
+
+        if (verbose) cout << "BATCH OPERATIONS\n"
+                             "================\n";
+
+        if (verbose) cout << "Single-threaded operation\n";
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const Element VALUES[] = { 1, 2, 3, 4, 5, 6, 7 };
+            const int     NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            mX.pushBackMany(VALUES, VALUES);
+            ASSERT(0 == X.length());
+
+            mX.pushBack(0);
+            mX.pushBackMany(VALUES, VALUES + NUM_VALUES);
+            ASSERT(NUM_VALUES + 1 == static_cast<int>(X.length()));
+
+            Element buffer[NUM_VALUES + 1] = {};
+
+            ASSERT(0 == mX.tryPopFrontUpTo(0, buffer));
+            ASSERT(1 == mX.tryPopFrontUpTo(1, buffer));
+            ASSERT(0 == buffer[0]);
+
+            ASSERT(3 == mX.popFrontMany(3, buffer));
+            ASSERT(bsl::equal(buffer, buffer + 3, VALUES));
+
+            bsl::vector<Element> v(&ta);
+            ASSERT(4 == mX.tryPopFrontUpTo(10, bsl::back_inserter(v)));
+            ASSERT(bsl::equal(v.begin(), v.end(), VALUES + 3));
+            ASSERT(0 == X.length());
+
+            ASSERT(0 == mX.tryPopFrontUpTo(10, buffer));
+
+            // An input-iterator range is accepted by `pushBackMany`.
+
+            bsl::list<Element> l(VALUES, VALUES + NUM_VALUES, &ta);
+            mX.pushBackMany(l.begin(), l.end());
+            ASSERT(NUM_VALUES == mX.popFrontMany(NUM_VALUES + 1, buffer));
+            ASSERT(bsl::equal(buffer, buffer + NUM_VALUES, VALUES));
+        }
+
+        if (verbose) cout << "Blocking at the high-water mark\n";
+        {
+            enum { k_HIGH_WATER_MARK = 4, k_NUM_VALUES = 50 };
+
+            Obj mX(k_HIGH_WATER_MARK, &ta);  const Obj& X = mX;
+
+            bslmt::ThreadGroup tg(&nda);
+
+            ASSERT(0 == tg.addThread(bdlf::BindUtil::bind(&consumer,
+                                                          &mX,
+                                                          1,
+                                                          k_NUM_VALUES + 0,
+                                                          3)));
+
+            producer(&mX, 0, k_NUM_VALUES, k_NUM_VALUES);
+
+            tg.joinAll();
+            ASSERT(0 == X.length());
+
+            // Block in `popFrontMany` until a producer pushes.
+
+            ASSERT(0 == tg.addThread(bdlf::BindUtil::bind(
+                                                      &producer,
+                                                      &mX,
+                                                      0,
+                                                      k_HIGH_WATER_MARK + 0,
+                                                      2)));
+
+            consumer(&mX, 1, k_HIGH_WATER_MARK, 3);
+
+            tg.joinAll();
+            ASSERT(0 == X.length());
+        }
+
+        if (verbose) cout << "Exception neutrality\n";
+        {
+            enum { k_NUM_VALUES = 6 };
+
+            bsl::vector<AElement> values(&ta);
+            for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+                values.push_back(AElement(ii, &ta));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                AObj mX(&ta);  const AObj& X = mX;
+
+                mX.pushBackMany(values.begin(), values.end());
+                ASSERT(k_NUM_VALUES == static_cast<int>(X.length()));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            AObj mX(&ta);  const AObj& X = mX;
+
+            mX.pushBackMany(values.begin(), values.end());
+
+            bsl::vector<AElement> popped(&ta);
+            popped.reserve(k_NUM_VALUES);
+
+            // The count of an interrupted call is lost, so the loop is driven
+            // by the length of the deque.
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                while (0 < X.length()) {
+                    const size_t LENGTH = X.length();
+                    const size_t NUM    = mX.tryPopFrontUpTo(
+                                                   2,
+                                                   bsl::back_inserter(popped));
+
+                    ASSERTV(NUM, LENGTH, bsl::min<size_t>(2, LENGTH) == NUM);
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == X.length());
+            ASSERT(values == popped);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "Concurrent operation\n";
+        {
+            const int    NUM_PRODUCERS[]    = { 1, 2, 4 };
+            const int    BATCH_SIZES[]      = { 1, 3, 16, 100 };
+            const size_t HIGH_WATER_MARKS[] = { 5, 64, Obj::maxSizeT() };
+
+            for (int pi = 0; pi < 3; ++pi) {
+                for (int bi = 0; bi < 4; ++bi) {
+                    for (int hi = 0; hi < 3; ++hi) {
+                        if (veryVerbose) {
+                            P_(NUM_PRODUCERS[pi]);  P_(BATCH_SIZES[bi]);
+                            P(HIGH_WATER_MARKS[hi]);
+                        }
+
+                        transfer(NUM_PRODUCERS[pi],
+                                 2000,
+                                 BATCH_SIZES[bi],
+                                 HIGH_WATER_MARKS[hi]);
+                    }
+                }
+            }
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING TIMED POP & TIMED PUSH FUNCTIONS -- MOVE SEMANTICS
@@ -9159,6 +9462,56 @@ int main(int argc, char *argv[])
         ASSERT(0 == da.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS BENCHMARK
+        //
+        // Concerns:
+        // 1. Transferring items in batches amortizes the cost of locking and
+        //    signalling over the batch.
+        //
+        // Plan:
+        // 1. Transfer a fixed number of items from a number of producer
+        //    threads to a consumer thread, one at a time and in batches of
+        //    several sizes, and report the throughput as CSV.  An optional
+        //    second argument specifies the number of items per producer.
+        //
+        // Testing:
+        //   BATCH OPERATIONS BENCHMARK
+        // --------------------------------------------------------------------
+
+        using namespace TEST_CASE_27;
+
+        if (verbose) cout << "BATCH OPERATIONS BENCHMARK\n"
+                             "==========================\n";
+
+        const int NUM_VALUES = argc > 2 && 0 < bsl::atoi(argv[2])
+                             ? bsl::atoi(argv[2])
+                             : 100000;
+
+        const int NUM_PRODUCERS[] = { 1, 4 };
+        const int BATCH_SIZES[]   = { 0, 4, 16, 64 };
+
+        cout << "producers,consumers,method,batch,seconds,"
+                "elements_per_second\n";
+
+        for (int pi = 0; pi < 2; ++pi) {
+            const int numValues = NUM_VALUES / NUM_PRODUCERS[pi];
+
+            for (int bi = 0; bi < 4; ++bi) {
+                const double seconds = transfer(NUM_PRODUCERS[pi],
+                                                numValues,
+                                                BATCH_SIZES[bi],
+                                                1024);
+
+                cout << NUM_PRODUCERS[pi] << ",1,"
+                     << (BATCH_SIZES[bi] ? "batch," : "single,")
+                     << BATCH_SIZES[bi] << ','
+                     << seconds << ','
+                     << (numValues * NUM_PRODUCERS[pi]) / seconds << '\n';
+            }
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,40 @@
+// bdlcc_shardedflathashmap.cpp                                       -*-C++-*-
+#include <bdlcc_shardedflathashmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_shardedflathashmap_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// A lookup reads a shard's sequence number, then the shard's table, then the
+// sequence number again, and uses what it read from the table only if the two
+// sequence numbers are equal and even.  Writers make the sequence number odd
+// before modifying a table in place and even again afterwards, so a lookup
+// that overlaps an in-place modification retries.
+//
+// A table is never rehashed in place: before an insertion that would make
+// `bdlc::FlatHashMap` rehash, the shard copies its elements into a table of
+// twice the capacity and publishes that table with a release store.  The
+// replaced table is no longer modified, and is kept until the map is
+// destroyed because lookups that loaded its address may still be reading it.
+//
+// The bits of the hash value selecting the shard are above the 7 bits that
+// `bdlc::FlatHashTable` uses for hashlets, and below the high-order bits it
+// uses to select a group, so that the elements of a shard remain evenly
+// distributed in its table.
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
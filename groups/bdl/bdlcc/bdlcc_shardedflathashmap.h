@@ -0,0 +1,963 @@
+// bdlcc_shardedflathashmap.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDFLATHASHMAP
+#define INCLUDED_BDLCC_SHARDEDFLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sharded open-addressing map with lock-free lookups.
+//
+//@CLASSES:
+//  bdlcc::ShardedFlatHashMap: sharded flat hash map with optimistic reads
+//
+//@SEE_ALSO: bdlcc_stripedunorderedmap, bdlc_flathashmap
+//
+//@DESCRIPTION: This component provides a single concurrent (fully thread-safe)
+// associative container, `bdlcc::ShardedFlatHashMap`, that partitions its
+// elements among a (user defined) number of *shards*, each an open-addressing
+// `bdlc::FlatHashMap`.  Modifications of a shard are serialized by a mutex,
+// while lookups (`getValue`) take no lock and write no shared memory: each
+// shard publishes a *sequence* *number* that writers make odd for the
+// duration of a modification, and a lookup that observes the sequence number
+// change while it reads the shard discards what it read and retries (i.e., the
+// shard is a *seqlock*).
+//
+// Compared to `bdlcc::StripedUnorderedMap`, which stores each element in a
+// separately allocated node and acquires a reader-writer lock for every
+// lookup, this container stores elements contiguously, allocates memory only
+// when a shard grows, and lets any number of concurrent readers proceed
+// without contending on a lock's cache line.  It therefore performs best for
+// read-mostly workloads on small keys and values.
+//
+// The interface mirrors the `setValue`, `getValue`, and `visit` methods of
+// `bdlcc::StripedUnorderedMap`.  As with that class, no iterators are
+// provided, and `bdlcc::ShardedFlatHashMap` is an *irregular* value-semantic
+// type: it does not implement equality comparison, assignment operator, or
+// copy constructor.
+//
+///Requirements on `KEY` and `VALUE`
+///----------------------------------
+// A lookup copies the key and value of an element while the element may be
+// concurrently modified, and uses the copy only if no modification occurred.
+// `KEY` and `VALUE` must therefore be bitwise copyable (i.e.,
+// `bslmf::IsBitwiseCopyable` must hold for both), and the `HASH` and `EQUAL`
+// functors must not have side effects.  The requirement on `KEY` and `VALUE`
+// is checked at compile time.
+//
+///Growth
+///------
+// A shard grows by building a table of twice the capacity holding its current
+// elements, and then publishing the new table for subsequent lookups; lookups
+// that are already in progress continue to read the previous table, which is
+// not modified after it is replaced.  Previous tables are retained until the
+// map is destroyed, so the memory used by a shard is at most twice that of its
+// current table.  Erasing elements does not shrink a shard.
+//
+///Thread Safety
+///-------------
+// The `bdlcc::ShardedFlatHashMap` class template is fully thread-safe (see
+// {`bsldoc_glossary`|Fully Thread-Safe}), assuming that the allocator is fully
+// thread-safe.  Each method is executed by the calling thread.
+//
+// Lookups on a shard being modified spin (yielding the processor) until the
+// modification completes; `visit` modifies each shard for the duration of the
+// visitations of the elements in that shard, so visitors should be short.
+//
+///Number of Shards
+///----------------
+// The number of shards is rounded up to a power of two.  Since each shard has
+// its own mutex, more shards allow more concurrent writers; lookups do not
+// contend with each other regardless of the number of shards.  A number of
+// shards of about four times the number of concurrently writing threads is
+// usually sufficient.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Price Cache
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the latest price of a set of instruments, identified by
+// an integer id, that is read by many threads and updated occasionally.
+//
+// First, we define the map:
+// ```
+// bdlcc::ShardedFlatHashMap<int, double> prices;
+// ```
+// Then, a writer thread records prices:
+// ```
+// assert(0 == prices.setValue(17, 101.25));
+// assert(0 == prices.setValue(42,  99.50));
+// assert(1 == prices.setValue(17, 101.50));
+// assert(2 == prices.size());
+// ```
+// Notice that `setValue` returns 1 if the key was already present.
+//
+// Next, reader threads look prices up without taking a lock:
+// ```
+// double price;
+//
+// assert(1      == prices.getValue(&price, 17));
+// assert(101.50 == price);
+// assert(0      == prices.getValue(&price, 99));
+// ```
+// Then, we apply a price adjustment to a single instrument with `visit`:
+// ```
+// struct Adjust {
+//     static bool halve(double *value, const int&)
+//     {
+//         *value /= 2;
+//         return true;
+//     }
+// };
+//
+// assert(1     == prices.visit(42, &Adjust::halve));
+// assert(1     == prices.getValue(&price, 42));
+// assert(49.75 == price);
+// ```
+// Finally, we remove an instrument:
+// ```
+// assert(1 == prices.erase(17));
+// assert(0 == prices.getValue(&price, 17));
+// assert(1 == prices.size());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bdlc_flathashmap.h>
+
+#include <bslh_fibonaccibadhashwrapper.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisecopyable.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_libraryfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_atomic.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                         // ========================
+                         // class ShardedFlatHashMap
+                         // ========================
+
+/// This class template defines a fully thread-safe container that provides a
+/// mapping from keys (of template parameter type `KEY`) to their associated
+/// mapped values (of template parameter type `VALUE`), both of which must be
+/// bitwise copyable.
+///
+/// The elements are partitioned among `numShards` open-addressing hash
+/// tables, a value specified on construction.  Modifications of a shard are
+/// serialized by a per-shard mutex; lookups are lock-free and are validated
+/// against a per-shard sequence number.
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedFlatHashMap {
+
+    BSLMF_ASSERT(bslmf::IsBitwiseCopyable<KEY>::value);
+    BSLMF_ASSERT(bslmf::IsBitwiseCopyable<VALUE>::value);
+
+  private:
+    // PRIVATE TYPES
+    typedef bdlc::FlatHashMap<KEY, VALUE, HASH, EQUAL> Table;
+
+    enum {
+        // Number of low-order hash bits used by `bdlc::FlatHashMap` for its
+        // hashlets, which are skipped when selecting a shard.
+
+        k_SHARD_SHIFT = 7
+    };
+
+    /// This `struct` holds the state of one shard.  Shards are padded so that
+    /// the state of adjacent shards does not share a cache line.
+    struct Shard {
+        // DATA
+        bsls::AtomicUint            d_sequence;  // odd while `*d_table_p` is
+                                                 // being modified
+
+        bsls::AtomicPointer<Table>  d_table_p;   // current table, or 0 if no
+                                                 // element was ever inserted
+
+        mutable bslmt::Mutex        d_mutex;     // serializes modifications
+
+        bsl::vector<Table *>        d_retired;   // previous tables, which
+                                                 // lookups may still read
+
+        char                        d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                           // padding to prevent false sharing
+
+        // CREATORS
+
+        /// Create an empty shard.  Use the specified `basicAllocator` to
+        /// supply memory.
+        explicit Shard(bslma::Allocator *basicAllocator);
+    };
+
+    /// This guard makes the sequence number of a shard odd on construction,
+    /// and even again on destruction, to mark a modification of the shard's
+    /// table in place.
+    class WriteGuard {
+
+        // DATA
+        Shard *d_shard_p;  // guarded shard
+
+      private:
+        // NOT IMPLEMENTED
+        WriteGuard(const WriteGuard&);
+        WriteGuard& operator=(const WriteGuard&);
+
+      public:
+        // CREATORS
+
+        /// Mark the specified `shard` as being modified.  The behavior is
+        /// undefined unless the calling thread holds `shard->d_mutex`.
+        explicit WriteGuard(Shard *shard);
+
+        /// Mark the guarded shard as no longer being modified.
+        ~WriteGuard();
+    };
+
+    // DATA
+    Shard            *d_shards_p;              // array of `d_numShards` shards
+
+    bsl::size_t       d_numShards;             // number of shards (a power of
+                                               // two)
+
+    bsl::size_t       d_initialShardCapacity;  // capacity of the first table
+                                               // of each shard
+
+    HASH              d_hasher;                // hash functor
+
+    EQUAL             d_equal;                 // key-equality functor
+
+    bslma::Allocator *d_allocator_p;           // memory allocator (held, not
+                                               // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedFlatHashMap(const ShardedFlatHashMap&);                  // = delete
+    ShardedFlatHashMap& operator=(const ShardedFlatHashMap&);       // = delete
+
+    // PRIVATE CLASS METHODS
+
+    /// Return `true` if inserting an element into the specified `table`
+    /// requires `table` to grow, and `false` otherwise.
+    static bool isFull(const Table& table);
+
+    // PRIVATE MANIPULATORS
+
+    /// Replace the table of the specified `shard` by one of twice the
+    /// capacity (or by an initial table, if `shard` has none) holding the
+    /// same elements, and return the new table.  The behavior is undefined
+    /// unless the calling thread holds `shard->d_mutex`.
+    Table *grow(Shard *shard);
+
+    /// Return a reference providing modifiable access to the shard holding
+    /// elements having the specified `key`.
+    Shard& shardFor(const KEY& key);
+
+    // PRIVATE ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the shard
+    /// holding elements having the specified `key`.
+    const Shard& shardFor(const KEY& key) const;
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16  // default number of shards
+    };
+
+    // PUBLIC TYPES
+
+    /// Value type of an element.
+    typedef bsl::pair<KEY, VALUE> KVType;
+
+    /// An alias to a function meeting the following contract:
+    /// ```
+    /// /// Visit the specified `value` attribute associated with the
+    /// /// specified `key`.  Return `true` if this function may be
+    /// /// called on additional elements, and `false` otherwise (i.e.,
+    /// /// if no other elements should be visited).  Note that this
+    /// /// functor can change the value associated with `key`.
+    /// bool visitorFunction(VALUE *value, const KEY& key);
+    /// ```
+    typedef bsl::function<bool (VALUE *, const KEY&)> VisitorFunction;
+
+    /// An alias to a function meeting the following contract:
+    /// ```
+    /// /// Visit the specified `value` attribute associated with the
+    /// /// specified `key`.  Return `true` if this function may be
+    /// /// called on additional elements, and `false` otherwise (i.e.,
+    /// /// if no other elements should be visited).  Note that this
+    /// /// functor can *not* change the value associated with `key`
+    /// /// and `value`.
+    /// bool visitorFunction(const VALUE& value, const KEY& key);
+    /// ```
+    typedef bsl::function<bool (const VALUE&, const KEY&)>
+                                                       ReadOnlyVisitorFunction;
+
+    // CREATORS
+
+    /// Create an empty `ShardedFlatHashMap` object.  Optionally specify an
+    /// `initialCapacity` for the number of elements that can be inserted
+    /// before any shard grows (assuming elements are evenly distributed
+    /// among shards), and a `numShards`, which is rounded up to a power of
+    /// two.  Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  No memory is allocated for a shard until an element is first
+    /// inserted into it.  The behavior is undefined unless `0 < numShards`.
+    explicit ShardedFlatHashMap(
+                      bsl::size_t       initialCapacity = 0,
+                      bsl::size_t       numShards       = k_DEFAULT_NUM_SHARDS,
+                      bslma::Allocator *basicAllocator  = 0);
+    explicit ShardedFlatHashMap(bslma::Allocator *basicAllocator);
+
+    /// Destroy this hash map.
+    ~ShardedFlatHashMap();
+
+    // MANIPULATORS
+
+    /// Remove all elements from this hash map.  Note that the capacity of
+    /// the shards is not reduced.
+    void clear();
+
+    /// Erase from this hash map the element having the specified `key`.
+    /// Return 1 on success and 0 if `key` does not exist.  Note that the
+    /// returned value equals the number of elements removed.
+    bsl::size_t erase(const KEY& key);
+
+    /// Insert into this hash map an element having the specified `key` and
+    /// `value`.  If `key` already exists in this hash map, the value
+    /// attribute of that element is set to `value`.  Return 1 if an element
+    /// is inserted, and 0 if an existing element is updated.  Note that the
+    /// return value equals the number of elements inserted.
+    bsl::size_t insert(const KEY& key, const VALUE& value);
+
+    /// Set the value attribute of the element in this hash map having the
+    /// specified `key` to the specified `value`.  If no such element exists,
+    /// insert `(key, value)`.  Return 1 if `key` was found, and 0 otherwise.
+    /// Note that the return value equals the number of elements found having
+    /// `key`.
+    bsl::size_t setValue(const KEY& key, const VALUE& value);
+
+    /// Call the specified `visitor` (in an unspecified order) on all
+    /// elements in this hash map until each such element has been visited
+    /// or `visitor` returns `false`.  That is, for `(key, value)`, invoke:
+    /// ```
+    /// bool visitor(&value, key);
+    /// ```
+    /// Return the number of elements visited or the negation of that value
+    /// if visitations stopped because `visitor` returned `false`.  `visitor`
+    /// has exclusive access (i.e., write access) to each element for the
+    /// duration of each invocation, and lookups of elements in the same
+    /// shard wait until the visitations of that shard complete.  Elements
+    /// inserted during the execution of `visit` may or may not be visited.
+    /// The behavior is undefined if methods of this hash map are invoked
+    /// from within `visitor`, as it may lead to a deadlock.
+    int visit(const VisitorFunction& visitor);
+
+    /// Call the specified `visitor` with the element (if one exists) in this
+    /// hash map having the specified `key`.  That is:
+    /// ```
+    /// bool visitor(&value, key);
+    /// ```
+    /// Return the number of elements updated or -1 if `visitor` returned
+    /// `false`.  `visitor` has exclusive access (i.e., write access) to the
+    /// element during its invocation.  The behavior is undefined if methods
+    /// of this hash map are invoked from within `visitor`, as it may lead to
+    /// a deadlock.
+    int visit(const KEY& key, const VisitorFunction& visitor);
+
+    // ACCESSORS
+
+    /// Return `true` if this hash map contains no elements, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return (a copy of) the key-equality functor used by this hash map.
+    EQUAL equalFunction() const;
+
+    /// Load, into the specified `*value`, the value attribute of the
+    /// element in this hash map having the specified `key`.  Return 1 on
+    /// success and 0 if `key` does not exist in this hash map.  Note that
+    /// this method neither acquires a lock nor writes to memory shared with
+    /// other threads, and that the return value equals the number of values
+    /// returned.
+    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+
+    /// Return (a copy of) the hash functor used by this hash map.
+    HASH hashFunction() const;
+
+    /// Return the number of shards in this hash map.
+    bsl::size_t numShards() const;
+
+    /// Return the current number of elements in this hash map.
+    bsl::size_t size() const;
+
+    /// Call the specified `visitor` (in an unspecified order) on all
+    /// elements in this hash map until each such element has been visited
+    /// or `visitor` returns `false`.  That is, for `(key, value)`, invoke:
+    /// ```
+    /// bool visitor(value, key);
+    /// ```
+    /// Return the number of elements visited or the negation of that value
+    /// if visitations stopped because `visitor` returned `false`.  `visitor`
+    /// has read-only access to each element for the duration of each
+    /// invocation.  The behavior is undefined if hash map manipulators are
+    /// invoked from within `visitor`, as it may lead to a deadlock.
+    int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+
+    /// Call the specified `visitor` on the element (if one exists) in this
+    /// hash map having the specified `key`.  That is, for `(key, value)`,
+    /// invoke:
+    /// ```
+    /// bool visitor(value, key);
+    /// ```
+    /// Return the number of elements visited or `-1` if `visitor` returned
+    /// `false`.  `visitor` has read-only access to the element for the
+    /// duration of its invocation.  The behavior is undefined if hash map
+    /// manipulators are invoked from within `visitor`, as it may lead to a
+    /// deadlock.
+    int visitReadOnly(const KEY&                     key,
+                      const ReadOnlyVisitorFunction& visitor) const;
+
+                               // Aspects
+
+    /// Return the allocator used by this hash map to supply memory.  Note
+    /// that if no allocator was supplied at construction the default
+    /// allocator installed at that time is used.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------------
+                         // class ShardedFlatHashMap::Shard
+                         // -------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::Shard::Shard(
+                                              bslma::Allocator *basicAllocator)
+: d_sequence(0)
+, d_table_p(0)
+, d_mutex()
+, d_retired(basicAllocator)
+, d_pad()
+{
+}
+
+                      // ------------------------------------
+                      // class ShardedFlatHashMap::WriteGuard
+                      // ------------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::WriteGuard::WriteGuard(
+                                                                  Shard *shard)
+: d_shard_p(shard)
+{
+    // The stores made while the sequence number is odd must not become
+    // visible before the sequence number itself.  Only the thread holding the
+    // shard's mutex modifies the sequence number.
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+    d_shard_p->d_sequence.storeRelaxed(
+                                    d_shard_p->d_sequence.loadRelaxed() + 1);
+    bsl::atomic_thread_fence(bsl::memory_order_release);
+#else
+    d_shard_p->d_sequence.addAcqRel(1);
+#endif
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::WriteGuard::~WriteGuard()
+{
+    d_shard_p->d_sequence.storeRelease(
+                                    d_shard_p->d_sequence.loadRelaxed() + 1);
+}
+
+                         // ------------------------
+                         // class ShardedFlatHashMap
+                         // ------------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::isFull(const Table& table)
+{
+    // This is the condition under which `bdlc::FlatHashMap` rehashes on
+    // insertion, which must never happen to a table that lookups may be
+    // reading.
+
+    return table.size() >= static_cast<bsl::size_t>(
+                                 table.max_load_factor()
+                                 * static_cast<float>(table.capacity()));
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::Table *
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::grow(Shard *shard)
+{
+    Table *table = shard->d_table_p.loadRelaxed();
+
+    const bsl::size_t capacity = table ? 2 * table->capacity()
+                                       : d_initialShardCapacity;
+
+    Table *newTable = new (*d_allocator_p) Table(capacity,
+                                                 d_hasher,
+                                                 d_equal,
+                                                 d_allocator_p);
+
+    bslma::RawDeleterProctor<Table, bslma::Allocator> proctor(newTable,
+                                                              d_allocator_p);
+
+    if (table) {
+        newTable->insert(table->begin(), table->end());
+        shard->d_retired.push_back(table);
+    }
+
+    proctor.release();
+
+    shard->d_table_p.storeRelease(newTable);
+
+    return newTable;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::Shard&
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::shardFor(const KEY& key)
+{
+    return d_shards_p[(d_hasher(key) >> k_SHARD_SHIFT) & (d_numShards - 1)];
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const typename ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::Shard&
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::shardFor(const KEY& key) const
+{
+    return d_shards_p[(d_hasher(key) >> k_SHARD_SHIFT) & (d_numShards - 1)];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::ShardedFlatHashMap(
+                                             bsl::size_t       initialCapacity,
+                                             bsl::size_t       numShards,
+                                             bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(static_cast<bsl::size_t>(bdlb::BitUtil::roundUpToBinaryPower(
+                               static_cast<bsls::Types::Uint64>(numShards))))
+, d_initialShardCapacity(0)
+, d_hasher()
+, d_equal()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numShards);
+
+    // Size the first table of each shard so that its share of
+    // `initialCapacity` elements can be inserted without growing.
+
+    const bsl::size_t perShard = (initialCapacity + d_numShards - 1)
+                                                                 / d_numShards;
+    d_initialShardCapacity = perShard + perShard / 7 + 1;
+
+    d_shards_p = static_cast<Shard *>(
+                         d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        new (d_shards_p + i) Shard(d_allocator_p);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::ShardedFlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(k_DEFAULT_NUM_SHARDS)
+, d_initialShardCapacity(1)
+, d_hasher()
+, d_equal()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_shards_p = static_cast<Shard *>(
+                         d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        new (d_shards_p + i) Shard(d_allocator_p);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::~ShardedFlatHashMap()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        Shard& shard = d_shards_p[i];
+
+        if (Table *table = shard.d_table_p.loadRelaxed()) {
+            d_allocator_p->deleteObject(table);
+        }
+        for (bsl::size_t j = 0; j < shard.d_retired.size(); ++j) {
+            d_allocator_p->deleteObject(shard.d_retired[j]);
+        }
+        shard.~Shard();
+    }
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        Shard& shard = d_shards_p[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+        Table *table = shard.d_table_p.loadRelaxed();
+        if (table && !table->empty()) {
+            WriteGuard writeGuard(&shard);
+            table->clear();
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    Shard& shard = shardFor(key);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+    Table *table = shard.d_table_p.loadRelaxed();
+    if (!table) {
+        return 0;                                                     // RETURN
+    }
+
+    typename Table::iterator it = table->find(key);
+    if (table->end() == it) {
+        return 0;                                                     // RETURN
+    }
+
+    WriteGuard writeGuard(&shard);
+    table->erase(it);
+
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                                            const KEY&   key,
+                                                            const VALUE& value)
+{
+    return 1 - setValue(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::setValue(
+                                                            const KEY&   key,
+                                                            const VALUE& value)
+{
+    Shard& shard = shardFor(key);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+    Table *table = shard.d_table_p.loadRelaxed();
+    if (table) {
+        typename Table::iterator it = table->find(key);
+        if (table->end() != it) {
+            WriteGuard writeGuard(&shard);
+            it->second = value;
+            return 1;                                                 // RETURN
+        }
+    }
+
+    if (!table || isFull(*table)) {
+        table = grow(&shard);
+    }
+
+    BSLS_ASSERT(!isFull(*table));
+
+    WriteGuard writeGuard(&shard);
+    table->insert(KVType(key, value));
+
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::visit(
+                                                const VisitorFunction& visitor)
+{
+    int count = 0;
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        Shard& shard = d_shards_p[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+        Table *table = shard.d_table_p.loadRelaxed();
+        if (!table || table->empty()) {
+            continue;                                               // CONTINUE
+        }
+
+        WriteGuard writeGuard(&shard);
+
+        for (typename Table::iterator it = table->begin();
+             it != table->end();
+             ++it) {
+            ++count;
+            if (!visitor(&it->second, it->first)) {
+                return -count;                                        // RETURN
+            }
+        }
+    }
+
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::visit(
+                                                const KEY&             key,
+                                                const VisitorFunction& visitor)
+{
+    Shard& shard = shardFor(key);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+    Table *table = shard.d_table_p.loadRelaxed();
+    if (!table) {
+        return 0;                                                     // RETURN
+    }
+
+    typename Table::iterator it = table->find(key);
+    if (table->end() == it) {
+        return 0;                                                     // RETURN
+    }
+
+    WriteGuard writeGuard(&shard);
+
+    return visitor(&it->second, it->first) ? 1 : -1;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return 0 == size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_equal;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::getValue(
+                                                        VALUE      *value,
+                                                        const KEY&  key) const
+{
+    BSLS_ASSERT(value);
+
+    const Shard& shard = shardFor(key);
+
+    bsls::ObjectBuffer<VALUE> buffer;
+
+    for (;;) {
+        const unsigned int sequence = shard.d_sequence.loadAcquire();
+
+        if (sequence & 1) {
+            bslmt::ThreadUtil::yield();
+            continue;                                               // CONTINUE
+        }
+
+        const Table *table = shard.d_table_p.loadAcquire();
+        if (!table) {
+            return 0;                                                 // RETURN
+        }
+
+        typename Table::const_iterator it = table->find(key);
+
+        const bool found = table->end() != it;
+        if (found) {
+            bsl::memcpy(buffer.buffer(), &it->second, sizeof(VALUE));
+        }
+
+        // The reads of the table must complete before the sequence number is
+        // read again.
+
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY)
+        bsl::atomic_thread_fence(bsl::memory_order_acquire);
+        if (sequence == shard.d_sequence.loadRelaxed()) {
+#else
+        // Without standard fences, use a full barrier: a read-modify-write
+        // of the shard's sequence number would write its cache line.
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        __sync_synchronize();
+#else
+        // An atomic read-modify-write of a local object is a full barrier
+        // on every supported platform, and writes no shared memory.
+
+        bsls::AtomicInt barrier;
+        barrier.addAcqRel(0);
+#endif
+        if (sequence == shard.d_sequence.loadAcquire()) {
+#endif
+            if (!found) {
+                return 0;                                             // RETURN
+            }
+            *value = buffer.object();
+            return 1;                                                 // RETURN
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t count = 0;
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        const Shard& shard = d_shards_p[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+        if (const Table *table = shard.d_table_p.loadRelaxed()) {
+            count += table->size();
+        }
+    }
+
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
+                                  const ReadOnlyVisitorFunction& visitor) const
+{
+    int count = 0;
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        const Shard& shard = d_shards_p[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+        const Table *table = shard.d_table_p.loadRelaxed();
+        if (!table) {
+            continue;                                               // CONTINUE
+        }
+
+        for (typename Table::const_iterator it = table->begin();
+             it != table->end();
+             ++it) {
+            ++count;
+            if (!visitor(it->second, it->first)) {
+                return -count;                                        // RETURN
+            }
+        }
+    }
+
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
+                                  const KEY&                     key,
+                                  const ReadOnlyVisitorFunction& visitor) const
+{
+    const Shard& shard = shardFor(key);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+    const Table *table = shard.d_table_p.loadRelaxed();
+    if (!table) {
+        return 0;                                                     // RETURN
+    }
+
+    typename Table::const_iterator it = table->find(key);
+    if (table->end() == it) {
+        return 0;                                                     // RETURN
+    }
+
+    return visitor(it->second, it->first) ? 1 : -1;
+}
+
+                               // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+ShardedFlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
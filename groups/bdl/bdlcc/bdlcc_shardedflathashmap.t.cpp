@@ -0,0 +1,1123 @@
+// bdlcc_shardedflathashmap.t.cpp                                     -*-C++-*-
+
+#include <bdlcc_shardedflathashmap.h>
+
+#include <bdlcc_stripedunorderedmap.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdlb_random.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_isbitwisecopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a fully thread-safe container template,
+// `bdlcc::ShardedFlatHashMap`, whose lookups are validated against per-shard
+// sequence numbers rather than protected by a lock.  Like
+// `bdlcc::StripedUnorderedMap`, it is an *irregular* value-semantic type, and
+// the canonical value-semantic test cases do not apply.
+//
+// Single-threaded behavior is tested in test cases [1 .. 5], where we verify
+// each method against an oracle and check that memory is obtained only from
+// the supplied allocator and is returned on destruction.  The concurrent
+// correctness of the lock-free lookups (in particular, that a lookup never
+// returns a value that was never stored, even while the shard is being
+// modified or grown) is tested in test case 6.
+//
+// Negatively numbered (manually run) performance tests compare this container
+// with `bdlcc::StripedUnorderedMap` for read-heavy and mixed workloads.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ShardedFlatHashMap(initialCapacity, numShards, *basicAllocator);
+// [ 2] ShardedFlatHashMap(bslma::Allocator *basicAllocator);
+// [ 2] ~ShardedFlatHashMap();
+//
+// MANIPULATORS
+// [ 4] void clear();
+// [ 4] bsl::size_t erase(const KEY& key);
+// [ 3] bsl::size_t insert(const KEY& key, const VALUE& value);
+// [ 3] bsl::size_t setValue(const KEY& key, const VALUE& value);
+// [ 5] int visit(const VisitorFunction& visitor);
+// [ 5] int visit(const KEY& key, const VisitorFunction& visitor);
+//
+// ACCESSORS
+// [ 4] bool empty() const;
+// [ 2] EQUAL equalFunction() const;
+// [ 3] bsl::size_t getValue(VALUE *value, const KEY& key) const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t numShards() const;
+// [ 3] bsl::size_t size() const;
+// [ 5] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+// [ 5] int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCURRENT LOOKUPS DURING MODIFICATION
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: READ-HEAVY AND MIXED WORKLOADS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::ShardedFlatHashMap<int, int> Obj;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Add the specified `value` to `*sum`, and return `true`.
+bool sumValues(int *sum, const int& value, const int&)
+{
+    *sum += value;
+    return true;
+}
+
+/// Return `true` if the specified `*count` is less than the specified
+/// `limit` after incrementing it, and `false` otherwise.
+bool countUntil(int *count, int limit, const int&, const int&)
+{
+    return ++*count < limit;
+}
+
+/// Double the specified `*value`, and return `true`.
+bool doubleValue(int *value, const int&)
+{
+    *value *= 2;
+    return true;
+}
+
+/// Return `false`.
+bool stopVisiting(int *, const int&)
+{
+    return false;
+}
+
+/// Return `false`.
+bool stopVisitingReadOnly(const int&, const int&)
+{
+    return false;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       CONCURRENCY TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace concurrency {
+
+/// This `struct` is stored as the value of the map in the concurrency test.
+/// Writers always store equal `d_first` and `d_second` members, so a lookup
+/// returning unequal members has observed a partially written element.
+struct Pair {
+    bsls::Types::Int64 d_first;
+    bsls::Types::Int64 d_second;
+
+    BSLMF_NESTED_TRAIT_DECLARATION(Pair, bslmf::IsBitwiseCopyable);
+};
+
+typedef bdlcc::ShardedFlatHashMap<int, Pair> PairMap;
+
+/// Repeatedly set the values of the keys congruent to the specified
+/// `writerId` modulo the specified `numWriters` in the specified `map`,
+/// inserting keys up to the specified `numKeys` and erasing and reinserting
+/// some of them, until the specified `done` is set.
+void writer(PairMap         *map,
+            bsls::AtomicBool *done,
+            int              writerId,
+            int              numWriters,
+            int              numKeys)
+{
+    bsls::Types::Int64 generation = 0;
+
+    while (!*done) {
+        ++generation;
+        for (int key = writerId; key < numKeys; key += numWriters) {
+            const Pair value = { key + generation, key + generation };
+            map->setValue(key, value);
+            if (0 == (key + generation) % 7) {
+                map->erase(key);
+            }
+        }
+    }
+}
+
+/// Repeatedly look up keys less than the specified `numKeys` in the
+/// specified `map` until the specified `done` is set, and load into the
+/// specified `numErrors` the number of lookups that returned a value that
+/// was never stored.
+void reader(PairMap          *map,
+            bsls::AtomicBool *done,
+            int              numKeys,
+            int              *numErrors)
+{
+    int seed = numKeys;
+
+    while (!*done) {
+        const int key = bdlb::Random::generate15(&seed) % numKeys;
+
+        Pair value;
+        if (map->getValue(&value, key)) {
+            if (value.d_first  != value.d_second ||
+                value.d_first  <= key) {
+                ++*numErrors;
+            }
+        }
+    }
+}
+
+}  // close namespace concurrency
+
+// ============================================================================
+//                       PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace performance {
+
+/// Perform the specified `numOps` operations on the specified `map`, which
+/// holds the keys `[0 .. numKeys)`, after waiting on the specified
+/// `barrier`.  The specified `readPercent` of the operations are lookups of
+/// keys in `[0 .. 2 * numKeys)` (so half of them miss), and the others set
+/// the value of a key in `[0 .. numKeys)`.  Use the specified `seed` to
+/// generate keys.
+template <class MAP>
+void worker(MAP            *map,
+            bslmt::Barrier *barrier,
+            int             numOps,
+            int             numKeys,
+            int             readPercent,
+            int             seed)
+{
+    barrier->wait();
+
+    int found = 0;
+    for (int i = 0; i < numOps; ++i) {
+        const int r = bdlb::Random::generate15(&seed) << 15
+                    | bdlb::Random::generate15(&seed);
+
+        if (r % 100 < readPercent) {
+            int value;
+            found += static_cast<int>(map->getValue(&value,
+                                                    r % (2 * numKeys)));
+        }
+        else {
+            map->setValue(r % numKeys, i);
+        }
+    }
+
+    if (veryVeryVerbose) {
+        P(found);
+    }
+}
+
+/// Return the wall time, in seconds, for the specified `numThreads`
+/// threads to each perform the specified `numOps` operations on the
+/// specified `map`, which is first loaded with the keys `[0 .. numKeys)`,
+/// with the specified `readPercent` of the operations being lookups.
+template <class MAP>
+double run(MAP *map,
+           int  numThreads,
+           int  numOps,
+           int  numKeys,
+           int  readPercent)
+{
+    for (int i = 0; i < numKeys; ++i) {
+        map->insert(i, i);
+    }
+
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(bdlf::BindUtil::bind(&worker<MAP>,
+                                               map,
+                                               &barrier,
+                                               numOps,
+                                               numKeys,
+                                               readPercent,
+                                               i + 1));
+    }
+
+    bsls::Stopwatch timer;
+    barrier.wait();
+    timer.start(true);
+    threads.joinAll();
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close namespace performance
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Price Cache
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the latest price of a set of instruments, identified by
+// an integer id, that is read by many threads and updated occasionally.
+//
+// First, we define the map:
+// ```
+    bdlcc::ShardedFlatHashMap<int, double> prices;
+// ```
+// Then, a writer thread records prices:
+// ```
+    ASSERT(0 == prices.setValue(17, 101.25));
+    ASSERT(0 == prices.setValue(42,  99.50));
+    ASSERT(1 == prices.setValue(17, 101.50));
+    ASSERT(2 == prices.size());
+// ```
+// Notice that `setValue` returns 1 if the key was already present.
+//
+// Next, reader threads look prices up without taking a lock:
+// ```
+    double price;
+
+    ASSERT(1      == prices.getValue(&price, 17));
+    ASSERT(101.50 == price);
+    ASSERT(0      == prices.getValue(&price, 99));
+// ```
+// Then, we apply a price adjustment to a single instrument with `visit`:
+// ```
+    struct Adjust {
+        static bool halve(double *value, const int&)
+        {
+            *value /= 2;
+            return true;
+        }
+    };
+
+    ASSERT(1     == prices.visit(42, &Adjust::halve));
+    ASSERT(1     == prices.getValue(&price, 42));
+    ASSERT(49.75 == price);
+// ```
+// Finally, we remove an instrument:
+// ```
+    ASSERT(1 == prices.erase(17));
+    ASSERT(0 == prices.getValue(&price, 17));
+    ASSERT(1 == prices.size());
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOOKUPS DURING MODIFICATION
+        //
+        // Concerns:
+        // 1. A lookup concurrent with `setValue` or `erase` on the same shard
+        //    returns either a value that was stored for the key or "not
+        //    found", and never a partially written value.
+        //
+        // 2. Lookups concurrent with the growth of a shard are not affected
+        //    by the growth.
+        //
+        // 3. After the writers finish, the map holds the last value written
+        //    for each key.
+        //
+        // Plan:
+        // 1. Create a map with a single shard and few elements, so that it
+        //    grows while the test runs.  Start writer threads that
+        //    repeatedly set values of 16-byte elements whose two halves are
+        //    equal, and erase some of them, and reader threads that look up
+        //    keys and count values whose halves differ, or that were never
+        //    stored.  (C-1..2)
+        //
+        // 2. After joining the threads, rewrite every key from a single
+        //    thread and verify its value with `getValue`.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT LOOKUPS DURING MODIFICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOOKUPS DURING MODIFICATION" << endl
+                          << "======================================" << endl;
+
+        using namespace concurrency;
+
+        const int k_NUM_KEYS    = 4096;
+        const int k_NUM_WRITERS = 2;
+        const int k_NUM_READERS = 4;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            PairMap          mX(0, 1, &oa);
+            bsls::AtomicBool done(false);
+            int              numErrors[k_NUM_READERS] = { 0 };
+
+            bslmt::ThreadGroup threads;
+
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&writer,
+                                                       &mX,
+                                                       &done,
+                                                       i,
+                                                       k_NUM_WRITERS,
+                                                       k_NUM_KEYS));
+            }
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&reader,
+                                                       &mX,
+                                                       &done,
+                                                       k_NUM_KEYS,
+                                                       &numErrors[i]));
+            }
+
+            bslmt::ThreadUtil::microSleep(0, 2);
+            done = true;
+            threads.joinAll();
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ASSERTV(i, numErrors[i], 0 == numErrors[i]);
+            }
+
+            for (int key = 0; key < k_NUM_KEYS; ++key) {
+                const Pair value = { 2 * key + 1, 2 * key + 1 };
+                mX.setValue(key, value);
+            }
+            ASSERTV(mX.size(), k_NUM_KEYS == static_cast<int>(mX.size()));
+
+            for (int key = 0; key < k_NUM_KEYS; ++key) {
+                Pair value = { 0, 0 };
+                ASSERTV(key, 1 == mX.getValue(&value, key));
+                ASSERTV(key, 2 * key + 1 == value.d_first);
+                ASSERTV(key, 2 * key + 1 == value.d_second);
+            }
+        }
+        ASSERT(0 == oa.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // VISITORS
+        //
+        // Concerns:
+        // 1. `visit` and `visitReadOnly` call the visitor on every element,
+        //    and return the number of elements visited.
+        //
+        // 2. If the visitor returns `false`, visitation stops and the
+        //    negated number of elements visited is returned.
+        //
+        // 3. `visit` can modify the visited values.
+        //
+        // 4. The keyed versions call the visitor only for the element having
+        //    the key, and return 1, -1, or 0 if there is no such element.
+        //
+        // Plan:
+        // 1. Populate a map, and visit it with visitors that sum the values,
+        //    double the values, and stop after a given count; verify the
+        //    results against the expected values.  (C-1..3)
+        //
+        // 2. Call the keyed versions for present and absent keys with
+        //    visitors returning `true` and `false`.  (C-4)
+        //
+        // Testing:
+        //   int visit(const VisitorFunction& visitor);
+        //   int visit(const KEY& key, const VisitorFunction& visitor);
+        //   int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+        //   int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VISITORS" << endl
+                          << "========" << endl;
+
+        using bdlf::PlaceHolders::_1;
+        using bdlf::PlaceHolders::_2;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(0, 4, &oa);  const Obj& X = mX;
+
+        {
+            int sum = 0;
+            ASSERT(0 == X.visitReadOnly(
+                              bdlf::BindUtil::bind(&sumValues, &sum, _1, _2)));
+            ASSERT(0 == mX.visit(&doubleValue));
+        }
+
+        const int k_NUM_KEYS = 100;
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            mX.insert(i, i);
+        }
+        const int expSum = k_NUM_KEYS * (k_NUM_KEYS - 1) / 2;
+
+        {
+            int sum = 0;
+            ASSERT(k_NUM_KEYS == X.visitReadOnly(
+                              bdlf::BindUtil::bind(&sumValues, &sum, _1, _2)));
+            ASSERTV(sum, expSum == sum);
+        }
+
+        ASSERT(k_NUM_KEYS == mX.visit(&doubleValue));
+
+        {
+            int sum = 0;
+            X.visitReadOnly(bdlf::BindUtil::bind(&sumValues, &sum, _1, _2));
+            ASSERTV(sum, 2 * expSum == sum);
+        }
+
+        {
+            int count = 0;
+            ASSERT(-10 == X.visitReadOnly(
+                       bdlf::BindUtil::bind(&countUntil, &count, 10, _1, _2)));
+            ASSERT(-1 == mX.visit(&stopVisiting));
+        }
+
+        ASSERT( 1 == mX.visit(7, &doubleValue));
+        ASSERT(-1 == mX.visit(7, &stopVisiting));
+        ASSERT( 0 == mX.visit(k_NUM_KEYS, &doubleValue));
+
+        {
+            int value;
+            ASSERT(1 == X.getValue(&value, 7));
+            ASSERTV(value, 28 == value);
+        }
+
+        {
+            int sum = 0;
+            ASSERT( 1 == X.visitReadOnly(
+                          7, bdlf::BindUtil::bind(&sumValues, &sum, _1, _2)));
+            ASSERTV(sum, 28 == sum);
+            ASSERT(-1 == X.visitReadOnly(7, &stopVisitingReadOnly));
+            ASSERT( 0 == X.visitReadOnly(k_NUM_KEYS, &stopVisitingReadOnly));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ERASE AND CLEAR
+        //
+        // Concerns:
+        // 1. `erase` removes only the element having the key, and returns 1,
+        //    or returns 0 if there is no such element.
+        //
+        // 2. Erased keys can be inserted again.
+        //
+        // 3. `clear` removes all elements, does not free memory, and leaves
+        //    the map usable.
+        //
+        // 4. `empty` returns `true` if and only if `size()` is 0.
+        //
+        // Plan:
+        // 1. Populate maps with various numbers of shards, erase every other
+        //    key, and verify the return values, `size`, and `getValue` for
+        //    all keys.  (C-1)
+        //
+        // 2. Reinsert the erased keys and verify.  (C-2)
+        //
+        // 3. Call `clear`, and verify that no memory was freed and that the
+        //    map is empty and can be repopulated.  (C-3..4)
+        //
+        // Testing:
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   bool empty() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASE AND CLEAR" << endl
+                          << "===============" << endl;
+
+        const int NUM_SHARDS[] = { 1, 2, 16 };
+        const int k_NUM_KEYS   = 1000;
+
+        for (int ti = 0; ti < 3; ++ti) {
+            const int SHARDS = NUM_SHARDS[ti];
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(0, SHARDS, &oa);  const Obj& X = mX;
+
+                ASSERT(true == X.empty());
+                ASSERT(0    == mX.erase(0));
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    mX.insert(i, i);
+                }
+                ASSERT(false == X.empty());
+
+                for (int i = 0; i < k_NUM_KEYS; i += 2) {
+                    ASSERTV(SHARDS, i, 1 == mX.erase(i));
+                    ASSERTV(SHARDS, i, 0 == mX.erase(i));
+                }
+                ASSERTV(SHARDS, k_NUM_KEYS / 2 == static_cast<int>(X.size()));
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    int value = -1;
+                    ASSERTV(SHARDS, i, static_cast<bsl::size_t>(i % 2) ==
+                                                      X.getValue(&value, i));
+                    ASSERTV(SHARDS, i, value, i % 2 ? i == value
+                                                    : -1 == value);
+                }
+
+                for (int i = 0; i < k_NUM_KEYS; i += 2) {
+                    ASSERTV(SHARDS, i, 1 == mX.insert(i, -i));
+                }
+                ASSERTV(SHARDS, k_NUM_KEYS == static_cast<int>(X.size()));
+
+                for (int i = 0; i < k_NUM_KEYS; i += 2) {
+                    int value;
+                    ASSERTV(SHARDS, i, 1 == X.getValue(&value, i));
+                    ASSERTV(SHARDS, i, -i == value);
+                }
+
+                const bsls::Types::Int64 numBytes = oa.numBytesInUse();
+
+                mX.clear();
+
+                ASSERTV(SHARDS, numBytes == oa.numBytesInUse());
+                ASSERT(true == X.empty());
+                ASSERT(0    == X.size());
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    int value;
+                    ASSERTV(SHARDS, i, 0 == X.getValue(&value, i));
+                }
+
+                ASSERT(1 == mX.insert(5, 5));
+                ASSERT(1 == X.size());
+            }
+            ASSERTV(SHARDS, 0 == oa.numBytesInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, SET VALUE, AND GET VALUE
+        //
+        // Concerns:
+        // 1. `setValue` inserts absent keys and returns 0, and updates
+        //    present keys and returns 1.
+        //
+        // 2. `insert` returns 1 for absent keys and 0 for present keys, and
+        //    otherwise behaves as `setValue`.
+        //
+        // 3. `getValue` loads the value of present keys and returns 1, and
+        //    returns 0 and does not modify its argument for absent keys.
+        //
+        // 4. Shards grow as elements are inserted, and all elements remain
+        //    accessible.
+        //
+        // 5. All memory comes from the object allocator.
+        //
+        // Plan:
+        // 1. For maps with various numbers of shards, insert many keys
+        //    (causing every shard to grow several times), verifying the
+        //    return values and `size` after each insertion, and `getValue`
+        //    for a present and an absent key.  (C-1..4)
+        //
+        // 2. Update every key with both methods and verify.  (C-1..3)
+        //
+        // 3. Verify that the default allocator was not used.  (C-5)
+        //
+        // Testing:
+        //   bsl::size_t insert(const KEY& key, const VALUE& value);
+        //   bsl::size_t setValue(const KEY& key, const VALUE& value);
+        //   bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, SET VALUE, AND GET VALUE" << endl
+                          << "================================" << endl;
+
+        const int NUM_SHARDS[] = { 1, 3, 16, 64 };
+        const int k_NUM_KEYS   = 5000;
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const int SHARDS = NUM_SHARDS[ti];
+
+            if (veryVerbose) { T_ P(SHARDS) }
+
+            bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocatorMonitor  dam(&defaultAllocator);
+            {
+                Obj mX(0, SHARDS, &oa);  const Obj& X = mX;
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    const int key = i * 7919;
+
+                    if (i % 2) {
+                        ASSERTV(SHARDS, i, 0 == mX.setValue(key, i));
+                    }
+                    else {
+                        ASSERTV(SHARDS, i, 1 == mX.insert(key, i));
+                    }
+                    ASSERTV(SHARDS, i, i + 1 == static_cast<int>(X.size()));
+
+                    int value = -1;
+                    ASSERTV(SHARDS, i, 1 == X.getValue(&value, key));
+                    ASSERTV(SHARDS, i, i == value);
+
+                    value = -1;
+                    ASSERTV(SHARDS, i, 0 == X.getValue(&value, key + 1));
+                    ASSERTV(SHARDS, i, -1 == value);
+                }
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    const int key = i * 7919;
+
+                    ASSERTV(SHARDS, i, 1 == mX.setValue(key, -i));
+                    ASSERTV(SHARDS, i, 0 == mX.insert(key, 2 * i));
+                }
+                ASSERTV(SHARDS, k_NUM_KEYS == static_cast<int>(X.size()));
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    int value;
+                    ASSERTV(SHARDS, i, 1 == X.getValue(&value, i * 7919));
+                    ASSERTV(SHARDS, i, 2 * i == value);
+                }
+            }
+            ASSERTV(SHARDS, 0 == oa.numBytesInUse());
+            ASSERTV(SHARDS, dam.isTotalSame());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. The number of shards is rounded up to a power of two.
+        //
+        // 2. The allocator is the one supplied, or the default allocator.
+        //
+        // 3. No memory is allocated for a shard until an element is inserted
+        //    into it.
+        //
+        // 4. With an `initialCapacity`, that many evenly distributed elements
+        //    can be inserted without further allocation.
+        //
+        // 5. The destructor releases all memory, including that of replaced
+        //    tables.
+        //
+        // 6. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Construct maps with various numbers of shards and allocator
+        //    arguments, and verify `numShards`, `allocator`, and the number of
+        //    allocations.  (C-1..3)
+        //
+        // 2. Construct a map with an initial capacity, insert that many keys,
+        //    and verify the number of allocations.  (C-4)
+        //
+        // 3. Insert enough keys to grow the shards, destroy the map, and
+        //    verify that all memory is returned.  (C-5)
+        //
+        // 4. Verify that a zero number of shards is rejected.  (C-6)
+        //
+        // Testing:
+        //   ShardedFlatHashMap(initialCapacity, numShards, *basicAllocator);
+        //   ShardedFlatHashMap(bslma::Allocator *basicAllocator);
+        //   ~ShardedFlatHashMap();
+        //   EQUAL equalFunction() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t numShards() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+            {
+                Obj mX;  const Obj& X = mX;
+
+                ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+                ASSERT(&defaultAllocator == X.allocator());
+                ASSERT(1 == defaultAllocator.numBlocksInUse());
+                ASSERT(X.hashFunction()(5) == Obj().hashFunction()(5));
+                ASSERT(true == X.equalFunction()(3, 3));
+            }
+            ASSERT(dam.isInUseSame());
+        }
+
+        const struct {
+            int         d_line;
+            bsl::size_t d_numShards;
+            bsl::size_t d_expShards;
+        } DATA[] = {
+            { L_,    1,    1 },
+            { L_,    2,    2 },
+            { L_,    3,    4 },
+            { L_,    5,    8 },
+            { L_,   16,   16 },
+            { L_,   17,   32 },
+            { L_, 1000, 1024 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE       = DATA[ti].d_line;
+            const bsl::size_t NUM_SHARDS = DATA[ti].d_numShards;
+            const bsl::size_t EXP_SHARDS = DATA[ti].d_expShards;
+
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+            {
+                Obj mX(0, NUM_SHARDS, &oa);  const Obj& X = mX;
+
+                ASSERTV(LINE, EXP_SHARDS == X.numShards());
+                ASSERTV(LINE, &oa        == X.allocator());
+                ASSERTV(LINE, 1          == oa.numBlocksInUse());
+
+                mX.insert(1, 1);
+
+                ASSERTV(LINE, 1 < oa.numBlocksInUse());
+
+                for (int i = 0; i < 10000; ++i) {
+                    mX.insert(i, i);
+                }
+            }
+            ASSERTV(LINE, 0 == oa.numBytesInUse());
+            ASSERTV(LINE, dam.isTotalSame());
+        }
+
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+                ASSERT(&oa == X.allocator());
+            }
+            ASSERT(0 == oa.numBytesInUse());
+        }
+
+        {
+            const int k_CAPACITY = 10000;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(k_CAPACITY, 4, &oa);
+
+                // Fill each shard with its share of the capacity, so that the
+                // keys are distributed exactly evenly.
+
+                bsl::vector<int> counts(4, 0);
+                int              numInserted = 0;
+                const int        perShard    = k_CAPACITY / 4;
+
+                for (int key = 0; numInserted < k_CAPACITY; ++key) {
+                    const bsl::size_t shard =
+                                       (mX.hashFunction()(key) >> 7) & 3;
+                    if (counts[shard] < perShard) {
+                        ++counts[shard];
+                        ++numInserted;
+                        mX.insert(key, key);
+                    }
+                }
+
+                // One block for the shards, and three for each table: the
+                // table object, its entries, and its control bytes.
+
+                ASSERTV(oa.numAllocations(), 13 == oa.numAllocations());
+            }
+            ASSERT(0 == oa.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            ASSERT_PASS(Obj(0, 1, &oa));
+            ASSERT_FAIL(Obj(0, 0, &oa));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Insert, look up, update, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == X.size());
+
+            ASSERT(1 == mX.insert(1, 10));
+            ASSERT(1 == mX.insert(2, 20));
+            ASSERT(0 == mX.insert(1, 11));
+            ASSERT(2 == X.size());
+
+            int value;
+            ASSERT(1  == X.getValue(&value, 1));
+            ASSERT(11 == value);
+            ASSERT(0  == X.getValue(&value, 3));
+
+            ASSERT(1 == mX.setValue(2, 21));
+            ASSERT(1 == X.getValue(&value, 2));
+            ASSERT(21 == value);
+
+            ASSERT(1 == mX.erase(1));
+            ASSERT(1 == X.size());
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: READ-HEAVY AND MIXED WORKLOADS
+        //   Compare this container with `bdlcc::StripedUnorderedMap`.  The
+        //   optional parameters are:
+        //   2nd parameter: number of threads (default 4).
+        //   3rd parameter: number of operations per thread (default 2000000).
+        //   4th parameter: number of keys (default 100000).
+        //
+        // Concerns:
+        // 1. For a read-heavy (99% lookups) workload, lock-free lookups are
+        //    faster than lookups taking a reader lock.
+        //
+        // 2. For a mixed (50% lookups) workload, the container is not slower
+        //    than `bdlcc::StripedUnorderedMap`.
+        //
+        // Plan:
+        // 1. For read percentages of 99 and 50, run the same workload against
+        //    both containers, each having 16 shards (stripes), and report the
+        //    elapsed times.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: READ-HEAVY AND MIXED WORKLOADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: READ-HEAVY AND MIXED WORKLOADS"
+                          << endl
+                          << "================================================"
+                          << endl;
+
+        const int numThreads = argc > 2 ? bsl::atoi(argv[2]) : 4;
+        const int numOps     = argc > 3 ? bsl::atoi(argv[3]) : 2000000;
+        const int numKeys    = argc > 4 ? bsl::atoi(argv[4]) : 100000;
+
+        const int READ_PERCENT[] = { 99, 50 };
+
+        bslma::NewDeleteAllocator na;
+
+        cout << "threads: " << numThreads << ", operations per thread: "
+             << numOps << ", keys: " << numKeys << endl;
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const int READ = READ_PERCENT[ti];
+
+            typedef bdlcc::StripedUnorderedMap<int, int> Striped;
+
+            double stripedTime;
+            {
+                Striped map(2 * numKeys, 16, &na);
+                stripedTime = performance::run(&map,
+                                               numThreads,
+                                               numOps,
+                                               numKeys,
+                                               READ);
+            }
+
+            double shardedTime;
+            {
+                Obj map(numKeys, 16, &na);
+                shardedTime = performance::run(&map,
+                                               numThreads,
+                                               numOps,
+                                               numKeys,
+                                               READ);
+            }
+
+            const double totalOps = static_cast<double>(numThreads) * numOps;
+
+            cout << READ << "% reads:" << endl
+                 << "    StripedUnorderedMap: " << stripedTime << "s ("
+                 << totalOps / stripedTime / 1e6 << " Mops/s)" << endl
+                 << "    ShardedFlatHashMap:  " << shardedTime << "s ("
+                 << totalOps / shardedTime / 1e6 << " Mops/s)" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -40,6 +40,12 @@ BSLS_IDENT("$Id: $")
 // blocked in `popFront` when the queue is dequeue disabled return from
 // `popFront` immediately and return an error code.
 //
+// The batch methods `pushBackMany`, `popFrontMany`, and `tryPopFrontUpTo`
+// transfer a range of elements at a time.  A batch method updates the shared
+// state of the queue, and signals a blocked thread, once per batch rather than
+// once per element, and is preferable when elements are produced or consumed
+// in groups.
+//
 ///Template Requirements
 ///---------------------
 // `bdlcc::SingleConsumerQueue` is a template that is parameterized on the type
@@ -241,6 +247,17 @@ class SingleConsumerQueue {
     /// undefined unless the invoker of this method is the single consumer.
     int popFront(TYPE* value);
 
+    /// Remove at least one and at most the specified `maxNumItems` elements
+    /// from the front of this queue and assign them, in order, to successive
+    /// positions of the specified `output` iterator.  If the queue is empty,
+    /// block until it is not empty.  Return the number of elements removed,
+    /// or 0 if `isPopFrontDisabled()`.  The consumer blocked due to the
+    /// queue being empty will return 0 if `disablePopFront` is invoked.  The
+    /// behavior is undefined unless `0 < maxNumItems` and the invoker of
+    /// this method is the single consumer.
+    template <class OUTPUT_ITER>
+    bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -253,6 +270,16 @@ class SingleConsumerQueue {
     /// changed.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append the elements in the specified range `[begin .. end)`, in
+    /// order, to the back of this queue.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`; in this case, a prefix of the range may have
+    /// been appended if the queue was disabled concurrently.  Note that
+    /// elements appended by other producers may be interleaved with the
+    /// range.
+    template <class FORWARD_ITER>
+    int pushBackMany(FORWARD_ITER begin, FORWARD_ITER end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -270,6 +297,15 @@ class SingleConsumerQueue {
     /// single consumer.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove, without blocking, up to the specified
+    /// `maxNumItems` elements from the front of this queue and assign them,
+    /// in order, to successive positions of the specified `output`
+    /// iterator.  Return the number of elements removed, which is 0 if
+    /// `isPopFrontDisabled()` or the queue was empty.  The behavior is
+    /// undefined unless the invoker of this method is the single consumer.
+    template <class OUTPUT_ITER>
+    bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -373,6 +409,14 @@ int SingleConsumerQueue<TYPE>::popFront(TYPE *value)
     return d_impl.popFront(value);
 }
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+bsl::size_t SingleConsumerQueue<TYPE>::popFrontMany(bsl::size_t maxNumItems,
+                                                    OUTPUT_ITER output)
+{
+    return d_impl.popFrontMany(maxNumItems, output);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -385,6 +429,14 @@ int SingleConsumerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class FORWARD_ITER>
+int SingleConsumerQueue<TYPE>::pushBackMany(FORWARD_ITER begin,
+                                             FORWARD_ITER end)
+{
+    return d_impl.pushBackMany(begin, end);
+}
+
 template <class TYPE>
 void SingleConsumerQueue<TYPE>::removeAll()
 {
@@ -397,6 +449,14 @@ int SingleConsumerQueue<TYPE>::tryPopFront(TYPE *value)
     return d_impl.tryPopFront(value);
 }
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+bsl::size_t SingleConsumerQueue<TYPE>::tryPopFrontUpTo(bsl::size_t maxNumItems,
+                                                       OUTPUT_ITER output)
+{
+    return d_impl.tryPopFrontUpTo(maxNumItems, output);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -109,6 +109,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>
+#include <bsl_iterator.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -185,6 +186,99 @@ class SingleConsumerQueueImpl_PopCompleteGuard {
     ~SingleConsumerQueueImpl_PopCompleteGuard();
 };
 
+            // ==================================================
+            // class SingleConsumerQueueImpl_PopManyCompleteGuard
+            // ==================================================
+
+/// This class implements a guard that automatically invokes
+/// `popManyComplete` on the managed queue upon destruction with the number
+/// of nodes removed by a batch removal.  If a removal was started and not
+/// completed, the removal is completed, destroying the value of the node,
+/// before `popManyComplete` is invoked.
+template <class TYPE>
+class SingleConsumerQueueImpl_PopManyCompleteGuard {
+
+    // DATA
+    TYPE        *d_queue_p;    // managed queue
+    bsl::size_t  d_numPopped;  // number of removed nodes
+    bool         d_isPopping;  // 'true' if a removal is in progress
+
+  private:
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PopManyCompleteGuard();
+    SingleConsumerQueueImpl_PopManyCompleteGuard(
+                          const SingleConsumerQueueImpl_PopManyCompleteGuard&);
+    SingleConsumerQueueImpl_PopManyCompleteGuard& operator=(
+                          const SingleConsumerQueueImpl_PopManyCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `popManyComplete` guard managing the specified `queue`.
+    explicit
+    SingleConsumerQueueImpl_PopManyCompleteGuard(TYPE *queue);
+
+    /// Destroy this object, complete the removal in progress, if any, and
+    /// invoke the `popManyComplete` method on the managed queue.
+    ~SingleConsumerQueueImpl_PopManyCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Complete the removal of the next node of the managed queue, and
+    /// destroy the value of the node if the specified `destruct` is `true`.
+    void completePop(bool destruct);
+
+    /// Indicate the removal of the next node of the managed queue, holding
+    /// a value, has started.
+    void startPop();
+};
+
+            // ==================================================
+            // class SingleConsumerQueueImpl_PushManyCompleteGuard
+            // ==================================================
+
+/// This class implements a guard that automatically invokes
+/// `pushManyComplete` on the managed queue upon destruction, publishing the
+/// nodes, of a block reserved by a batch insertion, that have been written
+/// and reclaiming the remaining nodes of the block.
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_PushManyCompleteGuard {
+
+    // DATA
+    TYPE        *d_queue_p;    // managed queue owning the managed nodes
+    NODE        *d_node_p;     // first managed node
+    bsl::size_t  d_numNodes;   // number of managed nodes
+    bsl::size_t  d_numPushed;  // number of written nodes
+
+  private:
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PushManyCompleteGuard();
+    SingleConsumerQueueImpl_PushManyCompleteGuard(
+                         const SingleConsumerQueueImpl_PushManyCompleteGuard&);
+    SingleConsumerQueueImpl_PushManyCompleteGuard& operator=(
+                         const SingleConsumerQueueImpl_PushManyCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `pushManyComplete` guard managing the specified `numNodes`
+    /// consecutive nodes, starting with the specified `node`, of the
+    /// specified `queue`.
+    SingleConsumerQueueImpl_PushManyCompleteGuard(TYPE        *queue,
+                                                  NODE        *node,
+                                                  bsl::size_t  numNodes);
+
+    /// Destroy this object and invoke the managed queue's
+    /// `pushManyComplete` method with the managed nodes and the number of
+    /// written nodes.
+    ~SingleConsumerQueueImpl_PushManyCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Count one more of the managed nodes as written.
+    void pushComplete();
+};
+
              // ===============================================
              // class SingleConsumerQueueImpl_AllocateLockGuard
              // ===============================================
@@ -352,6 +446,22 @@ class SingleConsumerQueueImpl {
                                                                   MUTEX,
                                                                   CONDITION> >;
 
+    friend class SingleConsumerQueueImpl_PopManyCompleteGuard<
+                                          SingleConsumerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
+    friend class SingleConsumerQueueImpl_PushManyCompleteGuard<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
     friend class SingleConsumerQueueImpl_AllocateLockGuard<
                                           SingleConsumerQueueImpl<TYPE,
                                                                   ATOMIC_OP,
@@ -381,10 +491,47 @@ class SingleConsumerQueueImpl {
     /// complete the reclamation of a node in the presence of an exception.
     void popComplete(bool destruct);
 
+    /// If the specified `destruct` is true, destruct the value stored in
+    /// `d_nextRead`.  Mark `d_nextRead` writable and advance `d_nextRead`.
+    /// Note that the node is not made available to the producers until
+    /// `popManyComplete` is invoked.
+    void popCompleteRaw(bool destruct);
+
+    /// Remove up to the specified `maxNumItems` elements from the front of
+    /// this queue, without blocking, and assign them, in order, to
+    /// successive positions of the specified `output` iterator.  Return the
+    /// number of elements removed.  Reclaimed nodes encountered are removed
+    /// but not counted.
+    template <class OUTPUT_ITER>
+    bsl::size_t popFrontManyRaw(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
+    /// Make the specified `numNodes` nodes, removed with `popCompleteRaw`,
+    /// available to the producers, and if the queue is empty then signal
+    /// the queue empty condition.
+    void popManyComplete(bsl::size_t numNodes);
+
     /// Return a pointer to the node to assign the value being pushed into
     /// this queue, or 0 if `isPushBackDisabled()`.
     Node *pushBackHelper();
 
+    /// Reserve at least one and at most the specified `numNodes` consecutive
+    /// nodes to assign the values being pushed into this queue, load into
+    /// `numNodes` the number of nodes reserved, and return a pointer to the
+    /// first reserved node, or return 0 if `isPushBackDisabled()`.  Note
+    /// that all the nodes are reserved with one update of `d_nextWrite`
+    /// when enough nodes are available, and that `pushBackHelper` is used to
+    /// reserve (and, if needed, allocate) a single node otherwise.
+    Node *pushBackManyHelper(bsl::size_t *numNodes);
+
+    /// Mark as readable the specified `numPushed` consecutive nodes starting
+    /// with the specified `node`, mark the remaining nodes of the
+    /// `numNodes` consecutive nodes starting with `node` as nodes to be
+    /// reclaimed, and signal the consumer if it is blocked on one of the
+    /// nodes.  The behavior is undefined unless `numPushed <= numNodes`.
+    void pushManyComplete(Node        *node,
+                          bsl::size_t  numPushed,
+                          bsl::size_t  numNodes);
+
     /// Remove the allocation lock indicator from `d_state`.  This method is
     /// intended to be used to remove the allocation lock indicator from
     /// `d_state` when there is an exception during allocation and the
@@ -443,6 +590,20 @@ class SingleConsumerQueueImpl {
     /// undefined unless the invoker of this method is the single consumer.
     int popFront(TYPE *value);
 
+    /// Remove at least one and at most the specified `maxNumItems` elements
+    /// from the front of this queue and assign them, in order, to successive
+    /// positions of the specified `output` iterator.  If the queue is empty,
+    /// block until it is not empty.  Return the number of elements removed,
+    /// or 0 if `isPopFrontDisabled()`.  The consumer blocked due to the
+    /// queue being empty will return 0 if `disablePopFront` is invoked.  The
+    /// behavior is undefined unless `0 < maxNumItems` and the invoker of
+    /// this method is the single consumer.  Note that the removed nodes are
+    /// made available to the producers with one update of the queue state.
+    /// Also note that if an exception is thrown while assigning to `output`,
+    /// the element being assigned is removed from this queue.
+    template <class OUTPUT_ITER>
+    bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -455,6 +616,18 @@ class SingleConsumerQueueImpl {
     /// changed.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append the elements in the specified range `[begin .. end)`, in
+    /// order, to the back of this queue.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`; in this case, a prefix of the range may have
+    /// been appended if the queue was disabled concurrently.  Note that,
+    /// when enough nodes are available, the nodes for many elements are
+    /// reserved with one update of the queue state, and the elements are
+    /// made readable after all of them are written.  Also note that elements
+    /// appended by other producers may be interleaved with the range.
+    template <class FORWARD_ITER>
+    int pushBackMany(FORWARD_ITER begin, FORWARD_ITER end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -472,6 +645,19 @@ class SingleConsumerQueueImpl {
     /// single consumer.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove, without blocking, up to the specified
+    /// `maxNumItems` elements from the front of this queue and assign them,
+    /// in order, to successive positions of the specified `output`
+    /// iterator.  Return the number of elements removed, which is 0 if
+    /// `isPopFrontDisabled()` or the queue was empty.  The behavior is
+    /// undefined unless the invoker of this method is the single consumer.
+    /// Note that the removed nodes are made available to the producers with
+    /// one update of the queue state.  Also note that if an exception is
+    /// thrown while assigning to `output`, the element being assigned is
+    /// removed from this queue.
+    template <class OUTPUT_ITER>
+    bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, retun
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -596,6 +782,83 @@ SingleConsumerQueueImpl_PopCompleteGuard<TYPE>::
     d_queue_p->popComplete(true);
 }
 
+            // --------------------------------------------------
+            // class SingleConsumerQueueImpl_PopManyCompleteGuard
+            // --------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleConsumerQueueImpl_PopManyCompleteGuard<TYPE>::
+                      SingleConsumerQueueImpl_PopManyCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_numPopped(0)
+, d_isPopping(false)
+{
+}
+
+template <class TYPE>
+SingleConsumerQueueImpl_PopManyCompleteGuard<TYPE>::
+                                ~SingleConsumerQueueImpl_PopManyCompleteGuard()
+{
+    if (d_isPopping) {
+        d_queue_p->popCompleteRaw(true);
+        ++d_numPopped;
+    }
+    d_queue_p->popManyComplete(d_numPopped);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleConsumerQueueImpl_PopManyCompleteGuard<TYPE>::completePop(
+                                                                 bool destruct)
+{
+    d_isPopping = false;
+    d_queue_p->popCompleteRaw(destruct);
+    ++d_numPopped;
+}
+
+template <class TYPE>
+inline
+void SingleConsumerQueueImpl_PopManyCompleteGuard<TYPE>::startPop()
+{
+    d_isPopping = true;
+}
+
+            // ---------------------------------------------------
+            // class SingleConsumerQueueImpl_PushManyCompleteGuard
+            // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushManyCompleteGuard<TYPE, NODE>::
+         SingleConsumerQueueImpl_PushManyCompleteGuard(TYPE        *queue,
+                                                       NODE        *node,
+                                                       bsl::size_t  numNodes)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_numNodes(numNodes)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushManyCompleteGuard<TYPE, NODE>::
+                               ~SingleConsumerQueueImpl_PushManyCompleteGuard()
+{
+    d_queue_p->pushManyComplete(d_node_p, d_numPushed, d_numNodes);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void SingleConsumerQueueImpl_PushManyCompleteGuard<TYPE, NODE>::pushComplete()
+{
+    BSLS_ASSERT(d_numPushed < d_numNodes);
+
+    ++d_numPushed;
+}
+
           // ------------------------------------------------------
           // class SingleConsumerQueueImpl_AllocateLockGuardProctor
           // ------------------------------------------------------
@@ -665,8 +928,18 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
 }
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+inline
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                                                    ::popComplete(bool destruct)
+{
+    popCompleteRaw(destruct);
+    popManyComplete(1);
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+inline
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                                ::popCompleteRaw(bool destruct)
 {
     Node *nextRead =
                     static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
@@ -679,9 +952,65 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
 
     ATOMIC_OP::setPtrRelease(&d_nextRead,
                              ATOMIC_OP::getPtrAcquire(&nextRead->d_next));
+}
 
-    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(&d_state,
-                                                           k_AVAILABLE_INC);
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class OUTPUT_ITER>
+bsl::size_t SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                     ::popFrontManyRaw(bsl::size_t maxNumItems,
+                                       OUTPUT_ITER output)
+{
+    SingleConsumerQueueImpl_PopManyCompleteGuard<
+                              SingleConsumerQueueImpl<TYPE,
+                                                      ATOMIC_OP,
+                                                      MUTEX,
+                                                      CONDITION> > guard(this);
+
+    bsl::size_t num = 0;
+
+    while (num < maxNumItems) {
+        Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+        int   nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+
+        if (e_RECLAIM == nodeState) {
+            ATOMIC_OP::addInt64AcqRel(&d_capacity, 1);
+            guard.completePop(false);
+            continue;                                               // CONTINUE
+        }
+
+        if (e_READABLE != nodeState) {
+            break;
+        }
+
+        guard.startPop();
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        *output = bslmf::MovableRefUtil::move(nextRead->d_value.object());
+#else
+        *output = nextRead->d_value.object();
+#endif
+        ++output;
+
+        guard.completePop(true);
+        ++num;
+    }
+
+    return num;
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                       ::popManyComplete(bsl::size_t numNodes)
+{
+    if (0 == numNodes) {
+        return;                                                       // RETURN
+    }
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                           &d_state,
+                           k_AVAILABLE_INC
+                                 * static_cast<bsls::Types::Int64>(numNodes));
 
     if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
         {
@@ -839,6 +1168,110 @@ typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
     return nextWrite;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
+                     SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                 ::pushBackManyHelper(bsl::size_t *numNodes)
+{
+    BSLS_ASSERT(numNodes);
+    BSLS_ASSERT(0 < *numNodes);
+
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    // Reserve the nodes, and indicate this thread is intending to use
+    // existing nodes, with one update of 'd_state'.  When fewer than two nodes
+    // are available, or an allocation is in progress, 'pushBackHelper'
+    // handles the reservation of a single node.
+
+    bsls::Types::Int64 state = ATOMIC_OP::getInt64Acquire(&d_state);
+    bsls::Types::Int64 expState;
+    bsls::Types::Int64 num;
+
+    do {
+        num = available(state);
+        if (1 == *numNodes || 2 > num || 0 != (state & k_ALLOCATE_MASK)) {
+            *numNodes = 1;
+            return pushBackHelper();                                  // RETURN
+        }
+        if (static_cast<bsls::Types::Int64>(*numNodes) < num) {
+            num = static_cast<bsls::Types::Int64>(*numNodes);
+        }
+
+        expState = state;
+        state    = ATOMIC_OP::testAndSwapInt64AcqRel(
+                                        &d_state,
+                                        state,
+                                        state + k_USE_INC
+                                              - k_AVAILABLE_INC * num);
+    } while (state != expState);
+
+    *numNodes = static_cast<bsl::size_t>(num);
+
+    Node *nextWrite =
+                   static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+
+    Node *expNextWrite;
+    do {
+        expNextWrite = nextWrite;
+
+        Node *next = nextWrite;
+        for (bsls::Types::Int64 i = 0; i < num; ++i) {
+            next = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
+                                                               &next->d_next));
+        }
+
+        nextWrite = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                  &d_nextWrite,
+                                                                  nextWrite,
+                                                                  next));
+    } while (nextWrite != expNextWrite);
+
+    ATOMIC_OP::addInt64AcqRel(&d_state, -k_USE_INC);
+
+    return nextWrite;
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                   ::pushManyComplete(Node        *node,
+                                                      bsl::size_t  numPushed,
+                                                      bsl::size_t  numNodes)
+{
+    BSLS_ASSERT(numPushed <= numNodes);
+
+    bool isBlocked = false;
+
+    for (bsl::size_t i = 0; i < numNodes; ++i) {
+        // Once published, a node may be removed and reused, so the next node
+        // is loaded first.
+
+        Node *next = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
+                                                               &node->d_next));
+
+        if (i < numPushed) {
+            int nodeState = ATOMIC_OP::swapIntAcqRel(&node->d_state,
+                                                     e_READABLE);
+            if (e_WRITABLE_AND_BLOCKED == nodeState) {
+                isBlocked = true;
+            }
+        }
+        else {
+            markReclaim(node);
+        }
+
+        node = next;
+    }
+
+    if (isBlocked) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 inline
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
@@ -1003,6 +1436,58 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class OUTPUT_ITER>
+bsl::size_t SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                        popFrontMany(bsl::size_t maxNumItems,
+                                                     OUTPUT_ITER output)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    // Wait, as in 'popFront', until the next node is readable; the nodes are
+    // then removed without blocking.
+
+    bsl::size_t num;
+    do {
+        Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+        int nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+
+        if (e_WRITABLE == nodeState) {
+            bslmt::ThreadUtil::yield();
+            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+            if (e_WRITABLE == nodeState) {
+                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+                nodeState = ATOMIC_OP::swapIntAcqRel(&nextRead->d_state,
+                                                     e_WRITABLE_AND_BLOCKED);
+                while (e_READABLE != nodeState && e_RECLAIM != nodeState) {
+                    if (generation !=
+                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
+                        ATOMIC_OP::testAndSwapIntAcqRel(&nextRead->d_state,
+                                                        e_WRITABLE_AND_BLOCKED,
+                                                        e_WRITABLE);
+                        return 0;                                     // RETURN
+                    }
+                    d_readCondition.wait(&d_readMutex);
+                    nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+                }
+            }
+        }
+
+        // Note that 'num' is 0 only if the readable nodes were all reclaimed
+        // nodes.
+
+        num = popFrontManyRaw(maxNumItems, output);
+    } while (0 == num);
+
+    return num;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
                                                              const TYPE& value)
@@ -1072,6 +1557,49 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITER>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBackMany(
+                                                            FORWARD_ITER begin,
+                                                            FORWARD_ITER end)
+{
+    bsl::size_t remaining =
+                        static_cast<bsl::size_t>(bsl::distance(begin, end));
+
+    while (remaining) {
+        bsl::size_t  num    = remaining;
+        Node        *target = pushBackManyHelper(&num);
+
+        if (0 == target) {
+            return e_DISABLED;                                        // RETURN
+        }
+
+        SingleConsumerQueueImpl_PushManyCompleteGuard<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node> guard(this, target, num);
+
+        for (bsl::size_t i = 0; i < num; ++i) {
+            Node *next = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
+                                                             &target->d_next));
+
+            bslalg::ScalarPrimitives::copyConstruct(target->d_value.address(),
+                                                    *begin,
+                                                    allocator());
+            guard.pushComplete();
+
+            ++begin;
+            target = next;
+        }
+
+        remaining -= num;
+    }
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -1145,6 +1673,19 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class OUTPUT_ITER>
+bsl::size_t SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                     tryPopFrontUpTo(bsl::size_t maxNumItems,
+                                                     OUTPUT_ITER output)
+{
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_popFrontDisabled) & 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    return popFrontManyRaw(maxNumItems, output);
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -29,10 +29,12 @@
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_format.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
@@ -81,10 +83,13 @@ using namespace bsl;
 // [ 5] SingleConsumerQueueImpl(capacity, *bA = 0);
 // [ 2] ~SingleConsumerQueueImpl();
 // [ 2] int popFront(TYPE *value);
+// [15] bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [15] int pushBackMany(FORWARD_ITER begin, FORWARD_ITER end);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [15] bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
 // [ 6] void disablePopFront();
@@ -108,6 +113,7 @@ using namespace bsl;
 // [12] CONCERN: ordering guarantee
 // [13] CONCERN: concurrent allocations
 // [14] DRQS 176476958: `disable` during `pop` creates invalid state
+// [15] CONCERN: batch operations preserve the ordering guarantee
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -832,6 +838,105 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
     s_continue = 0;
 }
 
+namespace Case15 {
+
+const int k_NUM_VALUES    = 10000;  // number of values pushed per producer
+const int k_PRODUCER_SHIFT = 20;    // shift of producer id within a value
+
+struct PushManyData {
+    Obj         *d_obj_p;      // queue under test
+    int          d_id;         // producer id
+    bsl::size_t  d_batchSize;  // number of elements per push
+};
+
+extern "C" void *pushBackMany(void *arg)
+{
+    PushManyData *data = static_cast<PushManyData *>(arg);
+    Obj&          mX   = *data->d_obj_p;
+
+    bsl::vector<int> values(data->d_batchSize);
+
+    const bsl::size_t batchSize = data->d_batchSize;
+
+    for (int i = 0; i < k_NUM_VALUES; i += static_cast<int>(batchSize)) {
+        bsl::size_t num = bsl::min(batchSize,
+                                   static_cast<bsl::size_t>(k_NUM_VALUES - i));
+        for (bsl::size_t j = 0; j < num; ++j) {
+            values[j] = (data->d_id << k_PRODUCER_SHIFT)
+                      + i
+                      + static_cast<int>(j);
+        }
+        ASSERT(e_SUCCESS == mX.pushBackMany(values.begin(),
+                                            values.begin() + num));
+    }
+
+    return 0;
+}
+
+extern "C" void *popFrontManyOnce(void *arg)
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    int values[4];
+
+    bsl::size_t num = mX.popFrontMany(4, values);
+
+    ASSERT(1 <= num);
+    ASSERT(1 == values[0]);
+
+    return 0;
+}
+
+/// Using the specified `numPushThread` threads, push `k_NUM_VALUES`
+/// increasing values per thread to the specified `obj` in batches of the
+/// specified `batchSize`, while removing elements with `popFrontMany` using
+/// the same `batchSize`, and verify that every value is removed exactly once
+/// and that the values of each producer are removed in increasing order.
+void batchOrderingTest(Obj *obj, int numPushThread, bsl::size_t batchSize)
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> pushHandle(numPushThread);
+    bsl::vector<PushManyData>              pushData(numPushThread);
+
+    for (int i = 0; i < numPushThread; ++i) {
+        pushData[i].d_obj_p     = obj;
+        pushData[i].d_id        = i;
+        pushData[i].d_batchSize = batchSize;
+        bslmt::ThreadUtil::create(&pushHandle[i],
+                                  pushBackMany,
+                                  &pushData[i]);
+    }
+
+    bsl::vector<int> last(numPushThread, -1);
+    bsl::vector<int> values(batchSize);
+
+    int remaining = numPushThread * k_NUM_VALUES;
+    while (0 < remaining) {
+        bsl::size_t num = obj->popFrontMany(batchSize, values.begin());
+
+        ASSERTV(batchSize, num, 1 <= num && num <= batchSize);
+
+        for (bsl::size_t j = 0; j < num; ++j) {
+            int id    = values[j] >> k_PRODUCER_SHIFT;
+            int value = values[j] & ((1 << k_PRODUCER_SHIFT) - 1);
+
+            ASSERTV(batchSize, id, 0 <= id && id < numPushThread);
+            ASSERTV(batchSize, id, last[id], value, last[id] + 1 == value);
+
+            last[id] = value;
+        }
+        remaining -= static_cast<int>(num);
+    }
+
+    for (int i = 0; i < numPushThread; ++i) {
+        bslmt::ThreadUtil::join(pushHandle[i]);
+    }
+
+    ASSERT(0 == remaining);
+    ASSERT(obj->isEmpty());
+}
+
+}  // close namespace Case15
+
 // ============================================================================
 //               GENERATOR FUNCTIONS `gg` AND `ggg` FOR TESTING
 // ----------------------------------------------------------------------------
@@ -954,6 +1059,257 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 15: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //   Ensure `pushBackMany`, `popFrontMany`, and `tryPopFrontUpTo`
+        //   operate as expected.
+        //
+        // Concerns:
+        // 1. `pushBackMany` appends the range, in order, to the queue,
+        //    allocating nodes as needed.
+        //
+        // 2. `popFrontMany` and `tryPopFrontUpTo` remove, in order, no more
+        //    than the requested number of elements, write them to the output
+        //    iterator, and return the number of elements removed.
+        //
+        // 3. `tryPopFrontUpTo` returns 0 when the queue is empty or when
+        //    `0 == maxNumItems`, and `popFrontMany` blocks until an element is
+        //    available.
+        //
+        // 4. The methods honor the disabled states of the queue, and the
+        //    consumer blocked in `popFrontMany` returns 0 when
+        //    `disablePopFront` is invoked.
+        //
+        // 5. Concurrent batch insertion delivers every element exactly once
+        //    and preserves the ordering guarantee.
+        //
+        // 6. The methods are exception neutral, and an exception leaves the
+        //    queue in a consistent state.
+        //
+        // Plan:
+        // 1. Directly verify the results of a sequence of batch operations on
+        //    a queue in a single thread.  (C-1..3)
+        //
+        // 2. Verify the return values of the methods when the queue is
+        //    disabled, and verify the blocked consumer is awoken both by
+        //    `pushBackMany` and by `disablePopFront`.  (C-3..4)
+        //
+        // 3. Using a varying number of threads, push increasing values in
+        //    batches while the consumer removes elements with `popFrontMany`,
+        //    and verify each value is removed exactly once and in increasing
+        //    order per producer.  (C-5)
+        //
+        // 4. Using an element type that allocates on copy and assignment,
+        //    inject exceptions and verify the number of elements in the queue
+        //    and that no memory is leaked.  (C-6)
+        //
+        // Testing:
+        //   bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER);
+        //   int pushBackMany(FORWARD_ITER begin, FORWARD_ITER end);
+        //   bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER);
+        //   CONCERN: batch operations preserve the ordering guarantee
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded behavior." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            const int VALUES[]   = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+                                     11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+            const bsl::size_t NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            int values[NUM_VALUES] = { 0 };
+
+            ASSERT(0 == mX.tryPopFrontUpTo(3, values));
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES));
+            ASSERT(0 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + 5));
+            ASSERT(5 == X.numElements());
+
+            ASSERT(0 == mX.tryPopFrontUpTo(0, values));
+            ASSERT(3 == mX.tryPopFrontUpTo(3, values));
+            ASSERT(1 == values[0]);
+            ASSERT(2 == values[1]);
+            ASSERT(3 == values[2]);
+            ASSERT(2 == X.numElements());
+
+            ASSERT(2 == mX.popFrontMany(NUM_VALUES, values));
+            ASSERT(4 == values[0]);
+            ASSERT(5 == values[1]);
+            ASSERT(X.isEmpty());
+
+            // Exceed the capacity of the queue to force allocations.
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(e_SUCCESS == mX.pushBackMany(VALUES,
+                                                    VALUES + NUM_VALUES));
+            }
+            ASSERT(3 * NUM_VALUES == X.numElements());
+
+            ASSERT(1 == mX.popFrontMany(1, values));
+            ASSERT(1 == values[0]);
+
+            bsl::vector<int> result;
+
+            bsl::size_t num = mX.tryPopFrontUpTo(100,
+                                                 bsl::back_inserter(result));
+
+            ASSERT(3 * NUM_VALUES - 1 == num);
+            ASSERT(3 * NUM_VALUES - 1 == result.size());
+            for (bsl::size_t i = 0; i < result.size(); ++i) {
+                ASSERTV(i,
+                        result[i],
+                        static_cast<int>((i + 1) % NUM_VALUES + 1) ==
+                                                                   result[i]);
+            }
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.waitUntilEmpty());
+        }
+
+        if (verbose) cout << "\nDisabled states and blocking." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            const int VALUES[] = { 1, 2, 3, 4 };
+
+            int values[4] = { 0 };
+
+            mX.disablePushBack();
+            ASSERT(e_DISABLED == mX.pushBackMany(VALUES, VALUES + 4));
+            ASSERT(0 == X.numElements());
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + 4));
+
+            mX.disablePopFront();
+            ASSERT(0 == mX.popFrontMany(4, values));
+            ASSERT(0 == mX.tryPopFrontUpTo(4, values));
+            ASSERT(4 == X.numElements());
+            mX.enablePopFront();
+
+            mX.removeAll();
+
+            bslmt::ThreadUtil::Handle handle;
+
+            bslmt::ThreadUtil::create(&handle,
+                                      Case15::popFrontManyOnce,
+                                      &mX);
+
+            bslmt::ThreadUtil::microSleep(100000);
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + 4));
+
+            bslmt::ThreadUtil::join(handle);
+
+            mX.removeAll();
+
+            bslmt::ThreadUtil::create(&handle, deferredDisablePopFront, &mX);
+
+            ASSERT(0 == mX.popFrontMany(4, values));
+
+            bslmt::ThreadUtil::join(handle);
+        }
+
+        if (verbose) cout << "\nConcurrent batch insertion." << endl;
+        {
+            const bsl::size_t BATCH_SIZES[] = { 1, 3, 16, 100 };
+            const int         NUM_BATCH_SIZES =
+                   static_cast<int>(sizeof BATCH_SIZES / sizeof *BATCH_SIZES);
+
+            for (int numPushThread = 1;
+                 numPushThread <= 4;
+                 numPushThread *= 2) {
+                for (int i = 0; i < NUM_BATCH_SIZES; ++i) {
+                    if (veryVerbose) {
+                        T_ P_(numPushThread) P(BATCH_SIZES[i]);
+                    }
+
+                    Obj mX;
+
+                    Case15::batchOrderingTest(&mX,
+                                              numPushThread,
+                                              BATCH_SIZES[i]);
+                }
+            }
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException neutrality." << endl;
+        {
+            typedef bdlcc::SingleConsumerQueueImpl<AllocExceptionHelper,
+                                                   bsls::AtomicOperations,
+                                                   bslmt::Mutex,
+                                                   bslmt::Condition> HObj;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            {
+                HObj mX(8, &sa);  const HObj& X = mX;
+
+                bsl::vector<AllocExceptionHelper> values(
+                                                   3,
+                                                   AllocExceptionHelper(&sa),
+                                                   &sa);
+
+                // The copy of the second element throws; the first element is
+                // appended and the nodes reserved for the others are
+                // reclaimed.
+
+                int numException = 0;
+
+                sa.setAllocationLimit(1);
+                try {
+                    mX.pushBackMany(values.begin(), values.end());
+                } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                    ++numException;
+                }
+                sa.setAllocationLimit(-1);
+
+                ASSERT(1 == numException);
+                ASSERT(1 == X.numElements());
+
+                ASSERT(e_SUCCESS == mX.pushBackMany(values.begin(),
+                                                    values.end()));
+                ASSERT(4 == X.numElements());
+
+                // The assignment of the first element removed throws; that
+                // element is removed.
+
+                sa.setAllocationLimit(0);
+                try {
+                    mX.tryPopFrontUpTo(3, values.begin());
+                } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                    ++numException;
+                }
+                sa.setAllocationLimit(-1);
+
+                ASSERT(2 == numException);
+                ASSERT(3 == X.numElements());
+
+                ASSERT(3 == mX.popFrontMany(3, values.begin()));
+                ASSERT(X.isEmpty());
+                ASSERT(0 == X.waitUntilEmpty());
+
+                // The reclaimed nodes are reused.
+
+                ASSERT(e_SUCCESS == mX.pushBackMany(values.begin(),
+                                                    values.end()));
+                ASSERT(3 == X.numElements());
+                ASSERT(3 == mX.tryPopFrontUpTo(3, values.begin()));
+                ASSERT(X.isEmpty());
+            }
+
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+#endif
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // DRQS 176476958: `disablePopFront` races with `popFront`
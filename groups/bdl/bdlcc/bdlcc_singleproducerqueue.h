@@ -40,6 +40,12 @@ BSLS_IDENT("$Id: $")
 // blocked in `popFront` when the queue is dequeue disabled return from
 // `popFront` immediately and return an error code.
 //
+// The batch methods `pushBackMany`, `popFrontMany`, and `tryPopFrontUpTo`
+// transfer a range of elements at a time.  A batch method updates the shared
+// state of the queue, and signals a blocked thread, once per batch rather than
+// once per element, and is preferable when elements are produced or consumed
+// in groups.
+//
 ///Template Requirements
 ///---------------------
 // `bdlcc::SingleProducerQueue` is a template that is parameterized on the type
@@ -254,6 +260,16 @@ class SingleProducerQueue {
     /// `e_DISABLED` if `disablePopFront` is invoked.
     int popFront(TYPE* value);
 
+    /// Remove at least one and at most the specified `maxNumItems` elements
+    /// from the front of this queue and assign them, in order, to successive
+    /// positions of the specified `output` iterator.  If the queue is empty,
+    /// block until it is not empty.  Return the number of elements removed,
+    /// or 0 if `isPopFrontDisabled()`.  Threads blocked due to the queue
+    /// being empty will return 0 if `disablePopFront` is invoked.  The
+    /// behavior is undefined unless `0 < maxNumItems`.
+    template <class OUTPUT_ITER>
+    bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.  The behavior is undefined
@@ -268,6 +284,14 @@ class SingleProducerQueue {
     /// method is the single producer.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append the elements in the specified range `[begin .. end)`, in
+    /// order, to the back of this queue.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`.  The behavior is undefined unless the invoker
+    /// of this method is the single producer.
+    template <class INPUT_ITER>
+    int pushBackMany(INPUT_ITER begin, INPUT_ITER end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -282,6 +306,14 @@ class SingleProducerQueue {
     /// the queue was empty.  On failure, `value` is not changed.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove, without blocking, up to the specified
+    /// `maxNumItems` elements from the front of this queue and assign them,
+    /// in order, to successive positions of the specified `output`
+    /// iterator.  Return the number of elements removed, which is 0 if
+    /// `isPopFrontDisabled()` or the queue was empty.
+    template <class OUTPUT_ITER>
+    bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.  The behavior is undefined
@@ -388,6 +420,14 @@ int SingleProducerQueue<TYPE>::popFront(TYPE *value)
     return d_impl.popFront(value);
 }
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+bsl::size_t SingleProducerQueue<TYPE>::popFrontMany(bsl::size_t maxNumItems,
+                                                    OUTPUT_ITER output)
+{
+    return d_impl.popFrontMany(maxNumItems, output);
+}
+
 template <class TYPE>
 int SingleProducerQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -400,6 +440,13 @@ int SingleProducerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class INPUT_ITER>
+int SingleProducerQueue<TYPE>::pushBackMany(INPUT_ITER begin, INPUT_ITER end)
+{
+    return d_impl.pushBackMany(begin, end);
+}
+
 template <class TYPE>
 void SingleProducerQueue<TYPE>::removeAll()
 {
@@ -412,6 +459,14 @@ int SingleProducerQueue<TYPE>::tryPopFront(TYPE *value)
     return d_impl.tryPopFront(value);
 }
 
+template <class TYPE>
+template <class OUTPUT_ITER>
+bsl::size_t SingleProducerQueue<TYPE>::tryPopFrontUpTo(bsl::size_t maxNumItems,
+                                                       OUTPUT_ITER output)
+{
+    return d_impl.tryPopFrontUpTo(maxNumItems, output);
+}
+
 template <class TYPE>
 int SingleProducerQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -23,6 +23,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -30,9 +31,11 @@
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_format.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
@@ -81,10 +84,13 @@ using namespace bsl;
 // [ 5] SingleProducerQueue(capacity, *bA = 0);
 // [ 2] ~SingleProducerQueue();
 // [ 2] int popFront(TYPE *value);
+// [13] bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBackMany(INPUT_ITER begin, INPUT_ITER end);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
 // [ 6] void disablePopFront();
@@ -100,7 +106,8 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
+// [-1] BATCH OPERATIONS BENCHMARK
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -733,6 +740,101 @@ OBJ& gg(OBJ *object, const char *spec)
     return *object;
 }
 
+namespace Case13 {
+
+/// Push the values `[0 .. numValues)` to the specified `queue` using
+/// `pushBack` if the specified `batchSize` is 0, and using `pushBackMany`
+/// with ranges of `batchSize` elements otherwise.
+void producer(Obj *queue, int numValues, int batchSize)
+{
+    if (0 == batchSize) {
+        for (int i = 0; i < numValues; ++i) {
+            ASSERT(e_SUCCESS == queue->pushBack(i));
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> values(batchSize);
+
+    for (int i = 0; i < numValues; i += batchSize) {
+        int num = bsl::min(batchSize, numValues - i);
+        for (int j = 0; j < num; ++j) {
+            values[j] = i + j;
+        }
+        ASSERT(e_SUCCESS == queue->pushBackMany(values.begin(),
+                                                values.begin() + num));
+    }
+}
+
+/// Remove elements from the specified `queue`, using `popFront` if the
+/// specified `batchSize` is 0 and using `popFrontMany` with batches of up to
+/// `batchSize` elements otherwise, until the queue is dequeue disabled, and
+/// add the number of elements removed to the specified `numPopped`.
+void consumer(Obj *queue, int batchSize, bsls::AtomicInt *numPopped)
+{
+    int count = 0;
+
+    if (0 == batchSize) {
+        int value;
+        while (e_SUCCESS == queue->popFront(&value)) {
+            ++count;
+        }
+    }
+    else {
+        bsl::vector<int> values(batchSize);
+
+        bsl::size_t num;
+        while (0 != (num = queue->popFrontMany(batchSize, values.begin()))) {
+            count += static_cast<int>(num);
+        }
+    }
+
+    numPopped->add(count);
+}
+
+/// Transfer `numValues` elements through the specified `queue` from each of
+/// the specified `numProducers` threads to the specified `numConsumers`
+/// threads, using the single-element methods if the specified `batchSize` is
+/// 0 and the batch methods otherwise, and verify every element is removed.
+void transfer(Obj *queue,
+              int  numProducers,
+              int  numConsumers,
+              int  numValues,
+              int  batchSize)
+{
+    bsls::AtomicInt numPopped(0);
+
+    bslmt::ThreadGroup producers;
+    bslmt::ThreadGroup consumers;
+
+    for (int i = 0; i < numConsumers; ++i) {
+        consumers.addThread(bdlf::BindUtil::bind(&consumer,
+                                                 queue,
+                                                 batchSize,
+                                                 &numPopped));
+    }
+    for (int i = 0; i < numProducers; ++i) {
+        producers.addThread(bdlf::BindUtil::bind(&producer,
+                                                 queue,
+                                                 numValues,
+                                                 batchSize));
+    }
+
+    producers.joinAll();
+
+    ASSERT(0 == queue->waitUntilEmpty());
+
+    queue->disablePopFront();
+
+    consumers.joinAll();
+
+    queue->enablePopFront();
+
+    ASSERTV(numPopped, numProducers * numValues == numPopped);
+}
+
+}  // close namespace Case13
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -867,7 +969,7 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -893,6 +995,90 @@ int main(int argc, char *argv[])
 
         myProducer(k_NUM_THREADS);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //   Ensure the batch methods forward to the implementation.
+        //
+        // Concerns:
+        // 1. `pushBackMany` appends the range, in order, to the queue.
+        //
+        // 2. `popFrontMany` and `tryPopFrontUpTo` remove, in order, no more
+        //    than the requested number of elements and return the number of
+        //    elements removed.
+        //
+        // 3. The methods honor the disabled states of the queue.
+        //
+        // 4. A batch insertion by the single producer is delivered exactly
+        //    once to multiple consumers using `popFrontMany`.
+        //
+        // Plan:
+        // 1. Directly verify the results of a sequence of batch operations,
+        //    including on a disabled queue.  (C-1..3)
+        //
+        // 2. Transfer elements from the single producer to multiple
+        //    consumers with the batch methods, and verify every element is
+        //    removed.  (C-4)
+        //
+        // Testing:
+        //   bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER);
+        //   int pushBackMany(INPUT_ITER begin, INPUT_ITER end);
+        //   bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            const int VALUES[] = { 1, 2, 3, 4, 5 };
+
+            int values[5] = { 0 };
+
+            ASSERT(0 == mX.tryPopFrontUpTo(5, values));
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + 5));
+            ASSERT(5 == X.numElements());
+
+            ASSERT(2 == mX.tryPopFrontUpTo(2, values));
+            ASSERT(1 == values[0]);
+            ASSERT(2 == values[1]);
+
+            bsl::vector<int> result;
+
+            ASSERT(3 == mX.popFrontMany(5, bsl::back_inserter(result)));
+            ASSERT(3 == result.size());
+            ASSERT(3 == result[0]);
+            ASSERT(5 == result[2]);
+            ASSERT(X.isEmpty());
+
+            mX.disablePushBack();
+            ASSERT(e_DISABLED == mX.pushBackMany(VALUES, VALUES + 5));
+            ASSERT(X.isEmpty());
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + 5));
+
+            mX.disablePopFront();
+            ASSERT(0 == mX.popFrontMany(5, values));
+            ASSERT(0 == mX.tryPopFrontUpTo(5, values));
+            ASSERT(5 == X.numElements());
+            mX.enablePopFront();
+        }
+        {
+            const int BATCH_SIZES[]   = { 1, 16 };
+            const int NUM_BATCH_SIZES = sizeof BATCH_SIZES
+                                                         / sizeof *BATCH_SIZES;
+
+            for (int i = 0; i < NUM_BATCH_SIZES; ++i) {
+                Obj mX;
+
+                Case13::transfer(&mX, 1, 2, 10000, BATCH_SIZES[i]);
+            }
+        }
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
@@ -2561,6 +2747,71 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS BENCHMARK
+        //
+        // Concerns:
+        // 1. The batch methods provide higher throughput than the
+        //    single-element methods when transferring many elements.
+        //
+        // Plan:
+        // 1. For several thread configurations, transfer a fixed number of
+        //    elements using `pushBack`/`popFront` and using
+        //    `pushBackMany`/`popFrontMany` with several batch sizes, and
+        //    report the throughput of each run in CSV format.  (C-1)
+        //
+        // Testing:
+        //   BATCH OPERATIONS BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS BENCHMARK" << endl
+                          << "==========================" << endl;
+
+        const int numValues = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        const int CONFIGS[][2] = { { 1, 1 }, { 1, 4 } };
+        const int NUM_CONFIGS  = sizeof CONFIGS / sizeof *CONFIGS;
+
+        const int BATCH_SIZES[] = { 0, 4, 16, 64 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        cout << "producers,consumers,method,batch,seconds,elements_per_second"
+             << endl;
+
+        for (int ci = 0; ci < NUM_CONFIGS; ++ci) {
+            const int NUM_PRODUCERS = CONFIGS[ci][0];
+            const int NUM_CONSUMERS = CONFIGS[ci][1];
+
+            for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+                const int BATCH_SIZE = BATCH_SIZES[bi];
+
+                Obj mX(1024);
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                Case13::transfer(&mX,
+                                 NUM_PRODUCERS,
+                                 NUM_CONSUMERS,
+                                 numValues / NUM_PRODUCERS,
+                                 BATCH_SIZE);
+
+                timer.stop();
+
+                const double seconds = timer.elapsedTime();
+
+                cout << NUM_PRODUCERS << ','
+                     << NUM_CONSUMERS << ','
+                     << (BATCH_SIZE ? "batch" : "single") << ','
+                     << (BATCH_SIZE ? BATCH_SIZE : 1) << ','
+                     << seconds << ','
+                     << static_cast<bsls::Types::Int64>(numValues / seconds)
+                     << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
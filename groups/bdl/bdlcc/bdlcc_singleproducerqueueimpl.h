@@ -168,6 +168,85 @@ class SingleProducerQueueImpl_PopCompleteGuard {
     ~SingleProducerQueueImpl_PopCompleteGuard();
 };
 
+           // ===================================================
+           // class SingleProducerQueueImpl_PushManyCompleteGuard
+           // ===================================================
+
+/// This class implements a guard that invokes `TYPE::pushManyComplete` upon
+/// destruction with the number of elements written by a batch insertion.
+template <class TYPE>
+class SingleProducerQueueImpl_PushManyCompleteGuard {
+
+    // DATA
+    TYPE        *d_queue_p;    // managed queue
+    bsl::size_t  d_numPushed;  // number of written elements
+
+  private:
+    // NOT IMPLEMENTED
+    SingleProducerQueueImpl_PushManyCompleteGuard();
+    SingleProducerQueueImpl_PushManyCompleteGuard(
+                         const SingleProducerQueueImpl_PushManyCompleteGuard&);
+    SingleProducerQueueImpl_PushManyCompleteGuard& operator=(
+                         const SingleProducerQueueImpl_PushManyCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `pushManyComplete` guard managing the specified `queue`.
+    explicit
+    SingleProducerQueueImpl_PushManyCompleteGuard(TYPE *queue);
+
+    /// Destroy this object and invoke the `TYPE::pushManyComplete` method
+    /// with the number of written elements.
+    ~SingleProducerQueueImpl_PushManyCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Count one more element as written.
+    void pushComplete();
+};
+
+             // ===============================================
+             // class SingleProducerQueueImpl_UnreserveProctor
+             // ===============================================
+
+/// This class implements a proctor that invokes `TYPE::unreserve` upon
+/// destruction with the number of elements, reserved by a batch removal,
+/// that remain under management.
+template <class TYPE>
+class SingleProducerQueueImpl_UnreserveProctor {
+
+    // DATA
+    TYPE        *d_queue_p;      // managed queue
+    bsl::size_t  d_numReserved;  // number of managed reserved elements
+
+  private:
+    // NOT IMPLEMENTED
+    SingleProducerQueueImpl_UnreserveProctor();
+    SingleProducerQueueImpl_UnreserveProctor(
+                              const SingleProducerQueueImpl_UnreserveProctor&);
+    SingleProducerQueueImpl_UnreserveProctor& operator=(
+                              const SingleProducerQueueImpl_UnreserveProctor&);
+
+  public:
+    // CREATORS
+
+    /// Create an `unreserve` proctor managing the specified `numReserved`
+    /// elements reserved from the specified `queue`.
+    SingleProducerQueueImpl_UnreserveProctor(TYPE        *queue,
+                                             bsl::size_t  numReserved);
+
+    /// Destroy this object and, if any reserved elements remain under
+    /// management, invoke the `TYPE::unreserve` method with their number.
+    ~SingleProducerQueueImpl_UnreserveProctor();
+
+    // MANIPULATORS
+
+    /// Release one reserved element from management.  The behavior is
+    /// undefined unless at least one reserved element is managed.
+    void releaseOne();
+};
+
                       // =============================
                       // class SingleProducerQueueImpl
                       // =============================
@@ -262,6 +341,18 @@ class SingleProducerQueueImpl {
                                                                   MUTEX,
                                                                   CONDITION> >;
 
+    friend class SingleProducerQueueImpl_PushManyCompleteGuard<
+                                          SingleProducerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
+    friend class SingleProducerQueueImpl_UnreserveProctor<
+                                          SingleProducerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
     friend class SingleProducerQueueImpl_PopCompleteGuard<
                            SingleProducerQueueImpl<TYPE,
                                                    ATOMIC_OP,
@@ -321,11 +412,40 @@ class SingleProducerQueueImpl {
     /// signal the queue empty condition.
     void popFrontRaw(TYPE* value, bool isEmpty);
 
+    /// Remove the specified `num` elements, previously reserved by the
+    /// invoking thread, from the front of this queue and assign them, in
+    /// order, to successive positions of the specified `output` iterator.
+    /// If the specified `isEmpty` is `true` then signal the queue empty
+    /// condition after the last element is removed.
+    template <class OUTPUT_ITER>
+    void popFrontManyRaw(bsl::size_t num, OUTPUT_ITER output, bool isEmpty);
+
+    /// Make the specified `numPushed` elements, already written by the
+    /// single producer, available to consumers, and signal a thread blocked
+    /// in a dequeue operation if appropriate.  This method is used within
+    /// `pushBackMany` by a guard, and is also correct in the presence of an
+    /// exception.
+    void pushManyComplete(bsl::size_t numPushed);
+
     /// Return all memory to the allocator.  This method is intended to be
     /// used by the destructor and to avoid a memory leak when there is an
     /// exception during construction.
     void releaseAllRaw();
 
+    /// Reserve, for the invoking thread, up to the specified `maxNumItems`
+    /// available elements that are not needed to supply the threads blocked
+    /// in a dequeue operation, load the resultant state of this queue into
+    /// the specified `state`, and return the number of elements reserved.
+    /// If no element is reserved, `state` is not modified.
+    bsl::size_t reserveUpTo(bsl::size_t         maxNumItems,
+                            bsls::Types::Int64 *state);
+
+    /// Return the specified `num` elements, reserved but not removed by the
+    /// invoking thread, to this queue and signal a thread blocked in a
+    /// dequeue operation if appropriate.  This method is used within
+    /// `popFrontManyRaw` by a proctor in the presence of an exception.
+    void unreserve(bsl::size_t num);
+
   private:
     // NOT IMPLEMENTED
     SingleProducerQueueImpl(const SingleProducerQueueImpl&);
@@ -374,6 +494,20 @@ class SingleProducerQueueImpl {
     /// `e_DISABLED` if `disablePopFront` is invoked.
     int popFront(TYPE *value);
 
+    /// Remove at least one and at most the specified `maxNumItems` elements
+    /// from the front of this queue and assign them, in order, to successive
+    /// positions of the specified `output` iterator.  If the queue is empty,
+    /// block until it is not empty.  Return the number of elements removed,
+    /// or 0 if `isPopFrontDisabled()`.  Threads blocked due to the queue
+    /// being empty will return 0 if `disablePopFront` is invoked.  The
+    /// behavior is undefined unless `0 < maxNumItems`.  Note that the
+    /// elements are reserved with a single update of the queue state.  Also
+    /// note that if an exception is thrown while assigning to `output`, the
+    /// element being assigned is removed from this queue, and the remaining
+    /// reserved elements are returned to the queue.
+    template <class OUTPUT_ITER>
+    bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.  The behavior is undefined
@@ -388,6 +522,18 @@ class SingleProducerQueueImpl {
     /// method is the single producer.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append the elements in the specified range `[begin .. end)`, in
+    /// order, to the back of this queue.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`.  The behavior is undefined unless the invoker
+    /// of this method is the single producer.  Note that the appended
+    /// elements are made available to consumers, and a blocked consumer is
+    /// signalled, once for the range rather than once per element.  Also
+    /// note that the items in the range are treated as `const` objects,
+    /// copied without being modified.
+    template <class INPUT_ITER>
+    int pushBackMany(INPUT_ITER begin, INPUT_ITER end);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -402,6 +548,18 @@ class SingleProducerQueueImpl {
     /// the queue was empty.  On failure, `value` is not changed.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove, without blocking, up to the specified
+    /// `maxNumItems` elements from the front of this queue and assign them,
+    /// in order, to successive positions of the specified `output`
+    /// iterator.  Return the number of elements removed, which is 0 if
+    /// `isPopFrontDisabled()` or the queue was empty.  Note that the
+    /// elements are reserved with a single update of the queue state.  Also
+    /// note that if an exception is thrown while assigning to `output`, the
+    /// element being assigned is removed from this queue, and the remaining
+    /// reserved elements are returned to the queue.
+    template <class OUTPUT_ITER>
+    bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER output);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.  The behavior is undefined
@@ -531,6 +689,67 @@ SingleProducerQueueImpl_PopCompleteGuard<TYPE, NODE>::
     d_queue_p->popComplete(d_node_p, d_isEmpty);
 }
 
+           // ---------------------------------------------------
+           // class SingleProducerQueueImpl_PushManyCompleteGuard
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleProducerQueueImpl_PushManyCompleteGuard<TYPE>::
+                     SingleProducerQueueImpl_PushManyCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+SingleProducerQueueImpl_PushManyCompleteGuard<TYPE>::
+                               ~SingleProducerQueueImpl_PushManyCompleteGuard()
+{
+    d_queue_p->pushManyComplete(d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleProducerQueueImpl_PushManyCompleteGuard<TYPE>::pushComplete()
+{
+    ++d_numPushed;
+}
+
+             // -----------------------------------------------
+             // class SingleProducerQueueImpl_UnreserveProctor
+             // -----------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleProducerQueueImpl_UnreserveProctor<TYPE>::
+                SingleProducerQueueImpl_UnreserveProctor(TYPE        *queue,
+                                                         bsl::size_t  numRsvd)
+: d_queue_p(queue)
+, d_numReserved(numRsvd)
+{
+}
+
+template <class TYPE>
+SingleProducerQueueImpl_UnreserveProctor<TYPE>::
+                                    ~SingleProducerQueueImpl_UnreserveProctor()
+{
+    if (d_numReserved) {
+        d_queue_p->unreserve(d_numReserved);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleProducerQueueImpl_UnreserveProctor<TYPE>::releaseOne()
+{
+    BSLS_ASSERT(0 < d_numReserved);
+
+    --d_numReserved;
+}
+
                       // -----------------------------
                       // class SingleProducerQueueImpl
                       // -----------------------------
@@ -653,6 +872,83 @@ void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 #endif
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class OUTPUT_ITER>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                      popFrontManyRaw(bsl::size_t num,
+                                                      OUTPUT_ITER output,
+                                                      bool        isEmpty)
+{
+    SingleProducerQueueImpl_UnreserveProctor<
+                                          SingleProducerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >
+                                                          proctor(this, num);
+
+    for (bsl::size_t i = 0; i < num; ++i) {
+        Node *readFrom =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+
+        Node *exp;
+        do {
+            Node *next =
+              static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&readFrom->d_next));
+
+            exp      = readFrom;
+            readFrom = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                   &d_nextRead,
+                                                                   readFrom,
+                                                                   next));
+        } while (readFrom != exp);
+
+        proctor.releaseOne();
+
+        SingleProducerQueueImpl_PopCompleteGuard<
+                                          SingleProducerQueueImpl <TYPE,
+                                                                   ATOMIC_OP,
+                                                                   MUTEX,
+                                                                   CONDITION>,
+                                          Node> guard(this,
+                                                      readFrom,
+                                                      isEmpty && i + 1 == num);
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        *output = bslmf::MovableRefUtil::move(readFrom->d_value.object());
+#else
+        *output = readFrom->d_value.object();
+#endif
+        ++output;
+    }
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                        pushManyComplete(bsl::size_t numPushed)
+{
+    if (0 == numPushed) {
+        return;                                                       // RETURN
+    }
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                          &d_state,
+                          k_AVAILABLE_INC
+                                * static_cast<bsls::Types::Int64>(numPushed));
+
+    // Signal only if no element was available to the blocked threads before
+    // this update; a thread that is awoken signals the next blocked thread if
+    // elements remain (see 'popFront').
+
+    if (   canSupplyBlockedThread(state)
+        && getAvailable(state)
+                              <= static_cast<bsls::Types::Int64>(numPushed)) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
                                                                 releaseAllRaw()
@@ -683,6 +979,56 @@ void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+bsl::size_t SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                   reserveUpTo(bsl::size_t         maxNumItems,
+                                               bsls::Types::Int64 *state)
+{
+    bsls::Types::Int64 currentState = ATOMIC_OP::getInt64Acquire(&d_state);
+    bsls::Types::Int64 expState;
+    bsls::Types::Int64 newState;
+    bsls::Types::Int64 num;
+
+    do {
+        // Elements needed to supply the blocked threads may not be reserved.
+
+        num = getAvailable(currentState) - (currentState & k_BLOCKED_MASK);
+        if (0 >= num) {
+            return 0;                                                 // RETURN
+        }
+        if (static_cast<bsls::Types::Int64>(maxNumItems) < num) {
+            num = static_cast<bsls::Types::Int64>(maxNumItems);
+        }
+
+        expState     = currentState;
+        newState     = currentState - k_AVAILABLE_INC * num;
+        currentState = ATOMIC_OP::testAndSwapInt64AcqRel(&d_state,
+                                                         currentState,
+                                                         newState);
+    } while (currentState != expState);
+
+    *state = newState;
+
+    return static_cast<bsl::size_t>(num);
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                                   unreserve(bsl::size_t num)
+{
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                                &d_state,
+                                k_AVAILABLE_INC
+                                      * static_cast<bsls::Types::Int64>(num));
+
+    if (canSupplyBlockedThread(state)) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
 // CREATORS
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
@@ -834,6 +1180,68 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class OUTPUT_ITER>
+bsl::size_t SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                        popFrontMany(bsl::size_t maxNumItems,
+                                                     OUTPUT_ITER output)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    // Acquire the first element exactly as 'popFront' does.
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(&d_state,
+                                                           -k_AVAILABLE_INC);
+
+    if (willHaveBlockedThread(state)) {
+        bslmt::ThreadUtil::yield();
+        state = ATOMIC_OP::getInt64Acquire(&d_state);
+        if (willHaveBlockedThread(state)) {
+            {
+                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+
+                state = ATOMIC_OP::addInt64NvAcqRel(
+                                              &d_state,
+                                              k_AVAILABLE_INC + k_BLOCKED_INC);
+
+                while (isEmpty(state)) {
+                    if (generation !=
+                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
+                        ATOMIC_OP::addInt64AcqRel(&d_state, -k_BLOCKED_INC);
+                        return 0;                                     // RETURN
+                    }
+                    d_readCondition.wait(&d_readMutex);
+                    state = ATOMIC_OP::getInt64Acquire(&d_state);
+                }
+
+                state = ATOMIC_OP::addInt64NvAcqRel(
+                                           &d_state,
+                                           -(k_AVAILABLE_INC + k_BLOCKED_INC));
+            }
+            if (canSupplyBlockedThread(state)) {
+                d_readCondition.signal();
+            }
+        }
+    }
+
+    // Reserve the remaining elements with one update of 'd_state'.
+
+    bsl::size_t num = 1;
+
+    if (1 < maxNumItems) {
+        num += reserveUpTo(maxNumItems - 1, &state);
+    }
+
+    popFrontManyRaw(num, output, isEmpty(state));
+
+    return num;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
                                                              const TYPE& value)
@@ -968,6 +1376,28 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class OUTPUT_ITER>
+bsl::size_t SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                     tryPopFrontUpTo(bsl::size_t maxNumItems,
+                                                     OUTPUT_ITER output)
+{
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1) || 0 == maxNumItems) {
+        return 0;                                                     // RETURN
+    }
+
+    bsls::Types::Int64 state;
+
+    bsl::size_t num = reserveUpTo(maxNumItems, &state);
+
+    if (num) {
+        popFrontManyRaw(num, output, isEmpty(state));
+    }
+
+    return num;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -982,6 +1412,57 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
     return pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class INPUT_ITER>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBackMany(
+                                                              INPUT_ITER begin,
+                                                              INPUT_ITER end)
+{
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    // The elements are written as in 'pushBack', but 'd_state' is updated,
+    // and a blocked consumer signalled, once by the guard.
+
+    SingleProducerQueueImpl_PushManyCompleteGuard<
+                              SingleProducerQueueImpl<TYPE,
+                                                      ATOMIC_OP,
+                                                      MUTEX,
+                                                      CONDITION> > guard(this);
+
+    for (; begin != end; ++begin) {
+        Node *nextWrite = static_cast<Node *>(
+                                       ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+
+        Node *next = static_cast<Node *>(
+                                 ATOMIC_OP::getPtrAcquire(&nextWrite->d_next));
+
+        if (e_WRITABLE != ATOMIC_OP::getIntAcquire(&next->d_state)) {
+            Node *n = static_cast<Node *>(
+                                      d_allocator_p->allocate(sizeof(Node)));
+
+            ATOMIC_OP::initInt(&n->d_state, e_WRITABLE);
+            ATOMIC_OP::initPointer(&n->d_next, next);
+
+            ATOMIC_OP::setPtrRelease(&nextWrite->d_next, n);
+
+            next = n;
+        }
+
+        bslalg::ScalarPrimitives::copyConstruct(nextWrite->d_value.address(),
+                                                *begin,
+                                                d_allocator_p);
+
+        ATOMIC_OP::setIntRelease(&nextWrite->d_state, e_READABLE);
+        ATOMIC_OP::setPtrRelease(&d_nextWrite, next);
+
+        guard.pushComplete();
+    }
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -27,9 +27,11 @@
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_format.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
@@ -78,10 +80,13 @@ using namespace bsl;
 // [ 5] SingleProducerQueueImpl(capacity, *bA = 0);
 // [ 2] ~SingleProducerQueueImpl();
 // [ 2] int popFront(TYPE *value);
+// [14] bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [14] int pushBackMany(INPUT_ITER begin, INPUT_ITER end);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [14] bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
 // [ 6] void disablePopFront();
@@ -104,6 +109,7 @@ using namespace bsl;
 // [11] CONCERN: template requirements
 // [12] CONCERN: ordering guarantee
 // [13] CONCERN: `numElements` is not lower-bound due to `tryPopFront`
+// [14] CONCERN: batch operations preserve the ordering guarantee
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -957,6 +963,108 @@ extern "C" void *tryPopFront(void *arg)
 
 } // close namespace Case13
 
+namespace Case14 {
+
+const int k_NUM_VALUES = 20000;  // number of values pushed by the producer
+
+struct PopManyData {
+    Obj              *d_obj_p;      // queue under test
+    bsl::size_t       d_batchSize;  // maximum number of elements per pop
+    bsl::vector<int>  d_values;     // values popped by this thread
+};
+
+extern "C" void *popFrontMany(void *arg)
+{
+    PopManyData *data = static_cast<PopManyData *>(arg);
+    Obj&         mX   = *data->d_obj_p;
+
+    bsl::vector<int> values(data->d_batchSize);
+
+    while (true) {
+        bsl::size_t num = mX.popFrontMany(data->d_batchSize, values.begin());
+        if (0 == num) {
+            break;
+        }
+        data->d_values.insert(data->d_values.end(),
+                              values.begin(),
+                              values.begin() + num);
+    }
+
+    return 0;
+}
+
+extern "C" void *popFrontManyOnce(void *arg)
+{
+    PopManyData *data = static_cast<PopManyData *>(arg);
+    Obj&         mX   = *data->d_obj_p;
+
+    bsl::vector<int> values(data->d_batchSize);
+
+    bsl::size_t num = mX.popFrontMany(data->d_batchSize, values.begin());
+
+    data->d_values.assign(values.begin(), values.begin() + num);
+
+    return 0;
+}
+
+/// Push `k_NUM_VALUES` increasing values to the specified `obj` in batches
+/// of the specified `batchSize` while the specified `numPopThread` threads
+/// remove elements with `popFrontMany` using the same `batchSize`, and verify
+/// that every value is removed exactly once and that the values removed by
+/// each thread are increasing.
+void batchOrderingTest(Obj *obj, int numPopThread, bsl::size_t batchSize)
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> popHandle(numPopThread);
+    bsl::vector<PopManyData>               popData(numPopThread);
+
+    for (int i = 0; i < numPopThread; ++i) {
+        popData[i].d_obj_p     = obj;
+        popData[i].d_batchSize = batchSize;
+        bslmt::ThreadUtil::create(&popHandle[i], popFrontMany, &popData[i]);
+    }
+
+    bsl::vector<int> values(batchSize);
+
+    for (int i = 0; i < k_NUM_VALUES; i += static_cast<int>(batchSize)) {
+        bsl::size_t num = bsl::min(batchSize,
+                                   static_cast<bsl::size_t>(k_NUM_VALUES - i));
+        for (bsl::size_t j = 0; j < num; ++j) {
+            values[j] = i + static_cast<int>(j);
+        }
+        ASSERT(e_SUCCESS == obj->pushBackMany(values.begin(),
+                                              values.begin() + num));
+    }
+
+    ASSERT(0 == obj->waitUntilEmpty());
+
+    obj->disablePopFront();
+
+    for (int i = 0; i < numPopThread; ++i) {
+        bslmt::ThreadUtil::join(popHandle[i]);
+    }
+
+    obj->enablePopFront();
+
+    bsl::vector<int> count(k_NUM_VALUES, 0);
+
+    for (int i = 0; i < numPopThread; ++i) {
+        const bsl::vector<int>& v = popData[i].d_values;
+        for (bsl::size_t j = 0; j < v.size(); ++j) {
+            ASSERTV(batchSize, i, j, 0 == j || v[j - 1] < v[j]);
+            ++count[v[j]];
+        }
+        if (1 == numPopThread) {
+            ASSERTV(batchSize, v.size(), k_NUM_VALUES == v.size());
+        }
+    }
+
+    for (int i = 0; i < k_NUM_VALUES; ++i) {
+        ASSERTV(batchSize, i, count[i], 1 == count[i]);
+    }
+}
+
+} // close namespace Case14
+
 // ============================================================================
 //               GENERATOR FUNCTIONS `gg` AND `ggg` FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1079,6 +1187,254 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //   Ensure `pushBackMany`, `popFrontMany`, and `tryPopFrontUpTo`
+        //   operate as expected.
+        //
+        // Concerns:
+        // 1. `pushBackMany` appends the range, in order, to the queue.
+        //
+        // 2. `popFrontMany` and `tryPopFrontUpTo` remove, in order, no more
+        //    than the requested number of elements, write them to the output
+        //    iterator, and return the number of elements removed.
+        //
+        // 3. `tryPopFrontUpTo` returns 0 when the queue is empty or when
+        //    `0 == maxNumItems`, and `popFrontMany` blocks until an element is
+        //    available.
+        //
+        // 4. The methods honor the disabled states of the queue, and a thread
+        //    blocked in `popFrontMany` returns 0 when `disablePopFront` is
+        //    invoked.
+        //
+        // 5. Concurrent batch removal delivers every element exactly once and
+        //    preserves the ordering guarantee.
+        //
+        // 6. The methods are exception neutral, and an exception leaves the
+        //    queue in a consistent state.
+        //
+        // Plan:
+        // 1. Directly verify the results of a sequence of batch operations on
+        //    a queue in a single thread.  (C-1..3)
+        //
+        // 2. Verify the return values of the methods when the queue is
+        //    disabled, and use a thread blocked in `popFrontMany` to verify
+        //    it is awoken both by `pushBackMany` and by `disablePopFront`.
+        //    (C-3..4)
+        //
+        // 3. Push increasing values in batches while a varying number of
+        //    threads remove elements with `popFrontMany`, and verify each
+        //    value is removed exactly once and in increasing order per
+        //    thread.  (C-5)
+        //
+        // 4. Using an element type that allocates on copy and assignment,
+        //    inject exceptions and verify the number of elements in the queue
+        //    and that no memory is leaked.  (C-6)
+        //
+        // Testing:
+        //   bsl::size_t popFrontMany(bsl::size_t maxNumItems, OUTPUT_ITER);
+        //   int pushBackMany(INPUT_ITER begin, INPUT_ITER end);
+        //   bsl::size_t tryPopFrontUpTo(bsl::size_t maxNumItems, OUTPUT_ITER);
+        //   CONCERN: batch operations preserve the ordering guarantee
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded behavior." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            const int VALUES[]   = { 1, 2, 3, 4, 5 };
+            const int NUM_VALUES = static_cast<int>(sizeof VALUES
+                                                    / sizeof *VALUES);
+
+            int values[NUM_VALUES] = { 0 };
+
+            ASSERT(0 == mX.tryPopFrontUpTo(3, values));
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES));
+            ASSERT(0 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + NUM_VALUES));
+            ASSERT(NUM_VALUES == X.numElements());
+
+            ASSERT(0 == mX.tryPopFrontUpTo(0, values));
+            ASSERT(3 == mX.tryPopFrontUpTo(3, values));
+            ASSERT(1 == values[0]);
+            ASSERT(2 == values[1]);
+            ASSERT(3 == values[2]);
+            ASSERT(2 == X.numElements());
+
+            ASSERT(2 == mX.popFrontMany(NUM_VALUES, values));
+            ASSERT(4 == values[0]);
+            ASSERT(5 == values[1]);
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + NUM_VALUES));
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + 2));
+            ASSERT(7 == X.numElements());
+
+            ASSERT(1 == mX.popFrontMany(1, values));
+            ASSERT(1 == values[0]);
+
+            bsl::vector<int> result;
+
+            ASSERT(6 == mX.tryPopFrontUpTo(10, bsl::back_inserter(result)));
+            ASSERT(6 == result.size());
+            ASSERT(2 == result[0]);
+            ASSERT(5 == result[3]);
+            ASSERT(1 == result[4]);
+            ASSERT(2 == result[5]);
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.waitUntilEmpty());
+        }
+
+        if (verbose) cout << "\nDisabled states and blocking." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            const int VALUES[] = { 1, 2, 3, 4 };
+
+            int values[4] = { 0 };
+
+            mX.disablePushBack();
+            ASSERT(e_DISABLED == mX.pushBackMany(VALUES, VALUES + 4));
+            ASSERT(0 == X.numElements());
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + 4));
+
+            mX.disablePopFront();
+            ASSERT(0 == mX.popFrontMany(4, values));
+            ASSERT(0 == mX.tryPopFrontUpTo(4, values));
+            ASSERT(4 == X.numElements());
+            mX.enablePopFront();
+
+            mX.removeAll();
+
+            Case14::PopManyData data;
+
+            data.d_obj_p     = &mX;
+            data.d_batchSize = 4;
+
+            bslmt::ThreadUtil::Handle handle;
+
+            bslmt::ThreadUtil::create(&handle,
+                                      Case14::popFrontManyOnce,
+                                      &data);
+
+            bslmt::ThreadUtil::microSleep(100000);
+
+            ASSERT(e_SUCCESS == mX.pushBackMany(VALUES, VALUES + 4));
+
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(1 <= data.d_values.size());
+            ASSERT(4 == data.d_values.size() + X.numElements());
+            ASSERT(1 == data.d_values[0]);
+
+            mX.removeAll();
+
+            bslmt::ThreadUtil::create(&handle, deferredDisablePopFront, &mX);
+
+            ASSERT(0 == mX.popFrontMany(4, values));
+
+            bslmt::ThreadUtil::join(handle);
+        }
+
+        if (verbose) cout << "\nConcurrent batch removal." << endl;
+        {
+            const bsl::size_t BATCH_SIZES[] = { 1, 3, 16, 100 };
+            const int         NUM_BATCH_SIZES =
+                   static_cast<int>(sizeof BATCH_SIZES / sizeof *BATCH_SIZES);
+
+            for (int numPopThread = 1; numPopThread <= 4; numPopThread *= 2) {
+                for (int i = 0; i < NUM_BATCH_SIZES; ++i) {
+                    if (veryVerbose) {
+                        T_ P_(numPopThread) P(BATCH_SIZES[i]);
+                    }
+
+                    Obj mX;
+
+                    Case14::batchOrderingTest(&mX,
+                                              numPopThread,
+                                              BATCH_SIZES[i]);
+                }
+            }
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException neutrality." << endl;
+        {
+            typedef bdlcc::SingleProducerQueueImpl<AllocExceptionHelper,
+                                                   bsls::AtomicOperations,
+                                                   bslmt::Mutex,
+                                                   bslmt::Condition> HObj;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            {
+                HObj mX(&sa);  const HObj& X = mX;
+
+                bsl::vector<AllocExceptionHelper> values(
+                                                   3,
+                                                   AllocExceptionHelper(&sa),
+                                                   &sa);
+
+                // Inject an exception while the range is being copied; the
+                // elements copied before the exception remain in the queue.
+
+                int numException = 0;
+
+                sa.setAllocationLimit(2);
+                try {
+                    mX.pushBackMany(values.begin(), values.end());
+                } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                    ++numException;
+                }
+                sa.setAllocationLimit(-1);
+
+                const bsl::size_t NUM_PUSHED = X.numElements();
+
+                ASSERT(1 == numException);
+                ASSERTV(NUM_PUSHED, 3 > NUM_PUSHED);
+
+                ASSERT(e_SUCCESS == mX.pushBackMany(values.begin(),
+                                                    values.end()));
+                ASSERT(NUM_PUSHED + 3 == X.numElements());
+
+                // The assignment of the first element removed throws; that
+                // element is removed and the others are returned to the
+                // queue.
+
+                sa.setAllocationLimit(0);
+                try {
+                    mX.tryPopFrontUpTo(3, values.begin());
+                } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                    ++numException;
+                }
+                sa.setAllocationLimit(-1);
+
+                ASSERT(2 == numException);
+                ASSERT(NUM_PUSHED + 2 == X.numElements());
+
+                bsl::vector<AllocExceptionHelper> result(&sa);
+
+                ASSERT(NUM_PUSHED + 2 == mX.popFrontMany(
+                                                  10,
+                                                  bsl::back_inserter(result)));
+                ASSERT(NUM_PUSHED + 2 == result.size());
+                ASSERT(X.isEmpty());
+                ASSERT(0 == X.waitUntilEmpty());
+            }
+
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+#endif
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // `numElements` IS NOT LOWER_BOUND DUE TO `tryPopFront`
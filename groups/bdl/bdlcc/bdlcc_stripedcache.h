@@ -0,0 +1,698 @@
+// bdlcc_stripedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_STRIPEDCACHE
+#define INCLUDED_BDLCC_STRIPEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an in-process cache partitioned into independent stripes.
+//
+//@CLASSES:
+//  bdlcc::StripedCache: in-process key-value cache with per-stripe locking
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// `bdlcc::StripedCache`, implementing a thread-safe in-memory key-value cache
+// whose items are partitioned, by the hash of their keys, among a fixed
+// number of independent `bdlcc::Cache` objects called "stripes".  Each stripe
+// has its own reader-writer lock, eviction queue, and watermarks, so threads
+// accessing keys in different stripes do not contend with each other.
+//
+// `bdlcc::StripedCache` takes the same template parameters as `bdlcc::Cache`,
+// and provides the same interface, except for the bulk operations and
+// `popFront`, which have no meaningful counterpart when items are spread
+// across several eviction queues.
+//
+///Watermarks and Eviction
+///-----------------------
+// The low and high watermarks supplied at construction apply to the cache as
+// a whole.  Each of the `numStripes()` stripes is given an equal share of
+// them, rounded up, and evicts items from its own eviction queue when its own
+// high watermark is reached.  Eviction is therefore only approximately in the
+// order given by the eviction policy, and the total number of items in the
+// cache may slightly exceed `highWatermark()` (by less than `numStripes()`).
+// For the cache to be effective, the low watermark should be large compared
+// to the number of stripes.
+//
+// The eviction policy is typically `bdlcc::CacheEvictionPolicy::e_CLOCK`,
+// for which a cache hit requires only a read lock on one stripe (see
+// {`bdlcc_cache`|Thread Contention}).
+//
+///Thread Safety
+///-------------
+// `bdlcc::StripedCache` is fully thread-safe (see `bsldoc_glossary`) under
+// the same conditions as `bdlcc::Cache`.  Operations on more than one stripe,
+// such as `size`, `clear`, and `visit`, process the stripes one after the
+// other, and so do not observe (or produce) a consistent snapshot of the
+// whole cache if it is modified concurrently.
+//
+// As with `bdlcc::Cache`, the cache object must not be used in a
+// post-eviction callback; otherwise, a deadlock may result.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Read-Mostly Cache Shared by Many Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that many threads of a service look up instrument descriptions by
+// an integer identifier, and that most lookups find the description in a
+// cache.
+//
+// First, we define a cache of up to 1000 descriptions that uses the CLOCK
+// eviction policy and 8 stripes:
+// ```
+// typedef bdlcc::StripedCache<int, bsl::string> MyCache;
+//
+// MyCache cache(bdlcc::CacheEvictionPolicy::e_CLOCK, 900, 1000, 8, &talloc);
+// assert(8 == cache.numStripes());
+// ```
+// Then, we populate the cache:
+// ```
+// cache.insert(1, "IBM");
+// cache.insert(2, "AAPL");
+// cache.insert(3, "MSFT");
+// assert(3 == cache.size());
+// ```
+// Next, we look up a description.  Only the stripe holding the key is locked,
+// and, with the CLOCK eviction policy, only for reading:
+// ```
+// bsl::shared_ptr<bsl::string> value;
+// int rc = cache.tryGetValue(&value, 2);
+// assert(0      == rc);
+// assert("AAPL" == *value);
+// ```
+// Finally, we remove an item, and observe that looking it up fails:
+// ```
+// rc = cache.erase(3);
+// assert(0 == rc);
+// assert(2 == cache.size());
+//
+// rc = cache.tryGetValue(&value, 3);
+// assert(1 == rc);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                            // ==================
+                            // class StripedCache
+                            // ==================
+
+/// This class represents an in-process key-value store whose items are
+/// partitioned among a number of independently locked `Cache` objects.
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class StripedCache {
+
+  public:
+    // PUBLIC TYPES
+
+    /// Type of each stripe.
+    typedef Cache<KEY, VALUE, HASH, EQUAL>              StripeType;
+
+    /// Shared pointer type pointing to value type.
+    typedef typename StripeType::ValuePtrType           ValuePtrType;
+
+    /// Type of function to call after an item has been evicted from the cache.
+    typedef typename StripeType::PostEvictionCallback   PostEvictionCallback;
+
+    enum {
+        k_DEFAULT_NUM_STRIPES = 16  // default number of stripes
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::vector<bsl::shared_ptr<StripeType> >   StripeVector;
+
+    // DATA
+    StripeVector  d_stripes;        // stripes, each allocated separately so
+                                    // that their locks are (typically) not
+                                    // in the same cache line
+
+    HASH          d_hashFunction;   // hash function, also used to select the
+                                    // stripe of a key
+
+    bsl::size_t   d_lowWatermark;   // low watermark of the whole cache
+
+    bsl::size_t   d_highWatermark;  // high watermark of the whole cache
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the share of the specified `watermark` given to each of the
+    /// specified `numStripes` stripes.
+    static bsl::size_t stripeWatermark(bsl::size_t watermark,
+                                       bsl::size_t numStripes);
+
+    // PRIVATE MANIPULATORS
+
+    /// Create the specified `numStripes` stripes, each using the specified
+    /// `evictionPolicy` and its share of the `lowWatermark` and
+    /// `highWatermark` attributes of this object, and the specified
+    /// `equalFunction`, and allocating memory from the specified
+    /// `basicAllocator`.
+    void createStripes(CacheEvictionPolicy::Enum  evictionPolicy,
+                       bsl::size_t                numStripes,
+                       const EQUAL&               equalFunction,
+                       bslma::Allocator          *basicAllocator);
+
+    /// Return a reference providing modifiable access to the stripe holding
+    /// the specified `key`.
+    StripeType& stripe(const KEY& key);
+
+    // PRIVATE ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the stripe
+    /// holding the specified `key`.
+    const StripeType& stripe(const KEY& key) const;
+
+  private:
+    // NOT IMPLEMENTED
+    StripedCache(const StripedCache&);
+    StripedCache& operator=(const StripedCache&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty LRU cache having no size limit and
+    /// `k_DEFAULT_NUM_STRIPES` stripes.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit StripedCache(bslma::Allocator *basicAllocator = 0);
+
+    /// Create an empty cache using the specified `evictionPolicy`,
+    /// `lowWatermark`, and `highWatermark`, whose items are partitioned
+    /// among the specified `numStripes` stripes, rounded up to a power of
+    /// two.  Optionally specify the `basicAllocator` used to supply memory.
+    /// If `basicAllocator` is 0, the currently installed default allocator
+    /// is used.  The behavior is undefined unless
+    /// `lowWatermark <= highWatermark`, `1 <= lowWatermark`, and
+    /// `1 <= numStripes`.
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes,
+                 bslma::Allocator          *basicAllocator = 0);
+
+    /// Create an empty cache using the specified `evictionPolicy`,
+    /// `lowWatermark`, and `highWatermark`, whose items are partitioned
+    /// among the specified `numStripes` stripes, rounded up to a power of
+    /// two.  The specified `hashFunction` is used to generate the hash
+    /// values for a given key, both to select its stripe and within the
+    /// stripe, and the specified `equalFunction` is used to determine
+    /// whether two keys have the same value.  Optionally specify the
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `lowWatermark <= highWatermark`, `1 <= lowWatermark`,
+    /// and `1 <= numStripes`.
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+
+    /// Destroy this object.
+    //! ~StripedCache() = default;
+
+    // MANIPULATORS
+
+    /// Remove all items from this cache.  Do *not* invoke the post-eviction
+    /// callback.
+    void clear();
+
+    /// Remove the item having the specified `key` from this cache.  Invoke
+    /// the post-eviction callback for the removed item.  Return 0 on success
+    /// and 1 if `key` does not exist.
+    int erase(const KEY& key);
+
+    /// Insert the specified `key` and its associated `value` into this
+    /// cache.  If `key` already exists, then its value will be replaced with
+    /// `value`.  See `Cache::insert` for the exception guarantees of the
+    /// overloads taking moved arguments.
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+
+    /// Insert the specified `key` and its associated `valuePtr` into this
+    /// cache.  If `key` already exists, then its value will be replaced
+    /// with `value`.
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+
+    /// Set the post-eviction callback of every stripe to the specified
+    /// `postEvictionCallback`.  The post-eviction callback is invoked for
+    /// each item evicted or removed from this cache.
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+
+    /// Load, into the specified `value`, the value associated with the
+    /// specified `key` in this cache.  If the optionally specified
+    /// `modifyEvictionQueue` is `true`, record the access according to the
+    /// eviction policy of this cache (see `Cache::tryGetValue`).  Return 0
+    /// on success, and 1 if `key` does not exist in this cache.  Note that
+    /// only the stripe holding `key` is locked.
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+
+    // ACCESSORS
+
+    /// Return (a copy of) the key-equality functor used by this cache.
+    EQUAL equalFunction() const;
+
+    /// Return the eviction policy used by this cache.
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+
+    /// Return (a copy of) the hash functor used by this cache.
+    HASH hashFunction() const;
+
+    /// Return the high watermark of this cache, as specified at
+    /// construction.  Note that each stripe uses its share of this value.
+    bsl::size_t highWatermark() const;
+
+    /// Return the low watermark of this cache, as specified at
+    /// construction.  Note that each stripe uses its share of this value.
+    bsl::size_t lowWatermark() const;
+
+    /// Return the number of stripes of this cache.
+    bsl::size_t numStripes() const;
+
+    /// Return the current size of this cache.  Note that the size of each
+    /// stripe is read in turn, so the result may not correspond to any one
+    /// state of the cache if it is modified concurrently.
+    bsl::size_t size() const;
+
+    /// Call the specified `visitor` for every item stored in this cache,
+    /// stripe by stripe and, within a stripe, in the order of its eviction
+    /// queue, until `visitor` returns `false`.  The `VISITOR` type must be a
+    /// callable object that can be invoked in the same way as the function
+    /// `bool (const KEY&, const VALUE&)`.  Note that only one stripe is
+    /// locked at a time.
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+};
+
+/// This component-private class adapts a visitor to `StripedCache::visit`,
+/// recording whether the visitor asked to stop, so that the remaining
+/// stripes are not visited.
+template <class VISITOR>
+class StripedCache_VisitorProxy {
+
+    // DATA
+    VISITOR *d_visitor_p;  // visitor (held, not owned)
+    bool     d_stopped;    // `true` once the visitor returned `false`
+
+  public:
+    // CREATORS
+
+    /// Create a proxy forwarding to the specified `visitor`.
+    explicit StripedCache_VisitorProxy(VISITOR *visitor);
+
+    // MANIPULATORS
+
+    /// Call the visitor with the specified `key` and `value`, and return its
+    /// result.
+    template <class KEY, class VALUE>
+    bool operator()(const KEY& key, const VALUE& value);
+
+    // ACCESSORS
+
+    /// Return `true` if the visitor has returned `false`, and `false`
+    /// otherwise.
+    bool stopped() const;
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class StripedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::stripeWatermark(
+                                                     bsl::size_t watermark,
+                                                     bsl::size_t numStripes)
+{
+    // Round up, without overflowing for an unlimited watermark.
+
+    return watermark / numStripes + (0 != watermark % numStripes ? 1 : 0);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::createStripes(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                numStripes,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+{
+    const bsl::size_t n = static_cast<bsl::size_t>(
+                                           bdlb::BitUtil::roundUpToBinaryPower(
+                                static_cast<bsls::Types::Uint64>(numStripes)));
+
+    const bsl::size_t low  = stripeWatermark(d_lowWatermark,  n);
+    const bsl::size_t high = stripeWatermark(d_highWatermark, n);
+
+    d_stripes.reserve(n);
+    for (bsl::size_t i = 0; i < n; ++i) {
+        d_stripes.push_back(bsl::allocate_shared<StripeType>(basicAllocator,
+                                                             evictionPolicy,
+                                                             low,
+                                                             high,
+                                                             d_hashFunction,
+                                                             equalFunction));
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedCache<KEY, VALUE, HASH, EQUAL>::StripeType&
+StripedCache<KEY, VALUE, HASH, EQUAL>::stripe(const KEY& key)
+{
+    return *d_stripes[d_hashFunction(key) & (d_stripes.size() - 1)];
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const typename StripedCache<KEY, VALUE, HASH, EQUAL>::StripeType&
+StripedCache<KEY, VALUE, HASH, EQUAL>::stripe(const KEY& key) const
+{
+    return *d_stripes[d_hashFunction(key) & (d_stripes.size() - 1)];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_stripes(basicAllocator)
+, d_hashFunction()
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+{
+    createStripes(CacheEvictionPolicy::e_LRU,
+                  k_DEFAULT_NUM_STRIPES,
+                  EQUAL(),
+                  bslma::Default::allocator(basicAllocator));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     bslma::Allocator          *basicAllocator)
+: d_stripes(basicAllocator)
+, d_hashFunction()
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_ASSERT(1 <= numStripes);
+
+    createStripes(evictionPolicy,
+                  numStripes,
+                  EQUAL(),
+                  bslma::Default::allocator(basicAllocator));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_stripes(basicAllocator)
+, d_hashFunction(hashFunction)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_ASSERT(1 <= numStripes);
+
+    createStripes(evictionPolicy,
+                  numStripes,
+                  equalFunction,
+                  bslma::Default::allocator(basicAllocator));
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_stripes.size(); ++i) {
+        d_stripes[i]->clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return stripe(key).erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    stripe(key).insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               const KEY&               key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    stripe(key).insert(key, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 bslmf::MovableRef<KEY> key,
+                                                 const VALUE&           value)
+{
+    KEY& localKey = key;
+    stripe(localKey).insert(bslmf::MovableRefUtil::move(localKey), value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<KEY>   key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    KEY& localKey = key;
+    stripe(localKey).insert(bslmf::MovableRefUtil::move(localKey),
+                            bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    stripe(key).insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY> key,
+                                              const ValuePtrType&    valuePtr)
+{
+    KEY& localKey = key;
+    stripe(localKey).insert(bslmf::MovableRefUtil::move(localKey), valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_stripes.size(); ++i) {
+        d_stripes[i]->setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    return stripe(key).tryGetValue(value, key, modifyEvictionQueue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL StripedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_stripes.front()->equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+StripedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_stripes.front()->evictionPolicy();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH StripedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::numStripes() const
+{
+    return d_stripes.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_stripes.size(); ++i) {
+        result += d_stripes[i]->size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    StripedCache_VisitorProxy<VISITOR> proxy(&visitor);
+
+    for (bsl::size_t i = 0; i < d_stripes.size() && !proxy.stopped(); ++i) {
+        d_stripes[i]->visit(proxy);
+    }
+}
+
+                      // -------------------------------
+                      // class StripedCache_VisitorProxy
+                      // -------------------------------
+
+// CREATORS
+template <class VISITOR>
+inline
+StripedCache_VisitorProxy<VISITOR>::StripedCache_VisitorProxy(
+                                                              VISITOR *visitor)
+: d_visitor_p(visitor)
+, d_stopped(false)
+{
+}
+
+// MANIPULATORS
+template <class VISITOR>
+template <class KEY, class VALUE>
+inline
+bool StripedCache_VisitorProxy<VISITOR>::operator()(const KEY&   key,
+                                                    const VALUE& value)
+{
+    d_stopped = !(*d_visitor_p)(key, value);
+    return !d_stopped;
+}
+
+// ACCESSORS
+template <class VISITOR>
+inline
+bool StripedCache_VisitorProxy<VISITOR>::stopped() const
+{
+    return d_stopped;
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::StripedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
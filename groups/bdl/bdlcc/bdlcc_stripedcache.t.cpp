@@ -0,0 +1,1131 @@
+// bdlcc_stripedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_stripedcache.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdlb_random.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, `bdlcc::StripedCache`, that
+// partitions the items of a cache among several `bdlcc::Cache` objects, and
+// forwards each operation on a key to the cache (stripe) selected by the hash
+// of the key.  As the behavior of each stripe is tested in `bdlcc_cache`, we
+// need only test that the stripes are created with the correct attributes,
+// that keys are forwarded to the correct stripe, and that the operations
+// spanning all stripes (`clear`, `setPostEvictionCallback`, `size`, and
+// `visit`) do so.  The default hash function for `int`, the identity, lets
+// the test cases predict the stripe of each key.
+//
+// A negatively numbered (manually run) performance test compares the
+// throughput of `bdlcc::Cache` and `bdlcc::StripedCache` under the LRU and
+// CLOCK eviction policies.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StripedCache(bslma::Allocator *basicAllocator);
+// [ 2] StripedCache(policy, low, high, numStripes, basicAllocator);
+// [ 2] StripedCache(policy, low, high, numStripes, hash, equal, alloc);
+//
+// MANIPULATORS
+// [ 3] void clear();
+// [ 3] int erase(const KEY& key);
+// [ 3] void insert(const KEY& key, const VALUE& value);
+// [ 3] void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+// [ 3] void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+// [ 3] void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+// [ 3] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 3] void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+// [ 4] void setPostEvictionCallback(postEvictionCallback);
+// [ 3] int tryGetValue(value, key, modifyEvictionQueue);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bsl::size_t numStripes() const;
+// [ 3] bsl::size_t size() const;
+// [ 5] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] EVICTION WITHIN STRIPES
+// [ 6] CONCURRENT LOOKUPS AND INSERTIONS
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: THROUGHPUT OF CACHE AND STRIPED CACHE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::StripedCache<int, int> Obj;
+typedef bdlcc::CacheEvictionPolicy    Policy;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// This visitor appends the keys of the visited items to a vector, and
+/// returns `false` once it has visited a specified number of items.
+struct KeyCollector {
+
+    bsl::vector<int> d_keys;
+    bsl::size_t      d_limit;
+
+    KeyCollector(bsl::size_t limit, bslma::Allocator *basicAllocator)
+    : d_keys(basicAllocator)
+    , d_limit(limit)
+    {}
+
+    bool operator() (int key, int)
+    {
+        d_keys.push_back(key);
+        return d_keys.size() < d_limit;
+    }
+};
+
+/// Append the value pointed to by the specified `valuePtr` to the specified
+/// `evicted` vector.
+void recordEviction(bsl::vector<int>            *evicted,
+                    const bsl::shared_ptr<int>&  valuePtr)
+{
+    evicted->push_back(*valuePtr);
+}
+
+/// This hash function maps each pair of consecutive non-negative keys
+/// `2 * n` and `2 * n + 1` to `n`; it is used to verify that a hash function
+/// supplied at construction selects the stripes.
+struct HalvingHash {
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key / 2);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       CONCURRENCY TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace concurrency {
+
+/// Until the specified `done` is set, look up random keys less than the
+/// specified `numKeys` in the specified `cache`, and insert each key that is
+/// not found, using the specified `seed` to generate the keys.  Load into
+/// the specified `numErrors` the number of lookups that found a value
+/// different from the key.
+void worker(Obj              *cache,
+            bsls::AtomicBool *done,
+            int               numKeys,
+            int               seed,
+            int              *numErrors)
+{
+    while (!*done) {
+        const int key = bdlb::Random::generate15(&seed) % numKeys;
+
+        bsl::shared_ptr<int> valuePtr;
+        if (0 == cache->tryGetValue(&valuePtr, key)) {
+            if (key != *valuePtr) {
+                ++*numErrors;
+            }
+        }
+        else {
+            cache->insert(key, key);
+        }
+
+        if (0 == key % 97) {
+            cache->erase(key);
+        }
+    }
+}
+
+}  // close namespace concurrency
+
+// ============================================================================
+//                       PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace performance {
+
+/// This class generates keys in `[0 .. numKeys)` following a Zipf
+/// distribution, in which the probability of the key `k` is proportional to
+/// `1 / (k + 1)^0.99`.
+class ZipfGenerator {
+
+    // DATA
+    bsl::vector<double> d_cdf;   // cumulative probability of each key
+
+    int                 d_seed;  // seed of `bdlb::Random`
+
+  public:
+    // CREATORS
+
+    /// Create a generator of keys in `[0 .. numKeys)` using the specified
+    /// `seed` and the specified `basicAllocator` to supply memory.
+    ZipfGenerator(int numKeys, int seed, bslma::Allocator *basicAllocator)
+    : d_cdf(basicAllocator)
+    , d_seed(seed)
+    {
+        d_cdf.reserve(numKeys);
+
+        double sum = 0;
+        for (int k = 0; k < numKeys; ++k) {
+            sum += 1 / bsl::pow(k + 1.0, 0.99);
+            d_cdf.push_back(sum);
+        }
+        for (int k = 0; k < numKeys; ++k) {
+            d_cdf[k] /= sum;
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Return the next key.
+    int operator()()
+    {
+        const double u = ((bdlb::Random::generate15(&d_seed) << 15) |
+                           bdlb::Random::generate15(&d_seed)) /
+                                                      double(1 << 30);
+        const int key = static_cast<int>(
+                  bsl::lower_bound(d_cdf.begin(), d_cdf.end(), u) -
+                                                              d_cdf.begin());
+        return key < static_cast<int>(d_cdf.size()) ? key : key - 1;
+    }
+};
+
+/// Look up, in the specified `cache`, the specified `numOps` keys generated
+/// by a `ZipfGenerator` over the specified `numKeys` keys using the
+/// specified `seed`, after waiting on the specified `barrier`.  Insert each
+/// key that is not found, and add the number of lookups that found their key
+/// to the specified `hits`.
+template <class CACHE>
+void worker(CACHE           *cache,
+            bslmt::Barrier  *barrier,
+            bsls::AtomicInt *hits,
+            int              numOps,
+            int              numKeys,
+            int              seed)
+{
+    bslma::NewDeleteAllocator na;
+    ZipfGenerator             generator(numKeys, seed, &na);
+
+    barrier->wait();
+
+    bsl::shared_ptr<int> valuePtr;
+
+    int found = 0;
+    for (int i = 0; i < numOps; ++i) {
+        const int key = generator();
+        if (0 == cache->tryGetValue(&valuePtr, key)) {
+            ++found;
+        }
+        else {
+            cache->insert(key, key);
+        }
+    }
+    *hits += found;
+}
+
+/// Run the specified `numThreads` threads each looking up the specified
+/// `numOps` keys among the specified `numKeys` keys in the specified
+/// (initially empty) `cache`.  Load into the specified `hitRate` the fraction
+/// of lookups that found their key, and return the wall time of the run, in
+/// seconds.
+template <class CACHE>
+double run(double *hitRate,
+           CACHE  *cache,
+           int     numThreads,
+           int     numOps,
+           int     numKeys)
+{
+    bslma::NewDeleteAllocator na;
+
+    bsls::AtomicInt    hits(0);
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads(&na);
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(bdlf::BindUtil::bindS(&na,
+                                                &worker<CACHE>,
+                                                cache,
+                                                &barrier,
+                                                &hits,
+                                                numOps,
+                                                numKeys,
+                                                i + 1));
+    }
+
+    bsls::Stopwatch timer;
+    barrier.wait();
+    timer.start(true);
+    threads.joinAll();
+    timer.stop();
+
+    *hitRate = static_cast<double>(hits) / (double(numThreads) * numOps);
+    return timer.accumulatedWallTime();
+}
+
+}  // close namespace performance
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator talloc("usage", veryVeryVeryVerbose);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Read-Mostly Cache Shared by Many Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that many threads of a service look up instrument descriptions by
+// an integer identifier, and that most lookups find the description in a
+// cache.
+//
+// First, we define a cache of up to 1000 descriptions that uses the CLOCK
+// eviction policy and 8 stripes:
+// ```
+    typedef bdlcc::StripedCache<int, bsl::string> MyCache;
+
+    MyCache cache(bdlcc::CacheEvictionPolicy::e_CLOCK, 900, 1000, 8, &talloc);
+    ASSERT(8 == cache.numStripes());
+// ```
+// Then, we populate the cache:
+// ```
+    cache.insert(1, "IBM");
+    cache.insert(2, "AAPL");
+    cache.insert(3, "MSFT");
+    ASSERT(3 == cache.size());
+// ```
+// Next, we look up a description.  Only the stripe holding the key is locked,
+// and, with the CLOCK eviction policy, only for reading:
+// ```
+    bsl::shared_ptr<bsl::string> value;
+    int rc = cache.tryGetValue(&value, 2);
+    ASSERT(0      == rc);
+    ASSERT("AAPL" == *value);
+// ```
+// Finally, we remove an item, and observe that looking it up fails:
+// ```
+    rc = cache.erase(3);
+    ASSERT(0 == rc);
+    ASSERT(2 == cache.size());
+
+    rc = cache.tryGetValue(&value, 3);
+    ASSERT(1 == rc);
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOOKUPS AND INSERTIONS
+        //
+        // Concerns:
+        // 1. Threads looking up, inserting, and erasing keys concurrently,
+        //    while the stripes evict items, leave the cache consistent, and a
+        //    lookup never finds the value of another key.
+        //
+        // Plan:
+        // 1. Run several threads performing random lookups, insertions, and
+        //    erasures on a shared CLOCK cache for a fixed time.  Then verify
+        //    that no lookup returned a wrong value, that the size of the
+        //    cache respects the (per-stripe) high watermarks, and that every
+        //    item holds the value of its key.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT LOOKUPS AND INSERTIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOOKUPS AND INSERTIONS" << endl
+                          << "=================================" << endl;
+
+        const int k_NUM_THREADS = 4;
+        const int k_NUM_KEYS    = 1000;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(Policy::e_CLOCK, 200, 256, 8, &ta);
+
+            bsls::AtomicBool   done(false);
+            int                numErrors[k_NUM_THREADS] = { 0 };
+            bslmt::ThreadGroup threads(&ta);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads.addThread(bdlf::BindUtil::bindS(&ta,
+                                                        &concurrency::worker,
+                                                        &mX,
+                                                        &done,
+                                                        k_NUM_KEYS,
+                                                        i + 1,
+                                                        &numErrors[i]));
+            }
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+            done = true;
+            threads.joinAll();
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(i, numErrors[i], 0 == numErrors[i]);
+            }
+
+            ASSERTV(mX.size(), 256 >= mX.size());
+
+            KeyCollector collector(k_NUM_KEYS, &ta);
+            mX.visit(collector);
+            ASSERTV(collector.d_keys.size(), mX.size(),
+                    mX.size() == collector.d_keys.size());
+
+            for (bsl::size_t i = 0; i < collector.d_keys.size(); ++i) {
+                const int            key = collector.d_keys[i];
+                bsl::shared_ptr<int> valuePtr;
+
+                ASSERTV(key, 0 == mX.tryGetValue(&valuePtr, key, false));
+                ASSERTV(key, *valuePtr, key == *valuePtr);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // VISIT
+        //
+        // Concerns:
+        // 1. `visit` calls the visitor for every item of every stripe, one
+        //    stripe after the other.
+        //
+        // 2. When the visitor returns `false`, no further item, in the same
+        //    or another stripe, is visited.
+        //
+        // 3. `visit` on an empty cache does not call the visitor.
+        //
+        // Plan:
+        // 1. Insert keys into a cache having 4 stripes, and verify, with a
+        //    visitor recording the keys it visits, that the keys are visited
+        //    grouped by stripe, in the order of insertion within a stripe.
+        //    (C-1)
+        //
+        // 2. Repeat P-1 with visitors that stop after each possible number
+        //    of items.  (C-2)
+        //
+        // 3. Visit an empty cache.  (C-3)
+        //
+        // Testing:
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "VISIT" << endl << "=====" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(Policy::e_LRU, 100, 100, 4, &ta);  const Obj& X = mX;
+        {
+            KeyCollector collector(100, &ta);
+            X.visit(collector);
+            ASSERT(collector.d_keys.empty());
+        }
+
+        const int KEYS[]   = { 5, 2, 8, 1, 4, 7, 3, 6 };
+        const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(KEYS[i], 10 * KEYS[i]);
+        }
+
+        // Stripe `k & 3`, in order of insertion within a stripe.
+
+        const int EXPECTED[] = { 8, 4, 5, 1, 2, 6, 7, 3 };
+
+        for (int limit = 1; limit <= NUM_KEYS + 1; ++limit) {
+            KeyCollector collector(limit, &ta);
+            X.visit(collector);
+
+            const bsl::size_t EXP_SIZE = bsl::min(limit, NUM_KEYS);
+            ASSERTV(limit, collector.d_keys.size(),
+                    EXP_SIZE == collector.d_keys.size());
+
+            for (bsl::size_t i = 0; i < collector.d_keys.size(); ++i) {
+                ASSERTV(limit, i, collector.d_keys[i],
+                        EXPECTED[i] == collector.d_keys[i]);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // EVICTION WITHIN STRIPES
+        //
+        // Concerns:
+        // 1. Each stripe evicts its own items when its share of the high
+        //    watermark is reached, down to its share of the low watermark,
+        //    according to the eviction policy.
+        //
+        // 2. Inserting into one stripe does not evict items of another.
+        //
+        // 3. The post-eviction callback set by `setPostEvictionCallback` is
+        //    invoked for items evicted from, or erased in, any stripe.
+        //
+        // Plan:
+        // 1. Create a CLOCK cache having 2 stripes and both watermarks 4
+        //    (i.e., 2 per stripe), and set a post-eviction callback recording
+        //    the evicted values.  Insert and look up even and odd keys, and
+        //    verify the items that remain and the evicted values.  (C-1..3)
+        //
+        // Testing:
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   EVICTION WITHIN STRIPES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EVICTION WITHIN STRIPES" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        {
+            bsl::vector<int> evicted(&ta);
+
+            Obj mX(Policy::e_CLOCK, 4, 4, 2, &ta);  const Obj& X = mX;
+            mX.setPostEvictionCallback(
+                          bdlf::BindUtil::bindS(&ta,
+                                                &recordEviction,
+                                                &evicted,
+                                                bdlf::PlaceHolders::_1));
+
+            bsl::shared_ptr<int> valuePtr;
+
+            mX.insert(0, 0);
+            mX.insert(2, 20);
+            mX.insert(1, 10);
+            mX.insert(3, 30);
+            ASSERTV(X.size(), 4 == X.size());
+            ASSERT(evicted.empty());
+
+            // The even stripe is full: 0 is evicted, the odd stripe is
+            // untouched.
+
+            mX.insert(4, 40);
+            ASSERTV(X.size(), 4 == X.size());
+            ASSERTV(evicted.size(), 1 == evicted.size() && 0 == evicted[0]);
+            ASSERT(1 == mX.tryGetValue(&valuePtr, 0));
+            ASSERT(0 == mX.tryGetValue(&valuePtr, 1));
+            ASSERT(0 == mX.tryGetValue(&valuePtr, 3, false));
+
+            // 1 was referenced: inserting 5 evicts 3.
+
+            mX.insert(5, 50);
+            ASSERTV(evicted.size(), 2 == evicted.size() && 30 == evicted[1]);
+            ASSERT(0 == mX.tryGetValue(&valuePtr, 1, false));
+            ASSERT(10 == *valuePtr);
+
+            // Erasing invokes the callback.
+
+            ASSERT(0 == mX.erase(2));
+            ASSERT(1 == mX.erase(2));
+            ASSERTV(evicted.size(), 3 == evicted.size() && 20 == evicted[2]);
+            ASSERTV(X.size(), 3 == X.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, TRYGETVALUE, ERASE, AND CLEAR
+        //
+        // Concerns:
+        // 1. Each `insert` overload inserts the key and value into the cache,
+        //    or replaces the value of an existing key.
+        //
+        // 2. `tryGetValue` finds exactly the keys that were inserted and not
+        //    erased, whichever stripe holds them.
+        //
+        // 3. `erase` removes only the specified key, and returns 1 if the key
+        //    is not in the cache.
+        //
+        // 4. `size` returns the total number of items in all stripes.
+        //
+        // 5. `clear` empties every stripe.
+        //
+        // 6. All memory is supplied by the allocator specified at
+        //    construction, and is returned on destruction.
+        //
+        // Plan:
+        // 1. Insert keys spread over all stripes using each `insert`
+        //    overload, and verify `size` and the values found by
+        //    `tryGetValue`.  (C-1..2, 4)
+        //
+        // 2. Erase some keys, and verify `size` and the keys found.  (C-3)
+        //
+        // 3. Clear the cache, and verify that it is empty.  (C-5)
+        //
+        // 4. Use a test allocator, and verify that the default allocator is
+        //    not used and that no memory is in use after destruction.  (C-6)
+        //
+        // Testing:
+        //   void clear();
+        //   int erase(const KEY& key);
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+        //   void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+        //   void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, TRYGETVALUE, ERASE, AND CLEAR" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator         ta("object", veryVeryVeryVerbose);
+        bslma::TestAllocatorMonitor  dam(&defaultAllocator);
+
+        {
+            typedef bdlcc::StripedCache<int, bsl::string> StringCache;
+
+            StringCache mX(Policy::e_CLOCK, 1000, 1000, 8, &ta);
+            const StringCache& X = mX;
+
+            const int NUM_KEYS = 48;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string VALUE(1 + i % 5, static_cast<char>('a' + i),
+                                        &ta);
+                switch (i % 6) {
+                  case 0: {
+                    mX.insert(i, VALUE);
+                  } break;
+                  case 1: {
+                    bsl::string value(VALUE, &ta);
+                    mX.insert(i, bslmf::MovableRefUtil::move(value));
+                  } break;
+                  case 2: {
+                    int key = i;
+                    mX.insert(bslmf::MovableRefUtil::move(key), VALUE);
+                  } break;
+                  case 3: {
+                    int         key = i;
+                    bsl::string value(VALUE, &ta);
+                    mX.insert(bslmf::MovableRefUtil::move(key),
+                              bslmf::MovableRefUtil::move(value));
+                  } break;
+                  case 4: {
+                    mX.insert(i, bsl::allocate_shared<bsl::string>(&ta,
+                                                                   VALUE));
+                  } break;
+                  case 5: {
+                    int key = i;
+                    mX.insert(bslmf::MovableRefUtil::move(key),
+                              bsl::allocate_shared<bsl::string>(&ta, VALUE));
+                  } break;
+                }
+                ASSERTV(i, X.size(), i + 1 == static_cast<int>(X.size()));
+            }
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string VALUE(1 + i % 5, static_cast<char>('a' + i),
+                                        &ta);
+
+                bsl::shared_ptr<bsl::string> valuePtr;
+                ASSERTV(i, 0 == mX.tryGetValue(&valuePtr, i));
+                ASSERTV(i, VALUE == *valuePtr);
+            }
+
+            // Replace a value.
+
+            mX.insert(7, bsl::string("seven", &ta));
+            ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+            {
+                bsl::shared_ptr<bsl::string> valuePtr;
+                ASSERT(0 == mX.tryGetValue(&valuePtr, 7));
+                ASSERT("seven" == *valuePtr);
+            }
+
+            for (int i = 0; i < NUM_KEYS; i += 3) {
+                ASSERTV(i, 0 == mX.erase(i));
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERTV(X.size(), NUM_KEYS * 2 / 3 == static_cast<int>(X.size()));
+
+            for (int i = 0; i < NUM_KEYS + 8; ++i) {
+                const int EXP = i < NUM_KEYS && 0 != i % 3 ? 0 : 1;
+
+                bsl::shared_ptr<bsl::string> valuePtr;
+                ASSERTV(i, EXP == mX.tryGetValue(&valuePtr, i));
+            }
+
+            mX.clear();
+            ASSERTV(X.size(), 0 == X.size());
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                bsl::shared_ptr<bsl::string> valuePtr;
+                ASSERTV(i, 1 == mX.tryGetValue(&valuePtr, i));
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(dam.isTotalSame());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. The default constructor creates an LRU cache having no size
+        //    limit and `k_DEFAULT_NUM_STRIPES` stripes.
+        //
+        // 2. The other constructors create a cache having the specified
+        //    eviction policy and watermarks, and the specified number of
+        //    stripes rounded up to a power of two.
+        //
+        // 3. The hash function supplied at construction selects the stripe
+        //    of a key, and is returned by `hashFunction`.
+        //
+        // 4. Memory is supplied by the specified allocator, or by the default
+        //    allocator if none is specified, and is returned on destruction.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create objects with each constructor, and verify the values of
+        //    the basic accessors.  (C-1..2)
+        //
+        // 2. Using a hash function that maps the keys 0 and 1 to the same
+        //    stripe, insert them into a cache having 2 stripes and both
+        //    watermarks 2, and verify that the second evicts the first.
+        //    (C-3)
+        //
+        // 3. Use test allocators to verify the source of memory.  (C-4)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a zero number of stripes.  (C-5)
+        //
+        // Testing:
+        //   explicit StripedCache(bslma::Allocator *basicAllocator);
+        //   StripedCache(policy, low, high, numStripes, basicAllocator);
+        //   StripedCache(policy, low, high, numStripes, hash, equal, alloc);
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numStripes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        const bsl::size_t UNLIMITED = bsl::numeric_limits<bsl::size_t>::max();
+
+        {
+            bslma::TestAllocator        ta("object", veryVeryVeryVerbose);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+            {
+                const Obj X(&ta);
+
+                ASSERT(Policy::e_LRU == X.evictionPolicy());
+                ASSERT(UNLIMITED     == X.lowWatermark());
+                ASSERT(UNLIMITED     == X.highWatermark());
+                ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+                ASSERT(0             == X.size());
+                ASSERT(0 < ta.numBlocksInUse());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+            ASSERT(dam.isTotalSame());
+        }
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+            {
+                const Obj X;
+                ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+                ASSERT(0 < defaultAllocator.numBlocksInUse());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_numStripes;
+            bsl::size_t d_expNumStripes;
+        } DATA[] = {
+            { L_,  1,  1 },
+            { L_,  2,  2 },
+            { L_,  3,  4 },
+            { L_,  8,  8 },
+            { L_,  9, 16 },
+            { L_, 64, 64 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE        = DATA[ti].d_line;
+            const bsl::size_t NUM_STRIPES = DATA[ti].d_numStripes;
+            const bsl::size_t EXP         = DATA[ti].d_expNumStripes;
+
+            bslma::TestAllocator        ta("object", veryVeryVeryVerbose);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+            {
+                const Obj X(Policy::e_FIFO, 10, 20, NUM_STRIPES, &ta);
+
+                ASSERTV(LINE, Policy::e_FIFO == X.evictionPolicy());
+                ASSERTV(LINE, 10  == X.lowWatermark());
+                ASSERTV(LINE, 20  == X.highWatermark());
+                ASSERTV(LINE, EXP == X.numStripes());
+
+                const Obj Y(Policy::e_CLOCK,
+                            30,
+                            40,
+                            NUM_STRIPES,
+                            bsl::hash<int>(),
+                            bsl::equal_to<int>(),
+                            &ta);
+
+                ASSERTV(LINE, Policy::e_CLOCK == Y.evictionPolicy());
+                ASSERTV(LINE, 30  == Y.lowWatermark());
+                ASSERTV(LINE, 40  == Y.highWatermark());
+                ASSERTV(LINE, EXP == Y.numStripes());
+                ASSERTV(LINE, Y.equalFunction()(3, 3));
+                ASSERTV(LINE, 3 == Y.hashFunction()(3));
+            }
+            ASSERTV(LINE, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+            ASSERTV(LINE, dam.isTotalSame());
+        }
+
+        {
+            typedef bdlcc::StripedCache<int, int, HalvingHash> HalvingObj;
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            HalvingObj mX(Policy::e_FIFO,
+                          2,
+                          2,
+                          2,
+                          HalvingHash(),
+                          bsl::equal_to<int>(),
+                          &ta);
+            ASSERT(2 == mX.hashFunction()(5));
+
+            // With 2 stripes, each holding at most one item, 0 and 1 are in
+            // the same stripe, so 1 evicts 0, but 2 is in the other stripe.
+
+            bsl::shared_ptr<int> valuePtr;
+
+            mX.insert(0, 0);
+            mX.insert(1, 1);
+            ASSERT(1 == mX.size());
+            mX.insert(2, 2);
+            ASSERT(2 == mX.size());
+            ASSERT(1 == mX.tryGetValue(&valuePtr, 0));
+            ASSERT(0 == mX.tryGetValue(&valuePtr, 1));
+            ASSERT(0 == mX.tryGetValue(&valuePtr, 2));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            ASSERT_PASS(Obj(Policy::e_LRU, 1, 1, 1, &ta));
+            ASSERT_FAIL(Obj(Policy::e_LRU, 1, 1, 0, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a cache, insert, look up, and erase a few items, and
+        //    verify the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(Policy::e_CLOCK, 100, 200, 4, &ta);  const Obj& X = mX;
+        ASSERT(4 == X.numStripes());
+        ASSERT(0 == X.size());
+
+        for (int i = 0; i < 10; ++i) {
+            mX.insert(i, i * i);
+        }
+        ASSERT(10 == X.size());
+
+        bsl::shared_ptr<int> valuePtr;
+        for (int i = 0; i < 10; ++i) {
+            ASSERTV(i, 0 == mX.tryGetValue(&valuePtr, i));
+            ASSERTV(i, i * i == *valuePtr);
+        }
+        ASSERT(1 == mX.tryGetValue(&valuePtr, 10));
+
+        ASSERT(0 == mX.erase(3));
+        ASSERT(1 == mX.erase(3));
+        ASSERT(9 == X.size());
+        ASSERT(1 == mX.tryGetValue(&valuePtr, 3));
+
+        mX.clear();
+        ASSERT(0 == X.size());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT OF CACHE AND STRIPED CACHE
+        //
+        // Concerns:
+        // 1. Report the hit rate and throughput of `bdlcc::Cache` and
+        //    `bdlcc::StripedCache`, under the LRU and CLOCK eviction
+        //    policies, for concurrent lookups of keys following a Zipf
+        //    distribution, where keys not found are inserted.
+        //
+        // Plan:
+        // 1. Run `performance::run` on each configuration and print the
+        //    results.  The optional arguments are the number of threads, the
+        //    number of lookups per thread, the number of distinct keys, the
+        //    high watermark (the low watermark is 90% of it), and the number
+        //    of stripes.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT OF CACHE AND STRIPED CACHE
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: THROUGHPUT OF CACHE AND STRIPED CACHE"
+             << endl
+             << "======================================================="
+             << endl;
+
+        const int numThreads = argc > 2 ? bsl::atoi(argv[2]) : 4;
+        const int numOps     = argc > 3 ? bsl::atoi(argv[3]) : 1000000;
+        const int numKeys    = argc > 4 ? bsl::atoi(argv[4]) : 100000;
+        const int capacity   = argc > 5 ? bsl::atoi(argv[5]) : 10000;
+        const int numStripes = argc > 6 ? bsl::atoi(argv[6]) : 16;
+
+        const int lowWatermark = capacity * 9 / 10;
+
+        bslma::NewDeleteAllocator na;
+
+        cout << "threads: " << numThreads << ", lookups per thread: "
+             << numOps << ", keys: " << numKeys << ", capacity: "
+             << capacity << ", stripes: " << numStripes << endl;
+
+        const struct {
+            bdlcc::CacheEvictionPolicy::Enum  d_policy;
+            const char                       *d_name;
+        } POLICIES[] = {
+            { Policy::e_LRU,   "LRU  " },
+            { Policy::e_CLOCK, "CLOCK" },
+        };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        const double totalOps = double(numThreads) * numOps;
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            double hitRate;
+            double time;
+
+            {
+                bdlcc::Cache<int, int> cache(POLICIES[ti].d_policy,
+                                             lowWatermark,
+                                             capacity,
+                                             &na);
+                time = performance::run(&hitRate,
+                                        &cache,
+                                        numThreads,
+                                        numOps,
+                                        numKeys);
+            }
+            cout << "Cache        " << POLICIES[ti].d_name << ": hit rate "
+                 << hitRate * 100 << "%, " << totalOps / time / 1e6
+                 << " Mlookups/s" << endl;
+
+            {
+                Obj cache(POLICIES[ti].d_policy,
+                          lowWatermark,
+                          capacity,
+                          numStripes,
+                          &na);
+                time = performance::run(&hitRate,
+                                        &cache,
+                                        numThreads,
+                                        numOps,
+                                        numKeys);
+            }
+            cout << "StripedCache " << POLICIES[ti].d_name << ": hit rate "
+                 << hitRate * 100 << "%, " << totalOps / time / 1e6
+                 << " Mlookups/s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -62,6 +62,25 @@ BSLS_IDENT("$Id: $")
 // unspecified, it has a value of 17.  The behavior is undefined unless the
 // specified `numIndexBits` is in the range `8 <= numIndexBits <= 24`.
 //
+///Timer Store
+///- - - - - -
+// By default, a `bdlcc::TimeQueue` orders its items in a `bsl::map` keyed by
+// time, so that adding, removing, or updating an item takes time logarithmic
+// in the number of distinct time values in the queue.  A queue created with
+// the `bdlc::TimerStoreType::e_TIMING_WHEEL` store type instead orders its
+// items in a `bdlc::TimingWheel`, so that these operations, and removing each
+// expired item in `popLE`, take constant time.  This suits queues holding
+// many timers that are mostly rescheduled or removed before they expire,
+// such as per-connection timeouts.
+//
+// A queue using a timing wheel compares time values at a resolution of one
+// microsecond: items whose time values fall within the same microsecond are
+// ordered by insertion rather than by time, and `popLE` (respectively,
+// `countLE`) removes (respectively, counts) the items whose time value falls
+// within the microsecond of the specified time, or earlier.  In addition,
+// `removeIf` and `countLE` take time linear in the number of nodes ever
+// allocated by the queue.
+//
 ///Thread Safety
 ///- - - - - - -
 // It is safe to access or modify two distinct `bdlcc::TimeQueue` objects
@@ -621,6 +640,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlc_timingwheel.h>
+
 #include <bdlma_concurrentpoolallocator.h>
 #include <bdlma_pool.h>
 
@@ -643,7 +664,9 @@ BSLS_IDENT("$Id: $")
 #include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstdint.h>
 #include <bsl_functional.h>
@@ -751,8 +774,11 @@ class TimeQueue {
     /// This queue is implemented internally as a map of time values, each
     /// entry in the map storing a doubly-linked circular list of items
     /// having the same time value.  This struct provides the node in the
-    /// list.
-    struct Node {
+    /// list.  If the queue uses a timing wheel instead of a map, the node is
+    /// linked into the wheel through its base class, and `d_prev_p` is
+    /// non-null (pointing to the node itself) while the node is in the
+    /// queue.
+    struct Node : bdlc::TimingWheelLink {
 
         // PUBLIC DATA MEMBERS
         unsigned int              d_index;
@@ -818,14 +844,45 @@ class TimeQueue {
                                                 // this queue (not necessarily
                                                 // equal to d_map.size())
 
+    bdlc::TimingWheel        *d_wheel_p;        // timing wheel ordering the
+                                                // items in place of `d_map`,
+                                                // or 0 if `d_map` is used
+                                                // (owned)
+
     bslma::Allocator         *d_allocator_p;    // allocator (held, not owned)
 
+    // PRIVATE CLASS METHODS
+
+    /// Return `true` if the specified `lhs` item has an earlier time than
+    /// the specified `rhs` item, and `false` otherwise.
+    static bool isEarlier(const TimeQueueItem<DATA>& lhs,
+                          const TimeQueueItem<DATA>& rhs);
+
+    /// Return the time, in microseconds, at which the specified `time` is
+    /// ordered in a timing wheel, saturated to the range of
+    /// `bsls::Types::Int64`.
+    static bsls::Types::Int64 wheelTime(const bsls::TimeInterval& time);
+
     // PRIVATE MANIPULATORS
 
+    /// Create the timing wheel of this queue if the specified `storeType` is
+    /// `bdlc::TimerStoreType::e_TIMING_WHEEL`.
+    void createStore(bdlc::TimerStoreType::Enum storeType);
+
     /// Prepare the specified `node` for being reused on the free list by
     /// incrementing the iteration count.  Set `d_prev_p` field to 0.
     void freeNode(Node *node);
 
+    /// Insert the specified `node` into the map or timing wheel of this
+    /// queue according to its time value.  The behavior is undefined unless
+    /// the lock of this queue is held.
+    void linkNode(Node *node);
+
+    /// Remove the specified `node` from the map or timing wheel of this
+    /// queue.  The behavior is undefined unless the lock of this queue is
+    /// held and `node` is in this queue.
+    void unlinkNode(Node *node);
+
     /// Remove from this queue all the items that have a time value less
     /// than or equal to the specified `time`, and optionally append into
     /// the optionally specified `buffer` a list of the removed items,
@@ -888,6 +945,11 @@ class TimeQueue {
     /// and `key` if such a node exists, otherwise return a null pointer.
     Node* getNodeFromHandle(Handle handle, Key key) const;
 
+    /// Return a pointer to the node having the lowest time value in this
+    /// queue, or a null pointer if this queue is empty.  The behavior is
+    /// undefined unless the lock of this queue is held.
+    Node *frontNode() const;
+
 
   private:
     // NOT IMPLEMENTED
@@ -919,6 +981,20 @@ class TimeQueue {
               bool              poolTimerMemory,
               bslma::Allocator *basicAllocator = 0);
 
+    /// Create an empty time queue that orders its items in a store of the
+    /// specified `storeType`.  Optionally specify `numIndexBits` to
+    /// configure the number of index bits used by this object.  If
+    /// `numIndexBits` is not specified a default value of 17 is used.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `8 <= numIndexBits <= 24`.
+    /// See {Timer Store} in the component-level documentation.
+    explicit TimeQueue(bdlc::TimerStoreType::Enum  storeType,
+                       bslma::Allocator           *basicAllocator = 0);
+    TimeQueue(int                         numIndexBits,
+              bdlc::TimerStoreType::Enum  storeType,
+              bslma::Allocator           *basicAllocator = 0);
+
     /// Destroy this time queue.
     ~TimeQueue();
 
@@ -1096,6 +1172,9 @@ class TimeQueue {
     bool isRegisteredHandle(Handle handle) const;
     bool isRegisteredHandle(Handle handle, const Key& key) const;
 
+    /// Return the type of store in which this queue orders its items.
+    bdlc::TimerStoreType::Enum storeType() const;
+
     /// Load into the specified `buffer`, the time value of the lowest time
     /// in this queue.  Return 0 on success, and a non-zero value if this
     /// queue is empty.
@@ -1243,7 +1322,40 @@ struct TimeQueue<DATA>::IsVector {
                                 // TimeQueue
                                 // ---------
 
+// PRIVATE CLASS METHODS
+template <class DATA>
+inline
+bool TimeQueue<DATA>::isEarlier(const TimeQueueItem<DATA>& lhs,
+                                const TimeQueueItem<DATA>& rhs)
+{
+    return lhs.time() < rhs.time();
+}
+
+template <class DATA>
+bsls::Types::Int64 TimeQueue<DATA>::wheelTime(const bsls::TimeInterval& time)
+{
+    typedef bsls::Types::Int64 Int64;
+
+    const Int64 k_MAX_SECONDS = LLONG_MAX / 1000000 - 1;
+
+    if (time.seconds() > k_MAX_SECONDS) {
+        return LLONG_MAX;                                             // RETURN
+    }
+    if (time.seconds() < -k_MAX_SECONDS) {
+        return LLONG_MIN;                                             // RETURN
+    }
+    return time.seconds() * 1000000 + time.nanoseconds() / 1000;
+}
+
 // PRIVATE MANIPULATORS
+template <class DATA>
+void TimeQueue<DATA>::createStore(bdlc::TimerStoreType::Enum storeType)
+{
+    if (bdlc::TimerStoreType::e_TIMING_WHEEL == storeType) {
+        d_wheel_p = new (*d_allocator_p) bdlc::TimingWheel();
+    }
+}
+
 template <class DATA>
 inline
 void TimeQueue<DATA>::freeNode(Node *node)
@@ -1257,6 +1369,52 @@ void TimeQueue<DATA>::freeNode(Node *node)
     node->d_prev_p = 0;
 }
 
+template <class DATA>
+void TimeQueue<DATA>::linkNode(Node *node)
+{
+    if (d_wheel_p) {
+        node->d_prev_p = node;
+        d_wheel_p->insert(node, wheelTime(node->d_time));
+        return;                                                       // RETURN
+    }
+
+    MapIter it = d_map.find(node->d_time);
+
+    if (d_map.end() == it) {
+        node->d_prev_p = node;
+        node->d_next_p = node;
+        d_map[node->d_time] = node;
+    }
+    else {
+        node->d_prev_p = it->second->d_prev_p;
+        it->second->d_prev_p->d_next_p = node;
+        node->d_next_p = it->second;
+        it->second->d_prev_p = node;
+    }
+}
+
+template <class DATA>
+void TimeQueue<DATA>::unlinkNode(Node *node)
+{
+    if (d_wheel_p) {
+        d_wheel_p->remove(node);
+        return;                                                       // RETURN
+    }
+
+    if (node->d_next_p != node) {
+        node->d_prev_p->d_next_p = node->d_next_p;
+        node->d_next_p->d_prev_p = node->d_prev_p;
+
+        MapIter it = d_map.find(node->d_time);
+        if (it->second == node) {
+            it->second = node->d_next_p;
+        }
+    }
+    else {
+        d_map.erase(node->d_time);
+    }
+}
+
 template <class DATA>
 template <class VECTOR>
 void TimeQueue<DATA>::popLEImp(const bsls::TimeInterval&  time,
@@ -1268,6 +1426,41 @@ void TimeQueue<DATA>::popLEImp(const bsls::TimeInterval&  time,
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
+    if (d_wheel_p) {
+        Node *begin = 0;
+
+        bdlc::TimingWheelLink *link = d_wheel_p->popLE(wheelTime(time));
+        while (link) {
+            Node *node = static_cast<Node *>(link);
+            link = link->next();
+
+            if (buffer) {
+                buffer->push_back(TimeQueueItem<DATA>(node->d_time,
+                                                      node->d_data.object(),
+                                                      node->d_index,
+                                                      node->d_key,
+                                                      d_allocator_p));
+            }
+            freeNode(node);
+            node->d_next_p = begin;
+            begin = node;
+            --d_length;
+        }
+
+        if (newLength) {
+            *newLength = d_length;
+        }
+        if (newMinTime) {
+            if (Node *front = frontNode()) {
+                *newMinTime = front->d_time;
+            }
+        }
+
+        lock.release()->unlock();
+        putFreeNodeList(begin);
+        return;                                                       // RETURN
+    }
+
     MapIter it = d_map.begin();
 
     Node *begin = 0;
@@ -1322,6 +1515,44 @@ void TimeQueue<DATA>::popLEImp(const bsls::TimeInterval&  time,
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
+    if (d_wheel_p) {
+        const bsls::Types::Int64  limit = wheelTime(time);
+        Node                     *begin = 0;
+
+        d_wheel_p->advance(limit);
+
+        Node *front = frontNode();
+
+        while (front && front->time() <= limit && 0 < maxTimers) {
+            if (buffer) {
+                buffer->push_back(TimeQueueItem<DATA>(front->d_time,
+                                                      front->d_data.object(),
+                                                      front->d_index,
+                                                      front->d_key,
+                                                      d_allocator_p));
+            }
+            d_wheel_p->remove(front);
+            freeNode(front);
+            front->d_next_p = begin;
+            begin = front;
+            --d_length;
+            --maxTimers;
+
+            front = frontNode();
+        }
+
+        if (newLength) {
+            *newLength = d_length;
+        }
+        if (front && newMinTime) {
+            *newMinTime = front->d_time;
+        }
+
+        lock.release()->unlock();
+        putFreeNodeList(begin);
+        return;                                                       // RETURN
+    }
+
     MapIter it = d_map.begin();
 
     Node *begin = 0;
@@ -1429,6 +1660,16 @@ typename TimeQueue<DATA>::Node *TimeQueue<DATA>::getNodeFromHandle(
     return node;
 }
 
+template <class DATA>
+inline
+typename TimeQueue<DATA>::Node *TimeQueue<DATA>::frontNode() const
+{
+    if (d_wheel_p) {
+        return static_cast<Node *>(d_wheel_p->front());               // RETURN
+    }
+    return d_map.empty() ? 0 : d_map.begin()->second;
+}
+
 // CREATORS
 template <class DATA>
 TimeQueue<DATA>::TimeQueue(bslma::Allocator *basicAllocator)
@@ -1439,6 +1680,7 @@ TimeQueue<DATA>::TimeQueue(bslma::Allocator *basicAllocator)
 , d_nextFreeNode_p(0)
 , d_map(basicAllocator)
 , d_length(0)
+, d_wheel_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -1453,6 +1695,7 @@ TimeQueue<DATA>::TimeQueue(bool              poolTimerMemory,
 , d_nextFreeNode_p(0)
 , d_map(basicAllocator)
 , d_length(0)
+, d_wheel_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     // The 'poolTimerMemory' option has been deprecated (see method
@@ -1470,6 +1713,7 @@ TimeQueue<DATA>::TimeQueue(int numIndexBits, bslma::Allocator *basicAllocator)
 , d_nextFreeNode_p(0)
 , d_map(basicAllocator)
 , d_length(0)
+, d_wheel_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(k_NUM_INDEX_BITS_MIN <= numIndexBits
@@ -1487,6 +1731,7 @@ TimeQueue<DATA>::TimeQueue(int               numIndexBits,
 , d_nextFreeNode_p(0)
 , d_map(basicAllocator)
 , d_length(0)
+, d_wheel_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(k_NUM_INDEX_BITS_MIN <= numIndexBits
@@ -1499,6 +1744,42 @@ TimeQueue<DATA>::TimeQueue(int               numIndexBits,
 
 }
 
+template <class DATA>
+TimeQueue<DATA>::TimeQueue(bdlc::TimerStoreType::Enum  storeType,
+                           bslma::Allocator           *basicAllocator)
+: d_indexMask((1U << k_NUM_INDEX_BITS_DEFAULT) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_map(basicAllocator)
+, d_length(0)
+, d_wheel_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    createStore(storeType);
+}
+
+template <class DATA>
+TimeQueue<DATA>::TimeQueue(int                         numIndexBits,
+                           bdlc::TimerStoreType::Enum  storeType,
+                           bslma::Allocator           *basicAllocator)
+: d_indexMask((1 << numIndexBits) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_map(basicAllocator)
+, d_length(0)
+, d_wheel_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(k_NUM_INDEX_BITS_MIN <= numIndexBits
+             && k_NUM_INDEX_BITS_MAX >= numIndexBits);
+
+    createStore(storeType);
+}
+
 template <class DATA>
 TimeQueue<DATA>::~TimeQueue()
 {
@@ -1510,6 +1791,9 @@ TimeQueue<DATA>::~TimeQueue()
             d_allocator_p->deleteObjectRaw(data[i]);
         }
     }
+    if (d_wheel_p) {
+        d_allocator_p->deleteObjectRaw(d_wheel_p);
+    }
 }
 
 // MANIPULATORS
@@ -1568,25 +1852,11 @@ typename TimeQueue<DATA>:: Handle TimeQueue<DATA>::add(
                                             data,
                                             d_allocator_p);
 
-    {
-        MapIter it = d_map.find(time);
-
-        if (d_map.end() == it) {
-            node->d_prev_p = node;
-            node->d_next_p = node;
-            d_map[time] = node;
-        }
-        else {
-            node->d_prev_p = it->second->d_prev_p;
-            it->second->d_prev_p->d_next_p = node;
-            node->d_next_p = it->second;
-            it->second->d_prev_p = node;
-        }
-    }
+    linkNode(node);
 
     ++d_length;
     if (isNewTop) {
-        *isNewTop = d_map.begin()->second == node && node->d_prev_p == node;
+        *isNewTop = frontNode() == node && node->d_prev_p == node;
     }
 
     if (newLength) {
@@ -1612,12 +1882,12 @@ int TimeQueue<DATA>::popFront(TimeQueueItem<DATA> *buffer,
                               bsls::TimeInterval  *newMinTime)
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-    MapIter it = d_map.begin();
 
-    if (d_map.end() == it) {
+    Node *node = frontNode();
+
+    if (!node) {
         return 1;                                                     // RETURN
     }
-    Node *node = it->second;
 
     if (buffer) {
         buffer->time()   = node->d_time;
@@ -1625,22 +1895,13 @@ int TimeQueue<DATA>::popFront(TimeQueueItem<DATA> *buffer,
         buffer->handle() = node->d_index;
         buffer->key()    = node->d_key;
     }
-    if (node->d_next_p != node) {
-        node->d_prev_p->d_next_p = node->d_next_p;
-        node->d_next_p->d_prev_p = node->d_prev_p;
-        if (it->second == node) {
-            it->second = node->d_next_p;
-        }
-    }
-    else {
-        d_map.erase(it);
-    }
+    unlinkNode(node);
 
     freeNode(node);
     --d_length;
 
-    if (d_length && newMinTime && !d_map.empty()) {
-        *newMinTime = d_map.begin()->first;
+    if (d_length && newMinTime) {
+        *newMinTime = frontNode()->d_time;
     }
 
     if (newLength) {
@@ -1768,18 +2029,7 @@ int TimeQueue<DATA>::remove(typename TimeQueue<DATA>::Handle  handle,
         item->key()    = node->d_key;
     }
 
-    if (node->d_next_p != node) {
-        node->d_prev_p->d_next_p = node->d_next_p;
-        node->d_next_p->d_prev_p = node->d_prev_p;
-
-        MapIter it = d_map.find(node->d_time);
-        if (it->second == node) {
-            it->second = node->d_next_p;
-        }
-    }
-    else {
-        d_map.erase(node->d_time);
-    }
+    unlinkNode(node);
     freeNode(node);
     --d_length;
 
@@ -1788,9 +2038,9 @@ int TimeQueue<DATA>::remove(typename TimeQueue<DATA>::Handle  handle,
     }
 
     if (d_length && newMinTime) {
-        BSLS_ASSERT(! d_map.empty());
+        BSLS_ASSERT(frontNode());
 
-        *newMinTime = d_map.begin()->first;
+        *newMinTime = frontNode()->d_time;
     }
 
     lock.release()->unlock();
@@ -1803,9 +2053,46 @@ template <class DATA>
 void TimeQueue<DATA>::removeAll(bsl::vector<TimeQueueItem<DATA> > *removedItems)
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-    MapIter it = d_map.begin();
 
     Node *begin = 0;
+
+    if (d_wheel_p) {
+        // Unlike `popLE`, `removeAll` does not advance the current time of
+        // the wheel, which would make every item added later overdue.  The
+        // removed items are in no particular order, and so are sorted.
+
+        const bsl::size_t numPrevious = removedItems
+                                      ? removedItems->size()
+                                      : 0;
+
+        bdlc::TimingWheelLink *link = d_wheel_p->removeAll();
+        while (link) {
+            Node *node = static_cast<Node *>(link);
+            link = link->next();
+
+            if (removedItems) {
+                removedItems->push_back(TimeQueueItem<DATA>(
+                                                         node->d_time,
+                                                         node->d_data.object(),
+                                                         node->d_index,
+                                                         node->d_key,
+                                                         d_allocator_p));
+            }
+            freeNode(node);
+            node->d_next_p = begin;
+            begin = node;
+            --d_length;
+        }
+
+        if (removedItems) {
+            bsl::sort(removedItems->begin() + numPrevious,
+                      removedItems->end(),
+                      &isEarlier);
+        }
+    }
+
+    MapIter it = d_map.begin();
+
     while (d_map.end() != it) {
         Node *const first = it->second;
         Node *const last  = first->d_prev_p;
@@ -1848,6 +2135,34 @@ void TimeQueue<DATA>::removeIf(
 
     MapIter  it           = d_map.begin();
     Node    *freeNodeList = 0;
+
+    if (d_wheel_p) {
+        // The wheel cannot be traversed, so visit every node that is in this
+        // queue.
+
+        const bsl::size_t numNodes = d_nodeArray.size();
+        for (bsl::size_t i = 0; i < numNodes; ++i) {
+            Node *node = d_nodeArray[i];
+
+            if (0 == node->d_prev_p || !predicate(node->d_data.object())) {
+                continue;
+            }
+            if (removedItems) {
+                removedItems->push_back(TimeQueueItem<DATA>(
+                                                         node->d_time,
+                                                         node->d_data.object(),
+                                                         node->d_index,
+                                                         node->d_key,
+                                                         d_allocator_p));
+            }
+            d_wheel_p->remove(node);
+            freeNode(node);
+            --d_length;
+            node->d_next_p = freeNodeList;
+            freeNodeList   = node;
+        }
+    }
+
     while (d_map.end() != it) {
         // We cache the next iterator, in case we erase this element because
         // its linked list of nodes is empty.
@@ -1902,9 +2217,9 @@ void TimeQueue<DATA>::removeIf(
         *newLength = d_length;
     }
     if (d_length && newMinTime) {
-        BSLS_ASSERT(! d_map.empty());
+        BSLS_ASSERT(frontNode());
 
-        *newMinTime = d_map.begin()->first;
+        *newMinTime = frontNode()->d_time;
     }
     lock.release()->unlock();
     putFreeNodeList(freeNodeList);
@@ -1933,36 +2248,12 @@ int TimeQueue<DATA>::update(typename TimeQueue<DATA>::Handle  handle,
         return 1;                                                     // RETURN
     }
 
-    if (node->d_prev_p != node) {
-        node->d_prev_p->d_next_p = node->d_next_p;
-        node->d_next_p->d_prev_p = node->d_prev_p;
-
-        MapIter it = d_map.find(node->d_time);
-        if (it->second == node) {
-            it->second = node->d_next_p;
-        }
-    }
-    else {
-        d_map.erase(node->d_time);
-    }
+    unlinkNode(node);
     node->d_time = newTime;
-
-    MapIter it = d_map.find(newTime);
-
-    if (d_map.end() == it) {
-        node->d_prev_p = node;
-        node->d_next_p = node;
-        d_map[newTime] = node;
-    }
-    else {
-        node->d_prev_p = it->second->d_prev_p;
-        it->second->d_prev_p->d_next_p = node;
-        node->d_next_p = it->second;
-        it->second->d_prev_p = node;
-    }
+    linkNode(node);
 
     if (isNewTop) {
-        *isNewTop = d_map.begin()->second == node && node->d_prev_p == node;
+        *isNewTop = frontNode() == node && node->d_prev_p == node;
     }
     return 0;
 }
@@ -1996,17 +2287,27 @@ bool TimeQueue<DATA>::isRegisteredHandle(
     return node != 0;
 }
 
+template <class DATA>
+inline
+bdlc::TimerStoreType::Enum TimeQueue<DATA>::storeType() const
+{
+    return d_wheel_p ? bdlc::TimerStoreType::e_TIMING_WHEEL
+                     : bdlc::TimerStoreType::e_ORDERED;
+}
+
 template <class DATA>
 inline
 int TimeQueue<DATA>::minTime(bsls::TimeInterval *buffer) const
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    if (d_map.empty()) {
+    Node *node = frontNode();
+
+    if (!node) {
         return 1;                                                     // RETURN
     }
 
-    *buffer = d_map.begin()->first;
+    *buffer = node->d_time;
     return 0;
 }
 
@@ -2018,6 +2319,19 @@ int TimeQueue<DATA>::countLE(const bsls::TimeInterval& time) const
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
+    if (d_wheel_p) {
+        const bsls::Types::Int64 limit    = wheelTime(time);
+        const bsl::size_t        numNodes = d_nodeArray.size();
+
+        for (bsl::size_t i = 0; i < numNodes; ++i) {
+            const Node *node = d_nodeArray[i];
+            if (node->d_prev_p && node->time() <= limit) {
+                ++count;
+            }
+        }
+        return count;                                                 // RETURN
+    }
+
     for (MapCIter it = d_map.cbegin();
          it != d_map.cend() && it->first <= time;
          ++it) {
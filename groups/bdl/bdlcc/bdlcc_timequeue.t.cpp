@@ -37,6 +37,7 @@
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_charconv.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -72,6 +73,7 @@ using namespace bsl;
 // list) is also a concern and tested in case 11.
 //-----------------------------------------------------------------------------
 // [3 ] bdlcc::TimeQueue(bslma::Allocator *allocator=0);
+// [17] bdlcc::TimeQueue(bdlc::TimerStoreType::Enum, bslma::Allocator *);
 // [3 ] ~bdlcc::TimeQueue();
 // [5 ] int popFront(bdlcc::TimeQueueItem<DATA> *buffer);
 // [6 ] int popFront(bdlcc::TimeQueueItem<DATA> *buffer,...
@@ -85,6 +87,7 @@ using namespace bsl;
 // [11] int length() const;
 // [3 ] bool isRegisteredHandle(int handle) const;
 // [3 ] int minTime(bsls::TimeInterval *buffer);
+// [17] bdlc::TimerStoreType::Enum storeType() const;
 // [11] int countLE(const bsls::TimeInterval& time) const;
 //-----------------------------------------------------------------------------
 // [1 ] BREATHING TEST
@@ -96,7 +99,8 @@ using namespace bsl;
 // [13] CONCERN: Memory Pooling
 // [14] CONCERN: ORDER PRESERVATION
 // [15] CONCERN: OVERFLOW OF INDEX GENERATION COUNT
-// [17] USAGE EXAMPLE
+// [17] CONCERN: TIMING WHEEL STORE ORDERS ITEMS AS THE DEFAULT STORE
+// [18] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -1598,7 +1602,7 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // TEST USAGE EXAMPLE
         //   The usage example from the header has been incorporated into this
@@ -1629,6 +1633,363 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // CONCERN: TIMING WHEEL STORE ORDERS ITEMS AS THE DEFAULT STORE
+        //
+        // Concerns:
+        // 1. `storeType` reports the store selected at construction, which is
+        //    `e_ORDERED` by default.
+        //
+        // 2. For time values that are whole microseconds, a queue using a
+        //    timing wheel returns the same items, in the same order, and
+        //    reports the same lengths and minimum times as a queue using the
+        //    default store, for any sequence of operations.
+        //
+        // 3. A queue using a timing wheel compares time values at microsecond
+        //    resolution.
+        //
+        // 4. A queue using a timing wheel allocates from the allocator
+        //    supplied at construction, and releases all memory on
+        //    destruction, including when items remain in the queue.
+        //
+        // 5. `popFront` and `removeAll` do not advance the current time of
+        //    the timing wheel, so items added afterwards with earlier times
+        //    are not overdue, and `removeAll` returns the items ordered by
+        //    time.
+        //
+        // Plan:
+        // 1. Create queues with and without a store type and verify
+        //    `storeType`.  (C-1)
+        //
+        // 2. Apply a long random sequence of operations to a queue of each
+        //    store type, and verify after each operation that the results,
+        //    `length`, `minTime`, and `countLE` of the two queues agree.
+        //    (C-2)
+        //
+        // 3. Add items whose time values differ by less than a microsecond to
+        //    a queue using a timing wheel, and verify that they are ordered by
+        //    insertion and popped together.  (C-3)
+        //
+        // 4. Use a test allocator and verify that no memory is obtained from
+        //    the default allocator, and that none is outstanding after
+        //    destruction.  (C-4)
+        //
+        // 5. Add items far in the future, in scrambled order of time, to a
+        //    queue using a timing wheel.  Pop the front item, then remove all
+        //    items and verify their order.  Add items with earlier times, and
+        //    verify that they are popped in order of time.  Note that the
+        //    slots of a wheel hold the links not earlier than its current
+        //    time, which `removeAll` preserves (see `bdlc_timingwheel`).
+        //    (C-5)
+        //
+        // Testing:
+        //   bdlcc::TimeQueue(bdlc::TimerStoreType::Enum, bslma::Allocator *);
+        //   bdlc::TimerStoreType::Enum storeType() const;
+        //   CONCERN: TIMING WHEEL STORE ORDERS ITEMS AS THE DEFAULT STORE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+             << "CONCERN: TIMING WHEEL STORE ORDERS ITEMS AS THE DEFAULT STORE"
+             << endl
+             << "============================================================="
+             << endl;
+
+        typedef bdlcc::TimeQueue<int>     IntQueue;
+        typedef bdlcc::TimeQueueItem<int> IntItem;
+        typedef bsl::vector<IntItem>      IntItems;
+
+        const bdlc::TimerStoreType::Enum ORDERED =
+                                              bdlc::TimerStoreType::e_ORDERED;
+        const bdlc::TimerStoreType::Enum WHEEL =
+                                         bdlc::TimerStoreType::e_TIMING_WHEEL;
+
+        if (verbose) cout << "\tTesting `storeType`." << endl;
+        {
+            IntQueue mA(&ta);
+            IntQueue mB(WHEEL, &ta);
+            IntQueue mC(20, WHEEL, &ta);
+            IntQueue mD(ORDERED, &ta);
+
+            ASSERT(ORDERED == mA.storeType());
+            ASSERT(WHEEL   == mB.storeType());
+            ASSERT(WHEEL   == mC.storeType());
+            ASSERT(ORDERED == mD.storeType());
+        }
+
+        if (verbose) cout << "\tComparing the two stores." << endl;
+        {
+            struct Compare {
+                static bool isLess(const IntItem& a, const IntItem& b)
+                {
+                    return a.time() < b.time()
+                        || (a.time() == b.time() && a.data() < b.data());
+                }
+
+                static void items(int line, const IntItems& a,
+                                  const IntItems& b)
+                {
+                    ASSERTV(line, a.size(), b.size(), a.size() == b.size());
+                    for (bsl::size_t i = 0; i < a.size() && i < b.size();
+                                                                         ++i) {
+                        ASSERTV(line, i, a[i].data(), b[i].data(),
+                                a[i].data() == b[i].data());
+                        ASSERTV(line, i, a[i].time() == b[i].time());
+                    }
+                }
+            };
+
+            const int NUM_IDS = 300;
+            const int NUM_OPS = 20000;
+
+            IntQueue mA(ORDERED, &ta);
+            IntQueue mB(WHEEL, &ta);
+
+            // Handles of the item having each id in each queue, or -1.
+
+            bsl::vector<int> handlesA(NUM_IDS, -1, &ta);
+            bsl::vector<int> handlesB(NUM_IDS, -1, &ta);
+
+            IntItems itemsA(&ta);
+            IntItems itemsB(&ta);
+
+            bsls::TimeInterval now(1000, 0);
+            int                seed = 17;
+
+            for (int op = 0; op < NUM_OPS; ++op) {
+                const int id     = bdlb::Random::generate15(&seed) % NUM_IDS;
+                const int choice = bdlb::Random::generate15(&seed) % 100;
+
+                // Times are whole microseconds, spread from 1s before "now" to
+                // about 30s after it, and often repeated.
+
+                const int          r     = bdlb::Random::generate15(&seed);
+                bsls::TimeInterval time  = now;
+                time.addMicroseconds(r % 3 ? (r - 1000) * 1000 : r % 4000);
+
+                itemsA.clear();
+                itemsB.clear();
+
+                if (choice < 40) {
+                    if (-1 == handlesA[id]) {
+                        int isNewTopA, isNewTopB, newLengthA, newLengthB;
+
+                        handlesA[id] = mA.add(time, id, &isNewTopA,
+                                              &newLengthA);
+                        handlesB[id] = mB.add(time, id, &isNewTopB,
+                                              &newLengthB);
+                        ASSERTV(op, isNewTopA == isNewTopB);
+                        ASSERTV(op, newLengthA == newLengthB);
+                    }
+                    else {
+                        int isNewTopA, isNewTopB;
+
+                        ASSERT(0 == mA.update(handlesA[id], time, &isNewTopA));
+                        ASSERT(0 == mB.update(handlesB[id], time, &isNewTopB));
+                        ASSERTV(op, isNewTopA == isNewTopB);
+                    }
+                }
+                else if (choice < 60) {
+                    if (-1 != handlesA[id]) {
+                        IntItem itemA(&ta), itemB(&ta);
+
+                        ASSERT(0 == mA.remove(handlesA[id], 0, 0, &itemA));
+                        ASSERT(0 == mB.remove(handlesB[id], 0, 0, &itemB));
+                        ASSERTV(op, itemA.data() == itemB.data());
+                        ASSERTV(op, itemA.time() == itemB.time());
+                        handlesA[id] = handlesB[id] = -1;
+                    }
+                }
+                else if (choice < 70) {
+                    IntItem itemA(&ta), itemB(&ta);
+
+                    const int rcA = mA.popFront(&itemA);
+                    const int rcB = mB.popFront(&itemB);
+                    ASSERTV(op, rcA == rcB);
+                    if (0 == rcA && 0 == rcB) {
+                        ASSERTV(op, itemA.data(), itemB.data(),
+                                itemA.data() == itemB.data());
+                        itemsA.push_back(itemA);
+                    }
+                }
+                else if (choice < 85) {
+                    now.addMilliseconds(r % 500);
+
+                    int                newLengthA, newLengthB;
+                    bsls::TimeInterval minTimeA, minTimeB;
+
+                    if (choice < 80) {
+                        mA.popLE(now, &itemsA, &newLengthA, &minTimeA);
+                        mB.popLE(now, &itemsB, &newLengthB, &minTimeB);
+                    }
+                    else {
+                        mA.popLE(now, r % 8, &itemsA, &newLengthA, &minTimeA);
+                        mB.popLE(now, r % 8, &itemsB, &newLengthB, &minTimeB);
+                    }
+                    Compare::items(op, itemsA, itemsB);
+                    ASSERTV(op, newLengthA == newLengthB);
+                    if (newLengthA) {
+                        ASSERTV(op, minTimeA == minTimeB);
+                    }
+                }
+                else if (choice < 95) {
+                    ASSERTV(op, mA.countLE(time) == mB.countLE(time));
+                }
+                else if (choice < 99) {
+                    const int divisor = 2 + r % 5;
+
+                    struct Predicate {
+                        static bool isMultiple(int divisor, const int& value)
+                        {
+                            return 0 == value % divisor;
+                        }
+                    };
+
+                    bsl::function<bool(const int&)> predicate(
+                                bsl::allocator_arg,
+                                &ta,
+                                bdlf::BindUtil::bind(&Predicate::isMultiple,
+                                                     divisor,
+                                                     bdlf::PlaceHolders::_1));
+
+                    mA.removeIf(predicate, 0, 0, &itemsA);
+                    mB.removeIf(predicate, 0, 0, &itemsB);
+                    ASSERTV(op, itemsA.size() == itemsB.size());
+                    for (bsl::size_t i = 0; i < itemsB.size(); ++i) {
+                        ASSERTV(op, 0 == itemsB[i].data() % divisor);
+                    }
+                }
+                else {
+                    // Items removed by `removeAll` having the same time are
+                    // in no particular order.
+
+                    mA.removeAll(&itemsA);
+                    mB.removeAll(&itemsB);
+                    for (bsl::size_t i = 1; i < itemsB.size(); ++i) {
+                        ASSERTV(op, i,
+                                itemsB[i - 1].time() <= itemsB[i].time());
+                    }
+                    bsl::sort(itemsA.begin(), itemsA.end(), &Compare::isLess);
+                    bsl::sort(itemsB.begin(), itemsB.end(), &Compare::isLess);
+                    Compare::items(op, itemsA, itemsB);
+                }
+
+                // Forget the handles of the removed items.
+
+                for (bsl::size_t i = 0; i < itemsA.size(); ++i) {
+                    handlesA[itemsA[i].data()] = -1;
+                    handlesB[itemsA[i].data()] = -1;
+                }
+
+                ASSERTV(op, mA.length() == mB.length());
+
+                bsls::TimeInterval minTimeA, minTimeB;
+                const int          rcA = mA.minTime(&minTimeA);
+                const int          rcB = mB.minTime(&minTimeB);
+                ASSERTV(op, rcA == rcB);
+                if (0 == rcA) {
+                    ASSERTV(op, minTimeA, minTimeB, minTimeA == minTimeB);
+                }
+            }
+
+            // Destroy the queues with items remaining.
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting microsecond resolution." << endl;
+        {
+            IntQueue mX(WHEEL, &ta);
+
+            const bsls::TimeInterval T0(5, 1000);
+            const bsls::TimeInterval T1(5, 1900);
+            const bsls::TimeInterval T2(5, 1100);
+            const bsls::TimeInterval T3(5, 2000);
+
+            mX.add(T1, 1);
+            mX.add(T2, 2);
+            mX.add(T3, 3);
+
+            bsls::TimeInterval minTime;
+            ASSERT(0 == mX.minTime(&minTime));
+            ASSERT(T1 == minTime);
+            ASSERT(2 == mX.countLE(T0));
+
+            IntItems items(&ta);
+            mX.popLE(T0, &items);
+            ASSERTV(items.size(), 2 == items.size());
+            if (2 == items.size()) {
+                ASSERT(1 == items[0].data());
+                ASSERT(2 == items[1].data());
+            }
+            ASSERT(1 == mX.length());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting `popFront` and `removeAll`." << endl;
+        {
+            const int NUM_ITEMS = 100;
+
+            IntQueue mX(WHEEL, &ta);
+
+            // Add items about a day in the future, in scrambled order of
+            // time, and pop the earliest.
+
+            for (int i = 0; i < NUM_ITEMS; ++i) {
+                const int k = i * 37 % NUM_ITEMS;
+
+                mX.add(bsls::TimeInterval(100000 + k, 0), k);
+            }
+
+            IntItem item(&ta);
+            ASSERT(0 == mX.popFront(&item));
+            ASSERT(0 == item.data());
+
+            IntItems items(&ta);
+            mX.removeAll(&items);
+            ASSERTV(items.size(), NUM_ITEMS - 1 == items.size());
+            for (bsl::size_t i = 0; i < items.size(); ++i) {
+                ASSERTV(i, items[i].data(),
+                        static_cast<int>(i) + 1 == items[i].data());
+            }
+            ASSERT(0 == mX.length());
+
+            // Add items with earlier times, again in scrambled order.
+
+            for (int i = 0; i < NUM_ITEMS; ++i) {
+                const int k = i * 37 % NUM_ITEMS;
+
+                mX.add(bsls::TimeInterval(10 + k, 0), k);
+            }
+
+            bsls::TimeInterval minTime;
+            ASSERT(0 == mX.minTime(&minTime));
+            ASSERT(bsls::TimeInterval(10, 0) == minTime);
+
+            for (int i = 0; i < NUM_ITEMS; ++i) {
+                ASSERTV(i, 0 == mX.popFront(&item));
+                ASSERTV(i, item.data(), i == item.data());
+            }
+            ASSERT(0 == mX.length());
+
+            for (int i = 0; i < NUM_ITEMS; ++i) {
+                const int k = i * 37 % NUM_ITEMS;
+
+                mX.add(bsls::TimeInterval(10 + k, 0), k);
+            }
+
+            items.clear();
+            mX.popLE(bsls::TimeInterval(10 + NUM_ITEMS / 2, 0), &items);
+            ASSERTV(items.size(), NUM_ITEMS / 2 + 1 == items.size());
+            for (bsl::size_t i = 0; i < items.size(); ++i) {
+                ASSERTV(i, items[i].data(),
+                        static_cast<int>(i) == items[i].data());
+            }
+            ASSERT(NUM_ITEMS / 2 - 1 == mX.length());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERTV(defaultAlloc.numBlocksTotal(),
+                0 == defaultAlloc.numBlocksTotal());
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TEST REMOVEIF MANIPULATOR
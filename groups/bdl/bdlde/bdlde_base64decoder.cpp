@@ -6,7 +6,49 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>  // for testing only
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_BASE64DECODER_SIMD_ENABLED
+# define BDLDE_BASE64DECODER_SSSE3_TARGET __attribute__((target("ssse3")))
+# define BDLDE_BASE64DECODER_AVX2_TARGET  __attribute__((target("avx2")))
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The bulk path of `convert` (see `decodeBlocks`) decodes runs of quads made
+// up solely of alphabet characters using one of the following kernels,
+// selected once per process according to the capabilities of the running
+// processor:
+//
+//: o `decodeScalar`: a portable loop decoding one quad per iteration.
+//:
+//: o `decodeSsse3`: decodes 16 characters into 12 bytes per iteration.  The
+//:   six 16-byte slices of the decoding table that cover the printable
+//:   characters are looked up with a chain of `pshufb` instructions,
+//:   xor-ing each slice with its predecessor so that only the lookup in the
+//:   slice a character belongs to survives; characters outside the alphabet
+//:   (whose table entries are `0xff`) and outside the printable range are
+//:   detected from the high bits of the result.  Two multiply-adds then
+//:   pack each four 6-bit values into three bytes.  The technique is
+//:   described at
+//:   http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+//:
+//: o `decodeAvx2`: the same computation on 256-bit registers, decoding 32
+//:   characters into 24 bytes per iteration.
+//
+// Each kernel stops at the first block containing a character that is not in
+// the alphabet, delegating the rest of the run to the next narrower kernel,
+// so that the quads preceding that character are still decoded in bulk.
 
 namespace {
 namespace u {
@@ -166,6 +208,224 @@ static const char urlAlphabet[256] = {
        ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
 };
 
+/// This type defines a function that decodes a sequence of quads of alphabet
+/// characters into 3 bytes each.
+typedef bsl::size_t (*DecodeFn)(char        *out,
+                                const char  *input,
+                                bsl::size_t  maxQuads,
+                                const char  *table);
+
+/// Decode to the specified `out` buffer, using the specified decoding
+/// `table`, at most the specified `maxQuads` quads of characters from the
+/// specified `input`, stopping at the first quad containing a character
+/// that is not in the alphabet, and return the number of quads decoded.
+bsl::size_t decodeScalar(char        *out,
+                         const char  *input,
+                         bsl::size_t  maxQuads,
+                         const char  *table)
+{
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(input);
+
+    bsl::size_t numQuads = 0;
+    for (; numQuads < maxQuads; ++numQuads) {
+        const unsigned x0 = static_cast<unsigned char>(table[in[0]]);
+        const unsigned x1 = static_cast<unsigned char>(table[in[1]]);
+        const unsigned x2 = static_cast<unsigned char>(table[in[2]]);
+        const unsigned x3 = static_cast<unsigned char>(table[in[3]]);
+
+        if ((x0 | x1 | x2 | x3) & 0x80) {
+            // Not an alphabet character; could be an error or a character to
+            // ignore.
+
+            break;                                                     // BREAK
+        }
+
+        out[0] = static_cast<char>((x0 << 2) | (x1 >> 4));
+        out[1] = static_cast<char>((x1 << 4) | (x2 >> 2));
+        out[2] = static_cast<char>((x2 << 6) |  x3);
+
+        in  += 4;
+        out += 3;
+    }
+
+    return numQuads;
+}
+
+#if defined(BDLDE_BASE64DECODER_SIMD_ENABLED)
+
+/// Return `true` if the running processor supports the SSSE3 instructions,
+/// and `false` otherwise.
+bool detectSsse3()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+}
+
+/// Return `true` if the running processor and operating system support the
+/// AVX2 instructions, and `false` otherwise.
+bool detectAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+/// Decode to the specified `out` buffer, using the specified decoding
+/// `table`, at most the specified `maxQuads` quads of characters from the
+/// specified `input`, stopping at the first quad containing a character
+/// that is not in the alphabet, and return the number of quads decoded.
+BDLDE_BASE64DECODER_SSSE3_TARGET
+bsl::size_t decodeSsse3(char        *out,
+                        const char  *input,
+                        bsl::size_t  maxQuads,
+                        const char  *table)
+{
+    // Load the slices of the table covering 0x20 to 0x7f (all other entries
+    // are `0xff`) and xor each with its predecessor for the lookup chain.
+
+    const __m128i *slices = reinterpret_cast<const __m128i *>(table);
+
+    __m128i lut[6];
+    for (int i = 0; i < 6; ++i) {
+        lut[i] = _mm_loadu_si128(slices + 2 + i);
+    }
+    for (int i = 5; 0 < i; --i) {
+        lut[i] = _mm_xor_si128(lut[i], lut[i - 1]);
+    }
+
+    const __m128i selection = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9,
+                                            8, 14, 13, 12, -1, -1, -1, -1);
+
+    bsl::size_t numQuads = 0;
+    while (4 <= maxQuads - numQuads) {
+        // Offset the characters to index the first slice.  Characters below
+        // 0x20 or above 0x7f become negative, and so look up 0 in every
+        // slice; each subsequent offset makes the characters of the
+        // previous slice negative.
+
+        __m128i x = _mm_subs_epi8(
+                          _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(input)),
+                          _mm_set1_epi8(0x20));
+
+        const __m128i tooSmall = x;
+
+        __m128i decoded = _mm_shuffle_epi8(lut[0], x);
+        for (int i = 1; i < 6; ++i) {
+            x       = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
+            decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut[i], x));
+        }
+
+        if (0 != _mm_movemask_epi8(_mm_or_si128(tooSmall, decoded))) {
+            break;                                                     // BREAK
+        }
+
+        // Pack `|00aaaaaa|00bbbbbb|00cccccc|00dddddd|` into
+        // `|00000000 aaaaaabb bbbbcccc ccdddddd|`, then select the bytes in
+        // output order.
+
+        decoded = _mm_maddubs_epi16(decoded, _mm_set1_epi16(0x0140));
+        decoded = _mm_madd_epi16(decoded, _mm_set1_epi32(0x00011000));
+        decoded = _mm_shuffle_epi8(decoded, selection);
+
+        bsl::memcpy(out, &decoded, 12);
+
+        input    += 16;
+        out      += 12;
+        numQuads += 4;
+    }
+
+    return numQuads + decodeScalar(out, input, maxQuads - numQuads, table);
+}
+
+/// Decode to the specified `out` buffer, using the specified decoding
+/// `table`, at most the specified `maxQuads` quads of characters from the
+/// specified `input`, stopping at the first quad containing a character
+/// that is not in the alphabet, and return the number of quads decoded.
+BDLDE_BASE64DECODER_AVX2_TARGET
+bsl::size_t decodeAvx2(char        *out,
+                       const char  *input,
+                       bsl::size_t  maxQuads,
+                       const char  *table)
+{
+    const __m128i *slices = reinterpret_cast<const __m128i *>(table);
+
+    __m256i lut[6];
+    for (int i = 0; i < 6; ++i) {
+        lut[i] = _mm256_broadcastsi128_si256(
+                                          _mm_loadu_si128(slices + 2 + i));
+    }
+    for (int i = 5; 0 < i; --i) {
+        lut[i] = _mm256_xor_si256(lut[i], lut[i - 1]);
+    }
+
+    const __m256i selection = _mm256_broadcastsi128_si256(
+                             _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9,
+                                           8, 14, 13, 12, -1, -1, -1, -1));
+
+    bsl::size_t numQuads = 0;
+    while (8 <= maxQuads - numQuads) {
+        __m256i x = _mm256_subs_epi8(
+                       _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(input)),
+                       _mm256_set1_epi8(0x20));
+
+        const __m256i tooSmall = x;
+
+        __m256i decoded = _mm256_shuffle_epi8(lut[0], x);
+        for (int i = 1; i < 6; ++i) {
+            x       = _mm256_subs_epi8(x, _mm256_set1_epi8(0x10));
+            decoded = _mm256_xor_si256(decoded,
+                                       _mm256_shuffle_epi8(lut[i], x));
+        }
+
+        if (0 != _mm256_movemask_epi8(_mm256_or_si256(tooSmall, decoded))) {
+            break;                                                     // BREAK
+        }
+
+        decoded = _mm256_maddubs_epi16(decoded, _mm256_set1_epi16(0x0140));
+        decoded = _mm256_madd_epi16(decoded, _mm256_set1_epi32(0x00011000));
+        decoded = _mm256_shuffle_epi8(decoded, selection);
+
+        const __m128i low  = _mm256_castsi256_si128(decoded);
+        const __m128i high = _mm256_extracti128_si256(decoded, 1);
+
+        bsl::memcpy(out,      &low,  12);
+        bsl::memcpy(out + 12, &high, 12);
+
+        input    += 32;
+        out      += 24;
+        numQuads += 8;
+    }
+
+    // Clear the upper halves of the AVX registers before executing the
+    // (non-VEX) SSSE3 instructions to avoid the state transition penalty.
+
+    _mm256_zeroupper();
+
+    return numQuads + decodeSsse3(out, input, maxQuads - numQuads, table);
+}
+
+#endif
+
+/// Return the fastest block-decoding kernel available on the running
+/// platform.
+DecodeFn decodeFunction()
+{
+    static DecodeFn decodeFn = 0;
+
+    BSLMT_ONCE_DO {
+#if defined(BDLDE_BASE64DECODER_SIMD_ENABLED)
+        decodeFn = detectAvx2()  ? &decodeAvx2
+                 : detectSsse3() ? &decodeSsse3
+                 :                 &decodeScalar;
+#else
+        decodeFn = &decodeScalar;
+#endif
+    }
+
+    return decodeFn;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -176,6 +436,17 @@ namespace bdlde {
                          // class Base64Decoder
                          // -------------------
 
+// PRIVATE ACCESSORS
+bsl::size_t Base64Decoder::decodeBlocks(char        *out,
+                                        const char  *input,
+                                        bsl::size_t  maxQuads) const
+{
+    BSLS_ASSERT(out   || 0 == maxQuads);
+    BSLS_ASSERT(input || 0 == maxQuads);
+
+    return u::decodeFunction()(out, input, maxQuads, d_alphabet_p);
+}
+
 // CREATORS
 Base64Decoder::Base64Decoder(const Base64DecoderOptions& options)
 : d_outputLength(0)
@@ -227,9 +498,67 @@ Base64Decoder::~Base64Decoder()
     BSLS_ASSERT(0 <= d_outputLength);
 }
 
+                         // ------------------------
+                         // struct Base64Decoder_Impl
+                         // ------------------------
+
+// CLASS METHODS
+bsl::size_t Base64Decoder_Impl::decode(char                 *out,
+                                       const char           *input,
+                                       bsl::size_t           maxQuads,
+                                       Base64Alphabet::Enum  alphabet,
+                                       Kernel                kernel)
+{
+    BSLS_ASSERT(out   || 0 == maxQuads);
+    BSLS_ASSERT(input || 0 == maxQuads);
+    BSLS_ASSERT(isAvailable(kernel));
+
+    const char *table = Base64Alphabet::e_BASIC == alphabet
+                      ? u::basicAlphabet
+                      : u::urlAlphabet;
+
+    switch (kernel) {
+#if defined(BDLDE_BASE64DECODER_SIMD_ENABLED)
+      case e_SSSE3: {
+        return u::decodeSsse3(out, input, maxQuads, table);           // RETURN
+      }
+      case e_AVX2: {
+        return u::decodeAvx2(out, input, maxQuads, table);            // RETURN
+      }
+#endif
+      default: {
+        return u::decodeScalar(out, input, maxQuads, table);          // RETURN
+      }
+    }
+}
+
+bool Base64Decoder_Impl::isAvailable(Kernel kernel)
+{
+    switch (kernel) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      }
+#if defined(BDLDE_BASE64DECODER_SIMD_ENABLED)
+      case e_SSSE3: {
+        return u::detectSsse3();                                      // RETURN
+      }
+      case e_AVX2: {
+        return u::detectAvx2();                                       // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BDLDE_BASE64DECODER_AVX2_TARGET
+#undef BDLDE_BASE64DECODER_SSSE3_TARGET
+#undef BDLDE_BASE64DECODER_SIMD_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
 //
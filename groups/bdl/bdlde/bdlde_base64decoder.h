@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Base64Decoder: automata performing Base64 decoding operations
+//  bdlde::Base64Decoder_Impl: block-decoding kernels (for testing only)
 //
 //@SEE_ALSO: bdlde_base64encoder
 //
@@ -183,6 +184,24 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Decoding Contiguous Input
+///-------------------------
+// When `convert` is called with a `char *` output buffer and a
+// `const char *` input range (or the corresponding `unsigned char` pointer
+// types), every run of complete 4-character quads consisting only of
+// alphabet characters is decoded in bulk; character-by-character decoding is
+// used only for the quads containing anything else (whitespace, `=`, or an
+// invalid character), after which bulk decoding resumes.  The bulk decoding
+// kernel is chosen once, at run time, from those supported by the processor:
+// on x86 platforms compiled with GCC or Clang, AVX2 and SSSE3 kernels decode
+// and validate 32 and 16 characters per step, respectively; elsewhere a
+// portable scalar loop is used.  The alphabet, ignore mode, padding, and
+// `maxNumOut` limit are honored exactly as for other iterator types, so the
+// output, the reported error position, and the state of the decoder do not
+// depend on which path was taken.  The kernels are made available for
+// testing through the component-private `struct`
+// `bdlde::Base64Decoder_Impl`.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -347,16 +366,11 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdint.h>
 #include <bsl_iostream.h>
 
-#ifdef __SSE4_2__
-#include <emmintrin.h>
-#include <smmintrin.h>
-#include <tmmintrin.h>
-#endif
-
 namespace BloombergLP {
 namespace bdlde {
 
@@ -427,6 +441,18 @@ class Base64Decoder {
 
     // PRIVATE ACCESSORS
 
+    /// Decode to the specified `out` buffer at most the specified
+    /// `maxQuads` complete quads of characters, each of which is a member
+    /// of the alphabet of this decoder, from the start of the specified
+    /// `input`, and return the number of quads decoded.  Decoding stops at
+    /// the first quad containing any other character (including whitespace
+    /// and `=`).  Three bytes are written to `out` for each quad decoded.
+    /// The behavior is undefined unless `input` refers to at least
+    /// `4 * maxQuads` characters.
+    bsl::size_t decodeBlocks(char        *out,
+                             const char  *input,
+                             bsl::size_t  maxQuads) const;
+
     /// Return the number bits of output there are (either already done or
     /// to be done) since the end of the last 4-bytes of input.  Note that
     /// input to this decoder, other than ignored whitespace or garbage,
@@ -585,6 +611,43 @@ class Base64Decoder {
     int outputLength() const;
 };
 
+                         // =========================
+                         // struct Base64Decoder_Impl
+                         // =========================
+
+/// This component-private `struct` provides access to the alternative
+/// block-decoding kernels used by `Base64Decoder::convert` for contiguous
+/// input.  It should not be used other than to test and benchmark.
+struct Base64Decoder_Impl {
+
+    // TYPES
+    enum Kernel {
+        e_SCALAR,  // portable, one quad at a time
+        e_SSSE3,   // x86 SSSE3, 16 characters at a time
+        e_AVX2     // x86 AVX2, 32 characters at a time
+    };
+
+    // CLASS METHODS
+
+    /// Decode to the specified `out` buffer at most the specified
+    /// `maxQuads` complete quads of characters in the specified `alphabet`
+    /// from the start of the specified `input`, using the specified
+    /// `kernel`, and return the number of quads decoded.  Decoding stops at
+    /// the first quad containing a character that is not in `alphabet`.
+    /// Three bytes are written to `out` for each quad decoded.  The
+    /// behavior is undefined unless `input` refers to at least
+    /// `4 * maxQuads` characters and `isAvailable(kernel)` is `true`.
+    static bsl::size_t decode(char                 *out,
+                              const char           *input,
+                              bsl::size_t           maxQuads,
+                              Base64Alphabet::Enum  alphabet,
+                              Kernel                kernel);
+
+    /// Return `true` if the specified `kernel` is supported by the running
+    /// platform, and `false` otherwise.
+    static bool isAvailable(Kernel kernel);
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -822,147 +885,37 @@ int Base64Decoder::convert<char *, const char *>(
     const char *originalBegin = begin;
 
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(e_INPUT_STATE == d_state)) {
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_bitsInStack == 0)) {
-            // Optimize for common case
-#ifdef __SSE4_2__
-            // Load 16-byte slices of LUT.  Note that the entire 256-byte LUT
-            // is *not* loaded, but only the middle slices that are non-ff.
-            const __m128i *alphabetSlices =
-                               reinterpret_cast<const __m128i *>(d_alphabet_p);
-            __m128i lut5 = _mm_loadu_si128(alphabetSlices + 7);
-            __m128i lut4 = _mm_loadu_si128(alphabetSlices + 6);
-            __m128i lut3 = _mm_loadu_si128(alphabetSlices + 5);
-            __m128i lut2 = _mm_loadu_si128(alphabetSlices + 4);
-            __m128i lut1 = _mm_loadu_si128(alphabetSlices + 3);
-            __m128i lut0 = _mm_loadu_si128(alphabetSlices + 2);
-
-            // Heavily inspired by techniques outlined in
-            // http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
-
-            // xor LUT fragments together for pshufb-xor chaining below.
-            lut5 = _mm_xor_si128(lut5, lut4);
-            lut4 = _mm_xor_si128(lut4, lut3);
-            lut3 = _mm_xor_si128(lut3, lut2);
-            lut2 = _mm_xor_si128(lut2, lut1);
-            lut1 = _mm_xor_si128(lut1, lut0);
-
-            while (end - begin >= 16 && static_cast<unsigned>(numEmitted + 12)
-                                         <= static_cast<unsigned>(maxNumOut)) {
-                // Load 16 base64 characters (will eventually be transformed
-                // into 12 bytes)
-                __m128i x = _mm_loadu_si128(
-                                     reinterpret_cast<const __m128i *>(begin));
-
-                // Offset indexes to match first LUT slice at offset 0x20
-                x = _mm_subs_epi8(x, _mm_set1_epi8(0x20));
-
-                // If indexes were < 0x20, 'x' will contain negative values
-                // which we will check for later (minimum bounds check)
-                __m128i tooSmall = x;
-
-                // Using the characters as indexes, look up the corresponding
-                // values from the LUT.  If an index is non-negative, only its
-                // low 4 bits are considered.  If an index is negative, 0 is
-                // returned for its lookup value.
-                __m128i decoded = _mm_shuffle_epi8(lut0, x);
-
-                // Advance to the next LUT slice.  Note that if the previous
-                // slice was the correct one for a given index, the index will
-                // become negative after this, resulting in subsequent lookups
-                // simply xor-ing 0 (harmless no-ops).
-                x = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
-
-                // Perform the next lookup using the same low 4 bits of each
-                // non-negative index.  The result is then xor-ed with the
-                // previous lookup result.  For negative indices, this is a
-                // no-op, while for non-negative indices, the xor with the
-                // previous LUT slice value cancels out the xor-ing done to the
-                // LUT slices above the loop, leaving the original value from
-                // this LUT slice.
-                decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut1, x));
-
-                // Continue to advance to each LUT slice
-                x = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
-                decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut2, x));
-                x = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
-                decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut3, x));
-                x = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
-                decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut4, x));
-                x = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
-                decoded = _mm_xor_si128(decoded, _mm_shuffle_epi8(lut5, x));
-                x = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
-
-                // At this point, the indexes in 'x' should be negative, as
-                // we've exhausted all populated LUT slices.  If any are not,
-                // that indicates the maximum bounds check failed.
-
-                // Check the minimum and maximum bounds were respected, as well
-                // as for any 'ff' values loaded from LUT slices themselves.
-                if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-                         !_mm_testz_si128(tooSmall | decoded | ~x,
-                                    _mm_set1_epi8(static_cast<char>(0x80))))) {
-                    // Unknown char; could be error or could be a character to
-                    // ignore; either way fall back to regular decoding
-                    break;
+        while (18 >= d_bitsInStack && begin != end) {
+            if (0 == d_bitsInStack
+             && 4 <= end - begin
+             && 64 > static_cast<unsigned char>(
+                          d_alphabet_p[static_cast<unsigned char>(*begin)])) {
+                // Optimize for the common case: decode complete quads of
+                // alphabet characters in bulk, returning to the
+                // character-by-character decoding below at the first quad
+                // containing any other character (e.g., whitespace or `=`).
+
+                bsl::size_t maxQuads = (end - begin) / 4;
+                if (0 <= maxNumOut) {
+                    const bsl::size_t room = (maxNumOut - numEmitted) / 3;
+                    if (room < maxQuads) {
+                        maxQuads = room;
+                    }
                 }
 
-                // 'decoded' currently contains dwords layed out like
-                // |00aaaaaa|00bbbbbb|00cccccc|00dddddd|.  Convert to
-                // |0000aaaa aabbbbbb|0000cccc ccdddddd| with a multiply-add.
-                decoded = _mm_maddubs_epi16(decoded, _mm_set1_epi16(0x0140));
-
-                // Convert to final form of
-                // |00000000 aaaaaabb bbbbcccc ccdddddd| with another multiply-
-                // add.  Note that each triplet of values is aligned to a byte
-                // boundary following this operation.
-                decoded = _mm_madd_epi16(decoded, _mm_set1_epi32(0x00011000));
-
-                // Take care of endianness and last four one-byte gaps by
-                // explicitly selecting each byte we want in order.
-                __m128i selection = _mm_set_epi64(
-                               reinterpret_cast<__m64>(0xffffffff0c0d0e08ull),
-                               reinterpret_cast<__m64>(0x090a040506000102ull));
-                decoded = _mm_shuffle_epi8(decoded, selection);
-
-                // Store the result
-                memcpy(out, &decoded, 12);
-
-                begin += 16;
-                numEmitted += 12;
-                out += 12;
-            }
-#endif
-            while (end - begin >= 4 && static_cast<unsigned>(numEmitted + 3)
-                                         <= static_cast<unsigned>(maxNumOut)) {
-                bsls::AlignedBuffer<4, 4> inBuffer;
-                uint8_t *in = reinterpret_cast<uint8_t *>(inBuffer.buffer());
-                memcpy(in, begin, 4);
-
-                uint8_t x[4];
-                x[0] = static_cast<uint8_t>(d_alphabet_p[in[0]]);
-                x[1] = static_cast<uint8_t>(d_alphabet_p[in[1]]);
-                x[2] = static_cast<uint8_t>(d_alphabet_p[in[2]]);
-                x[3] = static_cast<uint8_t>(d_alphabet_p[in[3]]);
-
-                uint32_t x4;
-                memcpy(&x4, x, sizeof(x4));
-                if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(x4 & 0x80808080u)) {
-                    // Unknown char; could be error or could be a character to
-                    // ignore; either way fall back to char-by-char decoding
-                    break;
-                }
+                const bsl::size_t numQuads = decodeBlocks(out,
+                                                          begin,
+                                                          maxQuads);
 
-                out[0] = static_cast<char>((x[0] << 2) | (x[1] >> 4));
-                out[1] = static_cast<char>((x[1] << 4) | (x[2] >> 2));
-                out[2] = static_cast<char>((x[2] << 6) | (x[3] >> 0));
+                begin      += 4 * numQuads;
+                out        += 3 * numQuads;
+                numEmitted += static_cast<int>(3 * numQuads);
 
-                begin += 4;
-                numEmitted += 3;
-                out += 3;
+                if (begin == end) {
+                    break;                                             // BREAK
+                }
             }
-        }
 
-        while (18 >= d_bitsInStack && begin != end) {
             const unsigned char byte = static_cast<unsigned char>(*begin);
 
             ++begin;
@@ -1079,6 +1032,41 @@ int Base64Decoder::convert<unsigned char *, const unsigned char *>(
                    maxNumOut);
 }
 
+template<>
+inline
+int Base64Decoder::convert<char *, char *>(char *out,
+                                           int  *numOut,
+                                           int  *numIn,
+                                           char *begin,
+                                           char *end,
+                                           int   maxNumOut)
+{
+    return convert(out,
+                   numOut,
+                   numIn,
+                   const_cast<const char *>(begin),
+                   const_cast<const char *>(end),
+                   maxNumOut);
+}
+
+template<>
+inline
+int Base64Decoder::convert<unsigned char *, unsigned char *>(
+                                                    unsigned char *out,
+                                                    int           *numOut,
+                                                    int           *numIn,
+                                                    unsigned char *begin,
+                                                    unsigned char *end,
+                                                    int            maxNumOut)
+{
+    return convert(reinterpret_cast<char *>(out),
+                   numOut,
+                   numIn,
+                   reinterpret_cast<const char *>(begin),
+                   reinterpret_cast<const char *>(end),
+                   maxNumOut);
+}
+
 
 template <class OUTPUT_ITERATOR>
 int Base64Decoder::endConvert(OUTPUT_ITERATOR out)
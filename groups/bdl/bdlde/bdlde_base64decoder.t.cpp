@@ -26,6 +26,7 @@
 #include <bslma_testallocator.h>
 #include <bslmf_assert.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -38,8 +39,10 @@
 #include <bsl_climits.h>   // INT_MIN
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_set.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 #include <stdio.h>
@@ -241,6 +244,10 @@ using bsl::ptrdiff_t;
 // [13] TABLE PLUS RANDOM TESTING, UNPADDED MODE, INJECTED GARBAGE
 // [14] 0 == U_ENABLE_DEPRECATIONS
 // [15] Constructors.
+// [16] BULK DECODING OF CONTIGUOUS INPUT
+// [16] size_t Base64Decoder_Impl::decode(out, in, max, alphabet, kernel);
+// [16] bool Base64Decoder_Impl::isAvailable(Kernel kernel);
+// [-2] PERFORMANCE: `convert` throughput
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -2455,6 +2462,306 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(16)
+{
+    // ------------------------------------------------------------------------
+    // BULK DECODING OF CONTIGUOUS INPUT
+    //
+    // Concerns:
+    // 1. Each block-decoding kernel available on the running platform
+    //    decodes the same number of quads, into the same bytes, as the
+    //    scalar kernel, for both alphabets, stopping at the first quad
+    //    containing a character that is not in the alphabet, wherever that
+    //    character is.
+    //
+    // 2. `convert` with `char *` output and `const char *` input (which
+    //    decodes in bulk) produces the same output, `numOut`, `numIn`,
+    //    return value, and decoder state as `convert` with other iterator
+    //    types, for all alphabets, ignore modes, and padding options, and
+    //    for input containing line breaks, whitespace, padding, and invalid
+    //    characters.
+    //
+    // 3. The bulk path observes `maxNumOut`, and resumes correctly when
+    //    input is supplied in arbitrary segments.
+    //
+    // Plan:
+    // 1. For every number of quads up to 80, decode pseudo-random alphabet
+    //    characters, with and without a single injected non-alphabet
+    //    character at each position, with each available kernel, and
+    //    compare with the scalar kernel.  (C-1)
+    //
+    // 2. For a variety of options, encoded lengths, injected characters,
+    //    segment lengths, and output limits, decode with a pair of
+    //    decoders, one given `const char *` input and `char *` output, and
+    //    one given a `bsl::back_insert_iterator`, and verify that the
+    //    results of each call, and the final output, are the same.
+    //    (C-2..3)
+    //
+    // Testing:
+    //   BULK DECODING OF CONTIGUOUS INPUT
+    //   size_t Base64Decoder_Impl::decode(out, in, max, alphabet, kernel);
+    //   bool Base64Decoder_Impl::isAvailable(Kernel kernel);
+    // ------------------------------------------------------------------------
+
+    (void)veryVeryVeryVerbose;
+    (void)veryVeryVerbose;
+
+    if (verbose) cout << endl
+                      << "BULK DECODING OF CONTIGUOUS INPUT" << endl
+                      << "=================================" << endl;
+
+    typedef bdlde::Base64Decoder_Impl Impl;
+
+    static const char BASIC[] =
+          "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static const char URL[] =
+          "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+    // Characters that are not in (at least one of) the alphabets, including
+    // those adjacent to the ranges of alphabet characters.
+
+    static const char OTHERS[] = " \r\n\t=*@[`{.,:\x1f\x7f\x80\xff-_+/";
+    const int         NUM_OTHERS = static_cast<int>(sizeof OTHERS - 1);
+
+    u::RandGen rand;
+
+    if (verbose) cout << "\nCompare each kernel with the scalar kernel."
+                      << endl;
+    {
+        const Impl::Kernel KERNELS[] = { Impl::e_SSSE3, Impl::e_AVX2 };
+        const int          NUM_KERNELS = static_cast<int>(sizeof KERNELS
+                                                          / sizeof *KERNELS);
+
+        ASSERT(Impl::isAvailable(Impl::e_SCALAR));
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            const Impl::Kernel KERNEL = KERNELS[ti];
+
+            if (!Impl::isAvailable(KERNEL)) {
+                if (verbose) { T_ P_(KERNEL) Q(not available) }
+                continue;
+            }
+            if (verbose) { T_ P(KERNEL) }
+
+            for (int ai = 0; ai < 2; ++ai) {
+                const Alpha::Enum  ALPHABET = ai ? Alpha::e_URL
+                                                 : Alpha::e_BASIC;
+                const char        *CHARS    = ai ? URL : BASIC;
+
+                for (size_t n = 0; n <= 80; ++n) {
+                    bsl::string input(4 * n, 'A');
+                    for (size_t i = 0; i < input.length(); ++i) {
+                        input[i] = CHARS[rand() % 64];
+                    }
+
+                    // `-1 == badPos` means no injected character.
+
+                    for (int badPos = -1;
+                         badPos < static_cast<int>(input.length());
+                         ++badPos) {
+                        bsl::string in(input);
+                        if (0 <= badPos) {
+                            in[badPos] = OTHERS[rand() % NUM_OTHERS];
+                        }
+
+                        bsl::vector<char> exp(3 * n + 1, '?');
+                        bsl::vector<char> result(3 * n + 1, '?');
+
+                        const size_t EXP_N = Impl::decode(exp.data(),
+                                                          in.data(),
+                                                          n,
+                                                          ALPHABET,
+                                                          Impl::e_SCALAR);
+                        const size_t N     = Impl::decode(result.data(),
+                                                          in.data(),
+                                                          n,
+                                                          ALPHABET,
+                                                          KERNEL);
+
+                        ASSERTV(KERNEL, ALPHABET, n, badPos, EXP_N, N,
+                                EXP_N == N);
+                        ASSERTV(KERNEL, ALPHABET, n, badPos,
+                                0 != bsl::memcmp(exp.data(),
+                                                 result.data(),
+                                                 3 * N) ? false : true);
+                        ASSERTV(KERNEL, n, badPos, '?' == result[3 * N]);
+                        if (0 > badPos) {
+                            ASSERTV(KERNEL, n, n == N);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (verbose) cout << "\nCompare `convert` overloads." << endl;
+    {
+        const int LENGTHS[] = { 0, 1, 2, 3, 11, 12, 13, 47, 57, 100, 301 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        const int SEGMENTS[]  = { 1, 3, 17, 64, 10000 };
+        const int NUM_SEGMENTS = static_cast<int>(sizeof SEGMENTS
+                                                  / sizeof *SEGMENTS);
+
+        const int MAX_OUTS[]  = { -1, 1, 2, 7, 50 };
+        const int NUM_MAX_OUTS = static_cast<int>(sizeof MAX_OUTS
+                                                  / sizeof *MAX_OUTS);
+
+        const int NUM_INJECTIONS = 6;
+
+        for (int ei = 0; ei < 6; ++ei) {
+            const int         LINE_LENGTH  = ei & 1 ? 76 : 0;
+            const Alpha::Enum ENC_ALPHABET = ei & 2 ? Alpha::e_URL
+                                                    : Alpha::e_BASIC;
+            const bool        ENC_PADDED   = ei < 4;
+
+            const EncoderOptions ENC_OPTIONS = EncoderOptions::custom(
+                                                                 LINE_LENGTH,
+                                                                 ENC_ALPHABET,
+                                                                 ENC_PADDED);
+
+        for (int oi = 0; oi < 12; ++oi) {
+            const Ignore::Enum IGNORE   = static_cast<Ignore::Enum>(oi % 3);
+            const Alpha::Enum  ALPHABET = oi / 3 % 2 ? Alpha::e_URL
+                                                     : Alpha::e_BASIC;
+            const bool         PADDED   = oi < 6;
+
+            const Options OPTIONS = Options::custom(IGNORE, ALPHABET, PADDED);
+
+        for (int ni = 0; ni < NUM_LENGTHS; ++ni) {
+            const int LENGTH = LENGTHS[ni];
+
+            bsl::string data(LENGTH, '\0');
+            for (int i = 0; i < LENGTH; ++i) {
+                data[i] = static_cast<char>(rand());
+            }
+
+            bsl::string encoded;
+            {
+                bdlde::Base64Encoder encoder(ENC_OPTIONS);
+                encoder.convert(bsl::back_inserter(encoded),
+                                data.begin(),
+                                data.end());
+                encoder.endConvert(bsl::back_inserter(encoded));
+            }
+
+        for (int ii = 0; ii < NUM_INJECTIONS; ++ii) {
+            // Inject `ii - 1` pseudo-random characters at pseudo-random
+            // positions, or none if `0 == ii`.
+
+            bsl::string input(encoded);
+            for (int jj = 0; jj < ii && !input.empty(); ++jj) {
+                const size_t pos = rand() % (input.length() + 1);
+                input.insert(pos, 1, OTHERS[rand() % NUM_OTHERS]);
+            }
+
+            const char *BEGIN = input.data();
+            const int   LEN   = static_cast<int>(input.length());
+
+        for (int si = 0; si < NUM_SEGMENTS; ++si) {
+            const int SEGMENT = SEGMENTS[si];
+
+        for (int mi = 0; mi < NUM_MAX_OUTS; ++mi) {
+            const int MAX_OUT = MAX_OUTS[mi];
+
+            if (veryVerbose) {
+                T_ P_(ei) P_(oi) P_(LENGTH) P_(ii) P_(SEGMENT) P(MAX_OUT)
+            }
+
+            Obj         bulkDecoder(OPTIONS);
+            Obj         iterDecoder(OPTIONS);
+            bsl::string bulk(Obj::maxDecodedLength(LEN) + 1, '?');
+            bsl::string iter;
+
+            bsl::back_insert_iterator<bsl::string> iterOut(iter);
+
+            int pos      = 0;
+            int bulkPos  = 0;
+            int attempts = 0;
+            while (pos < LEN && attempts++ < 10000) {
+                const int end = bsl::min(pos + SEGMENT, LEN);
+
+                int bulkNumOut = -7, bulkNumIn = -7;
+                int iterNumOut = -7, iterNumIn = -7;
+
+                const int bulkRc = bulkDecoder.convert(&bulk[bulkPos],
+                                                       &bulkNumOut,
+                                                       &bulkNumIn,
+                                                       BEGIN + pos,
+                                                       BEGIN + end,
+                                                       MAX_OUT);
+                const int iterRc = iterDecoder.convert(iterOut,
+                                                       &iterNumOut,
+                                                       &iterNumIn,
+                                                       BEGIN + pos,
+                                                       BEGIN + end,
+                                                       MAX_OUT);
+
+                ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT, pos,
+                        bulkRc == iterRc);
+                ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT, pos,
+                        bulkNumOut == iterNumOut);
+                ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT, pos,
+                        bulkNumIn == iterNumIn);
+                ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT, pos,
+                        bulkDecoder.isError() == iterDecoder.isError());
+                ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT, pos,
+                        bulkDecoder.isAcceptable() ==
+                                                 iterDecoder.isAcceptable());
+                ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT, pos,
+                        bulkDecoder.isMaximal() == iterDecoder.isMaximal());
+
+                if (bulkNumIn != iterNumIn || bulkNumOut != iterNumOut) {
+                    break;
+                }
+
+                pos     += bulkNumIn;
+                bulkPos += bulkNumOut;
+
+                if (bulkRc < 0) {
+                    break;
+                }
+            }
+
+            if (!bulkDecoder.isError()) {
+                int bulkNumOut = -7, iterNumOut = -7;
+                const int bulkRc = bulkDecoder.endConvert(&bulk[bulkPos],
+                                                          &bulkNumOut);
+                const int iterRc = iterDecoder.endConvert(iterOut,
+                                                          &iterNumOut);
+                ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT,
+                        bulkRc == iterRc);
+                ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT,
+                        bulkNumOut == iterNumOut);
+                bulkPos += bulkNumOut;
+            }
+
+            ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT,
+                    bulkDecoder.outputLength() == iterDecoder.outputLength());
+            ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT,
+                    bulkDecoder.isDone() == iterDecoder.isDone());
+            ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT,
+                    '?' == bulk[Obj::maxDecodedLength(LEN)]);
+
+            bulk.resize(bulkPos);
+            ASSERTV(ei, oi, LENGTH, ii, SEGMENT, MAX_OUT, bulk == iter);
+
+            if (0 == ii && ENC_ALPHABET == ALPHABET && ENC_PADDED == PADDED
+                && (LINE_LENGTH == 0 || IGNORE != Ignore::e_IGNORE_NONE)) {
+                // Unmodified input decodes to the original data.
+
+                ASSERTV(ei, oi, LENGTH, SEGMENT, MAX_OUT, bulk == data);
+            }
+        }
+        }
+        }
+        }
+        }
+        }
+    }
+}
+
 DEFINE_TEST_CASE(15)
 {
     // ------------------------------------------------------------------------
@@ -8194,6 +8501,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(16);
         CASE(15);
         CASE(14);
         CASE(13);
@@ -8274,6 +8582,126 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+    case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `convert` THROUGHPUT
+        //
+        // Concerns:
+        // 1. Measure the throughput of `convert` for contiguous input, with
+        //    and without line breaks, using each block-decoding kernel
+        //    available on the running platform, and for output through a
+        //    non-pointer iterator.
+        //
+        // Plan:
+        // 1. Repeatedly decode the encoding of a 1MB buffer and report the
+        //    rate, in terms of encoded characters.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: `convert` throughput
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: `convert` THROUGHPUT" << endl
+                          << "=================================" << endl;
+
+        typedef bdlde::Base64Decoder_Impl Impl;
+
+        const int k_SIZE = 1024 * 1024;
+        const int k_REPS = 100;
+
+        bsl::string data(k_SIZE, '\0');
+        for (int i = 0; i < k_SIZE; ++i) {
+            data[i] = static_cast<char>(i * 7 + (i >> 8));
+        }
+
+        const EncoderOptions OPTIONS[] = {
+            EncoderOptions::mime(),
+            EncoderOptions::standard(),
+        };
+        const char *NAMES[] = { "mime", "standard" };
+
+        bsl::vector<char> output(k_SIZE + 16);
+
+        for (int oi = 0; oi < 2; ++oi) {
+            bsl::string encoded;
+            {
+                bdlde::Base64Encoder encoder(OPTIONS[oi]);
+                encoder.convert(bsl::back_inserter(encoded),
+                                data.begin(),
+                                data.end());
+                encoder.endConvert(bsl::back_inserter(encoded));
+            }
+            const double LEN = static_cast<double>(encoded.length());
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int rep = 0; rep < k_REPS; ++rep) {
+                Obj decoder(Options::mime());
+                decoder.convert(output.data(),
+                                encoded.data(),
+                                encoded.data() + encoded.length());
+                decoder.endConvert(output.data());
+            }
+            timer.stop();
+
+            cout << NAMES[oi] << " (pointers): "
+                 << LEN * k_REPS / timer.elapsedTime() / 1.0e6
+                 << " MB/s" << endl;
+
+            bsl::string out;
+            out.reserve(k_SIZE);
+            timer.reset();
+            timer.start();
+            for (int rep = 0; rep < k_REPS / 10 + 1; ++rep) {
+                out.clear();
+                Obj decoder(Options::mime());
+                decoder.convert(bsl::back_inserter(out),
+                                encoded.data(),
+                                encoded.data() + encoded.length());
+                decoder.endConvert(bsl::back_inserter(out));
+            }
+            timer.stop();
+
+            cout << NAMES[oi] << " (iterator): "
+                 << LEN * (k_REPS / 10 + 1) / timer.elapsedTime() / 1.0e6
+                 << " MB/s" << endl;
+        }
+
+        bsl::string encoded;
+        {
+            bdlde::Base64Encoder encoder(EncoderOptions::standard());
+            encoder.convert(bsl::back_inserter(encoded),
+                            data.begin(),
+                            data.end());
+        }
+
+        const Impl::Kernel KERNELS[] = { Impl::e_SCALAR,
+                                         Impl::e_SSSE3,
+                                         Impl::e_AVX2 };
+        const char        *KERNEL_NAMES[] = { "scalar", "ssse3", "avx2" };
+
+        for (int ki = 0; ki < 3; ++ki) {
+            if (!Impl::isAvailable(KERNELS[ki])) {
+                continue;
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int rep = 0; rep < k_REPS; ++rep) {
+                Impl::decode(output.data(),
+                             encoded.data(),
+                             encoded.length() / 4,
+                             Alpha::e_BASIC,
+                             KERNELS[ki]);
+            }
+            timer.stop();
+
+            cout << "kernel " << KERNEL_NAMES[ki] << ": "
+                 << static_cast<double>(encoded.length()) * k_REPS
+                                          / timer.elapsedTime() / 1.0e6
+                 << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
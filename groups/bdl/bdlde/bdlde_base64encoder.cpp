@@ -4,7 +4,46 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_BASE64ENCODER_SIMD_ENABLED
+# define BDLDE_BASE64ENCODER_SSSE3_TARGET __attribute__((target("ssse3")))
+# define BDLDE_BASE64ENCODER_AVX2_TARGET  __attribute__((target("avx2")))
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The bulk path of `convert` (see `encodeBlocks`) hands runs of complete
+// 3-byte groups that fit on the current output line to one of the following
+// kernels, selected once per process according to the capabilities of the
+// running processor:
+//
+//: o `encodeScalar`: a portable loop encoding one group per iteration.
+//:
+//: o `encodeSsse3`: encodes 12 bytes into 16 characters per iteration.  A
+//:   byte shuffle places each 3-byte group in a 32-bit lane, two pairs of
+//:   masked 16-bit multiplies move each 6-bit index into its own byte, and
+//:   a final 16-entry `pshufb` lookup, indexed by the range each 6-bit value
+//:   falls in, yields the offset to add to obtain the ASCII character.  Only
+//:   the two characters that differ between the alphabets are taken from
+//:   the alphabet table, so both alphabets share the kernel.  The technique
+//:   is described at
+//:   http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+//:
+//: o `encodeAvx2`: the same computation on 256-bit registers, encoding 24
+//:   bytes into 32 characters per iteration.
+//
+// Both vector kernels read 16 bytes for each 12 they consume, and so must
+// stop while enough whole groups remain to keep the final load within the
+// input; the remaining groups are delegated to the next narrower kernel.
 
 namespace {
 namespace u {
@@ -43,6 +82,214 @@ const char base64url[] = {
     '4', '5', '6', '7', '8', '9', '-', '_',  // 070
 };
 
+/// This type defines a function that encodes a sequence of 3-byte groups
+/// into 4 characters each, without line breaks.
+typedef void (*EncodeFn)(char                *out,
+                         const unsigned char *input,
+                         bsl::size_t          numTriplets,
+                         const char          *alphabet);
+
+/// Load into the specified `out` the `4 * numTriplets` characters of the
+/// encoding, using the specified `alphabet`, of the specified `numTriplets`
+/// groups of three bytes at the specified `input`.
+void encodeScalar(char                *out,
+                  const unsigned char *input,
+                  bsl::size_t          numTriplets,
+                  const char          *alphabet)
+{
+    for (; 0 < numTriplets; --numTriplets) {
+        const unsigned value = (static_cast<unsigned>(input[0]) << 16)
+                             | (static_cast<unsigned>(input[1]) <<  8)
+                             |  static_cast<unsigned>(input[2]);
+
+        out[0] = alphabet[ value >> 18        ];
+        out[1] = alphabet[(value >> 12) & 0x3f];
+        out[2] = alphabet[(value >>  6) & 0x3f];
+        out[3] = alphabet[ value        & 0x3f];
+
+        input += 3;
+        out   += 4;
+    }
+}
+
+#if defined(BDLDE_BASE64ENCODER_SIMD_ENABLED)
+
+/// Return `true` if the running processor supports the SSSE3 instructions,
+/// and `false` otherwise.
+bool detectSsse3()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+}
+
+/// Return `true` if the running processor and operating system support the
+/// AVX2 instructions, and `false` otherwise.
+bool detectAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+/// Return the 16-byte table of offsets that, indexed by the range code of a
+/// 6-bit value (see `encodeSsse3`), converts that value to its character in
+/// the specified `alphabet`.
+inline BDLDE_BASE64ENCODER_SSSE3_TARGET
+__m128i asciiOffsets(const char *alphabet)
+{
+    const char k62 = static_cast<char>(alphabet[62] - 62);
+    const char k63 = static_cast<char>(alphabet[63] - 63);
+
+    return _mm_setr_epi8('a' - 26,
+                         '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                         '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                         k62,
+                         k63,
+                         'A',
+                         0,
+                         0);
+}
+
+/// Load into the specified `out` the `4 * numTriplets` characters of the
+/// encoding, using the specified `alphabet`, of the specified `numTriplets`
+/// groups of three bytes at the specified `input`, using SSSE3.
+BDLDE_BASE64ENCODER_SSSE3_TARGET
+void encodeSsse3(char                *out,
+                 const unsigned char *input,
+                 bsl::size_t          numTriplets,
+                 const char          *alphabet)
+{
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                          7, 6, 8, 7, 10, 9, 11, 10);
+    const __m128i offsets = asciiOffsets(alphabet);
+
+    // Each iteration loads 16 bytes, but consumes only 12.
+
+    while (6 <= numTriplets) {
+        __m128i in = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(input));
+
+        // Place the bytes `b0 b1 b2` of each group in a 32-bit lane as
+        // `b1 b0 b2 b1`, then shift each 6-bit field into its own byte.
+
+        in = _mm_shuffle_epi8(in, shuffle);
+
+        const __m128i hi = _mm_mulhi_epu16(
+                                   _mm_and_si128(in,
+                                                 _mm_set1_epi32(0x0fc0fc00)),
+                                   _mm_set1_epi32(0x04000040));
+        const __m128i lo = _mm_mullo_epi16(
+                                   _mm_and_si128(in,
+                                                 _mm_set1_epi32(0x003f03f0)),
+                                   _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(hi, lo);
+
+        // Compute the range code: 0 for 'a'..'z', 1..10 for '0'..'9', 11 and
+        // 12 for the last two characters, and 13 for 'A'..'Z'.
+
+        __m128i code = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        code = _mm_or_si128(code,
+                            _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26),
+                                                         indices),
+                                          _mm_set1_epi8(13)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_add_epi8(indices,
+                                      _mm_shuffle_epi8(offsets, code)));
+
+        input       += 12;
+        out         += 16;
+        numTriplets -= 4;
+    }
+
+    encodeScalar(out, input, numTriplets, alphabet);
+}
+
+/// Load into the specified `out` the `4 * numTriplets` characters of the
+/// encoding, using the specified `alphabet`, of the specified `numTriplets`
+/// groups of three bytes at the specified `input`, using AVX2.
+BDLDE_BASE64ENCODER_AVX2_TARGET
+void encodeAvx2(char                *out,
+                const unsigned char *input,
+                bsl::size_t          numTriplets,
+                const char          *alphabet)
+{
+    const __m256i shuffle = _mm256_broadcastsi128_si256(
+                                 _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                               7, 6, 8, 7, 10, 9, 11, 10));
+    const __m256i offsets = _mm256_broadcastsi128_si256(
+                                                      asciiOffsets(alphabet));
+
+    // Each iteration loads 28 bytes, but consumes only 24.
+
+    while (10 <= numTriplets) {
+        const __m128i in0 = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(input));
+        const __m128i in1 = _mm_loadu_si128(
+                               reinterpret_cast<const __m128i *>(input + 12));
+
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(in0),
+                                             in1,
+                                             1);
+
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        const __m256i hi = _mm256_mulhi_epu16(
+                              _mm256_and_si256(in,
+                                               _mm256_set1_epi32(0x0fc0fc00)),
+                              _mm256_set1_epi32(0x04000040));
+        const __m256i lo = _mm256_mullo_epi16(
+                              _mm256_and_si256(in,
+                                               _mm256_set1_epi32(0x003f03f0)),
+                              _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(hi, lo);
+
+        __m256i code = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        code = _mm256_or_si256(
+                          code,
+                          _mm256_and_si256(
+                                   _mm256_cmpgt_epi8(_mm256_set1_epi8(26),
+                                                     indices),
+                                   _mm256_set1_epi8(13)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                            _mm256_add_epi8(indices,
+                                            _mm256_shuffle_epi8(offsets,
+                                                                code)));
+
+        input       += 24;
+        out         += 32;
+        numTriplets -= 8;
+    }
+
+    // Clear the upper halves of the AVX registers before executing the
+    // (non-VEX) SSSE3 instructions to avoid the state transition penalty.
+
+    _mm256_zeroupper();
+
+    encodeSsse3(out, input, numTriplets, alphabet);
+}
+
+#endif
+
+/// Return the fastest block-encoding kernel available on the running
+/// platform.
+EncodeFn encodeFunction()
+{
+    static EncodeFn encodeFn = 0;
+
+    BSLMT_ONCE_DO {
+#if defined(BDLDE_BASE64ENCODER_SIMD_ENABLED)
+        encodeFn = detectAvx2()  ? &encodeAvx2
+                 : detectSsse3() ? &encodeSsse3
+                 :                 &encodeScalar;
+#else
+        encodeFn = &encodeScalar;
+#endif
+    }
+
+    return encodeFn;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -53,6 +300,93 @@ namespace bdlde {
                          // class Base64Encoder
                          // -------------------
 
+// PRIVATE MANIPULATORS
+bsl::size_t Base64Encoder::encodeBlocks(char                **out,
+                                        const unsigned char  *input,
+                                        bsl::size_t           length,
+                                        bsl::size_t           maxOutput)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(input || 0 == length);
+    BSLS_ASSERT(0 == d_bitsInStack);
+
+    const u::EncodeFn    encodeFn    = u::encodeFunction();
+    char                *output      = *out;
+    const unsigned char *next        = input;
+    bsl::size_t          numTriplets = length / 3;
+    bsl::size_t          room        = maxOutput;
+
+    while (0 < numTriplets) {
+        bsl::size_t count = numTriplets;
+
+        if (d_maxLineLength) {
+            if (d_lineLength >= d_maxLineLength) {
+                if (room < 2) {
+                    break;                                             // BREAK
+                }
+                if (d_lineLength == d_maxLineLength) {
+                    *output++ = '\r';
+                    --room;
+                }
+                *output++ = '\n';
+                --room;
+                d_lineLength = 0;
+            }
+
+            const bsl::size_t lineRoom =
+                                      (d_maxLineLength - d_lineLength) / 4;
+            if (lineRoom < count) {
+                count = lineRoom;
+            }
+        }
+        if (room / 4 < count) {
+            count = room / 4;
+        }
+
+        if (0 < count) {
+            encodeFn(output, next, count, d_alphabet_p);
+
+            output       += 4 * count;
+            room         -= 4 * count;
+            next         += 3 * count;
+            numTriplets  -= count;
+            d_lineLength += static_cast<int>(4 * count);
+            continue;                                               // CONTINUE
+        }
+
+        // The characters of the next group straddle a line break (or there
+        // is no room for them).  Emit them one at a time, allowing for up to
+        // three line breaks when the line length is less than 4.
+
+        if (0 == d_maxLineLength || room < 10) {
+            break;                                                     // BREAK
+        }
+
+        char quad[4];
+        encodeFn(quad, next, 1, d_alphabet_p);
+
+        for (int i = 0; i < 4; ++i) {
+            if (d_lineLength >= d_maxLineLength) {
+                *output++    = '\r';
+                *output++    = '\n';
+                room        -= 2;
+                d_lineLength = 0;
+            }
+            *output++ = quad[i];
+            --room;
+            ++d_lineLength;
+        }
+
+        next += 3;
+        --numTriplets;
+    }
+
+    d_outputLength += static_cast<int>(output - *out);
+    *out            = output;
+
+    return next - input;
+}
+
 // CREATORS
 Base64Encoder::Base64Encoder(const EncoderOptions& options)
 : d_maxLineLength(options.maxLineLength())
@@ -105,9 +439,66 @@ Base64Encoder::~Base64Encoder()
     BSLS_ASSERT(0 <= d_outputLength);
 }
 
+                         // ------------------------
+                         // struct Base64Encoder_Impl
+                         // ------------------------
+
+// CLASS METHODS
+void Base64Encoder_Impl::encode(char                 *out,
+                                const unsigned char  *input,
+                                bsl::size_t           numTriplets,
+                                Base64Alphabet::Enum  alphabet,
+                                Kernel                kernel)
+{
+    BSLS_ASSERT(out         || 0 == numTriplets);
+    BSLS_ASSERT(input       || 0 == numTriplets);
+    BSLS_ASSERT(isAvailable(kernel));
+
+    const char *table = Base64Alphabet::e_BASIC == alphabet ? u::base64
+                                                            : u::base64url;
+
+    switch (kernel) {
+#if defined(BDLDE_BASE64ENCODER_SIMD_ENABLED)
+      case e_SSSE3: {
+        u::encodeSsse3(out, input, numTriplets, table);
+      } break;
+      case e_AVX2: {
+        u::encodeAvx2(out, input, numTriplets, table);
+      } break;
+#endif
+      default: {
+        u::encodeScalar(out, input, numTriplets, table);
+      } break;
+    }
+}
+
+bool Base64Encoder_Impl::isAvailable(Kernel kernel)
+{
+    switch (kernel) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      }
+#if defined(BDLDE_BASE64ENCODER_SIMD_ENABLED)
+      case e_SSSE3: {
+        return u::detectSsse3();                                      // RETURN
+      }
+      case e_AVX2: {
+        return u::detectAvx2();                                       // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BDLDE_BASE64ENCODER_AVX2_TARGET
+#undef BDLDE_BASE64ENCODER_SSSE3_TARGET
+#undef BDLDE_BASE64ENCODER_SIMD_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
 //
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Base64Encoder: automata performing Base64 encoding operations
+//  bdlde::Base64Encoder_Impl: block-encoding kernels (for testing only)
 //
 //@SEE_ALSO: bdlde_base64decoder
 //
@@ -183,6 +184,21 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Encoding Contiguous Input
+///-------------------------
+// When `convert` is called with a `char *` output buffer and a
+// `const char *` input range (or the corresponding `unsigned char` pointer
+// types), complete 3-byte groups of input are encoded in bulk rather than one
+// byte at a time.  Runs of groups that fit on the current output line are
+// encoded by a kernel chosen once, at run time, from those supported by the
+// processor: on x86 platforms compiled with GCC or Clang, AVX2 and SSSE3
+// kernels encode 24 and 12 bytes per step, respectively; elsewhere a portable
+// scalar loop is used.  Soft line breaks are inserted, and the `maxNumOut`
+// limit is observed, exactly as for other iterator types, so the output (and
+// the state of the encoder) does not depend on which path was taken.  The
+// kernels are made available for testing through the component-private
+// `struct` `bdlde::Base64Encoder_Impl`.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -513,6 +529,19 @@ class Base64Encoder {
     template <class OUTPUT_ITERATOR>
     void encode(OUTPUT_ITERATOR *out, int maxLength);
 
+    /// Encode the complete 3-byte groups at the start of the specified
+    /// `input` having the specified `length` to the buffer addressed by
+    /// the specified `out`, inserting soft line breaks as needed and
+    /// writing no more than the specified `maxOutput` characters, advance
+    /// `*out` past the characters written, and return the number of input
+    /// bytes consumed (a multiple of 3).  Encoding stops early if the next
+    /// group would not fit within `maxOutput`.  The behavior is undefined
+    /// unless `0 == d_bitsInStack`.
+    bsl::size_t encodeBlocks(char                **out,
+                             const unsigned char  *input,
+                             bsl::size_t           length,
+                             bsl::size_t           maxOutput);
+
     /// Set the state to the specified `newState`.
     void setState(State newState);
 
@@ -745,6 +774,40 @@ class Base64Encoder {
     int outputLength() const;
 };
 
+                         // =========================
+                         // struct Base64Encoder_Impl
+                         // =========================
+
+/// This component-private `struct` provides access to the alternative
+/// block-encoding kernels used by `Base64Encoder::convert` for contiguous
+/// input.  It should not be used other than to test and benchmark.
+struct Base64Encoder_Impl {
+
+    // TYPES
+    enum Kernel {
+        e_SCALAR,  // portable, one 3-byte group at a time
+        e_SSSE3,   // x86 SSSE3, 12 bytes at a time
+        e_AVX2     // x86 AVX2, 24 bytes at a time
+    };
+
+    // CLASS METHODS
+
+    /// Load into the specified `out` buffer the `4 * numTriplets`
+    /// characters of the encoding, in the specified `alphabet` and without
+    /// line breaks, of the specified `numTriplets` 3-byte groups at the
+    /// specified `input`, using the specified `kernel`.  The behavior is
+    /// undefined unless `isAvailable(kernel)` is `true`.
+    static void encode(char                 *out,
+                       const unsigned char  *input,
+                       bsl::size_t           numTriplets,
+                       Base64Alphabet::Enum  alphabet,
+                       Kernel                kernel);
+
+    /// Return `true` if the specified `kernel` is supported by the running
+    /// platform, and `false` otherwise.
+    static bool isAvailable(Kernel kernel);
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -1025,6 +1088,133 @@ int Base64Encoder::convert(OUTPUT_ITERATOR  out,
     return 0;
 }
 
+template <>
+inline
+int Base64Encoder::convert<char *, const char *>(char        *out,
+                                                 int         *numOut,
+                                                 int         *numIn,
+                                                 const char  *begin,
+                                                 const char  *end,
+                                                 int          maxNumOut)
+{
+    int dummyNumOut;
+    if (!numOut) {
+        numOut = &dummyNumOut;
+    }
+    int dummyNumIn;
+    if (!numIn) {
+        numIn  = &dummyNumIn;
+    }
+
+    if (e_ERROR_STATE == state() || e_DONE_STATE == state()) {
+        setState(e_ERROR_STATE);
+        *numOut = 0;
+        *numIn  = 0;
+        return -1;                                                    // RETURN
+    }
+
+    const int initialLength = d_outputLength;
+    const int maxLength     = d_outputLength + maxNumOut;
+
+    // Emit as many output bytes as possible.
+
+    while (6 <= d_bitsInStack && d_outputLength != maxLength) {
+        encode(&out, maxLength);
+    }
+
+    // Consume as many input bytes as possible, encoding complete 3-byte
+    // groups in bulk.
+
+    const char *originalBegin = begin;
+
+    if (0 == d_bitsInStack && 3 <= end - begin) {
+        const int         numOutSoFar = d_outputLength - initialLength;
+        const bsl::size_t maxOutput   = 0 > maxNumOut
+                                      ? ~bsl::size_t(0)
+                                      : static_cast<bsl::size_t>(maxNumOut -
+                                                                 numOutSoFar);
+
+        begin += encodeBlocks(&out,
+                              reinterpret_cast<const unsigned char *>(begin),
+                              end - begin,
+                              maxOutput);
+    }
+
+    while (4 >= d_bitsInStack && begin != end) {
+        const unsigned char byte = static_cast<unsigned char>(*begin);
+
+        ++begin;
+
+        d_stack        = (d_stack << 8) | byte;
+        d_bitsInStack += 8;
+
+        if (d_outputLength != maxLength) {
+            encode(&out, maxLength);
+            if (6 <= d_bitsInStack && d_outputLength != maxLength) {
+                encode(&out, maxLength);
+            }
+        }
+    }
+
+    *numIn  = static_cast<int>(begin - originalBegin);
+    *numOut = d_outputLength - initialLength;
+
+    return 0;
+}
+
+template <>
+inline
+int Base64Encoder::convert<unsigned char *, const unsigned char *>(
+                                              unsigned char        *out,
+                                              int                  *numOut,
+                                              int                  *numIn,
+                                              const unsigned char  *begin,
+                                              const unsigned char  *end,
+                                              int                   maxNumOut)
+{
+    return convert(reinterpret_cast<char *>(out),
+                   numOut,
+                   numIn,
+                   reinterpret_cast<const char *>(begin),
+                   reinterpret_cast<const char *>(end),
+                   maxNumOut);
+}
+
+template <>
+inline
+int Base64Encoder::convert<char *, char *>(char *out,
+                                           int  *numOut,
+                                           int  *numIn,
+                                           char *begin,
+                                           char *end,
+                                           int   maxNumOut)
+{
+    return convert(out,
+                   numOut,
+                   numIn,
+                   const_cast<const char *>(begin),
+                   const_cast<const char *>(end),
+                   maxNumOut);
+}
+
+template <>
+inline
+int Base64Encoder::convert<unsigned char *, unsigned char *>(
+                                                    unsigned char *out,
+                                                    int           *numOut,
+                                                    int           *numIn,
+                                                    unsigned char *begin,
+                                                    unsigned char *end,
+                                                    int            maxNumOut)
+{
+    return convert(reinterpret_cast<char *>(out),
+                   numOut,
+                   numIn,
+                   reinterpret_cast<const char *>(begin),
+                   reinterpret_cast<const char *>(end),
+                   maxNumOut);
+}
+
 template <class OUTPUT_ITERATOR>
 int Base64Encoder::endConvert(OUTPUT_ITERATOR out)
 {
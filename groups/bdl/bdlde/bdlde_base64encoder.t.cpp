@@ -24,6 +24,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>    // isgraph(), isalpha()
@@ -34,7 +35,9 @@
 #include <bsl_climits.h>   // INT_MAX
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 using namespace BloombergLP;
@@ -133,7 +136,11 @@ using bsl::ptrdiff_t;
 // [ 3] int outputLength() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST -- (developer's sandbox)
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
+// [15] BULK ENCODING OF CONTIGUOUS INPUT
+// [15] void Base64Encoder_Impl::encode(out, in, n, alphabet, kernel);
+// [15] bool Base64Encoder_Impl::isAvailable(Kernel kernel);
+// [-1] PERFORMANCE: `convert` throughput
 // [14] 0 == U_ENABLE_DEPRECATIONS
 // [ ?] That the input iterator can have *minimal* functionality.
 // [ ?] That the output iterator can have *minimal* functionality.
@@ -1921,7 +1928,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Demonstrate that the example compiles, links, and runs.
@@ -1975,6 +1982,226 @@ int main(int argc, char *argv[])
 
         ASSERT(inStr == backInStream.str());
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // BULK ENCODING OF CONTIGUOUS INPUT
+        //
+        // Concerns:
+        // 1. Each block-encoding kernel available on the running platform
+        //    produces the same characters as the scalar kernel, for every
+        //    number of groups and for both alphabets.
+        //
+        // 2. `convert` with `char *` output and `const char *` input (which
+        //    encodes in bulk) produces the same output, `numOut`, `numIn`,
+        //    return value, and encoder state as `convert` with other
+        //    iterator types, for all line lengths, alphabets, and padding
+        //    options.
+        //
+        // 3. The bulk path observes `maxNumOut`, and resumes correctly when
+        //    input is supplied in arbitrary segments.
+        //
+        // Plan:
+        // 1. Encode pseudo-random data of every length up to 80 groups with
+        //    each available kernel, and compare with the scalar kernel.
+        //    (C-1)
+        //
+        // 2. For a variety of options, input lengths, segment lengths, and
+        //    output limits, encode pseudo-random data with a pair of
+        //    encoders, one given `const char *` input and `char *` output,
+        //    and one given a `bsl::back_insert_iterator`, and verify that
+        //    the results of each call, and the final output, are the same.
+        //    (C-2..3)
+        //
+        // Testing:
+        //   BULK ENCODING OF CONTIGUOUS INPUT
+        //   void Base64Encoder_Impl::encode(out, in, n, alphabet, kernel);
+        //   bool Base64Encoder_Impl::isAvailable(Kernel kernel);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK ENCODING OF CONTIGUOUS INPUT" << endl
+                          << "=================================" << endl;
+
+        typedef bdlde::Base64Encoder_Impl Impl;
+
+        bsl::vector<unsigned char> data(4096);
+        {
+            unsigned int seed = 12345;
+            for (size_t i = 0; i < data.size(); ++i) {
+                seed    = seed * 1103515245 + 12345;
+                data[i] = static_cast<unsigned char>(seed >> 16);
+            }
+        }
+
+        if (verbose) cout << "\nCompare each kernel with the scalar kernel."
+                          << endl;
+        {
+            const Impl::Kernel KERNELS[] = { Impl::e_SSSE3, Impl::e_AVX2 };
+            const int          NUM_KERNELS =
+                                     static_cast<int>(sizeof KERNELS
+                                                      / sizeof *KERNELS);
+
+            ASSERT(Impl::isAvailable(Impl::e_SCALAR));
+
+            for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+                const Impl::Kernel KERNEL = KERNELS[ti];
+
+                if (!Impl::isAvailable(KERNEL)) {
+                    if (verbose) { T_ P_(KERNEL) Q(not available) }
+                    continue;
+                }
+                if (verbose) { T_ P(KERNEL) }
+
+                for (int ai = 0; ai < 2; ++ai) {
+                    const Alphabet::Enum ALPHABET = ai ? Alphabet::e_URL
+                                                       : Alphabet::e_BASIC;
+
+                    for (size_t n = 0; n <= 80; ++n) {
+                        for (size_t offset = 0; offset < 4; ++offset) {
+                            const unsigned char *IN = &data[offset];
+
+                            bsl::vector<char> exp(4 * n + 1, '?');
+                            bsl::vector<char> result(4 * n + 1, '?');
+
+                            Impl::encode(exp.data(),
+                                         IN,
+                                         n,
+                                         ALPHABET,
+                                         Impl::e_SCALAR);
+                            Impl::encode(result.data(),
+                                         IN,
+                                         n,
+                                         ALPHABET,
+                                         KERNEL);
+
+                            ASSERTV(KERNEL, ALPHABET, n, offset,
+                                    exp == result);
+                            ASSERTV(KERNEL, n, '?' == result[4 * n]);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nCompare `convert` overloads." << endl;
+        {
+            const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 13, 76 };
+            const int NUM_LINE_LENGTHS =
+                                     static_cast<int>(sizeof LINE_LENGTHS
+                                                      / sizeof *LINE_LENGTHS);
+
+            const int LENGTHS[] = { 0, 1, 2, 3, 5, 11, 12, 13, 29, 30, 31,
+                                    57, 100, 301, 1000 };
+            const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                     / sizeof *LENGTHS);
+
+            const int SEGMENTS[]  = { 1, 2, 7, 32, 1000 };
+            const int NUM_SEGMENTS = static_cast<int>(sizeof SEGMENTS
+                                                      / sizeof *SEGMENTS);
+
+            const int MAX_OUTS[]  = { -1, 1, 2, 5, 40, 333 };
+            const int NUM_MAX_OUTS = static_cast<int>(sizeof MAX_OUTS
+                                                      / sizeof *MAX_OUTS);
+
+            const char *BEGIN = reinterpret_cast<const char *>(data.data());
+
+            for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+            for (int ai = 0; ai < 4; ++ai) {
+                const EncoderOptions OPTIONS = EncoderOptions::custom(
+                                                LINE_LENGTHS[li],
+                                                ai & 1 ? Alphabet::e_URL
+                                                       : Alphabet::e_BASIC,
+                                                ai & 2);
+
+            for (int ni = 0; ni < NUM_LENGTHS; ++ni) {
+                const int LENGTH = LENGTHS[ni];
+
+            for (int si = 0; si < NUM_SEGMENTS; ++si) {
+                const int SEGMENT = SEGMENTS[si];
+
+            for (int mi = 0; mi < NUM_MAX_OUTS; ++mi) {
+                const int MAX_OUT = MAX_OUTS[mi];
+
+                if (veryVerbose) {
+                    T_ P_(LINE_LENGTHS[li]) P_(ai) P_(LENGTH) P_(SEGMENT)
+                                                                    P(MAX_OUT)
+                }
+
+                const int MAX_LEN = static_cast<int>(
+                               Obj::encodedLength(OPTIONS, LENGTH));
+
+                Obj         bulkEncoder(OPTIONS);
+                Obj         iterEncoder(OPTIONS);
+                bsl::string bulk(MAX_LEN + 1, '?');
+                bsl::string iter;
+
+                bsl::back_insert_iterator<bsl::string> iterOut(iter);
+
+                int pos      = 0;
+                int bulkPos  = 0;
+                int attempts = 0;
+                while (pos < LENGTH && attempts++ < 10000) {
+                    const int end = bsl::min(pos + SEGMENT, LENGTH);
+
+                    int bulkNumOut = -7, bulkNumIn = -7;
+                    int iterNumOut = -7, iterNumIn = -7;
+
+                    const int bulkRc = bulkEncoder.convert(&bulk[bulkPos],
+                                                           &bulkNumOut,
+                                                           &bulkNumIn,
+                                                           BEGIN + pos,
+                                                           BEGIN + end,
+                                                           MAX_OUT);
+                    const int iterRc = iterEncoder.convert(iterOut,
+                                                           &iterNumOut,
+                                                           &iterNumIn,
+                                                           BEGIN + pos,
+                                                           BEGIN + end,
+                                                           MAX_OUT);
+
+                    ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT, pos,
+                            bulkRc == iterRc);
+                    ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT, pos,
+                            bulkNumOut == iterNumOut);
+                    ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT, pos,
+                            bulkNumIn == iterNumIn);
+                    ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT, pos,
+                            bulkEncoder.outputLength() ==
+                                                   iterEncoder.outputLength());
+
+                    if (bulkNumIn != iterNumIn || bulkNumOut != iterNumOut) {
+                        break;
+                    }
+
+                    pos     += bulkNumIn;
+                    bulkPos += bulkNumOut;
+                }
+
+                int bulkNumOut = -7, iterNumOut = -7;
+                ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT,
+                        bulkEncoder.endConvert(&bulk[bulkPos], &bulkNumOut) ==
+                               iterEncoder.endConvert(iterOut, &iterNumOut));
+                ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT,
+                        bulkNumOut == iterNumOut);
+                bulkPos += bulkNumOut;
+
+                ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT, bulkPos, MAX_LEN,
+                        bulkPos == MAX_LEN);
+                ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT,
+                        '?' == bulk[MAX_LEN]);
+
+                bulk.resize(bsl::min(bulkPos, MAX_LEN));
+                ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT, bulk, iter,
+                        bulk == iter);
+                ASSERTV(li, ai, LENGTH, SEGMENT, MAX_OUT,
+                        bulkEncoder.isDone() && iterEncoder.isDone());
+            }
+            }
+            }
+            }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // ENSURE U_ENABLE_DEPRECATIONS IS DISABLED
@@ -4838,6 +5065,108 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `convert` THROUGHPUT
+        //
+        // Concerns:
+        // 1. Measure the throughput of `convert` for contiguous input, with
+        //    and without line breaks, using each block-encoding kernel
+        //    available on the running platform, and for input supplied
+        //    through a non-pointer iterator.
+        //
+        // Plan:
+        // 1. Repeatedly encode a 1MB buffer and report the rate.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: `convert` throughput
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: `convert` THROUGHPUT" << endl
+                          << "=================================" << endl;
+
+        typedef bdlde::Base64Encoder_Impl Impl;
+
+        const int               k_SIZE = 1024 * 1024;
+        const int               k_REPS = 100;
+        bsl::vector<char>       input(k_SIZE);
+        bsl::vector<char>       output(k_SIZE * 2);
+
+        for (int i = 0; i < k_SIZE; ++i) {
+            input[i] = static_cast<char>(i * 7 + (i >> 8));
+        }
+
+        const EncoderOptions OPTIONS[] = {
+            EncoderOptions::mime(),
+            EncoderOptions::standard(),
+        };
+        const char *NAMES[] = { "mime", "standard" };
+
+        for (int oi = 0; oi < 2; ++oi) {
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int rep = 0; rep < k_REPS; ++rep) {
+                Obj encoder(OPTIONS[oi]);
+                encoder.convert(output.data(),
+                                input.data(),
+                                input.data() + k_SIZE);
+                encoder.endConvert(output.data());
+            }
+            timer.stop();
+
+            cout << NAMES[oi] << " (pointers): "
+                 << k_SIZE * static_cast<double>(k_REPS)
+                                          / timer.elapsedTime() / 1.0e6
+                 << " MB/s" << endl;
+
+            bsl::string out;
+            out.reserve(k_SIZE * 2);
+            timer.reset();
+            timer.start();
+            for (int rep = 0; rep < k_REPS / 10 + 1; ++rep) {
+                out.clear();
+                Obj encoder(OPTIONS[oi]);
+                encoder.convert(bsl::back_inserter(out),
+                                input.data(),
+                                input.data() + k_SIZE);
+                encoder.endConvert(bsl::back_inserter(out));
+            }
+            timer.stop();
+
+            cout << NAMES[oi] << " (iterator): "
+                 << k_SIZE * static_cast<double>(k_REPS / 10 + 1)
+                                          / timer.elapsedTime() / 1.0e6
+                 << " MB/s" << endl;
+        }
+
+        const Impl::Kernel KERNELS[] = { Impl::e_SCALAR,
+                                         Impl::e_SSSE3,
+                                         Impl::e_AVX2 };
+        const char        *KERNEL_NAMES[] = { "scalar", "ssse3", "avx2" };
+
+        for (int ki = 0; ki < 3; ++ki) {
+            if (!Impl::isAvailable(KERNELS[ki])) {
+                continue;
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int rep = 0; rep < k_REPS; ++rep) {
+                Impl::encode(output.data(),
+                             reinterpret_cast<unsigned char *>(input.data()),
+                             k_SIZE / 3,
+                             Alphabet::e_BASIC,
+                             KERNELS[ki]);
+            }
+            timer.stop();
+
+            cout << "kernel " << KERNEL_NAMES[ki] << ": "
+                 << k_SIZE * static_cast<double>(k_REPS)
+                                          / timer.elapsedTime() / 1.0e6
+                 << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
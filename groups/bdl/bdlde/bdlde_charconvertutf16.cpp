@@ -9,12 +9,25 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
 #include <bslmf_issame.h>
+#include <bslmt_once.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
 #include <bsl_cstdint.h>    // 'WCHAR_WIDTH'
+#include <bsl_cstring.h>    // 'memcpy'
+
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_CHARCONVERTUTF16_SIMD_ENABLED
+# define BDLDE_CHARCONVERTUTF16_SSE2_TARGET __attribute__((target("sse2")))
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -338,13 +351,21 @@ struct Capacity {
     void operator--() { --d_capacity; }
 
     /// Decrement `d_capacity` by the specified `delta`.
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
 
     // ACCESSORS
 
     /// Return `true` if `d_capacity` is less than the specified `rhs`, and
     /// `false` otherwise.
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
+
+    /// Return the lesser of the specified `n` and the number of characters
+    /// that can be output while leaving room for a terminating null.  The
+    /// behavior is undefined unless `0 < d_capacity`.
+    bsl::size_t limit(bsl::size_t n) const
+    {
+        return bsl::min(n, d_capacity - 1);
+    }
 };
 
 /// Functor passed to `localUtf8ToUtf16` and `localUtf16ToUtf8` in cases
@@ -360,12 +381,15 @@ struct NoOpCapacity {
     void operator--() {}
 
     /// No-op.
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
 
     // ACCESSORS
 
     /// Return `false`.
     bool operator<(bsl::size_t) const { return false; }
+
+    /// Return the specified `n`.
+    bsl::size_t limit(bsl::size_t n) const { return n; }
 };
 
 // LOCAL HELPER STRUCT
@@ -437,6 +461,14 @@ struct Utf8 {
             }
         }
 
+        /// Return the number of octets of input from the specified
+        /// `position` to the end of input.  The behavior is undefined
+        /// unless `position <= d_end`.
+        bsl::size_t numAvailable(const OctetType *position) const
+        {
+            return d_end - position;
+        }
+
         /// Return a pointer to after all the consecutive continuation
         /// bytes following the specified `octets` that are prior to
         /// `d_end`.  The behavior is undefined unless `octets <= d_end`.
@@ -500,6 +532,14 @@ struct Utf8 {
             return 0 == *position;
         }
 
+        /// Return 0.  Note that the extent of null-terminated input is not
+        /// known in advance, so none of it is ever available for bulk
+        /// processing.
+        bsl::size_t numAvailable(const OctetType *) const
+        {
+            return 0;
+        }
+
         /// Return a pointer to after all the consecutive continuation
         /// bytes following the specified `octets`.  The behavior is
         /// undefined unless `octets <= d_end`.
@@ -776,6 +816,14 @@ struct Utf16 {
                 return true;                                          // RETURN
             }
         }
+
+        /// Return the number of words of input from the specified
+        /// `utf16Buf` to the end of input.  The behavior is undefined
+        /// unless `utf16Buf <= d_end`.
+        bsl::size_t numAvailable(const UTF16_WORD *utf16Buf) const
+        {
+            return d_end - utf16Buf;
+        }
     };
 
     /// The `class` determines whether translation is at the end of input by
@@ -798,6 +846,14 @@ struct Utf16 {
         {
             return !*u16Buf;
         }
+
+        /// Return 0.  Note that the extent of null-terminated input is not
+        /// known in advance, so none of it is ever available for bulk
+        /// processing.
+        bsl::size_t numAvailable(const UTF16_WORD *) const
+        {
+            return 0;
+        }
     };
 
     // CLASS METHODS
@@ -932,7 +988,7 @@ struct Utf16 {
 template <class UTF16_WORD>
 struct Swapper {
 
-    enum { k_SIZE = sizeof(UTF16_WORD) };
+    enum { k_SIZE = sizeof(UTF16_WORD), k_IS_SWAPPED = 1 };
 
     // CLASS METHODS
 
@@ -989,6 +1045,8 @@ struct Swapper {
 template <class UTF16_WORD>
 struct NoOpSwapper {
 
+    enum { k_IS_SWAPPED = 0 };
+
     // CLASS METHODS
 
     /// Return the Unicode code point version of the specified `*utf16Buf`
@@ -1040,6 +1098,259 @@ struct NoOpSwapper {
 BSLMF_ASSERT(sizeof(wchar_t)                  >= sizeof(unsigned short));
 BSLMF_ASSERT(sizeof(bsl::wstring::value_type) >= sizeof(unsigned short));
 
+                        // ----------------
+                        // ASCII-run kernels
+                        // ----------------
+
+// The functions in this section convert, or count, a run of ASCII characters
+// in bulk, and are used by the translation and length-estimation loops below
+// at the beginning of each run of ASCII input whose extent is known (i.e.,
+// input specified by an end pointer or length, rather than null-terminated).
+// Each returns the length of the prefix of its input, at most `n`
+// characters, that it processed, which is always a whole number of blocks;
+// the remainder of the run, if any, is then processed by the
+// code-point-at-a-time loop as before, which therefore determines the result
+// for all non-ASCII input.  Where the running processor supports SSE2, the
+// vector kernels are used, which widen 16 octets to 16 words by interleaving
+// them with zero bytes, or narrow 16 words to 16 octets with saturating
+// packs, after checking that the whole block is ASCII.  Otherwise, portable
+// kernels test 8 octets or 4 words at a time.
+
+#if defined(BDLDE_CHARCONVERTUTF16_SIMD_ENABLED)
+
+/// Return `true` if the running processor supports the SSE2 instructions,
+/// and `false` otherwise.
+bool detectSse2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+/// Store into the specified `dst`, if not null, the 2- or 4-byte words, as
+/// specified by `WORD_SIZE`, in host byte order if `SWAPPED` is `false` and
+/// swapped otherwise, encoding the leading ASCII octets of the specified
+/// `src` having the specified `n` octets, 16 at a time, and return the number
+/// of octets processed.
+template <int WORD_SIZE, bool SWAPPED>
+BDLDE_CHARCONVERTUTF16_SSE2_TARGET
+bsl::size_t widenAsciiSse2(void *dst, const unsigned char *src, bsl::size_t n)
+{
+    const __m128i  zero = _mm_setzero_si128();
+    __m128i       *out  = static_cast<__m128i *>(dst);
+    bsl::size_t    ii   = 0;
+
+    for (; ii + 16 <= n; ii += 16) {
+        const __m128i in = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(src + ii));
+        if (_mm_movemask_epi8(in)) {
+            break;
+        }
+        if (!out) {
+            continue;
+        }
+
+        // Interleaving with zero bytes on the left places each octet in the
+        // low-order byte of its little-endian word, and on the right, in the
+        // high-order (swapped) byte.
+
+        const __m128i lo = SWAPPED ? _mm_unpacklo_epi8(zero, in)
+                                   : _mm_unpacklo_epi8(in, zero);
+        const __m128i hi = SWAPPED ? _mm_unpackhi_epi8(zero, in)
+                                   : _mm_unpackhi_epi8(in, zero);
+
+        if (2 == WORD_SIZE) {
+            _mm_storeu_si128(out++, lo);
+            _mm_storeu_si128(out++, hi);
+        }
+        else {
+            _mm_storeu_si128(out++, SWAPPED ? _mm_unpacklo_epi16(zero, lo)
+                                            : _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(out++, SWAPPED ? _mm_unpackhi_epi16(zero, lo)
+                                            : _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(out++, SWAPPED ? _mm_unpacklo_epi16(zero, hi)
+                                            : _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(out++, SWAPPED ? _mm_unpackhi_epi16(zero, hi)
+                                            : _mm_unpackhi_epi16(hi, zero));
+        }
+    }
+
+    return ii;
+}
+
+/// Store into the specified `dst`, if not null, the ASCII octets encoded by
+/// the leading ASCII words of the specified `src` having the specified `n`
+/// 2- or 4-byte words, as specified by `WORD_SIZE`, in host byte order if
+/// `SWAPPED` is `false` and swapped otherwise, 16 at a time, and return the
+/// number of words processed.
+template <int WORD_SIZE, bool SWAPPED>
+BDLDE_CHARCONVERTUTF16_SSE2_TARGET
+bsl::size_t narrowAsciiSse2(char *dst, const void *src, bsl::size_t n)
+{
+    // A word is ASCII if none of the bits in `mask` is set.  The bits are
+    // those of the value above the low-order 7, wherever the byte order
+    // places them.
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask = 2 == WORD_SIZE
+                       ? _mm_set1_epi16(static_cast<short>(SWAPPED ? 0x80ff
+                                                                   : 0xff80))
+                       : _mm_set1_epi32(static_cast<int>(SWAPPED ? 0x80ffffff
+                                                               : 0xffffff80));
+
+    const __m128i *in = static_cast<const __m128i *>(src);
+    bsl::size_t    ii = 0;
+
+    for (; ii + 16 <= n; ii += 16) {
+        __m128i packed;
+
+        if (2 == WORD_SIZE) {
+            __m128i a = _mm_loadu_si128(in);
+            __m128i b = _mm_loadu_si128(in + 1);
+            if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(
+                               _mm_and_si128(_mm_or_si128(a, b), mask), zero))) {
+                break;
+            }
+            if (SWAPPED) {
+                a = _mm_srli_epi16(a, 8);
+                b = _mm_srli_epi16(b, 8);
+            }
+            packed = _mm_packus_epi16(a, b);
+            in += 2;
+        }
+        else {
+            __m128i a = _mm_loadu_si128(in);
+            __m128i b = _mm_loadu_si128(in + 1);
+            __m128i c = _mm_loadu_si128(in + 2);
+            __m128i d = _mm_loadu_si128(in + 3);
+            if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(
+                  _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b),
+                                             _mm_or_si128(c, d)),
+                                mask),
+                  zero))) {
+                break;
+            }
+            if (SWAPPED) {
+                a = _mm_srli_epi32(a, 24);
+                b = _mm_srli_epi32(b, 24);
+                c = _mm_srli_epi32(c, 24);
+                d = _mm_srli_epi32(d, 24);
+            }
+            packed = _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                      _mm_packs_epi32(c, d));
+            in += 4;
+        }
+
+        if (dst) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + ii), packed);
+        }
+    }
+
+    return ii;
+}
+
+typedef bsl::size_t (*WidenAsciiFn)(void                *dst,
+                                    const unsigned char *src,
+                                    bsl::size_t          n);
+typedef bsl::size_t (*NarrowAsciiFn)(char       *dst,
+                                     const void *src,
+                                     bsl::size_t n);
+
+/// This `struct` holds the vector kernels, indexed by whether the words are
+/// 4 bytes long and by whether they are swapped.
+struct AsciiKernels {
+    WidenAsciiFn  d_widen[2][2];
+    NarrowAsciiFn d_narrow[2][2];
+};
+
+/// Return the address of the vector kernels if the running processor
+/// supports them, and 0 otherwise.
+const AsciiKernels *asciiKernels()
+{
+    static const AsciiKernels kernels = {
+        { { &widenAsciiSse2<2, false>,  &widenAsciiSse2<2, true>  },
+          { &widenAsciiSse2<4, false>,  &widenAsciiSse2<4, true>  } },
+        { { &narrowAsciiSse2<2, false>, &narrowAsciiSse2<2, true> },
+          { &narrowAsciiSse2<4, false>, &narrowAsciiSse2<4, true> } }
+    };
+    static const AsciiKernels *kernelsPtr = 0;
+
+    BSLMT_ONCE_DO {
+        kernelsPtr = detectSse2() ? &kernels : 0;
+    }
+
+    return kernelsPtr;
+}
+
+#endif
+
+/// Store into the specified `dst`, if not null, the `UTF16_WORD`s encoding
+/// the leading ASCII octets of the specified `src` having the specified `n`
+/// octets, swapped by `SWAPPER`, and return the number of octets processed.
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t widenAscii(UTF16_WORD            *dst,
+                       const Utf8::OctetType *src,
+                       bsl::size_t            n)
+{
+#if defined(BDLDE_CHARCONVERTUTF16_SIMD_ENABLED)
+    if (const AsciiKernels *kernels = asciiKernels()) {
+        return kernels->d_widen[4 == sizeof(UTF16_WORD)]
+                               [SWAPPER::k_IS_SWAPPED](dst, src, n);
+                                                                      // RETURN
+    }
+#endif
+
+    bsl::size_t ii = 0;
+    for (; ii + 8 <= n; ii += 8) {
+        bsls::Types::Uint64 octets;
+        bsl::memcpy(&octets, src + ii, sizeof octets);
+        if (octets & 0x8080808080808080ULL) {
+            break;
+        }
+        if (dst) {
+            for (int jj = 0; jj < 8; ++jj) {
+                dst[ii + jj] = SWAPPER::encodeSingleWord(src[ii + jj]);
+            }
+        }
+    }
+
+    return ii;
+}
+
+/// Store into the specified `dst`, if not null, the ASCII octets encoded by
+/// the leading ASCII words, swapped by `SWAPPER`, of the specified `src`
+/// having the specified `n` words, and return the number of words
+/// processed.
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t narrowAscii(char *dst, const UTF16_WORD *src, bsl::size_t n)
+{
+#if defined(BDLDE_CHARCONVERTUTF16_SIMD_ENABLED)
+    if (const AsciiKernels *kernels = asciiKernels()) {
+        return kernels->d_narrow[4 == sizeof(UTF16_WORD)]
+                                [SWAPPER::k_IS_SWAPPED](dst, src, n);
+                                                                      // RETURN
+    }
+#endif
+
+    bsl::size_t ii = 0;
+    for (; ii + 4 <= n; ii += 4) {
+        const UnicodeCodePoint w0 = SWAPPER::decodeSingleWord(src + ii);
+        const UnicodeCodePoint w1 = SWAPPER::decodeSingleWord(src + ii + 1);
+        const UnicodeCodePoint w2 = SWAPPER::decodeSingleWord(src + ii + 2);
+        const UnicodeCodePoint w3 = SWAPPER::decodeSingleWord(src + ii + 3);
+        if (!Utf16::isSingleUtf8(w0 | w1 | w2 | w3)) {
+            break;
+        }
+        if (dst) {
+            dst[ii]     = static_cast<char>(w0);
+            dst[ii + 1] = static_cast<char>(w1);
+            dst[ii + 2] = static_cast<char>(w2);
+            dst[ii + 3] = static_cast<char>(w3);
+        }
+    }
+
+    return ii;
+}
+
 // These template functions should be in the unnamed namespace, because if they
 // are declared static, you have to fully specialize them every time you call
 // them.
@@ -1067,12 +1378,31 @@ bsl::size_t computeRequiredUtf16WordsImp(const char  *srcBuffer,
 
     const Utf8::OctetType *octets = static_cast<const Utf8::OctetType*>(
                                           static_cast<const void*>(srcBuffer));
+    bool atRunStart = true;
     while (!endFunctor.isFinished(octets)) {
         if      (Utf8::isSingleOctet(     *octets)) {
+            if (atRunStart) {
+                // Count as much of this run of ASCII as possible in bulk.
+
+                atRunStart = false;
+
+                const bsl::size_t n = widenAscii<unsigned short,
+                                                 NoOpSwapper<unsigned short> >(
+                                              0,
+                                              octets,
+                                              endFunctor.numAvailable(octets));
+                octets      += n;
+                wordsNeeded += n;
+                continue;
+            }
             ++octets;
             ++wordsNeeded;
+            continue;
         }
-        else if (Utf8::isTwoOctetHeader(  *octets)) {
+
+        atRunStart = true;
+
+        if      (Utf8::isTwoOctetHeader(  *octets)) {
             octets += endFunctor.verifyContinuations(octets + 1, 1) ? 2 : 1;
             ++wordsNeeded;
         }
@@ -1193,6 +1523,7 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
 
     const Utf8::OctetType *octets = static_cast<const Utf8::OctetType*>(
                                           static_cast<const void*>(srcBuffer));
+    bool atRunStart = true;
     while (!endFunctor.isFinished(octets)) {
         // Checking for output space is tricky.  If we have an error case and
         // no replacement word, we may consume input octets without using any
@@ -1209,6 +1540,22 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
         // Single-octet case is simple and quick.
 
         if (Utf8::isSingleOctet(*octets)) {
+            if (atRunStart) {
+                // Translate as much of this run of ASCII as possible, and as
+                // will fit, in bulk.
+
+                atRunStart = false;
+
+                const bsl::size_t n = widenAscii<UTF16_WORD, SWAPPER>(
+                          dstBuffer,
+                          octets,
+                          dstCapacity.limit(endFunctor.numAvailable(octets)));
+                octets      += n;
+                dstBuffer   += n;
+                dstCapacity -= n;
+                nCodePoints += n;
+                continue;
+            }
             if (dstCapacity < 2) {
                 // Are we out of output room, with only space for the null?
 
@@ -1226,6 +1573,8 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
 
         // Two, three, or four octets needed.
 
+        atRunStart = true;
+
         // The error cases have a lot of repetition.  With the optimizer on,
         // the repeated code should all get folded together.
 
@@ -1426,15 +1775,33 @@ bsl::size_t requiredUtf8BytesImp(const UTF16_WORD *srcBuffer,
                        // 'SWAPPER', but not the variable 'swapper'.
 
     bsl::size_t bytesNeeded = 0;
+    bool        atRunStart  = true;
     while (!endFunctor.isFinished(srcBuffer)) {
         UnicodeCodePoint word0, word1;
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
         if      (Utf16::isSingleUtf8(word0)) {
+            if (atRunStart) {
+                // Count as much of this run of ASCII as possible in bulk.
+
+                atRunStart = false;
+
+                const bsl::size_t n = narrowAscii<UTF16_WORD, SWAPPER>(
+                                           0,
+                                           srcBuffer,
+                                           endFunctor.numAvailable(srcBuffer));
+                srcBuffer   += n;
+                bytesNeeded += n;
+                continue;
+            }
             ++srcBuffer;
             ++bytesNeeded;
+            continue;
         }
-        else if (Utf16::isSingleWord(word0)) {
+
+        atRunStart = true;
+
+        if      (Utf16::isSingleWord(word0)) {
             ++srcBuffer;
             bytesNeeded += Utf8::fitsInTwoOctets(word0) ? 2 : 3;
         }
@@ -1504,7 +1871,8 @@ int localUtf16ToUtf8(char             *dstBuffer,
 
     bsl::size_t nCodePoints = 0;
 
-    int returnStatus = 0;
+    int  returnStatus = 0;
+    bool atRunStart   = true;
     while (!endFunctor.isFinished(srcBuffer)) {
         // We don't do the out-of-room tests until we know that we can
         // generate valid Unicode code points from the UTF-16 string.
@@ -1515,6 +1883,22 @@ int localUtf16ToUtf8(char             *dstBuffer,
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
         if (Utf16::isSingleUtf8(word0)) {
+            if (atRunStart) {
+                // Translate as much of this run of ASCII as possible, and as
+                // will fit, in bulk.
+
+                atRunStart = false;
+
+                const bsl::size_t n = narrowAscii<UTF16_WORD, SWAPPER>(
+                        dstBuffer,
+                        srcBuffer,
+                        dstCapacity.limit(endFunctor.numAvailable(srcBuffer)));
+                srcBuffer   += n;
+                dstBuffer   += n;
+                dstCapacity -= n;
+                nCodePoints += n;
+                continue;
+            }
             if (dstCapacity < 2) {
                 // One for the code point, one for the null.
 
@@ -1529,6 +1913,8 @@ int localUtf16ToUtf8(char             *dstBuffer,
             continue;
         }
 
+        atRunStart = true;
+
         UnicodeCodePoint convBuf;
 
         // Is it a single-word code point?
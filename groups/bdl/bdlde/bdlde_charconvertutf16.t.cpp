@@ -129,8 +129,9 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
-// [18] USAGE EXAMPLE 2
-// [17] USAGE EXAMPLE 1
+// [19] USAGE EXAMPLE 2
+// [18] USAGE EXAMPLE 1
+// [17] ASCII RUNS: LENGTH-DELIMITED VS NULL-TERMINATED INPUT
 // [16] UTF-8 LENGTH CALCULATION TEST -- INCORRECT UNICODE
 // [15] UTF-16 LENGTH CALCULATION TEST -- INCORRECT UNICODE
 // [14] UTF-16 & UTF-8 LENGTH CALCULATION TEST -- CORRECT UNICODE
@@ -148,6 +149,11 @@ using namespace bsl;
 // [ 2] SINGLE-VALUE, LEGAL VALUE TEST
 // [ 1] BREATHING/USAGE TEST
 //-----------------------------------------------------------------------------
+// [17] utf8ToUtf16(ushort *, size_t, const string_view&, ...);
+// [17] utf16ToUtf8(char *, size_t, const ushort *, size_t, ...);
+// [17] utf16ToUtf8(char *, size_t, const wstring_view&, ...);
+// [17] computeRequiredUtf16Words(char *, char *);
+// [17] computeRequiredUtf8Bytes(ushort *, ushort *, byteOrder);
 // [16] computeRequiredUtf8Bytes(w_char_t *, w_char_t *, byteOrder);
 // [16] computeRequiredUtf8Bytes(ushort *, ushort *, byteOrder);
 // [15] computeRequiredUtf16Words(char *, char *);
@@ -4880,6 +4886,11 @@ class TestDriver {
   public:
     // PUBLIC CLASS METHODS
 
+    /// Verify that length-delimited input containing ASCII runs, with
+    /// UTF-16 of the specified `byteOrder`, is translated identically to
+    /// the same input passed null-terminated.
+    static void testCase17(bdlde::ByteOrder::Enum byteOrder);
+
     /// Test the calculations of length estimates for UTF-16 containing
     /// errors translated into UTF-8.  The UTF-16 is to be of the specified
     /// `byteOrder`.
@@ -5662,6 +5673,250 @@ void TestDriver::randomInvalidUtf16Vector(
                             // -----------------
 
 // PUBLIC CLASS METHODS
+void TestDriver::testCase17(bdlde::ByteOrder::Enum byteOrder)
+    // ------------------------------------------------------------------------
+    // ASCII RUNS: LENGTH-DELIMITED VS NULL-TERMINATED INPUT
+    //
+    // Concerns:
+    // 1. That length-delimited input, for which runs of ASCII characters are
+    //    widened or narrowed in bulk, is translated exactly as the same
+    //    input passed null-terminated, for which every character is
+    //    translated individually.
+    //
+    // 2. That status, code point count, word / byte count, and output
+    //    contents are identical for every output capacity, including
+    //    capacities that end in the middle of an ASCII run.
+    //
+    // 3. That errors following or interrupting ASCII runs are reported
+    //    identically.
+    //
+    // 4. That the length calculation functions agree between the two forms
+    //    of input.
+    //
+    // Plan:
+    // 1. Create random UTF-8 strings consisting of ASCII runs of random
+    //    length interleaved with random valid and, occasionally, invalid
+    //    multi-octet sequences.
+    //
+    // 2. Translate each string to UTF-16 in the specified `byteOrder` into
+    //    buffers of every capacity, passing the input both as a
+    //    `string_view` and as a null-terminated `const char *`, and observe
+    //    that the results match.  (C-1..3)
+    //
+    // 3. Occasionally replace a word of the UTF-16 result with a lone
+    //    surrogate, then translate it back to UTF-8 into buffers of every
+    //    capacity, passing the input both with a length and null-terminated,
+    //    in both `unsigned short` and `wchar_t` form, and observe that the
+    //    results match.  (C-1..3)
+    //
+    // 4. Call `computeRequiredUtf16Words` and `computeRequiredUtf8Bytes`
+    //    both with and without an end pointer and observe that the results
+    //    match.  (C-4)
+    //
+    // Testing:
+    //   utf8ToUtf16(ushort *, size_t, const string_view&, ...);
+    //   utf16ToUtf8(char *, size_t, const ushort *, size_t, ...);
+    //   utf16ToUtf8(char *, size_t, const wstring_view&, ...);
+    //   computeRequiredUtf16Words(char *, char *);
+    //   computeRequiredUtf8Bytes(ushort *, ushort *, byteOrder);
+    // ------------------------------------------------------------------------
+{
+    bslma::Allocator *alloc = &bslma::NewDeleteAllocator::singleton();
+
+    typedef bdlde::CharConvertStatus CCS;
+
+    enum { k_ITERATIONS = 400 };
+    for (int ii = 0; ii < k_ITERATIONS; ++ii) {
+        bsl::string utf8(alloc);
+
+        const unsigned numSegments = 1 + s_randGen.bits(3);
+        for (unsigned jj = 0; jj < numSegments; ++jj) {
+            const unsigned runLength = 0 == s_randGen.bits(2)
+                                     ? 64 + s_randGen.bits(6)
+                                     : s_randGen.bits(5);
+            for (unsigned kk = 0; kk < runLength; ++kk) {
+                appendRandomValidSingleOctet(&utf8);
+            }
+            if (0 == s_randGen.bits(3)) {
+                appendRandomInvalidUtf8CodePoint(&utf8);
+            }
+            else {
+                appendRandomValidUtf8CodePoint(&utf8);
+            }
+        }
+        ASSERT(bsl::strlen(utf8.c_str()) == utf8.length());
+
+        if (veryVerbose) cout << displayUtf8(utf8) << endl;
+
+        const char        *SRC8      = utf8.c_str();
+        const bsl::size_t  LEN8      = utf8.length();
+        const bsl::size_t  NUM_WORDS = Util::computeRequiredUtf16Words(SRC8);
+
+        ASSERTV(ii, NUM_WORDS == Util::computeRequiredUtf16Words(SRC8,
+                                                                 SRC8 + LEN8));
+
+        // UTF-8 -> UTF-16
+
+        bsl::vector<unsigned short> expBuf(NUM_WORDS + 2, 0xabcd, alloc);
+        bsl::vector<unsigned short> buf(   NUM_WORDS + 2, 0xabcd, alloc);
+
+        for (bsl::size_t cap = 0; cap <= NUM_WORDS + 1; ++cap) {
+            bsl::fill(expBuf.begin(), expBuf.end(), 0xabcd);
+            bsl::fill(buf.begin(),    buf.end(),    0xabcd);
+
+            bsl::size_t expNumCodePoints = -1, expNumWords = -1;
+            const int EXP_RC = Util::utf8ToUtf16(expBuf.data(),
+                                                 cap,
+                                                 SRC8,
+                                                 &expNumCodePoints,
+                                                 &expNumWords,
+                                                 '?',
+                                                 byteOrder);
+
+            bsl::size_t numCodePoints = -1, numWords = -1;
+            const int RC = Util::utf8ToUtf16(buf.data(),
+                                             cap,
+                                             bsl::string_view(SRC8, LEN8),
+                                             &numCodePoints,
+                                             &numWords,
+                                             '?',
+                                             byteOrder);
+
+            ASSERTV(ii, cap, EXP_RC, RC, EXP_RC == RC);
+            ASSERTV(ii, cap, expNumCodePoints, numCodePoints,
+                                            expNumCodePoints == numCodePoints);
+            ASSERTV(ii, cap, expNumWords, numWords, expNumWords == numWords);
+            ASSERTV(ii, cap, expBuf == buf);
+            ASSERTV(ii, cap, NUM_WORDS, numWords,
+                                 cap < NUM_WORDS || NUM_WORDS == numWords);
+        }
+
+        bsl::vector<unsigned short> utf16(alloc);
+        int rc = Util::utf8ToUtf16(&utf16,
+                                   bsl::string_view(SRC8, LEN8),
+                                   0,
+                                   '?',
+                                   byteOrder);
+        ASSERTV(ii, NUM_WORDS == utf16.size());
+        ASSERTV(ii, bsl::equal(utf16.begin(), utf16.end(), expBuf.begin()));
+        ASSERTV(ii, rc, 0 == (rc & ~CCS::k_INVALID_INPUT_BIT));
+
+        // Occasionally insert a lone surrogate into the UTF-16.
+
+        if (NUM_WORDS > 1 && 0 == s_randGen.bits(2)) {
+            const bsl::size_t   pos = s_randGen.bits(16) % (NUM_WORDS - 1);
+            const unsigned short w  = s_randGen.bits(1)
+                                    ? randomUtf16SurrogateLo()
+                                    : randomUtf16SurrogateHi();
+            utf16[pos] = bdlde::ByteOrder::e_HOST == byteOrder
+                       ? w
+                       : bsls::ByteOrderUtil::swapBytes(w);
+        }
+
+        const unsigned short *SRC16 = utf16.data();
+        const bsl::size_t     LEN16 = utf16.size() - 1;
+
+        const bsl::size_t NUM_BYTES = Util::computeRequiredUtf8Bytes(
+                                              SRC16,
+                                              static_cast<unsigned short *>(0),
+                                              byteOrder);
+        ASSERTV(ii, NUM_BYTES == Util::computeRequiredUtf8Bytes(SRC16,
+                                                                SRC16 + LEN16,
+                                                                byteOrder));
+
+        bsl::wstring wUtf16(alloc);
+        copyUtf16ToWstring(&wUtf16, utf16, byteOrder);
+
+        ASSERTV(ii, NUM_BYTES == Util::computeRequiredUtf8Bytes(
+                                                     wUtf16.c_str(),
+                                                     static_cast<wchar_t *>(0),
+                                                     byteOrder));
+        ASSERTV(ii, NUM_BYTES == Util::computeRequiredUtf8Bytes(
+                                              wUtf16.c_str(),
+                                              wUtf16.c_str() + wUtf16.length(),
+                                              byteOrder));
+
+        // UTF-16 -> UTF-8
+
+        bsl::string expOut(NUM_BYTES + 2, 'x', alloc);
+        bsl::string out(   NUM_BYTES + 2, 'x', alloc);
+
+        for (bsl::size_t cap = 0; cap <= NUM_BYTES + 1; ++cap) {
+            expOut.assign(NUM_BYTES + 2, 'x');
+            out.assign(   NUM_BYTES + 2, 'x');
+
+            bsl::size_t expNumCodePoints = -1, expNumBytes = -1;
+            const int EXP_RC = Util::utf16ToUtf8(expOut.data(),
+                                                 cap,
+                                                 SRC16,
+                                                 &expNumCodePoints,
+                                                 &expNumBytes,
+                                                 '?',
+                                                 byteOrder);
+
+            bsl::size_t numCodePoints = -1, numBytes = -1;
+            int RC = Util::utf16ToUtf8(out.data(),
+                                       cap,
+                                       SRC16,
+                                       LEN16,
+                                       &numCodePoints,
+                                       &numBytes,
+                                       '?',
+                                       byteOrder);
+
+            ASSERTV(ii, cap, EXP_RC, RC, EXP_RC == RC);
+            ASSERTV(ii, cap, expNumCodePoints, numCodePoints,
+                                            expNumCodePoints == numCodePoints);
+            ASSERTV(ii, cap, expNumBytes, numBytes, expNumBytes == numBytes);
+            ASSERTV(ii, cap, expOut == out);
+            ASSERTV(ii, cap, NUM_BYTES, numBytes,
+                                 cap < NUM_BYTES || NUM_BYTES == numBytes);
+
+            out.assign(NUM_BYTES + 2, 'x');
+            numCodePoints = -1, numBytes = -1;
+            RC = Util::utf16ToUtf8(out.data(),
+                                   cap,
+                                   wUtf16.c_str(),
+                                   &numCodePoints,
+                                   &numBytes,
+                                   '?',
+                                   byteOrder);
+
+            ASSERTV(ii, cap, EXP_RC, RC, EXP_RC == RC);
+            ASSERTV(ii, cap, expNumCodePoints == numCodePoints);
+            ASSERTV(ii, cap, expNumBytes == numBytes);
+            ASSERTV(ii, cap, expOut == out);
+
+            out.assign(NUM_BYTES + 2, 'x');
+            numCodePoints = -1, numBytes = -1;
+            RC = Util::utf16ToUtf8(out.data(),
+                                   cap,
+                                   bsl::wstring_view(wUtf16),
+                                   &numCodePoints,
+                                   &numBytes,
+                                   '?',
+                                   byteOrder);
+
+            ASSERTV(ii, cap, EXP_RC, RC, EXP_RC == RC);
+            ASSERTV(ii, cap, expNumCodePoints == numCodePoints);
+            ASSERTV(ii, cap, expNumBytes == numBytes);
+            ASSERTV(ii, cap, expOut == out);
+        }
+
+        // Drop errors rather than substituting for them.
+
+        bsl::string expStr(alloc), str(alloc);
+        rc = Util::utf16ToUtf8(&expStr, SRC16, 0, 0, byteOrder);
+        ASSERTV(ii, rc == Util::utf16ToUtf8(&str,
+                                            SRC16,
+                                            LEN16,
+                                            0,
+                                            0,
+                                            byteOrder));
+        ASSERTV(ii, expStr == str);
+    }
+}
+
 void TestDriver::testCase16(bdlde::ByteOrder::Enum byteOrder)
     // ------------------------------------------------------------------------
     // UTF-8 LENGTH CALCULATION TEST -- INCORRECT UNICODE
@@ -7755,7 +8010,7 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         // --------------------------------------------------------------------
@@ -7881,7 +8136,7 @@ int main(int argc, char**argv)
     ASSERT(utf16CodePointsWritten       == uf8CodePointsWritten);
 // ```
       } break;
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         // --------------------------------------------------------------------
@@ -7974,6 +8229,20 @@ int main(int argc, char**argv)
     ASSERT(0    == secondUtf16String[5]);
 // ```
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // ASCII RUNS: LENGTH-DELIMITED VS NULL-TERMINATED INPUT
+        //
+        // Documentation at start of `void testCase17`.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout <<
+                     "ASCII RUNS: LENGTH-DELIMITED VS NULL-TERMINATED INPUT\n"
+                     "=====================================================\n";
+
+        TestDriver::testCase17(bdlde::ByteOrder::e_LITTLE_ENDIAN);
+        TestDriver::testCase17(bdlde::ByteOrder::e_BIG_ENDIAN);
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // UTF-8 LENGTH CALCULATION TEST -- INCORRECT UNICODE
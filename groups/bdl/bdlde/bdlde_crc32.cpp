@@ -6,7 +6,21 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 
 #include <bslmf_assert.h>
 
-#include <bsls_annotation.h>
+#include <bslmt_once.h>
+
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <emmintrin.h>
+# include <wmmintrin.h>
+# define BDLDE_CRC32_PCLMUL_ENABLED
+# define BDLDE_CRC32_PCLMUL_TARGET __attribute__((target("pclmul,sse2")))
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -79,12 +93,30 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 // The main advantage of this algorithm is that the table-based lookup approach
 // greatly improves the performance of the CRC calculation (see Sarwate, D.V.,
 // "Computation of Cyclic Redundancy Checks via Table Look-Up", Communications
-// of the ACM, 31(8), pp.  1008-1013).  Additionally, the Duff's Device-based
-// implementation used in this component linearly improves the performance of
-// the 'update_crc' method above; see:
-//..
-//  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
-//..
+// of the ACM, 31(8), pp.  1008-1013).
+//
+// The software implementation used in this component extends the table
+// lookup to the "slice-by-8" algorithm, which consumes 8 bytes per step using
+// 8 tables, where 'table[k][b]' is the CRC register obtained by processing
+// the byte 'b' followed by 'k' zero bytes.  'table[0]' is 'CRC_TABLE', and
+// the remaining tables are derived from it on first use.
+//
+// On x86 processors supporting the PCLMULQDQ (carry-less multiplication)
+// instruction, buffers of at least 64 bytes are instead processed by
+// "folding", as described in Gopal et al., "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).  Four 128-bit
+// accumulators are each advanced over 512 bits of input per step by
+// multiplying their two halves by 'x^(512+64-1) mod P' and
+// 'x^(512-1) mod P' (bit-reflected, as the CRC is), and are then folded into
+// one 128-bit accumulator congruent to the data processed so far.  Rather
+// than a Barrett reduction, the final reduction of that accumulator computes
+// its CRC, starting from a zero register, with the table-based algorithm.
+//
+// 'Crc32::combine' multiplies the checksum of the first message by
+// 'x^(8 * lengthB) mod P', computing that power by repeated squaring, which
+// is the method used by 'crc32_combine' in zlib.  Note that, because the
+// initial register value and the final XOR are the same, the checksums
+// themselves (rather than the registers) can be combined this way.
 
 #include <bsls_assert.h>
 #include <bsl_ostream.h>
@@ -151,41 +183,228 @@ static const unsigned int CRC_TABLE[256] = {
 };
 
 namespace bdlde {
+namespace {
+
+/// Bit-reflected CRC-32 polynomial (omitting the `x^32` term).
+const unsigned int k_POLYNOMIAL = 0xedb88320;
+
+/// Bit-reflected representation of the polynomial `1`.
+const unsigned int k_X_TO_THE_0 = 0x80000000;
+
+/// Tables for the slice-by-8 algorithm (see the implementation notes),
+/// initialized by `crc32Update`.
+unsigned int s_sliceTables[8][256];
+
+/// Whether the running processor supports the PCLMULQDQ-based
+/// implementation, initialized by `crc32Update`.
+bool s_hasPclmul = false;
+
+/// Return the product, modulo the CRC-32 polynomial, of the specified `a`
+/// and `b`, both in bit-reflected representation.
+unsigned int multiplyModulo(unsigned int a, unsigned int b)
+{
+    unsigned int product = 0;
+
+    for (unsigned int mask = k_X_TO_THE_0; mask; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+        }
+        b = (b & 1) ? (b >> 1) ^ k_POLYNOMIAL : b >> 1;
+    }
+    return product;
+}
+
+/// Return the CRC register resulting from processing the specified `data`
+/// having the specified `length` (in bytes), starting from the specified
+/// `crc` register, using the slice-by-8 algorithm.  The behavior is
+/// undefined unless `s_sliceTables` has been initialized.
+unsigned int updateSliceBy8(unsigned int         crc,
+                            const unsigned char *data,
+                            bsl::size_t          length)
+{
+    const unsigned int (&t)[8][256] = s_sliceTables;
+
+    for (; 8 <= length; length -= 8, data += 8) {
+        crc ^=  static_cast<unsigned int>(data[0])
+             | (static_cast<unsigned int>(data[1]) <<  8)
+             | (static_cast<unsigned int>(data[2]) << 16)
+             | (static_cast<unsigned int>(data[3]) << 24);
+
+        crc = t[7][ crc        & 0xff] ^ t[6][(crc >>  8) & 0xff]
+            ^ t[5][(crc >> 16) & 0xff] ^ t[4][ crc >> 24        ]
+            ^ t[3][data[4]]            ^ t[2][data[5]]
+            ^ t[1][data[6]]            ^ t[0][data[7]];
+    }
+
+    for (; length; --length, ++data) {
+        crc = t[0][(crc ^ *data) & 0xff] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+#if defined(BDLDE_CRC32_PCLMUL_ENABLED)
+
+/// Return `true` if the running processor supports the PCLMULQDQ and SSE2
+/// instructions, and `false` otherwise.
+bool detectPclmul()
+{
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid(1, eax, ebx, ecx, edx);
+
+    return (ecx & (1u << 1)) && (edx & (1u << 26));
+}
+
+/// Return the specified 128-bit `value` multiplied by the power of `x`
+/// specified by `constants`, which holds the multipliers for the upper
+/// (low 64 bits) and lower (high 64 bits) degree halves of `value`.
+inline BDLDE_CRC32_PCLMUL_TARGET
+__m128i foldPclmul(__m128i value, __m128i constants)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00),
+                         _mm_clmulepi64_si128(value, constants, 0x11));
+}
+
+/// Return the 16 bytes at the specified `data`.
+inline BDLDE_CRC32_PCLMUL_TARGET
+__m128i loadPclmul(const unsigned char *data)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+}
+
+/// Return the CRC register resulting from processing the specified `data`
+/// having the specified `length` (in bytes), starting from the specified
+/// `crc` register, by folding with the PCLMULQDQ instruction.  The
+/// behavior is undefined unless `s_sliceTables` has been initialized and
+/// the running processor supports PCLMULQDQ.
+BDLDE_CRC32_PCLMUL_TARGET
+unsigned int updatePclmul(unsigned int         crc,
+                          const unsigned char *data,
+                          bsl::size_t          length)
+{
+    if (length < 64) {
+        return updateSliceBy8(crc, data, length);                     // RETURN
+    }
+
+    typedef bsls::Types::Int64 Int64;
+
+    const __m128i fold512 = _mm_set_epi64x(
+                                  static_cast<Int64>(0xcad38e8f00000000ULL),
+                                  static_cast<Int64>(0x653d982200000000ULL));
+    const __m128i fold128 = _mm_set_epi64x(
+                                  static_cast<Int64>(0x9ba54c6f00000000ULL),
+                                  static_cast<Int64>(0x65673b4600000000ULL));
+
+    __m128i x0 = _mm_xor_si128(loadPclmul(data),
+                               _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x1 = loadPclmul(data + 16);
+    __m128i x2 = loadPclmul(data + 32);
+    __m128i x3 = loadPclmul(data + 48);
+
+    for (data += 64, length -= 64; 64 <= length; data += 64, length -= 64) {
+        x0 = _mm_xor_si128(foldPclmul(x0, fold512), loadPclmul(data));
+        x1 = _mm_xor_si128(foldPclmul(x1, fold512), loadPclmul(data + 16));
+        x2 = _mm_xor_si128(foldPclmul(x2, fold512), loadPclmul(data + 32));
+        x3 = _mm_xor_si128(foldPclmul(x3, fold512), loadPclmul(data + 48));
+    }
+
+    x1 = _mm_xor_si128(foldPclmul(x0, fold128), x1);
+    x2 = _mm_xor_si128(foldPclmul(x1, fold128), x2);
+    x3 = _mm_xor_si128(foldPclmul(x2, fold128), x3);
+
+    for (; 16 <= length; data += 16, length -= 16) {
+        x3 = _mm_xor_si128(foldPclmul(x3, fold128), loadPclmul(data));
+    }
+
+    unsigned char folded[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(folded), x3);
+
+    return updateSliceBy8(updateSliceBy8(0, folded, 16), data, length);
+}
+
+#else
+
+/// Return `false`.  There is no PCLMULQDQ-based implementation for the
+/// current platform.
+bool detectPclmul()
+{
+    return false;
+}
+
+/// Invoke `updateSliceBy8` with the specified `crc`, `data`, and `length`.
+unsigned int updatePclmul(unsigned int         crc,
+                          const unsigned char *data,
+                          bsl::size_t          length)
+{
+    return updateSliceBy8(crc, data, length);
+}
+
+#endif
+
+/// Alias for a function that returns the CRC register resulting from
+/// processing a buffer, starting from a given register.
+typedef unsigned int (*Crc32UpdateFn)(unsigned int         crc,
+                                      const unsigned char *data,
+                                      bsl::size_t          length);
+
+/// Return the fastest implementation of the CRC-32 register update
+/// available on the running platform, initializing `s_sliceTables` on the
+/// first call.
+Crc32UpdateFn crc32Update()
+{
+    static Crc32UpdateFn updateFn = 0;
+
+    BSLMT_ONCE_DO {
+        for (int byte = 0; byte < 256; ++byte) {
+            unsigned int crc = CRC_TABLE[byte];
+            s_sliceTables[0][byte] = crc;
+            for (int k = 1; k < 8; ++k) {
+                crc = CRC_TABLE[crc & 0xff] ^ (crc >> 8);
+                s_sliceTables[k][byte] = crc;
+            }
+        }
+        s_hasPclmul = detectPclmul();
+        updateFn    = s_hasPclmul ? &updatePclmul : &updateSliceBy8;
+    }
+
+    return updateFn;
+}
+
+}  // close unnamed namespace
+
                                 // -----------
                                 // class Crc32
                                 // -----------
 
-// MANIPULATORS
-void Crc32::update(const void *data, bsl::size_t length)
+// CLASS METHODS
+unsigned int Crc32::combine(unsigned int        crcA,
+                            unsigned int        crcB,
+                            bsls::Types::Uint64 lengthB)
 {
-    BSLS_ASSERT(data || !length);
+    // `power` is `x^(8 * 2^i)` on the `i`th iteration, and `factor`
+    // accumulates `x^(8 * lengthB)`.
 
-    // The following is a Duff's Device-based implementation of a common
-    // algorithm (see end of RFC 1952).
+    unsigned int power  = k_X_TO_THE_0 >> 8;
+    unsigned int factor = k_X_TO_THE_0;
 
-    const unsigned char *d   = (const unsigned char *)data;
-    unsigned int         tmp = d_crc;
-
-    switch (length % 4) {
-      case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-          BSLS_ANNOTATION_FALLTHROUGH;
-      case 2: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-          BSLS_ANNOTATION_FALLTHROUGH;
-      case 1: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-          BSLS_ANNOTATION_FALLTHROUGH;
-      default: ;
+    for (; lengthB; lengthB >>= 1) {
+        if (lengthB & 1) {
+            factor = multiplyModulo(factor, power);
+        }
+        power = multiplyModulo(power, power);
     }
 
-    bsl::size_t n = length / 4;
-    while (n) {
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        --n;
-    }
+    return multiplyModulo(crcA, factor) ^ crcB;
+}
 
-    d_crc = tmp;
+// MANIPULATORS
+void Crc32::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    d_crc = crc32Update()(d_crc,
+                          static_cast<const unsigned char *>(data),
+                          length);
 }
 
 // ACCESSORS
@@ -215,9 +434,52 @@ bsl::ostream& Crc32::print(bsl::ostream& stream) const
     return stream << array;
 }
 
+                              // -----------------
+                              // struct Crc32_Impl
+                              // -----------------
+
+// CLASS METHODS
+bool Crc32_Impl::hasHardwareCrc32()
+{
+    crc32Update();  // initialize `s_hasPclmul`
+
+    return s_hasPclmul;
+}
+
+unsigned int Crc32_Impl::calculateHardware(const void   *data,
+                                           bsl::size_t   length,
+                                           unsigned int  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    crc32Update();  // initialize the tables
+
+    BSLS_ASSERT(s_hasPclmul);
+
+    return ~updatePclmul(~crc,
+                         static_cast<const unsigned char *>(data),
+                         length);
+}
+
+unsigned int Crc32_Impl::calculateSoftware(const void   *data,
+                                           bsl::size_t   length,
+                                           unsigned int  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    crc32Update();  // initialize the tables
+
+    return ~updateSliceBy8(~crc,
+                           static_cast<const unsigned char *>(data),
+                           length);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BDLDE_CRC32_PCLMUL_TARGET
+#undef BDLDE_CRC32_PCLMUL_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2017 Bloomberg Finance L.P.
 //
@@ -64,6 +64,10 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // CLASS METHODS
 // [10] static int maxSupportedBdexVersion(int);
+// [16] static unsigned int combine(unsigned int, unsigned int, Uint64);
+// [15] static bool Crc32_Impl::hasHardwareCrc32();
+// [15] static unsigned int Crc32_Impl::calculateHardware(data, len, crc);
+// [15] static unsigned int Crc32_Impl::calculateSoftware(data, len, crc);
 //
 // CREATORS
 // [ 2] bdlde::Crc32();
@@ -89,10 +93,11 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: THROUGHPUT OF THE IMPLEMENTATIONS
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc32& gg(bdlde::Crc32 *object, const char *spec);
@@ -324,6 +329,16 @@ unsigned int crc(const char *buf, int len)
 {
     return update_crc(0, buf, len);
 }
+
+/// Fill the specified `data` with pseudo-random bytes derived from the
+/// specified `seed`.
+void fillPseudoRandom(bsl::vector<char> *data, unsigned int seed)
+{
+    for (bsl::size_t i = 0; i < data->size(); ++i) {
+        seed = seed * 1103515245 + 12345;
+        (*data)[i] = static_cast<char>(seed >> 16);
+    }
+}
                         // --------------------------------
                         // crc32 Implementation from dbutil
                         // --------------------------------
@@ -513,7 +528,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -544,6 +559,177 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING `combine`
+        //
+        // Concerns:
+        //   1. `combine(crcA, crcB, lengthB)` is the checksum of the
+        //      concatenation of two messages having the checksums `crcA` and
+        //      `crcB`, the second of which has length `lengthB`, for every
+        //      split point of a message.
+        //   2. Combining with an empty message has no effect.
+        //   3. `combine` is correct for long second messages, and is
+        //      associative.
+        //
+        // Plan:
+        //   1. For messages of various lengths, compare the checksum of the
+        //      message with the result of combining the checksums of its two
+        //      parts, for every split point.  (C-1..2)
+        //   2. Compare the checksum of a long message with the result of
+        //      combining the checksums of a short prefix and of the rest, and
+        //      verify that combining three parts in either order gives the
+        //      same result.  (C-3)
+        //
+        // Testing:
+        //   static unsigned int combine(unsigned int, unsigned int, Uint64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `combine`"
+                          << "\n=================" << endl;
+
+        bsl::vector<char> data(300);
+        fillPseudoRandom(&data, 1);
+
+        const int LENGTHS[] = { 0, 1, 7, 16, 64, 65, 200, 300 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int i = 0; i < NUM_LENGTHS; ++i) {
+            const int LENGTH = LENGTHS[i];
+
+            const unsigned int EXP = crc(data.data(), LENGTH);
+
+            for (int split = 0; split <= LENGTH; ++split) {
+                const unsigned int CRC_A = crc(data.data(), split);
+                const unsigned int CRC_B = crc(data.data() + split,
+                                               LENGTH - split);
+
+                LOOP2_ASSERT(LENGTH, split,
+                             EXP == Obj::combine(CRC_A,
+                                                 CRC_B,
+                                                 LENGTH - split));
+            }
+
+            LOOP_ASSERT(LENGTH, EXP == Obj::combine(EXP, 0, 0));
+        }
+
+        bsl::vector<char> longData(1 << 20);
+        fillPseudoRandom(&longData, 2);
+
+        const int          LONG_LENGTH = static_cast<int>(longData.size());
+        const unsigned int LONG_EXP    = crc(longData.data(), LONG_LENGTH);
+        const unsigned int CRC_A       = crc(longData.data(), 3);
+        const unsigned int CRC_B       = crc(longData.data() + 3, 1000);
+        const unsigned int CRC_C       = crc(longData.data() + 1003,
+                                             LONG_LENGTH - 1003);
+
+        ASSERT(LONG_EXP == Obj::combine(CRC_A,
+                                        crc(longData.data() + 3,
+                                            LONG_LENGTH - 3),
+                                        LONG_LENGTH - 3));
+        ASSERT(LONG_EXP == Obj::combine(Obj::combine(CRC_A, CRC_B, 1000),
+                                        CRC_C,
+                                        LONG_LENGTH - 1003));
+        ASSERT(LONG_EXP == Obj::combine(CRC_A,
+                                        Obj::combine(CRC_B,
+                                                     CRC_C,
+                                                     LONG_LENGTH - 1003),
+                                        LONG_LENGTH - 3));
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ALTERNATIVE IMPLEMENTATIONS
+        //
+        // Concerns:
+        //   1. The slice-by-8 and hardware-accelerated implementations, as
+        //      well as `update`, compute the same checksum as the RFC 1952
+        //      oracle, for lengths around the block sizes of each
+        //      implementation and for any alignment of the data.
+        //   2. The optional `crc` argument continues the checksum of a
+        //      preceding message.
+        //
+        // Plan:
+        //   1. For every length up to 300 bytes and several longer ones, and
+        //      for every alignment within 16 bytes, compare the checksums
+        //      computed by each implementation with the oracle.  (C-1)
+        //   2. Compare the checksum of a message computed in two parts,
+        //      passing the checksum of the first part to the calculation of
+        //      the second, with the oracle.  (C-2)
+        //
+        // Testing:
+        //   static bool Crc32_Impl::hasHardwareCrc32();
+        //   static unsigned int Crc32_Impl::calculateHardware(data, len, crc);
+        //   static unsigned int Crc32_Impl::calculateSoftware(data, len, crc);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ALTERNATIVE IMPLEMENTATIONS"
+                          << "\n===================================" << endl;
+
+        const bool HARDWARE = bdlde::Crc32_Impl::hasHardwareCrc32();
+        if (verbose) { P(HARDWARE); }
+
+        bsl::vector<char> data(5000 + 16);
+        fillPseudoRandom(&data, 0);
+
+        bsl::vector<int> lengths;
+        for (int length = 0; length <= 300; ++length) {
+            lengths.push_back(length);
+        }
+        lengths.push_back(1023);
+        lengths.push_back(1024);
+        lengths.push_back(4099);
+        lengths.push_back(5000);
+
+        for (bsl::size_t i = 0; i < lengths.size(); ++i) {
+            const int LENGTH = lengths[i];
+
+            for (int offset = 0; offset < 16; ++offset) {
+                const char         *DATA = data.data() + offset;
+                const unsigned int  EXP  = crc(DATA, LENGTH);
+
+                LOOP2_ASSERT(LENGTH, offset,
+                             EXP == Obj(DATA, LENGTH).checksum());
+                LOOP2_ASSERT(LENGTH, offset,
+                             EXP == bdlde::Crc32_Impl::calculateSoftware(
+                                                                     DATA,
+                                                                     LENGTH));
+                if (HARDWARE) {
+                    LOOP2_ASSERT(LENGTH, offset,
+                                 EXP == bdlde::Crc32_Impl::calculateHardware(
+                                                                     DATA,
+                                                                     LENGTH));
+                }
+            }
+
+            const int          SPLIT = LENGTH / 3;
+            const unsigned int EXP   = crc(data.data(), LENGTH);
+            const unsigned int SW    = bdlde::Crc32_Impl::calculateSoftware(
+                                                                 data.data(),
+                                                                 SPLIT);
+
+            LOOP_ASSERT(LENGTH,
+                        EXP == bdlde::Crc32_Impl::calculateSoftware(
+                                                         data.data() + SPLIT,
+                                                         LENGTH - SPLIT,
+                                                         SW));
+            if (HARDWARE) {
+                const unsigned int HW = bdlde::Crc32_Impl::calculateHardware(
+                                                                 data.data(),
+                                                                 SPLIT);
+
+                LOOP_ASSERT(LENGTH,
+                            EXP == bdlde::Crc32_Impl::calculateHardware(
+                                                         data.data() + SPLIT,
+                                                         LENGTH - SPLIT,
+                                                         HW));
+            }
+        }
+
+        ASSERT(0 == bdlde::Crc32_Impl::calculateSoftware(0, 0));
+        if (HARDWARE) {
+            ASSERT(0 == bdlde::Crc32_Impl::calculateHardware(0, 0));
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -2677,6 +2863,78 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT OF THE IMPLEMENTATIONS
+        //
+        // Concerns:
+        //   Report the throughput of the byte-at-a-time oracle, the
+        //   slice-by-8 implementation, and the hardware-accelerated
+        //   implementation.
+        //
+        // Plan:
+        //   Time each implementation over the same buffer, whose size may be
+        //   specified as the second argument (4 MB by default), repeated to
+        //   process 256 MB in total.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT OF THE IMPLEMENTATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: THROUGHPUT"
+                          << "\n============================" << endl;
+
+        const int SIZE       = argc > 2 && 0 < atoi(argv[2])
+                             ? atoi(argv[2])
+                             : 4 * 1024 * 1024;
+        const int TOTAL_SIZE = 256 * 1024 * 1024;
+        const int ITERATIONS = TOTAL_SIZE / SIZE;
+
+        bsl::vector<char> data(SIZE);
+        fillPseudoRandom(&data, 0);
+
+        const bool HARDWARE = bdlde::Crc32_Impl::hasHardwareCrc32();
+
+        cout << "implementation,buffer_size,seconds,megabytes_per_second\n";
+
+        for (int impl = 0; impl < 3; ++impl) {
+            static const char *const NAMES[] = { "bytewise",
+                                                 "slice-by-8",
+                                                 "hardware" };
+            if (2 == impl && !HARDWARE) {
+                continue;                                           // CONTINUE
+            }
+
+            unsigned int    result = 0;
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                switch (impl) {
+                  case 0: {
+                    result ^= crc(data.data(), SIZE);
+                  } break;
+                  case 1: {
+                    result ^= bdlde::Crc32_Impl::calculateSoftware(
+                                                                  data.data(),
+                                                                  SIZE);
+                  } break;
+                  default: {
+                    result ^= bdlde::Crc32_Impl::calculateHardware(
+                                                                  data.data(),
+                                                                  SIZE);
+                  } break;
+                }
+            }
+            timer.stop();
+
+            cout << NAMES[impl] << ',' << SIZE << ','
+                 << timer.elapsedTime() << ','
+                 << ITERATIONS * static_cast<double>(SIZE)
+                                            / timer.elapsedTime() / 1e6
+                 << '\n';
+            if (veryVerbose) { P(result); }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -6,11 +6,48 @@
 // This implements the CRC-64 defined in ECMA 182 (with reversed polynomial
 // 0xC96C5795D7870F42), in the usual manner:
 //   http://en.wikipedia.org/wiki/Cyclic_redundancy_check
+//
+// The software implementation extends the table lookup to the "slice-by-8"
+// algorithm, which consumes 8 bytes per step using 8 tables, where
+// `table[k][b]` is the CRC register obtained by processing the byte `b`
+// followed by `k` zero bytes.  `table[0]` is `CRC_TABLE`, and the remaining
+// tables are derived from it on first use.
+//
+// On x86 processors supporting the PCLMULQDQ (carry-less multiplication)
+// instruction, buffers of at least 64 bytes are instead processed by
+// "folding", as described in Gopal et al., "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).  Four 128-bit
+// accumulators are each advanced over 512 bits of input per step by
+// multiplying their two halves by `x^(512+64-1) mod P` and `x^(512-1) mod P`
+// (bit-reflected, as the CRC is), and are then folded into one 128-bit
+// accumulator congruent to the data processed so far.  Rather than a Barrett
+// reduction, the final reduction of that accumulator computes its CRC,
+// starting from a zero register, with the table-based algorithm.
+//
+// `Crc64::combine` multiplies the checksum of the first message by
+// `x^(8 * lengthB) mod P`, computing that power by repeated squaring, which
+// is the method used by `crc32_combine` in zlib.  Note that, because the
+// initial register value and the final XOR are the same, the checksums
+// themselves (rather than the registers) can be combined this way.
 
 #include <bsl_ostream.h>
-#include <bsls_annotation.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <emmintrin.h>
+# include <wmmintrin.h>
+# define BDLDE_CRC64_PCLMUL_ENABLED
+# define BDLDE_CRC64_PCLMUL_TARGET __attribute__((target("pclmul,sse2")))
+#endif
+
 namespace BloombergLP {
 
 // STATIC DATA
@@ -275,57 +312,234 @@ static const bsls::Types::Uint64 CRC_TABLE[256] = {
 };
 
 namespace bdlde {
+namespace {
+
+typedef bsls::Types::Uint64 Uint64;
+
+/// Bit-reflected CRC-64 polynomial (omitting the `x^64` term).
+const Uint64 k_POLYNOMIAL = 0xc96c5795d7870f42ULL;
+
+/// Bit-reflected representation of the polynomial `1`.
+const Uint64 k_X_TO_THE_0 = 0x8000000000000000ULL;
+
+/// Tables for the slice-by-8 algorithm (see the implementation notes),
+/// initialized by `crc64Update`.
+Uint64 s_sliceTables[8][256];
+
+/// Whether the running processor supports the PCLMULQDQ-based
+/// implementation, initialized by `crc64Update`.
+bool s_hasPclmul = false;
+
+/// Return the product, modulo the CRC-64 polynomial, of the specified `a`
+/// and `b`, both in bit-reflected representation.
+Uint64 multiplyModulo(Uint64 a, Uint64 b)
+{
+    Uint64 product = 0;
+
+    for (Uint64 mask = k_X_TO_THE_0; mask; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+        }
+        b = (b & 1) ? (b >> 1) ^ k_POLYNOMIAL : b >> 1;
+    }
+    return product;
+}
+
+/// Return the CRC register resulting from processing the specified `data`
+/// having the specified `length` (in bytes), starting from the specified
+/// `crc` register, using the slice-by-8 algorithm.  The behavior is
+/// undefined unless `s_sliceTables` has been initialized.
+Uint64 updateSliceBy8(Uint64               crc,
+                      const unsigned char *data,
+                      bsl::size_t          length)
+{
+    const Uint64 (&t)[8][256] = s_sliceTables;
+
+    for (; 8 <= length; length -= 8, data += 8) {
+        crc ^=  static_cast<Uint64>(data[0])
+             | (static_cast<Uint64>(data[1]) <<  8)
+             | (static_cast<Uint64>(data[2]) << 16)
+             | (static_cast<Uint64>(data[3]) << 24)
+             | (static_cast<Uint64>(data[4]) << 32)
+             | (static_cast<Uint64>(data[5]) << 40)
+             | (static_cast<Uint64>(data[6]) << 48)
+             | (static_cast<Uint64>(data[7]) << 56);
+
+        crc = t[7][ crc        & 0xff] ^ t[6][(crc >>  8) & 0xff]
+            ^ t[5][(crc >> 16) & 0xff] ^ t[4][(crc >> 24) & 0xff]
+            ^ t[3][(crc >> 32) & 0xff] ^ t[2][(crc >> 40) & 0xff]
+            ^ t[1][(crc >> 48) & 0xff] ^ t[0][ crc >> 56        ];
+    }
+
+    for (; length; --length, ++data) {
+        crc = t[0][(crc ^ *data) & 0xff] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+#if defined(BDLDE_CRC64_PCLMUL_ENABLED)
+
+/// Return `true` if the running processor supports the PCLMULQDQ and SSE2
+/// instructions, and `false` otherwise.
+bool detectPclmul()
+{
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid(1, eax, ebx, ecx, edx);
+
+    return (ecx & (1u << 1)) && (edx & (1u << 26));
+}
+
+/// Return the specified 128-bit `value` multiplied by the power of `x`
+/// specified by `constants`, which holds the multipliers for the upper
+/// (low 64 bits) and lower (high 64 bits) degree halves of `value`.
+inline BDLDE_CRC64_PCLMUL_TARGET
+__m128i foldPclmul(__m128i value, __m128i constants)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00),
+                         _mm_clmulepi64_si128(value, constants, 0x11));
+}
+
+/// Return the 16 bytes at the specified `data`.
+inline BDLDE_CRC64_PCLMUL_TARGET
+__m128i loadPclmul(const unsigned char *data)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+}
+
+/// Return the CRC register resulting from processing the specified `data`
+/// having the specified `length` (in bytes), starting from the specified
+/// `crc` register, by folding with the PCLMULQDQ instruction.  The
+/// behavior is undefined unless `s_sliceTables` has been initialized and
+/// the running processor supports PCLMULQDQ.
+BDLDE_CRC64_PCLMUL_TARGET
+Uint64 updatePclmul(Uint64               crc,
+                    const unsigned char *data,
+                    bsl::size_t          length)
+{
+    if (length < 64) {
+        return updateSliceBy8(crc, data, length);                     // RETURN
+    }
+
+    typedef bsls::Types::Int64 Int64;
+
+    const __m128i fold512 = _mm_set_epi64x(
+                                  static_cast<Int64>(0x081f6054a7842df4ULL),
+                                  static_cast<Int64>(0x6ae3efbb9dd441f3ULL));
+    const __m128i fold128 = _mm_set_epi64x(
+                                  static_cast<Int64>(0xdabe95afc7875f40ULL),
+                                  static_cast<Int64>(0xe05dd497ca393ae4ULL));
+
+    __m128i x0 = _mm_xor_si128(loadPclmul(data),
+                               _mm_set_epi64x(0, static_cast<Int64>(crc)));
+    __m128i x1 = loadPclmul(data + 16);
+    __m128i x2 = loadPclmul(data + 32);
+    __m128i x3 = loadPclmul(data + 48);
+
+    for (data += 64, length -= 64; 64 <= length; data += 64, length -= 64) {
+        x0 = _mm_xor_si128(foldPclmul(x0, fold512), loadPclmul(data));
+        x1 = _mm_xor_si128(foldPclmul(x1, fold512), loadPclmul(data + 16));
+        x2 = _mm_xor_si128(foldPclmul(x2, fold512), loadPclmul(data + 32));
+        x3 = _mm_xor_si128(foldPclmul(x3, fold512), loadPclmul(data + 48));
+    }
+
+    x1 = _mm_xor_si128(foldPclmul(x0, fold128), x1);
+    x2 = _mm_xor_si128(foldPclmul(x1, fold128), x2);
+    x3 = _mm_xor_si128(foldPclmul(x2, fold128), x3);
+
+    for (; 16 <= length; data += 16, length -= 16) {
+        x3 = _mm_xor_si128(foldPclmul(x3, fold128), loadPclmul(data));
+    }
+
+    unsigned char folded[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(folded), x3);
+
+    return updateSliceBy8(updateSliceBy8(0, folded, 16), data, length);
+}
+
+#else
+
+/// Return `false`.  There is no PCLMULQDQ-based implementation for the
+/// current platform.
+bool detectPclmul()
+{
+    return false;
+}
+
+/// Invoke `updateSliceBy8` with the specified `crc`, `data`, and `length`.
+Uint64 updatePclmul(Uint64               crc,
+                    const unsigned char *data,
+                    bsl::size_t          length)
+{
+    return updateSliceBy8(crc, data, length);
+}
+
+#endif
+
+/// Alias for a function that returns the CRC register resulting from
+/// processing a buffer, starting from a given register.
+typedef Uint64 (*Crc64UpdateFn)(Uint64               crc,
+                                const unsigned char *data,
+                                bsl::size_t          length);
+
+/// Return the fastest implementation of the CRC-64 register update
+/// available on the running platform, initializing `s_sliceTables` and
+/// `s_hasPclmul` on the first call.
+Crc64UpdateFn crc64Update()
+{
+    static Crc64UpdateFn updateFn = 0;
+
+    BSLMT_ONCE_DO {
+        for (int byte = 0; byte < 256; ++byte) {
+            Uint64 crc = CRC_TABLE[byte];
+            s_sliceTables[0][byte] = crc;
+            for (int k = 1; k < 8; ++k) {
+                crc = CRC_TABLE[crc & 0xff] ^ (crc >> 8);
+                s_sliceTables[k][byte] = crc;
+            }
+        }
+        s_hasPclmul = detectPclmul();
+        updateFn    = s_hasPclmul ? &updatePclmul : &updateSliceBy8;
+    }
+
+    return updateFn;
+}
+
+}  // close unnamed namespace
+
                                 // -----------
                                 // class Crc64
                                 // -----------
 
-// MANIPULATORS
-void Crc64::update(const void *data, bsl::size_t length)
+// CLASS METHODS
+bsls::Types::Uint64 Crc64::combine(bsls::Types::Uint64 crcA,
+                                   bsls::Types::Uint64 crcB,
+                                   bsls::Types::Uint64 lengthB)
 {
-    BSLS_ASSERT(data || !length);
+    // `power` is `x^(8 * 2^i)` on the `i`th iteration, and `factor`
+    // accumulates `x^(8 * lengthB)`.
 
-    const unsigned char *d = (const unsigned char *)data;
-    bsls::Types::Uint64 tmp = d_crc;
-
-    switch (length % 8) {
-      case 7:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 6:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 5:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 4:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 3:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 2:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 1:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 0: ;
-    }
+    Uint64 power  = k_X_TO_THE_0 >> 8;
+    Uint64 factor = k_X_TO_THE_0;
 
-    bsl::size_t n = length / 8;
-    while (n) {
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        --n;
+    for (; lengthB; lengthB >>= 1) {
+        if (lengthB & 1) {
+            factor = multiplyModulo(factor, power);
+        }
+        power = multiplyModulo(power, power);
     }
 
-    d_crc = tmp;
+    return multiplyModulo(crcA, factor) ^ crcB;
+}
+
+// MANIPULATORS
+void Crc64::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    d_crc = crc64Update()(d_crc,
+                          static_cast<const unsigned char *>(data),
+                          length);
 }
 
 // ACCESSORS
@@ -343,9 +557,54 @@ bsl::ostream& Crc64::print(bsl::ostream& stream) const
     return stream << out;
 }
 
+                              // -----------------
+                              // struct Crc64_Impl
+                              // -----------------
+
+// CLASS METHODS
+bool Crc64_Impl::hasHardwareCrc64()
+{
+    crc64Update();  // initialize `s_hasPclmul`
+
+    return s_hasPclmul;
+}
+
+bsls::Types::Uint64 Crc64_Impl::calculateHardware(
+                                              const void          *data,
+                                              bsl::size_t          length,
+                                              bsls::Types::Uint64  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    crc64Update();  // initialize the tables
+
+    BSLS_ASSERT(s_hasPclmul);
+
+    return ~updatePclmul(~crc,
+                         static_cast<const unsigned char *>(data),
+                         length);
+}
+
+bsls::Types::Uint64 Crc64_Impl::calculateSoftware(
+                                              const void          *data,
+                                              bsl::size_t          length,
+                                              bsls::Types::Uint64  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    crc64Update();  // initialize the tables
+
+    return ~updateSliceBy8(~crc,
+                           static_cast<const unsigned char *>(data),
+                           length);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BDLDE_CRC64_PCLMUL_TARGET
+#undef BDLDE_CRC64_PCLMUL_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2017 Bloomberg Finance L.P.
 //
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Crc64: stores and updates a CRC-64 checksum
+//  bdlde::Crc64_Impl: calculates CRC-64 checksum with alternative impl.
 //
 //@SEE_ALSO:
 //
@@ -21,6 +22,23 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+// The class method `Crc64::combine` computes the checksum of the
+// concatenation of two messages from the checksums of each message and the
+// length of the second one, so that the checksum of a large dataset can be
+// computed in independent chunks (e.g., by several threads) and then merged.
+// This component additionally defines the struct `bdlde::Crc64_Impl` to
+// expose alternative implementations that should not be used other than to
+// test and benchmark.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// The checksum is calculated using the "slice-by-8" table-based algorithm,
+// which processes 8 bytes per step.  On x86 platforms, when compiling with
+// GCC or Clang, a runtime check additionally detects whether the running
+// processor supports the PCLMULQDQ (carry-less multiplication) instruction,
+// in which case buffers of at least 64 bytes are processed by folding with
+// that instruction.  The checksums produced are identical in all cases.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -128,6 +146,14 @@ class Crc64 {
     /// value-semantic types and containers.
     static int maxSupportedBdexVersion(int versionSelector);
 
+    /// Return the CRC-64 checksum of the concatenation of a message having
+    /// the specified checksum `crcA` and a message having the specified
+    /// checksum `crcB` and the specified `lengthB` (in bytes).  Note that
+    /// this operation takes time logarithmic in `lengthB`.
+    static bsls::Types::Uint64 combine(bsls::Types::Uint64 crcA,
+                                       bsls::Types::Uint64 crcB,
+                                       bsls::Types::Uint64 lengthB);
+
     // CREATORS
 
     /// Construct a checksum having the value corresponding to no data
@@ -213,6 +239,44 @@ class Crc64 {
     bsl::ostream& print(bsl::ostream& stream) const;
 };
 
+                             // =================
+                             // struct Crc64_Impl
+                             // =================
+
+/// This class provides alternative implementations of the CRC-64
+/// calculation used by `Crc64`.  It should not be used other than to test
+/// and benchmark.
+struct Crc64_Impl {
+
+    // CLASS METHODS
+
+    /// Return `true` if the running platform supports the
+    /// hardware-accelerated implementation, and `false` otherwise.
+    static bool hasHardwareCrc64();
+
+    /// Return the CRC-64 checksum of the concatenation of a message having
+    /// the optionally specified checksum `crc` and the specified `data`
+    /// having the specified `length` (in bytes), using the PCLMULQDQ-based
+    /// implementation.  If `crc` is not specified, return the checksum of
+    /// `data`.  The behavior is undefined unless `hasHardwareCrc64()`
+    /// returns `true`.  Note that if `data` is 0, then `length` also must
+    /// be 0.
+    static bsls::Types::Uint64 calculateHardware(
+                                           const void          *data,
+                                           bsl::size_t          length,
+                                           bsls::Types::Uint64  crc = 0);
+
+    /// Return the CRC-64 checksum of the concatenation of a message having
+    /// the optionally specified checksum `crc` and the specified `data`
+    /// having the specified `length` (in bytes), using the slice-by-8
+    /// implementation.  If `crc` is not specified, return the checksum of
+    /// `data`.  Note that if `data` is 0, then `length` also must be 0.
+    static bsls::Types::Uint64 calculateSoftware(
+                                           const void          *data,
+                                           bsl::size_t          length,
+                                           bsls::Types::Uint64  crc = 0);
+};
+
 // FREE OPERATORS
 
 /// Return `true` if the specified `lhs` and `rhs` checksums have the same
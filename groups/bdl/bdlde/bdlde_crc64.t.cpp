@@ -64,6 +64,10 @@ using namespace bsl;  // automatically added by script
 // ----------------------------------------------------------------------------
 // CLASS METHODS
 // [10] static int maxSupportedBdexVersion(int);
+// [16] static Uint64 combine(Uint64 crcA, Uint64 crcB, Uint64 lengthB);
+// [15] static bool Crc64_Impl::hasHardwareCrc64();
+// [15] static Uint64 Crc64_Impl::calculateHardware(data, length, crc);
+// [15] static Uint64 Crc64_Impl::calculateSoftware(data, length, crc);
 //
 // CREATORS
 // [ 2] bdlde::Crc64();
@@ -89,10 +93,11 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc64&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: THROUGHPUT OF THE IMPLEMENTATIONS
 //
 // [ 3] int ggg(bdlde::Crc64 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc64& gg(bdlde::Crc64 *object, const char *spec);
@@ -307,6 +312,17 @@ bsls::Types::Uint64 crc(const char *buffer, int length)
 {
     return update_crc(0, buffer, length);
 }
+
+/// Fill the specified `data` with pseudo-random bytes derived from the
+/// specified `seed`.
+void fillPseudoRandom(bsl::vector<char> *data, unsigned int seed)
+{
+    for (bsl::size_t i = 0; i < data->size(); ++i) {
+        seed = seed * 1103515245 + 12345;
+        (*data)[i] = static_cast<char>(seed >> 16);
+    }
+}
+
                      // -----------------------------------
                      // crc64 minimal implementation oracle
                      // -----------------------------------
@@ -486,7 +502,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -517,6 +533,171 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING `combine`
+        //
+        // Concerns:
+        // 1. `combine(crcA, crcB, lengthB)` is the checksum of the
+        //    concatenation of two messages having the checksums `crcA` and
+        //    `crcB`, the second of which has length `lengthB`, for every
+        //    split point of a message.
+        //
+        // 2. Combining with an empty message has no effect.
+        //
+        // 3. `combine` is correct for long second messages, and is
+        //    associative.
+        //
+        // Plan:
+        // 1. For messages of various lengths, compare the checksum of the
+        //    message with the result of combining the checksums of its two
+        //    parts, for every split point.  (C-1..2)
+        //
+        // 2. Compare the checksum of a long message with the result of
+        //    combining the checksums of a short prefix and of the rest, and
+        //    verify that combining three parts in either order gives the
+        //    same result.  (C-3)
+        //
+        // Testing:
+        //   static Uint64 combine(Uint64 crcA, Uint64 crcB, Uint64 lengthB);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "TESTING `combine`"
+                             "\n" "=================" "\n";
+
+        typedef bsls::Types::Uint64 Uint64;
+
+        bsl::vector<char> data(300);
+        fillPseudoRandom(&data, 1);
+
+        const int LENGTHS[] = { 0, 1, 7, 16, 64, 65, 200, 300 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int i = 0; i < NUM_LENGTHS; ++i) {
+            const int    LENGTH = LENGTHS[i];
+            const Uint64 EXP    = crc(data.data(), LENGTH);
+
+            for (int split = 0; split <= LENGTH; ++split) {
+                const Uint64 CRC_A = crc(data.data(), split);
+                const Uint64 CRC_B = crc(data.data() + split, LENGTH - split);
+
+                ASSERTV(LENGTH, split,
+                        EXP == Obj::combine(CRC_A, CRC_B, LENGTH - split));
+            }
+
+            ASSERTV(LENGTH, EXP == Obj::combine(EXP, 0, 0));
+        }
+
+        bsl::vector<char> longData(1 << 20);
+        fillPseudoRandom(&longData, 2);
+
+        const int    LONG_LENGTH = static_cast<int>(longData.size());
+        const Uint64 LONG_EXP    = crc(longData.data(), LONG_LENGTH);
+        const Uint64 CRC_A       = crc(longData.data(), 3);
+        const Uint64 CRC_B       = crc(longData.data() + 3, 1000);
+        const Uint64 CRC_C       = crc(longData.data() + 1003,
+                                       LONG_LENGTH - 1003);
+
+        ASSERT(LONG_EXP == Obj::combine(CRC_A,
+                                        crc(longData.data() + 3,
+                                            LONG_LENGTH - 3),
+                                        LONG_LENGTH - 3));
+        ASSERT(LONG_EXP == Obj::combine(Obj::combine(CRC_A, CRC_B, 1000),
+                                        CRC_C,
+                                        LONG_LENGTH - 1003));
+        ASSERT(LONG_EXP == Obj::combine(CRC_A,
+                                        Obj::combine(CRC_B,
+                                                     CRC_C,
+                                                     LONG_LENGTH - 1003),
+                                        LONG_LENGTH - 3));
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ALTERNATIVE IMPLEMENTATIONS
+        //
+        // Concerns:
+        // 1. The slice-by-8 and hardware-accelerated implementations, as well
+        //    as `update`, compute the same checksum as the byte-at-a-time
+        //    oracle, for lengths around the block sizes of each
+        //    implementation and for any alignment of the data.
+        //
+        // 2. The optional `crc` argument continues the checksum of a
+        //    preceding message.
+        //
+        // Plan:
+        // 1. For every length up to 300 bytes and several longer ones, and
+        //    for every alignment within 16 bytes, compare the checksums
+        //    computed by each implementation with the oracle.  (C-1)
+        //
+        // 2. Compare the checksum of a message computed in two parts,
+        //    passing the checksum of the first part to the calculation of
+        //    the second, with the oracle.  (C-2)
+        //
+        // Testing:
+        //   static bool Crc64_Impl::hasHardwareCrc64();
+        //   static Uint64 Crc64_Impl::calculateHardware(data, length, crc);
+        //   static Uint64 Crc64_Impl::calculateSoftware(data, length, crc);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "TESTING ALTERNATIVE IMPLEMENTATIONS"
+                             "\n" "===================================" "\n";
+
+        typedef bsls::Types::Uint64 Uint64;
+        typedef bdlde::Crc64_Impl   Impl;
+
+        const bool HARDWARE = Impl::hasHardwareCrc64();
+        if (verbose) { P(HARDWARE); }
+
+        bsl::vector<char> data(5000 + 16);
+        fillPseudoRandom(&data, 0);
+
+        bsl::vector<int> lengths;
+        for (int length = 0; length <= 300; ++length) {
+            lengths.push_back(length);
+        }
+        lengths.push_back(1023);
+        lengths.push_back(1024);
+        lengths.push_back(4099);
+        lengths.push_back(5000);
+
+        for (bsl::size_t i = 0; i < lengths.size(); ++i) {
+            const int LENGTH = lengths[i];
+
+            for (int offset = 0; offset < 16; ++offset) {
+                const char   *DATA = data.data() + offset;
+                const Uint64  EXP  = crc(DATA, LENGTH);
+
+                ASSERTV(LENGTH, offset, EXP == Obj(DATA, LENGTH).checksum());
+                ASSERTV(LENGTH, offset,
+                        EXP == Impl::calculateSoftware(DATA, LENGTH));
+                if (HARDWARE) {
+                    ASSERTV(LENGTH, offset,
+                            EXP == Impl::calculateHardware(DATA, LENGTH));
+                }
+            }
+
+            const int    SPLIT = LENGTH / 3;
+            const Uint64 EXP   = crc(data.data(), LENGTH);
+            const Uint64 SW    = Impl::calculateSoftware(data.data(), SPLIT);
+
+            ASSERTV(LENGTH, EXP == Impl::calculateSoftware(data.data() + SPLIT,
+                                                           LENGTH - SPLIT,
+                                                           SW));
+            if (HARDWARE) {
+                const Uint64 HW = Impl::calculateHardware(data.data(), SPLIT);
+
+                ASSERTV(LENGTH,
+                        EXP == Impl::calculateHardware(data.data() + SPLIT,
+                                                       LENGTH - SPLIT,
+                                                       HW));
+            }
+        }
+
+        ASSERT(0 == Impl::calculateSoftware(0, 0));
+        if (HARDWARE) {
+            ASSERT(0 == Impl::calculateHardware(0, 0));
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -2661,6 +2842,77 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT OF THE IMPLEMENTATIONS
+        //
+        // Concerns:
+        // 1. Report the throughput of the byte-at-a-time oracle, the
+        //    slice-by-8 implementation, and the hardware-accelerated
+        //    implementation.
+        //
+        // Plan:
+        // 1. Time each implementation over the same buffer, whose size may be
+        //    specified as the second argument (4 MB by default), repeated to
+        //    process 256 MB in total.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT OF THE IMPLEMENTATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n" "PERFORMANCE TEST: THROUGHPUT"
+                             "\n" "============================" "\n";
+
+        typedef bsls::Types::Uint64 Uint64;
+        typedef bdlde::Crc64_Impl   Impl;
+
+        const int SIZE       = argc > 2 && 0 < atoi(argv[2])
+                             ? atoi(argv[2])
+                             : 4 * 1024 * 1024;
+        const int TOTAL_SIZE = 256 * 1024 * 1024;
+        const int ITERATIONS = TOTAL_SIZE / SIZE;
+
+        bsl::vector<char> data(SIZE);
+        fillPseudoRandom(&data, 0);
+
+        const bool HARDWARE = Impl::hasHardwareCrc64();
+
+        cout << "implementation,buffer_size,seconds,megabytes_per_second\n";
+
+        for (int impl = 0; impl < 3; ++impl) {
+            static const char *const NAMES[] = { "bytewise",
+                                                 "slice-by-8",
+                                                 "hardware" };
+            if (2 == impl && !HARDWARE) {
+                continue;                                           // CONTINUE
+            }
+
+            Uint64          result = 0;
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                switch (impl) {
+                  case 0: {
+                    result ^= crc(data.data(), SIZE);
+                  } break;
+                  case 1: {
+                    result ^= Impl::calculateSoftware(data.data(), SIZE);
+                  } break;
+                  default: {
+                    result ^= Impl::calculateHardware(data.data(), SIZE);
+                  } break;
+                }
+            }
+            timer.stop();
+
+            cout << NAMES[impl] << ',' << SIZE << ','
+                 << timer.elapsedTime() << ','
+                 << ITERATIONS * static_cast<double>(SIZE)
+                                            / timer.elapsedTime() / 1e6
+                 << '\n';
+            if (veryVerbose) { P(result); }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -10,6 +10,23 @@ BSLS_IDENT_RCSID(bdlde_sha1_cpp,"$Id$ $CSID$")
 #include <bsl_ostream.h>
 #include <bsl_type_traits.h>
 #include <bslmf_assert.h>
+#include <bslmt_once.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 50000)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <immintrin.h>
+# define BDLDE_SHA1_X86_SHA_ENABLED
+# define BDLDE_SHA1_X86_SHA_TARGET __attribute__((target("sha,ssse3,sse4.1")))
+#elif defined(BSLS_PLATFORM_CPU_ARM) && defined(BSLS_PLATFORM_CPU_64_BIT)     \
+   && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+# include <arm_neon.h>
+# define BDLDE_SHA1_ARMV8_SHA_ENABLED
+#endif
 
 namespace BloombergLP {
 namespace bdlde {
@@ -148,10 +165,10 @@ void toHex(char *output, const unsigned char (&input)[Sha1::k_DIGEST_SIZE])
 
 /// Update the specified `state` with the hashed contents of the specified
 /// `message` having a length equal to the specified `numMessageBlocks`
-/// times `k_SHA1_BLOCK_SIZE`.
-void transform(Sha1State           *state,
-               const unsigned char *message,
-               bsl::uint64_t        numMessageBlocks)
+/// times `k_SHA1_BLOCK_SIZE`, using the portable implementation.
+void transformPortable(Sha1State           *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numMessageBlocks)
 {
     const unsigned char *messageEnd =
         message + k_SHA1_BLOCK_SIZE * numMessageBlocks;
@@ -191,6 +208,251 @@ void transform(Sha1State           *state,
     }
 }
 
+#if defined(BDLDE_SHA1_X86_SHA_ENABLED)
+
+/// Return `true` if the running processor supports the SHA extensions and
+/// the SSSE3 and SSE4.1 instructions used along with them, and `false`
+/// otherwise.
+bool hasSha1Hardware()
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    const bool hasSse = (ecx & (1u << 9)) && (ecx & (1u << 19));
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return hasSse && (ebx & (1u << 29));
+}
+
+/// Perform the four SHA-1 rounds, using the mixing function having the
+/// specified `FUNCTION` index (0 for rounds 0 to 19, 1 for rounds 20 to 39,
+/// and so on), that consume the specified `msg` words of the message
+/// schedule.  On entry, the specified `abcd` holds the working variables
+/// `a` through `d` and the specified `previous` holds those variables as
+/// they were before the preceding four rounds, from which `e` is derived;
+/// on exit, both are updated for the next four rounds.
+template <int FUNCTION>
+inline BDLDE_SHA1_X86_SHA_TARGET
+void roundsSha1X86(__m128i *abcd, __m128i *previous, __m128i msg)
+{
+    const __m128i e = _mm_sha1nexte_epu32(*previous, msg);
+    *previous = *abcd;
+    *abcd     = _mm_sha1rnds4_epu32(*abcd, e, FUNCTION);
+}
+
+/// Replace the specified `w0`, holding the oldest four words of the last
+/// sixteen words of the SHA-1 message schedule, with the next four words,
+/// given the specified `w1`, `w2`, and `w3` holding the remaining words in
+/// order.
+inline BDLDE_SHA1_X86_SHA_TARGET
+void scheduleSha1X86(__m128i *w0, __m128i w1, __m128i w2, __m128i w3)
+{
+    *w0 = _mm_sha1msg1_epu32(*w0, w1);
+    *w0 = _mm_xor_si128(*w0, w2);
+    *w0 = _mm_sha1msg2_epu32(*w0, w3);
+}
+
+/// Return the 16 bytes at the specified `data` loaded as four big-endian
+/// 32-bit words in the order used by the x86 SHA extensions.
+inline BDLDE_SHA1_X86_SHA_TARGET
+__m128i loadMessageSha1X86(const unsigned char *data)
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL,
+                                            0x08090a0b0c0d0e0fULL);
+
+    return _mm_shuffle_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)),
+                   byteSwap);
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numMessageBlocks`
+/// times `k_SHA1_BLOCK_SIZE`, using the x86 SHA extensions.
+BDLDE_SHA1_X86_SHA_TARGET
+void transformHardware(Sha1State           *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numMessageBlocks)
+{
+    __m128i abcd = _mm_shuffle_epi32(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(*state)),
+                0x1B);
+    __m128i e    = _mm_set_epi32(static_cast<int>((*state)[4]), 0, 0, 0);
+
+    for (; 0 < numMessageBlocks; --numMessageBlocks,
+                                 message += k_SHA1_BLOCK_SIZE) {
+        const __m128i abcdSave = abcd;
+        const __m128i eSave    = e;
+
+        __m128i w0 = loadMessageSha1X86(message);
+        __m128i w1 = loadMessageSha1X86(message + 16);
+        __m128i w2 = loadMessageSha1X86(message + 32);
+        __m128i w3 = loadMessageSha1X86(message + 48);
+
+        // Rounds 0 to 3 take `e` from the state rather than deriving it.
+
+        __m128i previous = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, _mm_add_epi32(e, w0), 0);
+
+        roundsSha1X86<0>(&abcd, &previous, w1);
+        roundsSha1X86<0>(&abcd, &previous, w2);
+        roundsSha1X86<0>(&abcd, &previous, w3);
+
+        scheduleSha1X86(&w0, w1, w2, w3);
+        roundsSha1X86<0>(&abcd, &previous, w0);
+        scheduleSha1X86(&w1, w2, w3, w0);
+        roundsSha1X86<1>(&abcd, &previous, w1);
+        scheduleSha1X86(&w2, w3, w0, w1);
+        roundsSha1X86<1>(&abcd, &previous, w2);
+        scheduleSha1X86(&w3, w0, w1, w2);
+        roundsSha1X86<1>(&abcd, &previous, w3);
+
+        scheduleSha1X86(&w0, w1, w2, w3);
+        roundsSha1X86<1>(&abcd, &previous, w0);
+        scheduleSha1X86(&w1, w2, w3, w0);
+        roundsSha1X86<1>(&abcd, &previous, w1);
+        scheduleSha1X86(&w2, w3, w0, w1);
+        roundsSha1X86<2>(&abcd, &previous, w2);
+        scheduleSha1X86(&w3, w0, w1, w2);
+        roundsSha1X86<2>(&abcd, &previous, w3);
+
+        scheduleSha1X86(&w0, w1, w2, w3);
+        roundsSha1X86<2>(&abcd, &previous, w0);
+        scheduleSha1X86(&w1, w2, w3, w0);
+        roundsSha1X86<2>(&abcd, &previous, w1);
+        scheduleSha1X86(&w2, w3, w0, w1);
+        roundsSha1X86<2>(&abcd, &previous, w2);
+        scheduleSha1X86(&w3, w0, w1, w2);
+        roundsSha1X86<3>(&abcd, &previous, w3);
+
+        scheduleSha1X86(&w0, w1, w2, w3);
+        roundsSha1X86<3>(&abcd, &previous, w0);
+        scheduleSha1X86(&w1, w2, w3, w0);
+        roundsSha1X86<3>(&abcd, &previous, w1);
+        scheduleSha1X86(&w2, w3, w0, w1);
+        roundsSha1X86<3>(&abcd, &previous, w2);
+        scheduleSha1X86(&w3, w0, w1, w2);
+        roundsSha1X86<3>(&abcd, &previous, w3);
+
+        e    = _mm_sha1nexte_epu32(previous, eSave);
+        abcd = _mm_add_epi32(abcd, abcdSave);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(*state),
+                     _mm_shuffle_epi32(abcd, 0x1B));
+    (*state)[4] = static_cast<Sha1Word>(_mm_extract_epi32(e, 3));
+}
+
+#elif defined(BDLDE_SHA1_ARMV8_SHA_ENABLED)
+
+/// Return `true`.  The ARMv8 SHA-1 instructions are used only when the
+/// compiler targets them, in which case every processor running this code
+/// supports them.
+bool hasSha1Hardware()
+{
+    return true;
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numMessageBlocks`
+/// times `k_SHA1_BLOCK_SIZE`, using the ARMv8 SHA-1 instructions.
+void transformHardware(Sha1State           *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numMessageBlocks)
+{
+    uint32x4_t abcd = vld1q_u32(*state);
+    Sha1Word   e    = (*state)[4];
+
+    for (; 0 < numMessageBlocks; --numMessageBlocks,
+                                 message += k_SHA1_BLOCK_SIZE) {
+        const uint32x4_t abcdSave = abcd;
+        const Sha1Word   eSave    = e;
+        uint32x4_t       w[4];  // last 16 words of the message schedule
+
+        for (int group = 0; group < 20; ++group) {
+            uint32x4_t& msg = w[group & 3];
+            if (group < 4) {
+                msg = vreinterpretq_u32_u8(
+                                   vrev32q_u8(vld1q_u8(message + 16 * group)));
+            }
+            else {
+                msg = vsha1su0q_u32(msg,
+                                    w[(group + 1) & 3],
+                                    w[(group + 2) & 3]);
+                msg = vsha1su1q_u32(msg, w[(group + 3) & 3]);
+            }
+
+            const Sha1Word   k    = k_SHA1_CONSTANTS[4 * group];
+            const uint32x4_t wk   = vaddq_u32(msg, vdupq_n_u32(k));
+            const Sha1Word   next = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+
+            if (group < 5) {
+                abcd = vsha1cq_u32(abcd, e, wk);
+            }
+            else if (group < 10 || 15 <= group) {
+                abcd = vsha1pq_u32(abcd, e, wk);
+            }
+            else {
+                abcd = vsha1mq_u32(abcd, e, wk);
+            }
+            e = next;
+        }
+
+        abcd  = vaddq_u32(abcd, abcdSave);
+        e    += eSave;
+    }
+
+    vst1q_u32(*state, abcd);
+    (*state)[4] = e;
+}
+
+#else
+
+/// Return `false`.  There is no hardware-accelerated implementation of the
+/// SHA-1 compression function for the current platform.
+bool hasSha1Hardware()
+{
+    return false;
+}
+
+/// Invoke `transformPortable` with the specified `state`, `message`, and
+/// `numMessageBlocks`.
+void transformHardware(Sha1State           *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numMessageBlocks)
+{
+    transformPortable(state, message, numMessageBlocks);
+}
+
+#endif
+
+/// Alias for a function that updates a SHA-1 state with the hashed contents
+/// of a number of message blocks.
+typedef void (*Sha1TransformFn)(Sha1State           *state,
+                                const unsigned char *message,
+                                bsl::uint64_t        numMessageBlocks);
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numMessageBlocks`
+/// times `k_SHA1_BLOCK_SIZE`, using the fastest implementation available on
+/// the running platform.
+void transform(Sha1State           *state,
+               const unsigned char *message,
+               bsl::uint64_t        numMessageBlocks)
+{
+    static Sha1TransformFn transformFn = 0;
+
+    BSLMT_ONCE_DO {
+        transformFn = hasSha1Hardware() ? &transformHardware
+                                        : &transformPortable;
+    }
+
+    transformFn(state, message, numMessageBlocks);
+}
+
 /// Update the specified `state` with the contents of the specified `buffer`
 /// followed by the contents of the specified `message` having the specified
 /// `messageSize` in bytes.  Update the specified `totalSize` to have the
@@ -279,6 +541,45 @@ Sha1::Sha1(const void *data, bsl::size_t length)
     update(data, length);
 }
 
+// CLASS METHODS
+void Sha1::calculateMany(unsigned char       *results,
+                         const void *const   *messages,
+                         const bsl::size_t   *lengths,
+                         bsl::size_t          numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    const Sha1 initial;
+
+    for (bsl::size_t index = 0; index < numMessages; ++index) {
+        BSLS_ASSERT(messages[index] || 0 == lengths[index]);
+
+        // The whole blocks of the message are compressed directly from the
+        // message, and only its final partial block is copied.
+
+        const unsigned char *message   = static_cast<const unsigned char *>(
+                                                              messages[index]);
+        const bsl::uint64_t  length    = lengths[index];
+        const bsl::uint64_t  numBlocks = length / k_BLOCK_SIZE;
+        const bsl::uint64_t  tailSize  = length % k_BLOCK_SIZE;
+        const unsigned char *tail      = message + numBlocks * k_BLOCK_SIZE;
+
+        State state;
+        bsl::copy(bsl::begin(initial.d_state),
+                  bsl::end(initial.d_state),
+                  bsl::begin(state));
+        transform(&state, message, numBlocks);
+
+        unsigned char buffer[k_BLOCK_SIZE];
+        bsl::copy(tail, tail + tailSize, buffer);
+
+        finalize(&state, length, tailSize, buffer);
+        unpackArray(results + index * k_DIGEST_SIZE, state);
+    }
+}
+
 // MANIPULATORS
 void Sha1::loadDigestAndReset(unsigned char *result)
 {
@@ -357,6 +658,37 @@ bsl::ostream& Sha1::print(bsl::ostream& stream) const
     return stream;
 }
 
+                              // ----------------
+                              // struct Sha1_Impl
+                              // ----------------
+
+// CLASS METHODS
+bool Sha1_Impl::hasHardwareSha1()
+{
+    return hasSha1Hardware();
+}
+
+void Sha1_Impl::transformSha1Hardware(bsl::uint32_t       *state,
+                                      const unsigned char *blocks,
+                                      bsl::size_t          numBlocks)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+    BSLS_ASSERT(hasSha1Hardware());
+
+    transformHardware(reinterpret_cast<Sha1State *>(state), blocks, numBlocks);
+}
+
+void Sha1_Impl::transformSha1Portable(bsl::uint32_t       *state,
+                                      const unsigned char *blocks,
+                                      bsl::size_t          numBlocks)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+
+    transformPortable(reinterpret_cast<Sha1State *>(state), blocks, numBlocks);
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -374,6 +706,10 @@ bool bdlde::operator==(const Sha1& lhs, const Sha1& rhs)
 
 }  // close enterprise namespace
 
+#undef BDLDE_SHA1_X86_SHA_TARGET
+#undef BDLDE_SHA1_X86_SHA_ENABLED
+#undef BDLDE_SHA1_ARMV8_SHA_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2022 Bloomberg Finance L.P.
 //
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -14,6 +15,7 @@
 #include <bsl_iterator.h>
 #include <bsl_string.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -71,6 +73,12 @@ using namespace bsl;
 //    o `void loadDigest(unsigned char *result) const;`
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 7] void Sha1::calculateMany(uchar *, const void *const *, ...);
+// [ 7] bool Sha1_Impl::hasHardwareSha1();
+// [ 7] void Sha1_Impl::transformSha1Hardware(uint32_t *, ...);
+// [ 7] void Sha1_Impl::transformSha1Portable(uint32_t *, ...);
+//
 // CREATORS
 // [ 2] Sha1::Sha1();
 // [ 5] Sha1::Sha1(const void *data, bsl::size_t length);
@@ -90,7 +98,8 @@ using namespace bsl;
 // [ 6] bsl::ostream& operator<<(bsl::ostream&, const Sha1&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: hardware, portable, and multi-buffer SHA-1
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 
@@ -522,6 +531,16 @@ void testTwoArgumentConstructor(const char *message)
     ASSERT(digest1 == digest2);
 }
 
+/// Fill the specified `data` with pseudo-random bytes derived from the
+/// specified `seed`.
+void fillPseudoRandom(bsl::vector<unsigned char> *data, unsigned int seed)
+{
+    for (bsl::size_t index = 0; index != data->size(); ++index) {
+        seed = seed * 1103515245 + 12345;
+        (*data)[index] = static_cast<unsigned char>(seed >> 16);
+    }
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -537,7 +556,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -559,6 +578,124 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING HARDWARE ACCELERATION AND `calculateMany`
+        //
+        // Concerns:
+        // 1. The hardware-accelerated SHA-1 compression function, if
+        //    available, produces the same state as the portable one for any
+        //    initial state and any number of blocks.
+        //
+        // 2. `calculateMany` loads the same digests as hashing each message
+        //    individually, for messages of lengths at and around the block
+        //    boundaries.
+        //
+        // 3. `calculateMany` writes only `numMessages * k_DIGEST_SIZE`
+        //    bytes, and accepts an empty batch.
+        //
+        // Plan:
+        // 1. If `hasHardwareSha1` returns `true`, compress pseudo-random
+        //    blocks from pseudo-random states with both implementations and
+        //    compare the results.  (C-1)
+        //
+        // 2. Compare the results of `calculateMany` for every batch size of
+        //    messages having lengths around the block boundaries with the
+        //    digests of the individual messages, and verify a sentinel byte
+        //    following the results.  (C-2..3)
+        //
+        // Testing:
+        //   void Sha1::calculateMany(uchar *, const void *const *, ...);
+        //   bool Sha1_Impl::hasHardwareSha1();
+        //   void Sha1_Impl::transformSha1Hardware(uint32_t *, ...);
+        //   void Sha1_Impl::transformSha1Portable(uint32_t *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING HARDWARE ACCELERATION AND "
+                             "`calculateMany`\n"
+                             "=================================="
+                             "===============\n";
+
+        if (verbose) {
+            cout << "Hardware SHA-1: "
+                 << bdlde::Sha1_Impl::hasHardwareSha1() << '\n';
+        }
+
+        if (bdlde::Sha1_Impl::hasHardwareSha1()) {
+            bsl::vector<unsigned char> blocks(64 * 9);
+
+            for (unsigned int seed = 0; seed != 100; ++seed) {
+                fillPseudoRandom(&blocks, seed);
+
+                bsl::uint32_t portable[5];
+                bsl::uint32_t hardware[5];
+                for (int index = 0; index != 5; ++index) {
+                    portable[index] = hardware[index] =
+                                         blocks[index] * 0x01010101u + seed;
+                }
+
+                const bsl::size_t NUM_BLOCKS = seed % 10;
+
+                bdlde::Sha1_Impl::transformSha1Portable(portable,
+                                                        blocks.data(),
+                                                        NUM_BLOCKS);
+                bdlde::Sha1_Impl::transformSha1Hardware(hardware,
+                                                        blocks.data(),
+                                                        NUM_BLOCKS);
+
+                ASSERTV(seed, bsl::equal(portable, portable + 5, hardware));
+            }
+        }
+
+        const bsl::size_t LENGTHS[] = {   0,   1,  55,  56,  63,  64,  65, 119,
+                                        120, 128, 129, 200, 1000, 4096, 4099 };
+        const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+        const bsl::size_t DIGEST_SIZE = bdlde::Sha1::k_DIGEST_SIZE;
+
+        bsl::vector<bsl::vector<unsigned char> > data(NUM_LENGTHS);
+        bsl::vector<const void *>                messages(NUM_LENGTHS);
+        bsl::vector<bsl::size_t>                 lengths(NUM_LENGTHS);
+        for (bsl::size_t index = 0; index != NUM_LENGTHS; ++index) {
+            data[index].resize(LENGTHS[index]);
+            fillPseudoRandom(&data[index], static_cast<unsigned int>(index));
+            messages[index] = LENGTHS[index] ? &data[index][0] : 0;
+            lengths[index]  = LENGTHS[index];
+        }
+
+        for (bsl::size_t numMessages = 0;
+             numMessages <= NUM_LENGTHS;
+             ++numMessages) {
+            for (bsl::size_t offset = 0;
+                 offset + numMessages <= NUM_LENGTHS;
+                 offset += 3) {
+                bsl::vector<unsigned char> results(
+                                            (numMessages + 1) * DIGEST_SIZE,
+                                            0xAB);
+
+                bdlde::Sha1::calculateMany(results.data(),
+                                           messages.data() + offset,
+                                           lengths.data() + offset,
+                                           numMessages);
+
+                for (bsl::size_t index = 0; index != numMessages; ++index) {
+                    const bdlde::Sha1 hasher(messages[offset + index],
+                                             lengths[offset + index]);
+                    unsigned char     expected[DIGEST_SIZE];
+                    hasher.loadDigest(expected);
+
+                    ASSERTV(numMessages, offset, index,
+                            bsl::equal(expected,
+                                       expected + DIGEST_SIZE,
+                                       results.begin() + index * DIGEST_SIZE));
+                }
+
+                // The byte after the last digest is not modified.
+
+                ASSERTV(numMessages, offset,
+                        0xAB == results[numMessages * DIGEST_SIZE]);
+            }
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR
@@ -760,6 +897,91 @@ int main(int argc, char *argv[])
         bdlde::Sha1 hasher;
         ASSERT(hasher == hasher);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: HARDWARE, PORTABLE, AND MULTI-BUFFER SHA-1
+        //
+        // Concerns:
+        // 1. Report the throughput of the SHA-1 compression function
+        //    implementations, and of hashing many independent messages
+        //    individually and with `calculateMany`.
+        //
+        // Plan:
+        // 1. Time each implementation over the same data, with an optional
+        //    second argument specifying the message size in bytes.
+        //
+        // Testing:
+        //   PERFORMANCE: hardware, portable, and multi-buffer SHA-1
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: HARDWARE, PORTABLE, AND "
+                             "MULTI-BUFFER SHA-1\n"
+                             "====================================="
+                             "==================\n";
+
+        const bsl::size_t MESSAGE_SIZE = argc > 2 && 0 < atoi(argv[2])
+                                       ? atoi(argv[2])
+                                       : 1024;
+        const bsl::size_t TOTAL_SIZE   = 64 * 1024 * 1024;
+        const bsl::size_t NUM_MESSAGES = TOTAL_SIZE / MESSAGE_SIZE;
+        const bsl::size_t DIGEST_SIZE  = bdlde::Sha1::k_DIGEST_SIZE;
+
+        bsl::vector<unsigned char> data(TOTAL_SIZE);
+        fillPseudoRandom(&data, 0);
+
+        bsls::Stopwatch timer;
+        bsl::uint32_t   state[5] = {};
+
+        cout << "implementation,message_size,seconds,megabytes_per_second\n";
+
+        timer.start();
+        bdlde::Sha1_Impl::transformSha1Portable(state,
+                                                data.data(),
+                                                TOTAL_SIZE / 64);
+        timer.stop();
+        cout << "portable transform,-," << timer.elapsedTime() << ','
+             << TOTAL_SIZE / timer.elapsedTime() / 1e6 << '\n';
+
+        if (bdlde::Sha1_Impl::hasHardwareSha1()) {
+            timer.reset();
+            timer.start();
+            bdlde::Sha1_Impl::transformSha1Hardware(state,
+                                                    data.data(),
+                                                    TOTAL_SIZE / 64);
+            timer.stop();
+            cout << "hardware transform,-," << timer.elapsedTime() << ','
+                 << TOTAL_SIZE / timer.elapsedTime() / 1e6 << '\n';
+        }
+
+        bsl::vector<const void *>  messages(NUM_MESSAGES);
+        bsl::vector<bsl::size_t>   lengths(NUM_MESSAGES, MESSAGE_SIZE);
+        bsl::vector<unsigned char> results(NUM_MESSAGES * DIGEST_SIZE);
+        for (bsl::size_t index = 0; index != NUM_MESSAGES; ++index) {
+            messages[index] = &data[index * MESSAGE_SIZE];
+        }
+
+        timer.reset();
+        timer.start();
+        for (bsl::size_t index = 0; index != NUM_MESSAGES; ++index) {
+            bdlde::Sha1 hasher(messages[index], MESSAGE_SIZE);
+            hasher.loadDigest(&results[index * DIGEST_SIZE]);
+        }
+        timer.stop();
+        cout << "Sha1 per message," << MESSAGE_SIZE << ','
+             << timer.elapsedTime() << ','
+             << TOTAL_SIZE / timer.elapsedTime() / 1e6 << '\n';
+
+        timer.reset();
+        timer.start();
+        bdlde::Sha1::calculateMany(results.data(),
+                                   messages.data(),
+                                   lengths.data(),
+                                   NUM_MESSAGES);
+        timer.stop();
+        cout << "Sha1::calculateMany," << MESSAGE_SIZE << ','
+             << timer.elapsedTime() << ','
+             << TOTAL_SIZE / timer.elapsedTime() / 1e6 << '\n';
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
@@ -1,10 +1,29 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_ostream.h>
 
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 50000)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <immintrin.h>
+# define BDLDE_SHA2_X86_SHA_ENABLED
+# define BDLDE_SHA2_X86_SHA_TARGET __attribute__((target("sha,ssse3,sse4.1")))
+#elif defined(BSLS_PLATFORM_CPU_ARM) && defined(BSLS_PLATFORM_CPU_64_BIT)     \
+   && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+# include <arm_neon.h>
+# define BDLDE_SHA2_ARMV8_SHA_ENABLED
+#endif
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -201,11 +220,11 @@ const bsl::uint64_t sha512Constants[80] =
 /// specified `numberOfBuffers`, mixing it with the values in the specified
 /// `constants`.
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
-void transform(INTEGER             *state,
-               const unsigned char *message,
-               bsl::uint64_t        numberOfBuffers,
-               bsl::uint64_t        bufferSize,
-               const INTEGER      (&constants)[ARRAY_SIZE])
+void transformPortable(INTEGER             *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBuffers,
+                       bsl::uint64_t        bufferSize,
+                       const INTEGER      (&constants)[ARRAY_SIZE])
 {
     const unsigned char *messageEnd = message + bufferSize * numberOfBuffers;
     for (; message != messageEnd; message += bufferSize)
@@ -247,6 +266,290 @@ void transform(INTEGER             *state,
     }
 }
 
+/// Size (in bytes) of the blocks into which messages are divided by SHA-224
+/// and SHA-256.
+const bsl::size_t k_SHA256_BLOCK_SIZE = 512 / 8;
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `numBlocks` blocks of `k_SHA256_BLOCK_SIZE` bytes starting at the
+/// specified `blocks`, using the portable implementation.
+void transformSha256Portable(bsl::uint32_t       *state,
+                             const unsigned char *blocks,
+                             bsl::uint64_t        numBlocks)
+{
+    transformPortable(state,
+                      blocks,
+                      numBlocks,
+                      k_SHA256_BLOCK_SIZE,
+                      sha256Constants);
+}
+
+#if defined(BDLDE_SHA2_X86_SHA_ENABLED)
+
+/// Return `true` if the running processor supports the SHA extensions and
+/// the SSSE3 and SSE4.1 instructions used along with them, and `false`
+/// otherwise.
+bool hasSha256Hardware()
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    const bool hasSse = (ecx & (1u << 9)) && (ecx & (1u << 19));
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return hasSse && (ebx & (1u << 29));
+}
+
+/// Update the specified `abef` and `cdgh` halves of a SHA-256 state by
+/// performing the four rounds that consume the specified `msg` words of
+/// the message schedule, mixed with the four constants starting at the
+/// specified `constants`.
+inline BDLDE_SHA2_X86_SHA_TARGET
+void roundsSha256X86(__m128i             *abef,
+                     __m128i             *cdgh,
+                     __m128i              msg,
+                     const bsl::uint32_t *constants)
+{
+    __m128i wk = _mm_add_epi32(msg,
+                               _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(
+                                                                constants)));
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, wk);
+    wk    = _mm_shuffle_epi32(wk, 0x0E);
+    *abef = _mm_sha256rnds2_epu32(*abef, *cdgh, wk);
+}
+
+/// Replace the specified `w0`, holding the oldest four words of the last
+/// sixteen words of the SHA-256 message schedule, with the next four words,
+/// given the specified `w1`, `w2`, and `w3` holding the remaining words in
+/// order.
+inline BDLDE_SHA2_X86_SHA_TARGET
+void scheduleSha256X86(__m128i *w0, __m128i w1, __m128i w2, __m128i w3)
+{
+    *w0 = _mm_sha256msg1_epu32(*w0, w1);
+    *w0 = _mm_add_epi32(*w0, _mm_alignr_epi8(w3, w2, 4));
+    *w0 = _mm_sha256msg2_epu32(*w0, w3);
+}
+
+/// Load the specified `abef` and `cdgh` with the halves of the specified
+/// SHA-256 `state` in the order used by the x86 SHA extensions.
+inline BDLDE_SHA2_X86_SHA_TARGET
+void loadSha256X86(__m128i *abef, __m128i *cdgh, const bsl::uint32_t *state)
+{
+    const __m128i dcba = _mm_shuffle_epi32(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(state)),
+                   0xB1);
+    const __m128i efgh = _mm_shuffle_epi32(
+               _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4)),
+               0x1B);
+
+    *abef = _mm_alignr_epi8(dcba, efgh, 8);
+    *cdgh = _mm_blend_epi16(efgh, dcba, 0xF0);
+}
+
+/// Store into the specified `state` the SHA-256 state held by the specified
+/// `abef` and `cdgh` in the order used by the x86 SHA extensions.
+inline BDLDE_SHA2_X86_SHA_TARGET
+void storeSha256X86(bsl::uint32_t *state, __m128i abef, __m128i cdgh)
+{
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+                     _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+                     _mm_alignr_epi8(dchg, feba, 8));
+}
+
+/// Return the 16 bytes at the specified `data` loaded as four big-endian
+/// 32-bit words.
+inline BDLDE_SHA2_X86_SHA_TARGET
+__m128i loadMessageSha256X86(const unsigned char *data)
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                            0x0405060700010203ULL);
+
+    return _mm_shuffle_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)),
+                   byteSwap);
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `numBlocks` blocks of `k_SHA256_BLOCK_SIZE` bytes starting at the
+/// specified `blocks`, using the x86 SHA extensions.
+BDLDE_SHA2_X86_SHA_TARGET
+void transformSha256Hardware(bsl::uint32_t       *state,
+                             const unsigned char *blocks,
+                             bsl::uint64_t        numBlocks)
+{
+    __m128i abef, cdgh;
+    loadSha256X86(&abef, &cdgh, state);
+
+    for (; 0 < numBlocks; --numBlocks, blocks += k_SHA256_BLOCK_SIZE) {
+        const __m128i abefSave = abef;
+        const __m128i cdghSave = cdgh;
+
+        __m128i w0 = loadMessageSha256X86(blocks);
+        __m128i w1 = loadMessageSha256X86(blocks + 16);
+        __m128i w2 = loadMessageSha256X86(blocks + 32);
+        __m128i w3 = loadMessageSha256X86(blocks + 48);
+
+        roundsSha256X86(&abef, &cdgh, w0, sha256Constants);
+        roundsSha256X86(&abef, &cdgh, w1, sha256Constants + 4);
+        roundsSha256X86(&abef, &cdgh, w2, sha256Constants + 8);
+        roundsSha256X86(&abef, &cdgh, w3, sha256Constants + 12);
+
+        for (int group = 4; group < 16; group += 4) {
+            const bsl::uint32_t *k = sha256Constants + 4 * group;
+
+            scheduleSha256X86(&w0, w1, w2, w3);
+            roundsSha256X86(&abef, &cdgh, w0, k);
+            scheduleSha256X86(&w1, w2, w3, w0);
+            roundsSha256X86(&abef, &cdgh, w1, k + 4);
+            scheduleSha256X86(&w2, w3, w0, w1);
+            roundsSha256X86(&abef, &cdgh, w2, k + 8);
+            scheduleSha256X86(&w3, w0, w1, w2);
+            roundsSha256X86(&abef, &cdgh, w3, k + 12);
+        }
+
+        abef = _mm_add_epi32(abef, abefSave);
+        cdgh = _mm_add_epi32(cdgh, cdghSave);
+    }
+
+    storeSha256X86(state, abef, cdgh);
+}
+
+#elif defined(BDLDE_SHA2_ARMV8_SHA_ENABLED)
+
+/// Return `true`.  The ARMv8 SHA-2 instructions are used only when the
+/// compiler targets them, in which case every processor running this code
+/// supports them.
+bool hasSha256Hardware()
+{
+    return true;
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `numBlocks` blocks of `k_SHA256_BLOCK_SIZE` bytes starting at the
+/// specified `blocks`, using the ARMv8 SHA-2 instructions.
+void transformSha256Hardware(bsl::uint32_t       *state,
+                             const unsigned char *blocks,
+                             bsl::uint64_t        numBlocks)
+{
+    uint32x4_t abcd = vld1q_u32(state);
+    uint32x4_t efgh = vld1q_u32(state + 4);
+
+    for (bsl::uint64_t block = 0; block < numBlocks; ++block) {
+        const uint32x4_t abcdSave = abcd;
+        const uint32x4_t efghSave = efgh;
+        uint32x4_t       w[4];  // last 16 words of the message schedule
+
+        for (int group = 0; group < 16; ++group) {
+            uint32x4_t& msg = w[group & 3];
+            if (group < 4) {
+                msg = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(
+                                               blocks
+                                             + block * k_SHA256_BLOCK_SIZE
+                                             + group * 16)));
+            }
+            else {
+                msg = vsha256su0q_u32(msg, w[(group - 3) & 3]);
+                msg = vsha256su1q_u32(msg,
+                                      w[(group - 2) & 3],
+                                      w[(group - 1) & 3]);
+            }
+
+            const uint32x4_t k    = vld1q_u32(sha256Constants + 4 * group);
+            const uint32x4_t wk   = vaddq_u32(msg, k);
+            const uint32x4_t prev = abcd;
+            abcd = vsha256hq_u32(abcd, efgh, wk);
+            efgh = vsha256h2q_u32(efgh, prev, wk);
+        }
+
+        abcd = vaddq_u32(abcd, abcdSave);
+        efgh = vaddq_u32(efgh, efghSave);
+    }
+
+    vst1q_u32(state,     abcd);
+    vst1q_u32(state + 4, efgh);
+}
+
+#else
+
+/// Return `false`.  There is no hardware-accelerated implementation of the
+/// SHA-256 compression function for the current platform.
+bool hasSha256Hardware()
+{
+    return false;
+}
+
+/// Invoke `transformSha256Portable` with the specified `state`, `blocks`,
+/// and `numBlocks`.
+void transformSha256Hardware(bsl::uint32_t       *state,
+                             const unsigned char *blocks,
+                             bsl::uint64_t        numBlocks)
+{
+    transformSha256Portable(state, blocks, numBlocks);
+}
+
+#endif
+
+/// Alias for a function that updates a SHA-256 state with the hashed
+/// contents of a number of message blocks.
+typedef void (*Sha256TransformFn)(bsl::uint32_t       *state,
+                                  const unsigned char *blocks,
+                                  bsl::uint64_t        numBlocks);
+
+/// Return the implementation of the SHA-256 compression function to be used
+/// on the running platform.
+Sha256TransformFn sha256Transform()
+{
+    static Sha256TransformFn transformFn = 0;
+
+    BSLMT_ONCE_DO {
+        transformFn = hasSha256Hardware() ? &transformSha256Hardware
+                                          : &transformSha256Portable;
+    }
+
+    return transformFn;
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `bufferSize` times the
+/// specified `numberOfBuffers`, mixing it with the values in the specified
+/// `constants`.
+template<class INTEGER, bsl::size_t ARRAY_SIZE>
+void transform(INTEGER             *state,
+               const unsigned char *message,
+               bsl::uint64_t        numberOfBuffers,
+               bsl::uint64_t        bufferSize,
+               const INTEGER      (&constants)[ARRAY_SIZE])
+{
+    transformPortable(state, message, numberOfBuffers, bufferSize, constants);
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `bufferSize` times the
+/// specified `numberOfBuffers`, using the fastest implementation of the
+/// SHA-256 compression function available on the running platform.  Note
+/// that this overload is selected for SHA-224 and SHA-256, whose constants
+/// are always `sha256Constants`.
+void transform(bsl::uint32_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint32_t (&)[64])
+{
+    BSLS_ASSERT(k_SHA256_BLOCK_SIZE == bufferSize);
+    (void)bufferSize;
+
+    sha256Transform()(state, message, numberOfBuffers);
+}
+
 /// Update the specified `state` with the contents of the specified `buffer`
 /// followed by the contents of the specified `message` having the specified
 /// `messageSize`, mixed with the data in the specified `constants`.  Update
@@ -331,6 +634,53 @@ void finalize(unsigned char        *result,
     }
 }
 
+/// Load into the specified `results` the digests, each having the specified
+/// `digestSize`, of the specified `numMessages` messages described by the
+/// specified `messages` and `lengths`, computed with SHA-256 starting from
+/// the specified `initialState`.  The whole blocks of each message are
+/// compressed directly from the message, and only its final partial block
+/// is copied.
+void calculateManySha256(unsigned char       *results,
+                         bsl::size_t          digestSize,
+                         const bsl::uint32_t (&initialState)[8],
+                         const void *const   *messages,
+                         const bsl::size_t   *lengths,
+                         bsl::size_t          numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    const Sha256TransformFn transformFn = sha256Transform();
+
+    for (bsl::size_t index = 0; index < numMessages; ++index) {
+        BSLS_ASSERT(messages[index] || 0 == lengths[index]);
+
+        const unsigned char *message   = static_cast<const unsigned char *>(
+                                                              messages[index]);
+        const bsl::uint64_t  length    = lengths[index];
+        const bsl::uint64_t  numBlocks = length / k_SHA256_BLOCK_SIZE;
+        const bsl::uint64_t  tailSize  = length % k_SHA256_BLOCK_SIZE;
+        const unsigned char *tail      = message
+                                       + numBlocks * k_SHA256_BLOCK_SIZE;
+
+        bsl::uint32_t state[8];
+        bsl::copy(initialState, initialState + 8, state);
+        transformFn(state, message, numBlocks);
+
+        unsigned char buffer[k_SHA256_BLOCK_SIZE];
+        bsl::copy(tail, tail + tailSize, buffer);
+
+        finalize(results + index * digestSize,
+                 digestSize,
+                 state,
+                 length,
+                 tailSize,
+                 buffer,
+                 sha256Constants);
+    }
+}
+
 /// Store into the specified `output` the hex representation of the bytes in
 /// the specified `input`.
 template<bsl::size_t SIZE>
@@ -346,6 +696,34 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+void Sha224::calculateMany(unsigned char       *results,
+                           const void *const   *messages,
+                           const bsl::size_t   *lengths,
+                           bsl::size_t          numMessages)
+{
+    const Sha224 initial;
+    calculateManySha256(results,
+                        k_DIGEST_SIZE,
+                        initial.d_state,
+                        messages,
+                        lengths,
+                        numMessages);
+}
+
+void Sha256::calculateMany(unsigned char       *results,
+                           const void *const   *messages,
+                           const bsl::size_t   *lengths,
+                           bsl::size_t          numMessages)
+{
+    const Sha256 initial;
+    calculateManySha256(results,
+                        k_DIGEST_SIZE,
+                        initial.d_state,
+                        messages,
+                        lengths,
+                        numMessages);
+}
+
 Sha224::Sha224()
 {
     reset();
@@ -650,6 +1028,36 @@ bsl::ostream& Sha512::print(bsl::ostream& stream) const
     return stream;
 }
 
+                              // ----------------
+                              // struct Sha2_Impl
+                              // ----------------
+
+bool Sha2_Impl::hasHardwareSha256()
+{
+    return hasSha256Hardware();
+}
+
+void Sha2_Impl::transformSha256Hardware(bsl::uint32_t       *state,
+                                        const unsigned char *blocks,
+                                        bsl::size_t          numBlocks)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+    BSLS_ASSERT(hasSha256Hardware());
+
+    bdlde::transformSha256Hardware(state, blocks, numBlocks);
+}
+
+void Sha2_Impl::transformSha256Portable(bsl::uint32_t       *state,
+                                        const unsigned char *blocks,
+                                        bsl::size_t          numBlocks)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+
+    bdlde::transformSha256Portable(state, blocks, numBlocks);
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -695,6 +1103,10 @@ bool bdlde::operator==(const Sha512& lhs, const Sha512& rhs)
 
 }  // close enterprise namespace
 
+#undef BDLDE_SHA2_X86_SHA_TARGET
+#undef BDLDE_SHA2_X86_SHA_ENABLED
+#undef BDLDE_SHA2_ARMV8_SHA_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
 //
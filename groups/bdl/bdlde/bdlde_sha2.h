@@ -12,6 +12,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //  bdlde::Sha256: value-semantic type representing a SHA-256 digest
 //  bdlde::Sha384: value-semantic type representing a SHA-384 digest
 //  bdlde::Sha512: value-semantic type representing a SHA-512 digest
+//  bdlde::Sha2_Impl: alternative implementations of the SHA-256 compression
 //
 //@SEE_ALSO: bdlde_md5
 //
@@ -25,6 +26,30 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+// `Sha224` and `Sha256` additionally provide the class method
+// `calculateMany`, which computes the digests of several independent messages
+// in one call, compressing the whole blocks of each message in place rather
+// than through the internal buffer of a digest object.  The struct
+// `bdlde::Sha2_Impl` exposes the alternative implementations of the SHA-256
+// compression function, and should not be used other than to test and
+// benchmark.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// The SHA-256 compression function used by `Sha224` and `Sha256` is
+// hardware-accelerated when building on a supported architecture with a
+// compatible compiler.  The digests produced are identical to those of the
+// portable implementation:
+// * x86: the SHA extensions (along with SSSE3 and SSE4.1) are used when a
+//   runtime check detects that the running processor supports them.  This
+//   requires GCC (version 5 or later) or Clang, but no special compilation
+//   flags.
+// * ARMv8: the SHA-2 cryptographic extension is used when the compiler
+//   targets it (i.e., defines `__ARM_FEATURE_SHA2` or
+//   `__ARM_FEATURE_CRYPTO`).
+//
+// `Sha384` and `Sha512` always use the portable implementation.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -125,6 +150,22 @@ class Sha224 {
     /// The size (in bytes) of the output
     static const bsl::size_t k_DIGEST_SIZE = 224 / 8;
 
+    // CLASS METHODS
+
+    /// Load into the specified `results` the SHA-224 digests of the
+    /// specified `numMessages` independent messages, where the message at
+    /// each index `i` starts at the address `messages[i]` and has the
+    /// length `lengths[i]` (in bytes), and its digest is stored into
+    /// `results + i * k_DIGEST_SIZE`.  The behavior is undefined unless
+    /// `results` refers to an array of at least
+    /// `numMessages * k_DIGEST_SIZE` bytes, and `messages` and `lengths`
+    /// each refer to an array of at least `numMessages` elements.  Note
+    /// that if `messages[i]` is 0, then `lengths[i]` must be 0.
+    static void calculateMany(unsigned char       *results,
+                              const void *const   *messages,
+                              const bsl::size_t   *lengths,
+                              bsl::size_t          numMessages);
+
     // CREATORS
 
     /// Construct a SHA-2 digest having the value corresponding to no data
@@ -209,6 +250,22 @@ class Sha256 {
     /// The size (in bytes) of the output
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
 
+    // CLASS METHODS
+
+    /// Load into the specified `results` the SHA-256 digests of the
+    /// specified `numMessages` independent messages, where the message at
+    /// each index `i` starts at the address `messages[i]` and has the
+    /// length `lengths[i]` (in bytes), and its digest is stored into
+    /// `results + i * k_DIGEST_SIZE`.  The behavior is undefined unless
+    /// `results` refers to an array of at least
+    /// `numMessages * k_DIGEST_SIZE` bytes, and `messages` and `lengths`
+    /// each refer to an array of at least `numMessages` elements.  Note
+    /// that if `messages[i]` is 0, then `lengths[i]` must be 0.
+    static void calculateMany(unsigned char       *results,
+                              const void *const   *messages,
+                              const bsl::size_t   *lengths,
+                              bsl::size_t          numMessages);
+
     // CREATORS
 
     /// Construct a SHA-2 digest having the value corresponding to no data
@@ -422,6 +479,41 @@ class Sha512 {
     bsl::ostream& print(bsl::ostream& stream) const;
 };
 
+                              // ================
+                              // struct Sha2_Impl
+                              // ================
+
+/// This `struct` provides access to the alternative implementations of the
+/// SHA-256 compression function used by `Sha224` and `Sha256`.  It should
+/// not be used other than to test and benchmark.
+struct Sha2_Impl {
+
+    // CLASS METHODS
+
+    /// Return `true` if a hardware-accelerated implementation of the
+    /// SHA-256 compression function is available on the running platform,
+    /// and `false` otherwise.
+    static bool hasHardwareSha256();
+
+    /// Update the specified `state` by compressing into it the specified
+    /// `numBlocks` 64-byte message blocks starting at the specified
+    /// `blocks`, using a hardware-accelerated implementation.  The behavior
+    /// is undefined unless `hasHardwareSha256()` returns `true`, and
+    /// `[blocks, blocks + numBlocks * 64)` is a valid range.
+    static void transformSha256Hardware(bsl::uint32_t       *state,
+                                        const unsigned char *blocks,
+                                        bsl::size_t          numBlocks);
+
+    /// Update the specified `state` by compressing into it the specified
+    /// `numBlocks` 64-byte message blocks starting at the specified
+    /// `blocks`, using the portable implementation.  The behavior is
+    /// undefined unless `[blocks, blocks + numBlocks * 64)` is a valid
+    /// range.
+    static void transformSha256Portable(bsl::uint32_t       *state,
+                                        const unsigned char *blocks,
+                                        bsl::size_t          numBlocks);
+};
+
 // FREE OPERATORS
 
 /// Return `true` if the specified `lhs` and `rhs` SHA digests have the same
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -86,6 +87,13 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [26] void Sha224::calculateMany(uchar *, const void *const *, ...);
+// [26] void Sha256::calculateMany(uchar *, const void *const *, ...);
+// [26] bool Sha2_Impl::hasHardwareSha256();
+// [26] void Sha2_Impl::transformSha256Hardware(uint32_t *, ...);
+// [26] void Sha2_Impl::transformSha256Portable(uint32_t *, ...);
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +143,8 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
+// [-1] PERFORMANCE: hardware, portable, and multi-buffer SHA-256
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -487,6 +496,72 @@ void testReset(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+/// Fill the specified `data` with pseudo-random bytes derived from the
+/// specified `seed`.
+void fillPseudoRandom(bsl::vector<unsigned char> *data, unsigned int seed)
+{
+    for (bsl::size_t index = 0; index != data->size(); ++index) {
+        seed = seed * 1103515245 + 12345;
+        (*data)[index] = static_cast<unsigned char>(seed >> 16);
+    }
+}
+
+/// Test that `HASHER::calculateMany` loads the same digests as hashing each
+/// message individually, for batches of every size up to a small limit,
+/// including messages of lengths at and around the block boundaries.
+template<class HASHER>
+void testCalculateMany()
+{
+    const bsl::size_t LENGTHS[] = {   0,   1,  55,  56,  63,  64,  65, 119,
+                                    120, 128, 129, 200, 1000, 4096, 4099 };
+    const bsl::size_t NUM_LENGTHS = arraySize(LENGTHS);
+
+    bsl::vector<bsl::vector<unsigned char> > data(NUM_LENGTHS);
+    bsl::vector<const void *>                messages(NUM_LENGTHS);
+    bsl::vector<bsl::size_t>                 lengths(NUM_LENGTHS);
+    for (bsl::size_t index = 0; index != NUM_LENGTHS; ++index) {
+        data[index].resize(LENGTHS[index]);
+        fillPseudoRandom(&data[index], static_cast<unsigned int>(index));
+        messages[index] = LENGTHS[index] ? &data[index][0] : 0;
+        lengths[index]  = LENGTHS[index];
+    }
+
+    for (bsl::size_t numMessages = 0;
+         numMessages <= NUM_LENGTHS;
+         ++numMessages) {
+        for (bsl::size_t offset = 0;
+             offset + numMessages <= NUM_LENGTHS;
+             offset += 3) {
+            bsl::vector<unsigned char> results(
+                                 (numMessages + 1) * HASHER::k_DIGEST_SIZE,
+                                 0xAB);
+
+            HASHER::calculateMany(results.data(),
+                                  messages.data() + offset,
+                                  lengths.data() + offset,
+                                  numMessages);
+
+            for (bsl::size_t index = 0; index != numMessages; ++index) {
+                const HASHER  hasher(messages[offset + index],
+                                     lengths[offset + index]);
+                unsigned char expected[HASHER::k_DIGEST_SIZE];
+                hasher.loadDigest(expected);
+
+                ASSERTV(numMessages, offset, index,
+                        bsl::equal(expected,
+                                   expected + HASHER::k_DIGEST_SIZE,
+                                   results.begin()
+                                         + index * HASHER::k_DIGEST_SIZE));
+            }
+
+            // The byte after the last digest is not modified.
+
+            ASSERTV(numMessages, offset,
+                    0xAB == results[numMessages * HASHER::k_DIGEST_SIZE]);
+        }
+    }
+}
+
 /// Test the two-argument constructor accepting the specified `message` and
 /// the specified `length`.
 template<class HASHER, bsl::size_t LENGTH>
@@ -513,7 +588,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -535,6 +610,79 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING HARDWARE ACCELERATION AND `calculateMany`
+        //
+        // Concerns:
+        // 1. The hardware-accelerated SHA-256 compression function, if
+        //    available, produces the same state as the portable one for any
+        //    initial state and any number of blocks.
+        //
+        // 2. `calculateMany` loads the same digests as hashing each message
+        //    individually, whether the batch has an odd or even number of
+        //    messages and whatever the relative lengths of the messages.
+        //
+        // 3. `calculateMany` writes only `numMessages * k_DIGEST_SIZE`
+        //    bytes, and accepts an empty batch.
+        //
+        // Plan:
+        // 1. If `hasHardwareSha256` returns `true`, compress pseudo-random
+        //    blocks from pseudo-random states with both implementations and
+        //    compare the results.  (C-1)
+        //
+        // 2. Compare the results of `calculateMany` for every batch size of
+        //    messages having lengths around the block boundaries with the
+        //    digests of the individual messages, and verify a sentinel byte
+        //    following the results.  (C-2..3)
+        //
+        // Testing:
+        //   void Sha224::calculateMany(uchar *, const void *const *, ...);
+        //   void Sha256::calculateMany(uchar *, const void *const *, ...);
+        //   bool Sha2_Impl::hasHardwareSha256();
+        //   void Sha2_Impl::transformSha256Hardware(uint32_t *, ...);
+        //   void Sha2_Impl::transformSha256Portable(uint32_t *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING HARDWARE ACCELERATION AND "
+                             "`calculateMany`\n"
+                             "=================================="
+                             "===============\n";
+
+        if (verbose) {
+            cout << "Hardware SHA-256: "
+                 << bdlde::Sha2_Impl::hasHardwareSha256() << '\n';
+        }
+
+        if (bdlde::Sha2_Impl::hasHardwareSha256()) {
+            bsl::vector<unsigned char> blocks(64 * 9);
+
+            for (unsigned int seed = 0; seed != 100; ++seed) {
+                fillPseudoRandom(&blocks, seed);
+
+                bsl::uint32_t portable[8];
+                bsl::uint32_t hardware[8];
+                for (int index = 0; index != 8; ++index) {
+                    portable[index] = hardware[index] =
+                                         blocks[index] * 0x01010101u + seed;
+                }
+
+                const bsl::size_t NUM_BLOCKS = seed % 10;
+
+                bdlde::Sha2_Impl::transformSha256Portable(portable,
+                                                          blocks.data(),
+                                                          NUM_BLOCKS);
+                bdlde::Sha2_Impl::transformSha256Hardware(hardware,
+                                                          blocks.data(),
+                                                          NUM_BLOCKS);
+
+                ASSERTV(seed, bsl::equal(portable, portable + 8, hardware));
+            }
+        }
+
+        testCalculateMany<bdlde::Sha224>();
+        testCalculateMany<bdlde::Sha256>();
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
@@ -1254,6 +1402,91 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: HARDWARE, PORTABLE, AND MULTI-BUFFER SHA-256
+        //
+        // Concerns:
+        // 1. Report the throughput of the SHA-256 compression function
+        //    implementations, and of hashing many independent messages
+        //    individually and with `calculateMany`.
+        //
+        // Plan:
+        // 1. Time each implementation over the same data, with an optional
+        //    second argument specifying the message size in bytes.
+        //
+        // Testing:
+        //   PERFORMANCE: hardware, portable, and multi-buffer SHA-256
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: HARDWARE, PORTABLE, AND "
+                             "MULTI-BUFFER SHA-256\n"
+                             "====================================="
+                             "====================\n";
+
+        const bsl::size_t MESSAGE_SIZE = argc > 2 && 0 < atoi(argv[2])
+                                       ? atoi(argv[2])
+                                       : 1024;
+        const bsl::size_t TOTAL_SIZE   = 64 * 1024 * 1024;
+        const bsl::size_t NUM_MESSAGES = TOTAL_SIZE / MESSAGE_SIZE;
+
+        bsl::vector<unsigned char> data(TOTAL_SIZE);
+        fillPseudoRandom(&data, 0);
+
+        bsls::Stopwatch timer;
+        bsl::uint32_t   state[8] = {};
+
+        cout << "implementation,message_size,seconds,megabytes_per_second\n";
+
+        timer.start();
+        bdlde::Sha2_Impl::transformSha256Portable(state,
+                                                  data.data(),
+                                                  TOTAL_SIZE / 64);
+        timer.stop();
+        cout << "portable transform,-," << timer.elapsedTime() << ','
+             << TOTAL_SIZE / timer.elapsedTime() / 1e6 << '\n';
+
+        if (bdlde::Sha2_Impl::hasHardwareSha256()) {
+            timer.reset();
+            timer.start();
+            bdlde::Sha2_Impl::transformSha256Hardware(state,
+                                                      data.data(),
+                                                      TOTAL_SIZE / 64);
+            timer.stop();
+            cout << "hardware transform,-," << timer.elapsedTime() << ','
+                 << TOTAL_SIZE / timer.elapsedTime() / 1e6 << '\n';
+        }
+
+        bsl::vector<const void *>  messages(NUM_MESSAGES);
+        bsl::vector<bsl::size_t>   lengths(NUM_MESSAGES, MESSAGE_SIZE);
+        bsl::vector<unsigned char> results(NUM_MESSAGES *
+                                           bdlde::Sha256::k_DIGEST_SIZE);
+        for (bsl::size_t index = 0; index != NUM_MESSAGES; ++index) {
+            messages[index] = &data[index * MESSAGE_SIZE];
+        }
+
+        timer.reset();
+        timer.start();
+        for (bsl::size_t index = 0; index != NUM_MESSAGES; ++index) {
+            bdlde::Sha256 hasher(messages[index], MESSAGE_SIZE);
+            hasher.loadDigest(&results[index * bdlde::Sha256::k_DIGEST_SIZE]);
+        }
+        timer.stop();
+        cout << "Sha256 per message," << MESSAGE_SIZE << ','
+             << timer.elapsedTime() << ','
+             << TOTAL_SIZE / timer.elapsedTime() / 1e6 << '\n';
+
+        timer.reset();
+        timer.start();
+        bdlde::Sha256::calculateMany(results.data(),
+                                     messages.data(),
+                                     lengths.data(),
+                                     NUM_MESSAGES);
+        timer.stop();
+        cout << "Sha256::calculateMany," << MESSAGE_SIZE << ','
+             << timer.elapsedTime() << ','
+             << TOTAL_SIZE / timer.elapsedTime() / 1e6 << '\n';
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
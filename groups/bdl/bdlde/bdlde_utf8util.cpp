@@ -7,6 +7,8 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #include <bsla_fallthrough.h>
 #include <bsla_unused.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -19,6 +21,16 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #include <bsl_limits.h>
 #include <bsl_streambuf.h>
 
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLDE_UTF8UTIL_SIMD_ENABLED
+# define BDLDE_UTF8UTIL_SSSE3_TARGET __attribute__((target("ssse3")))
+# define BDLDE_UTF8UTIL_AVX2_TARGET  __attribute__((target("avx2")))
+#endif
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
@@ -429,6 +441,381 @@ int validateAndCountCodePoints(const char **invalidString, const char *string)
     }
 }
 
+                        // ------------------------
+                        // validated-prefix kernels
+                        // ------------------------
+
+// The functions in this section find a prefix of a UTF-8 string that is known
+// to consist entirely of valid, complete code points, so that the
+// code-point-at-a-time loop of `validateAndCountCodePoints` need only examine
+// the remainder, which begins with the first erroneous sequence, if any.
+// The vector kernels implement the "lookup" algorithm of Keiser and Lemire,
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (Software:
+// Practice and Experience, 2021), also used by the `simdjson` and `simdutf`
+// libraries.  Every byte is classified, by three 16-entry table lookups on
+// the high nibble of the preceding byte, the low nibble of the preceding
+// byte, and the high nibble of the byte itself, into a set of error bits
+// whose intersection is non-empty exactly when the two bytes cannot be
+// adjacent in valid UTF-8 (e.g., a lead byte followed by a non-continuation
+// byte, or the second byte of an overlong encoding or of a surrogate).  A
+// separate test flags the third and fourth bytes of 3- and 4-byte
+// sequences, which must be continuation bytes.  Any error found in a block is
+// attributed to the code point beginning before it, if that code point spans
+// the block boundary, so the prefix returned always ends on a code point
+// boundary that precedes every error; `validateAndCountCodePoints` then
+// reports the exact location and kind of the error as before.
+
+enum {
+    // Error bits of the lookup tables used by the vector kernels.  Note that
+    // `k_ERR_TOO_LARGE_1000` and `k_ERR_OVERLONG_4` share a bit: the high
+    // nibble of the second byte decides which applies.
+
+    k_ERR_TOO_SHORT      = 1 << 0,  // lead byte not followed by continuation
+    k_ERR_TOO_LONG       = 1 << 1,  // ASCII byte followed by continuation
+    k_ERR_OVERLONG_3     = 1 << 2,  // `0xe0` followed by `[ 0x80 .. 0x9f ]`
+    k_ERR_TOO_LARGE      = 1 << 3,  // value greater than `0x10ffff`
+    k_ERR_SURROGATE      = 1 << 4,  // `0xed` followed by `[ 0xa0 .. 0xbf ]`
+    k_ERR_OVERLONG_2     = 1 << 5,  // `0xc0` or `0xc1`
+    k_ERR_TOO_LARGE_1000 = 1 << 6,  // `0xf5` or higher followed by `0x8?`
+    k_ERR_OVERLONG_4     = 1 << 6,  // `0xf0` followed by `[ 0x80 .. 0x8f ]`
+    k_ERR_TWO_CONTS      = 1 << 7,  // two continuation bytes
+    k_ERR_CARRY          = k_ERR_TOO_SHORT | k_ERR_TOO_LONG | k_ERR_TWO_CONTS
+};
+
+/// Error bits indexed by the high nibble of the first of two bytes.
+const unsigned char byte1HighTable[16] = {
+    // '0???????': ASCII
+    k_ERR_TOO_LONG, k_ERR_TOO_LONG, k_ERR_TOO_LONG, k_ERR_TOO_LONG,
+    k_ERR_TOO_LONG, k_ERR_TOO_LONG, k_ERR_TOO_LONG, k_ERR_TOO_LONG,
+
+    // '10??????': continuation
+    k_ERR_TWO_CONTS, k_ERR_TWO_CONTS, k_ERR_TWO_CONTS, k_ERR_TWO_CONTS,
+
+    // '1100????': two-byte lead, possibly overlong
+    k_ERR_TOO_SHORT | k_ERR_OVERLONG_2,
+
+    // '1101????': two-byte lead
+    k_ERR_TOO_SHORT,
+
+    // '1110????': three-byte lead
+    k_ERR_TOO_SHORT | k_ERR_OVERLONG_3 | k_ERR_SURROGATE,
+
+    // '1111????': four-byte lead, or invalid
+    k_ERR_TOO_SHORT | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000 |
+                                                              k_ERR_OVERLONG_4
+};
+
+/// Error bits indexed by the low nibble of the first of two bytes.
+const unsigned char byte1LowTable[16] = {
+    // '????0000'
+    k_ERR_CARRY | k_ERR_OVERLONG_3 | k_ERR_OVERLONG_2 | k_ERR_OVERLONG_4,
+
+    // '????0001'
+    k_ERR_CARRY | k_ERR_OVERLONG_2,
+
+    // '????001?'
+    k_ERR_CARRY,
+    k_ERR_CARRY,
+
+    // '????0100'
+    k_ERR_CARRY | k_ERR_TOO_LARGE,
+
+    // '????0101' .. '????1100'
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+
+    // '????1101'
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000 | k_ERR_SURROGATE,
+
+    // '????111?'
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000,
+    k_ERR_CARRY | k_ERR_TOO_LARGE | k_ERR_TOO_LARGE_1000
+};
+
+/// Error bits indexed by the high nibble of the second of two bytes.
+const unsigned char byte2HighTable[16] = {
+    // '0???????': ASCII
+    k_ERR_TOO_SHORT, k_ERR_TOO_SHORT, k_ERR_TOO_SHORT, k_ERR_TOO_SHORT,
+    k_ERR_TOO_SHORT, k_ERR_TOO_SHORT, k_ERR_TOO_SHORT, k_ERR_TOO_SHORT,
+
+    // '1000????'
+    k_ERR_TOO_LONG | k_ERR_OVERLONG_2 | k_ERR_TWO_CONTS | k_ERR_OVERLONG_3 |
+                                      k_ERR_TOO_LARGE_1000 | k_ERR_OVERLONG_4,
+
+    // '1001????'
+    k_ERR_TOO_LONG | k_ERR_OVERLONG_2 | k_ERR_TWO_CONTS | k_ERR_OVERLONG_3 |
+                                                               k_ERR_TOO_LARGE,
+
+    // '101?????'
+    k_ERR_TOO_LONG | k_ERR_OVERLONG_2 | k_ERR_TWO_CONTS | k_ERR_SURROGATE |
+                                                               k_ERR_TOO_LARGE,
+    k_ERR_TOO_LONG | k_ERR_OVERLONG_2 | k_ERR_TWO_CONTS | k_ERR_SURROGATE |
+                                                               k_ERR_TOO_LARGE,
+
+    // '11??????': lead
+    k_ERR_TOO_SHORT, k_ERR_TOO_SHORT, k_ERR_TOO_SHORT, k_ERR_TOO_SHORT
+};
+
+/// Return the length of the longest prefix of the specified `string`,
+/// ending at the specified `end`, that ends on a code point boundary, and
+/// load into the specified `numCodePoints` the number of code points in that
+/// prefix, given the specified `count` of non-continuation bytes in
+/// `[ string .. end )`.  The behavior is undefined unless
+/// `[ string .. end )` contains only valid UTF-8, except that the last code
+/// point may be incomplete.
+size_type finishPrefix(size_type  *numCodePoints,
+                       const char *string,
+                       const char *end,
+                       size_type   count)
+{
+    if (string != end && (end[-1] & 0x80)) {
+        // The last code point may continue past `end`; back off to its lead
+        // byte, which is at most 3 bytes back.
+
+        do {
+            --end;
+        } while (string != end && !isNotContinuation(*end));
+
+        --count;
+    }
+
+    *numCodePoints = count;
+    return end - string;
+}
+
+/// Return the length of a prefix of the specified `string` having the
+/// specified `length` that consists of valid UTF-8 and ends on a code point
+/// boundary, and load the number of code points in that prefix into the
+/// specified `numCodePoints`.  This portable kernel finds only the prefix of
+/// `string` consisting of ASCII characters, examining 8 bytes at a time.
+size_type validPrefixScalar(size_type  *numCodePoints,
+                            const char *string,
+                            size_type   length)
+{
+    const char *pc  = string;
+    const char *end = string + (length & ~size_type(7));
+
+    for (; pc != end; pc += 8) {
+        bsls::Types::Uint64 word;
+        bsl::memcpy(&word, pc, sizeof word);
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+    }
+
+    *numCodePoints = pc - string;
+    return pc - string;
+}
+
+#if defined(BDLDE_UTF8UTIL_SIMD_ENABLED)
+
+/// Return `true` if the running processor supports the SSSE3 instructions,
+/// and `false` otherwise.
+bool detectSsse3()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+}
+
+/// Return `true` if the running processor and operating system support the
+/// AVX2 instructions, and `false` otherwise.
+bool detectAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+/// Return the length of a prefix of the specified `string` having the
+/// specified `length` that consists of valid UTF-8 and ends on a code point
+/// boundary, and load the number of code points in that prefix into the
+/// specified `numCodePoints`.  This kernel validates 16 bytes at a time,
+/// and the prefix returned extends to within 19 bytes of the first error,
+/// or of the end of `string`.
+BDLDE_UTF8UTIL_SSSE3_TARGET
+size_type validPrefixSsse3(size_type  *numCodePoints,
+                           const char *string,
+                           size_type   length)
+{
+    const __m128i byte1High = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(byte1HighTable));
+    const __m128i byte1Low  = _mm_loadu_si128(
+                              reinterpret_cast<const __m128i *>(byte1LowTable));
+    const __m128i byte2High = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(byte2HighTable));
+    const __m128i nibble    = _mm_set1_epi8(0x0f);
+    const __m128i maxCont   = _mm_set1_epi8(static_cast<char>(0xbf));
+    const __m128i maxLead2  = _mm_set1_epi8(static_cast<char>(0xdf));
+    const __m128i maxLead3  = _mm_set1_epi8(static_cast<char>(0xef));
+    const __m128i highBit   = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i zero      = _mm_setzero_si128();
+
+    const char *pc  = string;
+    const char *end = string + (length & ~size_type(15));
+
+    __m128i   prev        = zero;
+    bool      prevIsAscii = true;
+    size_type count       = 0;
+
+    for (; pc != end; pc += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(pc));
+        const int     high  = _mm_movemask_epi8(input);
+
+        if (0 == high && prevIsAscii) {
+            count += 16;
+            continue;
+        }
+
+        const __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+        const __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+        const __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+
+        const __m128i special = _mm_and_si128(
+            _mm_and_si128(
+                _mm_shuffle_epi8(byte1High,
+                          _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                _mm_shuffle_epi8(byte1Low, _mm_and_si128(prev1, nibble))),
+            _mm_shuffle_epi8(byte2High,
+                             _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+
+        // The third and fourth bytes of 3- and 4-byte sequences must be
+        // continuation bytes, which the tables above flag as
+        // `k_ERR_TWO_CONTS`; the `xor` both clears those expected bits and
+        // sets the bit where a continuation was expected but not found.
+
+        const __m128i must23  = _mm_or_si128(_mm_subs_epu8(prev2, maxLead2),
+                                             _mm_subs_epu8(prev3, maxLead3));
+        const __m128i error   = _mm_xor_si128(
+                          special,
+                          _mm_and_si128(_mm_cmpgt_epi8(must23, zero), highBit));
+
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(error, zero))) {
+            break;
+        }
+
+        // Count the bytes that are not continuation bytes, which, viewed as
+        // signed, are those greater than `0xbf`.
+
+        count += __builtin_popcount(
+                      _mm_movemask_epi8(_mm_cmpgt_epi8(input, maxCont)));
+
+        prev        = input;
+        prevIsAscii = 0 == high;
+    }
+
+    return finishPrefix(numCodePoints, string, pc, count);
+}
+
+/// Return the length of a prefix of the specified `string` having the
+/// specified `length` that consists of valid UTF-8 and ends on a code point
+/// boundary, and load the number of code points in that prefix into the
+/// specified `numCodePoints`.  This kernel validates 32 bytes at a time,
+/// and the prefix returned extends to within 35 bytes of the first error,
+/// or of the end of `string`.
+BDLDE_UTF8UTIL_AVX2_TARGET
+size_type validPrefixAvx2(size_type  *numCodePoints,
+                          const char *string,
+                          size_type   length)
+{
+    const __m256i byte1High = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(byte1HighTable)));
+    const __m256i byte1Low  = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(byte1LowTable)));
+    const __m256i byte2High = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(byte2HighTable)));
+    const __m256i nibble    = _mm256_set1_epi8(0x0f);
+    const __m256i maxCont   = _mm256_set1_epi8(static_cast<char>(0xbf));
+    const __m256i maxLead2  = _mm256_set1_epi8(static_cast<char>(0xdf));
+    const __m256i maxLead3  = _mm256_set1_epi8(static_cast<char>(0xef));
+    const __m256i highBit   = _mm256_set1_epi8(static_cast<char>(0x80));
+    const __m256i zero      = _mm256_setzero_si256();
+
+    const char *pc  = string;
+    const char *end = string + (length & ~size_type(31));
+
+    __m256i   prev        = zero;
+    bool      prevIsAscii = true;
+    size_type count       = 0;
+
+    for (; pc != end; pc += 32) {
+        const __m256i input = _mm256_loadu_si256(
+                                       reinterpret_cast<const __m256i *>(pc));
+        const int     high  = _mm256_movemask_epi8(input);
+
+        if (0 == high && prevIsAscii) {
+            count += 32;
+            continue;
+        }
+
+        // `_mm256_alignr_epi8` shifts within each 128-bit lane, so first
+        // form the 32 bytes straddling `prev` and `input`.
+
+        const __m256i carried = _mm256_permute2x128_si256(prev, input, 0x21);
+        const __m256i prev1   = _mm256_alignr_epi8(input, carried, 15);
+        const __m256i prev2   = _mm256_alignr_epi8(input, carried, 14);
+        const __m256i prev3   = _mm256_alignr_epi8(input, carried, 13);
+
+        const __m256i special = _mm256_and_si256(
+            _mm256_and_si256(
+                _mm256_shuffle_epi8(byte1High,
+                       _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                _mm256_shuffle_epi8(byte1Low,
+                                    _mm256_and_si256(prev1, nibble))),
+            _mm256_shuffle_epi8(byte2High,
+                       _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+
+        const __m256i must23 = _mm256_or_si256(
+                                         _mm256_subs_epu8(prev2, maxLead2),
+                                         _mm256_subs_epu8(prev3, maxLead3));
+        const __m256i error  = _mm256_xor_si256(
+                    special,
+                    _mm256_and_si256(_mm256_cmpgt_epi8(must23, zero), highBit));
+
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+
+        count += __builtin_popcount(static_cast<unsigned>(
+                     _mm256_movemask_epi8(_mm256_cmpgt_epi8(input, maxCont))));
+
+        prev        = input;
+        prevIsAscii = 0 == high;
+    }
+
+    return finishPrefix(numCodePoints, string, pc, count);
+}
+
+#endif
+
+typedef size_type (*ValidPrefixFn)(size_type  *numCodePoints,
+                                   const char *string,
+                                   size_type   length);
+
+/// Return the fastest validated-prefix kernel available on the running
+/// platform.
+ValidPrefixFn validPrefixFunction()
+{
+    static ValidPrefixFn validPrefixFn = 0;
+
+    BSLMT_ONCE_DO {
+#if defined(BDLDE_UTF8UTIL_SIMD_ENABLED)
+        validPrefixFn = detectAvx2()  ? &validPrefixAvx2
+                      : detectSsse3() ? &validPrefixSsse3
+                      :                 &validPrefixScalar;
+#else
+        validPrefixFn = &validPrefixScalar;
+#endif
+    }
+
+    return validPrefixFn;
+}
+
 /// Return the number of Unicode code points in the specified `string`
 /// having the specified `length` (in bytes) if `string` contains valid
 /// UTF-8, with no effect on the specified `invalidString`.  Otherwise,
@@ -453,10 +840,18 @@ int validateAndCountCodePoints(const char             **invalidString,
         return 0;                                                     // RETURN
     }
 
-    const char       *pc     = string;
+    // Skip the prefix that the fastest available kernel can show to be valid
+    // and then examine the rest, if any, one code point at a time, so that
+    // the location and kind of the first error are determined exactly as
+    // before.
+
+    size_type   numCodePoints;
+    const char *pc = string + validPrefixFunction()(&numCodePoints,
+                                                    string,
+                                                    length);
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
+    int count = static_cast<int>(numCodePoints);
 
     while (pc <= pcEnd4) {
         switch (static_cast<unsigned char>(*pc) >> 4) {
@@ -876,6 +1271,52 @@ int Utf8Util_ImpUtil::getLineAndColumnNumber(
     BSLS_ASSERT_INVOKE_NORETURN("unreachable");
 }
 
+bool Utf8Util_ImpUtil::isAvailable(Kernel kernel)
+{
+    switch (kernel) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      }
+#if defined(BDLDE_UTF8UTIL_SIMD_ENABLED)
+      case e_SSSE3: {
+        return u::detectSsse3();                                      // RETURN
+      }
+      case e_AVX2: {
+        return u::detectAvx2();                                       // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
+Utf8Util_ImpUtil::size_type Utf8Util_ImpUtil::validPrefix(
+                                            size_type  *numCodePoints,
+                                            const char *string,
+                                            size_type   length,
+                                            Kernel      kernel)
+{
+    BSLS_ASSERT(numCodePoints);
+    BSLS_ASSERT(string || 0 == length);
+    BSLS_ASSERT(isAvailable(kernel));
+
+    switch (kernel) {
+#if defined(BDLDE_UTF8UTIL_SIMD_ENABLED)
+      case e_SSSE3: {
+        return u::validPrefixSsse3(numCodePoints, string, length);
+                                                                      // RETURN
+      }
+      case e_AVX2: {
+        return u::validPrefixAvx2(numCodePoints, string, length);     // RETURN
+      }
+#endif
+      default: {
+        return u::validPrefixScalar(numCodePoints, string, length);   // RETURN
+      }
+    }
+}
+
                               // ---------------
                               // struct Utf8Util
                               // ---------------
@@ -1970,6 +2411,10 @@ const char *Utf8Util::toAscii(IntPtr value)
 }  // close package namespace
 }  // close enterprise namespace
 
+#undef BDLDE_UTF8UTIL_AVX2_TARGET
+#undef BDLDE_UTF8UTIL_SSSE3_TARGET
+#undef BDLDE_UTF8UTIL_SIMD_ENABLED
+
 // ----------------------------------------------------------------------------
 // Copyright 2015 Bloomberg Finance L.P.
 //
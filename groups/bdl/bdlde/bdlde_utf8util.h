@@ -853,6 +853,14 @@ struct Utf8Util_ImpUtil {
     typedef bsls::Types::Uint64    Uint64;
     typedef bsls::Types::size_type size_type;
 
+    /// Enumerates the kernels that `validPrefix` may use to validate a
+    /// prefix of a UTF-8 string in bulk.
+    enum Kernel {
+        e_SCALAR,  // portable, skips ASCII 8 bytes at a time
+        e_SSSE3,   // x86 SSSE3, validates 16 bytes at a time
+        e_AVX2     // x86 AVX2, validates 32 bytes at a time
+    };
+
     /// Given a string referred to by the specified `input`, return the number
     /// of bytes in first code point in the string, whether the code point is
     /// valid or invalid.  Note that if the string begins with an invalid
@@ -885,6 +893,26 @@ struct Utf8Util_ImpUtil {
                                   char            lineDelimeter,
                                   char           *temporaryReadBuffer,
                                   int             temporaryReadBufferNumBytes);
+
+    /// Return `true` if the specified `kernel` is supported by the running
+    /// platform, and `false` otherwise.
+    static bool isAvailable(Kernel kernel);
+
+    /// Return the length of a prefix of the specified `string` having the
+    /// specified `length` (in bytes) that contains only valid UTF-8 and ends
+    /// on a code point boundary, found using the specified `kernel`, and
+    /// load the number of code points in that prefix into the specified
+    /// `numCodePoints`.  The prefix need not be the longest such prefix, and
+    /// may be empty, but always precedes the first invalid sequence in
+    /// `string`, if any.  The behavior is undefined unless
+    /// `isAvailable(kernel)` is `true`.  Note that the validating methods of
+    /// `Utf8Util` taking a length use the fastest available kernel to skip
+    /// such a prefix before examining the remainder of the input one code
+    /// point at a time.
+    static size_type validPrefix(size_type  *numCodePoints,
+                                 const char *string,
+                                 size_type   length,
+                                 Kernel      kernel);
 };
 
 // ============================================================================
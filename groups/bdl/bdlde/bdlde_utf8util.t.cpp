@@ -13,6 +13,7 @@
 #include <bsls_log.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -163,15 +164,18 @@ using bsl::size_t;
 // [13] const char *toAscii(IntPtr);
 // [18] const char *advancePastValidOrInvalidCodePoint(const char *, IntPtr);
 // [19] IntPtr replaceErrors(string,  const bsl::string_view&, unsigned);
+// [20] bool ImpUtil::isAvailable(Kernel);
+// [20] size_type ImpUtil::validPrefix(size_type *, cchar *, size_type, K);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
 // [14] NEGATIVE TESTING
-// [20] USAGE EXAMPLE 1
-// [21] USAGE EXAMPLE 2
-// [22] USAGE EXAMPLE 3
+// [21] USAGE EXAMPLE 1
+// [22] USAGE EXAMPLE 2
+// [23] USAGE EXAMPLE 3
 // [-1] random number generator
 // [-2] `utf8Encode`, `decode`
+// [-3] PERFORMANCE: `isValid` and `validPrefix`
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
 // ----------------------------------------------------------------------------
@@ -3735,7 +3739,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 22: {
+      case 23: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3: `readIfValid`
         //
@@ -3817,7 +3821,7 @@ int main(int argc, char *argv[])
         ASSERT(out.length() == validLen);
         ASSERT(validChineseUtf8 == out);
       } break;
-      case 21: {
+      case 22: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: `advance`
         //
@@ -3930,7 +3934,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 // ```
       } break;
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: `isValid` AND `numCodePoints*`
         //
@@ -4050,6 +4054,223 @@ int main(int argc, char *argv[])
     ASSERT(invalidPosition == stringWithOverlong.data() + string.length());
 // ```
       } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING `validPrefix`
+        //
+        // Concerns:
+        // 1. Every kernel reported as available by `isAvailable` returns a
+        //    prefix that ends on a code point boundary, precedes the first
+        //    error in the input, if any, and has the number of code points
+        //    loaded into `numCodePoints`.
+        //
+        // 2. The vector kernels return a prefix extending to within one
+        //    vector, plus the 3 trailing bytes of an incomplete code point, of
+        //    the end of valid input, and the scalar kernel returns a prefix
+        //    extending to within 7 bytes of the end of ASCII input.
+        //
+        // 3. The validating methods taking a length, which skip the prefix
+        //    found by the fastest kernel, report the same status, error
+        //    location, and number of code points as the methods taking a
+        //    null-terminated string, which do not, whatever the location and
+        //    kind of error, and whether the surrounding input is ASCII or
+        //    not.
+        //
+        // Plan:
+        // 1. Generate random valid strings of lengths spanning several vector
+        //    blocks, in which the code points are all ASCII, mostly ASCII, or
+        //    of random lengths.  For each available kernel, verify the
+        //    properties of the prefix it returns.  (C-1..2)
+        //
+        // 2. Into each such string, inject at every position each of a table
+        //    of erroneous sequences, covering every status that can be
+        //    reported, and truncate the string at every position.  Verify the
+        //    prefix returned by every available kernel, and compare the
+        //    results of the methods taking a length to those of the methods
+        //    taking a null-terminated string.  (C-1, 3)
+        //
+        // Testing:
+        //   bool ImpUtil::isAvailable(Kernel);
+        //   size_type ImpUtil::validPrefix(size_type *, cchar *, size_type, K);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `validPrefix`\n"
+                             "=====================\n";
+
+        typedef ImpUtil::size_type size_type;
+
+        static const struct {
+            ImpUtil::Kernel  d_kernel;
+            const char      *d_name_p;
+            size_type        d_slack;      // max distance from end of input
+        } KERNELS[] = {
+            { ImpUtil::e_SCALAR, "SCALAR",  7 },
+            { ImpUtil::e_SSSE3,  "SSSE3",  19 },
+            { ImpUtil::e_AVX2,   "AVX2",   35 },
+        };
+        enum { k_NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS };
+
+        ASSERT(ImpUtil::isAvailable(ImpUtil::e_SCALAR));
+
+        if (verbose) {
+            for (int kk = 0; kk < k_NUM_KERNELS; ++kk) {
+                cout << KERNELS[kk].d_name_p << ": "
+                     << (ImpUtil::isAvailable(KERNELS[kk].d_kernel)
+                         ? "available" : "not available") << endl;
+            }
+        }
+
+        // Erroneous sequences to inject, none of which contains a null byte,
+        // so that the methods taking null-terminated strings see the same
+        // input.
+
+        static const struct {
+            int         d_line;
+            const char *d_error_p;
+        } ERRORS[] = {
+            { L_, "\x80"                 },  // unexpected continuation
+            { L_, "\xbf"                 },  // unexpected continuation
+            { L_, "\xc2" "a"             },  // non-continuation
+            { L_, "\xe2\x82" "a"         },  // non-continuation
+            { L_, "\xf0\x90\x80" "a"     },  // non-continuation
+            { L_, "\xc0\x80"             },  // overlong
+            { L_, "\xc1\xbf"             },  // overlong
+            { L_, "\xe0\x9f\xbf"         },  // overlong
+            { L_, "\xf0\x8f\xbf\xbf"     },  // overlong
+            { L_, "\xed\xa0\x80"         },  // surrogate
+            { L_, "\xed\xbf\xbf"         },  // surrogate
+            { L_, "\xf4\x90\x80\x80"     },  // too large
+            { L_, "\xf7\xbf\xbf\xbf"     },  // too large
+            { L_, "\xf8\x88\x80\x80\x80" },  // invalid initial octet
+            { L_, "\xff"                 },  // invalid initial octet
+            { L_, "\xc2"                 },  // truncated by what follows
+            { L_, "\xef\xbf"             },  // truncated by what follows
+            { L_, "\xf4\x8f\xbf"         },  // truncated by what follows
+        };
+        enum { k_NUM_ERRORS = sizeof ERRORS / sizeof *ERRORS };
+
+        // Verify the prefix returned by every available kernel for the
+        // specified `str` of the specified `len`, whose first error, if any,
+        // is at the specified `errorOffset` (`len` otherwise).
+
+        struct CheckPrefix {
+            static void check(const char *str,
+                              size_type   len,
+                              size_type   errorOffset,
+                              bool        isAscii)
+            {
+                for (int kk = 0; kk < k_NUM_KERNELS; ++kk) {
+                    const ImpUtil::Kernel KERNEL = KERNELS[kk].d_kernel;
+                    if (!ImpUtil::isAvailable(KERNEL)) {
+                        continue;
+                    }
+
+                    size_type       numCodePoints = 99999;
+                    const size_type prefix = ImpUtil::validPrefix(
+                                                                &numCodePoints,
+                                                                str,
+                                                                len,
+                                                                KERNEL);
+                    ASSERTV(kk, len, prefix, errorOffset,
+                            prefix <= errorOffset);
+                    ASSERTV(kk, len, prefix,
+                            prefix == errorOffset ||
+                                              (str[prefix] & 0xc0) != 0x80);
+                    ASSERTV(kk, len, prefix, numCodePoints,
+                            Obj::numCodePointsRaw(str, prefix) ==
+                                                  IntPtr(numCodePoints));
+
+                    if (errorOffset == len &&
+                                        (isAscii || ImpUtil::e_SCALAR != KERNEL)) {
+                        ASSERTV(kk, len, prefix,
+                                prefix + KERNELS[kk].d_slack >= len);
+                    }
+                }
+            }
+        };
+
+        for (int ti = 0; ti < 240; ++ti) {
+            const int  MODE    = ti % 3;
+            const bool ASCII   = 0 == MODE;
+            const int  NUM_CPS = ti / 3 * 2;
+
+            bsl::string str;
+            for (int ii = 0; ii < NUM_CPS; ++ii) {
+                const bool asciiCp = ASCII
+                                  || (1 == MODE && 0 != u::randUnsigned() % 8);
+                u::appendRandCorrectCodePoint(&str, false, asciiCp ? 1 : -1);
+            }
+            const size_type LEN = str.length();
+            ASSERT(u::allValid(str));
+
+            if (veryVerbose) { P_(ti) P_(MODE) P(LEN) }
+
+            CheckPrefix::check(str.data(), LEN, LEN, ASCII);
+
+            // Truncate at every position.
+
+            for (size_type pos = 0; pos < LEN; ++pos) {
+                const bsl::string trunc(str.data(), pos);
+
+                const char   *invalid = 0;
+                const IntPtr  ret     = u::allNumCodePointsIfValid(&invalid,
+                                                                   trunc);
+                ASSERTV(ti, pos, (0 <= ret) == !invalid);
+                ASSERTV(ti, pos, Obj::isValid(trunc.data(), trunc.length()) ==
+                                                                   !invalid);
+
+                CheckPrefix::check(trunc.data(),
+                                   pos,
+                                   invalid ? invalid - trunc.data() : pos,
+                                   ASCII);
+            }
+
+            // Inject every error at every position.
+
+            for (int ei = 0; ei < k_NUM_ERRORS; ++ei) {
+                const int   LINE  = ERRORS[ei].d_line;
+                const char *ERROR = ERRORS[ei].d_error_p;
+
+                for (size_type pos = 0; pos <= LEN; ++pos) {
+                    if (pos < LEN && 0x80 == (str[pos] & 0xc0)) {
+                        continue;
+                    }
+
+                    bsl::string bad(str);
+                    bad.insert(pos, ERROR);
+
+                    const char   *invalid = 0;
+                    const IntPtr  ret     = u::allNumCodePointsIfValid(
+                                                                      &invalid,
+                                                                      bad);
+                    ASSERTV(LINE, ti, pos, ret, 0 > ret);
+                    ASSERTV(LINE, ti, pos, invalid - bad.data(),
+                            bad.data() + pos == invalid);
+
+                    int           status = 0;
+                    const char   *advInvalid = 0;
+                    const IntPtr  advRet = u::allAdvanceIfValid(&status,
+                                                                &advInvalid,
+                                                                bad);
+                    ASSERTV(LINE, ti, pos, advInvalid == invalid);
+                    ASSERTV(LINE, ti, pos, ret, status, ret == status);
+                    ASSERTV(LINE, ti, pos, advRet,
+                            Obj::numCodePointsRaw(bad.data(), pos) == advRet);
+
+                    const char *isValidInvalid = 0;
+                    ASSERTV(LINE, ti, pos, !Obj::isValid(&isValidInvalid,
+                                                         bad.data(),
+                                                         bad.length()));
+                    ASSERTV(LINE, ti, pos, isValidInvalid == invalid);
+
+                    CheckPrefix::check(bad.data(),
+                                       bad.length(),
+                                       pos,
+                                       false);
+                }
+            }
+        }
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // TESTING: `ImpUtil::replaceErrors`
@@ -8390,6 +8611,95 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `isValid` AND `validPrefix`
+        //
+        // Concerns:
+        // 1. Report the throughput of `isValid` and of each available
+        //    `validPrefix` kernel on ASCII, mostly ASCII, and multilingual
+        //    input.
+        //
+        // Plan:
+        // 1. Build 1MB strings of each kind, and time repeated validation.
+        //
+        // Testing:
+        //   PERFORMANCE: `isValid` and `validPrefix`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: `isValid` AND `validPrefix`\n"
+                             "========================================\n";
+
+        typedef ImpUtil::size_type size_type;
+
+        enum { k_SIZE = 1 << 20, k_REPS = 100 };
+
+        bsl::string inputs[3];
+        const char *NAMES[3] = { "ASCII", "mostly ASCII", "multilingual" };
+
+        while (inputs[0].length() < k_SIZE) {
+            u::appendRandCorrectCodePoint(&inputs[0], false, 1);
+        }
+        while (inputs[1].length() < k_SIZE) {
+            u::appendRandCorrectCodePoint(&inputs[1],
+                                          false,
+                                          u::randUnsigned() % 16 ? 1 : -1);
+        }
+        while (inputs[2].length() < k_SIZE) {
+            inputs[2] += u::charUtf8MultiLang;
+        }
+
+        static const struct {
+            ImpUtil::Kernel  d_kernel;
+            const char      *d_name_p;
+        } KERNELS[] = {
+            { ImpUtil::e_SCALAR, "SCALAR" },
+            { ImpUtil::e_SSSE3,  "SSSE3"  },
+            { ImpUtil::e_AVX2,   "AVX2"   },
+        };
+        enum { k_NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS };
+
+        for (int ii = 0; ii < 3; ++ii) {
+            const bsl::string& INPUT = inputs[ii];
+            const double       MB    = static_cast<double>(INPUT.length()) *
+                                                          k_REPS / (1 << 20);
+
+            cout << NAMES[ii] << " (" << INPUT.length() << " bytes):\n";
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int rep = 0; rep < k_REPS; ++rep) {
+                ASSERT(Obj::isValid(INPUT.data(), INPUT.length()));
+            }
+            timer.stop();
+            cout << "    isValid:               "
+                 << MB / timer.elapsedTime() << " MB/s\n";
+
+            for (int kk = 0; kk < k_NUM_KERNELS; ++kk) {
+                if (!ImpUtil::isAvailable(KERNELS[kk].d_kernel)) {
+                    continue;
+                }
+
+                size_type numCodePoints = 0;
+                size_type prefix        = 0;
+
+                timer.reset();
+                timer.start();
+                for (int rep = 0; rep < k_REPS; ++rep) {
+                    prefix = ImpUtil::validPrefix(&numCodePoints,
+                                                  INPUT.data(),
+                                                  INPUT.length(),
+                                                  KERNELS[kk].d_kernel);
+                }
+                timer.stop();
+                cout << "    validPrefix(" << KERNELS[kk].d_name_p << "): "
+                     << bsl::string(6 - bsl::strlen(KERNELS[kk].d_name_p),
+                                    ' ')
+                     << MB / timer.elapsedTime() << " MB/s, prefix "
+                     << prefix << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(bdljsn_jsonutil_cpp, "$Id$ $CSID$")
 #include <bdljsn_location.h>
 #include <bdljsn_readoptions.h>
 #include <bdljsn_stringutil.h>
+#include <bdljsn_structuralindex.h>
 #include <bdljsn_tokenizer.h>
 #include <bdljsn_writeoptions.h>
 #include <bdljsn_writestyle.h>
@@ -17,6 +18,7 @@ BSLS_IDENT_RCSID(bdljsn_jsonutil_cpp, "$Id$ $CSID$")
 #include <bdlb_numericparseutil.h>
 #include <bdlde_utf8util.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bsls_alignedbuffer.h>
 #include <bsls_assert.h>
@@ -225,6 +227,326 @@ int read(Json *result, Error *error, Tokenizer *tokenizer, int maxNestedDepth)
       } break;
     }
 
+    return 0;
+}
+
+                        // Structural Index Read Implementation
+
+// Implementation Note: When the `useStructuralIndex` option is set, a document
+// is first read by the `IndexedReader` below, which visits only the offsets
+// in a `StructuralIndex` of the input and never reports an error: if the
+// input is not a valid document, or is one that the `IndexedReader` does not
+// handle, the document is read again using the `Tokenizer`-based functions
+// above, which report the error.  Hence, the same documents are accepted, and
+// the same errors reported, whether or not the option is set.
+
+/// This class reads a JSON document from a text and from the structural index
+/// of that text.
+class IndexedReader {
+
+    // DATA
+    const char                    *d_text_p;  // start of the text
+    const StructuralIndex::Offset *d_next_p;  // next offset to visit
+    const StructuralIndex::Offset *d_end_p;   // sentinel offset
+
+    // PRIVATE CLASS METHODS
+
+    /// Load to the specified `result` the UTF-8 codepoint sequence equivalent
+    /// to the specified `contents` of a JSON string (absent its quotes).
+    /// Return 0 on success, and a non-zero value otherwise.
+    static int readContents(bsl::string             *result,
+                            const bsl::string_view&  contents);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the character at the next offset to visit, or 0 if all offsets
+    /// have been visited.
+    char peek() const;
+
+  public:
+    // CREATORS
+
+    /// Create a reader of the specified `text`, having the specified `index`.
+    /// The behavior is undefined unless `index` was built from `text`.
+    IndexedReader(const bsl::string_view& text, const StructuralIndex& index);
+
+    // MANIPULATORS
+
+    /// Read into the specified `result` the value starting at the next offset
+    /// to visit, not exceeding the specified `maxNestedDepth`, and advance
+    /// past that value.  Return 0 on success, and a non-zero value otherwise.
+    int read(Json *result, int maxNestedDepth);
+
+    /// Read into the specified `result` the array starting at the next
+    /// offset to visit, not exceeding the specified `maxNestedDepth`, and
+    /// advance past that array.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    int readArray(JsonArray *result, int maxNestedDepth);
+
+    /// Read into the specified `result` the object starting at the next
+    /// offset to visit, not exceeding the specified `maxNestedDepth`, and
+    /// advance past that object.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    int readObject(JsonObject *result, int maxNestedDepth);
+
+    /// Read into the specified `result` the scalar (i.e., `null`, `true`,
+    /// `false`, or a number) starting at the next offset to visit, and
+    /// advance past that scalar.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    int readScalar(Json *result);
+
+    // ACCESSORS
+
+    /// Return `true` if all offsets other than the sentinel have been
+    /// visited, and `false` otherwise.
+    bool atEnd() const;
+
+    /// Return the contents of the string, absent its quotes, starting at the
+    /// next offset to visit.  The behavior is undefined unless the character
+    /// at that offset is a quote.
+    bsl::string_view stringContents() const;
+};
+
+// PRIVATE CLASS METHODS
+int IndexedReader::readContents(bsl::string             *result,
+                                const bsl::string_view&  contents)
+{
+    // Most strings have no escape sequences, and so can be copied whole.
+
+    if (bsl::string_view::npos == contents.find('\\')) {
+        result->assign(contents.data(), contents.length());
+        return 0;                                                     // RETURN
+    }
+
+    return StringUtil::readUnquotedString(result, contents);
+}
+
+// PRIVATE ACCESSORS
+char IndexedReader::peek() const
+{
+    return d_next_p == d_end_p ? '\0' : d_text_p[*d_next_p];
+}
+
+// CREATORS
+IndexedReader::IndexedReader(const bsl::string_view& text,
+                             const StructuralIndex&  index)
+: d_text_p(text.data())
+, d_next_p(index.offsets().data())
+, d_end_p(index.offsets().data() + index.offsets().size() - 1)
+{
+    BSLS_ASSERT(!index.offsets().empty());
+    BSLS_ASSERT(text.length() == *d_end_p);
+}
+
+// MANIPULATORS
+int IndexedReader::read(Json *result, int maxNestedDepth)
+{
+    if (d_next_p == d_end_p) {
+        return -1;                                                    // RETURN
+    }
+
+    switch (peek()) {
+      case '{': {
+        return readObject(&result->makeObject(), maxNestedDepth - 1);
+                                                                      // RETURN
+      } break;
+      case '[': {
+        return readArray(&result->makeArray(), maxNestedDepth - 1);
+                                                                      // RETURN
+      } break;
+      case '"': {
+        bsl::string str(result->allocator());
+        if (0 != readContents(&str, stringContents())) {
+            return -1;                                                // RETURN
+        }
+        d_next_p += 2;
+        result->makeString(bslmf::MovableRefUtil::move(str));
+      } break;
+      case '}':
+      case ']':
+      case ':':
+      case ',': {
+        return -1;                                                    // RETURN
+      } break;
+      default: {
+        return readScalar(result);                                    // RETURN
+      } break;
+    }
+
+    return 0;
+}
+
+int IndexedReader::readArray(JsonArray *result, int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    // Advance from `[`.
+    ++d_next_p;
+    if (']' == peek()) {
+        ++d_next_p;
+        return 0;                                                     // RETURN
+    }
+
+    while (true) {
+        result->pushBack(Json());
+
+        int rc = read(&result->back(), maxNestedDepth);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+
+        const char separator = peek();
+        ++d_next_p;
+        if (']' == separator) {
+            return 0;                                                 // RETURN
+        }
+        if (',' != separator) {
+            return -1;                                                // RETURN
+        }
+    }
+}
+
+int IndexedReader::readObject(JsonObject *result, int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    // Advance from `{`.
+    ++d_next_p;
+    if ('}' == peek()) {
+        ++d_next_p;
+        return 0;                                                     // RETURN
+    }
+
+    while (true) {
+        if ('"' != peek()) {
+            return -1;                                                // RETURN
+        }
+
+        bsl::string key;
+        if (0 != readContents(&key, stringContents())) {
+            return -1;                                                // RETURN
+        }
+        d_next_p += 2;
+
+        if (':' != peek()) {
+            return -1;                                                // RETURN
+        }
+        ++d_next_p;
+
+        int rc;
+        // Keep first value found for a given key - discard others.
+        if (result->contains(key)) {
+            Json temp;
+
+            rc = read(&temp, maxNestedDepth);
+        }
+        else {
+            rc = read(&(*result)[key], maxNestedDepth);
+        }
+
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+
+        const char separator = peek();
+        ++d_next_p;
+        if ('}' == separator) {
+            return 0;                                                 // RETURN
+        }
+        if (',' != separator) {
+            return -1;                                                // RETURN
+        }
+    }
+}
+
+int IndexedReader::readScalar(Json *result)
+{
+    // A scalar extends from its offset to the first white space character or
+    // the next offset, whichever comes first.
+
+    const char *begin = d_text_p + d_next_p[0];
+    const char *end   = d_text_p + d_next_p[1];
+    const char *iter  = begin;
+    while (iter < end && ' '  != *iter
+                      && '\n' != *iter
+                      && '\t' != *iter
+                      && '\v' != *iter
+                      && '\r' != *iter) {
+        ++iter;
+    }
+    ++d_next_p;
+
+    const bsl::string_view value(begin, iter - begin);
+
+    if ("null" == value) {
+        BSLS_ASSERT(result->type() == JsonType::e_NULL);
+        return 0;                                                     // RETURN
+    }
+
+    if ("true" == value || "false" == value) {
+        result->makeBoolean("true" == value);
+        return 0;                                                     // RETURN
+    }
+
+    if (NumberUtil::isValidNumber(value)) {
+        result->makeNumber(JsonNumber(value));
+        return 0;                                                     // RETURN
+    }
+
+    return -1;
+}
+
+// ACCESSORS
+bool IndexedReader::atEnd() const
+{
+    return d_next_p == d_end_p;
+}
+
+bsl::string_view IndexedReader::stringContents() const
+{
+    BSLS_ASSERT('"' == peek());
+
+    return bsl::string_view(d_text_p + d_next_p[0] + 1,
+                            d_next_p[1] - d_next_p[0] - 1);
+}
+
+/// Load to the specified `result` the JSON document in the specified `input`
+/// according to the specified `options`, by way of a structural index of
+/// `input`.  Return 0 on success, and a non-zero value, with `result`
+/// unchanged, if `input` is not a valid JSON document.  The behavior is
+/// undefined if `options.allowTrailingText()` is `true`.  Note that no
+/// description of the error is produced on failure.
+int readIndexed(Json                    *result,
+                const bsl::string_view&  input,
+                const ReadOptions&       options)
+{
+    BSLS_ASSERT(!options.allowTrailingText());
+
+    // `StringUtil` does not verify that strings are UTF-8, so verify the
+    // whole of `input` up front.
+
+    if (!bdlde::Utf8Util::isValid(input)) {
+        return -1;                                                    // RETURN
+    }
+
+    StructuralIndex index;
+    if (0 != index.build(input)) {
+        return -1;                                                    // RETURN
+    }
+
+    IndexedReader reader(input, index);
+
+    Json json(result->allocator());
+    if (0 != reader.read(&json, options.maxNestedDepth()) ||
+        !reader.atEnd()) {
+        return -1;                                                    // RETURN
+    }
+
+    result->swap(json);
     return 0;
 }
 
@@ -687,69 +1009,131 @@ void writeDispatchFormatting(bsl::ostream&       output,
     }
 }
 
-}  // close namespace u
-}  // close unnamed namespace
-
-                              // ---------------
-                              // struct JsonUtil
-                              // ---------------
-
-// CLASS METHODS
-int JsonUtil::read(Json               *result,
-                   Error              *errorDescription,
-                   bsl::streambuf     *input,
-                   const ReadOptions&  options)
+/// Load to the specified `result` the JSON document read by the specified
+/// `tokenizer`, which must have been reset to its input, according to the
+/// specified `options`.  Return 0 on success, and a non-zero value
+/// otherwise, in which case the specified `errorDescription` is loaded with
+/// a description of the error, and `result` is unchanged.
+int readDocument(Json               *result,
+                 Error              *errorDescription,
+                 Tokenizer          *tokenizer,
+                 const ReadOptions&  options)
 {
-    BSLS_ASSERT(result);
-    BSLS_ASSERT(errorDescription);
-    BSLS_ASSERT(input);
-
     Error *error = errorDescription;
 
-    bdlma::LocalSequentialAllocator<8 * 1024> bsa;
-
-    Tokenizer tokenizer(&bsa);
-    tokenizer.setConformanceMode(Tokenizer::e_STRICT_20240119);
-    tokenizer.reset(input);
-
     // Advance from e_BEGIN
-    tokenizer.advanceToNextToken();
-    if (Tokenizer::e_ERROR == tokenizer.tokenType()) {
+    tokenizer->advanceToNextToken();
+    if (Tokenizer::e_ERROR == tokenizer->tokenType()) {
         u::setError(errorDescription,
-                    tokenizer,
+                    *tokenizer,
                     "Unexpected initial character");
         return -1;                                                    // RETURN
     }
 
     Json json(result->allocator());
     int  rc =
-        u::read(&json, errorDescription, &tokenizer, options.maxNestedDepth());
+        u::read(&json, errorDescription, tokenizer, options.maxNestedDepth());
     if (0 != rc) {
         return rc;                                                    // RETURN
     }
 
     if (!options.allowTrailingText()) {
-        rc = tokenizer.advanceToNextToken();
+        rc = tokenizer->advanceToNextToken();
         if (0 == rc) {
             // The tokenizer should report an error if there
             // 'advanceToNextToken' is advanced in an invalid state.
 
             u::setError(error,
-                        tokenizer,
+                        *tokenizer,
                         "Additional text found after document");
             return -1;                                                // RETURN
         }
-        else if (Tokenizer::k_EOF != tokenizer.readStatus()) {
+        else if (Tokenizer::k_EOF != tokenizer->readStatus()) {
             u::setError(error,
-                        tokenizer,
+                        *tokenizer,
                         "Additional text found after document");
             return -1;                                                // RETURN
         }
     }
-    tokenizer.resetStreamBufGetPointer();
+    tokenizer->resetStreamBufGetPointer();
     result->swap(json);
     return 0;
 }
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                              // ---------------
+                              // struct JsonUtil
+                              // ---------------
+
+// CLASS METHODS
+int JsonUtil::read(Json               *result,
+                   Error              *errorDescription,
+                   bsl::streambuf     *input,
+                   const ReadOptions&  options)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(errorDescription);
+    BSLS_ASSERT(input);
+
+    bdlma::LocalSequentialAllocator<8 * 1024> bsa;
+
+    Tokenizer tokenizer(&bsa);
+    tokenizer.setConformanceMode(Tokenizer::e_STRICT_20240119);
+
+    if (options.useStructuralIndex() && !options.allowTrailingText()) {
+        // The whole of `input` must be read to index it.  If it is not a
+        // valid document, read it again from memory to describe the error.
+
+        bsl::string text;
+        char        buffer[8 * 1024];
+        for (bsl::streamsize numRead;
+             0 < (numRead = input->sgetn(buffer, sizeof buffer));) {
+            text.append(buffer, static_cast<bsl::size_t>(numRead));
+        }
+
+        if (0 == u::readIndexed(result, text, options)) {
+            return 0;                                                 // RETURN
+        }
+
+        bdlsb::FixedMemInStreamBuf textBuf(text.data(), text.length());
+        tokenizer.reset(&textBuf);
+
+        return u::readDocument(result, errorDescription, &tokenizer, options);
+                                                                      // RETURN
+    }
+
+    tokenizer.reset(input);
+
+    return u::readDocument(result, errorDescription, &tokenizer, options);
+}
+
+int JsonUtil::read(Json                    *result,
+                   Error                   *errorDescription,
+                   const bsl::string_view&  input,
+                   const ReadOptions&       options)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(errorDescription);
+
+    if (options.useStructuralIndex() && !options.allowTrailingText() &&
+        0 == u::readIndexed(result, input, options)) {
+        return 0;                                                     // RETURN
+    }
+
+    bdlma::LocalSequentialAllocator<8 * 1024> bsa;
+
+    // Tokenize `input` in place, so that values not requiring unescaping are
+    // not copied before being loaded to `result`.
+
+    Tokenizer tokenizer(&bsa);
+    tokenizer.setConformanceMode(Tokenizer::e_STRICT_20240119);
+    tokenizer.reset(input);
+
+    return u::readDocument(result, errorDescription, &tokenizer, options);
+}
+
 bsl::ostream& JsonUtil::printError(bsl::ostream&   stream,
                                    bsl::streambuf *input,
                                    const Error&    error)
@@ -106,6 +106,18 @@ BSLS_IDENT("$Id: $")
 // +-----------+------------------------+-------------+-----------+
 // ```
 //
+///Reading Large Documents
+///-----------------------
+// If the `bdljsn::ReadOptions` attribute "useStructuralIndex" is `true` (and
+// "allowTrailingText" is `false`), `bdljsn::JsonUtil::read` first builds an
+// index of the structural characters of the input using vector instructions
+// where available (see `bdljsn_structuralindex`), and then constructs the
+// document by visiting only the indexed offsets.  If that fails, the input is
+// read again in the usual way, so that exactly the same documents are
+// accepted, and exactly the same errors are reported, whether or not the
+// option is set.  Note that, when reading from a `bsl::streambuf`, the whole
+// of the input is first copied into memory.
+//
 ///Usage
 ///-----
 // This section illustrates the intended use of this component.
@@ -556,16 +568,6 @@ int JsonUtil::read(Json           *result,
     return read(result, errorDescription, input, options);
 }
 
-inline
-int JsonUtil::read(Json                    *result,
-                   Error                   *errorDescription,
-                   const bsl::string_view&  input,
-                   const ReadOptions&       options)
-{
-    bdlsb::FixedMemInStreamBuf inputBuf(input.data(), input.size());
-    return read(result, errorDescription, &inputBuf, options);
-}
-
 inline
 int JsonUtil::read(Json                    *result,
                    Error                   *errorDescription,
@@ -36,6 +36,7 @@
 #include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>  // `bsl::size_t`
@@ -100,8 +101,10 @@ using bsl::ends;
 // [ 6] static ostream& printError(ostream&, string_view&, const Error&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ 7] CONCERN: JSON TEST SUITE COMPLIANCE
+// [ 8] CONCERN: `useStructuralIndex` DOES NOT CHANGE RESULTS
+// [-1] PERFORMANCE: `read` WITH `useStructuralIndex`
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -440,6 +443,19 @@ void checkResult(int                     line,
 
     int rc = Util::read(&json, &err, string, ro);
 
+    // Verify that reading by way of a structural index has the same result.
+
+    Json        indexedJson(&scratch);
+    Error       indexedErr(&scratch);
+    ReadOptions indexedRo;
+    indexedRo.setUseStructuralIndex(true);
+
+    int indexedRc = Util::read(&indexedJson, &indexedErr, string, indexedRo);
+
+    ASSERTV(line, string, rc, indexedRc, rc == indexedRc);
+    ASSERTV(line, string, err, indexedErr, err == indexedErr);
+    ASSERTV(line, string, json, indexedJson, json == indexedJson);
+
     if (0 == rc) {
         // Verify that success was expected.
         ASSERTV(line, string, isValid, isValid);
@@ -526,7 +542,8 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
 
         const int FUZZ_MAX_NESTED_DEPTH = 200;
 
-        bool allowTrailingTextFlag = bslim::FuzzUtil::consumeBool(&fdv);
+        bool allowTrailingTextFlag  = bslim::FuzzUtil::consumeBool(&fdv);
+        bool useStructuralIndexFlag = bslim::FuzzUtil::consumeBool(&fdv);
         int  maxNestedDepth        =
                            bslim::FuzzUtil::consumeNumberInRange<int>(
                                                         &fdv,
@@ -536,6 +553,7 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
         bdljsn::ReadOptions readOptions;
         readOptions.setAllowTrailingText(allowTrailingTextFlag);
         readOptions.setMaxNestedDepth(maxNestedDepth);
+        readOptions.setUseStructuralIndex(useStructuralIndexFlag);
 
         bslim::FuzzUtil::consumeRandomLengthString(&randomChars,
                                                    &fdv,
@@ -686,7 +704,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) {
-      case 8: { case 0:
+      case 9: { case 0:
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   First usage example extracted from component header file.
@@ -954,6 +972,182 @@ int main(int argc, char *argv[])
 #endif //  BSLS_COMPILERFEATURES_SUPPORT_RAW_STRINGS
         }
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING `useStructuralIndex`
+        //
+        // Concerns:
+        // 1. Setting the `useStructuralIndex` option does not change the
+        //    value returned by `read`, the error it reports, or the value it
+        //    loads, whether or not the input is a valid JSON document.
+        //
+        // 2. Concern 1 holds for input supplied by a `bsl::string_view` and
+        //    by a `bsl::streambuf`, and for any `maxNestedDepth`.
+        //
+        // 3. A successful `read` from a `bsl::streambuf` leaves it at the same
+        //    position whether or not the option is set.
+        //
+        // Plan:
+        // 1. Starting from a set of valid documents exercising every kind of
+        //    value, and a document long enough to be indexed in several
+        //    blocks, generate a large number of pseudo-random variants by
+        //    inserting, deleting, and replacing characters at random
+        //    positions, drawing from an alphabet in which structural
+        //    characters, quotes, backslashes, white space, and the characters
+        //    of literals and numbers are over-represented.
+        //
+        // 2. Read each variant, with several values of `maxNestedDepth`, from
+        //    a `bsl::string_view` and from a `bdlsb::FixedMemInStreamBuf`,
+        //    with and without the option set, and verify that the results are
+        //    the same.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: `useStructuralIndex` DOES NOT CHANGE RESULTS
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "TESTING `useStructuralIndex`" << endl
+                 << "============================" << endl;
+
+        static const char *const DOCUMENTS[] = {
+            "null",
+            " true ",
+            "-12.5e-3",
+            "\"a\\\"b\\\\c\\u00e9\\ud83d\\ude00\xc3\xa9\"",
+            "[]",
+            "{}",
+            "[1, [2, [3, [4]]], {\"a\": {\"b\": {}}}]",
+            "{\"k\": 1, \"k\": 2, \"\\\"\": [true, false, null]}",
+            "\v\t\r\n{ \"x\" : \"y\" , \"z\" : [ 0 , -0.0 , 1E+2 ] }\n",
+            "[\"\\/\\b\\f\\n\\r\\t\", \"\x7f\","
+                " 123456789012345678901234567890]",
+        };
+        const int NUM_DOCUMENTS = sizeof DOCUMENTS / sizeof *DOCUMENTS;
+
+        static const char ALPHABET[] = "{}[]:,\"\"\"\\\\ \t\n\v\f\r"
+                                       "0-1.eE+truefalsn\x01\x7f\xc3\xa9\xff";
+        const int         ALPHABET_SIZE = sizeof ALPHABET - 1;
+
+        bsl::string longDocument("[");
+        for (int i = 0; i < 40; ++i) {
+            longDocument += i ? ", " : "";
+            longDocument += "{\"id\": 1234, \"name\": \"\\\"quoted\\\"\","
+                            " \"ok\": true, \"list\": [1.5, null, \"s\"]}";
+        }
+        longDocument += "]";
+
+        static const int DEPTHS[] = { 1, 2, 3, 64 };
+        const int        NUM_DEPTHS = sizeof DEPTHS / sizeof *DEPTHS;
+
+        unsigned seed     = 1;
+        int      numValid = 0;
+
+        for (int ti = 0; ti < 20000; ++ti) {
+            const int   DOCUMENT = ti % (NUM_DOCUMENTS + 1);
+            bsl::string text     = NUM_DOCUMENTS == DOCUMENT
+                                 ? longDocument
+                                 : bsl::string(DOCUMENTS[DOCUMENT]);
+
+            seed = seed * 1103515245 + 12345;
+            const int NUM_MUTATIONS = (seed >> 16) % 4;
+
+            for (int mi = 0; mi < NUM_MUTATIONS; ++mi) {
+                seed = seed * 1103515245 + 12345;
+                const bsl::size_t POSITION = (seed >> 8) % (text.length() + 1);
+                seed = seed * 1103515245 + 12345;
+                const char        CHAR     = ALPHABET[(seed >> 16) %
+                                                               ALPHABET_SIZE];
+
+                switch ((seed >> 8) % 3) {
+                  case 0: {
+                    text.insert(POSITION, 1, CHAR);
+                  } break;
+                  case 1: {
+                    if (POSITION < text.length()) {
+                        text.erase(POSITION, 1);
+                    }
+                  } break;
+                  default: {
+                    if (POSITION < text.length()) {
+                        text[POSITION] = CHAR;
+                    }
+                  } break;
+                }
+            }
+
+            for (int di = 0; di < NUM_DEPTHS; ++di) {
+                const int DEPTH = DEPTHS[di];
+
+                if (veryVeryVerbose) { T_ P_(ti) P_(DEPTH) P(text) }
+
+                ReadOptions options;
+                options.setMaxNestedDepth(DEPTH);
+
+                ReadOptions indexedOptions(options);
+                indexedOptions.setUseStructuralIndex(true);
+
+                {
+                    Json  result;
+                    Error error;
+                    Json  indexedResult;
+                    Error indexedError;
+
+                    const int rc        = Util::read(&result,
+                                                     &error,
+                                                     text,
+                                                     options);
+                    const int indexedRc = Util::read(&indexedResult,
+                                                     &indexedError,
+                                                     text,
+                                                     indexedOptions);
+
+                    ASSERTV(ti, DEPTH, text, rc, indexedRc, rc == indexedRc);
+                    ASSERTV(ti, DEPTH, text, error, indexedError,
+                            error == indexedError);
+                    ASSERTV(ti, DEPTH, text, result == indexedResult);
+
+                    numValid += 0 == rc;
+                }
+
+                {
+                    bdlsb::FixedMemInStreamBuf input(text.data(),
+                                                     text.length());
+                    bdlsb::FixedMemInStreamBuf indexedInput(text.data(),
+                                                            text.length());
+
+                    Json  result;
+                    Error error;
+                    Json  indexedResult;
+                    Error indexedError;
+
+                    const int rc        = Util::read(&result,
+                                                     &error,
+                                                     &input,
+                                                     options);
+                    const int indexedRc = Util::read(&indexedResult,
+                                                     &indexedError,
+                                                     &indexedInput,
+                                                     indexedOptions);
+
+                    ASSERTV(ti, DEPTH, text, rc, indexedRc, rc == indexedRc);
+                    ASSERTV(ti, DEPTH, text, error, indexedError,
+                            error == indexedError);
+                    ASSERTV(ti, DEPTH, text, result == indexedResult);
+
+                    if (0 == rc) {
+                        ASSERTV(ti, DEPTH, text,
+                                input.pubseekoff(0, bsl::ios_base::cur) ==
+                                indexedInput.pubseekoff(0,
+                                                        bsl::ios_base::cur));
+                    }
+                }
+            }
+        }
+
+        if (verbose) P(numValid);
+        ASSERT(1000 < numValid);
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING JSON TEST SUITE COMPLIANCE
@@ -975,6 +1169,10 @@ int main(int argc, char *argv[])
         //    `errorMessage` (empty or not) match the expectations of the
         //    `d_isValid` member.
         //
+        // 4. Repeat P-2 with the `useStructuralIndex` option set, and confirm
+        //    that the returned value, the error, and the result are those of
+        //    P-2.
+        //
         // Testing:
         //   CONCERN: JSON TEST SUITE COMPLIANCE
         // --------------------------------------------------------------------
@@ -1031,6 +1229,21 @@ int main(int argc, char *argv[])
             ||  (JTSU::e_ACCEPT == EXPECTED) != (0       == rc   ) ) {
                 P(error);
             }
+
+            ReadOptions options;
+            options.setUseStructuralIndex(true);
+
+            Json  indexedResult;
+            Error indexedError;
+
+            int indexedRc = Util::read(&indexedResult,
+                                       &indexedError,
+                                       input,
+                                       options);
+
+            ASSERTV(LINE, rc, indexedRc, rc == indexedRc);
+            ASSERTV(LINE, error, indexedError, error == indexedError);
+            ASSERTV(LINE, result == indexedResult);
         }
       } break;
       case 6: {
@@ -4314,6 +4527,58 @@ int main(int argc, char *argv[])
                     location == result.location().offset());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `read` WITH `useStructuralIndex`
+        //
+        // Concerns:
+        // 1. Report the time taken to read a large document with and without
+        //    the `useStructuralIndex` option set.
+        //
+        // Plan:
+        // 1. Build a JSON document of about 16MB having objects, arrays,
+        //    strings, numbers, and literals, and time repeated reads of it
+        //    from a `bsl::string_view` with and without the option set.
+        //
+        // Testing:
+        //   PERFORMANCE: `read` WITH `useStructuralIndex`
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "PERFORMANCE: `read` WITH `useStructuralIndex`" << endl
+                 << "=============================================" << endl;
+
+        enum { k_SIZE = 16 << 20, k_REPS = 5 };
+
+        bsl::string document("[\n");
+        while (document.length() < k_SIZE) {
+            document += "  {\"id\": 12345, \"name\": \"Some Name\","
+                        " \"active\": true, \"ratio\": -1.5e3,"
+                        " \"tags\": [\"a\", \"b\\\"c\"], \"parent\": null},\n";
+        }
+        document += "  {}\n]\n";
+
+        const double MB = static_cast<double>(document.length()) * k_REPS /
+                                                                    (1 << 20);
+
+        for (int useIndex = 0; useIndex < 2; ++useIndex) {
+            ReadOptions options;
+            options.setUseStructuralIndex(useIndex);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int rep = 0; rep < k_REPS; ++rep) {
+                Json  result;
+                Error error;
+                ASSERT(0 == Util::read(&result, &error, document, options));
+            }
+            timer.stop();
+
+            cout << "useStructuralIndex = " << useIndex << ": "
+                 << MB / timer.elapsedTime() << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
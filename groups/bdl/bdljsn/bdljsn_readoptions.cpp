@@ -16,19 +16,22 @@ namespace bdljsn {
 // CONSTANTS
 const bool ReadOptions::s_DEFAULT_INITIALIZER_ALLOW_TRAILING_TEXT = false;
 const int  ReadOptions::s_DEFAULT_INITIALIZER_MAX_NESTED_DEPTH    = 64;
+const bool ReadOptions::s_DEFAULT_INITIALIZER_USE_STRUCTURAL_INDEX = false;
 
 // CREATORS
 ReadOptions::ReadOptions()
-: d_allowTrailingText(s_DEFAULT_INITIALIZER_ALLOW_TRAILING_TEXT)
-, d_maxNestedDepth   (s_DEFAULT_INITIALIZER_MAX_NESTED_DEPTH)
+: d_allowTrailingText (s_DEFAULT_INITIALIZER_ALLOW_TRAILING_TEXT)
+, d_maxNestedDepth    (s_DEFAULT_INITIALIZER_MAX_NESTED_DEPTH)
+, d_useStructuralIndex(s_DEFAULT_INITIALIZER_USE_STRUCTURAL_INDEX)
 {
 }
 
 // MANIPULATORS
 ReadOptions& ReadOptions::reset()
 {
-    d_allowTrailingText = s_DEFAULT_INITIALIZER_ALLOW_TRAILING_TEXT;
-    d_maxNestedDepth    = s_DEFAULT_INITIALIZER_MAX_NESTED_DEPTH;
+    d_allowTrailingText  = s_DEFAULT_INITIALIZER_ALLOW_TRAILING_TEXT;
+    d_maxNestedDepth     = s_DEFAULT_INITIALIZER_MAX_NESTED_DEPTH;
+    d_useStructuralIndex = s_DEFAULT_INITIALIZER_USE_STRUCTURAL_INDEX;
     return *this;
 }
 
@@ -42,8 +45,9 @@ bsl::ostream& ReadOptions::print(bsl::ostream& stream,
 {
     bslim::Printer printer(&stream, level, spacesPerLevel);
     printer.start();
-    printer.printAttribute("allowTrailingText", d_allowTrailingText);
-    printer.printAttribute("maxNestedDepth",    d_maxNestedDepth);
+    printer.printAttribute("allowTrailingText",  d_allowTrailingText);
+    printer.printAttribute("maxNestedDepth",     d_maxNestedDepth);
+    printer.printAttribute("useStructuralIndex", d_useStructuralIndex);
     printer.end();
     return stream;
 }
@@ -23,6 +23,7 @@ BSLS_IDENT("$Id: $")
 // ------------------  -----------    -------         ------------------
 // maxNestedDepth      int            64              > 0
 // allowTrailingText   bool           false
+// useStructuralIndex  bool           false
 // ```
 // * `maxNestedDepth`: the maximum depth to which JSON objects and arrays are
 //   allowed to be nested before the JSON decoder reports an error.  For
@@ -37,6 +38,15 @@ BSLS_IDENT("$Id: $")
 //   set to `true` a `read` operation will return success if there is text
 //   following a valid JSON document, assuming that text is separated by
 //   a delimeter.  See {`bdljsn_jsonutil`} for details.
+// * `useStructuralIndex`: whether a read operation will first build an index
+//   of the structural characters of the input (see
+//   `bdljsn_structuralindex`) and then construct the document by visiting
+//   only the indexed offsets.  This option does not change the documents that
+//   are accepted, or the errors that are reported, by a read operation, but
+//   typically makes reading large documents substantially faster.  Note that
+//   a read operation from a `bsl::streambuf` must first copy all of the input
+//   into memory when this option is set.  This option has no effect if
+//   `allowTrailingText` is `true`.
 //
 ///Usage
 ///-----
@@ -55,6 +65,7 @@ BSLS_IDENT("$Id: $")
 // bdljsn::ReadOptions options;
 // assert(64    == options.maxNestedDepth());
 // assert(false == options.allowTrailingText());
+// assert(false == options.useStructuralIndex());
 // ```
 // Finally, we populate that object to limit the maximum nested depth using a
 // pre-defined limit:
@@ -90,10 +101,14 @@ class ReadOptions {
     // maximum nesting level for JSON objects and arrays
     int d_maxNestedDepth;
 
+    // whether to read using an index of the structural characters
+    bool d_useStructuralIndex;
+
   public:
     // CONSTANTS
     static const bool s_DEFAULT_INITIALIZER_ALLOW_TRAILING_TEXT;
     static const int  s_DEFAULT_INITIALIZER_MAX_NESTED_DEPTH;
+    static const bool s_DEFAULT_INITIALIZER_USE_STRUCTURAL_INDEX;
 
   public:
     // CREATORS
@@ -103,6 +118,7 @@ class ReadOptions {
     /// ```
     /// setAllowTrailingText() == false
     /// maxNestedDepth()       == 64
+    /// useStructuralIndex()   == false
     /// ```
     ReadOptions();
 
@@ -132,6 +148,10 @@ class ReadOptions {
     /// behavior is undefined unless `0 < value`.
     ReadOptions& setMaxNestedDepth(int value);
 
+    /// Set the `useStructuralIndex` attribute of this object to the
+    /// specified `value` and return a non-`const` reference to this object.
+    ReadOptions& setUseStructuralIndex(bool value);
+
     // ACCESSORS
 
     /// Return the `allowTrailingText` attribute of this object.
@@ -140,6 +160,9 @@ class ReadOptions {
     /// Return the `maxNestedDepth` attribute of this object.
     int maxNestedDepth() const;
 
+    /// Return the `useStructuralIndex` attribute of this object.
+    bool useStructuralIndex() const;
+
                                   // Aspects
 
     /// Format this object to the specified output `stream` at the optionally
@@ -188,8 +211,9 @@ bsl::ostream& operator<<(bsl::ostream& stream, const ReadOptions& rhs);
 // CREATORS
 inline
 ReadOptions::ReadOptions(const ReadOptions& original)
-: d_allowTrailingText(original.d_allowTrailingText)
-, d_maxNestedDepth   (original.d_maxNestedDepth)
+: d_allowTrailingText (original.d_allowTrailingText)
+, d_maxNestedDepth    (original.d_maxNestedDepth)
+, d_useStructuralIndex(original.d_useStructuralIndex)
 {
 }
 
@@ -203,8 +227,9 @@ ReadOptions::~ReadOptions()
 inline
 ReadOptions& ReadOptions::operator=(const ReadOptions& rhs)
 {
-    d_allowTrailingText = rhs.d_allowTrailingText;
-    d_maxNestedDepth    = rhs.d_maxNestedDepth;
+    d_allowTrailingText  = rhs.d_allowTrailingText;
+    d_maxNestedDepth     = rhs.d_maxNestedDepth;
+    d_useStructuralIndex = rhs.d_useStructuralIndex;
 
     return *this;
 }
@@ -225,6 +250,13 @@ ReadOptions& ReadOptions::setMaxNestedDepth(int value)
     return *this;
 }
 
+inline
+ReadOptions& ReadOptions::setUseStructuralIndex(bool value)
+{
+    d_useStructuralIndex = value;
+    return *this;
+}
+
 // ACCESSORS
 inline
 bool ReadOptions::allowTrailingText() const
@@ -238,6 +270,12 @@ int ReadOptions::maxNestedDepth() const
     return d_maxNestedDepth;
 }
 
+inline
+bool ReadOptions::useStructuralIndex() const
+{
+    return d_useStructuralIndex;
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -245,16 +283,18 @@ inline
 bool bdljsn::operator==(const bdljsn::ReadOptions& lhs,
                         const bdljsn::ReadOptions& rhs)
 {
-    return lhs.maxNestedDepth()    == rhs.maxNestedDepth()
-        && lhs.allowTrailingText() == rhs.allowTrailingText();
+    return lhs.maxNestedDepth()     == rhs.maxNestedDepth()
+        && lhs.allowTrailingText()  == rhs.allowTrailingText()
+        && lhs.useStructuralIndex() == rhs.useStructuralIndex();
 }
 
 inline
 bool bdljsn::operator!=(const bdljsn::ReadOptions& lhs,
                         const bdljsn::ReadOptions& rhs)
 {
-    return lhs.maxNestedDepth()    != rhs.maxNestedDepth()
-        || lhs.allowTrailingText() != rhs.allowTrailingText();
+    return lhs.maxNestedDepth()     != rhs.maxNestedDepth()
+        || lhs.allowTrailingText()  != rhs.allowTrailingText()
+        || lhs.useStructuralIndex() != rhs.useStructuralIndex();
 }
 
 inline
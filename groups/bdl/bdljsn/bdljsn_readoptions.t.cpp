@@ -35,10 +35,12 @@ using namespace bsl;
 // Primary Manipulator:
 //  - `setAllowTrailingText`
 //  - `setMaxNestedDepth`
+//  - `setUseStructuralIndex`
 //
 // Basic Accessor:
 //  - `allowTrailingText`
 //  - `maxNestedDepth`
+//  - `useStructuralIndex`
 //
 // Certain standard value-semantic-type test cases are omitted:
 //  - [ 8] -- `swap` is not implemented for this class.
@@ -65,10 +67,12 @@ using namespace bsl;
 // [ 3] ReadOptions& reset();
 // [ 3] ReadOptions& setAllowTrailingText(bool value);
 // [ 3] ReadOptions& setMaxNestedDepth(int value);
+// [ 3] ReadOptions& setUseStructuralIndex(bool value);
 //
 // ACCESSORS
 // [ 4] bool allowTrailingText() const;
 // [ 4] int maxNestedDepth() const;
+// [ 4] bool useStructuralIndex() const;
 // [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
 //
 // FREE OPERATORS
@@ -161,23 +165,26 @@ struct DefaultDataRow {
     int  d_line;                // source line number
     int  d_maxNestedDepth;
     bool d_allowTrailingText;
+    bool d_useStructuralIndex;
 };
 
 static
 const DefaultDataRow DEFAULT_DATA[] =
 {
 
-//LINE  MAXND   ATT
-//----  -----   ---
+//LINE  MAXND   ATT    USI
+//----  -----   ---    ---
 
 // default (must be first)
-{ L_,      64, false },
+{ L_,      64, false, false },
 
 //
-{ L_,       1 , false },
-{ L_, INT_MAX , false },
-{ L_,       5 ,  true },
-{ L_, INT_MAX ,  true },
+{ L_,       1 , false, false },
+{ L_, INT_MAX , false, false },
+{ L_,       5 ,  true, false },
+{ L_, INT_MAX ,  true, false },
+{ L_,      64 , false,  true },
+{ L_,       5 ,  true,  true },
 
 };
 
@@ -245,6 +252,7 @@ int main(int argc, char *argv[])
     bdljsn::ReadOptions options;
     ASSERT(64    == options.maxNestedDepth());
     ASSERT(false == options.allowTrailingText());
+    ASSERT(false == options.useStructuralIndex());
 // ```
 // Finally, we populate that object to limit the maximum nested depth using a
 // pre-defined limit:
@@ -362,14 +370,17 @@ int main(int argc, char *argv[])
             const int   LINE1  = DATA[ti].d_line;
             const int   DEPTH1 = DATA[ti].d_maxNestedDepth;
             const bool  ATT1   = DATA[ti].d_allowTrailingText;
+            const bool  USI1   = DATA[ti].d_useStructuralIndex;
 
             Obj mZ;  const Obj& Z = mZ;
             mZ.setMaxNestedDepth(DEPTH1);
             mZ.setAllowTrailingText(ATT1);
+            mZ.setUseStructuralIndex(USI1);
 
             Obj mZZ;  const Obj& ZZ = mZZ;
             mZZ.setMaxNestedDepth(DEPTH1);
             mZZ.setAllowTrailingText(ATT1);
+            mZZ.setUseStructuralIndex(USI1);
 
             if (veryVerbose) { T_ P_(LINE1) P_(Z) P(ZZ) }
 
@@ -386,10 +397,12 @@ int main(int argc, char *argv[])
                 const int   LINE2   = DATA[tj].d_line;
                 const int   DEPTH2  = DATA[tj].d_maxNestedDepth;
                 const bool  ATT2    = DATA[tj].d_allowTrailingText;
+                const bool  USI2    = DATA[tj].d_useStructuralIndex;
 
                 Obj mX;  const Obj& X = mX;
                 mX.setMaxNestedDepth(DEPTH2);
                 mX.setAllowTrailingText(ATT2);
+                mX.setUseStructuralIndex(USI2);
 
                 if (veryVerbose) { T_ P_(LINE2) P(X) }
 
@@ -408,10 +421,12 @@ int main(int argc, char *argv[])
                 Obj mX;
                 mX.setMaxNestedDepth(DEPTH1);
                 mX.setAllowTrailingText(ATT1);
+                mX.setUseStructuralIndex(USI1);
 
                 Obj mZZ;  const Obj& ZZ = mZZ;
                 mZZ.setMaxNestedDepth(DEPTH1);
                 mZZ.setAllowTrailingText(ATT1);
+                mZZ.setUseStructuralIndex(USI1);
 
                 const Obj& Z = mX;
 
@@ -500,12 +515,18 @@ int main(int argc, char *argv[])
         for (int ti = 0; ti < NUM_DATA; ++ti) {
             const int   LINE    = DATA[ti].d_line;
             const int   DEPTH   = DATA[ti].d_maxNestedDepth;
+            const bool  ATT     = DATA[ti].d_allowTrailingText;
+            const bool  USI     = DATA[ti].d_useStructuralIndex;
 
             Obj mZ;  const Obj& Z = mZ;
             mZ.setMaxNestedDepth(DEPTH);
+            mZ.setAllowTrailingText(ATT);
+            mZ.setUseStructuralIndex(USI);
 
             Obj mZZ;  const Obj& ZZ = mZZ;
             mZZ.setMaxNestedDepth(DEPTH);
+            mZZ.setAllowTrailingText(ATT);
+            mZZ.setUseStructuralIndex(USI);
 
             if (veryVerbose) { T_ P_(Z) P(ZZ) }
 
@@ -631,6 +652,7 @@ int main(int argc, char *argv[])
 
         typedef int   T1;        // `maxNestedDepth`
         typedef bool  T2;        // `allowTrailingText`
+        typedef bool  T3;        // `useStructuralIndex`
 
                  // ------------------------------------
                  // Attribute 1 Values: `maxNestedDepth`
@@ -646,6 +668,13 @@ int main(int argc, char *argv[])
         const T2 A2 = false;            // baseline
         const T2 B2 = true;
 
+                 // ----------------------------------------
+                 // Attribute 3 Values: `useStructuralIndex`
+                 // ----------------------------------------
+
+        const T3 A3 = false;            // baseline
+        const T3 B3 = true;
+
         if (verbose) cout <<
             "\nCreate a table of distinct, but similar object values." << endl;
 
@@ -653,6 +682,7 @@ int main(int argc, char *argv[])
             int   d_line;        // source line number
             int   d_maxNestedDepth;
             bool  d_allowTrailingText;
+            bool  d_useStructuralIndex;
         } DATA[] = {
 
         // The first row of the table below represents an object value
@@ -663,10 +693,12 @@ int main(int argc, char *argv[])
        //LINE  MAXND
        //----  -----
 
-        { L_,    A1, A2 }, // baseline
-        { L_,    B1, A2 },
-        { L_,    A1, B2 },
-        { L_,    B1, B2 },
+        { L_,    A1, A2, A3 }, // baseline
+        { L_,    B1, A2, A3 },
+        { L_,    A1, B2, A3 },
+        { L_,    A1, A2, B3 },
+        { L_,    B1, B2, A3 },
+        { L_,    B1, B2, B3 },
 
         };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
@@ -677,8 +709,9 @@ int main(int argc, char *argv[])
             const int   LINE1    = DATA[ti].d_line;
             const int   DEPTH1   = DATA[ti].d_maxNestedDepth;
             const bool  ATT1     = DATA[ti].d_allowTrailingText;
+            const bool  USI1     = DATA[ti].d_useStructuralIndex;
             if (veryVerbose) {
-                T_ P_(LINE1) P_(ATT1) P(DEPTH1)
+                T_ P_(LINE1) P_(ATT1) P_(USI1) P(DEPTH1)
             }
 
             // Ensure an object compares correctly with itself (alias test).
@@ -687,6 +720,7 @@ int main(int argc, char *argv[])
 
                 mX.setMaxNestedDepth(DEPTH1);
                 mX.setAllowTrailingText(ATT1);
+                mX.setUseStructuralIndex(USI1);
 
                 ASSERTV(LINE1, X,   X == X);
                 ASSERTV(LINE1, X, !(X != X));
@@ -696,9 +730,10 @@ int main(int argc, char *argv[])
                 const int   LINE2   = DATA[tj].d_line;
                 const int   DEPTH2  = DATA[tj].d_maxNestedDepth;
                 const int   ATT2    = DATA[tj].d_allowTrailingText;
+                const bool  USI2    = DATA[tj].d_useStructuralIndex;
 
                 if (veryVerbose) {
-                    T_ P_(LINE1) P_(ATT2) P(DEPTH2)
+                    T_ P_(LINE1) P_(ATT2) P_(USI2) P(DEPTH2)
                 }
 
                 const bool EXP = ti == tj;  // expected for equality comparison
@@ -708,9 +743,11 @@ int main(int argc, char *argv[])
 
                 mX.setMaxNestedDepth(DEPTH1);
                 mX.setAllowTrailingText(ATT1);
+                mX.setUseStructuralIndex(USI1);
 
                 mY.setMaxNestedDepth(DEPTH2);
                 mY.setAllowTrailingText(ATT2);
+                mY.setUseStructuralIndex(USI2);
 
                 if (veryVerbose) { T_ T_ T_ P_(EXP) P_(X) P(Y) }
 
@@ -815,6 +852,7 @@ int main(int argc, char *argv[])
             int         d_spl;
             int         d_maxNestedDepth;
             bool        d_allowTrailingText;
+            bool        d_useStructuralIndex;
 
             const char *d_expected_p;
         } DATA[] = {
@@ -826,25 +864,28 @@ int main(int argc, char *argv[])
    // P-2.1.1: { A } x { 0 } x { 0, 1, -1 } --> 3 expected outputs
    // ------------------------------------------------------------------
 
-        //----  -  ---  -----  ---      ---
-        //LINE  L  SPL  MAXND  ATT      EXP
-        //----  -  ---  -----  ---      ---
+        //----  --  --  --  -----  -----  ---
+        //LINE   L SPL  ND  ATT    USI    EXP
+        //----  --  --  --  -----  -----  ---
 
-        { L_,  0,  0,      64, false,   "["                                  NL
+        { L_,  0,  0, 64, false, false, "["                                  NL
                                         "allowTrailingText = false"          NL
                                         "maxNestedDepth = 64"                NL
+                                        "useStructuralIndex = false"         NL
                                         "]"                                  NL
                                                                              },
 
-        { L_,  0,  1,      89, true,    "["                                  NL
+        { L_,  0,  1, 89, true,  true,  "["                                  NL
                                         " allowTrailingText = true"          NL
                                         " maxNestedDepth = 89"               NL
+                                        " useStructuralIndex = true"         NL
                                         "]"                                  NL
                                                                              },
 
-        { L_,  0,  -1,     89, true,    "["                                  SP
+        { L_,  0, -1, 89, true,  true,  "["                                  SP
                                         "allowTrailingText = true"           SP
                                         "maxNestedDepth = 89"                SP
+                                        "useStructuralIndex = true"          SP
                                         "]"
                                                                              },
 
@@ -852,42 +893,48 @@ int main(int argc, char *argv[])
        // P-2.1.2: { A } x { 3, -3 } x { 0, 2, -2 }  -->  6 expected outputs
        // ------------------------------------------------------------------
 
-        //LINE  L  SPL  MAXND  ATT      EXP
-        //----  -  ---  -----  ---      ---
-        { L_,  3,   0,    89,  true,    "["                                  NL
+        //LINE   L SPL  ND  ATT    USI    EXP
+        //----  --  --  --  -----  -----  ---
+        { L_,  3,  0, 89, true,  true,  "["                                  NL
                                         "allowTrailingText = true"           NL
                                         "maxNestedDepth = 89"                NL
+                                        "useStructuralIndex = true"          NL
                                         "]"                                  NL
                                                                              },
 
-        { L_,  3,   2,    89, true,     "      ["                            NL
+        { L_,  3,  2, 89, true,  true,  "      ["                            NL
                                         "        allowTrailingText = true"   NL
                                         "        maxNestedDepth = 89"        NL
+                                        "        useStructuralIndex = true"  NL
                                         "      ]"                            NL
 
                                                                              },
 
-        { L_,  3,  -2,    89,  true,    "      ["                            SP
+        { L_,  3, -2, 89, true,  true,  "      ["                            SP
                                         "allowTrailingText = true"           SP
                                         "maxNestedDepth = 89"                SP
+                                        "useStructuralIndex = true"          SP
                                         "]"
                                                                              },
 
-        { L_, -3,   0,    89,  true,    "["                                  NL
+        { L_, -3,  0, 89, true,  true,  "["                                  NL
                                         "allowTrailingText = true"           NL
                                         "maxNestedDepth = 89"                NL
+                                        "useStructuralIndex = true"          NL
                                         "]"                                  NL
                                                                              },
 
-        { L_, -3,   2,    89,  true,    "["                                  NL
+        { L_, -3,  2, 89, true,  true,  "["                                  NL
                                         "        allowTrailingText = true"   NL
                                         "        maxNestedDepth = 89"        NL
+                                        "        useStructuralIndex = true"  NL
                                         "      ]"                            NL
                                                                              },
 
-        { L_, -3,  -2,    89,  true,   "["                                   SP
+        { L_, -3, -2, 89, true,  true,  "["                                  SP
                                        "allowTrailingText = true"            SP
                                        "maxNestedDepth = 89"                 SP
+                                       "useStructuralIndex = true"           SP
                                        "]"
                                                                              },
 
@@ -895,12 +942,13 @@ int main(int argc, char *argv[])
        // P-2.1.3: { B } x { 2 }     x { 3 }         -->  1 expected output
        // -----------------------------------------------------------------
 
-        //LINE  L  SPL  MAXND  ATT      EXP
-        //----  -  ---  -----  ---      ---
+        //LINE   L SPL  ND  ATT    USI    EXP
+        //----  --  --  --  -----  -----  ---
 
-        { L_,  2,   3,     89, true,    "      ["                            NL
+        { L_,  2,  3, 89, true,  true,  "      ["                            NL
                                         "         allowTrailingText = true"  NL
                                         "         maxNestedDepth = 89"       NL
+                                        "         useStructuralIndex = true" NL
                                         "      ]"                            NL
                                                                              },
 
@@ -908,18 +956,20 @@ int main(int argc, char *argv[])
         // P-2.1.4: { A B } x { -9 }   x { -9 }      -->  2 expected outputs
         // -----------------------------------------------------------------
 
-        //LINE  L  SPL  MAXND  ATT      EXP
-        //----  -  ---  -----  ---      ---
+        //LINE   L SPL  ND  ATT    USI    EXP
+        //----  --  --  --  -----  -----  ---
 
-        { L_, -9,  -9,    89,  true,    "["                                  SP
+        { L_, -9, -9, 89, true,  true,  "["                                  SP
                                         "allowTrailingText = true"           SP
                                         "maxNestedDepth = 89"                SP
+                                        "useStructuralIndex = true"          SP
                                         "]"
                                                                              },
 
-        { L_, -9,  -9,     7,  false,   "["                                  SP
+        { L_, -9, -9,  7, false, false, "["                                  SP
                                         "allowTrailingText = false"          SP
                                         "maxNestedDepth = 7"                 SP
+                                        "useStructuralIndex = false"         SP
                                         "]"
                                                                              }
 #undef NL
@@ -938,6 +988,7 @@ int main(int argc, char *argv[])
 
                 const int   MAXND    = DATA[ti].d_maxNestedDepth;
                 const bool  ATT      = DATA[ti].d_allowTrailingText;
+                const bool  USI      = DATA[ti].d_useStructuralIndex;
 
                 const char *const EXP    = DATA[ti].d_expected_p;
 
@@ -948,6 +999,7 @@ int main(int argc, char *argv[])
                 Obj mX;  const Obj& X = mX;
                 mX.setMaxNestedDepth(MAXND);
                 mX.setAllowTrailingText(ATT);
+                mX.setUseStructuralIndex(USI);
 
                 ostringstream os;
 
@@ -1004,6 +1056,7 @@ int main(int argc, char *argv[])
         // Testing:
         //   int maxNestedDepth() const;
         //   bool allowTrailingText() const;
+        //   bool useStructuralIndex() const;
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -1014,6 +1067,7 @@ int main(int argc, char *argv[])
 
         typedef int   T1;        // `maxNestedDepth`
         typedef bool  T2;        // `allowTrailingText`
+        typedef bool  T3;        // `useStructuralIndex`
 
         if (verbose) cout << "\nEstablish suitable attribute values." << endl;
 
@@ -1023,6 +1077,7 @@ int main(int argc, char *argv[])
 
         const int   D1   = 64;                   // `maxNestedDepth`
         const int   D2   = false;                // `allowTrailingText`
+        const bool  D3   = false;                // `useStructuralIndex`
 
                         // ----------------------------
                         // `A` values: Boundary values.
@@ -1030,6 +1085,7 @@ int main(int argc, char *argv[])
 
         const int   A1   = INT_MAX;              // `maxNestedDepth`
         const int   A2   = true;                 // `allowTrailingText`
+        const bool  A3   = true;                 // `useStructuralIndex`
 
         if (verbose) cout << "\nCreate an object." << endl;
 
@@ -1044,6 +1100,10 @@ int main(int argc, char *argv[])
             const T2& initialAllowTrailingText = X.allowTrailingText();
             ASSERTV(D2, initialAllowTrailingText,
                     D2 == initialAllowTrailingText);
+
+            const T3& initialUseStructuralIndex = X.useStructuralIndex();
+            ASSERTV(D3, initialUseStructuralIndex,
+                    D3 == initialUseStructuralIndex);
         }
 
         if (verbose) cout <<
@@ -1060,6 +1120,9 @@ int main(int argc, char *argv[])
             const T2& allowTrailingText = X.allowTrailingText();
             ASSERTV(A2, allowTrailingText, A2 == allowTrailingText);
 
+            mX.setUseStructuralIndex(A3);
+            const T3& useStructuralIndex = X.useStructuralIndex();
+            ASSERTV(A3, useStructuralIndex, A3 == useStructuralIndex);
         }
       } break;
       case 3: {
@@ -1118,6 +1181,7 @@ int main(int argc, char *argv[])
         //   ReadOptions& reset();
         //   ReadOptions& setMaxNestedDepth(int value);
         //   ReadOptions& setAllowTrailingText(bool value);
+        //   ReadOptions& setUseStructuralIndex(bool value);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -1129,10 +1193,12 @@ int main(int argc, char *argv[])
         // `D` values.
         const int  D1 = 64;      // `maxNestedDepth`
         const bool D2 = false;   // `allowTrailingText`
+        const bool D3 = false;   // `useStructuralIndex`
 
         // `A` values.
         const int   A1   = 1;    // `maxNestedDepth`
         const bool  A2   = true; // `allowTrailingText`
+        const bool  A3   = true; // `useStructuralIndex`
 
         Obj                 mX;
         const Obj&          X = mX;
@@ -1149,6 +1215,7 @@ int main(int argc, char *argv[])
             mX.setMaxNestedDepth(A1);                                   // TEST
             ASSERT(A1 == X.maxNestedDepth());
             ASSERT(D2 == X.allowTrailingText());
+            ASSERT(D3 == X.useStructuralIndex());
 
             mX.reset();                                                 // TEST
             ASSERT(X  == defaultObj);
@@ -1160,6 +1227,19 @@ int main(int argc, char *argv[])
             mX.setAllowTrailingText(A2);
             ASSERT(D1 == X.maxNestedDepth());
             ASSERT(A2 == X.allowTrailingText());
+            ASSERT(D3 == X.useStructuralIndex());
+
+            mX.reset();
+            ASSERT(X  == defaultObj);
+        }
+        // --------------------
+        // `useStructuralIndex`
+        // --------------------
+        {
+            mX.setUseStructuralIndex(A3);
+            ASSERT(D1 == X.maxNestedDepth());
+            ASSERT(D2 == X.allowTrailingText());
+            ASSERT(A3 == X.useStructuralIndex());
 
             mX.reset();
             ASSERT(X  == defaultObj);
@@ -1175,16 +1255,25 @@ int main(int argc, char *argv[])
 
             ASSERT(A1  == X.maxNestedDepth());
             ASSERT(D2  == X.allowTrailingText());
+            ASSERT(D3  == X.useStructuralIndex());
 
             mX.setAllowTrailingText(A2);
 
             ASSERT(A1  == X.maxNestedDepth());
             ASSERT(A2  == X.allowTrailingText());
+            ASSERT(D3  == X.useStructuralIndex());
+
+            mX.setUseStructuralIndex(A3);
+
+            ASSERT(A1  == X.maxNestedDepth());
+            ASSERT(A2  == X.allowTrailingText());
+            ASSERT(A3  == X.useStructuralIndex());
 
             mX.setMaxNestedDepth(D1);
 
             ASSERT(D1  == X.maxNestedDepth());
             ASSERT(A2  == X.allowTrailingText());
+            ASSERT(A3  == X.useStructuralIndex());
 
             mX.reset();
             ASSERT(X   == defaultObj);
@@ -1205,6 +1294,9 @@ int main(int argc, char *argv[])
                 Obj &a2 = mX.setAllowTrailingText(A2);
                 ASSERTV(&a2, &mX, &a2 == &mX);
 
+                Obj &a3 = mX.setUseStructuralIndex(A3);
+                ASSERTV(&a3, &mX, &a3 == &mX);
+
                 Obj &r = mX.reset();
                 ASSERTV(&r,  &mX, &r  == &mX);
             }
@@ -1214,10 +1306,12 @@ int main(int argc, char *argv[])
             // ---------------------------------------
 
             mX.setMaxNestedDepth(A1)
-              .setAllowTrailingText(A2);
+              .setAllowTrailingText(A2)
+              .setUseStructuralIndex(A3);
 
             ASSERT(A1  == X.maxNestedDepth());
             ASSERT(A2  == X.allowTrailingText());
+            ASSERT(A3  == X.useStructuralIndex());
         }
 
         if (verbose) cout << "\nNegative Testing." << endl;
@@ -1265,6 +1359,7 @@ int main(int argc, char *argv[])
 
         const int   D1   = 64;                   // `maxNestedDepth`
         const bool  D2   = false;                // `allowTrailingText`
+        const bool  D3   = false;                // `useStructuralIndex`
 
         if (verbose) cout <<
                      "Create an object using the default constructor." << endl;
@@ -1279,6 +1374,7 @@ int main(int argc, char *argv[])
 
         ASSERTV(D1, X.maxNestedDepth(), D1 == X.maxNestedDepth());
         ASSERTV(D2, X.allowTrailingText(), D2 == X.allowTrailingText());
+        ASSERTV(D3, X.useStructuralIndex(), D3 == X.useStructuralIndex());
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -0,0 +1,608 @@
+// bdljsn_structuralindex.cpp                                         -*-C++-*-
+#include <bdljsn_structuralindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_structuralindex_cpp, "$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+// Compiler-specific and platform-specific
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && ((defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)   \
+  || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <immintrin.h>
+# define BDLJSN_STRUCTURALINDEX_SIMD_ENABLED
+# define BDLJSN_STRUCTURALINDEX_SSE2_TARGET __attribute__((target("sse2")))
+# define BDLJSN_STRUCTURALINDEX_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The text is processed in blocks of 64 characters.  A *kernel* classifies
+// the characters of a block into the bit masks of a `u::BlockMasks` object,
+// bit `i` of each mask describing character `i` of the block, and the
+// kernel-independent `u::BlockScanner` then derives from those masks the bit
+// mask of the characters of the block that belong in the index.  A final,
+// partial block is copied to a buffer padded with spaces before being
+// classified.
+//
+// `u::BlockScanner` carries three pieces of state from one block to the next:
+// whether the first character of the block is escaped, whether the block
+// begins within a string, and whether the last character of the previous
+// block belongs to a scalar.  Escaped characters are found by visiting each
+// backslash that is not itself escaped, which is fast because backslashes
+// are rare in typical JSON text.  The characters within strings (including
+// the opening quote, but not the closing quote) are then the bits set in the
+// prefix XOR of the mask of unescaped quotes.
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+typedef bsls::Types::Uint64     Uint64;
+typedef StructuralIndex::Offset Offset;
+
+enum { k_BLOCK_SIZE = 64 };
+
+/// This `struct` holds bit masks classifying a block of 64 characters, bit
+/// `i` of each mask being set if character `i` of the block is of the
+/// corresponding class.
+struct BlockMasks {
+    // PUBLIC DATA
+    Uint64 d_quote;       // '"'
+    Uint64 d_backslash;   // '\\'
+    Uint64 d_operator;    // '{', '}', '[', ']', ':', and ','
+    Uint64 d_whitespace;  // ' ', '\t', '\n', '\v', and '\r'
+    Uint64 d_control;     // U+0000 to U+001F
+};
+
+/// This class derives, from the bit masks classifying consecutive blocks of
+/// a text, the bit masks of the characters of those blocks that belong in a
+/// structural index.
+class BlockScanner {
+
+    // DATA
+    Uint64 d_escapeCarry;      // 1 if the next block begins with an escaped
+                               // character, and 0 otherwise
+
+    Uint64 d_inStringCarry;    // all bits set if the next block begins
+                               // within a string, and 0 otherwise
+
+    Uint64 d_scalarCarry;      // 1 if the last character scanned belongs to
+                               // a scalar, and 0 otherwise
+
+    Uint64 d_controlInString;  // non-zero if a string contains an
+                               // unescaped control character
+
+  public:
+    // CREATORS
+
+    /// Create a scanner positioned at the start of a text.
+    BlockScanner();
+
+    // MANIPULATORS
+
+    /// Return the bit mask of the characters of the block classified by the
+    /// specified `masks` that belong in a structural index, given that the
+    /// block follows the blocks previously scanned by this object.
+    Uint64 scan(const BlockMasks& masks);
+
+    // ACCESSORS
+
+    /// Return 0 if the blocks scanned by this object form a text that does
+    /// not end within a string and whose strings contain no unescaped
+    /// control characters, and a non-zero value otherwise.
+    int status() const;
+};
+
+                             // ------------------
+                             // class BlockScanner
+                             // ------------------
+
+// CREATORS
+inline
+BlockScanner::BlockScanner()
+: d_escapeCarry(0)
+, d_inStringCarry(0)
+, d_scalarCarry(0)
+, d_controlInString(0)
+{
+}
+
+// MANIPULATORS
+inline
+Uint64 BlockScanner::scan(const BlockMasks& masks)
+{
+    // Find the escaped characters.
+
+    Uint64 escaped  = d_escapeCarry;
+    Uint64 escapers = masks.d_backslash & ~escaped;
+
+    d_escapeCarry = 0;
+    while (escapers) {
+        const Uint64 backslash = escapers & (0 - escapers);
+        const Uint64 next      = backslash << 1;
+
+        if (0 == next) {
+            d_escapeCarry = 1;
+        }
+        escaped  |= next;
+        escapers &= ~(backslash | next);
+    }
+
+    // Find the characters within strings.
+
+    const Uint64 quotes   = masks.d_quote & ~escaped;
+    Uint64       inString = quotes;
+
+    inString ^= inString << 1;
+    inString ^= inString << 2;
+    inString ^= inString << 4;
+    inString ^= inString << 8;
+    inString ^= inString << 16;
+    inString ^= inString << 32;
+    inString ^= d_inStringCarry;
+
+    d_inStringCarry    = 0 - (inString >> 63);
+    d_controlInString |= masks.d_control & inString;
+
+    // Find the first character of each scalar.
+
+    const Uint64 nonScalar   = masks.d_whitespace | masks.d_operator | quotes;
+    const Uint64 scalar      = ~nonScalar & ~inString;
+    const Uint64 scalarStart = scalar & ~((scalar << 1) | d_scalarCarry);
+
+    d_scalarCarry = scalar >> 63;
+
+    return (masks.d_operator & ~inString) | quotes | scalarStart;
+}
+
+// ACCESSORS
+inline
+int BlockScanner::status() const
+{
+    return d_inStringCarry || d_controlInString ? -1 : 0;
+}
+
+/// Append to the specified `offsets` the sum of the specified `base` and the
+/// index of each bit set in the specified `mask`, in increasing order.
+inline
+void appendOffsets(bsl::vector<Offset> *offsets, Uint64 mask, Offset base)
+{
+    if (0 == mask) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t size = offsets->size();
+    offsets->resize(size + bdlb::BitUtil::numBitsSet(mask));
+
+    Offset *out = offsets->data() + size;
+    do {
+        *out++ = base + static_cast<Offset>(
+                                    bdlb::BitUtil::numTrailingUnsetBits(mask));
+        mask &= mask - 1;
+    } while (mask);
+}
+
+/// Load into the specified `masks` the classification of the 64 characters
+/// starting at the specified `block`.
+void classifyScalar(BlockMasks *masks, const char *block)
+{
+    Uint64 quote      = 0;
+    Uint64 backslash  = 0;
+    Uint64 op         = 0;
+    Uint64 whitespace = 0;
+    Uint64 control    = 0;
+
+    for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+        const Uint64        bit = Uint64(1) << i;
+        const unsigned char c   = static_cast<unsigned char>(block[i]);
+
+        switch (c) {
+          case '"': {
+            quote |= bit;
+          } break;
+          case '\\': {
+            backslash |= bit;
+          } break;
+          case '{':
+          case '}':
+          case '[':
+          case ']':
+          case ':':
+          case ',': {
+            op |= bit;
+          } break;
+          case ' ':
+          case '\t':
+          case '\n':
+          case '\v':
+          case '\r': {
+            whitespace |= bit;
+          } break;
+          default: {
+          } break;
+        }
+        if (c < 0x20) {
+            control |= bit;
+        }
+    }
+
+    masks->d_quote      = quote;
+    masks->d_backslash  = backslash;
+    masks->d_operator   = op;
+    masks->d_whitespace = whitespace;
+    masks->d_control    = control;
+}
+
+/// Append to the specified `offsets` the offsets of the structural
+/// characters of the specified `input`, followed by the length of `input`,
+/// classifying its characters one at a time.  Return 0 on success, and a
+/// non-zero value otherwise.
+int buildScalar(bsl::vector<Offset> *offsets, const bsl::string_view& input)
+{
+    const char        *data   = input.data();
+    const bsl::size_t  length = input.length();
+
+    BlockScanner scanner;
+    BlockMasks   masks;
+    bsl::size_t  i = 0;
+
+    for (; i + k_BLOCK_SIZE <= length; i += k_BLOCK_SIZE) {
+        classifyScalar(&masks, data + i);
+        appendOffsets(offsets, scanner.scan(masks), static_cast<Offset>(i));
+    }
+
+    if (i < length) {
+        char tail[k_BLOCK_SIZE];
+        bsl::memset(tail, ' ', sizeof tail);
+        bsl::memcpy(tail, data + i, length - i);
+
+        classifyScalar(&masks, tail);
+        appendOffsets(offsets, scanner.scan(masks), static_cast<Offset>(i));
+    }
+
+    offsets->push_back(static_cast<Offset>(length));
+    return scanner.status();
+}
+
+#if defined(BDLJSN_STRUCTURALINDEX_SIMD_ENABLED)
+
+/// Return `true` if the running processor supports the SSE2 instructions,
+/// and `false` otherwise.
+bool detectSse2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+/// Return `true` if the running processor and operating system support the
+/// AVX2 instructions, and `false` otherwise.
+bool detectAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+/// Return the bit mask of the bytes of the specified `input` that are equal
+/// to the specified `c`.
+BDLJSN_STRUCTURALINDEX_SSE2_TARGET
+inline
+unsigned equalSse2(__m128i input, char c)
+{
+    return static_cast<unsigned>(_mm_movemask_epi8(
+                                 _mm_cmpeq_epi8(input, _mm_set1_epi8(c))));
+}
+
+/// Load into the specified `masks` the classification of the 64 characters
+/// starting at the specified `block`, 16 characters at a time.
+BDLJSN_STRUCTURALINDEX_SSE2_TARGET
+inline
+void classifySse2(BlockMasks *masks, const char *block)
+{
+    const __m128i caseBit    = _mm_set1_epi8(0x20);
+    const __m128i nine       = _mm_set1_epi8(9);
+    const __m128i two        = _mm_set1_epi8(2);
+    const __m128i maxControl = _mm_set1_epi8(0x1f);
+
+    Uint64 quote      = 0;
+    Uint64 backslash  = 0;
+    Uint64 op         = 0;
+    Uint64 whitespace = 0;
+    Uint64 control    = 0;
+
+    for (int i = 0; i < k_BLOCK_SIZE; i += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(block + i));
+
+        // `c | 0x20` maps '[' and ']' onto '{' and '}', respectively, and
+        // no other character onto either.
+
+        const __m128i folded = _mm_or_si128(input, caseBit);
+        const unsigned opBits =
+                static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(
+                       _mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                       _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')))))
+              | equalSse2(input, ':')
+              | equalSse2(input, ',');
+
+        // '\t', '\n', and '\v' are the characters 9 to 11.
+
+        const __m128i tabToVt = _mm_sub_epi8(input, nine);
+        const unsigned wsBits =
+                static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                                        _mm_min_epu8(tabToVt, two), tabToVt)))
+              | equalSse2(input, ' ')
+              | equalSse2(input, '\r');
+
+        const unsigned controlBits = static_cast<unsigned>(
+                 _mm_movemask_epi8(_mm_cmpeq_epi8(
+                                   _mm_min_epu8(input, maxControl), input)));
+
+        quote      |= Uint64(equalSse2(input, '"'))  << i;
+        backslash  |= Uint64(equalSse2(input, '\\')) << i;
+        op         |= Uint64(opBits)                 << i;
+        whitespace |= Uint64(wsBits)                 << i;
+        control    |= Uint64(controlBits)            << i;
+    }
+
+    masks->d_quote      = quote;
+    masks->d_backslash  = backslash;
+    masks->d_operator   = op;
+    masks->d_whitespace = whitespace;
+    masks->d_control    = control;
+}
+
+/// Append to the specified `offsets` the offsets of the structural
+/// characters of the specified `input`, followed by the length of `input`,
+/// classifying its characters with SSE2 instructions.  Return 0 on success,
+/// and a non-zero value otherwise.
+BDLJSN_STRUCTURALINDEX_SSE2_TARGET
+int buildSse2(bsl::vector<Offset> *offsets, const bsl::string_view& input)
+{
+    const char        *data   = input.data();
+    const bsl::size_t  length = input.length();
+
+    BlockScanner scanner;
+    BlockMasks   masks;
+    bsl::size_t  i = 0;
+
+    for (; i + k_BLOCK_SIZE <= length; i += k_BLOCK_SIZE) {
+        classifySse2(&masks, data + i);
+        appendOffsets(offsets, scanner.scan(masks), static_cast<Offset>(i));
+    }
+
+    if (i < length) {
+        char tail[k_BLOCK_SIZE];
+        bsl::memset(tail, ' ', sizeof tail);
+        bsl::memcpy(tail, data + i, length - i);
+
+        classifySse2(&masks, tail);
+        appendOffsets(offsets, scanner.scan(masks), static_cast<Offset>(i));
+    }
+
+    offsets->push_back(static_cast<Offset>(length));
+    return scanner.status();
+}
+
+/// Return the bit mask of the bytes of the specified `input` that are equal
+/// to the specified `c`.
+BDLJSN_STRUCTURALINDEX_AVX2_TARGET
+inline
+unsigned equalAvx2(__m256i input, char c)
+{
+    return static_cast<unsigned>(_mm256_movemask_epi8(
+                               _mm256_cmpeq_epi8(input, _mm256_set1_epi8(c))));
+}
+
+/// Load into the specified `masks` the classification of the 64 characters
+/// starting at the specified `block`, 32 characters at a time.
+BDLJSN_STRUCTURALINDEX_AVX2_TARGET
+inline
+void classifyAvx2(BlockMasks *masks, const char *block)
+{
+    const __m256i caseBit    = _mm256_set1_epi8(0x20);
+    const __m256i nine       = _mm256_set1_epi8(9);
+    const __m256i two        = _mm256_set1_epi8(2);
+    const __m256i maxControl = _mm256_set1_epi8(0x1f);
+
+    Uint64 quote      = 0;
+    Uint64 backslash  = 0;
+    Uint64 op         = 0;
+    Uint64 whitespace = 0;
+    Uint64 control    = 0;
+
+    for (int i = 0; i < k_BLOCK_SIZE; i += 32) {
+        const __m256i input = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(block + i));
+
+        const __m256i folded = _mm256_or_si256(input, caseBit);
+        const unsigned opBits =
+                static_cast<unsigned>(_mm256_movemask_epi8(_mm256_or_si256(
+                       _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')),
+                       _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}')))))
+              | equalAvx2(input, ':')
+              | equalAvx2(input, ',');
+
+        const __m256i tabToVt = _mm256_sub_epi8(input, nine);
+        const unsigned wsBits =
+                static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                                     _mm256_min_epu8(tabToVt, two), tabToVt)))
+              | equalAvx2(input, ' ')
+              | equalAvx2(input, '\r');
+
+        const unsigned controlBits = static_cast<unsigned>(
+                 _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                                _mm256_min_epu8(input, maxControl), input)));
+
+        quote      |= Uint64(equalAvx2(input, '"'))  << i;
+        backslash  |= Uint64(equalAvx2(input, '\\')) << i;
+        op         |= Uint64(opBits)                 << i;
+        whitespace |= Uint64(wsBits)                 << i;
+        control    |= Uint64(controlBits)            << i;
+    }
+
+    masks->d_quote      = quote;
+    masks->d_backslash  = backslash;
+    masks->d_operator   = op;
+    masks->d_whitespace = whitespace;
+    masks->d_control    = control;
+}
+
+/// Append to the specified `offsets` the offsets of the structural
+/// characters of the specified `input`, followed by the length of `input`,
+/// classifying its characters with AVX2 instructions.  Return 0 on success,
+/// and a non-zero value otherwise.
+BDLJSN_STRUCTURALINDEX_AVX2_TARGET
+int buildAvx2(bsl::vector<Offset> *offsets, const bsl::string_view& input)
+{
+    const char        *data   = input.data();
+    const bsl::size_t  length = input.length();
+
+    BlockScanner scanner;
+    BlockMasks   masks;
+    bsl::size_t  i = 0;
+
+    for (; i + k_BLOCK_SIZE <= length; i += k_BLOCK_SIZE) {
+        classifyAvx2(&masks, data + i);
+        appendOffsets(offsets, scanner.scan(masks), static_cast<Offset>(i));
+    }
+
+    if (i < length) {
+        char tail[k_BLOCK_SIZE];
+        bsl::memset(tail, ' ', sizeof tail);
+        bsl::memcpy(tail, data + i, length - i);
+
+        classifyAvx2(&masks, tail);
+        appendOffsets(offsets, scanner.scan(masks), static_cast<Offset>(i));
+    }
+
+    offsets->push_back(static_cast<Offset>(length));
+    return scanner.status();
+}
+
+#endif
+
+typedef int (*BuildFn)(bsl::vector<Offset> *, const bsl::string_view&);
+
+/// Return the fastest implementation of `build` available on the running
+/// platform.
+BuildFn buildFunction()
+{
+    static BuildFn buildFn = 0;
+
+    BSLMT_ONCE_DO {
+#if defined(BDLJSN_STRUCTURALINDEX_SIMD_ENABLED)
+        buildFn = detectAvx2() ? &buildAvx2
+                : detectSse2() ? &buildSse2
+                :                &buildScalar;
+#else
+        buildFn = &buildScalar;
+#endif
+    }
+
+    return buildFn;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class StructuralIndex
+                           // ---------------------
+
+// CLASS METHODS
+bool StructuralIndex::isAvailable(Kernel kernel)
+{
+    switch (kernel) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      }
+#if defined(BDLJSN_STRUCTURALINDEX_SIMD_ENABLED)
+      case e_SSE2: {
+        return u::detectSse2();                                       // RETURN
+      }
+      case e_AVX2: {
+        return u::detectAvx2();                                       // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
+// MANIPULATORS
+int StructuralIndex::build(const bsl::string_view& input)
+{
+    d_offsets.clear();
+
+    if (input.length() > bsl::size_t(Offset(-1))) {
+        return -1;                                                    // RETURN
+    }
+
+    const int rc = u::buildFunction()(&d_offsets, input);
+    if (0 != rc) {
+        d_offsets.clear();
+    }
+    return rc;
+}
+
+int StructuralIndex::build(const bsl::string_view& input, Kernel kernel)
+{
+    BSLS_ASSERT(isAvailable(kernel));
+
+    d_offsets.clear();
+
+    if (input.length() > bsl::size_t(Offset(-1))) {
+        return -1;                                                    // RETURN
+    }
+
+    int rc;
+    switch (kernel) {
+#if defined(BDLJSN_STRUCTURALINDEX_SIMD_ENABLED)
+      case e_AVX2: {
+        rc = u::buildAvx2(&d_offsets, input);
+      } break;
+      case e_SSE2: {
+        rc = u::buildSse2(&d_offsets, input);
+      } break;
+#endif
+      default: {
+        rc = u::buildScalar(&d_offsets, input);
+      } break;
+    }
+
+    if (0 != rc) {
+        d_offsets.clear();
+    }
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
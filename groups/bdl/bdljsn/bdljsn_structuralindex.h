@@ -0,0 +1,247 @@
+// bdljsn_structuralindex.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLJSN_STRUCTURALINDEX
+#define INCLUDED_BDLJSN_STRUCTURALINDEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an index of the structural characters of a JSON text.
+//
+//@CLASSES:
+//  bdljsn::StructuralIndex: offsets of the structural characters of a text
+//
+//@SEE_ALSO: bdljsn_jsonutil, bdljsn_readoptions, bdljsn_tokenizer
+//
+//@DESCRIPTION: This component provides a mechanism,
+// `bdljsn::StructuralIndex`, that records the byte offsets of the characters
+// of a JSON text that determine its structure.  Building the index is the
+// first stage of a two-stage parser: the second stage visits only the offsets
+// in the index, and need not examine the text between them (other than the
+// contents of strings and scalars), so that white space, and string contents
+// requiring no unescaping, are never examined one character at a time.
+// `bdljsn::JsonUtil` uses this component when reading a document if the
+// `useStructuralIndex` option is set (see `bdljsn_readoptions`).
+//
+///Index Contents
+///--------------
+// After a successful call to `build`, the index holds, in increasing order,
+// the offsets of:
+//
+// * every `{`, `}`, `[`, `]`, `:`, and `,` character that is not within a
+//   string,
+// * every `"` character that opens or closes a string (i.e., that is not
+//   escaped by a preceding backslash), and
+// * the first character of every *scalar*: a maximal sequence of characters,
+//   outside of strings, containing no white space, none of the characters
+//   above, and no `"` characters (e.g., `true`, `null`, or `-1.5e3`, but
+//   also any other text that might appear in invalid JSON),
+//
+// followed by a single sentinel offset, the length of the text.  Note that
+// the offset of each opening quote is immediately followed in the index by
+// the offset of the matching closing quote.
+//
+// White space consists of the characters ' ', '\t', '\n', '\v', and '\r'
+// (i.e., the white space accepted by `bdljsn::Tokenizer` in the
+// `e_STRICT_20240119` conformance mode).
+//
+// `build` fails, and leaves the index empty, if the text ends within a
+// string, if a string contains an unescaped control character (i.e., one in
+// the range `U+0000` to `U+001F`), or if the text is too long for its length
+// to be represented as an `Offset`.  Note that `build` does not otherwise
+// verify that the text is valid JSON.
+//
+///Performance
+///-----------
+// The text is classified 64 characters at a time into bit masks (one bit per
+// character) of quotes, backslashes, structural characters, white space, and
+// control characters.  On x86 platforms those masks are computed with SSE2 or
+// AVX2 instructions, whichever is the best supported by the processor at run
+// time; elsewhere, a portable implementation is used.  Escaped characters are
+// then found by visiting only the backslashes, the interiors of strings by a
+// prefix XOR of the unescaped quotes, and the offsets of the set bits of the
+// resulting mask are appended to the index.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing a JSON Text
+///- - - - - - - - - - - - - - - -
+// First, we create a JSON text and an index:
+// ```
+// const bsl::string_view text = "{\"a\": [1, true]}";
+//
+// bdljsn::StructuralIndex index;
+// ```
+// Then, we build the index of the text:
+// ```
+// int rc = index.build(text);
+// assert(0 == rc);
+// ```
+// Finally, we observe the offsets of the structural characters, of the
+// scalars `1` and `true`, and of the sentinel, in the index:
+// ```
+// const bdljsn::StructuralIndex::Offset EXPECTED[] = {
+//     0, 1, 3, 4, 6, 7, 8, 10, 14, 15, 16
+// };
+// const bsl::size_t NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+//
+// assert(NUM_EXPECTED == index.offsets().size());
+// for (bsl::size_t i = 0; i < NUM_EXPECTED; ++i) {
+//     assert(EXPECTED[i] == index.offsets()[i]);
+// }
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+                           // =====================
+                           // class StructuralIndex
+                           // =====================
+
+/// This mechanism class holds the offsets of the structural characters of a
+/// JSON text.  See [](#Index Contents) for the offsets that are recorded.
+class StructuralIndex {
+
+  public:
+    // TYPES
+
+    /// `Offset` is an alias for the type of the offsets held in the index.
+    typedef bsl::uint32_t Offset;
+
+    /// Enumerates the implementations that `build` may use to classify the
+    /// characters of a text.
+    enum Kernel {
+        e_SCALAR,  // portable, one character at a time
+        e_SSE2,    // x86 SSE2, 16 characters at a time
+        e_AVX2     // x86 AVX2, 32 characters at a time
+    };
+
+  private:
+    // DATA
+    bsl::vector<Offset> d_offsets;  // offsets, followed by the sentinel
+
+  private:
+    // NOT IMPLEMENTED
+    StructuralIndex(const StructuralIndex&);
+    StructuralIndex& operator=(const StructuralIndex&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StructuralIndex,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+
+    /// Return `true` if the specified `kernel` can be used on the running
+    /// platform, and `false` otherwise.
+    static bool isAvailable(Kernel kernel);
+
+    // CREATORS
+
+    /// Create an empty index.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit StructuralIndex(bslma::Allocator *basicAllocator = 0);
+
+    //! ~StructuralIndex() = default;
+
+    // MANIPULATORS
+
+    /// Replace the contents of this index with the offsets of the structural
+    /// characters of the specified `input`, followed by the length of
+    /// `input`.  Optionally specify the `kernel` used to classify the
+    /// characters of `input`; if `kernel` is not specified, the fastest
+    /// kernel available on the running platform is used.  Return 0 on
+    /// success, and a non-zero value, with this index left empty, if `input`
+    /// ends within a string, if a string in `input` contains an unescaped
+    /// control character, or if the length of `input` cannot be represented
+    /// as an `Offset`.  The behavior is undefined unless
+    /// `isAvailable(kernel)`.
+    int build(const bsl::string_view& input);
+    int build(const bsl::string_view& input, Kernel kernel);
+
+    /// Remove all offsets from this index.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the offsets
+    /// held in this index, the last of which (if any) is the length of the
+    /// text that was indexed.
+    const bsl::vector<Offset>& offsets() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class StructuralIndex
+                           // ---------------------
+
+// CREATORS
+inline
+StructuralIndex::StructuralIndex(bslma::Allocator *basicAllocator)
+: d_offsets(basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+void StructuralIndex::clear()
+{
+    d_offsets.clear();
+}
+
+// ACCESSORS
+inline
+const bsl::vector<StructuralIndex::Offset>& StructuralIndex::offsets() const
+{
+    return d_offsets;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *StructuralIndex::allocator() const
+{
+    return d_offsets.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
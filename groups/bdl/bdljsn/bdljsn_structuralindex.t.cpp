@@ -0,0 +1,666 @@
+// bdljsn_structuralindex.t.cpp                                       -*-C++-*-
+#include <bdljsn_structuralindex.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a mechanism that records the offsets of the
+// structural characters of a text.  Its only non-trivial manipulator is
+// `build`, which is implemented by several kernels.  We test `build` first
+// on a table of texts having known indexes, and then compare every kernel
+// available on the running platform with a simple character-at-a-time
+// reference implementation, on a large number of random texts chosen to
+// stress the transitions between blocks of 64 characters.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] static bool isAvailable(Kernel kernel);
+//
+// CREATORS
+// [ 2] explicit StructuralIndex(bslma::Allocator *basicAllocator = 0);
+//
+// MANIPULATORS
+// [ 2] int build(const bsl::string_view& input);
+// [ 3] int build(const bsl::string_view& input, Kernel kernel);
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 2] const bsl::vector<Offset>& offsets() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: `build`
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS AND CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::StructuralIndex Obj;
+typedef Obj::Offset             Offset;
+
+static const struct {
+    Obj::Kernel  d_kernel;
+    const char  *d_name_p;
+} KERNELS[] = {
+    { Obj::e_SCALAR, "SCALAR" },
+    { Obj::e_SSE2,   "SSE2"   },
+    { Obj::e_AVX2,   "AVX2"   },
+};
+enum { k_NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS };
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Load into the specified `result` the index of the specified `input`,
+/// computed one character at a time according to the rules in the
+/// component documentation.  Return 0 on success, and a non-zero value, with
+/// `result` left empty, otherwise.
+int referenceIndex(bsl::vector<Offset> *result, const bsl::string_view& input)
+{
+    result->clear();
+
+    bool inString   = false;
+    bool escaped    = false;
+    bool prevScalar = false;
+
+    for (bsl::size_t i = 0; i < input.length(); ++i) {
+        const unsigned char c        = static_cast<unsigned char>(input[i]);
+        const bool          isQuote  = '"' == c && !escaped;
+
+        escaped = '\\' == c && !escaped;
+
+        if (inString) {
+            if (c < 0x20) {
+                result->clear();
+                return -1;                                            // RETURN
+            }
+            if (isQuote) {
+                result->push_back(static_cast<Offset>(i));
+                inString = false;
+            }
+            continue;                                               // CONTINUE
+        }
+
+        if (isQuote) {
+            result->push_back(static_cast<Offset>(i));
+            inString   = true;
+            prevScalar = false;
+        }
+        else if (bsl::strchr("{}[]:,", c) && c) {
+            result->push_back(static_cast<Offset>(i));
+            prevScalar = false;
+        }
+        else if (bsl::strchr(" \t\n\v\r", c) && c) {
+            prevScalar = false;
+        }
+        else {
+            if (!prevScalar) {
+                result->push_back(static_cast<Offset>(i));
+            }
+            prevScalar = true;
+        }
+    }
+
+    if (inString) {
+        result->clear();
+        return -1;                                                    // RETURN
+    }
+
+    result->push_back(static_cast<Offset>(input.length()));
+    return 0;
+}
+
+/// Return a pseudo-random number in the range `[0, 0x7fff]`, advancing the
+/// specified `seed`.
+int rand15(unsigned *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+/// Append to the specified `text` the specified `length` characters chosen
+/// pseudo-randomly, using the specified `seed`, from an alphabet in which
+/// quotes, backslashes, and structural characters are over-represented.
+/// Include control characters only if the specified `controls` is `true`.
+void appendRandomText(bsl::string *text,
+                      bsl::size_t  length,
+                      unsigned    *seed,
+                      bool         controls)
+{
+    static const char ALPHABET[] = "\"\"\"\\\\\\{}[]:, \t\n\v\r\f"
+                                   "abtrue01-.e\x7f\xc3\xa9";
+    const int         SIZE       = sizeof ALPHABET - 1;
+
+    for (bsl::size_t i = 0; i < length; ++i) {
+        const int r = rand15(seed);
+        if (controls && 0 == r % 97) {
+            *text += static_cast<char>(r % 0x20);
+        }
+        else {
+            *text += ALPHABET[r % SIZE];
+        }
+    }
+}
+
+/// Return a JSON text of at least the specified `size` bytes consisting of
+/// an array of objects with string, numeric, and literal members.
+bsl::string makeDocument(bsl::size_t size)
+{
+    bsl::string result("[\n");
+    while (result.length() < size) {
+        result += "  {\"id\": 12345, \"name\": \"Some Name\","
+                  " \"active\": true, \"ratio\": -1.5e3,"
+                  " \"tags\": [\"a\", \"b\\\"c\"], \"parent\": null},\n";
+    }
+    result += "  {}\n]\n";
+    return result;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Indexing a JSON Text
+///- - - - - - - - - - - - - - - -
+// First, we create a JSON text and an index:
+// ```
+        const bsl::string_view text = "{\"a\": [1, true]}";
+
+        bdljsn::StructuralIndex index;
+// ```
+// Then, we build the index of the text:
+// ```
+        int rc = index.build(text);
+        ASSERT(0 == rc);
+// ```
+// Finally, we observe the offsets of the structural characters, of the
+// scalars `1` and `true`, and of the sentinel, in the index:
+// ```
+        const bdljsn::StructuralIndex::Offset EXPECTED[] = {
+            0, 1, 3, 4, 6, 7, 8, 10, 14, 15, 16
+        };
+        const bsl::size_t NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+
+        ASSERT(NUM_EXPECTED == index.offsets().size());
+        for (bsl::size_t i = 0; i < NUM_EXPECTED; ++i) {
+            ASSERT(EXPECTED[i] == index.offsets()[i]);
+        }
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING KERNELS
+        //
+        // Concerns:
+        // 1. Every kernel reported available by `isAvailable` produces the
+        //    same index, and the same status, as a simple character-at-a-time
+        //    implementation of the rules in the component documentation.
+        //
+        // 2. Escapes, strings, and scalars that span the boundary between
+        //    two blocks of 64 characters, and texts whose length is not a
+        //    multiple of 64, are handled correctly.
+        //
+        // 3. The scalar kernel is always available.
+        //
+        // 4. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Generate pseudo-random texts of every length from 0 to 300, over
+        //    an alphabet in which quotes, backslashes, and structural
+        //    characters are over-represented, with and without control
+        //    characters.  (C-2)
+        //
+        // 2. For each text, and for each available kernel, compare the
+        //    result of `build` with that of a reference implementation.
+        //    (C-1)
+        //
+        // 3. Verify that `isAvailable(e_SCALAR)` is `true`.  (C-3)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for unavailable kernels.  (C-4)
+        //
+        // Testing:
+        //   static bool isAvailable(Kernel kernel);
+        //   int build(const bsl::string_view& input, Kernel kernel);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING KERNELS" << endl
+                          << "===============" << endl;
+
+        ASSERT(Obj::isAvailable(Obj::e_SCALAR));
+
+        if (verbose) {
+            for (int kk = 0; kk < k_NUM_KERNELS; ++kk) {
+                cout << KERNELS[kk].d_name_p << ": "
+                     << Obj::isAvailable(KERNELS[kk].d_kernel) << endl;
+            }
+        }
+
+        bslma::TestAllocator oa("object",  veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        Obj                 mX(&oa);  const Obj& X = mX;
+        bsl::vector<Offset> expected(&sa);
+        bsl::string         text(&sa);
+        unsigned            seed     = 12345;
+        int                 numValid = 0;
+
+        for (int ti = 0; ti < 4 * 301; ++ti) {
+            const bsl::size_t LENGTH   = ti % 301;
+            const bool        CONTROLS = ti / 301 == 3;
+
+            text.clear();
+
+            // Mostly, build texts of several strings separated by scalars,
+            // so that a good proportion of them are valid.
+
+            if (ti / 301 == 0) {
+                u::appendRandomText(&text, LENGTH, &seed, CONTROLS);
+            }
+            else {
+                while (text.length() < LENGTH) {
+                    const bool inString = u::rand15(&seed) % 2;
+                    const int  span     = u::rand15(&seed) % 80;
+                    if (inString) {
+                        text += '"';
+                        for (int i = 0; i < span; ++i) {
+                            const int r = u::rand15(&seed) % 8;
+                            text += 0 == r ? "\\\\"
+                                  : 1 == r ? "\\\""
+                                  : 2 == r ? "x"
+                                  :          "y";
+                        }
+                        text += '"';
+                    }
+                    else {
+                        u::appendRandomText(&text, span, &seed, CONTROLS);
+                    }
+                }
+            }
+
+            const int EXPECTED_RC = u::referenceIndex(&expected, text);
+            numValid += 0 == EXPECTED_RC;
+
+            for (int kk = 0; kk < k_NUM_KERNELS; ++kk) {
+                const Obj::Kernel  KERNEL = KERNELS[kk].d_kernel;
+                const char        *NAME   = KERNELS[kk].d_name_p;
+
+                if (!Obj::isAvailable(KERNEL)) {
+                    continue;                                       // CONTINUE
+                }
+
+                const int rc = mX.build(text, KERNEL);
+
+                ASSERTV(ti, NAME, text, EXPECTED_RC, rc,
+                        (0 == EXPECTED_RC) == (0 == rc));
+                ASSERTV(ti, NAME, text, expected == X.offsets());
+            }
+        }
+
+        if (verbose) P(numValid);
+        ASSERT(numValid > 200);
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mY;
+
+            for (int kk = 0; kk < k_NUM_KERNELS; ++kk) {
+                if (Obj::isAvailable(KERNELS[kk].d_kernel)) {
+                    ASSERT_PASS(mY.build("[]", KERNELS[kk].d_kernel));
+                }
+                else {
+                    ASSERT_FAIL(mY.build("[]", KERNELS[kk].d_kernel));
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `build`
+        //
+        // Concerns:
+        // 1. `build` loads the offsets of the structural characters, of the
+        //    opening and closing quotes of strings, and of the first character
+        //    of each scalar, in increasing order, followed by the length of
+        //    the input.
+        //
+        // 2. Characters within strings, including escaped quotes, are not
+        //    indexed.
+        //
+        // 3. `build` fails, leaving the index empty, if the input ends within
+        //    a string, or if a string contains an unescaped control character.
+        //
+        // 4. Control characters other than white space, and form feeds, are
+        //    part of scalars when not within strings.
+        //
+        // 5. `build` replaces any previous contents of the index, and `clear`
+        //    empties it.
+        //
+        // 6. Memory is supplied by the object allocator, and `allocator`
+        //    returns it.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, build the index of a variety
+        //    of inputs, each prefixed with 0 to 70 spaces to vary its
+        //    alignment with respect to the blocks of 64 characters, and
+        //    verify the expected status and offsets.  (C-1..5)
+        //
+        // 2. Use a test allocator to verify that the object allocator, and
+        //    not the default allocator, is used.  (C-6)
+        //
+        // Testing:
+        //   explicit StructuralIndex(bslma::Allocator *basicAllocator = 0);
+        //   int build(const bsl::string_view& input);
+        //   void clear();
+        //   const bsl::vector<Offset>& offsets() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `build`" << endl
+                          << "===============" << endl;
+
+        const int F = -1;  // marks the end of the list of expected offsets
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+            bool        d_valid;
+            int         d_offsets[16];
+        } DATA[] = {
+            //LINE INPUT                 VALID OFFSETS
+            //---- --------------------- ----- ------------------------
+            { L_,  "",                   true, {                   F }},
+            { L_,  " \t\n\v\r",          true, {                   F }},
+            { L_,  "{}",                 true, { 0, 1,             F }},
+            { L_,  "[1,2]",              true, { 0, 1, 2, 3, 4,    F }},
+            { L_,  "{\"a\":1}",          true, { 0, 1, 3, 4, 5, 6, F }},
+            { L_,  " true ",             true, { 1,                F }},
+            { L_,  "-1.5e3",             true, { 0,                F }},
+            { L_,  "ab cd",              true, { 0, 3,             F }},
+            { L_,  "a\fb",               true, { 0,                F }},
+            { L_,  "\x01",               true, { 0,                F }},
+            { L_,  "1\"x\"2",            true, { 0, 1, 3, 4,       F }},
+            { L_,  "\"{}[]:, \"",        true, { 0, 8,             F }},
+            { L_,  "\"\\\"\"",           true, { 0, 3,             F }},
+            { L_,  "\"\\\\\"",           true, { 0, 3,             F }},
+            { L_,  "\"\\\\\\\"\"",       true, { 0, 5,             F }},
+            { L_,  "\\\"",               true, { 0,                F }},
+            { L_,  "[\"\xc3\xa9\"]",     true, { 0, 1, 4, 5,       F }},
+            { L_,  "\"\x7f\"",           true, { 0, 2,             F }},
+            { L_,  "\"",                 false,{                   F }},
+            { L_,  "\"abc",              false,{                   F }},
+            { L_,  "\"a\\\"",            false,{                   F }},
+            { L_,  "\"\t\"",             false,{                   F }},
+            { L_,  "\"\\\n\"",           false,{                   F }},
+            { L_,  "[\"a\x1f\"]",        false,{                   F }},
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object",  veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(&oa == X.allocator());
+        ASSERT(X.offsets().empty());
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const char *const INPUT = DATA[ti].d_input_p;
+            const bool        VALID = DATA[ti].d_valid;
+            const int *const  EXP   = DATA[ti].d_offsets;
+
+            for (int padding = 0; padding <= 70; ++padding) {
+                bsl::string text(padding, ' ', &sa);
+                text += INPUT;
+
+                if (veryVerbose) { T_ P_(LINE) P_(padding) P(text) }
+
+                bsl::vector<Offset> expected(&sa);
+                if (VALID) {
+                    for (const int *pe = EXP; F != *pe; ++pe) {
+                        expected.push_back(static_cast<Offset>(*pe + padding));
+                    }
+                    expected.push_back(static_cast<Offset>(text.length()));
+                }
+
+                const int rc = mX.build(text);
+
+                ASSERTV(LINE, padding, rc, VALID == (0 == rc));
+                ASSERTV(LINE, padding, expected == X.offsets());
+            }
+        }
+
+        ASSERT(0 == mX.build("[1]"));
+        ASSERT(4 == X.offsets().size());
+
+        mX.clear();
+        ASSERT(X.offsets().empty());
+
+        ASSERT(0 <  oa.numBlocksTotal());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Index a small document and verify the offsets.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == mX.build("[\"x\", 12]"));
+
+        ASSERT(7 == X.offsets().size());
+        ASSERT(0 == X.offsets()[0]);
+        ASSERT(1 == X.offsets()[1]);
+        ASSERT(3 == X.offsets()[2]);
+        ASSERT(4 == X.offsets()[3]);
+        ASSERT(6 == X.offsets()[4]);
+        ASSERT(8 == X.offsets()[5]);
+        ASSERT(9 == X.offsets()[6]);
+
+        ASSERT(0 != mX.build("[\"x"));
+        ASSERT(X.offsets().empty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `build`
+        //
+        // Concerns:
+        // 1. Report the throughput of each available kernel.
+        //
+        // Plan:
+        // 1. Build a JSON document of about 16MB, and time repeated indexing
+        //    of it with each kernel.
+        //
+        // Testing:
+        //   PERFORMANCE: `build`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: `build`" << endl
+                          << "====================" << endl;
+
+        enum { k_SIZE = 16 << 20, k_REPS = 10 };
+
+        const bsl::string INPUT = u::makeDocument(k_SIZE);
+        const double      MB    = static_cast<double>(INPUT.length()) *
+                                                          k_REPS / (1 << 20);
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int kk = 0; kk < k_NUM_KERNELS; ++kk) {
+            if (!Obj::isAvailable(KERNELS[kk].d_kernel)) {
+                continue;                                           // CONTINUE
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int rep = 0; rep < k_REPS; ++rep) {
+                ASSERT(0 == mX.build(INPUT, KERNELS[kk].d_kernel));
+            }
+            timer.stop();
+
+            cout << KERNELS[kk].d_name_p << ": "
+                 << MB / timer.elapsedTime() << " MB/s, "
+                 << X.offsets().size() << " offsets" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
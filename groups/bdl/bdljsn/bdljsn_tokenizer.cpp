@@ -13,6 +13,7 @@ BSLS_IDENT_RCSID(bdljsn_tokenizer_cpp, "$Id$ $CSID$")
 
 #include <bsl_cstring.h>
 #include <bsl_ios.h>
+#include <bsl_new.h>
 
 // IMPLEMENTATION NOTES
 // --------------------
@@ -55,6 +56,15 @@ BSLS_IDENT_RCSID(bdljsn_tokenizer_cpp, "$Id$ $CSID$")
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
 //
+// All scanning is done over 'd_input', which refers either to 'd_stringBuffer'
+// (refreshed whenever that buffer is modified) or, for contiguous input, to
+// the input itself.  For contiguous input the three buffer-refilling functions
+// never move or copy characters: the first call to any of them makes the whole
+// input (or its valid UTF-8 prefix) available, exactly as one large read from
+// a 'streambuf' would, and subsequent calls find end of input.  Validating
+// lazily, on the first "read", rather than in 'reset' allows options to be set
+// after 'reset', as 'baljsn::Decoder' does.
+//
 // Note that the implementation must allow changes to tokenizer options after
 // tokenization has begun.  And in no case should a situation arise in which
 // the same state of tokenizer is legal with one combination of options and
@@ -78,6 +88,10 @@ namespace bdljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (d_isContiguous) {
+        return readContiguousInput() ? 0 : -1;                        // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -112,6 +126,7 @@ int Tokenizer::expandBufferForLargeValue()
 
     d_readOffset += numRead;
     d_stringBuffer.resize(currLength + numRead);
+    d_input = d_stringBuffer;
     return numRead ? 0 : -1;
 }
 
@@ -121,13 +136,13 @@ int Tokenizer::extractStringValue()
     char previousChar = 0;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length() &&
-               '"' != d_stringBuffer[d_valueIter]) {
-            if ('\\' == d_stringBuffer[d_valueIter] && '\\' == previousChar) {
+        while (d_valueIter < d_input.length() &&
+               '"' != d_input[d_valueIter]) {
+            if ('\\' == d_input[d_valueIter] && '\\' == previousChar) {
                 previousChar = 0;
             }
             else {
-                previousChar = d_stringBuffer[d_valueIter];
+                previousChar = d_input[d_valueIter];
 
                 if (false == d_allowUnescapedControlCharacters
                  && 0x00  <= previousChar
@@ -139,7 +154,7 @@ int Tokenizer::extractStringValue()
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_input.length()) {
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
             // current sequence of characters being processed to the front of
@@ -153,7 +168,8 @@ int Tokenizer::extractStringValue()
             }
 
             if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
+                const bsl::streamsize numRead =
+                                      moveValueCharsToStartAndReloadBuffer();
                 if (0 == numRead) {
                     return -1;                                        // RETURN
                 }
@@ -180,8 +196,12 @@ int Tokenizer::extractStringValue()
     return 0;
 }
 
-int Tokenizer::moveValueCharsToStartAndReloadBuffer()
+bsl::streamsize Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (d_isContiguous) {
+        return readContiguousInput();                                 // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -221,12 +241,54 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 
     d_readOffset += numRead;
     d_stringBuffer.resize(d_valueIter + numRead);
+    d_input = d_stringBuffer;
+
+    return static_cast<bsl::streamsize>(numRead);
+}
+
+bsl::streamsize Tokenizer::readContiguousInput()
+{
+    BSLS_ASSERT(d_isContiguous);
+
+    bsl::size_t numRead = 0;
+    if (0 == d_readStatus && 0 == d_bufEndStatus && 0 == d_readOffset) {
+        numRead = d_contiguousInput.length();
+
+        if (!d_allowNonUtf8StringLiterals) {
+            const char *invalid = 0;
+            const IntPtr rc = bdlde::Utf8Util::numCodePointsIfValid(
+                                                    &invalid,
+                                                    d_contiguousInput.data(),
+                                                    numRead);
+            if (rc < 0) {
+                d_bufEndStatus = static_cast<int>(rc);
+                numRead        = static_cast<bsl::size_t>(
+                                           invalid - d_contiguousInput.data());
+            }
+        }
+
+        d_input = d_contiguousInput.substr(0, numRead);
+    }
+
+    if (0 == d_readStatus && 0 == numRead) {
+        d_readStatus = 0 == d_bufEndStatus ? k_EOF : d_bufEndStatus;
+    }
+
+    d_readOffset += numRead;
 
-    return static_cast<int>(numRead);
+    return static_cast<bsl::streamsize>(numRead);
 }
 
-int Tokenizer::reloadStringBuffer()
+bsl::streamsize Tokenizer::reloadStringBuffer()
 {
+    if (d_isContiguous) {
+        // As for a 'streambuf', the cursor moves to the first newly read
+        // character or, at end of input, to the end of all that was read.
+
+        d_cursor = d_input.size();
+        return readContiguousInput();                                 // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
 
     bsl::size_t numRead;
@@ -261,7 +323,16 @@ int Tokenizer::reloadStringBuffer()
     d_readOffset += numRead;
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
-    return static_cast<int>(numRead);
+    d_input = d_stringBuffer;
+    return static_cast<bsl::streamsize>(numRead);
+}
+
+void Tokenizer::releaseBlobStreamBuf()
+{
+    if (d_hasBlobStreamBuf) {
+        d_blobStreamBuf.object().~InBlobStreamBuf();
+        d_hasBlobStreamBuf = false;
+    }
 }
 
 int Tokenizer::skipNonWhitespaceOrTillToken()
@@ -269,13 +340,13 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length() &&
-               !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter]) &&
-               !bsl::strchr(g_TOKENS, d_stringBuffer[d_valueIter])) {
+        while (d_valueIter < d_input.length() &&
+               !bdlb::CharType::isSpace(d_input[d_valueIter]) &&
+               !bsl::strchr(g_TOKENS, d_input[d_valueIter])) {
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_input.length()) {
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
             // current sequence of characters being processed to the front of
@@ -283,7 +354,8 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
             // buffer to hold additional characters.
 
             if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
+                const bsl::streamsize numRead =
+                                      moveValueCharsToStartAndReloadBuffer();
                 if (0 == numRead) {
                     if (d_readStatus < 0) {
                         return -1;                                    // RETURN
@@ -315,14 +387,13 @@ int Tokenizer::skipWhitespace()
                              ? g_WHITESPACE_DEFAULT
                              : g_WHITESPACE_STRICT;
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(k_WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
+        bsl::size_t pos = d_input.find_first_not_of(k_WHITESPACE, d_cursor);
+        if (bsl::string_view::npos != pos) {
             d_cursor = pos;
             break;
         }
 
-        const int numRead = reloadStringBuffer();
+        const bsl::streamsize numRead = reloadStringBuffer();
         if (0 == numRead) {
             return -1;                                                // RETURN
         }
@@ -333,14 +404,14 @@ int Tokenizer::skipWhitespace()
 // MANIPULATORS
 int Tokenizer::advanceToNextToken()
 {
-    BSLS_ASSERT(d_streambuf_p);
+    BSLS_ASSERT(d_streambuf_p || d_isContiguous);
 
     if (e_ERROR == d_tokenType) {
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
-        const int numRead = reloadStringBuffer();
+    if (d_cursor >= d_input.size()) {
+        const bsl::streamsize numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
             return -1;                                                // RETURN
@@ -358,7 +429,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        const char  ch = d_stringBuffer[d_cursor];
+        const char  ch = d_input[d_cursor];
         switch (ch) {
 
           case '{': {
@@ -697,9 +768,33 @@ int Tokenizer::advanceToNextToken()
     return 0;
 }
 
+void Tokenizer::reset(const bdlbb::Blob *blob)
+{
+    BSLS_ASSERT(blob);
+
+    if (blob->numDataBuffers() <= 1) {
+        releaseBlobStreamBuf();
+
+        reset(bsl::string_view(
+                         blob->numDataBuffers() ? blob->buffer(0).data() : 0,
+                         blob->length()));
+        return;                                                       // RETURN
+    }
+
+    releaseBlobStreamBuf();
+    new (d_blobStreamBuf.buffer()) bdlbb::InBlobStreamBuf(blob);
+    d_hasBlobStreamBuf = true;
+
+    reset(&d_blobStreamBuf.object());
+}
+
 int Tokenizer::resetStreamBufGetPointer()
 {
-    BSLS_ASSERT(d_streambuf_p);
+    BSLS_ASSERT(d_streambuf_p || d_isContiguous);
+
+    if (d_isContiguous) {
+        return 0;                                                     // RETURN
+    }
 
     if (d_cursor >= d_stringBuffer.size()) {
         return 0;                                                     // RETURN
@@ -724,9 +819,7 @@ int Tokenizer::value(bsl::string_view *data) const
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
 
-        *data = bsl::string_view(d_stringBuffer).substr(
-                                                    d_valueBegin,
-                                                    d_valueEnd - d_valueBegin);
+        *data = d_input.substr(d_valueBegin, d_valueEnd - d_valueBegin);
 
         return 0;                                                     // RETURN
     }
@@ -19,6 +19,9 @@ BSLS_IDENT("$Id: $")
 // `bsl::streambuf` containing JSON data with a tokenizer object and then call
 // the `advanceToNextToken` function to extract individual data values.
 //
+// A tokenizer can also be `reset` to a contiguous input, either a
+// `bsl::string_view` or a `bdlbb::Blob` (see {Contiguous Input}).
+//
 // This `class` was created to be used by other components in the `bdljsn` and
 // `baljsn` packages and in most cases clients should use the
 // `bdljsn_jsonutil`, `baljsn_decoder`, or `bdljsn_datumutil` components
@@ -28,6 +31,23 @@ BSLS_IDENT("$Id: $")
 // but not all such errors are detected.  In particular, callers should check
 // that closing brackets and braces match opening ones.
 //
+///Contiguous Input
+///----------------
+// When the entire JSON document is already in memory, the tokenizer can be
+// `reset` to refer to that memory directly, rather than to a `streambuf`.  In
+// that case, no data is copied into the tokenizer's internal buffer: the
+// string references returned by `value` refer into the input itself, and
+// remain valid for as long as the input does (rather than only until the
+// next call to `advanceToNextToken`).  If the `allowNonUtf8StringLiterals`
+// option is `false`, the input is validated as UTF-8 in a single pass when
+// tokenization begins, and tokenization fails at the first invalid byte, as
+// it would if the same input were read from a `streambuf`.
+//
+// A `bdlbb::Blob` is tokenized in place if its data occupies a single data
+// buffer.  Otherwise, because tokens may straddle buffer boundaries, the
+// blob is read through a `bdlbb::InBlobStreamBuf` owned by the tokenizer, and
+// the tokenizer behaves as if `reset` to that `streambuf`.
+//
 ///Strict Conformance
 ///------------------
 // The `bdljsn::Tokenizer` class allows several convenient variances from the
@@ -165,10 +185,14 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
 #include <bdlma_bufferedsequentialallocator.h>
 
 #include <bsls_alignedbuffer.h>
 #include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
 #include <bsl_ios.h>
@@ -185,8 +209,9 @@ namespace bdljsn {
                               // ===============
 
 /// This `class` provides a mechanism for traversing JSON data stored in a
-/// `bsl::streambuf` one node at a time and allows clients to access the
-/// data associated with that node, including its type and data value.
+/// `bsl::streambuf`, or in contiguous memory, one node at a time and allows
+/// clients to access the data associated with that node, including its type
+/// and data value.
 class Tokenizer {
 
   public:
@@ -260,8 +285,26 @@ class Tokenizer {
 
     bsl::string         d_stringBuffer;     // string buffer
 
+    bsl::string_view    d_input;            // characters being tokenized;
+                                            // refers to 'd_stringBuffer', or
+                                            // to the contiguous input
+
+    bsl::string_view    d_contiguousInput;  // contiguous input (held, not
+                                            // owned), if 'd_isContiguous'
+
     bsl::streambuf     *d_streambuf_p;      // streambuf (held, not owned)
 
+    bsls::ObjectBuffer<bdlbb::InBlobStreamBuf>
+                        d_blobStreamBuf;    // streambuf over a multi-buffer
+                                            // blob, if 'd_hasBlobStreamBuf'
+
+    bool                d_hasBlobStreamBuf; // 'true' if 'd_blobStreamBuf'
+                                            // holds an object
+
+    bool                d_isContiguous;     // 'true' if tokenizing
+                                            // 'd_contiguousInput' rather than
+                                            // '*d_streambuf_p'
+
     bsl::size_t         d_cursor;           // current cursor
 
     bsl::size_t         d_valueBegin;       // cursor for beginning of value
@@ -271,9 +314,8 @@ class Tokenizer {
     bsl::size_t         d_valueIter;        // cursor for iterating value
 
     Uint64              d_readOffset;       // the offset to the end of the
-                                            // current 'd_stringBuffer'
-                                            // relative to the start of the
-                                            // streambuf
+                                            // current 'd_input' relative to
+                                            // the start of the input
 
     TokenType           d_tokenType;        // token type
 
@@ -332,6 +374,18 @@ class Tokenizer {
     /// value otherwise.
     int extractStringValue();
 
+    /// Make the contiguous input supplied to `reset` available for
+    /// tokenization, if it has not already been made available, stopping
+    /// before the first invalid UTF-8 sequence unless
+    /// `d_allowNonUtf8StringLiterals` is `true`, and update the read status
+    /// exactly as a read from a `streambuf` would.  Return the number of
+    /// bytes made available by this call.  The behavior is undefined unless
+    /// `d_isContiguous` is `true`.
+    bsl::streamsize readContiguousInput();
+
+    /// Destroy the object held by `d_blobStreamBuf`, if any.
+    void releaseBlobStreamBuf();
+
     /// Move the current sequence of characters being tokenized to the front
     /// of the internal string buffer, `d_stringBuffer`, and then append
     /// additional characters, from the internally-held `streambuf`
@@ -339,8 +393,9 @@ class Tokenizer {
     /// sequence length of `d_buffer.size()` characters.  Return the number
     /// of bytes read from the `streambuf`.  Note that if 0 is returned, it
     /// may mean end of file or, if UTF-8 checking is set, that invalid
-    /// UTF-8 was encountered.
-    int moveValueCharsToStartAndReloadBuffer();
+    /// UTF-8 was encountered.  Also note that, for contiguous input, no
+    /// characters are moved.
+    bsl::streamsize moveValueCharsToStartAndReloadBuffer();
 
     /// If the `d_contextStack` is empty, return `e_NO_CONTEXT`, otherwise
     /// pop the top context from the `d_contextStack` stack, and return it.
@@ -353,7 +408,7 @@ class Tokenizer {
     /// `streambuf` and overwriting the current buffer.  After reading
     /// update the cursor to the new read location.  Return the number of
     /// bytes read from the `streambuf`.
-    int reloadStringBuffer();
+    bsl::streamsize reloadStringBuffer();
 
     /// Skip all characters until a whitespace or a token character is
     /// encountered and position the cursor onto the first such character.
@@ -394,7 +449,7 @@ class Tokenizer {
     /// allowTrailingTopLevelComma()      == true;
     /// allowUnescapedControlCharacters() == true;
     /// ```
-    /// The `reset` method must be called before any calls to
+    /// One of the `reset` methods must be called before any calls to
     /// `advanceToNextToken` or `resetStreamBufGetPointer`.
     explicit Tokenizer(bslma::Allocator *basicAllocator = 0);
 
@@ -410,7 +465,9 @@ class Tokenizer {
     /// if doing so would advanced past a character sequence that is not
     /// valid JSON, and is guaranteed to do so (fail to move) if
     /// `e_RELAXED != conformanceMode()`.  The behavior is undefined unless
-    /// `reset` has been called.
+    /// `reset` has been called.  Note that, if this tokenizer was `reset` to
+    /// a contiguous input, string references returned by `value` are not
+    /// invalidated.
     int advanceToNextToken();
 
     /// Reset this tokenizer to read data from the specified `streambuf`.
@@ -427,6 +484,28 @@ class Tokenizer {
     /// * `allowUnescapedControlCharacters`
     void reset(bsl::streambuf *streambuf);
 
+    /// Reset this tokenizer to read data directly from the specified
+    /// contiguous `input`, without copying it (see {Contiguous Input}).
+    /// The behavior is undefined unless the memory referred to by `input`
+    /// remains valid and unmodified until this tokenizer is next `reset` or
+    /// destroyed.  Note that the reader will not be on a valid node until
+    /// `advanceToNextToken` is called.  Note that this function does not
+    /// change the `conformanceMode` nor the values of any of the individual
+    /// token options.
+    void reset(const bsl::string_view& input);
+
+    /// Reset this tokenizer to read the data in the specified `blob`.  If
+    /// the data of `blob` occupies at most one buffer, read it directly
+    /// without copying it, as if `reset` to a `bsl::string_view` referring
+    /// to that buffer; otherwise read it through a `bdlbb::InBlobStreamBuf`
+    /// owned by this tokenizer (see {Contiguous Input}).  The behavior is
+    /// undefined unless `blob` remains valid and unmodified until this
+    /// tokenizer is next `reset` or destroyed.  Note that the reader will
+    /// not be on a valid node until `advanceToNextToken` is called.  Note
+    /// that this function does not change the `conformanceMode` nor the
+    /// values of any of the individual token options.
+    void reset(const bdlbb::Blob *blob);
+
     /// Reset the get pointer of the `streambuf` held by this object to
     /// refer to the byte following the last processed byte, if the held
     /// `streambuf` supports seeking, and return an error otherwise leaving
@@ -437,7 +516,8 @@ class Tokenizer {
     /// where this object stopped.  Also note that this call implies the end
     /// of processing for this object and any subsequent methods invoked on
     /// this object should only be done after calling `reset` and specifying
-    /// a new `streambuf`.
+    /// a new `streambuf`.  If this object was `reset` to a contiguous input,
+    /// return 0 with no effect.
     int resetStreamBufGetPointer();
 
     /// Set the `allowConsecutiveSeparators` option to the specified
@@ -598,7 +678,7 @@ class Tokenizer {
     /// Return the `conformanceMode` of this tokenizer.
     ConformanceMode conformanceMode() const;
 
-    /// Return the offset of the current octet being tokenized in the stream
+    /// Return the offset of the current octet being tokenized in the input
     /// supplied to `reset`, or if an error occurred, the position where the
     /// failed attempt to tokenize a token occurred.  Note that this
     /// operation is intended to provide additional information in the case
@@ -607,8 +687,11 @@ class Tokenizer {
 
     /// Return the last read position relative to when `reset` was called.
     /// Note that `readOffset() >= currentPosition()` -- the `readOffset` is
-    /// the offset of the last octet read from the stream supplied to
+    /// the offset of the last octet read from the input supplied to
     /// `reset`, and is at or beyond the current position being tokenized.
+    /// Note that, for contiguous input, the whole input (or, if UTF-8 is
+    /// being validated, its valid prefix) is read when tokenization
+    /// begins.
     bsls::Types::Uint64 readOffset() const;
 
     /// Return the status of the last call to `reloadStringBuffer()`:
@@ -630,7 +713,9 @@ class Tokenizer {
     /// the current token's type is `e_ELEMENT_NAME` or `e_ELEMENT_VALUE` or
     /// leave `data` unmodified otherwise.  Return 0 on success and a
     /// non-zero value otherwise.  Note that the returned `data` is only
-    /// valid until the next manipulator call on this object.
+    /// valid until the next manipulator call on this object, unless this
+    /// object was `reset` to a contiguous input, in which case `data` refers
+    /// into that input.
     int value(bsl::string_view *data) const;
 };
 
@@ -675,7 +760,11 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
                    k_CONTEXTSTACKBUFSIZE,
                    basicAllocator)
 , d_stringBuffer(&d_allocator)
+, d_input()
+, d_contiguousInput()
 , d_streambuf_p(0)
+, d_hasBlobStreamBuf(false)
+, d_isContiguous(false)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -702,27 +791,45 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 inline
 Tokenizer::~Tokenizer()
 {
+    releaseBlobStreamBuf();
 }
 
 // MANIPULATORS
 inline
 void Tokenizer::reset(bsl::streambuf *streambuf)
 {
-    d_streambuf_p  = streambuf;
+    if (streambuf != d_blobStreamBuf.address()) {
+        releaseBlobStreamBuf();
+    }
+
+    d_streambuf_p     = streambuf;
     d_stringBuffer.clear();
-    d_cursor       = 0;
-    d_valueBegin   = 0;
-    d_valueEnd     = 0;
-    d_valueIter    = 0;
-    d_readOffset   = 0;
-    d_tokenType    = e_BEGIN;
-    d_readStatus   = 0;
-    d_bufEndStatus = 0;
+    d_input           = d_stringBuffer;
+    d_contiguousInput = bsl::string_view();
+    d_isContiguous    = false;
+    d_cursor          = 0;
+    d_valueBegin      = 0;
+    d_valueEnd        = 0;
+    d_valueIter       = 0;
+    d_readOffset      = 0;
+    d_tokenType       = e_BEGIN;
+    d_readStatus      = 0;
+    d_bufEndStatus    = 0;
 
     d_contextStack.clear();
     pushContext(e_NO_CONTEXT);
 }
 
+inline
+void Tokenizer::reset(const bsl::string_view& input)
+{
+    reset(static_cast<bsl::streambuf *>(0));
+
+    d_contiguousInput = input;
+    d_isContiguous    = true;
+    d_input           = bsl::string_view(input.data(), 0);
+}
+
 inline
 Tokenizer& Tokenizer::setAllowConsecutiveSeparators(bool value)
 {
@@ -862,7 +969,7 @@ Tokenizer::ConformanceMode Tokenizer::conformanceMode() const
 inline
 bsls::Types::Uint64 Tokenizer::currentPosition() const
 {
-    return d_readOffset - d_stringBuffer.size() + d_cursor;
+    return d_readOffset - d_input.size() + d_cursor;
 }
 
 inline
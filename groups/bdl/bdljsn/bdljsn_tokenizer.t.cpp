@@ -4,6 +4,10 @@
 #include <bdljsn_numberutil.h>
 #include <bdljsn_stringutil.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlde_utf8util.h>
 
 #include <bdlsb_fixedmeminstreambuf.h>
@@ -66,6 +70,8 @@ using bsl::endl;
 // MANIPULATORS
 // [ 9] int advanceToNextToken();
 // [10] void reset(bsl::streambuf &streamBuf);
+// [24] void reset(const bsl::string_view& input);
+// [24] void reset(const bdlbb::Blob *blob);
 // [13] int resetStreamBufGetPointer();
 // [20] Tokenizer& setAllowConsecutiveSeparators(bool value);
 // [15] Tokenizer& setAllowHeterogenousArrays(bool value);
@@ -90,7 +96,7 @@ using bsl::endl;
 // [ 4] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [24] USAGE EXAMPLE
+// [25] USAGE EXAMPLE
 // [ 2] CONCERN: `advanceToNextToken` FIRST CHARACTER
 // [ 4] CONCERN: `advanceToNextToken` TO `e_START_OBJECT`
 // [ 5] CONCERN: `advanceToNextToken` TO `e_NAME`
@@ -370,6 +376,60 @@ void confirmStreamBufReset(bsl::streambuf     *sb,
     }
 }
 
+/// This `struct` records the observable state of a tokenizer after a call
+/// to `advanceToNextToken`.
+struct TokenRecord {
+    int         d_rc;               // return value of `advanceToNextToken`
+    int         d_tokenType;        // `tokenType()`
+    int         d_valueRc;          // return value of `value`
+    bsl::string d_value;            // copy of the data loaded by `value`
+    Uint64      d_currentPosition;  // `currentPosition()`
+    int         d_readStatus;       // `readStatus()`
+};
+
+/// Return `true` if the specified `lhs` and `rhs` records have the same
+/// value, and `false` otherwise.  Note that `d_currentPosition` is compared
+/// only if `0 == lhs.d_rc`: when reading from a `streambuf`, the position
+/// reported after failing within a token is not adjusted for characters
+/// discarded while reading that token.
+bool operator==(const TokenRecord& lhs, const TokenRecord& rhs)
+{
+    return lhs.d_rc              == rhs.d_rc
+        && lhs.d_tokenType       == rhs.d_tokenType
+        && lhs.d_valueRc         == rhs.d_valueRc
+        && lhs.d_value           == rhs.d_value
+        && (0 != lhs.d_rc || lhs.d_currentPosition == rhs.d_currentPosition)
+        && lhs.d_readStatus      == rhs.d_readStatus;
+}
+
+/// Advance the specified `tokenizer` until it fails, appending to the
+/// specified `result` a record of the state of `tokenizer` after each
+/// advance.  If the specified `views` is not 0, append to it the string
+/// reference loaded by `value` after each advance.
+void tokenizeAll(bsl::vector<TokenRecord>      *result,
+                 bsl::vector<bsl::string_view> *views,
+                 Obj                           *tokenizer)
+{
+    int rc = 0;
+    while (0 == rc) {
+        TokenRecord      record;
+        bsl::string_view value;
+
+        rc                       = tokenizer->advanceToNextToken();
+        record.d_rc              = rc;
+        record.d_tokenType       = tokenizer->tokenType();
+        record.d_valueRc         = tokenizer->value(&value);
+        record.d_value           = value;
+        record.d_currentPosition = tokenizer->currentPosition();
+        record.d_readStatus      = tokenizer->readStatus();
+
+        result->push_back(record);
+        if (views) {
+            views->push_back(value);
+        }
+    }
+}
+
 const Utf8Util::ErrorStatus EIT = Utf8Util::k_END_OF_INPUT_TRUNCATION;
 const Utf8Util::ErrorStatus UCO = Utf8Util::k_UNEXPECTED_CONTINUATION_OCTET;
 const Utf8Util::ErrorStatus NCO = Utf8Util::k_NON_CONTINUATION_OCTET;
@@ -533,7 +593,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 24: {
+      case 25: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -665,6 +725,258 @@ int main(int argc, char *argv[])
     ASSERT(55              == address.d_floorCount);
 // ```
       } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // TESTING CONTIGUOUS INPUT
+        //
+        // Concerns:
+        // 1. Tokenizing a `bsl::string_view` yields the same sequence of
+        //    token types, values, positions, and read statuses as tokenizing
+        //    a `streambuf` holding the same data, for valid and invalid
+        //    input, under any combination of options.
+        //
+        // 2. For contiguous input, the string references loaded by `value`
+        //    refer into the input and remain valid after subsequent calls to
+        //    `advanceToNextToken`.
+        //
+        // 3. Options set after `reset`, in particular UTF-8 validation, are
+        //    honored.
+        //
+        // 4. A blob whose data occupies one buffer is tokenized in place, and
+        //    a blob of many buffers is tokenized like a `streambuf`.
+        //
+        // 5. `resetStreamBufGetPointer` succeeds, with no effect, for
+        //    contiguous input.
+        //
+        // 6. A tokenizer can be reset between the different kinds of input.
+        //
+        // Plan:
+        // 1. For a table of JSON inputs, some invalid and some longer than
+        //    the internal buffer, and for each of several option
+        //    configurations, tokenize the input from a
+        //    `bdlsb::FixedMemInStreamBuf` and record the state after each
+        //    advance.  (C-1)
+        //
+        // 2. Tokenize the same input as a `bsl::string_view`, a single-buffer
+        //    blob, and a multi-buffer blob, using one tokenizer and setting
+        //    the options after each `reset`, and verify the recorded states
+        //    match those from P-1.  (C-1, 3..4, 6)
+        //
+        // 3. For the contiguous inputs, verify that every loaded reference
+        //    lies within the input and, once tokenization ends, still has
+        //    the recorded value.  (C-2)
+        //
+        // 4. Call `resetStreamBufGetPointer` on the contiguous tokenizer and
+        //    verify it returns 0.  (C-5)
+        //
+        // Testing:
+        //   void reset(const bsl::string_view& input);
+        //   void reset(const bdlbb::Blob *blob);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTIGUOUS INPUT" << endl
+                          << "========================" << endl;
+
+        bsl::string longName(3 * 8192, 'n');
+        bsl::string longValue(2 * 8192, 'v');
+        longValue[100] = '\\';    // escaped quotes within a long value
+        longValue[101] = '"';
+        bsl::string longNumber(9000, '7');
+
+        // The reference tokenizer, reading from a `streambuf`, requires that
+        // a token too long for its internal buffer neither start within the
+        // first four bytes of the input (when checking UTF-8) nor end at the
+        // end of the input, hence the leading white space and enclosing array.
+
+        const bsl::string LONG_OBJECT = WS "{\"" + longName + "\":\"" +
+                                        longValue + "\",\"n\":" + longNumber +
+                                        "}";
+        const bsl::string LONG_ARRAY  = "[" + bsl::string(20000, ' ') +
+                                        "1," + LARGE_STRING_C_STR + "]";
+        const bsl::string LONG_NUMBER = WS "[" + longNumber + "]";
+        const bsl::string LONG_BAD    = WS "[\"" + longValue + "\xc3\"]";
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+        } DATA[] = {
+            //LINE  INPUT
+            //----  -----
+            { L_,   ""                                                     },
+            { L_,   WS                                                     },
+            { L_,   "{}"                                                   },
+            { L_,   "[]"                                                   },
+            { L_,   "{\"a\":1,\"b\":[true,false,null,\"x\\\"y\"],"
+                    "\"c\":{\"d\":-1.5e3}}"                                },
+            { L_,   WS "[1, 2, 3]" WS                                      },
+            { L_,   "123"                                                  },
+            { L_,   "\"abc\""                                              },
+            { L_,   "\"abc"                                                },
+            { L_,   "{\"a\":1},"                                           },
+            { L_,   "{\"a\"::1,,\"b\":2}"                                  },
+            { L_,   "{\"a\":\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"}"     },
+            { L_,   "{\"a\":\"\xc3\"}"                                     },
+            { L_,   "{\"a\":\"\xed\xa0\x80\"}"                             },
+            { L_,   "{\"a\":1}\xff"                                        },
+            { L_,   "[1,\xc3"                                              },
+            { L_,   "[\"\x01\"]"                                           },
+            { L_,   "{\"a\":\f1}"                                          },
+            { L_,   "{\"a\" 1}"                                            },
+            { L_,   "[1,]"                                                 },
+            { L_,   "[[[[{\"a\":[{}]}]]]]"                                 },
+            { L_,   "}"                                                    },
+            { L_,   0                                                      },
+            { L_,   0                                                      },
+            { L_,   0                                                      },
+            { L_,   0                                                      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const bsl::string *const LONG_INPUTS[] = {
+            &LONG_OBJECT, &LONG_ARRAY, &LONG_NUMBER, &LONG_BAD
+        };
+        int longIndex = 0;
+
+        enum { k_RELAXED, k_CHECK_UTF8, k_STRICT, k_NUM_CONFIGS };
+
+        bdlbb::SimpleBlobBufferFactory smallFactory(7);
+
+        Obj mX;  const Obj& X = mX;    // reused across all inputs
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const bsl::string INPUT = DATA[ti].d_input_p
+                                    ? bsl::string(DATA[ti].d_input_p)
+                                    : *LONG_INPUTS[longIndex++];
+            const bsl::size_t LEN   = INPUT.length();
+
+            if (veryVerbose) { P_(LINE) P(LEN) }
+
+            bdlbb::SimpleBlobBufferFactory bigFactory(
+                                             static_cast<int>(LEN) + 1);
+
+            bdlbb::Blob singleBlob(&bigFactory);
+            bdlbb::BlobUtil::append(&singleBlob,
+                                    INPUT.data(),
+                                    0,
+                                    static_cast<int>(LEN));
+            ASSERTV(LINE, LEN <= 1 || 1 == singleBlob.numDataBuffers());
+
+            bdlbb::Blob multiBlob(&smallFactory);
+            bdlbb::BlobUtil::append(&multiBlob,
+                                    INPUT.data(),
+                                    0,
+                                    static_cast<int>(LEN));
+
+            for (int config = 0; config < k_NUM_CONFIGS; ++config) {
+                if (veryVeryVerbose) { T_ P(config) }
+
+                // Setting options after `reset` as `baljsn::Decoder` does.
+
+                struct Configure {
+                    static void apply(Obj *tokenizer, int config)
+                    {
+                        tokenizer->setConformanceMode(Obj::e_RELAXED);
+                        tokenizer->setAllowConsecutiveSeparators(true)
+                                  .setAllowFormFeedAsWhitespace(true)
+                                  .setAllowHeterogenousArrays(true)
+                                  .setAllowNonUtf8StringLiterals(
+                                                       k_CHECK_UTF8 != config)
+                                  .setAllowStandAloneValues(true)
+                                  .setAllowTrailingTopLevelComma(true)
+                                  .setAllowUnescapedControlCharacters(true);
+                        if (k_STRICT == config) {
+                            tokenizer->setConformanceMode(
+                                                       Obj::e_STRICT_20240119);
+                        }
+                    }
+                };
+
+                bsl::vector<TokenRecord> expected;
+                {
+                    bdlsb::FixedMemInStreamBuf isb(INPUT.data(), LEN);
+
+                    Obj mY;
+                    mY.reset(&isb);
+                    Configure::apply(&mY, config);
+                    tokenizeAll(&expected, 0, &mY);
+                }
+
+                // `bsl::string_view`
+
+                {
+                    bsl::vector<TokenRecord>      actual;
+                    bsl::vector<bsl::string_view> views;
+
+                    mX.reset(bsl::string_view(INPUT));
+                    Configure::apply(&mX, config);
+                    tokenizeAll(&actual, &views, &mX);
+
+                    ASSERTV(LINE, config, expected.size(), actual.size(),
+                            expected == actual);
+
+                    for (bsl::size_t ii = 0; ii < views.size(); ++ii) {
+                        if (0 != actual[ii].d_valueRc) {
+                            continue;                               // CONTINUE
+                        }
+                        ASSERTV(LINE, config, ii,
+                                INPUT.data() <= views[ii].data() &&
+                                views[ii].data() + views[ii].length() <=
+                                                         INPUT.data() + LEN);
+                        ASSERTV(LINE, config, ii,
+                                actual[ii].d_value == views[ii]);
+                    }
+
+                    ASSERTV(LINE, config, X.readOffset(),
+                            X.readOffset() <= LEN);
+
+                    ASSERTV(LINE, config, 0 == mX.resetStreamBufGetPointer());
+                }
+
+                // single-buffer `bdlbb::Blob`
+
+                {
+                    bsl::vector<TokenRecord>      actual;
+                    bsl::vector<bsl::string_view> views;
+
+                    mX.reset(&singleBlob);
+                    Configure::apply(&mX, config);
+                    tokenizeAll(&actual, &views, &mX);
+
+                    ASSERTV(LINE, config, expected == actual);
+
+                    const char *BEGIN = singleBlob.numDataBuffers()
+                                      ? singleBlob.buffer(0).data()
+                                      : 0;
+                    for (bsl::size_t ii = 0; ii < views.size(); ++ii) {
+                        if (0 == actual[ii].d_valueRc) {
+                            ASSERTV(LINE, config, ii,
+                                    BEGIN <= views[ii].data() &&
+                                    views[ii].data() < BEGIN + LEN);
+                        }
+                    }
+                }
+
+                // multi-buffer `bdlbb::Blob`
+
+                {
+                    bsl::vector<TokenRecord> actual;
+
+                    mX.reset(&multiBlob);
+                    Configure::apply(&mX, config);
+                    tokenizeAll(&actual, 0, &mX);
+
+                    ASSERTV(LINE, config, expected == actual);
+                }
+            }
+
+            // `mX` must not refer to `multiBlob` once it is destroyed.
+
+            mX.reset(bsl::string_view());
+        }
+        ASSERT(4 == longIndex);
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // TESTING `conformanceMode`
@@ -0,0 +1,704 @@
+// bdlma_threadcachingmultipoolallocator.cpp                          -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_concurrentpool.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_bslexceptionutil.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+
+#include <new>           // placement 'new'
+
+///IMPLEMENTATION NOTES
+///--------------------
+// A block that is free, and owned by a thread cache or a depot, is linked
+// through a 'FreeBlock' stored over its 'Header' (which is at least as large
+// as two pointers).  The free blocks of a given pool are kept in *batches* of
+// exactly 'batchSize(pool)' blocks, linked through 'd_next_p'; the depot of
+// each pool is a stack of batches, linked through the 'd_nextBatch_p' of the
+// first block of each batch.
+//
+// The cache of a thread keeps, for each pool, a list of up to 'batchSize'
+// blocks ('d_head_p', counted by 'd_count') and at most one spare full batch
+// ('d_spare_p').  An allocation pops 'd_head_p'; if it is empty, the spare
+// batch (or, failing that, a batch from the depot, or a batch of newly
+// allocated blocks) becomes the new list.  A deallocation pushes onto
+// 'd_head_p'; once the list holds a whole batch, the list becomes the spare
+// batch, and the previous spare batch (if any) is pushed to the depot.  This
+// hysteresis ensures that a thread alternating between allocating and
+// deallocating a block at a batch boundary does not visit the depot on every
+// call.
+//
+// The caches themselves are never deallocated before the allocator: on
+// thread exit, a cache is emptied and marked unclaimed, and is claimed by the
+// next thread that needs a cache, so that the number of caches is bounded by
+// the maximum number of threads that have used the allocator concurrently.
+
+namespace BloombergLP {
+
+enum {
+    k_DEFAULT_NUM_POOLS      = 10,
+    k_DEFAULT_MAX_CHUNK_SIZE = 32,
+    k_MIN_BLOCK_SIZE         = 8,
+
+    k_LOG2_MIN_BLOCK_SIZE    = 3,
+    k_LOG2_BATCH_BYTES       = 14,   // approximate bytes in a batch
+    k_MIN_BATCH_SIZE         = 4,
+    k_MAX_BATCH_SIZE         = 32
+};
+
+namespace {
+
+/// This `struct` overlays the header of a free memory block owned by a
+/// thread cache or a depot.
+struct FreeBlock {
+
+    // DATA
+    FreeBlock *d_next_p;       // next block in the same batch
+
+    FreeBlock *d_nextBatch_p;  // first block of the next batch in a depot;
+                               // meaningful only for the first block of a
+                               // batch in a depot
+};
+
+/// Return the number of blocks in a batch of free blocks of the pool having
+/// the specified `pool` index.
+inline
+int batchSize(int pool)
+{
+    const int shift = pool + k_LOG2_MIN_BLOCK_SIZE;
+    if (shift >= k_LOG2_BATCH_BYTES - 2) {
+        return k_MIN_BATCH_SIZE;                                      // RETURN
+    }
+    const int size = 1 << (k_LOG2_BATCH_BYTES - shift);
+    return size < k_MAX_BATCH_SIZE ? size : k_MAX_BATCH_SIZE;
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                 // ===========================================
+                 // class ThreadCachingMultipoolAllocator_Cache
+                 // ===========================================
+
+/// This component-private class holds the free blocks cached by one thread
+/// for each pool of a `ThreadCachingMultipoolAllocator`.  The per-pool
+/// state is stored immediately following the object.
+class ThreadCachingMultipoolAllocator_Cache {
+
+  public:
+    // PUBLIC TYPES
+
+    /// This `struct` holds the blocks cached by a thread for one pool.
+    struct PoolCache {
+        FreeBlock *d_head_p;     // blocks available to the owning thread
+
+        int        d_count;      // number of blocks in `d_head_p`
+
+        int        d_batchSize;  // number of blocks in a batch
+
+        FreeBlock *d_spare_p;    // full batch, or 0
+    };
+
+    // PUBLIC DATA
+    bsls::AtomicInt                        d_isClaimed;
+                                               // 1 if owned by a thread
+
+    ThreadCachingMultipoolAllocator_Cache *d_nextCache_p;
+                                               // next cache of the allocator
+
+    ThreadCachingMultipoolAllocator       *d_allocator_p;
+                                               // allocator owning this cache
+                                               // (held, not owned)
+
+    // CREATORS
+
+    /// Create an empty, claimed cache for the specified `numPools` pools of
+    /// the specified `allocator`.  The behavior is undefined unless the
+    /// footprint of this object is followed by storage for `numPools`
+    /// `PoolCache` objects.
+    ThreadCachingMultipoolAllocator_Cache(
+                                  ThreadCachingMultipoolAllocator *allocator,
+                                  int                              numPools)
+    : d_isClaimed(1)
+    , d_nextCache_p(0)
+    , d_allocator_p(allocator)
+    {
+        for (int i = 0; i < numPools; ++i) {
+            PoolCache& poolCache = pools()[i];
+            poolCache.d_head_p    = 0;
+            poolCache.d_count     = 0;
+            poolCache.d_batchSize = batchSize(i);
+            poolCache.d_spare_p   = 0;
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Return the address of the per-pool state of this cache.
+    PoolCache *pools()
+    {
+        return reinterpret_cast<PoolCache *>(this + 1);
+    }
+};
+
+                 // ===========================================
+                 // class ThreadCachingMultipoolAllocator_Depot
+                 // ===========================================
+
+/// This component-private class holds the batches of free blocks of one
+/// pool of a `ThreadCachingMultipoolAllocator` that are shared by all
+/// threads.
+class ThreadCachingMultipoolAllocator_Depot {
+
+  public:
+    // PUBLIC DATA
+    bslmt::Mutex  d_mutex;      // protects `d_batches_p`
+
+    FreeBlock    *d_batches_p;  // stack of full batches
+
+    char          d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                // separate the depots of adjacent pools
+
+    // CREATORS
+
+    /// Create an empty depot.
+    ThreadCachingMultipoolAllocator_Depot()
+    : d_batches_p(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Return the first block of a batch removed from this depot, or 0 if
+    /// this depot is empty.
+    FreeBlock *popBatch()
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        FreeBlock *batch = d_batches_p;
+        if (batch) {
+            d_batches_p = batch->d_nextBatch_p;
+        }
+        return batch;
+    }
+
+    /// Add the batch starting with the specified `batch` to this depot.
+    void pushBatch(FreeBlock *batch)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        batch->d_nextBatch_p = d_batches_p;
+        d_batches_p          = batch;
+    }
+};
+
+                  // -------------------------------------
+                  // class ThreadCachingMultipoolAllocator
+                  // -------------------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachingMultipoolAllocator::releaseCache(void *cache)
+{
+    Cache                           *cachePtr  = static_cast<Cache *>(cache);
+    ThreadCachingMultipoolAllocator *allocator = cachePtr->d_allocator_p;
+
+    for (int i = 0; i < allocator->d_numPools; ++i) {
+        Cache::PoolCache& poolCache = cachePtr->pools()[i];
+
+        if (poolCache.d_spare_p) {
+            allocator->d_depots_p[i].pushBatch(poolCache.d_spare_p);
+            poolCache.d_spare_p = 0;
+        }
+
+        // A partial batch cannot be added to the depot, so its blocks are
+        // returned to the pool.
+
+        while (poolCache.d_head_p) {
+            FreeBlock *block = poolCache.d_head_p;
+            poolCache.d_head_p = block->d_next_p;
+            allocator->d_pools_p[i].deallocate(block);
+        }
+        poolCache.d_count = 0;
+    }
+
+    cachePtr->d_isClaimed.storeRelease(0);
+}
+
+// PRIVATE MANIPULATORS
+void *ThreadCachingMultipoolAllocator::allocateBlock(int pool)
+{
+    Cache *cache = localCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return d_pools_p[pool].allocate();                            // RETURN
+    }
+
+    Cache::PoolCache& poolCache = cache->pools()[pool];
+
+    FreeBlock *block = poolCache.d_head_p;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != block)) {
+        poolCache.d_head_p = block->d_next_p;
+        --poolCache.d_count;
+        return block;                                                 // RETURN
+    }
+
+    block = poolCache.d_spare_p;
+    if (block) {
+        poolCache.d_spare_p = 0;
+    }
+    else {
+        block = d_depots_p[pool].popBatch();
+    }
+
+    if (block) {
+        poolCache.d_head_p = block->d_next_p;
+        poolCache.d_count  = poolCache.d_batchSize - 1;
+        return block;                                                 // RETURN
+    }
+
+    // Both the cache and the depot are empty: fill the cache with a batch of
+    // blocks from the pool.  The blocks are added to the cache one at a time
+    // so that none is lost if the pool fails to replenish.
+
+    for (int i = 1; i < poolCache.d_batchSize; ++i) {
+        block = static_cast<FreeBlock *>(d_pools_p[pool].allocate());
+        block->d_next_p    = poolCache.d_head_p;
+        poolCache.d_head_p = block;
+        ++poolCache.d_count;
+    }
+    return d_pools_p[pool].allocate();
+}
+
+void ThreadCachingMultipoolAllocator::deallocateBlock(void *block, int pool)
+{
+    Cache *cache = localCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_pools_p[pool].deallocate(block);
+        return;                                                       // RETURN
+    }
+
+    Cache::PoolCache& poolCache = cache->pools()[pool];
+
+    FreeBlock *freeBlock = static_cast<FreeBlock *>(block);
+    freeBlock->d_next_p = poolCache.d_head_p;
+    poolCache.d_head_p  = freeBlock;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                               ++poolCache.d_count < poolCache.d_batchSize)) {
+        return;                                                       // RETURN
+    }
+
+    // The list holds a whole batch: keep it as the spare batch, and hand the
+    // previous spare batch, if any, to the depot.
+
+    FreeBlock *fullBatch = poolCache.d_spare_p;
+
+    poolCache.d_spare_p = poolCache.d_head_p;
+    poolCache.d_head_p  = 0;
+    poolCache.d_count   = 0;
+
+    if (fullBatch) {
+        d_depots_p[pool].pushBatch(fullBatch);
+    }
+}
+
+void ThreadCachingMultipoolAllocator::initialize(
+                     const bsls::BlockGrowth::Strategy *growthStrategyArray,
+                     bsls::BlockGrowth::Strategy        growthStrategy,
+                     const int                         *maxBlocksPerChunkArray,
+                     int                                maxBlocksPerChunk)
+{
+    BSLS_ASSERT(1 <= d_numPools);
+
+    BSLMF_ASSERT(sizeof(FreeBlock) <= sizeof(Header));
+
+    d_maxBlockSize = k_MIN_BLOCK_SIZE;
+
+    d_pools_p = static_cast<ConcurrentPool *>(
+                      d_allocAdapter.allocate(d_numPools * sizeof *d_pools_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                              d_pools_p,
+                                                              &d_allocAdapter);
+    bslma::AutoDestructor<ConcurrentPool> autoDtor(d_pools_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDtor) {
+        new (d_pools_p + i) ConcurrentPool(
+                      d_maxBlockSize + static_cast<int>(sizeof(Header)),
+                      growthStrategyArray ? growthStrategyArray[i]
+                                          : growthStrategy,
+                      maxBlocksPerChunkArray ? maxBlocksPerChunkArray[i]
+                                             : maxBlocksPerChunk,
+                      &d_allocAdapter);
+
+        BSLS_ASSERT(d_maxBlockSize <=
+                       bsl::numeric_limits<bsls::Types::size_type>::max() / 2);
+
+        d_maxBlockSize *= 2;
+    }
+
+    d_maxBlockSize /= 2;
+
+    d_depots_p = static_cast<Depot *>(
+                     d_allocAdapter.allocate(d_numPools * sizeof *d_depots_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoDepotsDeallocator(
+                                                              d_depots_p,
+                                                              &d_allocAdapter);
+
+    for (int i = 0; i < d_numPools; ++i) {
+        new (d_depots_p + i) Depot();
+    }
+
+    d_isCaching = 0 == bslmt::ThreadUtil::createKey(&d_cacheKey,
+                                                    &releaseCache);
+
+    autoDepotsDeallocator.release();
+    autoDtor.release();
+    autoPoolsDeallocator.release();
+}
+
+ThreadCachingMultipoolAllocator::Cache *
+ThreadCachingMultipoolAllocator::localCache()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_isCaching)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    void *cache = bslmt::ThreadUtil::getSpecific(d_cacheKey);
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        return static_cast<Cache *>(cache);                           // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // Claim a cache released by an exited thread, if any.
+
+    Cache *result = d_caches.loadAcquire();
+    while (result && 0 != result->d_isClaimed.testAndSwap(0, 1)) {
+        result = result->d_nextCache_p;
+    }
+
+    if (0 == result) {
+        void *storage = d_allocAdapter.allocate(
+                                   sizeof(Cache)
+                                 + d_numPools * sizeof(Cache::PoolCache));
+
+        result = new (storage) Cache(this, d_numPools);
+
+        Cache *head = d_caches.loadRelaxed();
+        for (;;) {
+            result->d_nextCache_p = head;
+
+            Cache *prev = d_caches.testAndSwapAcqRel(head, result);
+            if (prev == head) {
+                break;
+            }
+            head = prev;
+        }
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_cacheKey, result)) {
+        // Without thread-specific storage the cache could not be released
+        // when this thread exits, so bypass it.
+
+        result->d_isClaimed.storeRelease(0);
+        return 0;                                                     // RETURN
+    }
+    return result;
+}
+
+// PRIVATE ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::findPool(
+                                             bsls::Types::size_type size) const
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+// CREATORS
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(k_DEFAULT_NUM_POOLS)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(0,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               0,
+               k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(0,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               0,
+               k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                   bsls::BlockGrowth::Strategy  growthStrategy,
+                                   bslma::Allocator            *basicAllocator)
+: d_numPools(k_DEFAULT_NUM_POOLS)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(0, growthStrategy, 0, k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                   int                          numPools,
+                                   bsls::BlockGrowth::Strategy  growthStrategy,
+                                   bslma::Allocator            *basicAllocator)
+: d_numPools(numPools)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(0, growthStrategy, 0, k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                int                          numPools,
+                                bsls::BlockGrowth::Strategy  growthStrategy,
+                                int                          maxBlocksPerChunk,
+                                bslma::Allocator            *basicAllocator)
+: d_numPools(numPools)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(0, growthStrategy, 0, maxBlocksPerChunk);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                        int                                numPools,
+                        const bsls::BlockGrowth::Strategy *growthStrategyArray,
+                        bslma::Allocator                  *basicAllocator)
+: d_numPools(numPools)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(growthStrategyArray,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               0,
+               k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                        int                                numPools,
+                        const bsls::BlockGrowth::Strategy *growthStrategyArray,
+                        int                                maxBlocksPerChunk,
+                        bslma::Allocator                  *basicAllocator)
+: d_numPools(numPools)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(growthStrategyArray,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               0,
+               maxBlocksPerChunk);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                     int                                numPools,
+                     bsls::BlockGrowth::Strategy        growthStrategy,
+                     const int                         *maxBlocksPerChunkArray,
+                     bslma::Allocator                  *basicAllocator)
+: d_numPools(numPools)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(0, growthStrategy, maxBlocksPerChunkArray, 0);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                     int                                numPools,
+                     const bsls::BlockGrowth::Strategy *growthStrategyArray,
+                     const int                         *maxBlocksPerChunkArray,
+                     bslma::Allocator                  *basicAllocator)
+: d_numPools(numPools)
+, d_isCaching(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(growthStrategyArray,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               maxBlocksPerChunkArray,
+               0);
+}
+
+ThreadCachingMultipoolAllocator::~ThreadCachingMultipoolAllocator()
+{
+    // Delete the key first, so that 'releaseCache' is no longer invoked for
+    // threads that exit.
+
+    if (d_isCaching) {
+        bslmt::ThreadUtil::deleteKey(d_cacheKey);
+    }
+
+    Cache *cache = d_caches.loadAcquire();
+    while (cache) {
+        Cache *next = cache->d_nextCache_p;
+        d_allocAdapter.deallocate(cache);
+        cache = next;
+    }
+
+    d_blockList.release();
+    for (int i = 0; i < d_numPools; ++i) {
+        d_depots_p[i].~Depot();
+        d_pools_p[i].release();
+        d_pools_p[i].~ConcurrentPool();
+    }
+    d_allocAdapter.deallocate(d_depots_p);
+    d_allocAdapter.deallocate(d_pools_p);
+}
+
+// MANIPULATORS
+void *ThreadCachingMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size)) {
+        if (size <= d_maxBlockSize) {
+            const int pool = findPool(size);
+
+            Header *p = static_cast<Header *>(allocateBlock(pool));
+
+            p->d_header.d_poolIdx = pool;
+
+            return p + 1;                                             // RETURN
+        }
+
+        // The requested size is large and will not be pooled.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        Header *p = static_cast<Header *>(
+                d_blockList.allocate(size + static_cast<int>(sizeof(Header))));
+
+        p->d_header.d_poolIdx = -1;
+
+        return p + 1;                                                 // RETURN
+    }
+
+    return 0;
+}
+
+void ThreadCachingMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    const int pool = h->d_header.d_poolIdx;
+
+    if (-1 == pool) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_blockList.deallocate(h);
+    }
+    else {
+        deallocateBlock(h, pool);
+    }
+}
+
+void ThreadCachingMultipoolAllocator::release()
+{
+    // Forget the blocks held by every cache and depot; their memory is
+    // reclaimed by releasing the pools.
+
+    for (Cache *cache = d_caches.loadAcquire();
+         cache;
+         cache = cache->d_nextCache_p) {
+        for (int i = 0; i < d_numPools; ++i) {
+            Cache::PoolCache& poolCache = cache->pools()[i];
+
+            poolCache.d_head_p  = 0;
+            poolCache.d_count   = 0;
+            poolCache.d_spare_p = 0;
+        }
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        d_depots_p[i].d_batches_p = 0;
+        d_pools_p[i].release();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_blockList.release();
+}
+
+void ThreadCachingMultipoolAllocator::reserveCapacity(
+                                           bsls::Types::size_type size,
+                                           int                    numBlocks)
+{
+    BSLS_ASSERT(0 <= numBlocks);
+    BSLS_ASSERT(size <= d_maxBlockSize);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size)) {
+        const int pool = findPool(size);
+        d_pools_p[pool].reserveCapacity(numBlocks);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,485 @@
+// bdlma_threadcachingmultipoolallocator.h                            -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingMultipoolAllocator: thread-caching multipool allocator
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides an allocator,
+// `bdlma::ThreadCachingMultipoolAllocator`, that implements the
+// `bdlma::ManagedAllocator` protocol and that can be used as a drop-in
+// replacement for `bdlma::ConcurrentMultipoolAllocator`.  Like that
+// allocator, it maintains a configurable number of `bdlma::ConcurrentPool`
+// objects, each dispensing memory blocks of a unique size, with each
+// successive pool managing memory blocks of a size twice that of the previous
+// pool, and a separately managed list of blocks too large to be pooled.  Both
+// the `release` method and the destructor release all memory currently
+// allocated via the object.
+// ```
+//  ,--------------------------------------.
+// ( bdlma::ThreadCachingMultipoolAllocator )
+//  `--------------------------------------'
+//              |         ctor/dtor
+//              |         maxPooledBlockSize
+//              |         numPools
+//              |         reserveCapacity
+//              V
+//   ,-----------------------.
+//  ( bdlma::ManagedAllocator )
+//   `-----------------------'
+//              |         release
+//              V
+//      ,-----------------.
+//     (  bslma::Allocator )
+//      `-----------------'
+//                       allocate
+//                       deallocate
+// ```
+//
+///Thread Caching
+///--------------
+// Each `bdlma::ConcurrentPool` keeps its free blocks on a single, atomically
+// updated list, so that every allocation and deallocation of a given size, on
+// every thread, contends on the same cache line.  A
+// `bdlma::ThreadCachingMultipoolAllocator` instead keeps, for each thread that
+// uses it and for each pool, a small cache of free blocks that is accessed
+// without synchronization:
+//
+// - An allocation takes a block from the cache of the calling thread.  An
+//   empty cache is refilled with a whole batch of blocks, taken (under a
+//   lock) from a shared per-pool *depot* of batches or, if the depot is
+//   empty, allocated from the pool.
+// - A deallocation returns the block to the cache of the calling thread.  A
+//   full cache hands a whole batch of blocks back to the depot.
+//
+// The number of blocks in a batch decreases with the block size of the pool
+// (from 32 blocks for small blocks to 4 blocks for the largest default
+// block size), bounding the memory held by the cache of each thread.  Blocks
+// therefore migrate between threads in batches, so that a producer thread
+// allocating blocks that are deallocated by a consumer thread acquires a lock
+// only once per batch on either side.  When a thread exits, the blocks in its
+// cache are returned to the depot and to the pools, and the cache is reused by
+// the next thread that uses the allocator.
+//
+// The per-thread caches are located using thread-specific storage: each
+// allocator consumes one thread-specific storage key (see `bslmt_threadutil`)
+// for its lifetime.  Since the number of such keys is limited, this allocator
+// is intended for long-lived allocators shared by several threads, rather
+// than for large numbers of short-lived allocators.  If a key cannot be
+// obtained, the allocator forgoes caching and behaves like a
+// `bdlma::ConcurrentMultipoolAllocator`.
+//
+///Thread Safety
+///-------------
+// `bdlma::ThreadCachingMultipoolAllocator` is *fully thread-safe*, meaning
+// any operation on the same object can be safely invoked from any thread,
+// except for `release`, which must not be invoked while other threads use the
+// allocator.
+//
+///Configuration at Construction
+///-----------------------------
+// The number of pools, the growth strategy of the pools, the maximum number of
+// blocks per chunk, and the basic allocator are configured exactly as for
+// `bdlma::ConcurrentMultipoolAllocator` (see
+// {`bdlma_concurrentmultipoolallocator`}), and the constructors of both
+// allocators take the same arguments.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handing Off Objects Between Threads
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that worker threads build messages that are consumed, and
+// destroyed, by a different thread.  Memory for the messages is allocated on
+// one thread and deallocated on another, so that a single allocator must be
+// shared by all threads.
+//
+// First, we define a simple, mutex-protected queue of strings, and a function
+// that fills the queue from a worker thread:
+// ```
+// struct MessageQueue {
+//     bslmt::Mutex               d_mutex;
+//     bsl::vector<bsl::string *> d_messages;
+//     bslma::Allocator          *d_allocator_p;
+// };
+//
+// extern "C" void *produceMessages(void *arg)
+// {
+//     MessageQueue *queue = static_cast<MessageQueue *>(arg);
+//
+//     for (int i = 0; i < 100; ++i) {
+//         bsl::string *message = new (*queue->d_allocator_p) bsl::string(
+//                                 "a message that is long enough to allocate",
+//                                 queue->d_allocator_p);
+//
+//         bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+//         queue->d_messages.push_back(message);
+//     }
+//     return 0;
+// }
+// ```
+// Then, we create a thread-caching multipool allocator and share it among
+// several producer threads:
+// ```
+// bdlma::ThreadCachingMultipoolAllocator allocator;
+//
+// MessageQueue queue;
+// queue.d_allocator_p = &allocator;
+//
+// bslmt::ThreadUtil::Handle handles[4];
+// for (int i = 0; i < 4; ++i) {
+//     bslmt::ThreadUtil::create(&handles[i], produceMessages, &queue);
+// }
+// for (int i = 0; i < 4; ++i) {
+//     bslmt::ThreadUtil::join(handles[i]);
+// }
+// assert(400 == queue.d_messages.size());
+// ```
+// Finally, the main thread consumes the messages, returning their memory to
+// its own cache, from which it is handed back, in batches, to the depot:
+// ```
+// for (bsl::size_t i = 0; i < queue.d_messages.size(); ++i) {
+//     allocator.deleteObject(queue.d_messages[i]);
+// }
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_concurrentallocatoradapter.h>
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+class ConcurrentPool;
+
+class ThreadCachingMultipoolAllocator_Cache;
+class ThreadCachingMultipoolAllocator_Depot;
+
+                  // =====================================
+                  // class ThreadCachingMultipoolAllocator
+                  // =====================================
+
+/// This class implements the `bdlma::ManagedAllocator` protocol to provide
+/// a thread-safe allocator that maintains a configurable number of
+/// `ConcurrentPool` objects, each dispensing memory blocks of a unique size,
+/// fronted by per-thread caches of free blocks.  The pools are placed in an
+/// array, with each successive pool managing memory blocks of size twice
+/// that of the previous pool.  Each allocation (deallocation) request
+/// allocates memory from (returns memory to) the cache of the calling
+/// thread for the pool having the smallest block size not less than the
+/// requested size, or, if no pool manages memory blocks of sufficient size,
+/// from a separately managed list of memory blocks.  Both the `release`
+/// method and the destructor of a `ThreadCachingMultipoolAllocator` release
+/// all memory currently allocated via the object.
+class ThreadCachingMultipoolAllocator : public ManagedAllocator {
+
+    // PRIVATE TYPES
+
+    /// This `struct` provides header information for each allocated memory
+    /// block.  The header stores the index to the pool used for the memory
+    /// allocation.
+    struct Header {
+
+        union {
+            int                    d_poolIdx;  // pool used for this memory
+                                               // block
+
+            bsls::AlignmentUtil::MaxAlignedType
+                                   d_dummy;    // force maximum alignment
+        } d_header;
+    };
+
+    typedef ThreadCachingMultipoolAllocator_Cache Cache;
+    typedef ThreadCachingMultipoolAllocator_Depot Depot;
+
+    // DATA
+    ConcurrentPool        *d_pools_p;       // array of memory pools, each
+                                            // dispensing fixed-size memory
+                                            // blocks
+
+    Depot                 *d_depots_p;      // array of depots of batches of
+                                            // free blocks, one per pool
+
+    int                    d_numPools;      // number of memory pools
+
+    bsls::Types::size_type d_maxBlockSize;  // largest memory block size;
+                                            // dispensed by the
+                                            // `d_numPools - 1`th pool; always
+                                            // a power of 2
+
+    bslmt::ThreadUtil::Key d_cacheKey;      // key of the cache of the
+                                            // calling thread
+
+    bool                   d_isCaching;     // `true` if `d_cacheKey` was
+                                            // created, and blocks are cached
+                                            // per thread
+
+    bsls::AtomicPointer<Cache>
+                           d_caches;        // list of all per-thread caches
+
+    BlockList              d_blockList;     // memory manager for "large"
+                                            // memory blocks
+
+    bslmt::Mutex           d_mutex;         // synchronize data access
+
+    ConcurrentAllocatorAdapter
+                           d_allocAdapter;  // thread-safe adapter
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingMultipoolAllocator(const ThreadCachingMultipoolAllocator&);
+    ThreadCachingMultipoolAllocator& operator=(
+                                       const ThreadCachingMultipoolAllocator&);
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the blocks cached by the `Cache` at the specified `cache`
+    /// address to their allocator, and make the cache available to other
+    /// threads.  This function is invoked on the exit of the thread owning
+    /// `cache`.
+    static void releaseCache(void *cache);
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the address of a free block, without header, from the pool
+    /// having the specified `pool` index, refilling the cache of the
+    /// calling thread if it is empty.
+    void *allocateBlock(int pool);
+
+    /// Return the specified `block`, without header, allocated from the
+    /// pool having the specified `pool` index, to the cache of the calling
+    /// thread.
+    void deallocateBlock(void *block, int pool);
+
+    /// Initialize this allocator with the growth strategy specified by
+    /// either the `growthStrategyArray` if it is not 0, or `growthStrategy`
+    /// otherwise, and with the maximum number of blocks per chunk specified
+    /// by either the `maxBlocksPerChunkArray` if it is not 0, or
+    /// `maxBlocksPerChunk` otherwise.
+    void initialize(const bsls::BlockGrowth::Strategy *growthStrategyArray,
+                    bsls::BlockGrowth::Strategy        growthStrategy,
+                    const int                         *maxBlocksPerChunkArray,
+                    int                                maxBlocksPerChunk);
+
+    /// Return the cache of the calling thread, creating one (or claiming a
+    /// cache released by an exited thread) if the calling thread has none,
+    /// or 0 if blocks are not cached per thread by this allocator.
+    Cache *localCache();
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the memory pool in this allocator for an
+    /// allocation request of the specified `size` (in bytes).  Note that
+    /// the index of the memory pool managing memory blocks having the
+    /// minimum block size is 0.
+    int findPool(bsls::Types::size_type size) const;
+
+  public:
+    // CREATORS
+
+    /// Create a thread-caching multipool allocator.  Optionally specify
+    /// `numPools`, indicating the number of internally created
+    /// `ConcurrentPool` objects; the block size of the first pool is 8
+    /// bytes, with the block size of each additional pool successively
+    /// doubling.  If `numPools` is not specified, an implementation-defined
+    /// number of pools `N` -- covering memory blocks ranging in size from
+    /// `2^3 = 8` to `2^(N+2)` -- are created.  Optionally specify a
+    /// `growthStrategy` indicating whether the number of blocks allocated
+    /// at once for every internally created pool should be either fixed or
+    /// grow geometrically, starting with 1.  If `growthStrategy` is not
+    /// specified, the allocation strategy for each internally created pool
+    /// is geometric, starting from 1.  If `numPools` is specified,
+    /// optionally specify a `maxBlocksPerChunk`, indicating the maximum
+    /// number of blocks to be allocated at once when a pool must be
+    /// replenished.  If `maxBlocksPerChunk` is not specified, an
+    /// implementation-defined value is used.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `1 <= numPools` and `1 <= maxBlocksPerChunk`.
+    explicit ThreadCachingMultipoolAllocator(
+                                         bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingMultipoolAllocator(
+                                         int               numPools,
+                                         bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingMultipoolAllocator(
+                              bsls::BlockGrowth::Strategy  growthStrategy,
+                              bslma::Allocator            *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(
+                              int                          numPools,
+                              bsls::BlockGrowth::Strategy  growthStrategy,
+                              bslma::Allocator            *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(
+                              int                          numPools,
+                              bsls::BlockGrowth::Strategy  growthStrategy,
+                              int                          maxBlocksPerChunk,
+                              bslma::Allocator            *basicAllocator = 0);
+
+    /// Create a thread-caching multipool allocator having the specified
+    /// `numPools`, indicating the number of internally created
+    /// `ConcurrentPool` objects; the block size of the first pool is 8
+    /// bytes, with the block size of each additional pool successively
+    /// doubling.  Optionally specify a `growthStrategy` indicating whether
+    /// the number of blocks allocated at once for every internally created
+    /// pool should be either fixed or grow geometrically, starting with 1.
+    /// If `growthStrategy` is not specified, optionally specify
+    /// `growthStrategyArray`, indicating the strategies for each individual
+    /// pool.  If neither `growthStrategy` nor `growthStrategyArray` are
+    /// specified, the allocation strategy for each internally created pool
+    /// will grow geometrically, starting from 1.  Optionally specify a
+    /// `maxBlocksPerChunk`, indicating the maximum number of blocks to be
+    /// allocated at once when a pool must be replenished.  If
+    /// `maxBlocksPerChunk` is not specified, optionally specify
+    /// `maxBlocksPerChunkArray`, indicating the maximum number of blocks to
+    /// allocate at once for each individual pool.  If neither
+    /// `maxBlocksPerChunk` nor `maxBlocksPerChunkArray` are specified, an
+    /// implementation-defined value is used.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `1 <= numPools`, `growthStrategyArray` has at least
+    /// `numPools` strategies, `1 <= maxBlocksPerChunk`, and
+    /// `maxBlocksPerChunkArray` has at least `numPools` positive values.
+    ThreadCachingMultipoolAllocator(
+                     int                                numPools,
+                     const bsls::BlockGrowth::Strategy *growthStrategyArray,
+                     bslma::Allocator                  *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(
+                     int                                numPools,
+                     const bsls::BlockGrowth::Strategy *growthStrategyArray,
+                     int                                maxBlocksPerChunk,
+                     bslma::Allocator                  *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(
+                     int                                numPools,
+                     bsls::BlockGrowth::Strategy        growthStrategy,
+                     const int                         *maxBlocksPerChunkArray,
+                     bslma::Allocator                  *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(
+                     int                                numPools,
+                     const bsls::BlockGrowth::Strategy *growthStrategyArray,
+                     const int                         *maxBlocksPerChunkArray,
+                     bslma::Allocator                  *basicAllocator = 0);
+
+    /// Destroy this allocator.  All memory allocated from this allocator is
+    /// released.  The behavior is undefined if this allocator is in use by
+    /// any other thread.
+    ~ThreadCachingMultipoolAllocator() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Return the address of a contiguous block of maximally-aligned memory
+    /// of (at least) the specified `size` (in bytes).  If
+    /// `size > maxPooledBlockSize()`, the memory allocation is managed
+    /// directly by the underlying allocator, and will not be pooled, but
+    /// will be deallocated when the `release` method is called, or when
+    /// this object is destroyed.  If `size` is 0, no memory is allocated
+    /// and 0 is returned.
+    void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+
+    /// Relinquish the memory block at the specified `address` back to this
+    /// allocator for reuse.  The block need not be deallocated by the
+    /// thread that allocated it.  If `address` is 0, this method has no
+    /// effect.  The behavior is undefined unless `address` was allocated by
+    /// this allocator, and has not already been deallocated.
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+
+    /// Relinquish all memory currently allocated via this allocator,
+    /// including the blocks cached by every thread.  The behavior is
+    /// undefined if this method is invoked while any other thread uses this
+    /// allocator.
+    void release() BSLS_KEYWORD_OVERRIDE;
+
+    /// Reserve memory from this allocator to satisfy memory requests for at
+    /// least the specified `numBlocks` having the specified `size` (in
+    /// bytes) before the pool replenishes.  If `size` is 0, this method has
+    /// no effect.  The behavior is undefined unless
+    /// `size <= maxPooledBlockSize()` and `0 <= numBlocks`.
+    void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+
+    // ACCESSORS
+
+    /// Return `true` if blocks are cached per thread by this allocator, and
+    /// `false` if this allocator could not obtain thread-specific storage
+    /// (in which case every request is forwarded to the pools).
+    bool isCaching() const;
+
+    /// Return the number of pools managed by this allocator.
+    int numPools() const;
+
+    /// Return the maximum size of memory blocks that are pooled by this
+    /// allocator.  Note that the maximum value is defined as:
+    /// ```
+    /// 2 ^ (numPools + 2)
+    /// ```
+    /// where `numPools` is either specified at construction, or an
+    /// implementation-defined value.
+    bsls::Types::size_type maxPooledBlockSize() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                  // -------------------------------------
+                  // class ThreadCachingMultipoolAllocator
+                  // -------------------------------------
+
+// ACCESSORS
+inline
+bool ThreadCachingMultipoolAllocator::isCaching() const
+{
+    return d_isCaching;
+}
+
+inline
+int ThreadCachingMultipoolAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+bsls::Types::size_type
+ThreadCachingMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
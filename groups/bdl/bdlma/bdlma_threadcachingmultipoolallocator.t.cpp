@@ -0,0 +1,1064 @@
+// bdlma_threadcachingmultipoolallocator.t.cpp                        -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>  // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>     // `atoi`
+#include <bsl_cstring.h>     // `memset`
+#include <bsl_deque.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include <assert.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// `bdlma::ThreadCachingMultipoolAllocator` dispenses blocks from a set of
+// `bdlma::ConcurrentPool` objects, caching free blocks per thread.  We verify
+// that 1) blocks are dispensed from the expected pool, are maximally aligned,
+// and do not overlap; 2) a block freed by a thread is reused by that thread
+// without consulting the pools or the underlying allocator; 3) blocks may be
+// freed by a thread other than the one that allocated them, and the memory
+// cached by exited threads is reused; and 4) `release` reclaims all memory,
+// including the blocks cached by every thread.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingMultipoolAllocator(Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int n, Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(Strategy gs, Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int n, Strategy gs, *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int n, Strategy gs, int m, *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int n, const Strategy *gs, *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(n, const Strategy *gs, m, *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(n, gs, const int *m, *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(n, const Strategy *, const int *, *);
+// [ 1] ~ThreadCachingMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 1] void *allocate(size_type size);
+// [ 1] void deallocate(void *address);
+// [ 4] void release();
+// [ 2] void reserveCapacity(size_type size, int numBlocks);
+//
+// ACCESSORS
+// [ 2] bool isCaching() const;
+// [ 2] int numPools() const;
+// [ 2] size_type maxPooledBlockSize() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] THREAD CACHING
+// [ 3] CONCURRENCY
+// [ 5] USAGE EXAMPLE
+// [-1] CROSS-THREAD PRODUCER/CONSUMER BENCHMARK
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                       GLOBAL TYPES AND CONSTANTS
+//-----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingMultipoolAllocator Obj;
+
+typedef bsls::Types::Int64                     Int64;
+
+// Warning: keep this in sync with `bdlma_threadcachingmultipoolallocator.h`!
+
+/// Stores pool number of this item.
+struct Header {
+    union {
+        int                                 d_pool;   // pool for this item
+        bsls::AlignmentUtil::MaxAlignedType d_dummy;  // force max. alignment
+    } d_header;
+};
+
+//=============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+/// Calculate the index of the pool that should allocate objects that are of
+/// the specified `objSize` (in bytes) from a multipool allocator managing
+/// the specified `numPools` number of memory pools.
+static int calcPool(int numPools, int objSize)
+{
+    ASSERT(0 < numPools);
+    ASSERT(0 < objSize);
+
+    int poolIndex        = 0;
+    int pooledObjectSize = 8;
+
+    while (objSize > pooledObjectSize) {
+        pooledObjectSize *= 2;
+        ++poolIndex;
+    }
+
+    if (poolIndex >= numPools) {
+        poolIndex = -1;
+    }
+
+    return poolIndex;
+}
+
+/// Return the index of the pool that allocated the memory at the specified
+/// `address`.
+inline static int recPool(void *address)
+{
+    ASSERT(address);
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    return h->d_header.d_pool;
+}
+
+/// Return `true` if the specified `address` is maximally aligned, and
+/// `false` otherwise.
+inline static bool isMaxAligned(void *address)
+{
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                  address,
+                                  bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+}
+
+//=============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace BDLMA_THREADCACHINGMULTIPOOLALLOCATOR_HANDOFF {
+
+/// This `struct` is a queue of batches of memory blocks, passed from
+/// producer threads to consumer threads.
+struct Handoff {
+
+    // DATA
+    bslmt::Mutex                     d_mutex;
+    bslmt::Condition                 d_condition;
+    bsl::deque<bsl::vector<char *> > d_batches;
+    int                              d_numProducing;  // producers not done
+
+    // CREATORS
+    explicit Handoff(int numProducers)
+    : d_numProducing(numProducers)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Load into the specified `batch` the oldest batch in this queue,
+    /// blocking until one is available.  Return `false` if all producers
+    /// are done and this queue is empty, and `true` otherwise.
+    bool pop(bsl::vector<char *> *batch)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        while (d_batches.empty() && 0 < d_numProducing) {
+            d_condition.wait(&d_mutex);
+        }
+        if (d_batches.empty()) {
+            return false;                                             // RETURN
+        }
+        batch->swap(d_batches.front());
+        d_batches.pop_front();
+        return true;
+    }
+
+    /// Append the specified `batch` to this queue, leaving `batch` empty.
+    void push(bsl::vector<char *> *batch)
+    {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_batches.push_back(bsl::vector<char *>());
+            d_batches.back().swap(*batch);
+        }
+        d_condition.signal();
+    }
+
+    /// Indicate that a producer is done.
+    void producerDone()
+    {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            --d_numProducing;
+        }
+        d_condition.broadcast();
+    }
+};
+
+/// This `struct` describes the work of one producer or consumer thread.
+struct ThreadArgs {
+
+    // DATA
+    Handoff          *d_handoff_p;
+    bslma::Allocator *d_allocator_p;
+    int               d_numBatches;   // batches made by a producer
+    int               d_batchSize;    // blocks in a batch
+    char              d_fill;         // fill byte of a producer
+    bool              d_verify;       // `true` if blocks are checked
+    int               d_numErrors;    // errors found by a consumer
+};
+
+enum { k_NUM_POOLS = 10 };  // number of pools of a default allocator
+
+/// Return the size of the specified `i`th block of a batch.
+inline
+int blockSize(int i)
+{
+    static const int SIZES[] = { 8, 24, 40, 16, 100, 64, 200, 32, 500, 12 };
+
+    return SIZES[i % (sizeof SIZES / sizeof *SIZES)];
+}
+
+extern "C" void *produce(void *arg)
+{
+    ThreadArgs&         args = *static_cast<ThreadArgs *>(arg);
+    bsl::vector<char *> batch;
+
+    for (int i = 0; i < args.d_numBatches; ++i) {
+        batch.reserve(args.d_batchSize);
+        for (int j = 0; j < args.d_batchSize; ++j) {
+            const int  size  = blockSize(j);
+            char      *block = static_cast<char *>(
+                                          args.d_allocator_p->allocate(size));
+            if (args.d_verify) {
+                bsl::memset(block, args.d_fill, size);
+            }
+            else {
+                block[0] = args.d_fill;
+            }
+            batch.push_back(block);
+        }
+        args.d_handoff_p->push(&batch);
+    }
+    args.d_handoff_p->producerDone();
+    return 0;
+}
+
+extern "C" void *consume(void *arg)
+{
+    ThreadArgs&         args = *static_cast<ThreadArgs *>(arg);
+    bsl::vector<char *> batch;
+
+    while (args.d_handoff_p->pop(&batch)) {
+        for (int j = 0; j < static_cast<int>(batch.size()); ++j) {
+            char *block = batch[j];
+
+            if (args.d_verify) {
+                const int size = blockSize(j);
+
+                if (recPool(block) != calcPool(k_NUM_POOLS, size)) {
+                    ++args.d_numErrors;
+                }
+                for (int k = 1; k < size; ++k) {
+                    if (block[k] != block[0]) {
+                        ++args.d_numErrors;
+                        break;
+                    }
+                }
+                bsl::memset(block, 0, size);
+            }
+            args.d_allocator_p->deallocate(block);
+        }
+        batch.clear();
+    }
+    return 0;
+}
+
+/// Run the specified `numPairs` pairs of producer and consumer threads
+/// handing off the specified `numBatches` batches of the specified
+/// `batchSize` blocks each, per producer, allocated from the specified
+/// `allocator`.  If the specified `verify` is `true`, check the contents of
+/// each block on the consumer thread.  Return the number of errors found.
+int runPairs(bslma::Allocator *allocator,
+             int               numPairs,
+             int               numBatches,
+             int               batchSize,
+             bool              verify)
+{
+    Handoff                                handoff(numPairs);
+    bsl::vector<ThreadArgs>                args(2 * numPairs);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(2 * numPairs);
+
+    for (int i = 0; i < 2 * numPairs; ++i) {
+        ThreadArgs& a   = args[i];
+        a.d_handoff_p   = &handoff;
+        a.d_allocator_p = allocator;
+        a.d_numBatches  = numBatches;
+        a.d_batchSize   = batchSize;
+        a.d_fill        = static_cast<char>('A' + i);
+        a.d_verify      = verify;
+        a.d_numErrors   = 0;
+
+        const int rc = bslmt::ThreadUtil::create(&handles[i],
+                                                 i % 2 ? consume : produce,
+                                                 &a);
+        ASSERTV(i, rc, 0 == rc);
+    }
+
+    int numErrors = 0;
+    for (int i = 0; i < 2 * numPairs; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+        numErrors += args[i].d_numErrors;
+    }
+    return numErrors;
+}
+
+/// This `struct` describes the work of a thread allocating, then freeing,
+/// a number of blocks.
+struct ChurnArgs {
+
+    // DATA
+    Obj  *d_allocator_p;
+    int   d_numBlocks;
+    bool  d_release;      // `true` if blocks are not freed
+};
+
+extern "C" void *churn(void *arg)
+{
+    ChurnArgs&          args = *static_cast<ChurnArgs *>(arg);
+    bsl::vector<void *> blocks;
+
+    blocks.reserve(args.d_numBlocks);
+    for (int i = 0; i < args.d_numBlocks; ++i) {
+        blocks.push_back(args.d_allocator_p->allocate(blockSize(i)));
+    }
+    if (!args.d_release) {
+        for (int i = 0; i < args.d_numBlocks; ++i) {
+            args.d_allocator_p->deallocate(blocks[i]);
+        }
+    }
+    return 0;
+}
+
+/// Run, on a new thread, `churn` with the specified `args`.
+void runChurnThread(ChurnArgs *args)
+{
+    bslmt::ThreadUtil::Handle handle;
+    ASSERT(0 == bslmt::ThreadUtil::create(&handle, churn, args));
+    bslmt::ThreadUtil::join(handle);
+}
+
+}  // close namespace BDLMA_THREADCACHINGMULTIPOOLALLOCATOR_HANDOFF
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace BDLMA_THREADCACHINGMULTIPOOLALLOCATOR_USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handing Off Objects Between Threads
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that worker threads build messages that are consumed, and
+// destroyed, by a different thread.  Memory for the messages is allocated on
+// one thread and deallocated on another, so that a single allocator must be
+// shared by all threads.
+//
+// First, we define a simple, mutex-protected queue of strings, and a function
+// that fills the queue from a worker thread:
+// ```
+    struct MessageQueue {
+        bslmt::Mutex               d_mutex;
+        bsl::vector<bsl::string *> d_messages;
+        bslma::Allocator          *d_allocator_p;
+    };
+
+    extern "C" void *produceMessages(void *arg)
+    {
+        MessageQueue *queue = static_cast<MessageQueue *>(arg);
+
+        for (int i = 0; i < 100; ++i) {
+            bsl::string *message = new (*queue->d_allocator_p) bsl::string(
+                                 "a message that is long enough to allocate",
+                                 queue->d_allocator_p);
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+            queue->d_messages.push_back(message);
+        }
+        return 0;
+    }
+// ```
+
+}  // close namespace BDLMA_THREADCACHINGMULTIPOOLALLOCATOR_USAGE_EXAMPLE
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        using namespace BDLMA_THREADCACHINGMULTIPOOLALLOCATOR_USAGE_EXAMPLE;
+
+        bslma::TestAllocator ta("usage", veryVeryVerbose);
+
+// Then, we create a thread-caching multipool allocator and share it among
+// several producer threads:
+// ```
+    bdlma::ThreadCachingMultipoolAllocator allocator(&ta);
+
+    MessageQueue queue;
+    queue.d_allocator_p = &allocator;
+
+    bslmt::ThreadUtil::Handle handles[4];
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], produceMessages, &queue);
+    }
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    ASSERT(400 == queue.d_messages.size());
+// ```
+// Finally, the main thread consumes the messages, returning their memory to
+// its own cache, from which it is handed back, in batches, to the depot:
+// ```
+    for (bsl::size_t i = 0; i < queue.d_messages.size(); ++i) {
+        allocator.deleteObject(queue.d_messages[i]);
+    }
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `release`
+        //
+        // Concerns:
+        // 1. `release` returns to the underlying allocator all memory
+        //    allocated from the pools and for large blocks, including the
+        //    blocks cached by live and exited threads.
+        //
+        // 2. The allocator is fully usable, by every thread, after `release`.
+        //
+        // Plan:
+        // 1. Measure the memory in use after the main thread has obtained its
+        //    cache, and invoked `release`.  Allocate blocks of various sizes
+        //    from several threads, freeing some of them (so that they are
+        //    cached), then invoke `release` and verify the memory in use
+        //    does not exceed the measurement, plus the caches of the threads.
+        //    (C-1)
+        //
+        // 2. After `release`, allocate and free blocks from the main thread
+        //    and new threads, and verify the allocations succeed and that the
+        //    blocks do not overlap.  (C-2)
+        //
+        // Testing:
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING `release`" << endl
+                                  << "=================" << endl;
+
+        using namespace BDLMA_THREADCACHINGMULTIPOOLALLOCATOR_HANDOFF;
+
+        bslma::TestAllocator ta("release", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            mX.deallocate(mX.allocate(8));
+            mX.release();
+
+            const Int64 BASE = ta.numBytesInUse();
+
+            // One thread leaves its blocks allocated, the others free them,
+            // so that they are cached.  All threads run one at a time, so
+            // that only one additional cache is created.
+
+            ChurnArgs args = { &mX, 2000, true };
+            runChurnThread(&args);
+
+            args.d_release = false;
+            runChurnThread(&args);
+            runChurnThread(&args);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.deallocate(mX.allocate(blockSize(i)));
+            }
+            void *large = mX.allocate(10000);
+            ASSERT(large);
+
+            const Int64 CACHED = ta.numBytesInUse();
+            if (veryVerbose) { P_(BASE) P(CACHED) }
+            ASSERT(BASE < CACHED);
+
+            mX.release();
+
+            const Int64 RELEASED = ta.numBytesInUse();
+            if (veryVerbose) { P(RELEASED) }
+
+            // The only additional memory is the cache of the other threads.
+
+            ASSERTV(BASE, RELEASED, RELEASED - BASE < 1024);
+
+            bsl::vector<char *> blocks;
+            for (int i = 0; i < 500; ++i) {
+                char *p = static_cast<char *>(mX.allocate(blockSize(i)));
+                ASSERT(p);
+                bsl::memset(p, i % 128, blockSize(i));
+                blocks.push_back(p);
+            }
+            for (int i = 0; i < 500; ++i) {
+                ASSERTV(i, static_cast<char>(i % 128) == blocks[i][0]);
+                ASSERTV(i,
+                        static_cast<char>(i % 128)
+                                            == blocks[i][blockSize(i) - 1]);
+                mX.deallocate(blocks[i]);
+            }
+
+            runChurnThread(&args);
+            ASSERT(0 == runPairs(&mX, 2, 20, 50, true));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        // 1. Blocks allocated by one thread may be freed by another, and are
+        //    not dispensed again while in use.
+        //
+        // 2. The caches of exited threads are reused, so that the memory
+        //    retained by the allocator does not grow with the number of
+        //    threads that have used it, but only with the number of threads
+        //    that use it concurrently.
+        //
+        // 3. No memory is leaked, even if threads exit while holding cached
+        //    blocks.
+        //
+        // Plan:
+        // 1. Using several pairs of threads, allocate blocks of various sizes
+        //    on producer threads, filling each with a byte specific to the
+        //    producer, and hand them off to consumer threads that verify the
+        //    contents and the pool index of each block before clearing and
+        //    freeing it.  (C-1)
+        //
+        // 2. Repeatedly run a thread that allocates, and then frees, a number
+        //    of blocks.  Verify that the memory in use after each thread has
+        //    exited does not grow.  (C-2)
+        //
+        // 3. Verify that the test allocator has no memory in use after the
+        //    allocator is destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY" << endl
+                                  << "===========" << endl;
+
+        using namespace BDLMA_THREADCACHINGMULTIPOOLALLOCATOR_HANDOFF;
+
+        if (verbose) cout << "\nCross-thread hand-off." << endl;
+        {
+            bslma::TestAllocator ta("handoff", veryVeryVerbose);
+            {
+                Obj mX(&ta);
+
+                for (int round = 0; round < 3; ++round) {
+                    const int numErrors = runPairs(&mX, 3, 50, 100, true);
+                    ASSERTV(round, numErrors, 0 == numErrors);
+                }
+            }
+            ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nReuse of the caches of exited threads."
+                          << endl;
+        {
+            bslma::TestAllocator ta("reuse", veryVeryVerbose);
+            {
+                Obj mX(&ta);
+
+                ChurnArgs args = { &mX, 3000, false };
+                runChurnThread(&args);
+
+                const Int64 IN_USE = ta.numBytesInUse();
+
+                for (int i = 0; i < 20; ++i) {
+                    runChurnThread(&args);
+                    ASSERTV(i, IN_USE, ta.numBytesInUse(),
+                            IN_USE == ta.numBytesInUse());
+                }
+            }
+            ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nThreads exiting with allocated blocks."
+                          << endl;
+        {
+            bslma::TestAllocator ta("exit", veryVeryVerbose);
+            {
+                Obj mX(&ta);
+
+                ChurnArgs args = { &mX, 1000, true };
+                for (int i = 0; i < 5; ++i) {
+                    runChurnThread(&args);
+                }
+            }
+            ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // THREAD CACHING
+        //
+        // Concerns:
+        // 1. Each constructor creates an allocator with the specified number
+        //    of pools, that caches blocks per thread.
+        //
+        // 2. A block freed by a thread is the next block of its size
+        //    dispensed to that thread.
+        //
+        // 3. Once its cache is warm, a thread allocating and freeing blocks
+        //    does not use the underlying allocator, whatever the order of
+        //    the operations.
+        //
+        // 4. `reserveCapacity` reserves memory in the pool for the specified
+        //    size.
+        //
+        // Plan:
+        // 1. Using each constructor, create an allocator and verify the
+        //    values of `numPools`, `maxPooledBlockSize`, and `isCaching`.
+        //    Allocate, and free, a block from each pool, and a large block.
+        //    (C-1)
+        //
+        // 2. Free a block, and verify the next allocation of the same size
+        //    returns the same address.  (C-2)
+        //
+        // 3. Allocate, then free, a number of blocks several times, in FIFO
+        //    and LIFO orders, and verify the number of allocations from the
+        //    test allocator does not change after the first round.  (C-3)
+        //
+        // 4. Reserve capacity for a number of blocks, and verify that
+        //    allocating those blocks does not use the test allocator.  (C-4)
+        //
+        // Testing:
+        //   ThreadCachingMultipoolAllocator(Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int n, Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(Strategy gs, Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int n, Strategy gs, *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int n, Strategy gs, int m, *ba);
+        //   ThreadCachingMultipoolAllocator(int n, const Strategy *gs, *ba);
+        //   ThreadCachingMultipoolAllocator(n, const Strategy *gs, m, *ba);
+        //   ThreadCachingMultipoolAllocator(n, gs, const int *m, *ba = 0);
+        //   ThreadCachingMultipoolAllocator(n, const Strategy *, const int *);
+        //   void reserveCapacity(size_type size, int numBlocks);
+        //   bool isCaching() const;
+        //   int numPools() const;
+        //   size_type maxPooledBlockSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "THREAD CACHING" << endl
+                                  << "==============" << endl;
+
+        typedef bsls::BlockGrowth::Strategy Strategy;
+
+        const Strategy GEO = bsls::BlockGrowth::BSLS_GEOMETRIC;
+        const Strategy CON = bsls::BlockGrowth::BSLS_CONSTANT;
+
+        if (verbose) cout << "\nTesting constructors and accessors." << endl;
+        {
+            bslma::TestAllocator ta("ctor", veryVeryVerbose);
+
+            const int      NUM_POOLS = 5;
+            const Strategy STRATEGIES[NUM_POOLS] = { GEO, CON, GEO, CON, GEO };
+            const int      MAX_CHUNKS[NUM_POOLS] = { 1, 2, 4, 8, 16 };
+
+            for (int ti = 0; ti < 9; ++ti) {
+                Obj *mX = 0;
+                int  EXP_NUM_POOLS = NUM_POOLS;
+
+                switch (ti) {
+                  case 0: {
+                    mX = new (ta) Obj(&ta);
+                    EXP_NUM_POOLS = 10;
+                  } break;
+                  case 1: {
+                    mX = new (ta) Obj(NUM_POOLS, &ta);
+                  } break;
+                  case 2: {
+                    mX = new (ta) Obj(CON, &ta);
+                    EXP_NUM_POOLS = 10;
+                  } break;
+                  case 3: {
+                    mX = new (ta) Obj(NUM_POOLS, CON, &ta);
+                  } break;
+                  case 4: {
+                    mX = new (ta) Obj(NUM_POOLS, CON, 3, &ta);
+                  } break;
+                  case 5: {
+                    mX = new (ta) Obj(NUM_POOLS, STRATEGIES, &ta);
+                  } break;
+                  case 6: {
+                    mX = new (ta) Obj(NUM_POOLS, STRATEGIES, 3, &ta);
+                  } break;
+                  case 7: {
+                    mX = new (ta) Obj(NUM_POOLS, GEO, MAX_CHUNKS, &ta);
+                  } break;
+                  case 8: {
+                    mX = new (ta) Obj(NUM_POOLS,
+                                      STRATEGIES,
+                                      MAX_CHUNKS,
+                                      &ta);
+                  } break;
+                }
+                const Obj& X = *mX;
+
+                ASSERTV(ti, EXP_NUM_POOLS == X.numPools());
+                ASSERTV(ti, X.isCaching());
+                ASSERTV(ti, (8 << (EXP_NUM_POOLS - 1)) ==
+                                   static_cast<int>(X.maxPooledBlockSize()));
+
+                for (int size = 1;
+                     size <= static_cast<int>(X.maxPooledBlockSize()) * 2;
+                     size *= 2) {
+                    void *p = mX->allocate(size);
+                    ASSERTV(ti, size, isMaxAligned(p));
+                    ASSERTV(ti, size,
+                            calcPool(EXP_NUM_POOLS, size) == recPool(p));
+                    mX->deallocate(p);
+                }
+                ta.deleteObject(mX);
+                ASSERTV(ti, 0 == ta.numBytesInUse());
+            }
+
+            Obj mX;
+            ASSERT(10 == mX.numPools());
+        }
+
+        if (verbose) cout << "\nTesting LIFO reuse." << endl;
+        {
+            bslma::TestAllocator ta("lifo", veryVeryVerbose);
+            Obj                  mX(&ta);
+
+            for (int size = 1; size <= 2048; size = size * 3 + 1) {
+                void *p = mX.allocate(size);
+                void *q = mX.allocate(size);
+                mX.deallocate(p);
+                ASSERTV(size, p == mX.allocate(size));
+                mX.deallocate(q);
+                mX.deallocate(p);
+                ASSERTV(size, p == mX.allocate(size));
+                mX.deallocate(p);
+            }
+        }
+
+        if (verbose) cout << "\nTesting warm cache." << endl;
+        {
+            bslma::TestAllocator ta("warm", veryVeryVerbose);
+            Obj                  mX(&ta);
+
+            const int           NUM_BLOCKS = 1000;
+            bsl::vector<void *> blocks(NUM_BLOCKS);
+
+            Int64 numAllocations = 0;
+
+            for (int round = 0; round < 6; ++round) {
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    blocks[i] = mX.allocate(64);
+                }
+                if (round % 2) {
+                    for (int i = 0; i < NUM_BLOCKS; ++i) {
+                        mX.deallocate(blocks[i]);
+                    }
+                }
+                else {
+                    for (int i = NUM_BLOCKS - 1; 0 <= i; --i) {
+                        mX.deallocate(blocks[i]);
+                    }
+                }
+                if (0 == round) {
+                    numAllocations = ta.numAllocations();
+                }
+                ASSERTV(round, numAllocations, ta.numAllocations(),
+                        numAllocations == ta.numAllocations());
+            }
+        }
+
+        if (verbose) cout << "\nTesting `reserveCapacity`." << endl;
+        {
+            bslma::TestAllocator ta("reserve", veryVeryVerbose);
+            Obj                  mX(4, &ta);
+
+            // Create the cache of this thread.
+
+            mX.deallocate(mX.allocate(8));
+
+            // Blocks are taken from the pool in batches, so reserve more
+            // blocks than are allocated.
+
+            mX.reserveCapacity(0, 10);
+            mX.reserveCapacity(20, 256);
+
+            const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < 200; ++i) {
+                blocks.push_back(mX.allocate(20));
+            }
+            ASSERTV(NUM_ALLOCATIONS, ta.numAllocations(),
+                    NUM_ALLOCATIONS == ta.numAllocations());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        // 1. Blocks of every size are dispensed from the expected pool, or,
+        //    if large, from the underlying allocator, are maximally aligned,
+        //    and do not overlap.
+        //
+        // 2. `allocate(0)` returns 0, and `deallocate(0)` has no effect.
+        //
+        // 3. All memory is returned to the underlying allocator on
+        //    destruction.
+        //
+        // Plan:
+        // 1. Allocate blocks of sizes from 1 to twice the maximum pooled
+        //    block size, verify their alignment and pool index, and fill
+        //    them with a distinct byte.  Verify the contents of each, then
+        //    free them.  Repeat, freeing the blocks in a different order.
+        //    (C-1)
+        //
+        // 2. Invoke `allocate(0)` and `deallocate(0)`.  (C-2)
+        //
+        // 3. Verify that the test allocator has no memory in use after the
+        //    allocator is destroyed.  (C-3)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   ~ThreadCachingMultipoolAllocator();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("breathing", veryVeryVerbose);
+        {
+            Obj mX(6, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            const int MAX_SIZE = 2 * static_cast<int>(X.maxPooledBlockSize());
+
+            bsl::vector<char *> blocks;
+            for (int round = 0; round < 3; ++round) {
+                for (int size = 1; size <= MAX_SIZE; size += 7) {
+                    char *p = static_cast<char *>(mX.allocate(size));
+
+                    ASSERTV(size, isMaxAligned(p));
+                    ASSERTV(size, calcPool(X.numPools(), size) == recPool(p));
+
+                    bsl::memset(p, size % 127, size);
+                    blocks.push_back(p);
+                }
+
+                int i = 0;
+                for (int size = 1; size <= MAX_SIZE; size += 7, ++i) {
+                    const char *p = blocks[i];
+                    for (int k = 0; k < size; ++k) {
+                        if (p[k] != static_cast<char>(size % 127)) {
+                            ASSERTV(size, k, false);
+                            break;
+                        }
+                    }
+                }
+
+                const int NUM_BLOCKS = static_cast<int>(blocks.size());
+                for (int j = 0; j < NUM_BLOCKS; ++j) {
+                    switch (round) {
+                      case 0: {
+                        mX.deallocate(blocks[j]);
+                      } break;
+                      case 1: {
+                        mX.deallocate(blocks[NUM_BLOCKS - 1 - j]);
+                      } break;
+                      default: {
+                        const int HALF = (NUM_BLOCKS + 1) / 2;
+                        mX.deallocate(blocks[j < HALF
+                                             ? 2 * j
+                                             : 2 * (j - HALF) + 1]);
+                      }
+                    }
+                }
+                blocks.clear();
+            }
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CROSS-THREAD PRODUCER/CONSUMER BENCHMARK
+        //   Compare `ConcurrentMultipoolAllocator` and
+        //   `ThreadCachingMultipoolAllocator` when blocks are allocated by
+        //   producer threads and freed by consumer threads.
+        //
+        //   Usage: <driver> -1 [numPairs] [numBatches] [batchSize]
+        //
+        // Testing:
+        //   CROSS-THREAD PRODUCER/CONSUMER BENCHMARK
+        // --------------------------------------------------------------------
+
+        cout << endl << "CROSS-THREAD PRODUCER/CONSUMER BENCHMARK" << endl
+                     << "========================================" << endl;
+
+        using namespace BDLMA_THREADCACHINGMULTIPOOLALLOCATOR_HANDOFF;
+
+        const int NUM_PAIRS   = argc > 2 ? atoi(argv[2]) : 2;
+        const int NUM_BATCHES = argc > 3 ? atoi(argv[3]) : 20000;
+        const int BATCH_SIZE  = argc > 4 ? atoi(argv[4]) : 64;
+
+        P_(NUM_PAIRS) P_(NUM_BATCHES) P(BATCH_SIZE)
+
+        const double NUM_OPS = 2.0 * NUM_PAIRS * NUM_BATCHES * BATCH_SIZE;
+
+        for (int rep = 0; rep < 2; ++rep) {
+            double elapsedConcurrent;
+            {
+                bdlma::ConcurrentMultipoolAllocator ma;
+
+                bsls::Stopwatch timer;
+                timer.start(true);
+                runPairs(&ma, NUM_PAIRS, NUM_BATCHES, BATCH_SIZE, false);
+                timer.stop();
+                elapsedConcurrent = timer.accumulatedWallTime();
+            }
+
+            double elapsedCaching;
+            {
+                Obj ma;
+
+                bsls::Stopwatch timer;
+                timer.start(true);
+                runPairs(&ma, NUM_PAIRS, NUM_BATCHES, BATCH_SIZE, false);
+                timer.stop();
+                elapsedCaching = timer.accumulatedWallTime();
+            }
+
+            printf("ConcurrentMultipoolAllocator:    %8.3fs %7.1f ns/op\n",
+                   elapsedConcurrent,
+                   elapsedConcurrent * 1e9 / NUM_OPS);
+            printf("ThreadCachingMultipoolAllocator: %8.3fs %7.1f ns/op\n",
+                   elapsedCaching,
+                   elapsedCaching * 1e9 / NUM_OPS);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,6 +14,8 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 
 #include <bdlt_timeunitratio.h>
 
+#include <bslma_deallocatorproctor.h>
+
 #include <bslmf_movableref.h>
 
 #include <bsls_assert.h>
@@ -200,6 +202,264 @@ bsls::TimeInterval EventSchedulerTestTimeSource_Data::currentTime() const
     return d_currentTime;
 }
 
+                      // --------------------------------
+                      // class EventScheduler::EventQueue
+                      // --------------------------------
+
+// PRIVATE MANIPULATORS
+EventScheduler::EventQueue::WheelNode *
+EventScheduler::EventQueue::addNode(bsls::Types::Int64  key,
+                                    const EventData&    data,
+                                    int                 refCount,
+                                    bool               *newFrontFlag)
+{
+    BSLS_ASSERT(d_wheel_p);
+
+    void *memory = d_nodePool.allocate();
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(memory,
+                                                             &d_nodePool);
+
+    WheelNode *node = new (memory) WheelNode(data, refCount, allocator());
+
+    proctor.release();
+
+    bool isFront;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        d_wheel_p->insert(node, key);
+        isFront = d_wheel_p->front() == node;
+    }
+
+    if (newFrontFlag) {
+        *newFrontFlag = isFront;
+    }
+    return node;
+}
+
+// CREATORS
+EventScheduler::EventQueue::EventQueue(
+                                   bdlc::TimerStoreType::Enum  storeType,
+                                   bslma::Allocator           *basicAllocator)
+: d_list(basicAllocator)
+, d_wheel_p(0)
+, d_wheelMutex()
+, d_nodePool(sizeof(WheelNode), basicAllocator)
+{
+    if (bdlc::TimerStoreType::e_TIMING_WHEEL == storeType) {
+        d_wheel_p = new (*allocator()) bdlc::TimingWheel();
+    }
+}
+
+EventScheduler::EventQueue::~EventQueue()
+{
+    if (d_wheel_p) {
+        removeAll();
+        allocator()->deleteObject(d_wheel_p);
+    }
+}
+
+// MANIPULATORS
+void EventScheduler::EventQueue::addR(bsls::Types::Int64  key,
+                                      const EventData&    data,
+                                      bool               *newFrontFlag)
+{
+    if (d_wheel_p) {
+        addNode(key, data, 1, newFrontFlag);
+    }
+    else {
+        d_list.addR(key, data, newFrontFlag);
+    }
+}
+
+void EventScheduler::EventQueue::addR(PairHandle          *result,
+                                      bsls::Types::Int64   key,
+                                      const EventData&     data,
+                                      bool                *newFrontFlag)
+{
+    BSLS_ASSERT(result);
+
+    Pair *reference;
+    addRawR(&reference, key, data, newFrontFlag);
+    result->reset(this, reference);
+}
+
+void EventScheduler::EventQueue::addRawR(Pair               **result,
+                                         bsls::Types::Int64   key,
+                                         const EventData&     data,
+                                         bool                *newFrontFlag)
+{
+    BSLS_ASSERT(result);
+
+    if (d_wheel_p) {
+        *result = toPair(addNode(key, data, 2, newFrontFlag));
+    }
+    else {
+        List::Pair *pair;
+        d_list.addRawR(&pair, key, data, newFrontFlag);
+        *result = reinterpret_cast<Pair *>(static_cast<void *>(pair));
+    }
+}
+
+void EventScheduler::EventQueue::advance(bsls::Types::Int64 now)
+{
+    if (d_wheel_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        d_wheel_p->advance(now);
+    }
+}
+
+void EventScheduler::EventQueue::releaseReferenceRaw(const Pair *reference)
+{
+    if (0 == d_wheel_p) {
+        d_list.releaseReferenceRaw(toListPair(reference));
+        return;                                                       // RETURN
+    }
+
+    WheelNode *node = toNode(reference);
+    if (0 == --node->d_refCount) {
+        node->~WheelNode();
+        d_nodePool.deallocate(node);
+    }
+}
+
+int EventScheduler::EventQueue::remove(const Pair *reference)
+{
+    if (0 == d_wheel_p) {
+        return d_list.remove(toListPair(reference));                  // RETURN
+    }
+
+    if (0 == reference) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    WheelNode *node = toNode(reference);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        if (!node->isLinked()) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+        d_wheel_p->remove(node);
+    }
+
+    // Release the reference held by the wheel; the caller holds another.
+
+    releaseReferenceRaw(reference);
+    return 0;
+}
+
+int EventScheduler::EventQueue::removeAll()
+{
+    if (0 == d_wheel_p) {
+        return d_list.removeAll();                                    // RETURN
+    }
+
+    bdlc::TimingWheelLink *link;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        link = d_wheel_p->removeAll();
+    }
+
+    // Releasing the references held by the wheel may destroy the callbacks of
+    // the events, and so must be done without holding `d_wheelMutex`.
+
+    int numRemoved = 0;
+    while (link) {
+        bdlc::TimingWheelLink *next = link->next();
+        releaseReferenceRaw(toPair(link));
+        link = next;
+        ++numRemoved;
+    }
+    return numRemoved;
+}
+
+int EventScheduler::EventQueue::updateR(const Pair         *reference,
+                                        bsls::Types::Int64  newKey,
+                                        bool               *newFrontFlag)
+{
+    if (0 == d_wheel_p) {
+        return d_list.updateR(toListPair(reference),
+                              newKey,
+                              newFrontFlag);                          // RETURN
+    }
+
+    if (0 == reference) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    WheelNode *node = toNode(reference);
+
+    bool isFront;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        if (!node->isLinked()) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+        d_wheel_p->remove(node);
+        d_wheel_p->insert(node, newKey);
+        isFront = d_wheel_p->front() == node;
+    }
+
+    if (newFrontFlag) {
+        *newFrontFlag = isFront;
+    }
+    return 0;
+}
+
+// ACCESSORS
+int EventScheduler::EventQueue::front(PairHandle *front) const
+{
+    BSLS_ASSERT(front);
+
+    Pair *reference;
+    if (0 != frontRaw(&reference)) {
+        return -1;                                                    // RETURN
+    }
+
+    front->reset(const_cast<EventQueue *>(this), reference);
+    return 0;
+}
+
+int EventScheduler::EventQueue::frontRaw(Pair **front) const
+{
+    BSLS_ASSERT(front);
+
+    if (0 == d_wheel_p) {
+        List::Pair *pair;
+        int         rc = d_list.frontRaw(&pair);
+        *front = reinterpret_cast<Pair *>(static_cast<void *>(pair));
+        return rc;                                                    // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+    bdlc::TimingWheelLink *link = d_wheel_p->front();
+    if (0 == link) {
+        *front = 0;
+        return -1;                                                    // RETURN
+    }
+
+    ++static_cast<WheelNode *>(link)->d_refCount;
+    *front = toPair(link);
+    return 0;
+}
+
+int EventScheduler::EventQueue::length() const
+{
+    if (0 == d_wheel_p) {
+        return d_list.length();                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+    return static_cast<int>(d_wheel_p->length());
+}
+
                            // --------------------
                            // class EventScheduler
                            // --------------------
@@ -226,7 +486,7 @@ bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::AtomicInt64 *now)
     bsls::Types::Int64 t = 0;
 
     if (0 == d_currentRecurringEvent) {
-        if (*now <= (t = d_currentEvent->key())) {
+        if (*now <= (t = d_eventQueue.key(d_currentEvent))) {
             *now = d_currentTimeFunctor().totalMicroseconds();
         }
     }
@@ -237,7 +497,8 @@ bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::AtomicInt64 *now)
     }
     else {
         bsls::Types::Int64 recurringEventTime = d_currentRecurringEvent->key();
-        bsls::Types::Int64 eventTime          = d_currentEvent->key();
+        bsls::Types::Int64 eventTime          =
+                                              d_eventQueue.key(d_currentEvent);
 
         // Prefer overdue events over overdue clocks if running behind.
 
@@ -382,9 +643,11 @@ void EventScheduler::dispatchEvents()
             }
         }
         else { // d_currentEvent
-            EventData& data = d_currentEvent->data();
+            EventData& data = d_eventQueue.data(d_currentEvent);
             bsls::Types::Int64 nowOffset = data.d_nowOffset();
             if (nowOffset <= 0) {
+                d_eventQueue.advance(d_cachedNow);
+
                 int ret = d_eventQueue.remove(d_currentEvent);
                 if (0 == ret) {
                     // The fact that we successfully removed the event from
@@ -553,7 +816,7 @@ EventScheduler::EventScheduler()
             bsl::allocator_arg,
             bslma::Default::defaultAllocator(),
             createDefaultCurrentTimeFunctor(bsls::SystemClockType::e_REALTIME))
-, d_eventQueue()
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED)
 , d_recurringQueue()
 , d_dispatcherFunctor(bsl::allocator_arg,
                       bslma::Default::defaultAllocator(),
@@ -577,7 +840,7 @@ EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       &defaultDispatcherFunction)
@@ -602,7 +865,7 @@ EventScheduler::EventScheduler(const bsl::string_view&  eventSchedulerName,
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       &defaultDispatcherFunction)
@@ -623,7 +886,7 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
                                bslma::Allocator            *basicAllocator)
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(clockType))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       &defaultDispatcherFunction)
@@ -649,7 +912,7 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
                                bslma::Allocator            *basicAllocator)
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(clockType))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       &defaultDispatcherFunction)
@@ -674,7 +937,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       &defaultDispatcherFunction)
@@ -701,7 +964,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       &defaultDispatcherFunction)
@@ -724,7 +987,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                            bsls::SystemClockType::e_MONOTONIC))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       &defaultDispatcherFunction)
@@ -751,7 +1014,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                            bsls::SystemClockType::e_MONOTONIC))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       &defaultDispatcherFunction)
@@ -775,7 +1038,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       dispatcherFunctor)
@@ -802,7 +1065,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       dispatcherFunctor)
@@ -825,7 +1088,85 @@ EventScheduler::EventScheduler(
                           bslma::Allocator                  *basicAllocator)
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(clockType))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherThreadId(invalidThreadId())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+, d_eventSchedulerName(basicAllocator)
+{
+    initialize(
+            0,
+            bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION);
+}
+
+EventScheduler::EventScheduler(
+                          const EventScheduler::Dispatcher&  dispatcherFunctor,
+                          bsls::SystemClockType::Enum        clockType,
+                          const bsl::string_view&            eventSchedulerName,
+                          bdlm::MetricsRegistry             *metricsRegistry,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherThreadId(invalidThreadId())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+, d_eventSchedulerName(eventSchedulerName, basicAllocator)
+{
+    initialize(metricsRegistry, eventSchedulerName);
+}
+
+EventScheduler::EventScheduler(bdlc::TimerStoreType::Enum   storeType,
+                               bsls::SystemClockType::Enum  clockType,
+                               bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(storeType, basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_dispatcherThreadId(invalidThreadId())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+, d_eventSchedulerName(basicAllocator)
+{
+    initialize(
+            0,
+            bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION);
+}
+
+EventScheduler::EventScheduler(
+                          bdlc::TimerStoreType::Enum         storeType,
+                          const EventScheduler::Dispatcher&  dispatcherFunctor,
+                          bsls::SystemClockType::Enum        clockType,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(storeType, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       dispatcherFunctor)
@@ -846,6 +1187,7 @@ EventScheduler::EventScheduler(
 }
 
 EventScheduler::EventScheduler(
+                          bdlc::TimerStoreType::Enum         storeType,
                           const EventScheduler::Dispatcher&  dispatcherFunctor,
                           bsls::SystemClockType::Enum        clockType,
                           const bsl::string_view&            eventSchedulerName,
@@ -853,7 +1195,7 @@ EventScheduler::EventScheduler(
                           bslma::Allocator                  *basicAllocator)
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(clockType))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(storeType, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       dispatcherFunctor)
@@ -879,7 +1221,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       dispatcherFunctor)
@@ -907,7 +1249,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                             bsls::SystemClockType::e_REALTIME))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       dispatcherFunctor)
@@ -931,7 +1273,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                            bsls::SystemClockType::e_MONOTONIC))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       dispatcherFunctor)
@@ -959,7 +1301,7 @@ EventScheduler::EventScheduler(
 : d_currentTimeFunctor(bsl::allocator_arg, basicAllocator,
                        createDefaultCurrentTimeFunctor(
                                            bsls::SystemClockType::e_MONOTONIC))
-, d_eventQueue(basicAllocator)
+, d_eventQueue(bdlc::TimerStoreType::e_ORDERED, basicAllocator)
 , d_recurringQueue(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg, basicAllocator,
                       dispatcherFunctor)
@@ -1086,7 +1428,7 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
             // Because we succeeded in removing this from the queue, we know
             // that no other thread is accessing this node.
 
-            itemPtr->data().d_callback = 0;
+            d_eventQueue.data(itemPtr).d_callback = 0;
         }
 
         return ret;                                                   // RETURN
@@ -1141,7 +1483,7 @@ int EventScheduler::rescheduleEvent(const Event               *handle,
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
     if (h) {
-        h->data().d_nowOffset = returnZero;
+        d_eventQueue.data(h).d_nowOffset = returnZero;
     }
 
     bsls::Types::Int64 startTime = newEpochTime.totalMicroseconds();
@@ -1174,7 +1516,7 @@ int EventScheduler::rescheduleEventAndWait(
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
         if (h) {
-            h->data().d_nowOffset = returnZero;
+            d_eventQueue.data(h).d_nowOffset = returnZero;
         }
 
         bsls::Types::Int64 startTime = newEpochTime.totalMicroseconds();
@@ -171,6 +171,19 @@ BSLS_IDENT("$Id: $")
 // `bdlt::CurrentTime::now(bsls::SystemClockType::e_MONOTONIC)` and
 // `bsl::chrono::steady_clock`).
 //
+///Timer Store
+///-----------
+// By default an `EventScheduler` keeps its one-time events in a
+// `bdlcc::SkipList`, so that scheduling, rescheduling, and cancelling an event
+// takes time logarithmic in the number of pending events.  A scheduler created
+// with the `bdlc::TimerStoreType::e_TIMING_WHEEL` store type instead keeps its
+// one-time events in a `bdlc::TimingWheel`, on which these operations take
+// constant time.  This suits schedulers holding many timeouts that are usually
+// cancelled or rescheduled before they expire.  Recurring events are kept in a
+// `bdlcc::SkipList` regardless of the store type, and the store type does not
+// affect the behavior of the scheduler described elsewhere in this
+// documentation.
+//
 ///Event Clock Substitution
 ///------------------------
 // For testing purposes, a class `bdlmt::EventSchedulerTestTimeSource` is
@@ -441,10 +454,14 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlc_timingwheel.h>
+
 #include <bdlcc_skiplist.h>
 
 #include <bdlm_metricsregistry.h>
 
+#include <bdlma_concurrentpool.h>
+
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 
@@ -623,10 +640,268 @@ class EventScheduler {
     typedef bdlcc::SkipList<bsls::Types::Int64,
                             RecurringEventData>            RecurringEventQueue;
 
-    typedef bdlcc::SkipList<bsls::Types::Int64, EventData> EventQueue;
-
     typedef bsl::function<bsls::TimeInterval()>            CurrentTimeFunctor;
 
+                             // ================
+                             // class EventQueue
+                             // ================
+
+    /// This class implements the queue of one-time events of an event
+    /// scheduler, ordered by the time (in microseconds) of each event.  The
+    /// events are kept either in a `bdlcc::SkipList` or in a
+    /// `bdlc::TimingWheel` guarded by a mutex, as selected at construction.
+    /// The interface of this class is the subset of the `bdlcc::SkipList`
+    /// interface used by `EventScheduler`, with the key and data of an event
+    /// accessed through the queue rather than through the event.  This class
+    /// is fully thread-safe.
+    class EventQueue {
+
+        // PRIVATE TYPES
+        typedef bdlcc::SkipList<bsls::Types::Int64, EventData> List;
+
+        /// This `struct` holds a one-time event in a timing wheel.  The
+        /// wheel holds a reference to the node while the node is linked
+        /// into it.
+        struct WheelNode : bdlc::TimingWheelLink {
+
+            // DATA
+            bsls::AtomicInt d_refCount;  // number of references to the node
+
+            EventData       d_data;      // the event
+
+            // CREATORS
+
+            /// Create a node holding a copy of the specified `data` and
+            /// having the specified `refCount`, using the specified
+            /// `basicAllocator` to supply memory.
+            WheelNode(const EventData&  data,
+                      int               refCount,
+                      bslma::Allocator *basicAllocator)
+            : d_refCount(refCount)
+            , d_data(data, basicAllocator)
+            {
+            }
+        };
+
+      public:
+        // PUBLIC TYPES
+
+        /// `Pair` is an opaque type referring to an event in the queue.
+        struct Pair;
+
+        enum {
+            e_NOT_FOUND = List::e_NOT_FOUND,
+            e_INVALID   = List::e_INVALID
+        };
+
+                             // ================
+                             // class PairHandle
+                             // ================
+
+        /// Objects of this type manage a reference to an event in a queue.
+        class PairHandle {
+
+            // DATA
+            EventQueue *d_queue_p;  // queue of the event (held, not owned)
+
+            Pair       *d_pair_p;   // managed event reference
+
+            // FRIENDS
+            friend class EventQueue;
+
+          public:
+            // CREATORS
+
+            /// Create a handle that does not refer to an event.
+            PairHandle();
+
+            /// Create a handle referring to the same event as the
+            /// specified `original` handle.
+            PairHandle(const PairHandle& original);
+
+            /// Release the reference (if any) held by this handle and
+            /// destroy it.
+            ~PairHandle();
+
+            // MANIPULATORS
+
+            /// Release the reference (if any) held by this handle; then
+            /// make this handle refer to the same event as the specified
+            /// `rhs` handle.  Return a reference providing modifiable
+            /// access to this handle.
+            PairHandle& operator=(const PairHandle& rhs);
+
+            /// Release the reference (if any) held by this handle.
+            void release();
+
+            /// Release the reference (if any) held by this handle; then
+            /// make this handle manage the specified `reference` to an
+            /// event in the specified `queue`.
+            void reset(EventQueue *queue, Pair *reference);
+
+            // ACCESSORS
+
+            /// Return the event referred to by this handle, or 0 if this
+            /// handle does not refer to an event.
+            operator Pair*() const;
+
+            /// Return the time of the event referred to by this handle.
+            /// The behavior is undefined unless this handle refers to an
+            /// event.
+            bsls::Types::Int64 key() const;
+        };
+
+      private:
+        // DATA
+        List                    d_list;          // events, in skip-list
+                                                 // mode
+
+        bdlc::TimingWheel      *d_wheel_p;       // events in timing-wheel
+                                                 // mode (owned), or 0
+
+        mutable bslmt::Mutex    d_wheelMutex;    // guards `d_wheel_p`
+
+        bdlma::ConcurrentPool   d_nodePool;      // supplies `WheelNode`s
+
+        // PRIVATE CLASS METHODS
+
+        /// Return the skip-list pair referred to by the specified
+        /// `reference`.
+        static List::Pair *toListPair(const Pair *reference);
+
+        /// Return the timing-wheel node referred to by the specified
+        /// `reference`.
+        static WheelNode *toNode(const Pair *reference);
+
+        /// Return the reference to the specified `node`.
+        static Pair *toPair(bdlc::TimingWheelLink *node);
+
+        // PRIVATE MANIPULATORS
+
+        /// Return a timing-wheel node holding the specified `data` and
+        /// having a reference count of the specified `refCount`, linked
+        /// into the timing wheel at the specified `key`.  Load into the
+        /// optionally specified `newFrontFlag` `true` if the node is at
+        /// the front of the queue, and `false` otherwise.
+        WheelNode *addNode(bsls::Types::Int64  key,
+                           const EventData&    data,
+                           int                 refCount,
+                           bool               *newFrontFlag);
+
+      private:
+        // NOT IMPLEMENTED
+        EventQueue(const EventQueue&);
+        EventQueue& operator=(const EventQueue&);
+
+      public:
+        // CREATORS
+
+        /// Create an empty queue keeping its events in a store of the
+        /// specified `storeType`.  Optionally specify a `basicAllocator`
+        /// used to supply memory.  If `basicAllocator` is 0, the currently
+        /// installed default allocator is used.
+        explicit EventQueue(bdlc::TimerStoreType::Enum  storeType,
+                            bslma::Allocator           *basicAllocator = 0);
+
+        /// Remove all events from this queue and destroy it.  The behavior
+        /// is undefined unless all references to events in this queue
+        /// have been released.
+        ~EventQueue();
+
+        // MANIPULATORS
+
+        /// Add an event having the specified `key` and `data` to this
+        /// queue.  Load into the optionally specified `newFrontFlag`
+        /// `true` if the event is at the front of the queue, and `false`
+        /// otherwise.
+        void addR(bsls::Types::Int64  key,
+                  const EventData&    data,
+                  bool               *newFrontFlag = 0);
+
+        /// Add an event having the specified `key` and `data` to this
+        /// queue, and load into the specified `result` a reference to the
+        /// event.  Load into the optionally specified `newFrontFlag`
+        /// `true` if the event is at the front of the queue, and `false`
+        /// otherwise.
+        void addR(PairHandle          *result,
+                  bsls::Types::Int64   key,
+                  const EventData&     data,
+                  bool                *newFrontFlag = 0);
+
+        /// Add an event having the specified `key` and `data` to this
+        /// queue, and load into the specified `result` a reference to the
+        /// event that must be released using `releaseReferenceRaw`.  Load
+        /// into the optionally specified `newFrontFlag` `true` if the
+        /// event is at the front of the queue, and `false` otherwise.
+        void addRawR(Pair               **result,
+                     bsls::Types::Int64   key,
+                     const EventData&     data,
+                     bool                *newFrontFlag = 0);
+
+        /// Inform this queue that the specified `now` has been reached, so
+        /// that events whose key is not later than `now` are removed in
+        /// constant time.  Events subsequently added with a key earlier
+        /// than `now` remain correctly ordered, but adding each of them
+        /// takes time linear in the number of such events.  Note that this
+        /// method has no effect unless this queue uses a timing wheel.
+        void advance(bsls::Types::Int64 now);
+
+        /// Release the specified `reference` to an event.
+        void releaseReferenceRaw(const Pair *reference);
+
+        /// Remove the event referred to by the specified `reference` from
+        /// this queue.  Return 0 on success, `e_NOT_FOUND` if the event
+        /// has already been removed, and `e_INVALID` if `reference` is 0.
+        int remove(const Pair *reference);
+
+        /// Remove all events from this queue.  Return the number of events
+        /// removed.
+        int removeAll();
+
+        /// Assign the specified `newKey` to the event referred to by the
+        /// specified `reference`, moving the event within this queue as
+        /// necessary.  Load into the optionally specified `newFrontFlag`
+        /// `true` if the event is then at the front of the queue, and
+        /// `false` otherwise.  Return 0 on success, `e_NOT_FOUND` if the
+        /// event is no longer in this queue, and `e_INVALID` if
+        /// `reference` is 0.
+        int updateR(const Pair         *reference,
+                    bsls::Types::Int64  newKey,
+                    bool               *newFrontFlag = 0);
+
+        // ACCESSORS
+
+        /// Increment the reference count of the event referred to by the
+        /// specified `reference`, and return `reference`.  There must be a
+        /// corresponding call to `releaseReferenceRaw`.
+        Pair *addPairReferenceRaw(const Pair *reference) const;
+
+        /// Return the allocator used by this queue to supply memory.
+        bslma::Allocator *allocator() const;
+
+        /// Return a reference providing modifiable access to the data of
+        /// the event referred to by the specified `reference`.
+        EventData& data(const Pair *reference) const;
+
+        /// Load into the specified `front` a reference to the first event
+        /// in this queue.  Return 0 on success, and a non-zero value (with
+        /// no effect on `front`) if this queue is empty.
+        int front(PairHandle *front) const;
+
+        /// Load into the specified `front` a reference to the first event
+        /// in this queue, or 0 if this queue is empty.  The reference must
+        /// be released using `releaseReferenceRaw`.  Return 0 on success,
+        /// and a non-zero value if this queue is empty.
+        int frontRaw(Pair **front) const;
+
+        /// Return the time of the event referred to by the specified
+        /// `reference`.
+        bsls::Types::Int64 key(const Pair *reference) const;
+
+        /// Return the number of events in this queue.
+        int length() const;
+    };
+
     // FRIENDS
     friend class EventSchedulerEventHandle;
     friend class EventSchedulerRecurringEventHandle;
@@ -1034,6 +1309,51 @@ class EventScheduler {
                    bdlm::MetricsRegistry       *metricsRegistry,
                    bslma::Allocator            *basicAllocator = 0);
 
+    /// Create an event scheduler keeping its one-time events in a store of
+    /// the specified `storeType` (see {Timer Store} in the component
+    /// documentation) and using the specified `clockType` to indicate the
+    /// epoch used for all time intervals (see {Supported Clock Types} in
+    /// the component documentation).  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    EventScheduler(bdlc::TimerStoreType::Enum   storeType,
+                   bsls::SystemClockType::Enum  clockType,
+                   bslma::Allocator            *basicAllocator = 0);
+
+    /// Create an event scheduler keeping its one-time events in a store of
+    /// the specified `storeType` (see {Timer Store} in the component
+    /// documentation), using the specified `dispatcherFunctor` (see {The
+    /// Dispatcher Thread and the Dispatcher Functor} in the component-level
+    /// documentation), and using the specified `clockType` to indicate the
+    /// epoch used for all time intervals (see {Supported Clock Types} in
+    /// the component documentation).  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    EventScheduler(bdlc::TimerStoreType::Enum   storeType,
+                   const Dispatcher&            dispatcherFunctor,
+                   bsls::SystemClockType::Enum  clockType,
+                   bslma::Allocator            *basicAllocator = 0);
+
+    /// Create an event scheduler keeping its one-time events in a store of
+    /// the specified `storeType` (see {Timer Store} in the component
+    /// documentation), using the specified `dispatcherFunctor` (see {The
+    /// Dispatcher Thread and the Dispatcher Functor} in the component-level
+    /// documentation), using the specified `clockType` to indicate the
+    /// epoch used for all time intervals (see {Supported Clock Types} in
+    /// the component documentation), the specified `eventSchedulerName` to
+    /// be used to identify this event scheduler, and the specified
+    /// `metricsRegistry` to be used for reporting metrics.  If
+    /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::singleton()` is
+    /// used.  Optionally specify a `basicAllocator` used to supply memory.
+    /// If `basicAllocator` is 0, the currently installed default allocator
+    /// is used.
+    EventScheduler(bdlc::TimerStoreType::Enum   storeType,
+                   const Dispatcher&            dispatcherFunctor,
+                   bsls::SystemClockType::Enum  clockType,
+                   const bsl::string_view&      eventSchedulerName,
+                   bdlm::MetricsRegistry       *metricsRegistry,
+                   bslma::Allocator            *basicAllocator = 0);
+
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
     /// Create an event scheduler using the specified `dispatcherFunctor`
     /// (see {The Dispatcher Thread and the Dispatcher Functor} in the
@@ -1672,6 +1992,152 @@ class EventSchedulerTestTimeSource {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
+                // --------------------------------------------
+                // class EventScheduler::EventQueue::PairHandle
+                // --------------------------------------------
+
+// CREATORS
+inline
+EventScheduler::EventQueue::PairHandle::PairHandle()
+: d_queue_p(0)
+, d_pair_p(0)
+{
+}
+
+inline
+EventScheduler::EventQueue::PairHandle::PairHandle(
+                                                  const PairHandle& original)
+: d_queue_p(original.d_queue_p)
+, d_pair_p(original.d_pair_p
+           ? original.d_queue_p->addPairReferenceRaw(original.d_pair_p)
+           : 0)
+{
+}
+
+inline
+EventScheduler::EventQueue::PairHandle::~PairHandle()
+{
+    release();
+}
+
+// MANIPULATORS
+inline
+EventScheduler::EventQueue::PairHandle&
+EventScheduler::EventQueue::PairHandle::operator=(const PairHandle& rhs)
+{
+    if (this != &rhs) {
+        Pair *reference = rhs.d_pair_p
+                        ? rhs.d_queue_p->addPairReferenceRaw(rhs.d_pair_p)
+                        : 0;
+        release();
+        d_queue_p = rhs.d_queue_p;
+        d_pair_p  = reference;
+    }
+    return *this;
+}
+
+inline
+void EventScheduler::EventQueue::PairHandle::release()
+{
+    if (d_pair_p) {
+        d_queue_p->releaseReferenceRaw(d_pair_p);
+        d_pair_p = 0;
+    }
+}
+
+inline
+void EventScheduler::EventQueue::PairHandle::reset(EventQueue *queue,
+                                                   Pair       *reference)
+{
+    release();
+    d_queue_p = queue;
+    d_pair_p  = reference;
+}
+
+// ACCESSORS
+inline
+EventScheduler::EventQueue::PairHandle::operator Pair*() const
+{
+    return d_pair_p;
+}
+
+inline
+bsls::Types::Int64 EventScheduler::EventQueue::PairHandle::key() const
+{
+    BSLS_ASSERT(d_pair_p);
+
+    return d_queue_p->key(d_pair_p);
+}
+
+                      // --------------------------------
+                      // class EventScheduler::EventQueue
+                      // --------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+EventScheduler::EventQueue::List::Pair *
+EventScheduler::EventQueue::toListPair(const Pair *reference)
+{
+    return reinterpret_cast<List::Pair *>(
+                     const_cast<void *>(static_cast<const void *>(reference)));
+}
+
+inline
+EventScheduler::EventQueue::WheelNode *
+EventScheduler::EventQueue::toNode(const Pair *reference)
+{
+    return reinterpret_cast<WheelNode *>(
+                     const_cast<void *>(static_cast<const void *>(reference)));
+}
+
+inline
+EventScheduler::EventQueue::Pair *
+EventScheduler::EventQueue::toPair(bdlc::TimingWheelLink *node)
+{
+    return reinterpret_cast<Pair *>(static_cast<WheelNode *>(node));
+}
+
+// ACCESSORS
+inline
+EventScheduler::EventQueue::Pair *
+EventScheduler::EventQueue::addPairReferenceRaw(const Pair *reference) const
+{
+    if (d_wheel_p) {
+        ++toNode(reference)->d_refCount;
+        return const_cast<Pair *>(reference);                         // RETURN
+    }
+
+    d_list.addPairReferenceRaw(toListPair(reference));
+    return const_cast<Pair *>(reference);
+}
+
+inline
+bslma::Allocator *EventScheduler::EventQueue::allocator() const
+{
+    return d_list.allocator();
+}
+
+inline
+EventScheduler::EventData&
+EventScheduler::EventQueue::data(const Pair *reference) const
+{
+    if (d_wheel_p) {
+        return toNode(reference)->d_data;                             // RETURN
+    }
+
+    return toListPair(reference)->data();
+}
+
+inline
+bsls::Types::Int64 EventScheduler::EventQueue::key(const Pair *reference) const
+{
+    if (d_wheel_p) {
+        return toNode(reference)->time();                             // RETURN
+    }
+
+    return toListPair(reference)->key();
+}
+
                       // -------------------------------
                       // class EventSchedulerEventHandle
                       // -------------------------------
@@ -1840,7 +2306,7 @@ int EventScheduler::cancelEvent(const Event *handle)
         // `d_callback` may contain event handles which are in reference cycles
         // which would prevent cleanup of the node and freeing of resources.
 
-        itemPtr->data().d_callback = 0;
+        d_eventQueue.data(itemPtr).d_callback = 0;
     }
 
     return ret;
@@ -1898,7 +2364,7 @@ int EventScheduler::rescheduleEvent(
     bsls::TimeInterval offsetFromNow(newEpochTime - t_CLOCK::now());
 
     if (h) {
-        h->data().d_nowOffset = bdlf::BindUtil::bind(
+        d_eventQueue.data(h).d_nowOffset = bdlf::BindUtil::bind(
                                          timeUntilTrigger<t_CLOCK, t_DURATION>,
                                          newEpochTime);
     }
@@ -1933,7 +2399,7 @@ int EventScheduler::rescheduleEventAndWait(
         bsls::TimeInterval offsetFromNow(newEpochTime - t_CLOCK::now());
 
         if (h) {
-            h->data().d_nowOffset = bdlf::BindUtil::bind(
+            d_eventQueue.data(h).d_nowOffset = bdlf::BindUtil::bind(
                                          timeUntilTrigger<t_CLOCK, t_DURATION>,
                                          newEpochTime);
         }
@@ -21,6 +21,7 @@
 #include <bslim_testutil.h>
 
 #include <bslma_default.h>
+#include <bslma_managedptr.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
@@ -114,6 +115,10 @@ using namespace bsl;
 // [20] bdlmt::EventScheduler(disp, clockType, alloc = 0);
 // [20] bdlmt::EventScheduler(disp, clockType, id, adapter, alloc = 0);
 //
+// [37] bdlmt::EventScheduler(storeType, clockType, alloc = 0);
+// [37] bdlmt::EventScheduler(store, disp, clockType, alloc = 0);
+// [37] bdlmt::EventScheduler(store, disp, clock, id, adapter, a = 0);
+//
 // [ 1] ~bdlmt::EventScheduler();
 //
 // MANIPULATORS
@@ -158,6 +163,7 @@ using namespace bsl;
 // [33] CONCERN: THREAD NAMES
 // [36] TESTING CONCERN: Self-canceling non-recurring callback
 // [36] TESTING CONCERN: Self-canceling recurring callback
+// [37] CONCERN: TIMING WHEEL STORE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1618,6 +1624,191 @@ void case25CallbackFunction()
     ++s_case25CallbackInvocationCount;
 }
 
+// ============================================================================
+//                         CASE 37 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_37 {
+
+enum { k_NUM_EVENTS = 200 };
+
+/// Return a time interval of the specified `numMilliseconds`.
+bsls::TimeInterval milliseconds(int numMilliseconds)
+{
+    bsls::TimeInterval result;
+    result.addMilliseconds(numMilliseconds);
+    return result;
+}
+
+/// Append the specified `id` to the specified `ids`.
+void record(bsl::vector<int> *ids, int id)
+{
+    ids->push_back(id);
+}
+
+/// Return the time at which event `id` of the scenario run by `runScenario`
+/// is initially scheduled, relative to the time at which the scenario
+/// starts.  The times of distinct events are distinct multiples of 10ms.
+bsls::TimeInterval offset(int id)
+{
+    return milliseconds(((id * 7919) % k_NUM_EVENTS + 1) * 10);
+}
+
+/// Return `true` if the scenario run by `runScenario` cancels event `id`,
+/// and `false` otherwise.
+bool isCancelled(int id)
+{
+    return (0 == id % 3 && 0 == id % 4) || (1 == id % 3 && 1 == id % 5);
+}
+
+/// Load into the specified `ids` the identifiers of the events of the
+/// scenario run by `runScenario`, in the order in which they are expected to
+/// be dispatched.
+void expectedOrder(bsl::vector<int> *ids)
+{
+    bsl::vector<bsl::pair<bsls::TimeInterval, int> > events;
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        if (isCancelled(i)) {
+            continue;
+        }
+        if (6 == i) {
+            events.push_back(bsl::make_pair(milliseconds(5), i));
+        }
+        else if (0 == i % 3 && 3 == i % 7) {
+            events.push_back(bsl::make_pair(milliseconds(3000 + i), i));
+        }
+        else {
+            events.push_back(bsl::make_pair(offset(i), i));
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        events.push_back(bsl::make_pair(bsls::TimeInterval(i, 500500000),
+                                        -1));
+    }
+
+    bsl::sort(events.begin(), events.end());
+
+    ids->clear();
+    for (bsl::size_t i = 0; i < events.size(); ++i) {
+        ids->push_back(events[i].second);
+    }
+}
+
+/// Run a scenario scheduling, cancelling, and rescheduling one-time events,
+/// and scheduling a recurring event, on an event scheduler using a store of
+/// the specified `storeType` and the specified `basicAllocator`, and load
+/// into the specified `ids` the identifiers of the events in the order in
+/// which they are dispatched (where the recurring event has identifier -1).
+void runScenario(bsl::vector<int>           *ids,
+                 bdlc::TimerStoreType::Enum  storeType,
+                 bslma::Allocator           *basicAllocator)
+{
+    Obj        mX(storeType,
+                  bsls::SystemClockType::e_MONOTONIC,
+                  basicAllocator);
+    const Obj& X = mX;
+
+    bdlmt::EventSchedulerTestTimeSource timeSource(&mX, basicAllocator);
+
+    const bsls::TimeInterval start = timeSource.now();
+
+    bsl::vector<EventHandle> handles(k_NUM_EVENTS, basicAllocator);
+    bsl::vector<Event *>     raw(k_NUM_EVENTS,
+                                 static_cast<Event *>(0),
+                                 basicAllocator);
+
+    int numPending = 0;
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        const bsl::function<void()> callback(bdlf::BindUtil::bind(&record,
+                                                                  ids,
+                                                                  i));
+
+        switch (i % 3) {
+          case 0: {
+            mX.scheduleEvent(&handles[i], start + offset(i), callback);
+          } break;
+          case 1: {
+            mX.scheduleEventRaw(&raw[i], start + offset(i), callback);
+          } break;
+          default: {
+            mX.scheduleEvent(start + offset(i), callback);
+          } break;
+        }
+        ++numPending;
+    }
+    ASSERTV(X.numEvents(), k_NUM_EVENTS == X.numEvents());
+
+    RecurringEventHandle recurring;
+    mX.scheduleRecurringEvent(&recurring,
+                              bsls::TimeInterval(1, 0),
+                              bdlf::BindUtil::bind(&record, ids, -1),
+                              start + bsls::TimeInterval(0, 500500000));
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        if (!isCancelled(i)) {
+            continue;
+        }
+        const Event *event = 0 == i % 3 ? handles[i] : raw[i];
+
+        const int rc = mX.cancelEvent(event);
+        ASSERTV(i, rc, 0 == rc);
+        ASSERTV(i, 0 != mX.cancelEvent(event));
+        --numPending;
+    }
+    ASSERTV(X.numEvents(), numPending, numPending == X.numEvents());
+
+    for (int i = 0; i < k_NUM_EVENTS; i += 3) {
+        if (isCancelled(i)) {
+            ASSERTV(i, 0 != mX.rescheduleEvent(handles[i], start));
+        }
+        else if (6 == i) {
+            ASSERTV(i, 0 == mX.rescheduleEvent(handles[i],
+                                               start + milliseconds(5)));
+        }
+        else if (3 == i % 7) {
+            ASSERTV(i, 0 == mX.rescheduleEvent(
+                                           handles[i],
+                                           start + milliseconds(3000 + i)));
+        }
+    }
+    ASSERTV(X.numEvents(), numPending, numPending == X.numEvents());
+
+    bsls::TimeInterval expectedNext;
+    expectedNext.addMicroseconds(
+                                (start + milliseconds(5)).totalMicroseconds());
+    ASSERTV(X.nextPendingEventTime(), expectedNext,
+            expectedNext == X.nextPendingEventTime());
+
+    ASSERT(0 == mX.start());
+
+    // Advance the time in steps of 1ms, so that the dispatcher is never more
+    // than one event behind, and the order in which events are dispatched is
+    // the order of their times.
+
+    for (int i = 0; i < 4000; ++i) {
+        timeSource.advanceTime(milliseconds(1));
+    }
+
+    mX.stop();
+
+    ASSERTV(X.numEvents(), 0 == X.numEvents());
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        if (raw[i]) {
+            ASSERTV(i, 0 != mX.cancelEvent(raw[i]));
+            mX.releaseEventRaw(raw[i]);
+        }
+        if (handles[i]) {
+            ASSERTV(i, 0 != mX.cancelEvent(handles[i]));
+        }
+    }
+
+    ASSERT(0 == mX.cancelEvent(&recurring));
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_37
+
 // ============================================================================
 //                         CASE 20 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -3040,6 +3231,63 @@ struct TestPrintClass {
 
 }  // close namespace EVENTSCHEDULER_TEST_CASE_MINUS_1
 
+// ============================================================================
+//                         CASE -2 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_MINUS_2 {
+
+/// Do nothing.
+void noop()
+{
+}
+
+/// Schedule the specified `numEvents` one-time events, at pseudo-random times
+/// 30 to 40 seconds in the future, on an event scheduler using a store of
+/// the specified `storeType`, then cancel each of them, and print the time
+/// taken by each phase, labelled by the specified `label`.
+void runTimeouts(const char                 *label,
+                 bdlc::TimerStoreType::Enum  storeType,
+                 int                         numEvents)
+{
+    Obj mX(storeType, bsls::SystemClockType::e_MONOTONIC);
+
+    bsl::vector<EventHandle> handles(numEvents);
+
+    const bsls::TimeInterval now = mX.now();
+    const bsl::function<void()> callback(&noop);
+
+    unsigned int seed = 12345;
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < numEvents; ++i) {
+        seed = seed * 1103515245 + 12345;
+        bsls::TimeInterval time = now + bsls::TimeInterval(30, 0);
+        time.addMicroseconds((seed >> 8) % 10000000);
+
+        mX.scheduleEvent(&handles[i], time, callback);
+    }
+
+    timer.stop();
+    const double scheduleTime = timer.accumulatedWallTime();
+    timer.reset();
+    timer.start();
+
+    for (int i = 0; i < numEvents; ++i) {
+        mX.cancelEvent(&handles[i]);
+    }
+
+    timer.stop();
+    const double cancelTime = timer.accumulatedWallTime();
+
+    cout << label << ": schedule " << scheduleTime
+         << "s, cancel " << cancelTime << "s" << endl;
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_MINUS_2
+
 // ============================================================================
 //                        CASE -100 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -3163,6 +3411,157 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 37: {
+        // --------------------------------------------------------------------
+        // CONCERN: TIMING WHEEL STORE
+        //
+        // Concerns:
+        // 1. An event scheduler keeping its one-time events in either store
+        //    dispatches one-time and recurring events in the order of their
+        //    times.
+        //
+        // 2. Cancelling and rescheduling one-time events referred to by
+        //    handles or raw pointers behaves the same for either store.
+        //
+        // 3. `numEvents` and `nextPendingEventTime` reflect the one-time
+        //    events in either store.
+        //
+        // 4. `cancelAllEvents` removes every one-time event from either
+        //    store.
+        //
+        // 5. Every constructor taking a store type creates a scheduler using
+        //    a store of that type.
+        //
+        // 6. All memory is supplied by the allocator supplied at
+        //    construction, and is released.
+        //
+        // Plan:
+        // 1. For each store type, run a scenario that schedules 200 one-time
+        //    events at distinct times (through handles, raw pointers, and
+        //    neither), cancels and reschedules some of them, and schedules a
+        //    recurring event, then advances a test time source in steps of
+        //    1ms.  Verify the return codes of the operations, the number of
+        //    pending events, the next pending event time, and that the order
+        //    in which events are dispatched is the order computed
+        //    independently from their times.  (C-1..3)
+        //
+        // 2. Using each constructor taking a store type, and each store type,
+        //    schedule events through handles, invoke `cancelAllEvents`, and
+        //    verify that no event remains and that the handles can no longer
+        //    cancel their events.  (C-4..5)
+        //
+        // 3. Supply a test allocator to each scheduler, and verify that no
+        //    memory remains in use after the scheduler is destroyed.  (C-6)
+        //
+        // Testing:
+        //   bdlmt::EventScheduler(storeType, clockType, alloc = 0);
+        //   bdlmt::EventScheduler(store, disp, clockType, alloc = 0);
+        //   bdlmt::EventScheduler(store, disp, clock, id, adapter, a = 0);
+        //   CONCERN: TIMING WHEEL STORE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCERN: TIMING WHEEL STORE\n"
+                             "===========================\n";
+
+        namespace TC = EVENTSCHEDULER_TEST_CASE_37;
+
+        const bdlc::TimerStoreType::Enum STORES[] = {
+            bdlc::TimerStoreType::e_ORDERED,
+            bdlc::TimerStoreType::e_TIMING_WHEEL
+        };
+        const int NUM_STORES = sizeof STORES / sizeof *STORES;
+
+        if (verbose) cout << "Order of dispatch\n";
+        {
+            bsl::vector<int> EXPECTED;
+            TC::expectedOrder(&EXPECTED);
+
+            for (int ti = 0; ti < NUM_STORES; ++ti) {
+                const bdlc::TimerStoreType::Enum STORE = STORES[ti];
+
+                bslma::TestAllocator oa("object", veryVeryVerbose);
+
+                bsl::vector<int> ids;
+                TC::runScenario(&ids, STORE, &oa);
+
+                ASSERTV(STORE, EXPECTED.size(), ids.size(),
+                        EXPECTED.size() == ids.size());
+                ASSERTV(STORE, EXPECTED == ids);
+                ASSERTV(STORE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "`cancelAllEvents` and constructors\n";
+        {
+            using EVENTSCHEDULER_TEST_CASE_20::dispatcherFunction;
+
+            for (int ti = 0; ti < NUM_STORES; ++ti) {
+                const bdlc::TimerStoreType::Enum STORE = STORES[ti];
+
+                for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+                    const char CONFIG = cfg;
+
+                    bslma::TestAllocator oa("object", veryVeryVerbose);
+                    {
+                        bslma::ManagedPtr<Obj> mX;
+                        switch (CONFIG) {
+                          case 'a': {
+                            mX.load(new (oa) Obj(
+                                           STORE,
+                                           bsls::SystemClockType::e_MONOTONIC,
+                                           &oa),
+                                    &oa);
+                          } break;
+                          case 'b': {
+                            mX.load(new (oa) Obj(
+                                           STORE,
+                                           &dispatcherFunction,
+                                           bsls::SystemClockType::e_MONOTONIC,
+                                           &oa),
+                                    &oa);
+                          } break;
+                          case 'c': {
+                            mX.load(new (oa) Obj(
+                                           STORE,
+                                           &dispatcherFunction,
+                                           bsls::SystemClockType::e_MONOTONIC,
+                                           "wheel",
+                                           0,
+                                           &oa),
+                                    &oa);
+                          } break;
+                        }
+
+                        ASSERTV(STORE, CONFIG, &oa == mX->allocator());
+                        ASSERTV(STORE, CONFIG,
+                                bsls::SystemClockType::e_MONOTONIC ==
+                                                            mX->clockType());
+
+                        const bsls::TimeInterval T = mX->now() +
+                                                    bsls::TimeInterval(3600);
+
+                        EventHandle handles[50];
+                        for (int i = 0; i < 50; ++i) {
+                            mX->scheduleEvent(&handles[i],
+                                              T + TC::milliseconds(i % 7),
+                                              bsl::function<void()>());
+                        }
+                        ASSERTV(STORE, CONFIG, 50 == mX->numEvents());
+
+                        mX->cancelAllEvents();
+
+                        ASSERTV(STORE, CONFIG, 0 == mX->numEvents());
+                        for (int i = 0; i < 50; ++i) {
+                            ASSERTV(STORE, CONFIG, i,
+                                    0 != mX->cancelEvent(handles[i]));
+                        }
+                    }
+                    ASSERTV(STORE, CONFIG, oa.numBlocksInUse(),
+                            0 == oa.numBlocksInUse());
+                }
+            }
+        }
+      } break;
       case 36: {
         // --------------------------------------------------------------------
         // Testing self-cancellation in the context of reference cycles
@@ -9079,6 +9478,40 @@ int main(int argc, char *argv[])
             x.cancelAllEvents();
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TIMER STORES
+        //
+        // Concerns:
+        // 1. Scheduling and cancelling one-time events is faster on a
+        //    scheduler keeping them in a timing wheel than on one keeping
+        //    them in a skip list.
+        //
+        // Plan:
+        // 1. For each store type, schedule a number of one-time events (given
+        //    by the optional second argument, 1000000 by default) at
+        //    pseudo-random times, cancel them, and report the time taken.
+        //
+        // Testing:
+        //   PERFORMANCE: TIMER STORES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: TIMER STORES\n"
+                             "=========================\n";
+
+        using namespace EVENTSCHEDULER_TEST_CASE_MINUS_2;
+
+        const int numEvents = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        cout << "events: " << numEvents << endl;
+
+        runTimeouts("skip list   ",
+                    bdlc::TimerStoreType::e_ORDERED,
+                    numEvents);
+        runTimeouts("timing wheel",
+                    bdlc::TimerStoreType::e_TIMING_WHEEL,
+                    numEvents);
+      } break;
       case -100: {
         // --------------------------------------------------------------------
         // The router simulation (kind of) test
@@ -11,6 +11,8 @@ BSLS_IDENT_RCSID(bdlmt_fixedthreadpool_cpp,"$Id$ $CSID$")
 #include <bdlm_metric.h>
 #include <bdlm_metricdescriptor.h>
 
+#include <bslma_default.h>
+
 #include <bsls_nullptr.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -80,6 +82,25 @@ namespace bdlmt {
 const char FixedThreadPool::s_defaultThreadName[16] = { "bdl.FixedPool" };
 
 // PRIVATE MANIPULATORS
+void FixedThreadPool::drainLockFreeQueue()
+{
+    // Each processing thread arrives at the barrier once it observes the
+    // queue as empty, which guarantees that all the jobs enqueued before this
+    // call have completed when all the threads have arrived.
+
+    d_control = e_DRAIN;
+    wakeThreads(d_numThreads);
+    d_barrier.wait();  // pool threads acknowledge drain
+
+    // All the processing threads are waiting on the barrier: discard any
+    // surplus wake-up so that idle threads do not spin on the semaphore.
+
+    d_control = e_RUN;
+    while (0 == d_workSemaphore.tryWait()) {
+    }
+    d_barrier.wait();  // pool threads may proceed
+}
+
 void FixedThreadPool::initialize(bdlm::MetricsRegistry   *metricsRegistry,
                                  const bsl::string_view&  threadPoolName)
 {
@@ -152,6 +173,75 @@ void FixedThreadPool::workerThread()
     } while (d_drainFlag);
 }
 
+void FixedThreadPool::lockFreeWorkerThread()
+{
+    d_barrier.wait();  // initial synchronization in 'start'
+
+    bdlcc::FixedQueue<Job>& queue = *d_lockFreeQueue_p;
+
+    Job functor;
+
+    for (;;) {
+        if (0 == queue.tryPopFront(&functor)) {
+            d_numActiveThreads.addAcqRel(1);
+            functor();
+            functor = bsl::nullptr_t();  // ensure destructor is called
+            d_numActiveThreads.addAcqRel(-1);
+            continue;                                               // CONTINUE
+        }
+
+        const int control = d_control;
+
+        if (e_RUN != control && queue.isEmpty()) {
+            if (e_STOP == control) {
+                return;                                               // RETURN
+            }
+
+            d_barrier.wait();  // pool threads acknowledge drain
+            d_barrier.wait();  // pool threads may proceed
+            continue;                                               // CONTINUE
+        }
+
+        // Register as waiting before checking the queue one last time.  The
+        // increment of 'd_numWaitingThreads', and the loads performed by
+        // 'isEmpty' and of 'd_control', are sequentially consistent; paired
+        // with 'wakeThreads', this guarantees that either this thread
+        // observes the newly enqueued job (or the change of state), or the
+        // enqueuing (or controlling) thread observes this thread as waiting.
+
+        d_numWaitingThreads.add(1);
+
+        if (queue.isEmpty() && e_RUN == d_control) {
+            d_workSemaphore.wait();
+        }
+
+        d_numWaitingThreads.add(-1);
+    }
+}
+
+void FixedThreadPool::stopLockFreeQueue(bool removePendingJobs)
+{
+    d_lockFreeQueue_p->disable();
+
+    if (removePendingJobs) {
+        d_lockFreeQueue_p->removeAll();
+    }
+
+    d_control = e_STOP;
+    wakeThreads(d_numThreads);
+    d_threadGroup.joinAll();
+
+    // A job whose enqueue started before the queue was disabled may have
+    // been enqueued after the last 'removeAll'.
+
+    if (removePendingJobs) {
+        d_lockFreeQueue_p->removeAll();
+    }
+
+    while (0 == d_workSemaphore.tryWait()) {
+    }
+}
+
 int FixedThreadPool::startNewThread()
 {
 #if defined(BSLS_PLATFORM_OS_UNIX)
@@ -161,8 +251,15 @@ int FixedThreadPool::startNewThread()
     pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
 #endif
 
-    bsl::function<void()> workerThreadFunc =
+    bsl::function<void()> workerThreadFunc;
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        workerThreadFunc = bdlf::MemFnUtil::memFn(
+                                 &FixedThreadPool::lockFreeWorkerThread, this);
+    }
+    else {
+        workerThreadFunc =
                   bdlf::MemFnUtil::memFn(&FixedThreadPool::workerThread, this);
+    }
 
     int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
 
@@ -182,12 +279,18 @@ FixedThreadPool::FixedThreadPool(
                              int                             maxNumPendingJobs,
                              bslma::Allocator               *basicAllocator)
 : d_queue(maxNumPendingJobs, basicAllocator)
+, d_queueBackend(e_BOUNDED_QUEUE)
+, d_lockFreeQueue_p(0)
+, d_control(e_STOP)
+, d_numWaitingThreads(0)
+, d_workSemaphore()
 , d_numActiveThreads(0)
 , d_drainFlag(false)
 , d_barrier(numThreads + 1)
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
 , d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(1 <= numThreads);
 
@@ -206,12 +309,18 @@ FixedThreadPool::FixedThreadPool(
                              bdlm::MetricsRegistry          *metricsRegistry,
                              bslma::Allocator               *basicAllocator)
 : d_queue(maxNumPendingJobs, basicAllocator)
+, d_queueBackend(e_BOUNDED_QUEUE)
+, d_lockFreeQueue_p(0)
+, d_control(e_STOP)
+, d_numWaitingThreads(0)
+, d_workSemaphore()
 , d_numActiveThreads(0)
 , d_drainFlag(false)
 , d_barrier(numThreads + 1)
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
 , d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(1 <= numThreads);
 
@@ -226,12 +335,18 @@ FixedThreadPool::FixedThreadPool(int               numThreads,
                                  int               maxNumPendingJobs,
                                  bslma::Allocator *basicAllocator)
 : d_queue(maxNumPendingJobs, basicAllocator)
+, d_queueBackend(e_BOUNDED_QUEUE)
+, d_lockFreeQueue_p(0)
+, d_control(e_STOP)
+, d_numWaitingThreads(0)
+, d_workSemaphore()
 , d_numActiveThreads(0)
 , d_drainFlag(false)
 , d_barrier(numThreads + 1)
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(basicAllocator)
 , d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(1 <= numThreads);
 
@@ -246,12 +361,18 @@ FixedThreadPool::FixedThreadPool(int                      numThreads,
                                  bdlm::MetricsRegistry   *metricsRegistry,
                                  bslma::Allocator        *basicAllocator)
 : d_queue(maxNumPendingJobs, basicAllocator)
+, d_queueBackend(e_BOUNDED_QUEUE)
+, d_lockFreeQueue_p(0)
+, d_control(e_STOP)
+, d_numWaitingThreads(0)
+, d_workSemaphore()
 , d_numActiveThreads(0)
 , d_drainFlag(false)
 , d_barrier(numThreads + 1)
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(basicAllocator)
 , d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(1 <= numThreads);
 
@@ -260,9 +381,97 @@ FixedThreadPool::FixedThreadPool(int                      numThreads,
     initialize(metricsRegistry, threadPoolName);
 }
 
+FixedThreadPool::FixedThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             int                             maxNumPendingJobs,
+                             QueueBackend                    queueBackend,
+                             bslma::Allocator               *basicAllocator)
+: d_queue(e_LOCK_FREE_QUEUE == queueBackend ? 1 : maxNumPendingJobs,
+          basicAllocator)
+, d_queueBackend(queueBackend)
+, d_lockFreeQueue_p(0)
+, d_control(e_STOP)
+, d_numWaitingThreads(0)
+, d_workSemaphore()
+, d_numActiveThreads(0)
+, d_drainFlag(false)
+, d_barrier(numThreads + 1)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+    BSLS_ASSERT_OPT(1 <= maxNumPendingJobs);
+
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        d_lockFreeQueue_p = new (*d_allocator_p)
+                           bdlcc::FixedQueue<Job>(maxNumPendingJobs,
+                                                  d_allocator_p);
+        d_lockFreeQueue_p->disable();
+    }
+
+    initialize(
+        0,
+        (!d_threadAttributes.threadName().empty()
+         ? d_threadAttributes.threadName()
+         : bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION));
+}
+
+FixedThreadPool::FixedThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             int                             maxNumPendingJobs,
+                             QueueBackend                    queueBackend,
+                             const bsl::string_view&         threadPoolName,
+                             bdlm::MetricsRegistry          *metricsRegistry,
+                             bslma::Allocator               *basicAllocator)
+: d_queue(e_LOCK_FREE_QUEUE == queueBackend ? 1 : maxNumPendingJobs,
+          basicAllocator)
+, d_queueBackend(queueBackend)
+, d_lockFreeQueue_p(0)
+, d_control(e_STOP)
+, d_numWaitingThreads(0)
+, d_workSemaphore()
+, d_numActiveThreads(0)
+, d_drainFlag(false)
+, d_barrier(numThreads + 1)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+    BSLS_ASSERT_OPT(1 <= maxNumPendingJobs);
+
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        d_lockFreeQueue_p = new (*d_allocator_p)
+                           bdlcc::FixedQueue<Job>(maxNumPendingJobs,
+                                                  d_allocator_p);
+        d_lockFreeQueue_p->disable();
+    }
+
+    if (d_threadAttributes.threadName().empty()) {
+        d_threadAttributes.setThreadName(threadPoolName);
+    }
+
+    initialize(metricsRegistry, threadPoolName);
+}
+
 FixedThreadPool::~FixedThreadPool()
 {
     shutdown();
+
+    if (d_lockFreeQueue_p) {
+        // Ensure the metrics callbacks cannot access the queue once it is
+        // destroyed.
+
+        d_backlogHandle.unregister();
+        d_usedCapacityHandle.unregister();
+
+        d_allocator_p->deleteObject(d_lockFreeQueue_p);
+    }
 }
 
 // MANIPULATORS
@@ -270,7 +479,8 @@ int FixedThreadPool::start()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
 
-    if (!d_queue.isPopFrontDisabled()) {
+    if (e_LOCK_FREE_QUEUE == d_queueBackend ? e_STOP != d_control
+                                            : !d_queue.isPopFrontDisabled()) {
         return 0;                                                     // RETURN
     }
 
@@ -288,8 +498,14 @@ int FixedThreadPool::start()
         }
     }
 
-    d_queue.enablePopFront();
-    d_queue.enablePushBack();
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        d_control = e_RUN;
+        d_lockFreeQueue_p->enable();
+    }
+    else {
+        d_queue.enablePopFront();
+        d_queue.enablePushBack();
+    }
 
     d_barrier.wait();
 
@@ -61,6 +61,31 @@ BSLS_IDENT("$Id: $")
 // `bslmt_threadutil` package documentation for a description of
 // `bslmt::ThreadAttributes`.
 //
+///Queue Backends
+///--------------
+// A `bdlmt::FixedThreadPool` holds its pending jobs in the queue selected by
+// the `QueueBackend` supplied at construction:
+//
+// * `e_BOUNDED_QUEUE` (the default): jobs are held in a
+//   `bdlcc::BoundedQueue`.  Each enqueued job is handed to the processing
+//   threads through a semaphore.
+// * `e_LOCK_FREE_QUEUE`: jobs are held in a `bdlcc::FixedQueue`, a lock-free
+//   ring buffer whose cells are reserved using sequence numbers (see
+//   `bdlcc_fixedqueueindexmanager`).  Enqueuing a job does not post a
+//   semaphore unless a processing thread is waiting for work, so producers
+//   submitting short jobs to a busy pool do not contend on a semaphore.
+//
+// The `enqueueJobs` method submits a range of jobs.  When the
+// `e_LOCK_FREE_QUEUE` backend is used, the waiting processing threads are
+// woken once for the whole range (or once each time the queue becomes full
+// while the range is being enqueued) rather than once per job.  When the
+// `e_BOUNDED_QUEUE` backend is used, `enqueueJobs` is equivalent to invoking
+// `enqueueJob` for each job in the range.
+//
+// Both backends provide the same observable behavior for all the methods of
+// `bdlmt::FixedThreadPool`.  Note that the capacity of a `e_LOCK_FREE_QUEUE`
+// pool is exactly the `maxNumPendingJobs` supplied at construction.
+//
 // Thread pools are ideal for developing multi-threaded server applications.  A
 // server need only package client requests to execute as jobs, and
 // `bdlmt::FixedThreadPool` will handle the queue management, thread
@@ -314,6 +339,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlcc_boundedqueue.h>
+#include <bdlcc_fixedqueue.h>
 
 #include <bdlf_bind.h>
 
@@ -328,6 +354,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_threadgroup.h>
@@ -336,18 +363,14 @@ BSLS_IDENT("$Id: $")
 #include <bsls_atomic.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_functional.h>
 #include <bsl_string.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 
-#include <bdlcc_fixedqueue.h>
-
 #include <bslmt_condition.h>
-#include <bslmt_semaphore.h>
-
-#include <bsl_algorithm.h>
 
 #endif // BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 
@@ -393,6 +416,14 @@ class FixedThreadPool {
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
+    /// Enumeration of the queues that may be used by a thread pool to hold
+    /// its pending jobs.  See {Queue Backends}.
+    enum QueueBackend {
+        e_BOUNDED_QUEUE,    // jobs are held in a `bdlcc::BoundedQueue`
+
+        e_LOCK_FREE_QUEUE   // jobs are held in a `bdlcc::FixedQueue`
+    };
+
   private:
     // PRIVATE CLASS DATA
     static const char       s_defaultThreadName[16];  // Thread name to use
@@ -400,7 +431,31 @@ class FixedThreadPool {
                                                       // specified.
 
     // PRIVATE DATA
-    Queue                   d_queue;              // underlying queue
+    Queue                   d_queue;              // underlying queue (unused
+                                                  // unless `e_BOUNDED_QUEUE
+                                                  // == d_queueBackend`)
+
+    const QueueBackend      d_queueBackend;       // kind of queue holding the
+                                                  // pending jobs
+
+    bdlcc::FixedQueue<Job> *d_lockFreeQueue_p;    // underlying queue (null
+                                                  // unless `e_LOCK_FREE_QUEUE
+                                                  // == d_queueBackend`),
+                                                  // owned
+
+    bsls::AtomicInt         d_control;            // state of the processing
+                                                  // threads (`e_STOP`,
+                                                  // `e_RUN`, or `e_DRAIN`)
+                                                  // when `e_LOCK_FREE_QUEUE
+                                                  // == d_queueBackend`
+
+    bsls::AtomicInt         d_numWaitingThreads;  // number of threads waiting
+                                                  // on `d_workSemaphore`
+
+    bslmt::Semaphore        d_workSemaphore;      // semaphore on which idle
+                                                  // threads wait when
+                                                  // `e_LOCK_FREE_QUEUE ==
+                                                  // d_queueBackend`
 
     bsls::AtomicInt         d_numActiveThreads;   // number of threads
                                                   // processing jobs
@@ -436,8 +491,15 @@ class FixedThreadPool {
                             d_usedCapacityHandle; // used capacity metric
                                                   // handle
 
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held)
+
     // PRIVATE MANIPULATORS
 
+    /// Internal method used by `drain` when `e_LOCK_FREE_QUEUE ==
+    /// d_queueBackend`.  Note that this method must be called with
+    /// `d_metaMutex` locked.
+    void drainLockFreeQueue();
+
     /// Initialize this thread pool using the stored attributes and the
     /// specified `metricsRegistry` and `threadPoolName`.  If
     /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::singleton()`  is
@@ -448,6 +510,22 @@ class FixedThreadPool {
     /// The main function executed by each worker thread.
     void workerThread();
 
+    /// The main function executed by each worker thread when
+    /// `e_LOCK_FREE_QUEUE == d_queueBackend`.
+    void lockFreeWorkerThread();
+
+    /// Internal method used by `stop` and `shutdown` when
+    /// `e_LOCK_FREE_QUEUE == d_queueBackend`: disable enqueuing, remove all
+    /// pending jobs if the specified `removePendingJobs` is `true`, and join
+    /// all the processing threads once the queue is empty.  Note that this
+    /// method must be called with `d_metaMutex` locked.
+    void stopLockFreeQueue(bool removePendingJobs);
+
+    /// Release the threads waiting on `d_workSemaphore` that are needed to
+    /// process the specified `numJobs` newly enqueued jobs.  The behavior is
+    /// undefined unless `0 <= numJobs`.
+    void wakeThreads(int numJobs);
+
     /// Internal method to spawn a new processing thread and increment the
     /// current count.  Note that this method must be called with
     /// `d_metaMutex` locked.
@@ -533,6 +611,48 @@ class FixedThreadPool {
                     bdlm::MetricsRegistry          *metricsRegistry,
                     bslma::Allocator               *basicAllocator = 0);
 
+    /// Construct a thread pool with the specified `threadAttributes`,
+    /// `numThreads` number of threads, a job queue with capacity sufficient
+    /// to enqueue the specified `maxNumPendingJobs` without blocking, and
+    /// the specified `queueBackend` used to hold the pending jobs.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The name used for created threads is
+    /// `threadAttributes.threadName()` if not empty, otherwise
+    /// "bdl.FixedPool".  The detached state of `threadAttributes` is
+    /// ignored, and `e_CREATE_JOINABLE` is used in all cases.  The behavior
+    /// is undefined unless `1 <= numThreads` and `1 <= maxNumPendingJobs`.
+    /// See {Queue Backends}.
+    FixedThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                    int                             numThreads,
+                    int                             maxNumPendingJobs,
+                    QueueBackend                    queueBackend,
+                    bslma::Allocator               *basicAllocator = 0);
+
+    /// Construct a thread pool with the specified `threadAttributes`,
+    /// `numThreads` number of threads, a job queue with capacity sufficient
+    /// to enqueue the specified `maxNumPendingJobs` without blocking, the
+    /// specified `queueBackend` used to hold the pending jobs, the specified
+    /// `threadPoolName` to be used to identify this thread pool, and the
+    /// specified `metricsRegistry` to be used for reporting metrics.  If
+    /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::singleton()` is
+    /// used.  Optionally specify a `basicAllocator` used to supply memory.
+    /// If `basicAllocator` is 0, the currently installed default allocator
+    /// is used.  The name used for created threads is
+    /// `threadAttributes.threadName()` if not empty, otherwise
+    /// `threadPoolName` if not empty, otherwise "bdl.FixedPool".  The
+    /// detached state of `threadAttributes` is ignored, and
+    /// `e_CREATE_JOINABLE` is used in all cases.  The behavior is undefined
+    /// unless `1 <= numThreads` and `1 <= maxNumPendingJobs`.  See
+    /// {Queue Backends}.
+    FixedThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                    int                             numThreads,
+                    int                             maxNumPendingJobs,
+                    QueueBackend                    queueBackend,
+                    const bsl::string_view&         threadPoolName,
+                    bdlm::MetricsRegistry          *metricsRegistry,
+                    bslma::Allocator               *basicAllocator = 0);
+
     /// Remove all pending jobs from the queue without executing them, block
     /// until all currently running jobs complete, and then destroy this
     /// thread pool.
@@ -577,6 +697,24 @@ class FixedThreadPool {
     /// behavior is undefined unless `function` is not null.
     int enqueueJob(FixedThreadPoolJobFunc function, void *userData);
 
+    /// Enqueue, in order, each job in the specified range `[first, last)`
+    /// to be executed by the next available thread.  Return 0 if all the
+    /// jobs in the range were enqueued, and a non-zero value otherwise.
+    /// Specifically, return `e_SUCCESS` on success, `e_DISABLED` if
+    /// `!isEnabled()` before all the jobs were enqueued, and `e_FAILED` if
+    /// an error occurs.  If a non-zero value is returned, the jobs in the
+    /// range preceding the job that could not be enqueued remain enqueued.
+    /// This operation will block, as `enqueueJob` does, while there is not
+    /// sufficient capacity in the underlying queue to enqueue the next job
+    /// in the range.  The behavior is undefined unless each job in the range
+    /// is not null and `INPUT_ITER` is an input iterator whose value type is
+    /// convertible to `Job`.  Note that when `e_LOCK_FREE_QUEUE ==
+    /// queueBackend()`, the waiting threads are woken once for all the jobs
+    /// enqueued before this method returns or blocks.  See
+    /// {Queue Backends}.
+    template <class INPUT_ITER>
+    int enqueueJobs(INPUT_ITER first, INPUT_ITER last);
+
     /// Enqueue the specified `functor` to be executed by the next available
     /// thread.  Return 0 on success, and a non-zero value otherwise.
     /// Specifically, return `e_SUCCESS` on success, `e_DISABLED` if
@@ -651,6 +789,10 @@ class FixedThreadPool {
     /// thread pool.
     int numThreadsStarted() const;
 
+    /// Return the kind of queue used by this thread pool to hold pending
+    /// jobs.
+    QueueBackend queueBackend() const;
+
     /// Return the capacity of the queue used to enqueue jobs by this thread
     /// pool.
     int queueCapacity() const;
@@ -664,17 +806,46 @@ class FixedThreadPool {
                           // class FixedThreadPool
                           // ---------------------
 
+// PRIVATE MANIPULATORS
+inline
+void FixedThreadPool::wakeThreads(int numJobs)
+{
+    BSLS_ASSERT(0 <= numJobs);
+
+    // The preceding push into `*d_lockFreeQueue_p` writes the push index of
+    // the queue with full sequential consistency, which guarantees that the
+    // following load observes any thread that incremented
+    // `d_numWaitingThreads` before observing the queue as empty (see
+    // `lockFreeWorkerThread`).
+
+    const int numWaitingThreads = d_numWaitingThreads;
+
+    if (0 < numWaitingThreads && 0 < numJobs) {
+        d_workSemaphore.post(bsl::min(numJobs, numWaitingThreads));
+    }
+}
+
 // MANIPULATORS
 inline
 void FixedThreadPool::disable()
 {
-    d_queue.disablePushBack();
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        d_lockFreeQueue_p->disable();
+    }
+    else {
+        d_queue.disablePushBack();
+    }
 }
 
 inline
 void FixedThreadPool::enable()
 {
-    d_queue.enablePushBack();
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        d_lockFreeQueue_p->enable();
+    }
+    else {
+        d_queue.enablePushBack();
+    }
 }
 
 inline
@@ -682,6 +853,14 @@ int FixedThreadPool::enqueueJob(const Job& functor)
 {
     BSLS_ASSERT(functor);
 
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        if (0 != d_lockFreeQueue_p->pushBack(functor)) {
+            return e_DISABLED;                                        // RETURN
+        }
+        wakeThreads(1);
+        return e_SUCCESS;                                             // RETURN
+    }
+
     return d_queue.pushBack(functor);
 }
 
@@ -690,6 +869,15 @@ int FixedThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
 {
     BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
 
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        if (0 != d_lockFreeQueue_p->pushBack(
+                                     bslmf::MovableRefUtil::move(functor))) {
+            return e_DISABLED;                                        // RETURN
+        }
+        wakeThreads(1);
+        return e_SUCCESS;                                             // RETURN
+    }
+
     return d_queue.pushBack(bslmf::MovableRefUtil::move(functor));
 }
 
@@ -702,11 +890,71 @@ int FixedThreadPool::enqueueJob(FixedThreadPoolJobFunc  function,
     return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
 }
 
+template <class INPUT_ITER>
+int FixedThreadPool::enqueueJobs(INPUT_ITER first, INPUT_ITER last)
+{
+    if (e_LOCK_FREE_QUEUE != d_queueBackend) {
+        for (; first != last; ++first) {
+            const Job& functor = *first;
+
+            BSLS_ASSERT(functor);
+
+            const int rc = d_queue.pushBack(functor);
+            if (0 != rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    int numPushed = 0;
+
+    for (; first != last; ++first) {
+        const Job& functor = *first;
+
+        BSLS_ASSERT(functor);
+
+        int rc = d_lockFreeQueue_p->tryPushBack(functor);
+        if (0 != rc && d_lockFreeQueue_p->isEnabled()) {
+            // The queue is enabled, so it is full (`tryPushBack` does not
+            // report which of the two caused the failure).  Wake the threads
+            // needed for the jobs enqueued so far before blocking, since they
+            // may be the only ones able to make room in the queue.
+
+            wakeThreads(numPushed);
+            numPushed = 0;
+
+            rc = d_lockFreeQueue_p->pushBack(functor);
+        }
+
+        if (0 != rc) {
+            wakeThreads(numPushed);
+            return e_DISABLED;                                        // RETURN
+        }
+
+        ++numPushed;
+    }
+
+    wakeThreads(numPushed);
+
+    return e_SUCCESS;
+}
+
 inline
 int FixedThreadPool::tryEnqueueJob(const Job& functor)
 {
     BSLS_ASSERT(functor);
 
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        const int rc = d_lockFreeQueue_p->tryPushBack(functor);
+        if (0 != rc) {
+            return d_lockFreeQueue_p->isEnabled() ? e_FULL
+                                                  : e_DISABLED;       // RETURN
+        }
+        wakeThreads(1);
+        return e_SUCCESS;                                             // RETURN
+    }
+
     return d_queue.tryPushBack(functor);
 }
 
@@ -715,6 +963,17 @@ int FixedThreadPool::tryEnqueueJob(bslmf::MovableRef<Job> functor)
 {
     BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
 
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        const int rc = d_lockFreeQueue_p->tryPushBack(
+                                         bslmf::MovableRefUtil::move(functor));
+        if (0 != rc) {
+            return d_lockFreeQueue_p->isEnabled() ? e_FULL
+                                                  : e_DISABLED;       // RETURN
+        }
+        wakeThreads(1);
+        return e_SUCCESS;                                             // RETURN
+    }
+
     return d_queue.tryPushBack(bslmf::MovableRefUtil::move(functor));
 }
 
@@ -733,6 +992,11 @@ void FixedThreadPool::drain()
     bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
 
     if (isStarted()) {
+        if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+            drainLockFreeQueue();
+            return;                                                   // RETURN
+        }
+
         d_queue.waitUntilEmpty();
 
         d_drainFlag = true;
@@ -751,6 +1015,11 @@ void FixedThreadPool::shutdown()
     bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
 
     if (isStarted()) {
+        if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+            stopLockFreeQueue(true);
+            return;                                                   // RETURN
+        }
+
         d_queue.disablePushBack();
         d_queue.disablePopFront();
         d_threadGroup.joinAll();
@@ -764,6 +1033,11 @@ void FixedThreadPool::stop()
     bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
 
     if (isStarted()) {
+        if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+            stopLockFreeQueue(false);
+            return;                                                   // RETURN
+        }
+
         d_queue.disablePushBack();
         d_queue.waitUntilEmpty();
         d_queue.disablePopFront();
@@ -775,6 +1049,9 @@ void FixedThreadPool::stop()
 inline
 bool FixedThreadPool::isEnabled() const
 {
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        return d_lockFreeQueue_p->isEnabled();                        // RETURN
+    }
     return !d_queue.isPushBackDisabled();
 }
 
@@ -793,6 +1070,9 @@ int FixedThreadPool::numActiveThreads() const
 inline
 int FixedThreadPool::numPendingJobs() const
 {
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        return d_lockFreeQueue_p->numElements();                      // RETURN
+    }
     return static_cast<int>(d_queue.numElements());
 }
 
@@ -808,9 +1088,18 @@ int FixedThreadPool::numThreadsStarted() const
     return d_threadGroup.numThreads();
 }
 
+inline
+FixedThreadPool::QueueBackend FixedThreadPool::queueBackend() const
+{
+    return d_queueBackend;
+}
+
 inline
 int FixedThreadPool::queueCapacity() const
 {
+    if (e_LOCK_FREE_QUEUE == d_queueBackend) {
+        return d_lockFreeQueue_p->capacity();                         // RETURN
+    }
     return static_cast<int>(d_queue.capacity());
 }
 
@@ -15,7 +15,9 @@
 
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_testutil.h>
+#include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_throughputbenchmark.h>
 #include <bslmt_throughputbenchmarkresult.h>
@@ -77,14 +79,17 @@ using bsl::flush;
 //
 // In addition to positive test cases (run in the nightly builds), a negative
 // test case -1 can be run manually to measure performance of enqueuing jobs,
-// and test case -3 can be run to reproduce the lost condition signal issue in
+// test case -3 can be run to reproduce the lost condition signal issue in
 // the underlying implementation of condition variable (e.g.,
-// https://sourceware.org/bugzilla/show_bug.cgi?id=25847).
+// https://sourceware.org/bugzilla/show_bug.cgi?id=25847), and test case -4
+// can be run to compare the throughput of the queue backends.
 //
 // [ 3] bdlmt::FixedThreadPool(numThreads, maxNumPendingJobs, *bA);
 // [ 3] bdlmt::FixedThreadPool(nT, maxNPJ, mI, *mR, *bA);
 // [ 3] bdlmt::FixedThreadPool(attributes, nT, maxNPJ, *bA);
 // [ 3] bdlmt::FixedThreadPool(attributes, nT, maxNPJ, mI, *mR, *bA);
+// [21] bdlmt::FixedThreadPool(attributes, nT, maxNPJ, qB, *bA);
+// [21] bdlmt::FixedThreadPool(attributes, nT, maxNPJ, qB, mI, *mR, *bA);
 // [ 3] ~bdlmt::FixedThreadPool();
 // [ 3] int enqueueJob(const bsl::function<void()>& );
 // [15] int enqueueJob(bslmf::MovableRef<Job>);
@@ -97,6 +102,8 @@ using bsl::flush;
 // [ 4] int queueCapacity() const;
 // [ 4] int numThreadsStarted() const;
 // [ 5] int tryEnqueueJob(FixedThreadPoolJobFunc, void *);
+// [21] int enqueueJobs(INPUT_ITER first, INPUT_ITER last);
+// [21] QueueBackend queueBackend() const;
 // ----------------------------------------------------------------------------
 // [ 2] TESTING HELPER FUNCTIONS
 // [ 2] Breathing test
@@ -110,6 +117,8 @@ using bsl::flush;
 // [18] DRQS 167232024: `drain` FAILS TO WAIT FOR ALL JOBS TO FINISH
 // [19] CONCERN: POOL OBJECT CAN OUTLIVE USED `MetricsRegistry`
 // [20] THREAD NAMES
+// [21] QUEUE BACKENDS
+// [-4] BENCHMARK: QUEUE BACKENDS AND BATCH SUBMISSION
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -544,6 +553,7 @@ static double getCurrentCpuTime()
 
 static bdlmt::FixedThreadPool *s_performanceTestPool_p;
 static bsls::Types::Int64      s_performanceTestPoolBusyWork;
+static bsl::vector<Obj::Job>  *s_performanceTestBatch_p;
 
 void performanceTestInitialize(bool)
 {
@@ -569,19 +579,47 @@ void performanceTestPush(int)
     s_performanceTestPool_p->enqueueJob(&performanceTestJob);
 }
 
-void performanceTest(FILE       *outputFile,
-                     const char *scenarioName,
-                     int         numPush,
-                     int         numPool,
-                     int         busyPush,
-                     int         busyPool)
+void performanceTestPushBatch(int)
 {
-    s_performanceTestPool_p       = new bdlmt::FixedThreadPool(numPool, 512);
+    s_performanceTestPool_p->enqueueJobs(s_performanceTestBatch_p->begin(),
+                                         s_performanceTestBatch_p->end());
+}
+
+/// Measure the throughput of a pool having the specified `numPool` threads
+/// and using the optionally specified `queueBackend`, when the specified
+/// `numPush` threads enqueue jobs, and write the result to the specified
+/// `outputFile` as a line starting with the specified `scenarioName`.  The
+/// pushing threads perform the specified `busyPush` amount of work between
+/// two submissions and the jobs perform the specified `busyPool` amount of
+/// work.  If the optionally specified `batchSize` is greater than 1, the jobs
+/// are enqueued `batchSize` at a time using `enqueueJobs`.  Note that the
+/// reported throughput is in jobs, regardless of `batchSize`.
+void performanceTest(FILE              *outputFile,
+                     const char        *scenarioName,
+                     int                numPush,
+                     int                numPool,
+                     int                busyPush,
+                     int                busyPool,
+                     Obj::QueueBackend  queueBackend = Obj::e_BOUNDED_QUEUE,
+                     int                batchSize = 1)
+{
+    s_performanceTestPool_p       = new bdlmt::FixedThreadPool(
+                                                     bslmt::ThreadAttributes(),
+                                                     numPool,
+                                                     512,
+                                                     queueBackend);
     s_performanceTestPoolBusyWork = busyPool;
 
+    bsl::vector<Obj::Job> batch(batchSize, Obj::Job(&performanceTestJob));
+    s_performanceTestBatch_p = &batch;
+
     bslmt::ThroughputBenchmark bench;
 
-    int id = bench.addThreadGroup(performanceTestPush, numPush, busyPush);
+    int id = bench.addThreadGroup(1 < batchSize
+                                  ? performanceTestPushBatch
+                                  : performanceTestPush,
+                                  numPush,
+                                  busyPush);
 
     bslmt::ThroughputBenchmarkResult result;
     bench.execute(&result,
@@ -597,14 +635,15 @@ void performanceTest(FILE       *outputFile,
     bsl::ostringstream ss;
     ss << scenarioName;
     for (bsl::size_t i = 0; i < percentiles.size(); ++i) {
-        ss << ',' << static_cast<int>(percentiles[i]);
+        ss << ',' << static_cast<int>(percentiles[i] * batchSize);
     }
 
     fprintf(outputFile, "%s\n", ss.str().c_str());
     fflush(outputFile);
 
     delete s_performanceTestPool_p;
-    s_performanceTestPool_p = 0;
+    s_performanceTestPool_p  = 0;
+    s_performanceTestBatch_p = 0;
 }
 
 void testJobRecordNowMicroseconds(bsls::AtomicInt64 *now)
@@ -772,6 +811,70 @@ static void myFastFunctorSearch(const bsl::string&              word,
     delete[] jobInfoArray;
 }
 
+// ============================================================================
+//                         CASE 21 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FIXEDTHREADPOOL_CASE_21 {
+
+/// Increment the specified `counter`.
+void countJob(bsls::AtomicInt *counter)
+{
+    ++*counter;
+}
+
+/// Wait on the specified `semaphore`.
+void waitJob(bslmt::Semaphore *semaphore)
+{
+    semaphore->wait();
+}
+
+/// Wait until the specified `pool` is disabled and has no pending jobs, then
+/// post the specified `semaphore`.
+void releaseWhenDisabledAndEmpty(const Obj        *pool,
+                                 bslmt::Semaphore *semaphore)
+{
+    while (pool->isEnabled() || 0 != pool->numPendingJobs()) {
+        bslmt::ThreadUtil::yield();
+    }
+    semaphore->post();
+}
+
+/// Load into the specified `result` the value returned by enqueuing a job
+/// onto the specified `pool`.
+void enqueueAndStore(Obj *pool, bsls::AtomicInt *result)
+{
+    *result = pool->enqueueJob(noop, 0);
+}
+
+/// Enqueue onto the specified `pool` the specified `numJobs` jobs, each
+/// incrementing the specified `counter`, using `enqueueJob` if the specified
+/// `useBatch` is `false`, and using `enqueueJobs` in batches of (up to) 16
+/// jobs otherwise.
+void producerJob(Obj             *pool,
+                 bsls::AtomicInt *counter,
+                 int              numJobs,
+                 bool             useBatch)
+{
+    Obj::Job job = bdlf::BindUtil::bind(&countJob, counter);
+
+    if (!useBatch) {
+        for (int i = 0; i < numJobs; ++i) {
+            ASSERT(0 == pool->enqueueJob(job));
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<Obj::Job> batch(16, job);
+    while (0 < numJobs) {
+        const int n = bsl::min(numJobs, static_cast<int>(batch.size()));
+        ASSERT(0 == pool->enqueueJobs(batch.begin(), batch.begin() + n));
+        numJobs -= n;
+    }
+}
+
+}  // close namespace FIXEDTHREADPOOL_CASE_21
+
 // ============================================================================
 //                         USAGE CASE RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -1114,6 +1217,376 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING QUEUE BACKENDS
+        //
+        // Concerns:
+        // 1. Pools created with the constructors not taking a `QueueBackend`
+        //    use `e_BOUNDED_QUEUE`, and `queueBackend` returns the backend
+        //    supplied at construction.
+        //
+        // 2. With `e_LOCK_FREE_QUEUE`, the queue capacity is
+        //    `maxNumPendingJobs`, enqueuing is disabled until `start`, and
+        //    `tryEnqueueJob` returns `e_FULL` and `e_DISABLED` as appropriate.
+        //
+        // 3. With `e_LOCK_FREE_QUEUE`, a thread blocked in `enqueueJob` on a
+        //    full queue returns `e_DISABLED` when `disable` is invoked.
+        //
+        // 4. With `e_LOCK_FREE_QUEUE`, `stop` executes the pending jobs,
+        //    `shutdown` discards them, and the pool can be restarted.
+        //
+        // 5. `enqueueJobs` enqueues every job in the range, for both backends,
+        //    including a range larger than the queue capacity, and returns
+        //    `e_DISABLED` if the pool is disabled.
+        //
+        // 6. With `e_LOCK_FREE_QUEUE`, every job enqueued concurrently by
+        //    several threads, with `enqueueJob` or `enqueueJobs`, is executed
+        //    exactly once, and `drain` waits for all of them, for various
+        //    queue capacities.
+        //
+        // 7. All memory is supplied by the allocator passed at construction,
+        //    and is returned when the pool is destroyed.
+        //
+        // Plan:
+        // 1. Create pools with each constructor and verify `queueBackend`.
+        //    (C-1)
+        //
+        // 2. Using blocking jobs to occupy the processing threads, fill the
+        //    queue of a lock-free pool and verify the results of
+        //    `tryEnqueueJob` before `start`, when the queue is full, and when
+        //    the pool is disabled.  (C-2)
+        //
+        // 3. Fill the queue of a lock-free pool, attempt to enqueue a job from
+        //    another thread, and verify this thread returns `e_DISABLED` after
+        //    `disable` is invoked.  (C-3)
+        //
+        // 4. Enqueue jobs behind a blocking job, release it, and invoke `stop`
+        //    and verify all the jobs were executed.  Restart the pool, repeat
+        //    with `shutdown`, releasing the blocking job only once the pending
+        //    jobs are removed, and verify no job was executed.  (C-4)
+        //
+        // 5. For both backends, enqueue with `enqueueJobs` a range of jobs
+        //    larger than the queue capacity, then an empty range, then a
+        //    range while the pool is disabled, and verify the results and the
+        //    number of executed jobs.  (C-5)
+        //
+        // 6. For several queue capacities, enqueue jobs onto a lock-free pool
+        //    from several threads, half of them using `enqueueJob` and half
+        //    using `enqueueJobs`, then `drain` the pool and verify the number
+        //    of executed jobs.  (C-6)
+        //
+        // 7. Use a test allocator for all the pools and verify no memory is
+        //    outstanding at the end of each scope.  (C-7)
+        //
+        // Testing:
+        //   bdlmt::FixedThreadPool(attributes, nT, maxNPJ, qB, *bA);
+        //   bdlmt::FixedThreadPool(attributes, nT, maxNPJ, qB, mI, *mR, *bA);
+        //   int enqueueJobs(INPUT_ITER first, INPUT_ITER last);
+        //   QueueBackend queueBackend() const;
+        //   QUEUE BACKENDS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING QUEUE BACKENDS"
+                          << "\n======================" << endl;
+
+        using namespace FIXEDTHREADPOOL_CASE_21;
+
+        const bslmt::ThreadAttributes attr;
+
+        if (verbose) cout << "\nTesting `queueBackend`." << endl;
+        {
+            bdlm::MetricsRegistry registry(&testAllocator);
+
+            Obj mA(2, 4, &testAllocator);
+            Obj mB(attr, 2, 4, Obj::e_BOUNDED_QUEUE, &testAllocator);
+            Obj mC(attr, 2, 4, Obj::e_LOCK_FREE_QUEUE, &testAllocator);
+            Obj mD(attr,
+                   2,
+                   4,
+                   Obj::e_LOCK_FREE_QUEUE,
+                   "lockFreePool",
+                   &registry,
+                   &testAllocator);
+
+            ASSERT(Obj::e_BOUNDED_QUEUE   == mA.queueBackend());
+            ASSERT(Obj::e_BOUNDED_QUEUE   == mB.queueBackend());
+            ASSERT(Obj::e_LOCK_FREE_QUEUE == mC.queueBackend());
+            ASSERT(Obj::e_LOCK_FREE_QUEUE == mD.queueBackend());
+
+            ASSERT(4 == mC.queueCapacity());
+            ASSERT(4 == mD.queueCapacity());
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `tryEnqueueJob`." << endl;
+        {
+            const int k_CAPACITY = 5;
+
+            Obj mX(attr,
+                   2,
+                   k_CAPACITY,
+                   Obj::e_LOCK_FREE_QUEUE,
+                   &testAllocator);
+            const Obj& X = mX;
+
+            ASSERT(0 < testAllocator.numBlocksInUse());
+
+            ASSERT(k_CAPACITY == X.queueCapacity());
+            ASSERT(false      == X.isEnabled());
+            ASSERT(false      == X.isStarted());
+
+            ASSERT(Obj::e_DISABLED == mX.tryEnqueueJob(noop, 0));
+            ASSERT(Obj::e_DISABLED == mX.enqueueJob(noop, 0));
+
+            ASSERT(0 == mX.start());
+            ASSERT(X.isEnabled());
+            ASSERT(X.isStarted());
+
+            bslmt::Semaphore semaphore;
+            bsls::AtomicInt  counter(0);
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitJob,
+                                                           &semaphore)));
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitJob,
+                                                           &semaphore)));
+
+            while (2 != X.numActiveThreads() || 0 != X.numPendingJobs()) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            for (int i = 0; i < k_CAPACITY; ++i) {
+                ASSERTV(i, Obj::e_SUCCESS == mX.tryEnqueueJob(
+                                bdlf::BindUtil::bind(&countJob, &counter)));
+            }
+            ASSERT(k_CAPACITY    == X.numPendingJobs());
+            ASSERT(Obj::e_FULL   == mX.tryEnqueueJob(noop, 0));
+
+            mX.disable();
+
+            ASSERT(false           == X.isEnabled());
+            ASSERT(Obj::e_DISABLED == mX.tryEnqueueJob(noop, 0));
+
+            mX.enable();
+
+            ASSERT(X.isEnabled());
+
+            semaphore.post(2);
+            mX.drain();
+
+            ASSERT(k_CAPACITY == counter);
+            ASSERT(0          == X.numPendingJobs());
+            ASSERT(0          == X.numActiveThreads());
+            ASSERT(X.isStarted());
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `disable` with a blocked `enqueueJob`."
+                          << endl;
+        {
+            Obj mX(attr, 1, 1, Obj::e_LOCK_FREE_QUEUE, &testAllocator);
+            const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            bslmt::Semaphore semaphore;
+            bsls::AtomicInt  result(-1);
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitJob,
+                                                           &semaphore)));
+            while (1 != X.numActiveThreads() || 0 != X.numPendingJobs()) {
+                bslmt::ThreadUtil::yield();
+            }
+            ASSERT(0 == mX.enqueueJob(noop, 0));
+
+            bslmt::ThreadGroup enqueuer(&testAllocator);
+            ASSERT(0 == enqueuer.addThread(
+                        bdlf::BindUtil::bind(&enqueueAndStore, &mX, &result)));
+
+            bslmt::ThreadUtil::microSleep(k_DECISECOND);
+
+            ASSERT(-1 == result);
+
+            mX.disable();
+            enqueuer.joinAll();
+
+            ASSERT(Obj::e_DISABLED == result);
+
+            semaphore.post();
+            mX.stop();
+
+            ASSERT(false == X.isStarted());
+            ASSERT(0     == X.numPendingJobs());
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `stop` and `shutdown`." << endl;
+        {
+            const int k_NUM_JOBS = 5;
+
+            Obj mX(attr, 1, 10, Obj::e_LOCK_FREE_QUEUE, &testAllocator);
+            const Obj& X = mX;
+
+            bslmt::Semaphore semaphore;
+            bsls::AtomicInt  counter(0);
+
+            for (int iteration = 0; iteration < 2; ++iteration) {
+                ASSERTV(iteration, 0 == mX.start());
+
+                counter = 0;
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitJob,
+                                                               &semaphore)));
+                while (1 != X.numActiveThreads() || 0 != X.numPendingJobs()) {
+                    bslmt::ThreadUtil::yield();
+                }
+                for (int i = 0; i < k_NUM_JOBS; ++i) {
+                    ASSERT(0 == mX.enqueueJob(
+                                   bdlf::BindUtil::bind(&countJob, &counter)));
+                }
+
+                semaphore.post();
+                mX.stop();
+
+                ASSERTV(iteration, k_NUM_JOBS == counter);
+                ASSERTV(iteration, false      == X.isStarted());
+                ASSERTV(iteration, false      == X.isEnabled());
+            }
+
+            ASSERT(0 == mX.start());
+
+            counter = 0;
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitJob,
+                                                           &semaphore)));
+            while (1 != X.numActiveThreads() || 0 != X.numPendingJobs()) {
+                bslmt::ThreadUtil::yield();
+            }
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(
+                                   bdlf::BindUtil::bind(&countJob, &counter)));
+            }
+
+            // `shutdown` blocks until the executing job completes; release
+            // it from another thread once the pending jobs have been removed.
+
+            bslmt::ThreadGroup releaser(&testAllocator);
+            ASSERT(0 == releaser.addThread(
+                          bdlf::BindUtil::bind(&releaseWhenDisabledAndEmpty,
+                                               &X,
+                                               &semaphore)));
+            mX.shutdown();
+            releaser.joinAll();
+
+            ASSERT(0     == counter);
+            ASSERT(0     == X.numPendingJobs());
+            ASSERT(false == X.isStarted());
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `enqueueJobs`." << endl;
+        {
+            const Obj::QueueBackend BACKENDS[] = { Obj::e_BOUNDED_QUEUE,
+                                                   Obj::e_LOCK_FREE_QUEUE };
+            const int NUM_BACKENDS = static_cast<int>(sizeof BACKENDS
+                                                           / sizeof *BACKENDS);
+
+            const int k_NUM_JOBS = 100;
+
+            for (int ti = 0; ti < NUM_BACKENDS; ++ti) {
+                const Obj::QueueBackend BACKEND = BACKENDS[ti];
+
+                if (veryVerbose) { T_ P(BACKEND); }
+
+                Obj mX(attr, 2, 4, BACKEND, &testAllocator);
+                const Obj& X = mX;
+
+                bsls::AtomicInt counter(0);
+
+                bsl::vector<Obj::Job> jobs(
+                                     k_NUM_JOBS,
+                                     Obj::Job(bdlf::BindUtil::bind(&countJob,
+                                                                   &counter)),
+                                     &testAllocator);
+
+                ASSERTV(BACKEND, Obj::e_DISABLED ==
+                                     mX.enqueueJobs(jobs.begin(), jobs.end()));
+
+                ASSERTV(BACKEND, 0 == mX.start());
+
+                ASSERTV(BACKEND, Obj::e_SUCCESS ==
+                                     mX.enqueueJobs(jobs.begin(), jobs.end()));
+                mX.drain();
+
+                ASSERTV(BACKEND, counter, k_NUM_JOBS == counter);
+
+                ASSERTV(BACKEND, Obj::e_SUCCESS ==
+                                   mX.enqueueJobs(jobs.begin(), jobs.begin()));
+                ASSERTV(BACKEND, Obj::e_SUCCESS ==
+                               mX.enqueueJobs(jobs.begin(), jobs.begin() + 3));
+                mX.drain();
+
+                ASSERTV(BACKEND, counter, k_NUM_JOBS + 3 == counter);
+
+                mX.disable();
+
+                ASSERTV(BACKEND, Obj::e_DISABLED ==
+                                     mX.enqueueJobs(jobs.begin(), jobs.end()));
+                mX.drain();
+
+                ASSERTV(BACKEND, counter, k_NUM_JOBS + 3 == counter);
+                ASSERTV(BACKEND, 0 == X.numPendingJobs());
+            }
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting concurrent producers." << endl;
+        {
+            const int CAPACITIES[]   = { 1, 3, 64, 1024 };
+            const int NUM_CAPACITIES = static_cast<int>(sizeof CAPACITIES
+                                                         / sizeof *CAPACITIES);
+
+            const int k_NUM_THREADS   = 4;
+            const int k_NUM_PRODUCERS = 4;
+            const int k_NUM_JOBS      = 2000;
+
+            for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+                const int CAPACITY = CAPACITIES[ti];
+
+                if (veryVerbose) { T_ P(CAPACITY); }
+
+                Obj mX(attr,
+                       k_NUM_THREADS,
+                       CAPACITY,
+                       Obj::e_LOCK_FREE_QUEUE,
+                       &testAllocator);
+                const Obj& X = mX;
+
+                ASSERT(0 == mX.start());
+
+                bsls::AtomicInt    counter(0);
+                bslmt::ThreadGroup producers(&testAllocator);
+
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    ASSERT(0 == producers.addThread(
+                                        bdlf::BindUtil::bind(&producerJob,
+                                                             &mX,
+                                                             &counter,
+                                                             k_NUM_JOBS,
+                                                             0 == i % 2)));
+                }
+                producers.joinAll();
+                mX.drain();
+
+                ASSERTV(CAPACITY,
+                        counter,
+                        k_NUM_PRODUCERS * k_NUM_JOBS == counter);
+                ASSERTV(CAPACITY, 0 == X.numPendingJobs());
+                ASSERTV(CAPACITY, 0 == X.numActiveThreads());
+            }
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING THREAD NAMES
@@ -2992,6 +3465,82 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case -4: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: QUEUE BACKENDS AND BATCH SUBMISSION
+        //   Compare the throughput of short jobs submitted by several
+        //   producers to pools using each queue backend, with and without
+        //   `enqueueJobs`.
+        //
+        // Plan:
+        //   Using `performanceTest`, measure the throughput of each
+        //   combination of backend, batch size, number of producers, and
+        //   amount of work per job, and print the percentiles (in jobs per
+        //   second) as comma-separated values.
+        //
+        // Testing:
+        //   BENCHMARK: QUEUE BACKENDS AND BATCH SUBMISSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBENCHMARK: QUEUE BACKENDS AND BATCH SUBMISSION"
+                          << "\n=============================================="
+                          << endl;
+
+        const Obj::QueueBackend BACKENDS[]   = { Obj::e_BOUNDED_QUEUE,
+                                                 Obj::e_LOCK_FREE_QUEUE };
+        const int               NUM_BACKENDS = static_cast<int>(
+                                          sizeof BACKENDS / sizeof *BACKENDS);
+
+        const int batchSize[]  = { 1, 16 };
+        const int numBatchSize = static_cast<int>(sizeof batchSize
+                                                          / sizeof *batchSize);
+
+        const int threadCount[]  = { 1, 4, 8 };
+        const int numThreadCount = static_cast<int>(sizeof threadCount
+                                                        / sizeof *threadCount);
+
+        const int busyWork[]  = { 20, 500 };
+        const int numBusyWork = static_cast<int>(sizeof busyWork
+                                                           / sizeof *busyWork);
+
+        printf("BACKEND,BATCH,#PUSH,#POOL,POOL BUSY,0%%,"
+               "10%%,20%%,30%%,40%%,50%%,60%%,70%%,80%%,90%%,100%%\n");
+
+        for (int ti = 0; ti < NUM_BACKENDS; ++ti) {
+            for (int bi = 0; bi < numBatchSize; ++bi) {
+                for (int nPush = 0; nPush < numThreadCount; ++nPush) {
+                    for (int bwPool = 0; bwPool < numBusyWork; ++bwPool) {
+                        const Obj::QueueBackend BACKEND  = BACKENDS[ti];
+                        const int               BATCH    = batchSize[bi];
+                        const int               numPush  = threadCount[nPush];
+                        const int               numPool  = 4;
+                        const int               busyPool = busyWork[bwPool];
+
+                        char s[1024];
+                        snprintf(s,
+                                 sizeof s,
+                                 "%s,%i,%i,%i,%i",
+                                 Obj::e_BOUNDED_QUEUE == BACKEND
+                                 ? "BOUNDED"
+                                 : "LOCK-FREE",
+                                 BATCH,
+                                 numPush,
+                                 numPool,
+                                 busyPool);
+
+                        performanceTest(stdout,
+                                        s,
+                                        numPush,
+                                        numPool,
+                                        20,
+                                        busyPool,
+                                        BACKEND,
+                                        BATCH);
+                    }
+                }
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
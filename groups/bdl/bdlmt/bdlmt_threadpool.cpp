@@ -8,13 +8,19 @@ BSLS_IDENT_RCSID(bdlmt_threadpool_cpp,"$Id$ $CSID$")
 #include <bdlm_metric.h>
 #include <bdlm_metricdescriptor.h>
 
+#include <bdlb_random.h>
+
 #include <bdlf_bind.h>
 
+#include <bslma_allocator.h>
+
 #include <bslmf_movableref.h>
 
 #include <bslmt_barrier.h>           // for testing only
 #include <bslmt_lockguard.h>         // for testing only
+#include <bslmt_platform.h>
 #include <bslmt_threadattributes.h>  // for testing only
+#include <bslmt_threadlocalvariable.h>
 #include <bslmt_threadutil.h>        // for testing only
 
 #include <bsls_assert.h>
@@ -26,6 +32,7 @@ BSLS_IDENT_RCSID(bdlmt_threadpool_cpp,"$Id$ $CSID$")
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_string.h>
@@ -85,6 +92,63 @@ struct ThreadPoolWaitNode {
     /// Default constructor.
     ThreadPoolWaitNode();
 };
+
+                         // ===================
+                         // ThreadPoolWorkQueue
+                         // ===================
+
+/// This structure holds the jobs owned by one processing thread of a thread
+/// pool operating in `ThreadPool::e_WORK_STEALING` mode.  The owning thread
+/// pushes and pops jobs at the back of `d_jobs`, while other threads steal
+/// jobs from the front.  `d_size` mirrors the length of `d_jobs` so that
+/// thieves can skip empty queues without acquiring `d_mutex`.  Instances are
+/// allocated individually and padded so that the queues of distinct threads
+/// do not share a cache line.
+struct ThreadPoolWorkQueue {
+
+    bslmt::Mutex                d_mutex;     // protects 'd_jobs'
+
+    bsl::deque<ThreadPool::Job> d_jobs;      // jobs held by this queue
+
+    bsls::AtomicInt             d_size;      // number of jobs in 'd_jobs'
+
+    const ThreadPool           *d_pool_p;    // thread pool owning this queue
+                                             // (held, not owned)
+
+    bool                        d_isClaimed; // 'true' if a processing thread
+                                             // currently owns this queue
+                                             // (protected by the 'd_mutex'
+                                             // of 'd_pool_p')
+
+    char                        d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                             // padding to prevent false
+                                             // sharing
+
+    // CREATORS
+
+    /// Create an empty work queue belonging to the specified `pool`, using
+    /// the specified `basicAllocator` to supply memory.
+    ThreadPoolWorkQueue(const ThreadPool *pool,
+                        bslma::Allocator *basicAllocator);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace {
+
+// The work queue owned by the calling thread if it is a processing thread of
+// a thread pool operating in 'e_WORK_STEALING' mode, and 0 otherwise.
+
+BSLMT_THREAD_LOCAL_VARIABLE(BloombergLP::bdlmt::ThreadPoolWorkQueue *,
+                            t_ownWorkQueue,
+                            0);
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlmt {
+
                             // ===============
                             // ThreadPoolEntry
                             // ===============
@@ -103,6 +167,19 @@ extern "C" void *ThreadPoolEntry(void *aThis)
 ThreadPoolWaitNode::ThreadPoolWaitNode()
 : d_jobCond(bsls::SystemClockType::e_MONOTONIC)
 {
+}
+
+                            // -------------------
+                            // ThreadPoolWorkQueue
+                            // -------------------
+
+ThreadPoolWorkQueue::ThreadPoolWorkQueue(const ThreadPool *pool,
+                                         bslma::Allocator *basicAllocator)
+: d_jobs(basicAllocator)
+, d_size(0)
+, d_pool_p(pool)
+, d_isClaimed(false)
+{
 }
 
                                 // ----------
@@ -125,9 +202,62 @@ void ThreadPool::doEnqueueJob(bslmf::MovableRef<Job> job)
     wakeThreadIfNeeded();
 }
 
+int ThreadPool::doEnqueueWorkStealingJob(bslmf::MovableRef<Job> job)
+{
+    ThreadPoolWorkQueue *queue = t_ownWorkQueue;
+    if (0 == queue || this != queue->d_pool_p) {
+        // The calling thread is not a processing thread of this pool, so
+        // distribute the job among the queues of the running threads.
+
+        const int numQueues = bsl::min(
+                                 static_cast<int>(d_workQueues.size()),
+                                 bsl::max(static_cast<int>(d_threadCount), 1));
+
+        queue = d_workQueues[d_nextWorkQueue++ % numQueues];
+    }
+
+    // Account for the job before it becomes visible to other threads, so
+    // that 'drain' cannot observe neither a queued nor an active job while
+    // the job is in flight.
+
+    ++d_numQueuedJobs;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+        queue->d_jobs.push_back(bslmf::MovableRefUtil::move(job));
+        ++queue->d_size;
+    }
+
+    // The increment of 'd_numQueuedJobs' above and the load of 'd_waitHead'
+    // below pair with the store of 'd_waitHead' followed by the load of
+    // 'd_numQueuedJobs' in 'workStealingWorkerThread', so that either this
+    // thread observes the waiting thread or the waiting thread observes the
+    // job.
+
+    if (d_waitHead.load()
+     || (d_threadCount < d_maxThreads
+      && d_numQueuedJobs + d_numActiveThreads > d_threadCount)) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        wakeThreadIfNeeded();
+        return startThreadIfNeeded();                                 // RETURN
+    }
+    return 0;
+}
+
 void ThreadPool::initialize(bdlm::MetricsRegistry   *metricsRegistry,
                             const bsl::string_view&  threadPoolName)
 {
+    if (e_WORK_STEALING == d_schedulingMode) {
+        bslma::Allocator *allocator = d_workQueues.get_allocator().mechanism();
+
+        const int numQueues = d_maxThreads > 0 ? d_maxThreads : 1;
+
+        d_workQueues.reserve(numQueues);
+        for (int i = 0; i < numQueues; ++i) {
+            d_workQueues.push_back(
+                        new (*allocator) ThreadPoolWorkQueue(this, allocator));
+        }
+    }
+
     if (d_threadAttributes.threadName().empty()) {
         d_threadAttributes.setThreadName(s_defaultThreadName);
     }
@@ -182,9 +312,67 @@ void ThreadPool::wakeThreadIfNeeded()
     }
 }
 
+bool ThreadPool::popWorkStealingJob(Job *job, int ownIndex, int *seed)
+{
+    ThreadPoolWorkQueue *queue = d_workQueues[ownIndex];
+    if (queue->d_size) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+        if (!queue->d_jobs.empty()) {
+            *job = bslmf::MovableRefUtil::move(queue->d_jobs.back());
+            queue->d_jobs.pop_back();
+            --queue->d_size;
+
+            ++d_numActiveThreads;
+            --d_numQueuedJobs;
+            return true;                                              // RETURN
+        }
+    }
+
+    const int numQueues = static_cast<int>(d_workQueues.size());
+    const int first     = bdlb::Random::generate15(seed) % numQueues;
+
+    for (int i = 0; i < numQueues; ++i) {
+        const int index = (first + i) % numQueues;
+        if (index == ownIndex) {
+            continue;                                               // CONTINUE
+        }
+
+        queue = d_workQueues[index];
+        if (0 == queue->d_size) {
+            continue;                                               // CONTINUE
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+        if (!queue->d_jobs.empty()) {
+            *job = bslmf::MovableRefUtil::move(queue->d_jobs.front());
+            queue->d_jobs.pop_front();
+            --queue->d_size;
+
+            ++d_numActiveThreads;
+            --d_numQueuedJobs;
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+void ThreadPool::removeWorkStealingJobs()
+{
+    for (bsl::size_t i = 0; i < d_workQueues.size(); ++i) {
+        ThreadPoolWorkQueue *queue = d_workQueues[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+        d_numQueuedJobs.add(-static_cast<int>(queue->d_jobs.size()));
+        queue->d_jobs.clear();
+        queue->d_size = 0;
+    }
+}
+
 int ThreadPool::startThreadIfNeeded()
 {
-    if (static_cast<int>(d_queue.size()) + d_numActiveThreads > d_threadCount
+    if (  static_cast<int>(d_queue.size())
+        + d_numQueuedJobs
+        + d_numActiveThreads > d_threadCount
        && d_threadCount < d_maxThreads) {
         int rc = startNewThread();
         (void)rc;  // Suppress unused variable warning.
@@ -289,6 +477,11 @@ int ThreadPool::startNewThread()
 
 void ThreadPool::workerThread()
 {
+    if (e_WORK_STEALING == d_schedulingMode) {
+        workStealingWorkerThread();
+        return;                                                       // RETURN
+    }
+
     ThreadPoolWaitNode waitNode;
     Job functor(bsl::allocator_arg,
                 bsl::allocator<char>(d_queue.get_allocator()));
@@ -413,6 +606,182 @@ void ThreadPool::workerThread()
     } // while (1)
 }
 
+void ThreadPool::workStealingWorkerThread()
+{
+    ThreadPoolWaitNode waitNode;
+    Job functor(bsl::allocator_arg,
+                bsl::allocator<char>(d_queue.get_allocator()));
+
+    // Claim a work queue.  Note that the number of claimed queues never
+    // exceeds 'd_threadCount', which never exceeds 'd_workQueues.size()'.
+
+    int ownIndex = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        while (d_workQueues[ownIndex]->d_isClaimed) {
+            ++ownIndex;
+            BSLS_ASSERT(ownIndex < static_cast<int>(d_workQueues.size()));
+        }
+        d_workQueues[ownIndex]->d_isClaimed = true;
+    }
+    t_ownWorkQueue = d_workQueues[ownIndex];
+
+    int seed = ownIndex + 1;
+
+    while (1) {
+        // The functor has to be cleared when we are *not* holding any lock
+        // because it might have some objects bound with non-trivial
+        // destructors.
+
+        if (functor) {
+            functor = bsl::nullptr_t();
+            --d_numActiveThreads;
+        }
+
+        if (!popWorkStealingJob(&functor, ownIndex, &seed)) {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+            bool retryFlag = false;
+            while (1) {
+                // Queued jobs take precedence over the null functors enqueued
+                // on 'd_queue' by 'stop()' and 'shutdown()', so that 'stop()'
+                // completes all pending jobs.
+
+                if (d_numQueuedJobs > 0) {
+                    retryFlag = true;
+                    break;
+                }
+
+                if (!d_queue.empty()) {
+                    break;
+                }
+
+                if (0 == d_numActiveThreads) {
+                    d_drainCond.broadcast();
+                }
+
+                // Attach the 'waitNode' of this thread to the head of the wait
+                // list, then check again for a job that may have been
+                // enqueued by a thread that did not observe 'waitNode'.
+
+                waitNode.d_hasJob = 0;
+                waitNode.d_prev = 0;
+                if (d_waitHead) {
+                    d_waitHead->d_prev = &waitNode;
+                }
+                waitNode.d_next = d_waitHead.load();
+                d_waitHead = &waitNode;
+
+                if (d_numQueuedJobs > 0) {
+                    if (waitNode.d_next) {
+                        waitNode.d_next->d_prev = 0;
+                    }
+                    d_waitHead = waitNode.d_next.load();
+
+                    retryFlag = true;
+                    break;
+                }
+
+                // Let this thread wait until either there is a job available
+                // or 'd_maxIdleTime' elapses.
+
+                if (d_minThreads <= d_numActiveThreads) {
+                    // This thread should be removed if it times out.
+
+                    bsls::TimeInterval endTime =
+                        bsls::SystemTime::nowMonotonicClock() + d_maxIdleTime;
+                    do {
+                        if (waitNode.d_jobCond.timedWait(&d_mutex, endTime)) {
+                            // This thread timed out its max idle time.
+
+                            break;
+                        }
+
+                        // Else we may either have been signaled or awakened
+                        // spuriously.  In the latter case, loop.
+
+                    } while (!waitNode.d_hasJob &&
+                             bsls::SystemTime::nowMonotonicClock() < endTime);
+                }
+                else {
+                    // This thread should not be subject to a timeout, in order
+                    // to maintain the minimum number of threads.
+
+                    while (0 == waitNode.d_hasJob) {
+                        waitNode.d_jobCond.wait(&d_mutex);
+                    }
+                }
+
+                if (0 == waitNode.d_hasJob) {
+                    // We haven't been signaled, so must have timed out.
+                    // Remove this node from the wait list.
+
+                    if (waitNode.d_next) {
+                        waitNode.d_next->d_prev = waitNode.d_prev.load();
+                    }
+                    if (waitNode.d_prev) {
+                        waitNode.d_prev->d_next = waitNode.d_next.load();
+                    }
+                    else {
+                        d_waitHead = waitNode.d_next.load();
+                    }
+
+                    // In addition, in the following case, we may shut down
+                    // this thread, unless a job was concurrently enqueued by
+                    // a thread that observed the thread count prior to its
+                    // decrement.
+
+                    if (d_threadCount > d_minThreads) {
+                        --d_threadCount;
+                        if (0 == d_numQueuedJobs) {
+                            d_workQueues[ownIndex]->d_isClaimed = false;
+                            t_ownWorkQueue = 0;
+                            return;                                   // RETURN
+                        }
+                        ++d_threadCount;
+                    }
+                }
+            }
+
+            if (retryFlag) {
+                continue;                                           // CONTINUE
+            }
+
+            functor = bslmf::MovableRefUtil::move(d_queue.front());
+            d_queue.pop_front();
+
+            // Although user-enqueued functors cannot be null, 'stop()' and
+            // 'shutdown()' enqueue null functors to signal to this thread that
+            // it should shutdown.
+
+            if (!functor) {
+                d_workQueues[ownIndex]->d_isClaimed = false;
+                t_ownWorkQueue = 0;
+
+                --d_threadCount;
+                if (0 == d_threadCount) {
+                    d_drainCond.broadcast();
+                }
+                return;                                               // RETURN
+            }
+
+            ++d_numActiveThreads;
+        }
+
+        // Run the callback and keep measurements.
+
+        bsls::Types::Int64 start  = bsls::TimeUtil::getTimer();
+        functor();
+        bsls::Types::Int64 finish = bsls::TimeUtil::getTimer();
+        if (start < d_lastResetTime) {
+            d_callbackTime.add(finish - d_lastResetTime);
+        }
+        else {
+            d_callbackTime.add(finish - start);
+        }
+    } // while (1)
+}
+
 // CREATORS
 ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
                        int                             minThreads,
@@ -430,6 +799,10 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
 , d_waitHead(0)
 , d_lastResetTime(bsls::TimeUtil::getTimer()) // now
 , d_numThreadCreateFailures(0)
+, d_schedulingMode(e_SHARED_QUEUE)
+, d_workQueues(basicAllocator)
+, d_numQueuedJobs(0)
+, d_nextWorkQueue(0)
 {
     BSLS_ASSERT(0          <= minThreads);
     BSLS_ASSERT(minThreads <= maxThreads);
@@ -462,6 +835,10 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
 , d_waitHead(0)
 , d_lastResetTime(bsls::TimeUtil::getTimer()) // now
 , d_numThreadCreateFailures(0)
+, d_schedulingMode(e_SHARED_QUEUE)
+, d_workQueues(basicAllocator)
+, d_numQueuedJobs(0)
+, d_nextWorkQueue(0)
 {
     BSLS_ASSERT(0          <= minThreads);
     BSLS_ASSERT(minThreads <= maxThreads);
@@ -493,6 +870,10 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
 , d_waitHead(0)
 , d_lastResetTime(bsls::TimeUtil::getTimer()) // now
 , d_numThreadCreateFailures(0)
+, d_schedulingMode(e_SHARED_QUEUE)
+, d_workQueues(basicAllocator)
+, d_numQueuedJobs(0)
+, d_nextWorkQueue(0)
 {
     BSLS_ASSERT(0                        <= minThreads);
     BSLS_ASSERT(minThreads               <= maxThreads);
@@ -525,6 +906,82 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
 , d_waitHead(0)
 , d_lastResetTime(bsls::TimeUtil::getTimer()) // now
 , d_numThreadCreateFailures(0)
+, d_schedulingMode(e_SHARED_QUEUE)
+, d_workQueues(basicAllocator)
+, d_numQueuedJobs(0)
+, d_nextWorkQueue(0)
+{
+    BSLS_ASSERT(0                        <= minThreads);
+    BSLS_ASSERT(minThreads               <= maxThreads);
+    BSLS_ASSERT(bsls::TimeInterval(0, 0) <= maxIdleTime);
+    BSLS_ASSERT(INT_MAX                  >= maxIdleTime.totalMilliseconds());
+
+    if (d_threadAttributes.threadName().empty()) {
+        d_threadAttributes.setThreadName(threadPoolName);
+    }
+
+    initialize(metricsRegistry, threadPoolName);
+}
+
+ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                       int                             minThreads,
+                       int                             maxThreads,
+                       bsls::TimeInterval              maxIdleTime,
+                       SchedulingMode                  schedulingMode,
+                       bslma::Allocator               *basicAllocator)
+: d_queue(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_maxThreads(maxThreads)
+, d_minThreads(minThreads)
+, d_threadCount(0)
+, d_createFailures(0)
+, d_maxIdleTime(maxIdleTime)
+, d_numActiveThreads(0)
+, d_enabled(0)
+, d_waitHead(0)
+, d_lastResetTime(bsls::TimeUtil::getTimer()) // now
+, d_numThreadCreateFailures(0)
+, d_schedulingMode(schedulingMode)
+, d_workQueues(basicAllocator)
+, d_numQueuedJobs(0)
+, d_nextWorkQueue(0)
+{
+    BSLS_ASSERT(0                        <= minThreads);
+    BSLS_ASSERT(minThreads               <= maxThreads);
+    BSLS_ASSERT(bsls::TimeInterval(0, 0) <= maxIdleTime);
+    BSLS_ASSERT(INT_MAX                  >= maxIdleTime.totalMilliseconds());
+
+    initialize(
+        0,
+        (!d_threadAttributes.threadName().empty()
+         ? d_threadAttributes.threadName()
+         : bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION));
+}
+
+ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                       int                             minThreads,
+                       int                             maxThreads,
+                       bsls::TimeInterval              maxIdleTime,
+                       SchedulingMode                  schedulingMode,
+                       const bsl::string_view&         threadPoolName,
+                       bdlm::MetricsRegistry          *metricsRegistry,
+                       bslma::Allocator               *basicAllocator)
+: d_queue(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_maxThreads(maxThreads)
+, d_minThreads(minThreads)
+, d_threadCount(0)
+, d_createFailures(0)
+, d_maxIdleTime(maxIdleTime)
+, d_numActiveThreads(0)
+, d_enabled(0)
+, d_waitHead(0)
+, d_lastResetTime(bsls::TimeUtil::getTimer()) // now
+, d_numThreadCreateFailures(0)
+, d_schedulingMode(schedulingMode)
+, d_workQueues(basicAllocator)
+, d_numQueuedJobs(0)
+, d_nextWorkQueue(0)
 {
     BSLS_ASSERT(0                        <= minThreads);
     BSLS_ASSERT(minThreads               <= maxThreads);
@@ -541,6 +998,11 @@ ThreadPool::ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
 ThreadPool::~ThreadPool()
 {
     shutdown();
+
+    bslma::Allocator *allocator = d_workQueues.get_allocator().mechanism();
+    for (bsl::size_t i = 0; i < d_workQueues.size(); ++i) {
+        allocator->deleteObject(d_workQueues[i]);
+    }
 }
 
 // MANIPULATORS
@@ -549,7 +1011,8 @@ void ThreadPool::drain()
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     d_enabled = 0;
 
-    while ((d_threadCount && d_queue.size()) || d_numActiveThreads) {
+    while ((d_threadCount && (d_queue.size() || d_numQueuedJobs))
+        || d_numActiveThreads) {
         d_drainCond.wait(&d_mutex);
     }
 }
@@ -565,6 +1028,19 @@ int ThreadPool::enqueueJob(const Job& functor)
         bsl::abort();  // abort (for when 'assert' is removed by optimization)
     }
 
+    if (e_WORK_STEALING == d_schedulingMode) {
+        if (!d_enabled) {
+            return -1;                                                // RETURN
+        }
+
+        Job job(bsl::allocator_arg,
+                bsl::allocator<char>(d_queue.get_allocator()),
+                functor);
+
+        return doEnqueueWorkStealingJob(bslmf::MovableRefUtil::move(job));
+                                                                      // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     if (!d_enabled) {
         return -1;                                                    // RETURN
@@ -586,6 +1062,15 @@ int ThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
         bsl::abort();  // abort (for when 'assert' is removed by optimization)
     }
 
+    if (e_WORK_STEALING == d_schedulingMode) {
+        if (!d_enabled) {
+            return -1;                                                // RETURN
+        }
+
+        return doEnqueueWorkStealingJob(bslmf::MovableRefUtil::move(functor));
+                                                                      // RETURN
+    }
+
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     if (!d_enabled) {
         return -1;                                                    // RETURN
@@ -604,6 +1089,8 @@ void ThreadPool::shutdown()
     while (!d_queue.empty()) {
         d_queue.pop_front();
     }
+    removeWorkStealingJobs();
+
     for (int i = 0; i < d_threadCount; ++i) {
         doEnqueueJob(Job());
     }
@@ -611,6 +1098,11 @@ void ThreadPool::shutdown()
         d_drainCond.wait(&d_mutex);
     }
     d_queue.clear();
+
+    // Discard any job enqueued on a work queue concurrently with the
+    // disabling of queuing above.
+
+    removeWorkStealingJobs();
 }
 
 double ThreadPool::resetPercentBusy()
@@ -673,7 +1165,7 @@ int ThreadPool::numWaitingThreads() const
 int ThreadPool::numPendingJobs() const
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-    return static_cast<int>(d_queue.size());
+    return static_cast<int>(d_queue.size()) + d_numQueuedJobs;
 }
 
 double ThreadPool::percentBusy() const
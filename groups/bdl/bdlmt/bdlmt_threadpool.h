@@ -61,6 +61,33 @@ BSLS_IDENT("$Id: $")
 // See `bslmt_threadutil` package documentation for a description of
 // `bslmt::ThreadAttributes`.
 //
+///Scheduling Modes
+///----------------
+// A `bdlmt::ThreadPool` distributes jobs to its processing threads according
+// to the `SchedulingMode` supplied at construction:
+//
+// * `e_SHARED_QUEUE` (the default): all jobs are held on a single queue
+//   protected by a single mutex.  Jobs are dequeued in the order in which
+//   they were enqueued.
+// * `e_WORK_STEALING`: each processing thread owns a job queue.  A job
+//   enqueued from one of the processing threads of the pool (e.g., a job that
+//   fans out into smaller jobs) is pushed onto that thread's own queue, and a
+//   job enqueued from any other thread is distributed round-robin among the
+//   per-thread queues.  A processing thread first takes the most recently
+//   enqueued job from its own queue, and, when that queue is empty, steals
+//   the oldest job from the queue of another thread, starting from a randomly
+//   selected victim.  The pool-wide mutex is acquired only to wake idle
+//   threads, to create or retire threads, and by `drain`, `stop`, and
+//   `shutdown`, so enqueuing jobs onto a pool whose threads are all busy does
+//   not contend on a single lock.
+//
+// The minimum and maximum number of threads, the maximum idle time, and the
+// busy-time metrics (`percentBusy` and `resetPercentBusy`) behave identically
+// in both modes.  Note that in `e_WORK_STEALING` mode there is no guarantee
+// on the relative order in which enqueued jobs begin executing, even when the
+// pool has a single processing thread.  This mode is intended for workloads
+// comprising large numbers of short, independent jobs.
+//
 // Thread pools are ideal for developing multi-threaded server applications.  A
 // server need only package client requests to execute as jobs, and
 // `bdlmt::ThreadPool` will handle the queue management, thread management, and
@@ -369,6 +396,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_timeinterval.h>
 
 #include <bsl_deque.h>
+#include <bsl_vector.h>
 #if defined(BSLS_PLATFORM_OS_UNIX)
     #include <bsl_csignal.h>              // sigfillset
 #endif
@@ -392,6 +420,7 @@ extern "C" typedef void (*bcep_ThreadPoolJobFunc)(void *);
 namespace bdlmt {
 
 struct ThreadPoolWaitNode;
+struct ThreadPoolWorkQueue;
 
 /// Entry point for processing threads.
 extern "C" void *ThreadPoolEntry(void *);
@@ -412,6 +441,15 @@ class ThreadPool {
     // TYPES
     typedef bsl::function<void()> Job;
 
+    /// Enumeration of the strategies used by a thread pool to distribute
+    /// enqueued jobs to its processing threads.  See {Scheduling Modes}.
+    enum SchedulingMode {
+        e_SHARED_QUEUE,   // all jobs are held on a single, shared queue
+
+        e_WORK_STEALING   // each processing thread has its own job queue, and
+                          // idle threads steal jobs from busy threads
+    };
+
   private:
     // PRIVATE DATA
     bsl::deque<Job>      d_queue;          // queue of pending jobs
@@ -438,9 +476,10 @@ class ThreadPool {
                                            // threads that must running at any
                                            // given time
 
-    int                  d_threadCount;    // current number of processing
+    bsls::AtomicInt      d_threadCount;    // current number of processing
                                            // threads started by this thread
-                                           // pool
+                                           // pool (modified only with
+                                           // 'd_mutex' locked)
 
     bsls::AtomicInt      d_createFailures; // number of thread create failures
 
@@ -450,7 +489,7 @@ class ThreadPool {
                                            // remain idle before being shut
                                            // down
 
-    int                  d_numActiveThreads;
+    bsls::AtomicInt      d_numActiveThreads;
                                            // current number of threads that
                                            // are actively processing a job
 
@@ -479,6 +518,23 @@ class ThreadPool {
                                            // managed threads
 #endif
 
+    const SchedulingMode d_schedulingMode; // strategy used to distribute
+                                           // jobs to processing threads
+
+    bsl::vector<ThreadPoolWorkQueue *>
+                         d_workQueues;     // per-thread job queues, one for
+                                           // each of the 'd_maxThreads'
+                                           // threads (empty unless
+                                           // 'e_WORK_STEALING ==
+                                           // d_schedulingMode')
+
+    bsls::AtomicInt      d_numQueuedJobs;  // number of jobs held in
+                                           // 'd_workQueues'
+
+    bsls::AtomicUint     d_nextWorkQueue;  // index used to distribute jobs
+                                           // enqueued by threads other than
+                                           // the processing threads
+
     bdlm::MetricsRegistryRegistrationHandle
                          d_backlogHandle;  // backlog metric handle
 
@@ -499,6 +555,29 @@ class ThreadPool {
     void doEnqueueJob(const Job& job);
     void doEnqueueJob(bslmf::MovableRef<Job> job);
 
+    /// Internal method used to push the specified `job` onto the work
+    /// queue of the calling thread if it is a processing thread of this
+    /// thread pool, and onto the next work queue in round-robin order
+    /// otherwise, then wake a waiting thread or start a new thread if
+    /// needed.  Return 0 if at least one thread is running, and a non-zero
+    /// value otherwise.  Note that this method must be called with
+    /// `d_mutex` unlocked, and only if
+    /// `e_WORK_STEALING == d_schedulingMode`.
+    int doEnqueueWorkStealingJob(bslmf::MovableRef<Job> job);
+
+    /// Load into the specified `job` a job removed from one of the work
+    /// queues, trying first the most recently enqueued job of the work
+    /// queue having the specified `ownIndex`, then the oldest job of each
+    /// other work queue, starting from a victim selected using the
+    /// specified `seed`.  Increment `d_numActiveThreads` before the job is
+    /// accounted as removed from `d_numQueuedJobs`.  Return `true` if a job
+    /// was loaded, and `false` if all the work queues were found empty.
+    bool popWorkStealingJob(Job *job, int ownIndex, int *seed);
+
+    /// Remove all the jobs held in the work queues.  Note that this method
+    /// must be called with `d_mutex` locked.
+    void removeWorkStealingJobs();
+
     /// Initialize this thread pool using the stored attributes and the
     /// specified `metricsRegistry` and `threadPoolName`.  If
     /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::singleton()`  is
@@ -527,6 +606,10 @@ class ThreadPool {
     /// Processing thread function.
     void workerThread();
 
+    /// Processing thread function used when
+    /// `e_WORK_STEALING == d_schedulingMode`.
+    void workStealingWorkerThread();
+
   private:
     // NOT IMPLEMENTED
     ThreadPool(const ThreadPool&);
@@ -616,6 +699,52 @@ class ThreadPool {
                bdlm::MetricsRegistry          *metricsRegistry,
                bslma::Allocator               *basicAllocator = 0);
 
+    /// Construct a thread pool with the specified `threadAttributes`, the
+    /// specified `minThreads` minimum number of threads, the specified
+    /// `maxThreads` maximum number of threads, the specified `maxIdleTime`
+    /// idle time after which a thread may be considered for destruction,
+    /// and the specified `schedulingMode` used to distribute jobs to the
+    /// processing threads.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The name used for created threads is
+    /// `threadAttributes.threadName()` if not empty, otherwise
+    /// "bdl.ThreadPool".  The behavior is undefined unless `0 <= minThreads`,
+    /// `minThreads <= maxThreads`, `0 <= maxIdleTime`, and the `maxIdleTime`
+    /// has a value less than or equal to `INT_MAX` milliseconds.  See
+    /// {Scheduling Modes}.
+    ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+               int                             minThreads,
+               int                             maxThreads,
+               bsls::TimeInterval              maxIdleTime,
+               SchedulingMode                  schedulingMode,
+               bslma::Allocator               *basicAllocator = 0);
+
+    /// Construct a thread pool with the specified `threadAttributes`, the
+    /// specified `minThreads` minimum number of threads, the specified
+    /// `maxThreads` maximum number of threads, the specified `maxIdleTime`
+    /// idle time after which a thread may be considered for destruction,
+    /// the specified `schedulingMode` used to distribute jobs to the
+    /// processing threads, the specified `threadPoolName` to be used to
+    /// identify this thread pool, and the specified `metricsRegistry` to be
+    /// used for reporting metrics.  If `metricsRegistry` is 0,
+    /// `bdlm::MetricsRegistry::singleton()` is used.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The name used for
+    /// created threads is `threadAttributes.threadName()` if not empty,
+    /// otherwise `threadPoolName` if not empty, otherwise "bdl.ThreadPool".
+    /// The behavior is undefined unless `0 <= minThreads`,
+    /// `minThreads <= maxThreads`, `0 <= maxIdleTime`, and the `maxIdleTime`
+    /// has a value less than or equal to `INT_MAX` milliseconds.  See
+    /// {Scheduling Modes}.
+    ThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+               int                             minThreads,
+               int                             maxThreads,
+               bsls::TimeInterval              maxIdleTime,
+               SchedulingMode                  schedulingMode,
+               const bsl::string_view&         threadPoolName,
+               bdlm::MetricsRegistry          *metricsRegistry,
+               bslma::Allocator               *basicAllocator = 0);
+
     /// Call `shutdown()` and destroy this thread pool.
     ~ThreadPool();
 
@@ -716,6 +845,10 @@ class ThreadPool {
     /// processors).
     double percentBusy() const;
 
+    /// Return the strategy used by this thread pool to distribute jobs to
+    /// its processing threads.
+    SchedulingMode schedulingMode() const;
+
     /// Return the number of times that thread creation failed.
     int threadFailures() const;
 };
@@ -752,6 +885,12 @@ int ThreadPool::maxThreads() const
     return d_maxThreads;
 }
 
+inline
+ThreadPool::SchedulingMode ThreadPool::schedulingMode() const
+{
+    return d_schedulingMode;
+}
+
 inline
 int ThreadPool::threadFailures() const
 {
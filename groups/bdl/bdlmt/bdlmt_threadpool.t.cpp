@@ -8,6 +8,7 @@
 #include <bdlm_metricsadapter.h>
 #include <bdlm_metricsregistry.h>
 
+#include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
 #include <bslmt_barrier.h>           // for test only
@@ -17,6 +18,8 @@
 #include <bslmt_testutil.h>
 #include <bslmt_threadattributes.h>  // for test only
 #include <bslmt_threadutil.h>        // for test only
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
 #include <bslmt_timedcompletionguard.h>
 
 #include <bsls_assert.h>
@@ -68,6 +71,8 @@ using namespace bsl;  // automatically added by script
 //
 // [3 ] ThreadPool(const Attributes&, int, int, TimeInterval,Allocator *);
 // [3 ] ThreadPool(tA, min, max, TI maxIdleTime, mI, *mR, *bA = 0);
+// [18] ThreadPool(tA, min, max, TI maxIdleTime, mode, *bA = 0);
+// [18] ThreadPool(tA, min, max, TI maxIdleTime, mode, mI, *mR, *bA = 0);
 // [6 ] ThreadPool(const Attributes&, int, int, int ,Allocator *);
 // [6 ] ThreadPool(tA, min, max, int maxIdleTime, mI, *mR, *bA = 0);
 // [3 ] ~ThreadPool();
@@ -86,6 +91,7 @@ using namespace bsl;  // automatically added by script
 // [6 ] int maxIdleTime() const;
 // [3 ] bsls::TimeInterval maxIdleTimeInterval() const;
 // [3 ] int threadFailures() const;
+// [18] SchedulingMode schedulingMode() const;
 // [9 ] double percentBusy() const
 // [9 ] double resetPercentBusy()
 // ----------------------------------------------------------------------------
@@ -99,6 +105,7 @@ using namespace bsl;  // automatically added by script
 // [13] TESTING CPU consumption of an idle pool.
 // [15] TESTING MOVING ENQUEUEJOB METHOD
 // [16] THREAD NAMES
+// [18] WORK-STEALING SCHEDULING MODE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -787,6 +794,54 @@ void threadNameCheckJob(void *arg)
 
 }  // close namespace THREAD_NAMES_TEST
 
+// ============================================================================
+//                         CASE 18 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace case18 {
+
+/// Increment the specified `counter`, and, if the specified `depth` is
+/// positive, enqueue on the specified `pool` two jobs that invoke this
+/// function with `depth - 1`.  Note that a call to this function with a
+/// `depth` of `N` results in `2^(N + 1) - 1` increments of `counter`.
+void fanOutJob(Obj *pool, bsls::AtomicInt *counter, int depth)
+{
+    ++*counter;
+    if (0 < depth) {
+        for (int i = 0; i < 2; ++i) {
+            ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&fanOutJob,
+                                                              pool,
+                                                              counter,
+                                                              depth - 1)));
+        }
+    }
+}
+
+/// Increment the specified `counter`.
+void countJob(bsls::AtomicInt *counter)
+{
+    ++*counter;
+}
+
+/// Increment the specified `counter`, then wait on the specified `barrier`.
+void blockingJob(bsls::AtomicInt *counter, bslmt::Barrier *barrier)
+{
+    ++*counter;
+    barrier->wait();
+}
+
+/// Enqueue on the specified `pool` the specified `numJobs` jobs that
+/// increment the specified `counter`.
+void producerJob(Obj *pool, bsls::AtomicInt *counter, int numJobs)
+{
+    for (int i = 0; i < numJobs; ++i) {
+        ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&countJob,
+                                                          counter)));
+    }
+}
+
+}  // close namespace case18
+
 // ============================================================================
 //                         CASE 17 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -1264,6 +1319,115 @@ struct MinusTwoJob {
     }
 };
 
+// ============================================================================
+//                         CASE -3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace caseMinus3 {
+
+Obj                *s_pool_p;          // pool under test
+bsls::Types::Int64  s_jobBusyWork;     // busy work performed by each job
+int                 s_fanOut;          // number of child jobs per job
+
+/// Perform `s_jobBusyWork` busy work.
+void leafJob()
+{
+    bslmt::ThroughputBenchmark::busyWork(s_jobBusyWork);
+}
+
+/// Enqueue `s_fanOut` leaf jobs on `s_pool_p`, then perform `s_jobBusyWork`
+/// busy work.
+void fanOutJob()
+{
+    for (int i = 0; i < s_fanOut; ++i) {
+        s_pool_p->enqueueJob(&leafJob);
+    }
+    bslmt::ThroughputBenchmark::busyWork(s_jobBusyWork);
+}
+
+/// Enqueue a job on `s_pool_p`; the job fans out if `0 < s_fanOut`.
+void push(int)
+{
+    if (s_fanOut) {
+        s_pool_p->enqueueJob(&fanOutJob);
+    }
+    else {
+        s_pool_p->enqueueJob(&leafJob);
+    }
+}
+
+/// Start `s_pool_p`.
+void initializeSample(bool)
+{
+    s_pool_p->start();
+}
+
+/// Stop `s_pool_p`, discarding the jobs that have not yet started.
+void shutdownSample(bool)
+{
+    s_pool_p->shutdown();
+}
+
+/// Do nothing.
+void cleanupSample(bool)
+{
+}
+
+/// Measure, using `bslmt::ThroughputBenchmark`, the rate at which the
+/// specified `numProducers` threads can enqueue jobs on a thread pool
+/// having the specified `numThreads` processing threads and the specified
+/// `mode`, where each job performs the specified `jobBusyWork` and enqueues
+/// the specified `fanOut` additional jobs from the processing thread.
+/// Print the median throughput, in jobs per second, together with the
+/// specified `scenarioName`.
+void benchmark(const char           *scenarioName,
+               Obj::SchedulingMode   mode,
+               int                   numProducers,
+               int                   numThreads,
+               int                   jobBusyWork,
+               int                   fanOut)
+{
+    bslmt::ThreadAttributes attr;
+    Obj                     pool(attr,
+                                 numThreads,
+                                 numThreads,
+                                 bsls::TimeInterval(10, 0),
+                                 mode);
+
+    s_pool_p      = &pool;
+    s_jobBusyWork = jobBusyWork;
+    s_fanOut      = fanOut;
+
+    bslmt::ThroughputBenchmark bench;
+
+    int id = bench.addThreadGroup(&push, numProducers, 0);
+
+    bslmt::ThroughputBenchmarkResult result;
+    bench.execute(&result,
+                  100,
+                  11,
+                  &initializeSample,
+                  &shutdownSample,
+                  &cleanupSample);
+
+    double median;
+    result.getMedian(&median, id);
+
+    printf("%s,%s,%d,%d,%d,%d,%.0f\n",
+           scenarioName,
+           Obj::e_WORK_STEALING == mode ? "WORK_STEALING" : "SHARED_QUEUE",
+           numProducers,
+           numThreads,
+           jobBusyWork,
+           fanOut,
+           median * (1 + fanOut));
+    fflush(stdout);
+
+    s_pool_p = 0;
+}
+
+}  // close namespace caseMinus3
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1291,6 +1455,334 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0: // 0 is always the first test case
+      case 18: {
+        // --------------------------------------------------------------------
+        // WORK-STEALING SCHEDULING MODE
+        //
+        // Concerns:
+        // 1. The existing constructors create a pool in `e_SHARED_QUEUE`
+        //    mode, and the new constructors create a pool in the supplied
+        //    mode.
+        //
+        // 2. In `e_WORK_STEALING` mode, every job enqueued from a thread that
+        //    is not a processing thread of the pool executes exactly once.
+        //
+        // 3. In `e_WORK_STEALING` mode, every job enqueued from a processing
+        //    thread of the pool (i.e., by another job) executes exactly once,
+        //    and jobs are stolen by idle threads.
+        //
+        // 4. `drain` waits until all jobs, including the ones enqueued by
+        //    executing jobs, have completed; `stop` completes all pending
+        //    jobs; `shutdown` discards pending jobs.
+        //
+        // 5. The minimum and maximum number of threads are honored: threads
+        //    are created on demand up to the maximum, and threads in excess of
+        //    the minimum exit after the maximum idle time.
+        //
+        // 6. `numPendingJobs`, `numActiveThreads`, and `percentBusy` account
+        //    for the jobs held in the per-thread queues.
+        //
+        // 7. All memory is supplied by the allocator supplied at
+        //    construction.
+        //
+        // Plan:
+        // 1. Construct pools with each constructor and verify
+        //    `schedulingMode`.  (C-1)
+        //
+        // 2. For a set of pools with various minimum and maximum numbers of
+        //    threads, enqueue a large number of counting jobs from several
+        //    external threads, drain the pool, and verify the count.  (C-2,4)
+        //
+        // 3. Enqueue a job that recursively fans out into a binary tree of
+        //    jobs, drain the pool, and verify the number of executed jobs.
+        //    (C-3,4)
+        //
+        // 4. Block all the processing threads on a barrier, enqueue
+        //    additional jobs, verify `numPendingJobs` and `numActiveThreads`,
+        //    then release the barrier and verify the behavior of `stop` and
+        //    `shutdown`.  (C-4,6)
+        //
+        // 5. Saturate a pool with a nonzero minimum, then verify that the
+        //    number of threads returns to the minimum after the idle time.
+        //    (C-5)
+        //
+        // 6. Use a test allocator throughout.  (C-7)
+        //
+        // Testing:
+        //   ThreadPool(tA, min, max, TI maxIdleTime, mode, *bA = 0);
+        //   ThreadPool(tA, min, max, TI maxIdleTime, mode, mI, *mR, *bA = 0);
+        //   SchedulingMode schedulingMode() const;
+        //   WORK-STEALING SCHEDULING MODE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "WORK-STEALING SCHEDULING MODE\n"
+                             "=============================\n";
+
+        using namespace case18;
+
+        const bsls::TimeInterval k_IDLE(0, 100 * 1000 * 1000);
+
+        bslma::TestAllocator    da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslmt::ThreadAttributes attr;
+
+        if (verbose) cout << "\tTesting `schedulingMode`." << endl;
+        {
+            Obj mX(attr, 1, 2, 100, &testAllocator);
+            ASSERT(Obj::e_SHARED_QUEUE == mX.schedulingMode());
+
+            Obj mY(attr, 1, 2, k_IDLE, Obj::e_SHARED_QUEUE, &testAllocator);
+            ASSERT(Obj::e_SHARED_QUEUE == mY.schedulingMode());
+
+            Obj mZ(attr, 1, 2, k_IDLE, Obj::e_WORK_STEALING, &testAllocator);
+            ASSERT(Obj::e_WORK_STEALING == mZ.schedulingMode());
+
+            Obj mW(attr,
+                   1,
+                   2,
+                   k_IDLE,
+                   Obj::e_WORK_STEALING,
+                   "ws",
+                   0,
+                   &testAllocator);
+            ASSERT(Obj::e_WORK_STEALING == mW.schedulingMode());
+        }
+
+        if (verbose) cout << "\tTesting jobs enqueued externally." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_min;
+                int d_max;
+            } DATA[] = {
+                //LINE  MIN  MAX
+                //----  ---  ---
+                { L_,     0,   1 },
+                { L_,     0,   4 },
+                { L_,     1,   1 },
+                { L_,     2,   8 },
+                { L_,     4,   4 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            const int k_NUM_PRODUCERS = 4;
+            const int k_NUM_JOBS      = 5000;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+                const int MIN  = DATA[ti].d_min;
+                const int MAX  = DATA[ti].d_max;
+
+                if (veryVerbose) { T_ P_(LINE); P_(MIN); P(MAX); }
+
+                Obj mX(attr,
+                       MIN,
+                       MAX,
+                       k_IDLE,
+                       Obj::e_WORK_STEALING,
+                       &testAllocator);
+
+                STARTPOOL(mX);
+
+                bsls::AtomicInt counter(0);
+
+                bsl::vector<bslmt::ThreadUtil::Handle> handles(
+                                                              k_NUM_PRODUCERS);
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    ASSERTV(LINE, 0 == bslmt::ThreadUtil::create(
+                                       &handles[i],
+                                       bdlf::BindUtil::bind(&producerJob,
+                                                            &mX,
+                                                            &counter,
+                                                            k_NUM_JOBS)));
+                }
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                mX.drain();
+
+                ASSERTV(LINE, counter, k_NUM_PRODUCERS * k_NUM_JOBS == counter);
+                ASSERTV(LINE, mX.numPendingJobs(), 0 == mX.numPendingJobs());
+                ASSERTV(LINE, 0 == mX.numActiveThreads());
+                ASSERTV(LINE, mX.numWaitingThreads() <= MAX);
+                ASSERTV(LINE, 0 == mX.enabled());
+
+                // `drain` disables queuing.
+
+                ASSERTV(LINE, 0 != mX.enqueueJob(
+                                   bdlf::BindUtil::bind(&countJob, &counter)));
+                STARTPOOL(mX);
+                ASSERTV(LINE, 0 == mX.enqueueJob(
+                                   bdlf::BindUtil::bind(&countJob, &counter)));
+                mX.stop();
+
+                ASSERTV(LINE, counter,
+                        k_NUM_PRODUCERS * k_NUM_JOBS + 1 == counter);
+                ASSERTV(LINE, 0 == mX.numWaitingThreads());
+            }
+        }
+
+        if (verbose) cout << "\tTesting jobs enqueued by jobs." << endl;
+        {
+            const int k_DEPTH = 12;
+
+            for (int maxThreads = 1; maxThreads <= 8; maxThreads *= 2) {
+                Obj mX(attr,
+                       0,
+                       maxThreads,
+                       k_IDLE,
+                       Obj::e_WORK_STEALING,
+                       &testAllocator);
+
+                STARTPOOL(mX);
+
+                bsls::AtomicInt counter(0);
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOutJob,
+                                                               &mX,
+                                                               &counter,
+                                                               k_DEPTH)));
+
+                // Note that `drain` disables queuing, so wait for the last
+                // job to be enqueued before draining the pool.
+
+                while ((1 << (k_DEPTH + 1)) - 1 != counter) {
+                    bslmt::ThreadUtil::yield();
+                }
+                mX.drain();
+
+                ASSERTV(maxThreads, counter,
+                        (1 << (k_DEPTH + 1)) - 1 == counter);
+                ASSERTV(maxThreads, 0 == mX.numPendingJobs());
+            }
+        }
+
+        if (verbose) cout << "\tTesting `stop`, `shutdown`, and accessors."
+                          << endl;
+        {
+            const int k_NUM_THREADS = 4;
+            const int k_NUM_EXTRA   = 100;
+
+            for (int doShutdown = 0; doShutdown < 2; ++doShutdown) {
+                Obj mX(attr,
+                       k_NUM_THREADS,
+                       k_NUM_THREADS,
+                       k_IDLE,
+                       Obj::e_WORK_STEALING,
+                       &testAllocator);
+
+                STARTPOOL(mX);
+
+                bsls::AtomicInt counter(0);
+                bslmt::Barrier  barrier(k_NUM_THREADS + 1);
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                                 &blockingJob,
+                                                                 &counter,
+                                                                 &barrier)));
+                }
+
+                // Wait until all the threads are blocked.
+
+                while (k_NUM_THREADS != counter) {
+                    bslmt::ThreadUtil::yield();
+                }
+                ASSERTV(mX.numActiveThreads(),
+                        k_NUM_THREADS == mX.numActiveThreads());
+                ASSERTV(mX.numWaitingThreads(), 0 == mX.numWaitingThreads());
+
+                for (int i = 0; i < k_NUM_EXTRA; ++i) {
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&countJob,
+                                                                   &counter)));
+                }
+                ASSERTV(mX.numPendingJobs(),
+                        k_NUM_EXTRA == mX.numPendingJobs());
+
+                if (doShutdown) {
+                    bslmt::ThreadUtil::Handle handle;
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                           &handle,
+                                           bdlf::BindUtil::bind(&Obj::shutdown,
+                                                                &mX)));
+
+                    // Wait until `shutdown` disables queuing.  Note that
+                    // `numPendingJobs` acquires the lock held by `shutdown`
+                    // while it discards the pending jobs and enqueues one
+                    // internal stop request per thread.
+
+                    while (mX.enabled()) {
+                        bslmt::ThreadUtil::yield();
+                    }
+                    ASSERTV(mX.numPendingJobs(),
+                            k_NUM_THREADS >= mX.numPendingJobs());
+                    barrier.wait();
+                    bslmt::ThreadUtil::join(handle);
+
+                    ASSERTV(counter, k_NUM_THREADS == counter);
+                }
+                else {
+                    barrier.wait();
+                    mX.stop();
+
+                    ASSERTV(counter, k_NUM_THREADS + k_NUM_EXTRA == counter);
+                }
+                ASSERT(0 == mX.numPendingJobs());
+                ASSERT(0 == mX.numActiveThreads());
+                ASSERT(0 == mX.numWaitingThreads());
+                ASSERT(0 <  mX.percentBusy());
+            }
+        }
+
+        if (verbose) cout << "\tTesting max idle time." << endl;
+        {
+            const int k_MIN = 2;
+            const int k_MAX = 6;
+
+            Obj mX(attr,
+                   k_MIN,
+                   k_MAX,
+                   k_IDLE,
+                   Obj::e_WORK_STEALING,
+                   &testAllocator);
+
+            STARTPOOL(mX);
+            ASSERTV(mX.numWaitingThreads(), k_MIN == mX.numWaitingThreads());
+
+            bsls::AtomicInt counter(0);
+            bslmt::Barrier  barrier(k_MAX + 1);
+
+            for (int i = 0; i < k_MAX; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&blockingJob,
+                                                               &counter,
+                                                               &barrier)));
+            }
+            barrier.wait();
+
+            // Wait for the threads beyond the minimum to time out.  Allow for
+            // a very slow test machine.
+
+            for (int i = 0; i < 100 && k_MIN != mX.numWaitingThreads(); ++i) {
+                bslmt::ThreadUtil::microSleep(100 * 1000);
+            }
+            ASSERTV(mX.numWaitingThreads(), k_MIN == mX.numWaitingThreads());
+
+            // The remaining threads still process jobs.
+
+            for (int i = 0; i < 1000; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&countJob,
+                                                               &counter)));
+            }
+            mX.drain();
+            ASSERTV(counter, k_MAX + 1000 == counter);
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+        ASSERTV(testAllocator.numBlocksInUse(),
+                0 == testAllocator.numBlocksInUse());
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // INTERNAL FUNCTOR MOVE
@@ -3303,6 +3795,71 @@ int main(int argc, char *argv[])
 
         tp.shutdown();
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: SCHEDULING MODE CONTENTION
+        //
+        // Concerns:
+        // 1. Measure the throughput of enqueuing short jobs, from external
+        //    threads and from processing threads, in each scheduling mode.
+        //
+        // Plan:
+        // 1. For each scheduling mode, and for a set of numbers of producer
+        //    threads, processing threads, job durations, and fan-out factors,
+        //    use `bslmt::ThroughputBenchmark` to measure the rate at which
+        //    jobs are enqueued, and print the results as comma-separated
+        //    values.
+        //
+        // Testing:
+        //   BENCHMARK: SCHEDULING MODE CONTENTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BENCHMARK: SCHEDULING MODE CONTENTION\n"
+                             "=====================================\n";
+
+        using namespace caseMinus3;
+
+        const int k_NUM_CPUS = bsl::max(
+                   1,
+                   static_cast<int>(bslmt::ThreadUtil::hardwareConcurrency()));
+
+        static const struct {
+            const char *d_scenario;
+            int         d_numProducers;
+            int         d_jobBusyWork;
+            int         d_fanOut;
+        } DATA[] = {
+            // SCENARIO           PRODUCERS  BUSY  FAN-OUT
+            // -----------------  ---------  ----  -------
+            { "oneProducer",              1,    0,       0 },
+            { "manyProducers",            4,    0,       0 },
+            { "fanOut",                   1,    0,      16 },
+            { "fanOutBusy",               1,  100,      16 },
+            { "manyFanOutBusy",           4,  100,      16 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        printf("scenario,mode,producers,threads,busyWork,fanOut,jobsPerSec\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            for (int numThreads = 1;
+                 numThreads <= k_NUM_CPUS;
+                 numThreads *= 2) {
+                benchmark(DATA[ti].d_scenario,
+                          Obj::e_SHARED_QUEUE,
+                          DATA[ti].d_numProducers,
+                          numThreads,
+                          DATA[ti].d_jobBusyWork,
+                          DATA[ti].d_fanOut);
+                benchmark(DATA[ti].d_scenario,
+                          Obj::e_WORK_STEALING,
+                          DATA[ti].d_numProducers,
+                          numThreads,
+                          DATA[ti].d_jobBusyWork,
+                          DATA[ti].d_fanOut);
+            }
+        }
+      } break;
       default: {
           testStatus = -1;
       }
@@ -840,6 +840,84 @@ TimerEventScheduler::TimerEventScheduler(
     initialize(metricsRegistry, eventSchedulerName);
 }
 
+TimerEventScheduler::TimerEventScheduler(
+                                   bdlc::TimerStoreType::Enum   storeType,
+                                   bsls::SystemClockType::Enum  clockType,
+                                   bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData),
+                       basicAllocator)
+, d_eventTimeQueue(NUM_INDEX_BITS_DEFAULT, storeType, basicAllocator)
+, d_clockTimeQueue(NUM_INDEX_BITS_DEFAULT, storeType, basicAllocator)
+, d_clocks(basicAllocator)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingClockItems(basicAllocator)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+, d_eventSchedulerName(basicAllocator)
+, d_cachedClockMicroseconds(bsl::numeric_limits<bsls::Types::Int64>::max())
+, d_cachedEventMicroseconds(bsl::numeric_limits<bsls::Types::Int64>::max())
+{
+    initialize(
+            0,
+            bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION);
+}
+
+TimerEventScheduler::TimerEventScheduler(
+                                   int                          numEvents,
+                                   int                          numClocks,
+                                   bdlc::TimerStoreType::Enum   storeType,
+                                   bsls::SystemClockType::Enum  clockType,
+                                   bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData),
+                       basicAllocator)
+, d_eventTimeQueue(bsl::max(NUM_INDEX_BITS_MIN, numBitsRequired(numEvents)),
+                   storeType,
+                   basicAllocator)
+, d_clockTimeQueue(bsl::max(NUM_INDEX_BITS_MIN, numBitsRequired(numClocks)),
+                   storeType,
+                   basicAllocator)
+, d_clocks(basicAllocator)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingClockItems(basicAllocator)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+, d_eventSchedulerName(basicAllocator)
+, d_cachedClockMicroseconds(bsl::numeric_limits<bsls::Types::Int64>::max())
+, d_cachedEventMicroseconds(bsl::numeric_limits<bsls::Types::Int64>::max())
+{
+    BSLS_ASSERT(numEvents < (1 << 24) - 1);
+    BSLS_ASSERT(numClocks < (1 << 24) - 1);
+    BSLS_REVIEW((numEvents + numClocks) < (1 << 24) - 1);
+
+    initialize(
+            0,
+            bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION);
+}
+
 TimerEventScheduler::TimerEventScheduler(
                      int                                     numEvents,
                      int                                     numClocks,
@@ -110,6 +110,21 @@ BSLS_IDENT("$Id: $")
 // instance according to the correct clock is available via the
 // `bdlmt::TimerEventScheduler::now` accessor.
 //
+///Timer Store
+///-----------
+// A `bdlmt::TimerEventScheduler` keeps its events and clocks in two
+// `bdlcc::TimeQueue` objects.  By default these order their items in a
+// `bsl::map`, so that scheduling, rescheduling, and cancelling an event takes
+// time logarithmic in the number of distinct times scheduled.  A scheduler
+// created with the `bdlc::TimerStoreType::e_TIMING_WHEEL` store type instead
+// uses time queues backed by a `bdlc::TimingWheel`, on which these operations
+// take constant time; this suits schedulers holding many timeouts that are
+// usually cancelled or rescheduled before they expire.  Since the scheduler
+// dispatches events at a resolution of one microsecond, the microsecond
+// resolution of such time queues (see `bdlcc_timequeue`) does not change the
+// order in which events are dispatched, except that events scheduled within
+// the same microsecond are dispatched in the order they were scheduled.
+//
 ///Event Clock Substitution
 ///------------------------
 // For testing purposes, a class `bdlmt::TimerEventSchedulerTestTimeSource` is
@@ -331,6 +346,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlc_timingwheel.h>
+
 #include <bdlcc_objectcatalog.h>
 #include <bdlcc_timequeue.h>
 
@@ -762,6 +779,36 @@ class TimerEventScheduler {
                         bdlm::MetricsRegistry       *metricsRegistry,
                         bslma::Allocator            *basicAllocator = 0);
 
+    /// Construct an event scheduler using the default dispatcher functor
+    /// (see the "The dispatcher thread and the dispatcher functor" section
+    /// in component-level doc), ordering its events and clocks in a store of
+    /// the specified `storeType` (see [](#Timer Store)), and using the
+    /// specified `clockType` to indicate the epoch used for all time
+    /// intervals (see [](#Supported Clock-Types)).  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  Note that the
+    /// maximal number of scheduled non-recurring events and recurring events
+    /// defaults to an implementation defined constant.
+    TimerEventScheduler(bdlc::TimerStoreType::Enum   storeType,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+
+    /// Construct a timer event scheduler using the default dispatcher functor
+    /// (see the "The dispatcher thread and the dispatcher functor" section in
+    /// component level doc) that has the capability to concurrently schedule
+    /// *at* *least* the specified `numEvents` and `numClocks`, orders them in
+    /// a store of the specified `storeType` (see [](#Timer Store)), and uses
+    /// the specified `clockType` to indicate the epoch used for all time
+    /// intervals (see [](#Supported Clock-Types)).  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 <= numEvents < 2**24` and `0 <= numClocks < 2**24`.
+    TimerEventScheduler(int                          numEvents,
+                        int                          numClocks,
+                        bdlc::TimerStoreType::Enum   storeType,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+
     /// Construct a timer event scheduler using the specified
     /// `dispatcherFunctor` (see "The dispatcher thread and the dispatcher
     /// functor" section in component level doc) that has the capability to
@@ -123,6 +123,8 @@ using bsl::ptrdiff_t;
 // [23] bdlmt::TimerEventScheduler(nE, nC, disp, mI, mR, bA = 0);
 // [24] bdlmt::TimerEventScheduler(nE, nC, disp, cT, bA = 0);
 // [24] bdlmt::TimerEventScheduler(nE, nC, disp, cT, mI, mR, bA = 0);
+// [31] bdlmt::TimerEventScheduler(sT, cT, bA = 0);
+// [31] bdlmt::TimerEventScheduler(nE, nC, sT, cT, bA = 0);
 //
 // [ 1] ~bdlmt::TimerEventScheduler();
 //
@@ -161,8 +163,9 @@ using bsl::ptrdiff_t;
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
 // [28] CLOCK-REPLACEMENT BREATHING TEST
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [30] CONCERN: THREAD NAMES
+// [31] CONCERN: TIMING WHEEL STORE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -938,6 +941,120 @@ bool TestMetricsAdapter::verify(const bsl::string& name) const
         && d_descriptors[0].objectIdentifier()       == name;
 }
 
+// ============================================================================
+//                         CASE 31 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace TIMER_EVENT_SCHEDULER_TEST_CASE_31
+
+{
+
+/// This class records, in a thread-safe manner, the ids of executed events.
+class Recorder {
+
+    // DATA
+    mutable bslmt::Mutex d_mutex;
+    bsl::vector<int>     d_ids;
+
+  public:
+    // CREATORS
+    explicit Recorder(bslma::Allocator *basicAllocator)
+    : d_ids(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Record the specified `id`.
+    void record(int id)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_ids.push_back(id);
+    }
+
+    // ACCESSORS
+
+    /// Load the recorded ids, in order, into the specified `result`.
+    void ids(bsl::vector<int> *result) const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        *result = d_ids;
+    }
+
+    /// Return the number of recorded ids.
+    int size() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return static_cast<int>(d_ids.size());
+    }
+};
+
+/// Schedule events on the specified `scheduler`, which uses the specified
+/// `timeSource`, cancel and reschedule some of them, and verify that the
+/// remaining ones are executed in order of time.  Use the specified
+/// `allocator` to supply memory.
+void testScheduler(Obj                                      *scheduler,
+                   bdlmt::TimerEventSchedulerTestTimeSource *timeSource,
+                   bslma::Allocator                         *allocator)
+{
+    Recorder         recorder(allocator);
+    bsls::AtomicInt  numClockRuns(0);
+    const int        NUM_EVENTS = 10;
+    Handle           handles[NUM_EVENTS];
+
+    const bsls::TimeInterval now = timeSource->now();
+
+    // Schedule event `i` at `now + i + 1` seconds, in reverse order.
+
+    for (int i = NUM_EVENTS - 1; 0 <= i; --i) {
+        handles[i] = scheduler->scheduleEvent(
+                             now + bsls::TimeInterval(i + 1),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  i));
+        ASSERTV(i, Obj::e_INVALID_HANDLE != handles[i]);
+    }
+    const Handle clock = scheduler->startClock(
+                                bsls::TimeInterval(10),
+                                bdlf::BindUtil::bind(&bsls::AtomicInt::add,
+                                                     &numClockRuns,
+                                                     1),
+                                now + bsls::TimeInterval(5));
+
+    ASSERT(0 == scheduler->cancelEvent(handles[3]));
+    ASSERT(0 == scheduler->cancelEvent(handles[7]));
+    ASSERT(0 != scheduler->cancelEvent(handles[7]));
+    ASSERT(0 == scheduler->rescheduleEvent(handles[5],
+                                           now + bsls::TimeInterval(20)));
+    ASSERT(NUM_EVENTS - 2 == scheduler->numEvents());
+
+    ASSERT(0 == scheduler->start());
+    timeSource->advanceTime(bsls::TimeInterval(30));
+
+    for (int i = 0; i < 500 && NUM_EVENTS - 2 > recorder.size(); ++i) {
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+    scheduler->stop();
+
+    static const int EXPECTED[] = { 0, 1, 2, 4, 6, 8, 9, 5 };
+    const int        NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+
+    bsl::vector<int> ids(allocator);
+    recorder.ids(&ids);
+
+    ASSERTV(ids.size(), NUM_EXPECTED == static_cast<int>(ids.size()));
+    for (int i = 0; i < NUM_EXPECTED && i < static_cast<int>(ids.size());
+                                                                         ++i) {
+        ASSERTV(i, EXPECTED[i], ids[i], EXPECTED[i] == ids[i]);
+    }
+    ASSERTV(numClockRuns, 0 < numClockRuns);
+    ASSERT(0 == scheduler->numEvents());
+
+    ASSERT(0 == scheduler->cancelClock(clock));
+}
+
+}  // close namespace TIMER_EVENT_SCHEDULER_TEST_CASE_31
+
 // ----------------------------------------------------------------------------
 //                       USAGE EXAMPLE RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -3209,7 +3326,7 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE:
         //
@@ -3234,6 +3351,61 @@ int main(int argc, char *argv[])
         My_Server server(bsls::TimeInterval(10), &ta);
 
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // CONCERN: TIMING WHEEL STORE
+        //
+        // Concerns:
+        // 1. A scheduler created with the `e_TIMING_WHEEL` store type
+        //    executes events and clocks in order of time.
+        //
+        // 2. Events can be cancelled and rescheduled.
+        //
+        // 3. Memory is supplied by the allocator specified at construction.
+        //
+        // Plan:
+        // 1. Using each constructor taking a store type, create a scheduler
+        //    with a test time source.  Schedule events in reverse order of
+        //    time, and a clock, cancel two events, and reschedule another
+        //    one.  Advance the time source and verify the order in which the
+        //    events are executed.  (C-1..2)
+        //
+        // 2. Use a test allocator and verify that no memory is outstanding
+        //    after the scheduler is destroyed.  (C-3)
+        //
+        // Testing:
+        //   bdlmt::TimerEventScheduler(sT, cT, bA = 0);
+        //   bdlmt::TimerEventScheduler(nE, nC, sT, cT, bA = 0);
+        //   CONCERN: TIMING WHEEL STORE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: TIMING WHEEL STORE" << endl
+                          << "===========================" << endl;
+
+        using namespace TIMER_EVENT_SCHEDULER_TEST_CASE_31;
+
+        const bdlc::TimerStoreType::Enum WHEEL =
+                                         bdlc::TimerStoreType::e_TIMING_WHEEL;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(WHEEL, bsls::SystemClockType::e_MONOTONIC, &ta);
+
+            bdlmt::TimerEventSchedulerTestTimeSource timeSource(&mX);
+
+            testScheduler(&mX, &timeSource, &ta);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        {
+            Obj mX(100, 10, WHEEL, bsls::SystemClockType::e_REALTIME, &ta);
+
+            bdlmt::TimerEventSchedulerTestTimeSource timeSource(&mX);
+
+            testScheduler(&mX, &timeSource, &ta);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING THREAD NAME
@@ -777,6 +777,75 @@ int localFcntlLock(int descriptor, int cmd, int type)
     return fcntl(descriptor, cmd, &flk);
 }
 
+/// Transfer data between the file with the specified `descriptor` and the
+/// sequence of the specified `numBuffers` buffers starting at the specified
+/// `buffers`, reading into the buffers if the specified `readFlag` is
+/// `true`, and writing from them otherwise, using as few `::readv` or
+/// `::writev` calls as possible.  Retry partial transfers and interrupted
+/// calls until all buffers are transferred, the end of the file is reached,
+/// or an error occurs.  Return the total number of bytes transferred, or -1
+/// if an error occurred before any bytes were transferred.
+static
+bdls::FilesystemUtil::Offset localTransferVector(
+                           int                                   descriptor,
+                           const bdls::FilesystemUtil::IoBuffer *buffers,
+                           int                                   numBuffers,
+                           bool                                  readFlag)
+{
+    typedef bdls::FilesystemUtil::Offset Offset;
+
+    enum { k_MAX_IOVECS = 64 };  // well below 'IOV_MAX' on all platforms
+
+    struct iovec iov[k_MAX_IOVECS];
+
+    Offset total        = 0;
+    int    index        = 0;  // first buffer not completely transferred
+    Offset bufferOffset = 0;  // bytes of 'buffers[index]' transferred
+
+    while (1) {
+        // Skip the completed (and empty) buffers.
+
+        while (index < numBuffers
+            && bufferOffset >= buffers[index].d_length) {
+            bufferOffset -= buffers[index].d_length;
+            ++index;
+        }
+
+        int numIovecs = 0;
+        for (int i = index; i < numBuffers && numIovecs < k_MAX_IOVECS; ++i) {
+            const Offset skip = i == index ? bufferOffset : 0;
+            if (buffers[i].d_length > skip) {
+                iov[numIovecs].iov_base = buffers[i].d_buffer_p + skip;
+                iov[numIovecs].iov_len  = static_cast<size_t>(
+                                                 buffers[i].d_length - skip);
+                ++numIovecs;
+            }
+        }
+
+        if (0 == numIovecs) {
+            break;
+        }
+
+        const ssize_t rc = readFlag ? ::readv(descriptor, iov, numIovecs)
+                                    : ::writev(descriptor, iov, numIovecs);
+        if (rc < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return 0 == total ? -1 : total;                           // RETURN
+        }
+
+        if (0 == rc) {
+            break;
+        }
+
+        total        += rc;
+        bufferOffset += rc;
+    }
+
+    return total;
+}
+
 /// Free the specified glob data structure, `pglob`.  Note that this
 /// function has a signature appropriate for use as a managed pointer
 /// deleter, hence the parameters are both passed as `void *`.
@@ -1591,6 +1660,96 @@ int FilesystemUtil::write(FileDescriptor  descriptor,
     return WriteFile(descriptor, buffer, numBytesToWrite, &n, 0) ? n : -1;
 }
 
+int FilesystemUtil::pread(FileDescriptor  descriptor,
+                          void           *buffer,
+                          int             numBytesToRead,
+                          Offset          offset)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= numBytesToRead);
+    BSLS_ASSERT(0 <= offset);
+
+    OVERLAPPED overlapped;
+    ZeroMemory(&overlapped, sizeof(overlapped));
+    overlapped.Offset     = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+    DWORD n;
+    if (!ReadFile(descriptor, buffer, numBytesToRead, &n, &overlapped)) {
+        return ERROR_HANDLE_EOF == GetLastError() ? 0 : -1;           // RETURN
+    }
+    return n;
+}
+
+int FilesystemUtil::pwrite(FileDescriptor  descriptor,
+                           const void     *buffer,
+                           int             numBytesToWrite,
+                           Offset          offset)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= numBytesToWrite);
+    BSLS_ASSERT(0 <= offset);
+
+    OVERLAPPED overlapped;
+    ZeroMemory(&overlapped, sizeof(overlapped));
+    overlapped.Offset     = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+    DWORD n;
+    return WriteFile(descriptor, buffer, numBytesToWrite, &n, &overlapped)
+           ? n
+           : -1;
+}
+
+FilesystemUtil::Offset FilesystemUtil::readv(FileDescriptor  descriptor,
+                                             const IoBuffer *buffers,
+                                             int             numBuffers)
+{
+    BSLS_ASSERT(buffers || 0 == numBuffers);
+    BSLS_ASSERT(0 <= numBuffers);
+
+    // Windows has no vectored I/O on handles opened for synchronous access,
+    // so transfer the buffers one at a time.
+
+    Offset total = 0;
+    for (int i = 0; i < numBuffers; ++i) {
+        const int rc = read(descriptor,
+                            buffers[i].d_buffer_p,
+                            buffers[i].d_length);
+        if (rc < 0) {
+            return 0 == total ? -1 : total;                           // RETURN
+        }
+        total += rc;
+        if (rc < buffers[i].d_length) {
+            break;
+        }
+    }
+    return total;
+}
+
+FilesystemUtil::Offset FilesystemUtil::writev(FileDescriptor  descriptor,
+                                              const IoBuffer *buffers,
+                                              int             numBuffers)
+{
+    BSLS_ASSERT(buffers || 0 == numBuffers);
+    BSLS_ASSERT(0 <= numBuffers);
+
+    Offset total = 0;
+    for (int i = 0; i < numBuffers; ++i) {
+        const int rc = write(descriptor,
+                             buffers[i].d_buffer_p,
+                             buffers[i].d_length);
+        if (rc < 0) {
+            return 0 == total ? -1 : total;                           // RETURN
+        }
+        total += rc;
+        if (rc < buffers[i].d_length) {
+            break;
+        }
+    }
+    return total;
+}
+
 int FilesystemUtil::map(FileDescriptor   descriptor,
                         void           **address,
                         Offset           offset,
@@ -1672,6 +1831,19 @@ int FilesystemUtil::sync(char *address, bsl::size_t numBytes, bool)
     return FlushViewOfFile(address, numBytes) ? 0 : -1;
 }
 
+int FilesystemUtil::adviseAccess(FileDescriptor, Offset offset, Offset length,
+                                 AccessAdvice)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+
+    // Windows offers no per-region access hints for open handles ('open'
+    // may be given 'FILE_FLAG_SEQUENTIAL_SCAN' and the like instead), so the
+    // advice is ignored.
+
+    return 0;
+}
+
 int FilesystemUtil::lock(FileDescriptor descriptor, bool lockWrite)
 {
     OVERLAPPED overlapped;
@@ -2590,6 +2762,58 @@ int FilesystemUtil::write(FileDescriptor  descriptor,
     return static_cast<int>(::write(descriptor, buffer, numBytes));
 }
 
+int FilesystemUtil::pread(FileDescriptor  descriptor,
+                          void           *buffer,
+                          int             numBytes,
+                          Offset          offset)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(0 <= offset);
+
+#if defined(U_USE_TRANSITIONAL_UNIX_FILE_SYSTEM_INTERFACE)
+    return static_cast<int>(::pread64(descriptor, buffer, numBytes, offset));
+#else
+    return static_cast<int>(::pread(descriptor, buffer, numBytes, offset));
+#endif
+}
+
+FilesystemUtil::Offset FilesystemUtil::readv(FileDescriptor  descriptor,
+                                             const IoBuffer *buffers,
+                                             int             numBuffers)
+{
+    BSLS_ASSERT(buffers || 0 == numBuffers);
+    BSLS_ASSERT(0 <= numBuffers);
+
+    return localTransferVector(descriptor, buffers, numBuffers, true);
+}
+
+int FilesystemUtil::pwrite(FileDescriptor  descriptor,
+                           const void     *buffer,
+                           int             numBytes,
+                           Offset          offset)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(0 <= offset);
+
+#if defined(U_USE_TRANSITIONAL_UNIX_FILE_SYSTEM_INTERFACE)
+    return static_cast<int>(::pwrite64(descriptor, buffer, numBytes, offset));
+#else
+    return static_cast<int>(::pwrite(descriptor, buffer, numBytes, offset));
+#endif
+}
+
+FilesystemUtil::Offset FilesystemUtil::writev(FileDescriptor  descriptor,
+                                              const IoBuffer *buffers,
+                                              int             numBuffers)
+{
+    BSLS_ASSERT(buffers || 0 == numBuffers);
+    BSLS_ASSERT(0 <= numBuffers);
+
+    return localTransferVector(descriptor, buffers, numBuffers, false);
+}
+
 int FilesystemUtil::map(FileDescriptor   descriptor,
                         void           **address,
                         Offset           offset,
@@ -2692,6 +2916,53 @@ int FilesystemUtil::tryLock(FileDescriptor descriptor, bool lockWriteFlag)
          :                                      -1;
 }
 
+int FilesystemUtil::adviseAccess(FileDescriptor descriptor,
+                                 Offset         offset,
+                                 Offset         length,
+                                 AccessAdvice   advice)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)                                           \
+ || defined(BSLS_PLATFORM_OS_AIX)                                             \
+ || defined(BSLS_PLATFORM_OS_SOLARIS)
+    int posixAdvice;
+    switch (advice) {
+      case e_ADVICE_SEQUENTIAL: {
+        posixAdvice = POSIX_FADV_SEQUENTIAL;
+      } break;
+      case e_ADVICE_RANDOM: {
+        posixAdvice = POSIX_FADV_RANDOM;
+      } break;
+      case e_ADVICE_WILL_NEED: {
+        posixAdvice = POSIX_FADV_WILLNEED;
+      } break;
+      case e_ADVICE_DONT_NEED: {
+        posixAdvice = POSIX_FADV_DONTNEED;
+      } break;
+      default: {
+        BSLS_ASSERT(e_ADVICE_NORMAL == advice);
+        posixAdvice = POSIX_FADV_NORMAL;
+      } break;
+    }
+
+# if defined(U_USE_TRANSITIONAL_UNIX_FILE_SYSTEM_INTERFACE)
+    return ::posix_fadvise64(descriptor, offset, length, posixAdvice);
+# else
+    return ::posix_fadvise(descriptor, offset, length, posixAdvice);
+# endif
+#else
+    // 'posix_fadvise' is not available (e.g., on Darwin), and the advice is
+    // only a hint, so it is ignored.
+
+    (void)descriptor;
+    (void)advice;
+
+    return 0;
+#endif
+}
+
 int FilesystemUtil::lock(FileDescriptor descriptor, bool lockWriteFlag)
 {
     int rc = localFcntlLock(descriptor,
@@ -3660,6 +3931,28 @@ bsl::ostream& operator<<(bsl::ostream&                      stream,
     return stream << output;
 }
 
+bsl::ostream& operator<<(bsl::ostream&                      stream,
+                         FilesystemUtil::AccessAdvice       value)
+{
+    const char *output = 0;
+    switch (value) {
+#undef   CASE
+#define  CASE(str) case FilesystemUtil::e_ ## str: output = #str; break
+      CASE(ADVICE_NORMAL);
+      CASE(ADVICE_SEQUENTIAL);
+      CASE(ADVICE_RANDOM);
+      CASE(ADVICE_WILL_NEED);
+      CASE(ADVICE_DONT_NEED);
+#undef   CASE
+      default: {
+        return stream << "Invalid 'AccessAdvice' == " <<
+                                             static_cast<int>(value); // RETURN
+      }
+    }
+
+    return stream << output;
+}
+
 }  // close package namespace
 
 namespace {
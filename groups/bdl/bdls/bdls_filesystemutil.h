@@ -99,6 +99,29 @@ BSLS_IDENT("$Id: $")
 // * `e_SEEK_FROM_END`
 //   > Seek from the end of the file.
 //
+///Positional and Vectored I/O
+///---------------------------
+// In addition to `read` and `write`, which transfer a single buffer at the
+// file pointer, `bdls::FilesystemUtil` provides:
+//
+// * `pread` and `pwrite`, which transfer a single buffer at an explicitly
+//   specified offset in the file.  On Posix the file pointer is neither used
+//   nor changed, so several threads can use positional I/O on one descriptor
+//   concurrently; on Windows the file pointer is left at an unspecified
+//   position.
+//
+// * `readv` and `writev`, which transfer a sequence of buffers (described by
+//   `bdls::FilesystemUtil::IoBuffer` objects) at the file pointer, using as
+//   few system calls as the platform allows (`readv(2)` and `writev(2)` on
+//   Posix).  These functions retry partial transfers, and so, unlike `read`
+//   and `write`, transfer fewer bytes than requested only at end-of-file or
+//   on error.
+//
+// The `adviseAccess` method passes a hint about the intended access pattern of
+// a region of a file (e.g., sequential access, or that the region will be
+// needed soon, which initiates readahead) to the operating system, on the
+// platforms that support `posix_fadvise`; elsewhere, it has no effect.
+//
 ///Platform-Specific File Locking Caveats
 ///--------------------------------------
 // Locking has the following caveats for the following operating systems:
@@ -418,6 +441,26 @@ struct FilesystemUtil {
         e_KEEP       // Keep the file's contents.
     };
 
+    /// Enumeration used to describe to `adviseAccess` the intended access
+    /// pattern of a region of a file.
+    enum AccessAdvice {
+        e_ADVICE_NORMAL,      // No particular pattern (the default).
+        e_ADVICE_SEQUENTIAL,  // Sequential access; read ahead aggressively.
+        e_ADVICE_RANDOM,      // Random access; do not read ahead.
+        e_ADVICE_WILL_NEED,   // The region will be needed soon; read it in.
+        e_ADVICE_DONT_NEED    // The region will not be needed soon.
+    };
+
+    /// This `struct` describes a contiguous region of memory used as one of
+    /// a sequence of buffers by the vectored I/O functions `readv` and
+    /// `writev`.
+    struct IoBuffer {
+
+        // PUBLIC DATA
+        char *d_buffer_p;  // address of the first byte of the region
+        int   d_length;    // number of bytes in the region
+    };
+
     // CLASS DATA
     static const FileDescriptor k_INVALID_FD;  // `FileDescriptor` value
                                                // representing no file, used
@@ -887,6 +930,20 @@ struct FilesystemUtil {
     /// descriptor referring to the same file, within a single process.
     static int lock(FileDescriptor descriptor, bool lockWriteFlag);
 
+    /// Advise the operating system that the region of the specified
+    /// `length` bytes beginning at the specified `offset` in the file with
+    /// the specified `descriptor` will be accessed as described by the
+    /// specified `advice`.  If `length` is 0, the region extends to the end
+    /// of the file.  Return 0 on success, and a non-zero value otherwise.
+    /// The behavior is undefined unless `0 <= offset` and `0 <= length`.
+    /// Note that the advice is only a hint, which on platforms that do not
+    /// support `posix_fadvise` (including Windows and Darwin) is ignored
+    /// with a return value of 0.
+    static int adviseAccess(FileDescriptor descriptor,
+                            Offset         offset,
+                            Offset         length,
+                            AccessAdvice   advice);
+
     /// Set the size of the file referred to by the specified `descriptor`
     /// to the specified `size`.  `descriptor` must be open for writing.
     /// After the function call, the position is set to the end of the file.
@@ -1000,6 +1057,31 @@ struct FilesystemUtil {
     /// other error.
     static int read(FileDescriptor descriptor, void *buffer, int numBytes);
 
+    /// Read the specified `numBytes` bytes beginning at the specified
+    /// `offset` in the file with the specified `descriptor` into the
+    /// specified `buffer`.  Return `numBytes` on success; the number of
+    /// bytes read if there were not enough available; or a negative number
+    /// on some other error.  On Posix, the file pointer is unaffected; on
+    /// Windows, its position after the call is unspecified.  The behavior
+    /// is undefined unless `0 <= numBytes` and `0 <= offset`.
+    static int pread(FileDescriptor  descriptor,
+                     void           *buffer,
+                     int             numBytes,
+                     Offset          offset);
+
+    /// Read, beginning at the file pointer of the file with the specified
+    /// `descriptor`, into the sequence of the specified `numBuffers`
+    /// buffers starting at the specified `buffers`, filling each buffer
+    /// before the next.  Return the total number of bytes read, which is
+    /// less than the total length of the buffers only if the end of the file
+    /// was reached or an error occurred after some bytes were read, or a
+    /// negative value if an error occurred before any bytes were read.  The
+    /// behavior is undefined unless `0 <= numBuffers` and each of the
+    /// buffers has a non-negative length.
+    static Offset readv(FileDescriptor  descriptor,
+                        const IoBuffer *buffers,
+                        int             numBuffers);
+
     /// Remove the file or directory at the specified `path`.  If the `path`
     /// refers to a directory and the optionally specified `recursiveFlag`
     /// is `true`, recursively remove all files and directories within the
@@ -1071,6 +1153,33 @@ struct FilesystemUtil {
                      const void     *buffer,
                      int             numBytes);
 
+    /// Write the specified `numBytes` from the specified `buffer` address
+    /// to the file with the specified `descriptor`, beginning at the
+    /// specified `offset` in the file.  Return `numBytes` on success; the
+    /// number of bytes written if space was exhausted; or a negative value
+    /// on some other error.  On Posix, the file pointer is unaffected; on
+    /// Windows, its position after the call is unspecified.  The behavior
+    /// is undefined unless `0 <= numBytes` and `0 <= offset`.  Note that on
+    /// Posix, if `descriptor` was opened in append mode, the data is written
+    /// at the end of the file regardless of `offset`.
+    static int pwrite(FileDescriptor  descriptor,
+                      const void     *buffer,
+                      int             numBytes,
+                      Offset          offset);
+
+    /// Write, beginning at the file pointer of the file with the specified
+    /// `descriptor`, the contents of the sequence of the specified
+    /// `numBuffers` buffers starting at the specified `buffers`, in order.
+    /// Return the total number of bytes written, which is less than the
+    /// total length of the buffers only if space was exhausted or an error
+    /// occurred after some bytes were written, or a negative value if an
+    /// error occurred before any bytes were written.  The behavior is
+    /// undefined unless `0 <= numBuffers` and each of the buffers has a
+    /// non-negative length.
+    static Offset writev(FileDescriptor  descriptor,
+                         const IoBuffer *buffers,
+                         int             numBuffers);
+
     /// Grow the file with the specified `descriptor` to the size of at
     /// least the specified `size` bytes.  Return 0 on success, and a
     /// non-zero value otherwise.  If the optionally specified `reserveFlag`
@@ -1437,6 +1546,12 @@ bsl::ostream& operator<<(bsl::ostream&                      stream,
 bsl::ostream& operator<<(bsl::ostream&                      stream,
                          FilesystemUtil::FileTruncatePolicy value);
 
+/// Output the specified `value` to the specified `stream`, in
+/// human-readable form.  If `value` is not a valid `AccessAdvice` value,
+/// report that it is invalid and output it as an integer.
+bsl::ostream& operator<<(bsl::ostream&                      stream,
+                         FilesystemUtil::AccessAdvice       value);
+
 }  // close package namespace
 }  // close enterprise namespace
 
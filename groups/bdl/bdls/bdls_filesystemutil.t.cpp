@@ -137,6 +137,11 @@ using bsls::NameOf;
 // [31] int remove(STRING_TYPE);
 // [32] bool isSymbolicLink(STRING_TYPE);
 // [32] int getSymbolicLinkTarget(STRING_TYPE *, STRING_TYPE);
+// [34] int pread(FileDescriptor, void *, int, Offset);
+// [34] int pwrite(FileDescriptor, const void *, int, Offset);
+// [34] Offset readv(FileDescriptor, const IoBuffer *, int);
+// [34] Offset writev(FileDescriptor, const IoBuffer *, int);
+// [34] int adviseAccess(FileDescriptor, Offset, Offset, AccessAdvice);
 //
 // FREE OPERATORS
 // [27] ostream& operator<<(ostream&, Whence);
@@ -144,6 +149,7 @@ using bsls::NameOf;
 // [27] ostream& operator<<(ostream&, FileOpenPolicy);
 // [27] ostream& operator<<(ostream&, FileIOPolicy);
 // [27] ostream& operator<<(ostream&, FileTruncatePolicy);
+// [27] ostream& operator<<(ostream&, AccessAdvice);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [17] CONCERN: Open in append-mode behavior (particularly on windows)
@@ -156,8 +162,8 @@ using bsls::NameOf;
 // [21] CONCERN: error codes for `createDirectories`
 // [21] CONCERN: error codes for `createPrivateDirectory`
 // [33] TESTING REMOVE UNIX SOCKET
-// [35] TESTING USAGE EXAMPLE 2
-// [34] TESTING USAGE EXAMPLE 1
+// [36] TESTING USAGE EXAMPLE 2
+// [35] TESTING USAGE EXAMPLE 1
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -4618,7 +4624,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == Obj::setWorkingDirectory(tmpWorkingDir));
 
     switch(test) { case 0:
-      case 35: {
+      case 36: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
         //
@@ -4703,7 +4709,7 @@ int main(int argc, char *argv[])
         ASSERT(0 == bdls::PathUtil::popLeaf(&logPath));
         ASSERT(0 == Obj::remove(logPath.c_str(), true));
       } break;
-      case 34: {
+      case 35: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -4822,6 +4828,280 @@ int main(int argc, char *argv[])
         ASSERT(0 == bdls::PathUtil::popLeaf(&logPath));
         ASSERT(0 == Obj::remove(logPath.c_str(), true));
       } break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // TESTING POSITIONAL AND VECTORED I/O
+        //
+        // Concerns:
+        // 1. `pwrite` writes at the specified offset, and `pread` reads from
+        //    the specified offset, returning the number of bytes transferred
+        //    (fewer than requested at the end of the file).
+        //
+        // 2. On Posix, `pread` and `pwrite` do not move the file pointer.
+        //
+        // 3. `writev` writes the buffers in order, at the file pointer,
+        //    including when there are more buffers than can be passed to a
+        //    single system call, and ignores empty buffers.
+        //
+        // 4. `readv` fills the buffers in order, from the file pointer, and
+        //    stops at the end of the file, returning the number of bytes
+        //    read.
+        //
+        // 5. `adviseAccess` accepts every `AccessAdvice` value.
+        //
+        // 6. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Create a file and write a pattern to it with `pwrite` at
+        //    scattered offsets; read the pattern back with `pread`, and also
+        //    attempt to read past the end of the file.  Check the file
+        //    pointer after each call.  (C-1..2)
+        //
+        // 2. For several numbers of buffers (up to several hundred) of
+        //    various lengths (including 0), write a pattern to a file with
+        //    `writev`, read it back with `read`, then read it again with
+        //    `readv` into buffers whose total length exceeds the file size.
+        //    (C-3..4)
+        //
+        // 3. Call `adviseAccess` with every advice value.  (C-5)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int pread(FileDescriptor, void *, int, Offset);
+        //   int pwrite(FileDescriptor, const void *, int, Offset);
+        //   Offset readv(FileDescriptor, const IoBuffer *, int);
+        //   Offset writev(FileDescriptor, const IoBuffer *, int);
+        //   int adviseAccess(FileDescriptor, Offset, Offset, AccessAdvice);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING POSITIONAL AND VECTORED I/O\n"
+                             "===================================\n";
+
+        typedef Obj::IoBuffer IoBuffer;
+
+        const char *fileName = "ioTest";
+
+        if (verbose) cout << "Testing `pread` and `pwrite`\n";
+        {
+            Obj::FileDescriptor fd = Obj::open(fileName,
+                                               Obj::e_OPEN_OR_CREATE,
+                                               Obj::e_READ_WRITE,
+                                               Obj::e_TRUNCATE);
+            ASSERT(Obj::k_INVALID_FD != fd);
+
+            // Write 8 blocks of 100 bytes in a scrambled order.
+
+            enum { k_BLOCK = 100, k_NUM_BLOCKS = 8 };
+
+            static const int ORDER[k_NUM_BLOCKS] = { 5, 0, 7, 2, 6, 1, 3, 4 };
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                char block[k_BLOCK];
+                bsl::memset(block, 'a' + ORDER[i], sizeof block);
+
+                int rc = Obj::pwrite(fd,
+                                     block,
+                                     k_BLOCK,
+                                     ORDER[i] * k_BLOCK);
+                ASSERTV(i, rc, k_BLOCK == rc);
+#ifdef BSLS_PLATFORM_OS_UNIX
+                ASSERTV(i, 0 == Obj::seek(fd, 0, Obj::e_SEEK_FROM_CURRENT));
+#endif
+            }
+            ASSERT(k_NUM_BLOCKS * k_BLOCK == Obj::getFileSize(fd));
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                char block[k_BLOCK + 1];
+                int  rc = Obj::pread(fd, block, k_BLOCK, i * k_BLOCK);
+                ASSERTV(i, rc, k_BLOCK == rc);
+                for (int j = 0; j < k_BLOCK; ++j) {
+                    ASSERTV(i, j, block[j], 'a' + i == block[j]);
+                }
+#ifdef BSLS_PLATFORM_OS_UNIX
+                ASSERTV(i, 0 == Obj::seek(fd, 0, Obj::e_SEEK_FROM_CURRENT));
+#endif
+            }
+
+            // Read across, and beyond, the end of the file.
+
+            char buffer[k_BLOCK];
+            int  rc = Obj::pread(fd,
+                                 buffer,
+                                 k_BLOCK,
+                                 k_NUM_BLOCKS * k_BLOCK - 10);
+            ASSERTV(rc, 10 == rc);
+            ASSERT('a' + k_NUM_BLOCKS - 1 == buffer[0]);
+
+            rc = Obj::pread(fd, buffer, k_BLOCK, 10 * k_NUM_BLOCKS * k_BLOCK);
+            ASSERTV(rc, 0 == rc);
+
+            ASSERT(0 == Obj::close(fd));
+            ASSERT(0 == Obj::remove(fileName));
+        }
+
+        if (verbose) cout << "Testing `readv` and `writev`\n";
+        {
+            static const int NUM_BUFFERS[] = { 0, 1, 2, 3, 64, 65, 200, 500 };
+            const int        NUM_DATA = sizeof NUM_BUFFERS /
+                                                         sizeof *NUM_BUFFERS;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int NUM = NUM_BUFFERS[ti];
+
+                if (veryVerbose) P(NUM);
+
+                // Buffer 'i' has length 'i % 7 * 13', so that some buffers
+                // are empty, and contains bytes that depend on their position
+                // in the file.
+
+                bsl::vector<IoBuffer> buffers(NUM);
+                bsl::vector<char>     data;
+                for (int i = 0; i < NUM; ++i) {
+                    const int length = i % 7 * 13;
+                    for (int j = 0; j < length; ++j) {
+                        data.push_back(static_cast<char>(data.size() * 7 + i));
+                    }
+                    buffers[i].d_length = length;
+                }
+                const int TOTAL = static_cast<int>(data.size());
+
+                bsl::vector<char> source(data);
+                for (int i = 0, offset = 0; i < NUM; ++i) {
+                    buffers[i].d_buffer_p = source.data() + offset;
+                    offset += buffers[i].d_length;
+                }
+
+                Obj::FileDescriptor fd = Obj::open(fileName,
+                                                   Obj::e_OPEN_OR_CREATE,
+                                                   Obj::e_READ_WRITE,
+                                                   Obj::e_TRUNCATE);
+                ASSERT(Obj::k_INVALID_FD != fd);
+
+                // Start the write after a prefix, to verify that 'writev'
+                // uses the file pointer.
+
+                ASSERT(3 == Obj::write(fd, "xyz", 3));
+
+                Obj::Offset rc = Obj::writev(fd, buffers.data(), NUM);
+                ASSERTV(NUM, rc, TOTAL, TOTAL == rc);
+                ASSERTV(NUM, 3 + TOTAL == Obj::getFileSize(fd));
+                ASSERTV(NUM, 3 + TOTAL == Obj::seek(fd,
+                                                    0,
+                                                    Obj::e_SEEK_FROM_CURRENT));
+
+                bsl::vector<char> readBack(TOTAL + 1);
+                ASSERT(3 == Obj::seek(fd, 3, Obj::e_SEEK_FROM_BEGINNING));
+                ASSERTV(NUM, TOTAL == Obj::read(fd,
+                                                readBack.data(),
+                                                TOTAL + 1));
+                ASSERTV(NUM, 0 == TOTAL ||
+                           0 == bsl::memcmp(readBack.data(),
+                                            data.data(),
+                                            TOTAL));
+
+                // Read into the same buffers followed by an extra buffer, so
+                // that the end of the file is reached.
+
+                bsl::vector<char> target(TOTAL + 100, '\0');
+                for (int i = 0, offset = 0; i < NUM; ++i) {
+                    buffers[i].d_buffer_p = target.data() + offset;
+                    offset += buffers[i].d_length;
+                }
+                IoBuffer extra = { target.data() + TOTAL, 100 };
+                buffers.push_back(extra);
+
+                ASSERT(3 == Obj::seek(fd, 3, Obj::e_SEEK_FROM_BEGINNING));
+                rc = Obj::readv(fd, buffers.data(), NUM + 1);
+                ASSERTV(NUM, rc, TOTAL, TOTAL == rc);
+                ASSERTV(NUM, 0 == TOTAL ||
+                           0 == bsl::memcmp(target.data(),
+                                            data.data(),
+                                            TOTAL));
+                ASSERTV(NUM, '\0' == target[TOTAL]);
+
+                // At the end of the file, 'readv' reads nothing.
+
+                rc = Obj::readv(fd, buffers.data(), NUM + 1);
+                ASSERTV(NUM, rc, 0 == rc);
+
+                ASSERT(0 == Obj::close(fd));
+                ASSERT(0 == Obj::remove(fileName));
+            }
+        }
+
+        if (verbose) cout << "Testing `adviseAccess`\n";
+        {
+            Obj::FileDescriptor fd = Obj::open(fileName,
+                                               Obj::e_OPEN_OR_CREATE,
+                                               Obj::e_READ_WRITE,
+                                               Obj::e_TRUNCATE);
+            ASSERT(Obj::k_INVALID_FD != fd);
+            ASSERT(5 == Obj::write(fd, "hello", 5));
+
+            static const Obj::AccessAdvice ADVICE[] = {
+                Obj::e_ADVICE_NORMAL,
+                Obj::e_ADVICE_SEQUENTIAL,
+                Obj::e_ADVICE_RANDOM,
+                Obj::e_ADVICE_WILL_NEED,
+                Obj::e_ADVICE_DONT_NEED
+            };
+            const int NUM_ADVICE = sizeof ADVICE / sizeof *ADVICE;
+
+            for (int i = 0; i < NUM_ADVICE; ++i) {
+                const Obj::AccessAdvice A = ADVICE[i];
+
+                ASSERTV(A, 0 == Obj::adviseAccess(fd, 0, 0, A));
+                ASSERTV(A, 0 == Obj::adviseAccess(fd, 1, 3, A));
+            }
+
+            ASSERT(0 == Obj::close(fd));
+            ASSERT(0 == Obj::remove(fileName));
+        }
+
+        if (verbose) cout << "Negative testing\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj::FileDescriptor fd = Obj::open(fileName,
+                                               Obj::e_OPEN_OR_CREATE,
+                                               Obj::e_READ_WRITE,
+                                               Obj::e_TRUNCATE);
+            ASSERT(Obj::k_INVALID_FD != fd);
+
+            char     buffer[4];
+            IoBuffer ioBuffer = { buffer, 4 };
+
+            ASSERT_PASS(Obj::pread(fd, buffer, 4, 0));
+            ASSERT_FAIL(Obj::pread(fd, 0, 4, 0));
+            ASSERT_FAIL(Obj::pread(fd, buffer, -1, 0));
+            ASSERT_FAIL(Obj::pread(fd, buffer, 4, -1));
+
+            ASSERT_PASS(Obj::pwrite(fd, buffer, 4, 0));
+            ASSERT_FAIL(Obj::pwrite(fd, 0, 4, 0));
+            ASSERT_FAIL(Obj::pwrite(fd, buffer, -1, 0));
+            ASSERT_FAIL(Obj::pwrite(fd, buffer, 4, -1));
+
+            ASSERT_PASS(Obj::writev(fd, &ioBuffer, 1));
+            ASSERT_PASS(Obj::writev(fd, 0, 0));
+            ASSERT_FAIL(Obj::writev(fd, 0, 1));
+            ASSERT_FAIL(Obj::writev(fd, &ioBuffer, -1));
+
+            ASSERT_PASS(Obj::readv(fd, &ioBuffer, 1));
+            ASSERT_PASS(Obj::readv(fd, 0, 0));
+            ASSERT_FAIL(Obj::readv(fd, 0, 1));
+            ASSERT_FAIL(Obj::readv(fd, &ioBuffer, -1));
+
+            ASSERT_PASS(Obj::adviseAccess(fd, 0, 0, Obj::e_ADVICE_NORMAL));
+            ASSERT_FAIL(Obj::adviseAccess(fd, -1, 0, Obj::e_ADVICE_NORMAL));
+            ASSERT_FAIL(Obj::adviseAccess(fd, 0, -1, Obj::e_ADVICE_NORMAL));
+
+            ASSERT(0 == Obj::close(fd));
+            ASSERT(0 == Obj::remove(fileName));
+        }
+      } break;
       case 33: {
         // --------------------------------------------------------------------
         // TESTING REMOVE UNIX SOCKET (DRQS 176123156)
@@ -5475,6 +5755,7 @@ int main(int argc, char *argv[])
         //   ostream& operator<<(ostream&, FileOpenPolicy);
         //   ostream& operator<<(ostream&, FileIOPolicy);
         //   ostream& operator<<(ostream&, FileTruncatePolicy);
+        //   ostream& operator<<(ostream&, AccessAdvice);
         // --------------------------------------------------------------------
 
         bsl::ostringstream oss;
@@ -5509,6 +5790,12 @@ int main(int argc, char *argv[])
 
         STEST(e_, TRUNCATE);
         STEST(e_, KEEP);
+
+        STEST(e_, ADVICE_NORMAL);
+        STEST(e_, ADVICE_SEQUENTIAL);
+        STEST(e_, ADVICE_RANDOM);
+        STEST(e_, ADVICE_WILL_NEED);
+        STEST(e_, ADVICE_DONT_NEED);
 #undef  STEST
 
 #undef  BADTEST
@@ -5533,6 +5820,7 @@ int main(int argc, char *argv[])
         BADTEST(FileOpenPolicy);
         BADTEST(FileIOPolicy);
         BADTEST(FileTruncatePolicy);
+        BADTEST(AccessAdvice);
 # endif
 #undef  BADTEST
       } break;
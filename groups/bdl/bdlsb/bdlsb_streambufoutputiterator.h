@@ -0,0 +1,299 @@
+// bdlsb_streambufoutputiterator.h                                    -*-C++-*-
+#ifndef INCLUDED_BDLSB_STREAMBUFOUTPUTITERATOR
+#define INCLUDED_BDLSB_STREAMBUFOUTPUTITERATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an output iterator writing spans to a stream buffer.
+//
+//@CLASSES:
+//  bdlsb::StreamBufOutputIterator: output iterator over a stream buffer
+//
+//@SEE_ALSO: bdlsb_memoutstreambuf, bdlbb_blobstreambuf, bslfmt_putrangeutil
+//
+//@DESCRIPTION: This component provides an output iterator class template,
+// `bdlsb::StreamBufOutputIterator`, that writes characters to a stream
+// buffer.  It is similar to `bsl::ostreambuf_iterator`, but differs in two
+// ways:
+//
+// * It has the `bslfmt::HasPutRange` trait, so a contiguous span of
+//   characters written through it by the `bslfmt` formatting functions (or by
+//   `bslfmt::PutRangeUtil::copy`) is handed to the stream buffer in a single
+//   `sputn` call.  Stream buffers that hold their data in chunks, such as
+//   `bdlsb::MemOutStreamBuf` or `bdlbb::OutBlobStreamBuf`, copy such a span
+//   with one `memcpy` per chunk.
+//
+// * It is a template on the type of the stream buffer, so it can be used
+//   with the non-virtual stream buffers of this package, such as
+//   `bdlsb::FixedMemOutput` and `bdlsb::OverflowMemOutput`, and, when used
+//   with a concrete `bsl::streambuf`-derived type, single characters are
+//   written without going through a `bsl::streambuf` pointer.
+//
+// Formatting to a `StreamBufOutputIterator` therefore writes directly into
+// the buffers of the stream buffer, without first formatting into an
+// intermediate string.
+//
+// As with `bsl::ostreambuf_iterator`, once a write has failed (e.g., because
+// a fixed-size buffer is full) all subsequent writes through the iterator
+// are ignored, and `failed` returns `true`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting into a Stream Buffer
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are building a message in a `bdlsb::MemOutStreamBuf`, and want to
+// format values into it without going through a temporary string.
+//
+// First, we create the stream buffer:
+// ```
+// bdlsb::MemOutStreamBuf streamBuf;
+// ```
+// Then, we format into it through a `StreamBufOutputIterator`:
+// ```
+// typedef bdlsb::StreamBufOutputIterator<bdlsb::MemOutStreamBuf> Iterator;
+//
+// Iterator it(&streamBuf);
+// it = bsl::format_to(it, "order {} for {} shares of {}", 1017, 250, "IBM");
+// ```
+// Finally, we check the contents of the stream buffer:
+// ```
+// assert(!it.failed());
+// assert("order 1017 for 250 shares of IBM" ==
+//        bsl::string_view(streamBuf.data(), streamBuf.length()));
+// ```
+//
+///Example 2: Detecting a Full Buffer
+/// - - - - - - - - - - - - - - - - -
+// Suppose we format into a fixed-size buffer that turns out to be too small.
+// The iterator records the failure, and the output is truncated:
+// ```
+// char                  buffer[8];
+// bdlsb::FixedMemOutput output(buffer, sizeof buffer);
+//
+// bdlsb::StreamBufOutputIterator<bdlsb::FixedMemOutput> out(&output);
+// out = bsl::format_to(out, "{}-{}", "abcdef", 12345);
+//
+// assert(out.failed());
+// assert(8 == output.length());
+// assert(0 == bsl::memcmp(buffer, "abcdef-1", 8));
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bslfmt_putrangeutil.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_ios.h>  // 'bsl::streamsize'
+#include <bsl_iterator.h>
+#include <bsl_streambuf.h>
+
+namespace BloombergLP {
+namespace bdlsb {
+
+                       // =============================
+                       // class StreamBufOutputIterator
+                       // =============================
+
+/// This class template provides an output iterator writing `char` values to
+/// a stream buffer of the (template parameter) type `t_STREAMBUF`, which is
+/// `bsl::streambuf` or a type providing the `sputc` and `sputn` methods and
+/// the `traits_type` type of the `bsl::streambuf` interface.  Spans written
+/// with `putRange` are passed to the stream buffer in a single `sputn` call.
+template <class t_STREAMBUF = bsl::streambuf>
+class StreamBufOutputIterator {
+
+    // PRIVATE TYPES
+    typedef typename t_STREAMBUF::traits_type TraitsType;
+
+    // DATA
+    t_STREAMBUF *d_streamBuf_p;  // target stream buffer (held, not owned)
+    bool         d_failed;       // `true` once a write has failed
+
+  public:
+    // TYPES
+    typedef bsl::output_iterator_tag iterator_category;
+    typedef void                     value_type;
+    typedef bsl::ptrdiff_t           difference_type;
+    typedef void                     pointer;
+    typedef void                     reference;
+
+    typedef char                     char_type;
+    typedef t_STREAMBUF              streambuf_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StreamBufOutputIterator,
+                                   bslfmt::HasPutRange);
+
+    // CREATORS
+
+    /// Create an iterator that does not refer to a stream buffer.  Writes
+    /// through the created iterator are ignored, and `failed` returns
+    /// `true`.
+    StreamBufOutputIterator();
+
+    /// Create an iterator writing to the specified `streamBuf`.  The
+    /// behavior is undefined unless `streamBuf` is not null.
+    explicit StreamBufOutputIterator(t_STREAMBUF *streamBuf);
+
+    //! StreamBufOutputIterator(const StreamBufOutputIterator&) = default;
+    //! ~StreamBufOutputIterator() = default;
+
+    // MANIPULATORS
+    //! StreamBufOutputIterator& operator=(const StreamBufOutputIterator&) =
+    //!                                                                default;
+
+    /// Write the specified `c` to the stream buffer unless a previous write
+    /// through this iterator has failed, and return a reference providing
+    /// modifiable access to this iterator.  If the stream buffer fails to
+    /// accept `c`, subsequent writes are ignored.
+    StreamBufOutputIterator& operator=(char c);
+
+    /// Return a reference providing modifiable access to this iterator.
+    StreamBufOutputIterator& operator*();
+
+    /// Do nothing, and return a reference providing modifiable access to
+    /// this iterator.
+    StreamBufOutputIterator& operator++();
+
+    /// Do nothing, and return a reference providing modifiable access to
+    /// this iterator.
+    StreamBufOutputIterator& operator++(int);
+
+    /// Write the characters in the specified range [`begin`, `end`) to the
+    /// stream buffer with a single call to its `sputn` method, unless a
+    /// previous write through this iterator has failed.  If the stream
+    /// buffer accepts fewer than `end - begin` characters, subsequent writes
+    /// are ignored.  The behavior is undefined unless `begin <= end`.
+    void putRange(const char *begin, const char *end);
+
+    // ACCESSORS
+
+    /// Return `true` if a write through this iterator has failed, or if this
+    /// iterator does not refer to a stream buffer, and `false` otherwise.
+    bool failed() const;
+
+    /// Return the address of the stream buffer written through this
+    /// iterator, or 0 if it does not refer to one.
+    t_STREAMBUF *streamBuf() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class StreamBufOutputIterator
+                       // -----------------------------
+
+// CREATORS
+template <class t_STREAMBUF>
+inline
+StreamBufOutputIterator<t_STREAMBUF>::StreamBufOutputIterator()
+: d_streamBuf_p(0)
+, d_failed(true)
+{
+}
+
+template <class t_STREAMBUF>
+inline
+StreamBufOutputIterator<t_STREAMBUF>::StreamBufOutputIterator(
+                                                        t_STREAMBUF *streamBuf)
+: d_streamBuf_p(streamBuf)
+, d_failed(false)
+{
+    BSLS_ASSERT(streamBuf);
+}
+
+// MANIPULATORS
+template <class t_STREAMBUF>
+inline
+StreamBufOutputIterator<t_STREAMBUF>&
+StreamBufOutputIterator<t_STREAMBUF>::operator=(char c)
+{
+    if (!d_failed && TraitsType::eq_int_type(TraitsType::eof(),
+                                             d_streamBuf_p->sputc(c))) {
+        d_failed = true;
+    }
+    return *this;
+}
+
+template <class t_STREAMBUF>
+inline
+StreamBufOutputIterator<t_STREAMBUF>&
+StreamBufOutputIterator<t_STREAMBUF>::operator*()
+{
+    return *this;
+}
+
+template <class t_STREAMBUF>
+inline
+StreamBufOutputIterator<t_STREAMBUF>&
+StreamBufOutputIterator<t_STREAMBUF>::operator++()
+{
+    return *this;
+}
+
+template <class t_STREAMBUF>
+inline
+StreamBufOutputIterator<t_STREAMBUF>&
+StreamBufOutputIterator<t_STREAMBUF>::operator++(int)
+{
+    return *this;
+}
+
+template <class t_STREAMBUF>
+inline
+void StreamBufOutputIterator<t_STREAMBUF>::putRange(const char *begin,
+                                                    const char *end)
+{
+    BSLS_ASSERT(begin <= end);
+
+    const bsl::streamsize length = end - begin;
+    if (!d_failed && length != d_streamBuf_p->sputn(begin, length)) {
+        d_failed = true;
+    }
+}
+
+// ACCESSORS
+template <class t_STREAMBUF>
+inline
+bool StreamBufOutputIterator<t_STREAMBUF>::failed() const
+{
+    return d_failed;
+}
+
+template <class t_STREAMBUF>
+inline
+t_STREAMBUF *StreamBufOutputIterator<t_STREAMBUF>::streamBuf() const
+{
+    return d_streamBuf_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,690 @@
+// bdlsb_streambufoutputiterator.t.cpp                                -*-C++-*-
+#include <bdlsb_streambufoutputiterator.h>
+
+#include <bdlsb_fixedmemoutput.h>
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+#include <bdlsb_overflowmemoutput.h>
+
+#include <bslfmt_putrangeutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_format.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                   TEST PLAN
+// ----------------------------------------------------------------------------
+//                                   Overview
+//                                   --------
+// The component under test is an output iterator over a stream buffer.  We
+// check that single characters are written with `sputc` and spans with a
+// single `sputn`, using a stream buffer that counts the calls it receives,
+// and that a failed write is latched.  We then check that formatting through
+// the iterator into the stream buffers of this package produces the same
+// text as formatting into a string.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] StreamBufOutputIterator();
+// [ 2] explicit StreamBufOutputIterator(t_STREAMBUF *streamBuf);
+//
+// MANIPULATORS
+// [ 3] StreamBufOutputIterator& operator=(char c);
+// [ 3] StreamBufOutputIterator& operator*();
+// [ 3] StreamBufOutputIterator& operator++();
+// [ 3] StreamBufOutputIterator& operator++(int);
+// [ 4] void putRange(const char *begin, const char *end);
+//
+// ACCESSORS
+// [ 2] bool failed() const;
+// [ 2] t_STREAMBUF *streamBuf() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: FORMATTING INTO STREAM BUFFERS
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+#define ASSERT_OPT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS_RAW(EXPR)
+#define ASSERT_OPT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlsb::StreamBufOutputIterator<>                       Obj;
+typedef bdlsb::StreamBufOutputIterator<bdlsb::FixedMemOutput> FixedObj;
+
+// ============================================================================
+//                     GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// This stream buffer appends to a string, accepting at most a given number
+/// of characters, and counts the calls to `overflow` and `xsputn`.  It has
+/// no put area, so every `sputc` call results in a call to `overflow`.
+class CountingStreamBuf : public bsl::streambuf {
+    // DATA
+    bsl::string d_data;
+    int         d_limit;
+    int         d_numOverflows;
+    int         d_numXsputns;
+
+  protected:
+    // PROTECTED MANIPULATORS
+    int_type overflow(int_type c) BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numOverflows;
+        if (traits_type::eq_int_type(traits_type::eof(), c)) {
+            return traits_type::not_eof(c);                           // RETURN
+        }
+        if (static_cast<int>(d_data.size()) == d_limit) {
+            return traits_type::eof();                                // RETURN
+        }
+        d_data.push_back(traits_type::to_char_type(c));
+        return c;
+    }
+
+    bsl::streamsize xsputn(const char      *s,
+                           bsl::streamsize  n) BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numXsputns;
+        const bsl::streamsize room  = d_limit - d_data.size();
+        const bsl::streamsize count = bsl::min(room, n);
+        d_data.append(s, static_cast<bsl::size_t>(count));
+        return count;
+    }
+
+  public:
+    // CREATORS
+    explicit CountingStreamBuf(int limit = 1 << 20)
+    : d_limit(limit)
+    , d_numOverflows(0)
+    , d_numXsputns(0)
+    {
+    }
+
+    // ACCESSORS
+    const bsl::string& data() const { return d_data; }
+    int numOverflows() const { return d_numOverflows; }
+    int numXsputns() const { return d_numXsputns; }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Formatting into a Stream Buffer
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are building a message in a `bdlsb::MemOutStreamBuf`, and want to
+// format values into it without going through a temporary string.
+//
+// First, we create the stream buffer:
+// ```
+        bdlsb::MemOutStreamBuf streamBuf;
+// ```
+// Then, we format into it through a `StreamBufOutputIterator`:
+// ```
+        typedef bdlsb::StreamBufOutputIterator<bdlsb::MemOutStreamBuf>
+                                                                      Iterator;
+
+        Iterator it(&streamBuf);
+        it = bsl::format_to(it, "order {} for {} shares of {}", 1017, 250,
+                            "IBM");
+// ```
+// Finally, we check the contents of the stream buffer:
+// ```
+        ASSERT(!it.failed());
+        ASSERT("order 1017 for 250 shares of IBM" ==
+               bsl::string_view(streamBuf.data(), streamBuf.length()));
+// ```
+//
+///Example 2: Detecting a Full Buffer
+/// - - - - - - - - - - - - - - - - -
+// Suppose we format into a fixed-size buffer that turns out to be too small.
+// The iterator records the failure, and the output is truncated:
+// ```
+        char                  buffer[8];
+        bdlsb::FixedMemOutput output(buffer, sizeof buffer);
+
+        bdlsb::StreamBufOutputIterator<bdlsb::FixedMemOutput> out(&output);
+        out = bsl::format_to(out, "{}-{}", "abcdef", 12345);
+
+        ASSERT(out.failed());
+        ASSERT(8 == output.length());
+        ASSERT(0 == bsl::memcmp(buffer, "abcdef-1", 8));
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: FORMATTING INTO STREAM BUFFERS
+        //
+        // Concerns:
+        // 1. Formatting through the iterator into each stream buffer of this
+        //    package, and into a `bsl::streambuf` accessed by base pointer,
+        //    produces the same text as formatting into a string.
+        //
+        // 2. When formatting with `bslfmt`, literal text and the bodies of
+        //    strings and integers reach the stream buffer through `sputn`.
+        //
+        // Plan:
+        // 1. For a table of format strings, format the same arguments into a
+        //    string and, through the iterator, into each kind of stream
+        //    buffer, and compare.  (C-1)
+        //
+        // 2. Format into a `CountingStreamBuf` and check that no character was
+        //    written individually.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: FORMATTING INTO STREAM BUFFERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: FORMATTING INTO STREAM BUFFERS" << endl
+                          << "=======================================" << endl;
+
+        static const struct {
+            int         d_line;   // source line number
+            const char *d_fmt_p;  // format string
+        } DATA[] = {
+            //LINE  FORMAT
+            //----  -------------------------------------------------------
+            { L_,   ""                                                      },
+            { L_,   "plain literal text"                                    },
+            { L_,   "{} {} {}"                                              },
+            { L_,   "id={0} name='{1}' ratio={2:.3f} id again={0:#x}"       },
+            { L_,   "[{1:>12}] [{0:<8}] [{2:^11.2e}]"                       },
+            { L_,   "{{escaped}} {1}{1}{1}{1}{1}{1}{1}{1}{1}{1}{1}{1}{1}{1}" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int    ID    = 123456;
+        const char  *NAME  = "a rather long name to cross chunk boundaries";
+        const double RATIO = 3.14159;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const FMT  = DATA[ti].d_fmt_p;
+
+            if (veryVerbose) { T_ P_(LINE) P(FMT) }
+
+            const bsl::string EXP = bsl::vformat(
+                                    FMT,
+                                    bsl::make_format_args(ID, NAME, RATIO));
+
+            {
+                typedef bdlsb::MemOutStreamBuf Buffer;
+
+                Buffer                                 sb;
+                bdlsb::StreamBufOutputIterator<Buffer> it(&sb);
+
+                bsl::vformat_to(it,
+                                FMT,
+                                bsl::make_format_args(ID, NAME, RATIO));
+                ASSERTV(LINE, EXP == bsl::string_view(sb.data(),
+                                                      sb.length()));
+            }
+            {
+                bsl::stringbuf  sb;
+                bsl::streambuf *base = &sb;
+                Obj             it(base);
+                bsl::vformat_to(it,
+                                FMT,
+                                bsl::make_format_args(ID, NAME, RATIO));
+                ASSERTV(LINE, EXP == sb.str());
+            }
+            {
+                typedef bdlsb::OverflowMemOutput Buffer;
+
+                char                                   buffer[8];
+                Buffer                                 sb(buffer,
+                                                          sizeof buffer);
+                bdlsb::StreamBufOutputIterator<Buffer> it(&sb);
+
+                bsl::vformat_to(it,
+                                FMT,
+                                bsl::make_format_args(ID, NAME, RATIO));
+
+                const bsl::size_t inBuffer = bsl::min<bsl::size_t>(
+                                                           sizeof buffer,
+                                                           sb.dataLength());
+                bsl::string actual(buffer, inBuffer);
+                actual.append(sb.overflowBuffer(),
+                              sb.dataLengthInOverflowBuffer());
+                ASSERTV(LINE, EXP == actual);
+            }
+            {
+                typedef bdlsb::FixedMemOutStreamBuf Buffer;
+
+                char                                   buffer[1024];
+                Buffer                                 sb(buffer,
+                                                          sizeof buffer);
+                bdlsb::StreamBufOutputIterator<Buffer> it(&sb);
+
+                bsl::vformat_to(it,
+                                FMT,
+                                bsl::make_format_args(ID, NAME, RATIO));
+                ASSERTV(LINE, EXP == bsl::string_view(sb.data(),
+                                                      sb.length()));
+            }
+        }
+
+#if !defined(BSLS_LIBRARYFEATURES_HAS_CPP20_FORMAT)
+        if (verbose) cout << "\tSpans reach `sputn`." << endl;
+        {
+            CountingStreamBuf sb;
+            bsl::format_to(Obj(&sb), "id={} name={} end", ID, NAME);
+
+            ASSERTV(sb.data(), bsl::string("id=123456 name=") + NAME + " end"
+                                                                 == sb.data());
+            ASSERTV(sb.numOverflows(), 0 == sb.numOverflows());
+            ASSERTV(sb.numXsputns(),   5 == sb.numXsputns());
+        }
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `putRange`
+        //
+        // Concerns:
+        // 1. `putRange` writes the whole range to the stream buffer with a
+        //    single `sputn` call, including for an empty range.
+        //
+        // 2. If the stream buffer accepts only part of the range, the
+        //    iterator is marked as failed and subsequent writes, by either
+        //    `putRange` or assignment, are ignored.
+        //
+        // 3. `bslfmt::PutRangeUtil::copy` uses `putRange`.
+        //
+        // 4. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Write ranges to a `CountingStreamBuf`, some of which do not fit,
+        //    and check the data, the calls received and `failed`.  (C-1..3)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid ranges.  (C-4)
+        //
+        // Testing:
+        //   void putRange(const char *begin, const char *end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `putRange`" << endl
+                          << "==================" << endl;
+
+        const char SRC[] = "0123456789";
+
+        for (int len = 0; len <= 10; ++len) {
+            for (int limit = 0; limit <= 10; ++limit) {
+                if (veryVerbose) { T_ P_(len) P(limit) }
+
+                CountingStreamBuf sb(limit);
+                Obj               mX(&sb);  const Obj& X = mX;
+
+                mX.putRange(SRC, SRC + len);
+
+                const int written = bsl::min(len, limit);
+                ASSERTV(len, limit, bsl::string(SRC, written) == sb.data());
+                ASSERTV(len, limit, 1 == sb.numXsputns());
+                ASSERTV(len, limit, 0 == sb.numOverflows());
+                ASSERTV(len, limit, (len > limit) == X.failed());
+
+                // A failed iterator ignores further writes; otherwise, each
+                // write reaches the stream buffer until one fails.
+
+                mX.putRange(SRC, SRC + 1);
+                mX = 'x';
+
+                if (len > limit) {
+                    ASSERTV(len, limit, 1 == sb.numXsputns());
+                    ASSERTV(len, limit, 0 == sb.numOverflows());
+                }
+                else {
+                    ASSERTV(len, limit, 2 == sb.numXsputns());
+                    ASSERTV(len, limit, (len < limit ? 1 : 0) ==
+                                                         sb.numOverflows());
+                }
+                ASSERTV(len, limit, (len + 2 > limit) == X.failed());
+                const int size = static_cast<int>(sb.data().size());
+                ASSERTV(len, limit, bsl::min(len + 2, limit) == size);
+            }
+        }
+
+        if (verbose) cout << "\tUsing `bslfmt::PutRangeUtil::copy`." << endl;
+        {
+            CountingStreamBuf sb;
+
+            Obj mX = bslfmt::PutRangeUtil::copy(SRC, SRC + 10, Obj(&sb));
+            ASSERT(!mX.failed());
+            ASSERT(SRC == sb.data());
+            ASSERT(1   == sb.numXsputns());
+            ASSERT(0   == sb.numOverflows());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            CountingStreamBuf sb;
+            Obj               mX(&sb);
+
+            ASSERT_PASS(mX.putRange(SRC, SRC));
+            ASSERT_PASS(mX.putRange(SRC, SRC + 1));
+            ASSERT_FAIL(mX.putRange(SRC + 1, SRC));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING SINGLE-CHARACTER OUTPUT
+        //
+        // Concerns:
+        // 1. Assigning a character through the iterator writes it to the
+        //    stream buffer with `sputc`.
+        //
+        // 2. `operator*` and both increment operators return a reference to
+        //    the iterator itself, and do not write anything.
+        //
+        // 3. Once the stream buffer refuses a character, the iterator is
+        //    marked as failed and no further characters are written.
+        //
+        // 4. The iterator can be used with stream buffers that do not derive
+        //    from `bsl::streambuf`.
+        //
+        // Plan:
+        // 1. Write characters one at a time through iterators over a
+        //    `CountingStreamBuf` and a `bdlsb::FixedMemOutput` with limited
+        //    room, checking the data and `failed` after each.  (C-1..4)
+        //
+        // Testing:
+        //   StreamBufOutputIterator& operator=(char c);
+        //   StreamBufOutputIterator& operator*();
+        //   StreamBufOutputIterator& operator++();
+        //   StreamBufOutputIterator& operator++(int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SINGLE-CHARACTER OUTPUT" << endl
+                          << "===============================" << endl;
+
+        {
+            CountingStreamBuf sb(3);
+            Obj               mX(&sb);  const Obj& X = mX;
+
+            ASSERT(&mX == &*mX);
+            ASSERT(&mX == &++mX);
+            ASSERT(&mX == &mX++);
+            ASSERT(0   == sb.numOverflows());
+
+            *mX++ = 'a';
+            *++mX = 'b';
+            mX    = 'c';
+            ASSERT("abc" == sb.data());
+            ASSERT(3     == sb.numOverflows());
+            ASSERT(!X.failed());
+
+            mX = 'd';
+            ASSERT("abc" == sb.data());
+            ASSERT(4     == sb.numOverflows());
+            ASSERT(X.failed());
+
+            mX = 'e';
+            ASSERT(4     == sb.numOverflows());
+            ASSERT(X.failed());
+        }
+        {
+            char                  buffer[4];
+            bdlsb::FixedMemOutput sb(buffer, sizeof buffer);
+            FixedObj              mX(&sb);  const FixedObj& X = mX;
+
+            const char *TEXT = "wxyz!?";
+            for (int i = 0; i < 6; ++i) {
+                *mX++ = TEXT[i];
+                ASSERTV(i, (i >= 4) == X.failed());
+            }
+            ASSERT(4 == sb.length());
+            ASSERT(0 == bsl::memcmp(buffer, "wxyz", 4));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. A default-constructed iterator refers to no stream buffer, is
+        //    failed, and ignores writes.
+        //
+        // 2. An iterator created from a stream buffer refers to it and is not
+        //    failed.
+        //
+        // 3. Copies refer to the same stream buffer and have the same failed
+        //    state.
+        //
+        // 4. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create iterators with each constructor and by copying, and check
+        //    the accessors.  (C-1..3)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a null stream buffer.  (C-4)
+        //
+        // Testing:
+        //   StreamBufOutputIterator();
+        //   explicit StreamBufOutputIterator(t_STREAMBUF *streamBuf);
+        //   bool failed() const;
+        //   t_STREAMBUF *streamBuf() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        ASSERT(bslfmt::HasPutRange<Obj>::value);
+        ASSERT(bslfmt::HasPutRange<FixedObj>::value);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == X.streamBuf());
+            ASSERT(X.failed());
+
+            mX = 'a';
+            mX.putRange("bc", "bc" + 2);
+            ASSERT(X.failed());
+        }
+        {
+            CountingStreamBuf sb;
+            const Obj         X(&sb);
+            ASSERT(&sb == X.streamBuf());
+            ASSERT(!X.failed());
+
+            const Obj Y(X);
+            ASSERT(&sb == Y.streamBuf());
+            ASSERT(!Y.failed());
+
+            Obj mZ;  const Obj& Z = mZ;
+            mZ = X;
+            ASSERT(&sb == Z.streamBuf());
+            ASSERT(!Z.failed());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            CountingStreamBuf sb;
+
+            ASSERT_PASS((Obj(&sb)));
+            ASSERT_FAIL((Obj(static_cast<bsl::streambuf *>(0))));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Write characters and a span to a `bdlsb::MemOutStreamBuf`
+        //    through the iterator.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bdlsb::MemOutStreamBuf sb;
+
+        bdlsb::StreamBufOutputIterator<bdlsb::MemOutStreamBuf> mX(&sb);
+
+        *mX++ = '<';
+        mX.putRange("hello", "hello" + 5);
+        *mX++ = '>';
+
+        ASSERT(!mX.failed());
+        ASSERT("<hello>" == bsl::string_view(sb.data(), sb.length()));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
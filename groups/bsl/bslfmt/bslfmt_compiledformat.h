@@ -0,0 +1,446 @@
+// bslfmt_compiledformat.h                                            -*-C++-*-
+
+#ifndef INCLUDED_BSLFMT_COMPILEDFORMAT
+#define INCLUDED_BSLFMT_COMPILEDFORMAT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a run-time format string split once for repeated use.
+//
+//@CLASSES:
+//  bslfmt::BasicCompiledFormat: format string pre-split for repeated use
+//  bslfmt::CompiledFormat: `BasicCompiledFormat<char>`
+//  bslfmt::WCompiledFormat: `BasicCompiledFormat<wchar_t>`
+//
+//@SEE_ALSO: bslfmt_format, bslfmt_formatstringparser
+//
+//@DESCRIPTION: This component provides a class template,
+// `BasicCompiledFormat`, holding a copy of a format string together with the
+// result of splitting it into literal text and replacement fields (see
+// `bslfmt_formatstringparser`).  Formatting with a `BasicCompiledFormat`
+// produces the same output as passing the same format string to
+// `bslfmt::vformat`, but does not re-scan the string on every call: each run
+// of literal text is written in a single operation and each format
+// specification is handed straight to the `formatter` for its argument.
+//
+// When the format string is a compile-time constant, `bslfmt::format` and
+// related functions obtain the same benefit under C++20 without the use of
+// this component, since `bslfmt::basic_format_string` splits the string at
+// compile time.  `BasicCompiledFormat` is intended for format strings that
+// are known only at run time (e.g., read from configuration) but are then
+// used many times.
+//
+// The top-level structure of the format string is validated on construction,
+// and a `bslfmt::format_error` is thrown if the string is malformed.  Format
+// specifications and argument ids are checked, as usual, when formatting,
+// because they depend on the arguments supplied.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Formatting with a Run-Time Format String
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we read the layout of a log line from configuration, and need to
+// format many records with it.  First, we compile the layout once:
+// ```
+// bsl::string layout("{:>8}|{:<6}|{}");   // e.g., read from a file
+//
+// const bslfmt::CompiledFormat format(layout);
+// ```
+// Then, we format each record with it:
+// ```
+// bsl::string line = format.format(12345, "INFO", "started");
+// assert("   12345|INFO  |started" == line);
+//
+// line.clear();
+// format.format_to(&line, 7, "WARN", "low disk");
+// assert("       7|WARN  |low disk" == line);
+// ```
+// Finally, we note that malformed format strings are rejected up front:
+// ```
+// try {
+//     const bslfmt::CompiledFormat bad("{:>8");
+//     assert(false);
+// }
+// catch (const bslfmt::format_error&) {
+// }
+// ```
+
+#include <bslscm_version.h>
+
+#include <bslfmt_format_args.h>
+#include <bslfmt_format_context.h>
+#include <bslfmt_format_imp.h>
+#include <bslfmt_formaterror.h>
+#include <bslfmt_formatstringparser.h>
+
+#include <bslma_bslallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_decay.h>
+#include <bslmf_enableif.h>
+#include <bslmf_issame.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_compilerfeatures.h>
+#include <bsls_exceptionutil.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_string.h>
+#include <bslstl_stringview.h>
+#include <bslstl_vector.h>
+
+namespace BloombergLP {
+namespace bslfmt {
+
+                     // ===================================
+                     // class CompiledFormat_SegmentAppender
+                     // ===================================
+
+/// This component-private class is a `FormatStringParser` sink appending the
+/// segments it is given to a `bsl::vector`.
+class CompiledFormat_SegmentAppender {
+    // DATA
+    bsl::vector<FormatStringSegment> *d_segments_p;  // target (held, not
+                                                     // owned)
+
+  public:
+    // CREATORS
+
+    /// Create an appender adding segments to the specified `segments`.
+    explicit CompiledFormat_SegmentAppender(
+                                   bsl::vector<FormatStringSegment> *segments);
+
+    // MANIPULATORS
+
+    /// Append the specified `segment` to the target vector and return `true`.
+    bool append(const FormatStringSegment& segment);
+};
+
+                         // =========================
+                         // class BasicCompiledFormat
+                         // =========================
+
+/// This class holds a format string of character type `t_CHAR` together
+/// with the segments it splits into, and formats arguments according to it
+/// without re-scanning the string.
+template <class t_CHAR>
+class BasicCompiledFormat {
+  public:
+    // TYPES
+    typedef bsl::allocator<char> allocator_type;
+
+    /// Type of the argument list accepted by the `vformat_to` and `vformat`
+    /// methods (`format_args` for `char` and `wformat_args` for `wchar_t`).
+    typedef basic_format_args<
+        basic_format_context<Format_ContextOutputIteratorRef<t_CHAR>, t_CHAR> >
+        FormatArgs;
+
+  private:
+    // PRIVATE TYPES
+    typedef basic_format_context<Format_ContextOutputIteratorRef<t_CHAR>,
+                                 t_CHAR>
+        Context;
+
+    // DATA
+    bsl::basic_string<t_CHAR>        d_formatString;  // copy of the string
+
+    bsl::vector<FormatStringSegment> d_segments;      // `d_formatString`
+                                                      // split into segments
+
+    // PRIVATE MANIPULATORS
+
+    /// Split `d_formatString` into `d_segments`.  Throw `format_error` if
+    /// the string is malformed.
+    void compile();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BasicCompiledFormat,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an object holding a copy of the specified `formatString`,
+    /// split for repeated use.  Optionally specify an `allocator` (e.g., the
+    /// address of a `bslma::Allocator` object) to supply memory; otherwise,
+    /// the default allocator is used.  Throw `format_error` if
+    /// `formatString` is malformed.
+    explicit BasicCompiledFormat(
+                  bsl::basic_string_view<t_CHAR> formatString,
+                  const allocator_type&          allocator = allocator_type());
+
+    /// Create an object having the same value as the specified `original`.
+    /// Optionally specify an `allocator` (e.g., the address of a
+    /// `bslma::Allocator` object) to supply memory; otherwise, the default
+    /// allocator is used.
+    BasicCompiledFormat(
+                      const BasicCompiledFormat& original,
+                      const allocator_type&      allocator = allocator_type());
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs`, and return a
+    /// reference providing modifiable access to this object.
+    BasicCompiledFormat& operator=(const BasicCompiledFormat& rhs);
+
+    // ACCESSORS
+
+    /// Format the specified `args` according to the format string held by
+    /// this object, write the result to the specified output iterator `out`,
+    /// and return an iterator one past the last character written.  Throw
+    /// `format_error` if the arguments do not match the format string.
+    template <class t_OUT>
+    t_OUT vformat_to(t_OUT out, FormatArgs args) const;
+
+    /// Format the specified `args` according to the format string held by
+    /// this object and append the result to the specified `out`.  Throw
+    /// `format_error` if the arguments do not match the format string.
+    void vformat_to(bsl::basic_string<t_CHAR> *out, FormatArgs args) const;
+
+    /// Format the specified `args` according to the format string held by
+    /// this object and return the result.  Throw `format_error` if the
+    /// arguments do not match the format string.
+    bsl::basic_string<t_CHAR> vformat(FormatArgs args) const;
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    /// Format the specified `args` according to the format string held by
+    /// this object, write the result to the specified output iterator `out`,
+    /// and return an iterator one past the last character written.  Throw
+    /// `format_error` if the arguments do not match the format string.
+    template <class t_OUT, class... t_ARGS>
+    typename bsl::enable_if<
+        !bsl::is_same<typename bsl::decay<t_OUT>::type,
+                      bsl::basic_string<t_CHAR> *>::value,
+        t_OUT>::type
+    format_to(t_OUT out, const t_ARGS&... args) const;
+
+    /// Format the specified `args` according to the format string held by
+    /// this object and append the result to the specified `out`.  Throw
+    /// `format_error` if the arguments do not match the format string.
+    template <class... t_ARGS>
+    void format_to(bsl::basic_string<t_CHAR> *out,
+                   const t_ARGS&...           args) const;
+
+    /// Format the specified `args` according to the format string held by
+    /// this object and return the result.  Throw `format_error` if the
+    /// arguments do not match the format string.
+    template <class... t_ARGS>
+    bsl::basic_string<t_CHAR> format(const t_ARGS&... args) const;
+#endif
+
+    /// Return the format string held by this object.
+    bsl::basic_string_view<t_CHAR> formatString() const;
+
+    /// Return the allocator used by this object to supply memory.
+    allocator_type get_allocator() const;
+
+    /// Return the number of segments the format string held by this object
+    /// was split into.
+    int numSegments() const;
+};
+
+// TYPEDEFS
+typedef BasicCompiledFormat<char>    CompiledFormat;
+typedef BasicCompiledFormat<wchar_t> WCompiledFormat;
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                     // ----------------------------------
+                     // class CompiledFormat_SegmentAppender
+                     // ----------------------------------
+
+// CREATORS
+inline
+CompiledFormat_SegmentAppender::CompiledFormat_SegmentAppender(
+                                    bsl::vector<FormatStringSegment> *segments)
+: d_segments_p(segments)
+{
+}
+
+// MANIPULATORS
+inline
+bool CompiledFormat_SegmentAppender::append(const FormatStringSegment& segment)
+{
+    d_segments_p->push_back(segment);
+    return true;
+}
+
+                         // -------------------------
+                         // class BasicCompiledFormat
+                         // -------------------------
+
+// PRIVATE MANIPULATORS
+template <class t_CHAR>
+void BasicCompiledFormat<t_CHAR>::compile()
+{
+    CompiledFormat_SegmentAppender appender(&d_segments);
+
+    const int rc = FormatStringParser<t_CHAR>::parse(
+                             &appender,
+                             bsl::basic_string_view<t_CHAR>(d_formatString));
+    if (FormatStringParserEnums::e_SUCCESS != rc) {
+        typedef FormatStringParserEnums Enums;
+
+        BSLS_THROW(format_error(
+                            Enums::toAscii(static_cast<Enums::Status>(rc))));
+    }
+}
+
+// CREATORS
+template <class t_CHAR>
+BasicCompiledFormat<t_CHAR>::BasicCompiledFormat(
+                           bsl::basic_string_view<t_CHAR> formatString,
+                           const allocator_type&          allocator)
+: d_formatString(formatString.data(), formatString.size(), allocator)
+, d_segments(allocator)
+{
+    compile();
+}
+
+template <class t_CHAR>
+BasicCompiledFormat<t_CHAR>::BasicCompiledFormat(
+                                        const BasicCompiledFormat& original,
+                                        const allocator_type&      allocator)
+: d_formatString(original.d_formatString, allocator)
+, d_segments(original.d_segments, allocator)
+{
+}
+
+// MANIPULATORS
+template <class t_CHAR>
+BasicCompiledFormat<t_CHAR>&
+BasicCompiledFormat<t_CHAR>::operator=(const BasicCompiledFormat& rhs)
+{
+    if (this != &rhs) {
+        BasicCompiledFormat copy(rhs, get_allocator());
+
+        d_formatString.swap(copy.d_formatString);
+        d_segments.swap(copy.d_segments);
+    }
+    return *this;
+}
+
+// ACCESSORS
+template <class t_CHAR>
+template <class t_OUT>
+inline
+t_OUT BasicCompiledFormat<t_CHAR>::vformat_to(t_OUT      out,
+                                              FormatArgs args) const
+{
+    // An empty vector may have a null `data()`, in which case the (empty)
+    // string is scanned, with the same result.
+
+    return Format_Imp_Processor<t_CHAR>::process(
+                                     out,
+                                     formatString(),
+                                     args,
+                                     d_segments.data(),
+                                     d_segments.data() + d_segments.size());
+}
+
+template <class t_CHAR>
+inline
+void BasicCompiledFormat<t_CHAR>::vformat_to(bsl::basic_string<t_CHAR> *out,
+                                             FormatArgs                 args)
+                                                                          const
+{
+    vformat_to(bsl::back_inserter(*out), args);
+}
+
+template <class t_CHAR>
+inline
+bsl::basic_string<t_CHAR>
+BasicCompiledFormat<t_CHAR>::vformat(FormatArgs args) const
+{
+    bsl::basic_string<t_CHAR> result;
+    vformat_to(&result, args);
+    return result;
+}
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class t_CHAR>
+template <class t_OUT, class... t_ARGS>
+inline
+typename bsl::enable_if<
+    !bsl::is_same<typename bsl::decay<t_OUT>::type,
+                  bsl::basic_string<t_CHAR> *>::value,
+    t_OUT>::type
+BasicCompiledFormat<t_CHAR>::format_to(t_OUT out, const t_ARGS&... args) const
+{
+    return vformat_to(out,
+                      FormatArgs(Format_ArgsUtil::makeFormatArgs<Context>(
+                                                                  args...)));
+}
+
+template <class t_CHAR>
+template <class... t_ARGS>
+inline
+void BasicCompiledFormat<t_CHAR>::format_to(
+                                       bsl::basic_string<t_CHAR> *out,
+                                       const t_ARGS&...           args) const
+{
+    vformat_to(bsl::back_inserter(*out),
+               FormatArgs(Format_ArgsUtil::makeFormatArgs<Context>(args...)));
+}
+
+template <class t_CHAR>
+template <class... t_ARGS>
+inline
+bsl::basic_string<t_CHAR>
+BasicCompiledFormat<t_CHAR>::format(const t_ARGS&... args) const
+{
+    bsl::basic_string<t_CHAR> result;
+    format_to(&result, args...);
+    return result;
+}
+#endif
+
+template <class t_CHAR>
+inline
+bsl::basic_string_view<t_CHAR>
+BasicCompiledFormat<t_CHAR>::formatString() const
+{
+    return bsl::basic_string_view<t_CHAR>(d_formatString.data(),
+                                          d_formatString.size());
+}
+
+template <class t_CHAR>
+inline
+typename BasicCompiledFormat<t_CHAR>::allocator_type
+BasicCompiledFormat<t_CHAR>::get_allocator() const
+{
+    return d_segments.get_allocator();
+}
+
+template <class t_CHAR>
+inline
+int BasicCompiledFormat<t_CHAR>::numSegments() const
+{
+    return static_cast<int>(d_segments.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // INCLUDED_BSLFMT_COMPILEDFORMAT
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,698 @@
+// bslfmt_compiledformat.t.cpp                                        -*-C++-*-
+#include <bslfmt_compiledformat.h>
+
+#include <bslfmt_format_imp.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <bslstl_string.h>
+#include <bslstl_stringview.h>
+
+#include <stdio.h>   // `printf`, `snprintf`
+#include <stdlib.h>  // `atoi`
+#include <string.h>  // `strcmp`
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a class template holding a format string
+// split into segments.  Its formatting methods must produce exactly what
+// `bslfmt::vformat` produces for the same format string and arguments,
+// including the errors reported; this is tested with a table of format
+// strings for both `char` and `wchar_t`.  The class is allocator-aware, so
+// memory use is also checked.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit BasicCompiledFormat(basic_string_view, const allocator_type&);
+// [ 4] BasicCompiledFormat(const BasicCompiledFormat&, const allocator_type&);
+//
+// MANIPULATORS
+// [ 4] BasicCompiledFormat& operator=(const BasicCompiledFormat&);
+//
+// ACCESSORS
+// [ 3] t_OUT vformat_to(t_OUT, FormatArgs) const;
+// [ 3] void vformat_to(basic_string *, FormatArgs) const;
+// [ 3] basic_string vformat(FormatArgs) const;
+// [ 3] t_OUT format_to(t_OUT, const t_ARGS&...) const;
+// [ 3] void format_to(basic_string *, const t_ARGS&...) const;
+// [ 3] basic_string format(const t_ARGS&...) const;
+// [ 2] basic_string_view formatString() const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] int numSegments() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE MEASUREMENTS
+//-----------------------------------------------------------------------------
+
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q BSLS_BSLTESTUTIL_Q    // Quote identifier literally.
+#define P BSLS_BSLTESTUTIL_P    // Print identifier and value.
+#define P_ BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslfmt::CompiledFormat  Obj;
+typedef bslfmt::WCompiledFormat WObj;
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return a wide copy of the specified narrow ASCII `str`.
+bsl::wstring widen(const char *str)
+{
+    bsl::wstring result;
+    for (; *str; ++str) {
+        result.push_back(static_cast<wchar_t>(*str));
+    }
+    return result;
+}
+
+/// Format the arguments `42`, `"abc"` and `2.5` with the specified `fmt`
+/// using `bslfmt::vformat` and using a `BasicCompiledFormat<t_CHAR>`, and
+/// verify that the outputs (or the error messages) are identical if `fmt`
+/// was accepted by the `BasicCompiledFormat` constructor.  The specified
+/// `line` is used to identify the call in case of a failure.  Return `true`
+/// if `fmt` was accepted, and `false` otherwise.
+template <class t_CHAR>
+bool checkMatchesVformat(const bsl::basic_string<t_CHAR>& fmt, int line);
+
+template <>
+bool checkMatchesVformat<char>(const bsl::string& fmt, int line)
+{
+    const int    i = 42;
+    const char  *s = "abc";
+    const double d = 2.5;
+
+    bsl::string expected, expectedError;
+    try {
+        expected = bslfmt::vformat(fmt, bslfmt::make_format_args(i, s, d));
+    }
+    catch (const bslfmt::format_error& err) {
+        expectedError = err.what();
+    }
+
+    bsl::string actual, actualError;
+    bool        compiled = false;
+    try {
+        const Obj mX(fmt);
+        compiled = true;
+
+        actual = mX.vformat(bslfmt::make_format_args(i, s, d));
+
+        bsl::string viaFormat = mX.format(i, s, d);
+        ASSERTV(line, actual.c_str(), viaFormat.c_str(), actual == viaFormat);
+
+        bsl::string viaFormatTo("<");
+        mX.format_to(&viaFormatTo, i, s, d);
+        ASSERTV(line, viaFormatTo.c_str(), "<" + actual == viaFormatTo);
+
+        char        buffer[64] = {};
+        const char *end        = mX.format_to(buffer, i, s, d);
+        ASSERTV(line, actual.c_str(), buffer,
+                actual == bsl::string_view(buffer, end - buffer));
+    }
+    catch (const bslfmt::format_error& err) {
+        actualError = err.what();
+    }
+
+    if (compiled) {
+        ASSERTV(line, fmt.c_str(), expected.c_str(), actual.c_str(),
+                expected == actual);
+        ASSERTV(line,
+                fmt.c_str(),
+                expectedError.c_str(),
+                actualError.c_str(),
+                expectedError == actualError);
+    }
+    return compiled;
+}
+
+template <>
+bool checkMatchesVformat<wchar_t>(const bsl::wstring& fmt, int line)
+{
+    const int      i = 42;
+    const wchar_t *s = L"abc";
+    const double   d = 2.5;
+
+    bsl::wstring expected;
+    bsl::string  expectedError;
+    try {
+        expected = bslfmt::vformat(fmt, bslfmt::make_wformat_args(i, s, d));
+    }
+    catch (const bslfmt::format_error& err) {
+        expectedError = err.what();
+    }
+
+    bsl::wstring actual;
+    bsl::string  actualError;
+    bool         compiled = false;
+    try {
+        const WObj mX(fmt);
+        compiled = true;
+
+        actual = mX.vformat(bslfmt::make_wformat_args(i, s, d));
+        ASSERTV(line, actual == mX.format(i, s, d));
+    }
+    catch (const bslfmt::format_error& err) {
+        actualError = err.what();
+    }
+
+    if (compiled) {
+        ASSERTV(line, expected == actual);
+        ASSERTV(line,
+                expectedError.c_str(),
+                actualError.c_str(),
+                expectedError == actualError);
+    }
+    return compiled;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;  (void)veryVeryVerbose;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No global memory is allocated after `main` starts.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) {  case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace `assert` with
+        //:   `ASSERT`, and insert `if (veryVerbose)` before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Example 1: Formatting with a Run-Time Format String
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we read the layout of a log line from configuration, and need to
+// format many records with it.  First, we compile the layout once:
+// ```
+        bsl::string layout("{:>8}|{:<6}|{}");   // e.g., read from a file
+
+        const bslfmt::CompiledFormat format(layout);
+// ```
+// Then, we format each record with it:
+// ```
+        bsl::string line = format.format(12345, "INFO", "started");
+        ASSERT("   12345|INFO  |started" == line);
+
+        line.clear();
+        format.format_to(&line, 7, "WARN", "low disk");
+        ASSERT("       7|WARN  |low disk" == line);
+// ```
+// Finally, we note that malformed format strings are rejected up front:
+// ```
+        try {
+            const bslfmt::CompiledFormat bad("{:>8");
+            ASSERT(false);
+        }
+        catch (const bslfmt::format_error&) {
+        }
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTOR AND COPY ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 A copy formats exactly as the original does.
+        //:
+        //: 2 A copy uses the allocator supplied at construction, and the
+        //:   default allocator if none is supplied.
+        //:
+        //: 3 The assignment operator leaves the target using its own
+        //:   allocator, and self-assignment has no effect.
+        //
+        // Plan:
+        //: 1 Copy and assign objects created with test allocators, and check
+        //:   the allocators used and the formatted output.  (C-1..3)
+        //
+        // Testing:
+        //   BasicCompiledFormat(const BasicCompiledFormat&, const alloc&);
+        //   BasicCompiledFormat& operator=(const BasicCompiledFormat&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY CONSTRUCTOR AND COPY ASSIGNMENT"
+                            "\n====================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        const char *FMT = "a rather long format string: {1} then {0:*^7}";
+
+        const Obj X(FMT, &oa);
+        ASSERT(&oa == X.get_allocator().mechanism());
+
+        {
+            const bsls::Types::Int64 numBlocks = sa.numBlocksTotal();
+
+            const Obj Y(X, &sa);
+            ASSERT(&sa == Y.get_allocator().mechanism());
+            ASSERT(numBlocks < sa.numBlocksTotal());
+            ASSERT(X.formatString() == Y.formatString());
+            ASSERT(X.numSegments()  == Y.numSegments());
+            ASSERT(X.format(1, "b") == Y.format(1, "b"));
+        }
+        {
+            const Obj Y(X);
+            ASSERT(&defaultAllocator == Y.get_allocator().mechanism());
+            ASSERT(X.format(1, "b") == Y.format(1, "b"));
+        }
+        {
+            Obj mY("{}", &sa);  const Obj& Y = mY;
+
+            const Obj& R = (mY = X);
+            ASSERT(&R == &Y);
+            ASSERT(&sa == Y.get_allocator().mechanism());
+            ASSERT(X.formatString() == Y.formatString());
+            ASSERT("a rather long format string: b then ***1***" ==
+                                                             Y.format(1, "b"));
+
+            mY = Y;
+            ASSERT(X.formatString() == Y.formatString());
+            ASSERT(X.format(1, "b") == Y.format(1, "b"));
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING FORMATTING
+        //
+        // Concerns:
+        //: 1 Formatting with a compiled format string produces the same
+        //:   output as `vformat` with the same format string.
+        //:
+        //: 2 Errors detected while formatting (bad specifications, missing
+        //:   arguments, mixed numbering) are reported with the same message
+        //:   as `vformat` reports.
+        //:
+        //: 3 Malformed format strings are rejected by the constructor.
+        //:
+        //: 4 All formatting methods agree with each other, for both `char`
+        //:   and `wchar_t`.
+        //
+        // Plan:
+        //: 1 For a table of format strings, compare the output and errors of
+        //:   `vformat` and of each formatting method.  (C-1..4)
+        //
+        // Testing:
+        //   t_OUT vformat_to(t_OUT, FormatArgs) const;
+        //   void vformat_to(basic_string *, FormatArgs) const;
+        //   basic_string vformat(FormatArgs) const;
+        //   t_OUT format_to(t_OUT, const t_ARGS&...) const;
+        //   void format_to(basic_string *, const t_ARGS&...) const;
+        //   basic_string format(const t_ARGS&...) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING FORMATTING"
+                            "\n==================\n");
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_fmt_p;     // format string
+            bool        d_compiles;  // accepted by the constructor
+        } DATA[] = {
+            //LINE  FORMAT                          COMPILES
+            //----  ------------------------------  --------
+            { L_,   "",                             true     },
+            { L_,   "plain text",                   true     },
+            { L_,   "{{}}",                         true     },
+            { L_,   "{}",                           true     },
+            { L_,   "{}{}{}",                       true     },
+            { L_,   "<{}> <{}> <{}>",               true     },
+            { L_,   "{2} {1} {0}",                  true     },
+            { L_,   "{0}{0}{0}",                    true     },
+            { L_,   "{:>6}|{:<6}|{:^9.3f}",         true     },
+            { L_,   "{0:#x} {0:+d} {0:08b}",        true     },
+            { L_,   "{:{}}",                        true     },
+            { L_,   "{2:.{0}}",                     true     },
+            { L_,   "{{{}}}",                       true     },
+            { L_,   "{}{}{}{}",                     true     },
+            { L_,   "{3}",                          true     },
+            { L_,   "{}{1}",                        true     },
+            { L_,   "{1}{}",                        true     },
+            { L_,   "{:q}",                         true     },
+            { L_,   "{0:}}",                        false    },
+            { L_,   "{",                            false    },
+            { L_,   "}",                            false    },
+            { L_,   "a{b",                          false    },
+            { L_,   "{0x}",                         false    },
+            { L_,   "{:",                           false    },
+            { L_,   "{99999999999}",                false    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const FMT      = DATA[ti].d_fmt_p;
+            const bool        COMPILES = DATA[ti].d_compiles;
+
+            if (veryVerbose) { T_ P_(LINE) P(FMT) }
+
+            ASSERTV(LINE, COMPILES ==
+                          checkMatchesVformat(bsl::string(FMT), LINE));
+            ASSERTV(LINE, COMPILES ==
+                          checkMatchesVformat(widen(FMT), LINE));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor keeps a copy of the format string and splits it
+        //:   into the expected number of segments.
+        //:
+        //: 2 A malformed format string causes `format_error` to be thrown
+        //:   with a message describing the problem, and no memory is leaked.
+        //:
+        //: 3 Memory is obtained from the supplied allocator, or from the
+        //:   default allocator if none is supplied.
+        //
+        // Plan:
+        //: 1 Construct objects from well-formed and malformed strings and
+        //:   check the accessors and the exceptions thrown.  (C-1..2)
+        //:
+        //: 2 Use test allocators to check memory use.  (C-3)
+        //
+        // Testing:
+        //   explicit BasicCompiledFormat(basic_string_view, const alloc&);
+        //   basic_string_view formatString() const;
+        //   allocator_type get_allocator() const;
+        //   int numSegments() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTOR AND ACCESSORS"
+                            "\n=========================\n");
+
+        static const struct {
+            int         d_line;         // source line number
+            const char *d_fmt_p;        // format string
+            int         d_numSegments;  // expected segments, or -1
+            const char *d_error_p;      // expected message if rejected
+        } DATA[] = {
+            //LINE  FORMAT           SEGS  ERROR
+            //----  ---------------  ----  --------------------------------
+            { L_,   "",               0,  ""                               },
+            { L_,   "abc",            1,  ""                               },
+            { L_,   "{}",             1,  ""                               },
+            { L_,   "a{}b",           2,  ""                               },
+            { L_,   "{{x}}",          2,  ""                               },
+            { L_,   "{0:>{1}}{2}",    2,  ""                               },
+            { L_,   "{",             -1,  "unmatched {"                    },
+            { L_,   "a}b",           -1,  "} must be escaped"              },
+            { L_,   "{0x}",          -1,  "Separator ':' missing"          },
+            { L_,   "{:{}",          -1,  "unterminated replacement field" },
+            { L_,   "{4294967296}",  -1,  "arg id too large"               },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const char *const FMT   = DATA[ti].d_fmt_p;
+            const int         SEGS  = DATA[ti].d_numSegments;
+            const char *const ERROR = DATA[ti].d_error_p;
+
+            if (veryVerbose) { T_ P_(LINE) P(FMT) }
+
+            try {
+                const Obj X(FMT, &oa);
+
+                ASSERTV(LINE, 0 <= SEGS);
+                ASSERTV(LINE, SEGS, X.numSegments(),
+                        SEGS == X.numSegments());
+                ASSERTV(LINE, bsl::string_view(FMT) == X.formatString());
+                ASSERTV(LINE, X.formatString().data() != FMT);
+                ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+            }
+            catch (const bslfmt::format_error& err) {
+                ASSERTV(LINE, 0 > SEGS);
+                ASSERTV(LINE, ERROR, err.what(), 0 == strcmp(ERROR,
+                                                             err.what()));
+            }
+            ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) printf("\tDefault allocator.\n");
+        {
+            const WObj X(L"{:>8} and {}");
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+            ASSERT(2 == X.numSegments());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compile a format string and format a few arguments with it.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const Obj X("The answer is {}, not {:x}.");
+        ASSERT(3 == X.numSegments());
+        ASSERT("The answer is 42, not 2a." == X.format(42, 42));
+
+        const WObj WX(L"{1}-{0}");
+        ASSERT(L"b-a" == WX.format(L"a", L"b"));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE MEASUREMENTS
+        //
+        // Concerns:
+        //: 1 Formatting with a compiled format string is faster than
+        //:   formatting with a format string scanned on every call.
+        //
+        // Plan:
+        //: 1 Format the same arguments in a loop with `snprintf`,
+        //:   `bslfmt::vformat`, `bslfmt::format` (whose format string is
+        //:   split at compile time under C++20), and a `CompiledFormat`, and
+        //:   report the timings using `bsls_stopwatch`.
+        //
+        // Testing:
+        //   PERFORMANCE MEASUREMENTS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE MEASUREMENTS"
+                            "\n========================\n");
+
+        const int k_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000 * 1000;
+        const int k_NUM_ITERATIONS = k_ITERATIONS > 0 ? k_ITERATIONS
+                                                      : 1000 * 1000;
+
+#define BSLFMT_BENCH_FORMAT "request {} from {} took {} us, status={}"
+        const char *k_FMT = BSLFMT_BENCH_FORMAT;
+
+        const int   id     = 123456;
+        const char *host   = "host01.example.com";
+        const int   micros = 4271;
+        const char *status = "OK";
+
+        bsl::string result;
+        result.reserve(128);
+        {
+            char            buffer[128];
+            unsigned long   value = 0;
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                value += snprintf(buffer,
+                                  sizeof buffer,
+                                  "request %d from %s took %d us, status=%s",
+                                  id,
+                                  host,
+                                  micros,
+                                  status);
+            }
+            timer.stop();
+            printf("snprintf           %d calls (in seconds): %f\n",
+                   k_NUM_ITERATIONS,
+                   timer.elapsedTime());
+            (void)value;
+        }
+        {
+            unsigned long   value = 0;
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                result.clear();
+                bslfmt::vformat_to(&result,
+                                   k_FMT,
+                                   bslfmt::make_format_args(id,
+                                                            host,
+                                                            micros,
+                                                            status));
+                value += result.size();
+            }
+            timer.stop();
+            printf("bslfmt::vformat_to %d calls (in seconds): %f\n",
+                   k_NUM_ITERATIONS,
+                   timer.elapsedTime());
+            (void)value;
+        }
+        {
+            unsigned long   value = 0;
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                result.clear();
+                bslfmt::format_to(&result,
+                                  BSLFMT_BENCH_FORMAT,
+                                  id,
+                                  host,
+                                  micros,
+                                  status);
+                value += result.size();
+            }
+            timer.stop();
+            printf("bslfmt::format_to  %d calls (in seconds): %f\n",
+                   k_NUM_ITERATIONS,
+                   timer.elapsedTime());
+            (void)value;
+        }
+        {
+            const Obj       X(k_FMT);
+            unsigned long   value = 0;
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                result.clear();
+                X.format_to(&result, id, host, micros, status);
+                value += result.size();
+            }
+            timer.stop();
+            printf("CompiledFormat     %d calls (in seconds): %f\n",
+                   k_NUM_ITERATIONS,
+                   timer.elapsedTime());
+            (void)value;
+        }
+#undef BSLFMT_BENCH_FORMAT
+      } break;
+      default: {
+        printf("WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        printf("Error, non-zero test status = %d .\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -108,6 +108,7 @@ BSLS_IDENT("$Id: $")
 #include <bslfmt_format_args.h>
 #include <bslfmt_formaterror.h>
 #include <bslfmt_formatterbase.h>
+#include <bslfmt_putrangeutil.h>
 
 #include <bslalg_numericformatterutil.h>
 
@@ -118,6 +119,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_isintegral.h>
 #include <bslmf_issame.h>
 #include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_compilerfeatures.h>
 #include <bsls_exceptionutil.h>
@@ -173,6 +175,11 @@ class Format_ContextOutputIteratorBase {
     /// Write the specified `character` to the contained iterator and then
     /// increment this iterator.
     virtual void put(t_CHAR character) = 0;
+
+    /// Write the characters in the specified range [`begin`, `end`) to the
+    /// contained iterator, incrementing it after each character.  The default
+    /// implementation calls `put` for each character.
+    virtual void putRange(const t_CHAR *begin, const t_CHAR *end);
 };
 
                 // ======================================
@@ -202,6 +209,13 @@ class Format_ContextOutputIteratorImpl
     /// Write the specified `character` to the contained iterator and then
     /// increment this iterator.
     void put(t_CHAR character) BSLS_KEYWORD_OVERRIDE;
+
+    /// Write the characters in the specified range [`begin`, `end`) to the
+    /// contained iterator, using a single call to its `putRange` method if it
+    /// has the `HasPutRange` trait, and incrementing it after each character
+    /// otherwise.
+    void putRange(const t_CHAR *begin,
+                  const t_CHAR *end) BSLS_KEYWORD_OVERRIDE;
 };
 
                   // =====================================
@@ -227,6 +241,10 @@ class Format_ContextOutputIteratorRef {
     typedef void                     reference;
     typedef void                     pointer;
 
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Format_ContextOutputIteratorRef,
+                                   HasPutRange);
+
     // CREATORS
 
     /// Create an instance of this type.  The specified `base` should be a
@@ -248,6 +266,12 @@ class Format_ContextOutputIteratorRef {
     /// iterator then being incremented.
     void operator=(t_CHAR x);
 
+    /// Call `putRange(begin, end)` on the referenced
+    /// `Format_ContextOutputIteratorImpl` instance, writing the characters in
+    /// the specified range [`begin`, `end`) to the underlying iterator with a
+    /// single indirect call.
+    void putRange(const t_CHAR *begin, const t_CHAR *end);
+
     /// Do nothing.  This method is provided to enable this type to satisfy the
     /// requirements of [output.iterators].
     Format_ContextOutputIteratorRef& operator++();
@@ -341,6 +365,20 @@ class Format_ContextFactory {
 //                           INLINE DEFINITIONS
 // ============================================================================
 
+                 // --------------------------------------
+                 // class Format_ContextOutputIteratorBase
+                 // --------------------------------------
+
+// MANIPULATORS
+template <class t_CHAR>
+void Format_ContextOutputIteratorBase<t_CHAR>::putRange(const t_CHAR *begin,
+                                                        const t_CHAR *end)
+{
+    for (; begin != end; ++begin) {
+        put(*begin);
+    }
+}
+
                  // --------------------------------------
                  // class Format_ContextOutputIteratorImpl
                  // --------------------------------------
@@ -369,6 +407,14 @@ void Format_ContextOutputIteratorImpl<t_CHAR, t_ITER>::put(t_CHAR character)
     ++d_iter;
 }
 
+template <class t_CHAR, class t_ITER>
+void Format_ContextOutputIteratorImpl<t_CHAR, t_ITER>::putRange(
+                                                         const t_CHAR *begin,
+                                                         const t_CHAR *end)
+{
+    d_iter = PutRangeUtil::copy(begin, end, d_iter);
+}
+
                     // -------------------------------------
                     // class Format_ContextOutputIteratorRef
                     // -------------------------------------
@@ -411,6 +457,16 @@ void Format_ContextOutputIteratorRef<t_CHAR>::operator=(t_CHAR x)
 #endif
 }
 
+template <class t_CHAR>
+inline
+void Format_ContextOutputIteratorRef<t_CHAR>::putRange(const t_CHAR *begin,
+                                                       const t_CHAR *end)
+{
+    if (begin != end) {
+        d_base_p->putRange(begin, end);
+    }
+}
+
 template <class t_CHAR>
 inline
 Format_ContextOutputIteratorRef<t_CHAR>&
@@ -55,7 +55,8 @@ using namespace BloombergLP;
 // [ 2] TESTING PRIMARY MANIPULATORS: Not Applicable
 // [ 5] TESTING OUTPUT:               Not Applicable
 // [10] STREAMING FUNCTIONALITY:      Not Applicable
-// [13] USAGE EXAMPLE
+// [13] void Format_ContextOutputIteratorRef::putRange(const CHAR *, ...);
+// [14] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -128,6 +129,33 @@ void aSsErT(bool condition, const char *message, int line)
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
 
+/// This type appends the characters written through it to a string, and
+/// relies on `Format_ContextOutputIteratorBase::putRange` falling back to
+/// `put` for each character.
+class CountingBase : public bslfmt::Format_ContextOutputIteratorBase<char> {
+    // DATA
+    bsl::string *d_result_p;
+    int          d_numPuts;
+
+  public:
+    // CREATORS
+    explicit CountingBase(bsl::string *result)
+    : d_result_p(result)
+    , d_numPuts(0)
+    {
+    }
+
+    // MANIPULATORS
+    void put(char character) BSLS_KEYWORD_OVERRIDE
+    {
+        d_result_p->push_back(character);
+        ++d_numPuts;
+    }
+
+    // ACCESSORS
+    int numPuts() const { return d_numPuts; }
+};
+
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -212,7 +240,7 @@ int main(int argc, char **argv)
     ASSERT(&defaultAllocator == bslma::Default::defaultAllocator());
 
     switch (test) {  case 0:
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -302,6 +330,63 @@ int main(int argc, char **argv)
         testFormatter(bslfmt::make_format_args(value));
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING `putRange`
+        //
+        // Concerns:
+        //: 1 `putRange` on a `Format_ContextOutputIteratorRef` writes the
+        //:   characters of the range, in order, to the underlying iterator
+        //:   and advances that iterator past them.
+        //:
+        //: 2 An empty range writes nothing.
+        //:
+        //: 3 A type derived from `Format_ContextOutputIteratorBase` that
+        //:   overrides only `put` receives one call per character.
+        //
+        // Plan:
+        //: 1 Write ranges of several lengths through an `Impl` wrapping a
+        //:   `char *` and verify the contents and the final iterator
+        //:   position.  (C-1..2)
+        //:
+        //: 2 Write a range through a `CountingBase` object.  (C-3)
+        //
+        // Testing:
+        //   void Format_ContextOutputIteratorRef::putRange(const CHAR *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING `putRange`"
+                   "\n==================\n");
+
+        const char SOURCE[] = "0123456789";
+
+        for (int len = 0; len <= 10; ++len) {
+            char  buffer[16] = { 0 };
+            char *position   = buffer;
+
+            bslfmt::Format_ContextOutputIteratorImpl<char, char *> impl(
+                                                                     position);
+            bslfmt::Format_ContextOutputIteratorRef<char> ref(&impl);
+
+            ref.putRange(SOURCE, SOURCE + len);
+
+            ASSERTV(len, buffer + len == position);
+            ASSERTV(len, bsl::string(SOURCE, len) == buffer);
+        }
+
+        {
+            bsl::string  result;
+            CountingBase base(&result);
+
+            bslfmt::Format_ContextOutputIteratorRef<char> ref(&base);
+
+            ref.putRange(SOURCE, SOURCE + 4);
+
+            ASSERTV(base.numPuts(), 4 == base.numPuts());
+            ASSERTV(result.c_str(), "0123" == result);
+        }
+      } break;
       case 12: {
         // --------------------------------------------
         // TESTING CONSTRUCTION FROM ARG STORE - WORK IN PROGRESS
@@ -112,6 +112,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_compilerfeatures.h>
 #include <bsls_exceptionutil.h>
 #include <bsls_libraryfeatures.h>
+#include <bsls_performancehint.h>
 #include <bsls_unspecifiedbool.h>
 #include <bsls_util.h>
 
@@ -129,6 +130,7 @@ BSLS_IDENT("$Id: $")
 #include <bslfmt_format_context.h>
 #include <bslfmt_format_string.h>
 #include <bslfmt_formatparsecontext.h>
+#include <bslfmt_formatstringparser.h>
 
 #include <bslfmt_formatterbase.h>
 #include <bslfmt_formatterbool.h>
@@ -341,37 +343,54 @@ struct Format_Imp_Processor {
 
     /// Format the specified `args` according to the format string specified by
     /// `fmtStr` and write the result to the output iterator specified by
-    /// `out`.  Return an iterator one past the end of the output range.
+    /// `out`.  Return an iterator one past the end of the output range.  If
+    /// the specified `segmentsBegin` is not 0, the range [`segmentsBegin`,
+    /// the specified `segmentsEnd`) must hold the result of splitting
+    /// `fmtStr` with `FormatStringParser`, and is used in place of scanning
+    /// `fmtStr`.
     template <class t_OUT>
     static t_OUT processImp(
-         t_OUT&                                                         out,
-         bsl::basic_string_view<t_CHAR>                                 fmtStr,
-         const basic_format_args<basic_format_context<t_OUT, t_CHAR> >& args);
+       t_OUT&                                                         out,
+       bsl::basic_string_view<t_CHAR>                                 fmtStr,
+       const basic_format_args<basic_format_context<t_OUT, t_CHAR> >& args,
+       const FormatStringSegment                                *segmentsBegin,
+       const FormatStringSegment                                *segmentsEnd);
 
   public:
     // CLASS METHODS
 
     /// Format the specified `args` according to the format string specified by
     /// `fmtStr` and write the result to the output iterator specified by
-    /// `out`.  Return an iterator one past the end of the output range.  This
-    /// function participates in overload resolution if `out` is of
-    /// `Format_ContextOutputIteratorRef` type.
+    /// `out`.  Return an iterator one past the end of the output range.
+    /// Optionally specify the range [`segmentsBegin`, `segmentsEnd`) holding
+    /// `fmtStr` already split by `FormatStringParser`; if `segmentsBegin` is
+    /// 0, `fmtStr` is scanned instead.  This function participates in
+    /// overload resolution if `out` is of `Format_ContextOutputIteratorRef`
+    /// type.
     static Format_ContextOutputIteratorRef<t_CHAR>
-    process(Format_ContextOutputIteratorRef<t_CHAR> out,
-            bsl::basic_string_view<t_CHAR>          fmtStr,
+    process(Format_ContextOutputIteratorRef<t_CHAR>  out,
+            bsl::basic_string_view<t_CHAR>           fmtStr,
             const basic_format_args<
                 basic_format_context<Format_ContextOutputIteratorRef<t_CHAR>,
-                                     t_CHAR> >&     args);
+                                     t_CHAR> >&      args,
+            const FormatStringSegment               *segmentsBegin = 0,
+            const FormatStringSegment               *segmentsEnd   = 0);
 
     /// Format the specified `args` according to the format string specified by
     /// `fmtStr` and write the result to the output iterator specified by
-    /// `out`.  Return an iterator one past the end of the output range.  This
-    /// function participates in overload resolution if `out` is not of
+    /// `out`.  Return an iterator one past the end of the output range.
+    /// Optionally specify the range [`segmentsBegin`, `segmentsEnd`) holding
+    /// `fmtStr` already split by `FormatStringParser`; if `segmentsBegin` is
+    /// 0, `fmtStr` is scanned instead.  This function participates in
+    /// overload resolution if `out` is not of
     /// `Format_ContextOutputIteratorRef` type.
     template <class t_OUT, class t_CONTEXT>
-    static t_OUT process(t_OUT                               out,
-                         bsl::basic_string_view<t_CHAR>      fmtStr,
-                         const basic_format_args<t_CONTEXT>& args);
+    static t_OUT process(
+                        t_OUT                               out,
+                        bsl::basic_string_view<t_CHAR>      fmtStr,
+                        const basic_format_args<t_CONTEXT>& args,
+                        const FormatStringSegment          *segmentsBegin = 0,
+                        const FormatStringSegment          *segmentsEnd   = 0);
 };
 
                                // --------------
@@ -800,11 +819,15 @@ void Format_Imp_Visitor<t_OUT, t_CHAR>::operator()(const handle& h) const
 template <class t_CHAR>
 template <class t_OUT>
 t_OUT Format_Imp_Processor<t_CHAR>::processImp(
-         t_OUT&                                                         out,
-         bsl::basic_string_view<t_CHAR>                                 fmtStr,
-         const basic_format_args<basic_format_context<t_OUT, t_CHAR> >& args)
+       t_OUT&                                                         out,
+       bsl::basic_string_view<t_CHAR>                                 fmtStr,
+       const basic_format_args<basic_format_context<t_OUT, t_CHAR> >& args,
+       const FormatStringSegment                                *segmentsBegin,
+       const FormatStringSegment                                *segmentsEnd)
     // The actual meat of the implementation.
 {
+    typedef typename bsl::basic_string_view<t_CHAR>::iterator Iterator;
+
     const size_t argSize = Format_ArgsUtil::formatArgsSize(args);
 
     basic_format_parse_context<t_CHAR>  pc(fmtStr, argSize);
@@ -812,7 +835,68 @@ t_OUT Format_Imp_Processor<t_CHAR>::processImp(
                                   Format_ContextFactory::construct(out, args));
     Format_Imp_Visitor<t_OUT, t_CHAR> visitor(pc, fc);
 
-    typename bsl::basic_string_view<t_CHAR>::iterator it = pc.begin();
+    const Iterator  first = pc.begin();
+    const t_CHAR   *data  = fmtStr.data();
+
+    Iterator it = first;
+
+    if (segmentsBegin) {
+        // The string was split in advance: write each literal run in one go
+        // and hand each format specification straight to its formatter.  The
+        // checks below are those made by the scanning loop, in the same
+        // order, so that both paths throw the same errors.
+
+        it = pc.end();
+
+        for (const FormatStringSegment *segment  = segmentsBegin;
+                                        segment != segmentsEnd;
+                                      ++segment) {
+            out = fc.out();
+            out.putRange(data + segment->d_literalBegin,
+                         data + segment->d_literalEnd);
+            fc.advance_to(out);
+
+            if (FormatStringSegment::k_NO_FIELD == segment->d_argId) {
+                continue;                                           // CONTINUE
+            }
+
+            size_t id;
+            if (FormatStringSegment::k_AUTOMATIC_ID == segment->d_argId) {
+                id = pc.next_arg_id();
+            }
+            else {
+                id = segment->d_argId;
+                if (id >= argSize) {
+                    BSLS_THROW(format_error("arg id too large"));
+                }
+                pc.check_arg_id(id);
+            }
+
+            pc.advance_to(first + segment->d_specBegin);
+            visit_format_arg(visitor, args.get(id));
+            out = fc.out();
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                               pc.begin() != first + segment->d_specEnd)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                // The formatter did not stop at the closing brace found by
+                // the parser: finish the string with the scanning loop, which
+                // reports the error (or agrees with the formatter).
+
+                it = pc.begin();
+                if (it != pc.end()) {
+                    if (*it != '}') {
+                        BSLS_THROW(
+                               format_error("parsing terminated before }"));
+                    }
+                    // advance past the terminating }
+                    ++it;
+                }
+                break;                                                 // BREAK
+            }
+        }
+    }
 
     while (it != pc.end()) {
         if (*it == '{') {
@@ -885,12 +969,16 @@ t_OUT Format_Imp_Processor<t_CHAR>::processImp(
             fc.advance_to(out);
         }
         else {
-            // just copy it
-            out  = fc.out();
-            *out = *it;
-            ++out;
-            ++it;
+            // copy the run of characters up to the next brace in one go
+            Iterator runEnd = it;
+            do {
+                ++runEnd;
+            } while (runEnd != pc.end() && *runEnd != '{' && *runEnd != '}');
+
+            out = fc.out();
+            out.putRange(data + (it - first), data + (runEnd - first));
             fc.advance_to(out);
+            it = runEnd;
         }
     }
     return fc.out();
@@ -898,26 +986,30 @@ t_OUT Format_Imp_Processor<t_CHAR>::processImp(
 
 template <class t_CHAR>
 Format_ContextOutputIteratorRef<t_CHAR> Format_Imp_Processor<t_CHAR>::process(
-              Format_ContextOutputIteratorRef<t_CHAR> out,
-              bsl::basic_string_view<t_CHAR>          fmtStr,
+              Format_ContextOutputIteratorRef<t_CHAR>  out,
+              bsl::basic_string_view<t_CHAR>           fmtStr,
               const basic_format_args<
                   basic_format_context<Format_ContextOutputIteratorRef<t_CHAR>,
-                                       t_CHAR> >& args)
+                                       t_CHAR> >&      args,
+              const FormatStringSegment               *segmentsBegin,
+              const FormatStringSegment               *segmentsEnd)
 {
-    processImp(out, fmtStr, args);
+    processImp(out, fmtStr, args, segmentsBegin, segmentsEnd);
     return out;
 }
 
 template <class t_CHAR>
 template <class t_OUT, class t_CONTEXT>
 t_OUT Format_Imp_Processor<t_CHAR>::process(
-                                    t_OUT                               out,
-                                    bsl::basic_string_view<t_CHAR>      fmtStr,
-                                    const basic_format_args<t_CONTEXT>& args)
+                           t_OUT                               out,
+                           bsl::basic_string_view<t_CHAR>      fmtStr,
+                           const basic_format_args<t_CONTEXT>& args,
+                           const FormatStringSegment          *segmentsBegin,
+                           const FormatStringSegment          *segmentsEnd)
 {
     Format_ContextOutputIteratorImpl<t_CHAR, t_OUT> wrappedOut(out);
     Format_ContextOutputIteratorRef<t_CHAR>         wrappedOutRef(&wrappedOut);
-    processImp(wrappedOutRef, fmtStr, args);
+    processImp(wrappedOutRef, fmtStr, args, segmentsBegin, segmentsEnd);
     return out;
 }
 
@@ -994,7 +1086,12 @@ format_to(t_OUT                          out,
           BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
           const t_ARGS&...               args)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args...));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args...)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 
 template <class t_OUT, class... t_ARGS>
@@ -1005,7 +1102,12 @@ format_to(t_OUT                           out,
           BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
           const t_ARGS&...                args)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args...));
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args...)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 
 template <class... t_ARGS>
@@ -1013,9 +1115,12 @@ void format_to(bsl::string                    *out,
                BSLFMT_FORMAT_STRING_PARAMETER  fmtStr,
                const t_ARGS&...                args)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args...));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args...)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 
 template <class... t_ARGS>
@@ -1023,16 +1128,19 @@ void format_to(bsl::wstring                    *out,
                BSLFMT_FORMAT_WSTRING_PARAMETER  fmtStr,
                const t_ARGS&...                 args)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args...));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args...)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 
 template <class... t_ARGS>
 bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr, const t_ARGS&...args)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args...));
+    bslfmt::format_to(&result, fmtStr, args...);
     return result;
 }
 
@@ -1041,7 +1149,7 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS&...                args)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args...));
+    bslfmt::format_to(&result, fmtStr, args...);
     return result;
 }
 
@@ -1051,7 +1159,7 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS&...               args)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args...));
+    bslfmt::format_to(&result, fmtStr, args...);
     return bsl::string(result, alloc);
 }
 
@@ -1061,7 +1169,7 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS&...                args)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args...));
+    bslfmt::format_to(&result, fmtStr, args...);
     return bsl::wstring(result, alloc);
 }
 
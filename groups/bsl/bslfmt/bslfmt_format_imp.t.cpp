@@ -243,6 +243,17 @@ bool doTestWithOracle(wstring_view                   result,
 
 struct NonFormattableType {};
 
+struct FormattableType;
+
+/// Format the arguments `42`, `"abc"` and `FormattableType{7}` according to
+/// the specified `fmt`, once by scanning `fmt` and once from the segments
+/// computed for it by `FormatStringParser`, and verify that both produce the
+/// same output, or throw `format_error` with the same message.  Return `true`
+/// if `fmt` could be split into a `FormatStringSegmentBuffer<8>`, and `false`
+/// otherwise.  The specified `line` is used to identify a function call
+/// location in case of a failure.
+bool checkSegmentsMatchScanning(const char *fmt, int line);
+
 struct FormattableType {
     int x;
 };
@@ -328,6 +339,59 @@ struct formatter<FormattableType, t_CHAR> {
 
 }  // close namespace bsl
 
+bool checkSegmentsMatchScanning(const char *fmt, int line)
+{
+    const bsl::string_view view(fmt);
+
+    bslfmt::FormatStringSegmentBuffer<8> segments;
+    segments.clear();
+    if (0 != bslfmt::FormatStringParser<char>::parse(&segments, view)) {
+        segments.reset();
+    }
+
+    int             a = 42;
+    const char     *b = "abc";
+    FormattableType c = { 7 };
+
+    bsl::string scanned;
+    bsl::string scannedError;
+    try {
+        bslfmt::Format_Imp_Processor<char>::process(
+                          bsl::back_inserter(scanned),
+                          view,
+                          bslfmt::format_args(bslfmt::make_format_args(a,
+                                                                       b,
+                                                                       c)));
+    }
+    catch (const bslfmt::format_error& err) {
+        scannedError = err.what();
+    }
+
+    bsl::string split;
+    bsl::string splitError;
+    try {
+        bslfmt::Format_Imp_Processor<char>::process(
+                          bsl::back_inserter(split),
+                          view,
+                          bslfmt::format_args(bslfmt::make_format_args(a,
+                                                                       b,
+                                                                       c)),
+                          segments.begin(),
+                          segments.end());
+    }
+    catch (const bslfmt::format_error& err) {
+        splitError = err.what();
+    }
+
+    ASSERTV(line, scanned.c_str(), split.c_str(), scanned == split);
+    ASSERTV(line,
+            scannedError.c_str(),
+            splitError.c_str(),
+            scannedError == splitError);
+
+    return segments.isCompiled();
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -362,6 +426,111 @@ int main(int argc, char **argv)
     ASSERT(&defaultAllocator == bslma::Default::defaultAllocator());
 
     switch (test) {  case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRE-SPLIT FORMAT STRINGS
+        //
+        // Concerns:
+        //: 1 Formatting from the segments computed by `FormatStringParser`
+        //:   produces the same output as scanning the format string.
+        //:
+        //: 2 Errors detected while formatting (argument ids out of range,
+        //:   mixed indexing, bad format specifications) are reported with the
+        //:   same message on both paths.
+        //:
+        //: 3 Strings that cannot be split (malformed, or with too many
+        //:   segments) are handled by scanning.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format each string in a set
+        //:   both ways with `Format_Imp_Processor::process` and compare the
+        //:   results, also checking whether the string could be split.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   process(out, fmtStr, args, segmentsBegin, segmentsEnd);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING PRE-SPLIT FORMAT STRINGS"
+                   "\n================================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_format;
+            bool        d_compiled;
+        } DATA[] = {
+            { L_, "",                          true  },
+            { L_, "abc",                       true  },
+            { L_, "{}",                        true  },
+            { L_, "{} {} {}",                  true  },
+            { L_, "{0} {1} {2}",               true  },
+            { L_, "{2}{1}{0}{1}",              true  },
+            { L_, "x{{y}}z{}",                 true  },
+            { L_, "{{{}}}",                    true  },
+            { L_, "{:>6}|{:<5}|{}",            true  },
+            { L_, "{:*^8x}",                   true  },
+            { L_, "{2:12}",                    true  },
+            { L_, "{1:{0}}",                   true  },
+            { L_, "{1:.{0}}",                  true  },
+            { L_, "{}{0}",                     true  },
+            { L_, "{0}{}",                     true  },
+            { L_, "{3}",                       true  },
+            { L_, "{} {} {} {}",               true  },
+            { L_, "{:s}",                      true  },
+            { L_, "{0:5 }",                    true  },
+            { L_, "{1:d}",                     true  },
+            { L_, "{:{}}",                     true  },
+            { L_, "{:}}",                      false },
+            { L_, "{",                         false },
+            { L_, "}",                         false },
+            { L_, "{0",                        false },
+            { L_, "{0x}",                      false },
+            { L_, "{:",                        false },
+            { L_, "{}{}{}{{{{{{{{{{{{{{",      false },
+            { L_, "a{}b{}c{}d{{e}}f{0}g",      true  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const FORMAT   = DATA[ti].d_format;
+            const bool        COMPILED = DATA[ti].d_compiled;
+
+            if (veryVerbose) { T_ P_(LINE) P(FORMAT) }
+
+            const bool compiled = checkSegmentsMatchScanning(FORMAT, LINE);
+            ASSERTV(LINE, COMPILED, compiled, COMPILED == compiled);
+        }
+
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP20_BASELINE_LIBRARY)
+        if (verbose) printf("\tTesting strings split at compile time.\n");
+        {
+            int         a = 42;
+            const char *b = "abc";
+
+            ASSERT("[    42|abc]" == bslfmt::format("[{:6}|{}]", a, b));
+            ASSERT(L"{42}"       == bslfmt::format(L"{{{}}}", a));
+
+            bsl::string result;
+            bslfmt::format_to(&result, "{1}-{0}", a, b);
+            ASSERT("abc-42" == result);
+
+            ASSERT(6 == bslfmt::formatted_size("{}:{}", a, b));
+
+            try {
+                bslfmt::format("{} {} {}", a, b);
+                ASSERT(false);
+            }
+            catch (const bslfmt::format_error& err) {
+                ASSERTV(err.what(), 0 == strcmp(
+                                 "Number of conversion specifiers exceeds "
+                                 "number of arguments",
+                                 err.what()));
+            }
+        }
+#endif
+      } break;
       case 1: {
         if (verbose)
             printf("\nBREATHING TEST"
@@ -21,7 +21,7 @@
 // regions of C++11 code, then this header contains no code and is not
 // '#include'd in the original header.
 //
-// Generated on Thu Apr 24 06:19:46 2025
+// Generated on Sun Oct 18 08:01:49 2026
 // Command line: sim_cpp11_features.pl bslfmt_format_imp.h
 
 #ifdef COMPILING_BSLFMT_FORMAT_IMP_H
@@ -212,37 +212,54 @@ struct Format_Imp_Processor {
 
     /// Format the specified `args` according to the format string specified by
     /// `fmtStr` and write the result to the output iterator specified by
-    /// `out`.  Return an iterator one past the end of the output range.
+    /// `out`.  Return an iterator one past the end of the output range.  If
+    /// the specified `segmentsBegin` is not 0, the range [`segmentsBegin`,
+    /// the specified `segmentsEnd`) must hold the result of splitting
+    /// `fmtStr` with `FormatStringParser`, and is used in place of scanning
+    /// `fmtStr`.
     template <class t_OUT>
     static t_OUT processImp(
-         t_OUT&                                                         out,
-         bsl::basic_string_view<t_CHAR>                                 fmtStr,
-         const basic_format_args<basic_format_context<t_OUT, t_CHAR> >& args);
+       t_OUT&                                                         out,
+       bsl::basic_string_view<t_CHAR>                                 fmtStr,
+       const basic_format_args<basic_format_context<t_OUT, t_CHAR> >& args,
+       const FormatStringSegment                                *segmentsBegin,
+       const FormatStringSegment                                *segmentsEnd);
 
   public:
     // CLASS METHODS
 
     /// Format the specified `args` according to the format string specified by
     /// `fmtStr` and write the result to the output iterator specified by
-    /// `out`.  Return an iterator one past the end of the output range.  This
-    /// function participates in overload resolution if `out` is of
-    /// `Format_ContextOutputIteratorRef` type.
+    /// `out`.  Return an iterator one past the end of the output range.
+    /// Optionally specify the range [`segmentsBegin`, `segmentsEnd`) holding
+    /// `fmtStr` already split by `FormatStringParser`; if `segmentsBegin` is
+    /// 0, `fmtStr` is scanned instead.  This function participates in
+    /// overload resolution if `out` is of `Format_ContextOutputIteratorRef`
+    /// type.
     static Format_ContextOutputIteratorRef<t_CHAR>
-    process(Format_ContextOutputIteratorRef<t_CHAR> out,
-            bsl::basic_string_view<t_CHAR>          fmtStr,
+    process(Format_ContextOutputIteratorRef<t_CHAR>  out,
+            bsl::basic_string_view<t_CHAR>           fmtStr,
             const basic_format_args<
                 basic_format_context<Format_ContextOutputIteratorRef<t_CHAR>,
-                                     t_CHAR> >&     args);
+                                     t_CHAR> >&      args,
+            const FormatStringSegment               *segmentsBegin = 0,
+            const FormatStringSegment               *segmentsEnd   = 0);
 
     /// Format the specified `args` according to the format string specified by
     /// `fmtStr` and write the result to the output iterator specified by
-    /// `out`.  Return an iterator one past the end of the output range.  This
-    /// function participates in overload resolution if `out` is not of
+    /// `out`.  Return an iterator one past the end of the output range.
+    /// Optionally specify the range [`segmentsBegin`, `segmentsEnd`) holding
+    /// `fmtStr` already split by `FormatStringParser`; if `segmentsBegin` is
+    /// 0, `fmtStr` is scanned instead.  This function participates in
+    /// overload resolution if `out` is not of
     /// `Format_ContextOutputIteratorRef` type.
     template <class t_OUT, class t_CONTEXT>
-    static t_OUT process(t_OUT                               out,
-                         bsl::basic_string_view<t_CHAR>      fmtStr,
-                         const basic_format_args<t_CONTEXT>& args);
+    static t_OUT process(
+                        t_OUT                               out,
+                        bsl::basic_string_view<t_CHAR>      fmtStr,
+                        const basic_format_args<t_CONTEXT>& args,
+                        const FormatStringSegment          *segmentsBegin = 0,
+                        const FormatStringSegment          *segmentsEnd   = 0);
 };
 
                                // --------------
@@ -2818,11 +2835,15 @@ void Format_Imp_Visitor<t_OUT, t_CHAR>::operator()(const handle& h) const
 template <class t_CHAR>
 template <class t_OUT>
 t_OUT Format_Imp_Processor<t_CHAR>::processImp(
-         t_OUT&                                                         out,
-         bsl::basic_string_view<t_CHAR>                                 fmtStr,
-         const basic_format_args<basic_format_context<t_OUT, t_CHAR> >& args)
+       t_OUT&                                                         out,
+       bsl::basic_string_view<t_CHAR>                                 fmtStr,
+       const basic_format_args<basic_format_context<t_OUT, t_CHAR> >& args,
+       const FormatStringSegment                                *segmentsBegin,
+       const FormatStringSegment                                *segmentsEnd)
     // The actual meat of the implementation.
 {
+    typedef typename bsl::basic_string_view<t_CHAR>::iterator Iterator;
+
     const size_t argSize = Format_ArgsUtil::formatArgsSize(args);
 
     basic_format_parse_context<t_CHAR>  pc(fmtStr, argSize);
@@ -2830,7 +2851,68 @@ t_OUT Format_Imp_Processor<t_CHAR>::processImp(
                                   Format_ContextFactory::construct(out, args));
     Format_Imp_Visitor<t_OUT, t_CHAR> visitor(pc, fc);
 
-    typename bsl::basic_string_view<t_CHAR>::iterator it = pc.begin();
+    const Iterator  first = pc.begin();
+    const t_CHAR   *data  = fmtStr.data();
+
+    Iterator it = first;
+
+    if (segmentsBegin) {
+        // The string was split in advance: write each literal run in one go
+        // and hand each format specification straight to its formatter.  The
+        // checks below are those made by the scanning loop, in the same
+        // order, so that both paths throw the same errors.
+
+        it = pc.end();
+
+        for (const FormatStringSegment *segment  = segmentsBegin;
+                                        segment != segmentsEnd;
+                                      ++segment) {
+            out = fc.out();
+            out.putRange(data + segment->d_literalBegin,
+                         data + segment->d_literalEnd);
+            fc.advance_to(out);
+
+            if (FormatStringSegment::k_NO_FIELD == segment->d_argId) {
+                continue;                                           // CONTINUE
+            }
+
+            size_t id;
+            if (FormatStringSegment::k_AUTOMATIC_ID == segment->d_argId) {
+                id = pc.next_arg_id();
+            }
+            else {
+                id = segment->d_argId;
+                if (id >= argSize) {
+                    BSLS_THROW(format_error("arg id too large"));
+                }
+                pc.check_arg_id(id);
+            }
+
+            pc.advance_to(first + segment->d_specBegin);
+            visit_format_arg(visitor, args.get(id));
+            out = fc.out();
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                               pc.begin() != first + segment->d_specEnd)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                // The formatter did not stop at the closing brace found by
+                // the parser: finish the string with the scanning loop, which
+                // reports the error (or agrees with the formatter).
+
+                it = pc.begin();
+                if (it != pc.end()) {
+                    if (*it != '}') {
+                        BSLS_THROW(
+                               format_error("parsing terminated before }"));
+                    }
+                    // advance past the terminating }
+                    ++it;
+                }
+                break;                                                 // BREAK
+            }
+        }
+    }
 
     while (it != pc.end()) {
         if (*it == '{') {
@@ -2903,12 +2985,16 @@ t_OUT Format_Imp_Processor<t_CHAR>::processImp(
             fc.advance_to(out);
         }
         else {
-            // just copy it
-            out  = fc.out();
-            *out = *it;
-            ++out;
-            ++it;
+            // copy the run of characters up to the next brace in one go
+            Iterator runEnd = it;
+            do {
+                ++runEnd;
+            } while (runEnd != pc.end() && *runEnd != '{' && *runEnd != '}');
+
+            out = fc.out();
+            out.putRange(data + (it - first), data + (runEnd - first));
             fc.advance_to(out);
+            it = runEnd;
         }
     }
     return fc.out();
@@ -2916,26 +3002,30 @@ t_OUT Format_Imp_Processor<t_CHAR>::processImp(
 
 template <class t_CHAR>
 Format_ContextOutputIteratorRef<t_CHAR> Format_Imp_Processor<t_CHAR>::process(
-              Format_ContextOutputIteratorRef<t_CHAR> out,
-              bsl::basic_string_view<t_CHAR>          fmtStr,
+              Format_ContextOutputIteratorRef<t_CHAR>  out,
+              bsl::basic_string_view<t_CHAR>           fmtStr,
               const basic_format_args<
                   basic_format_context<Format_ContextOutputIteratorRef<t_CHAR>,
-                                       t_CHAR> >& args)
+                                       t_CHAR> >&      args,
+              const FormatStringSegment               *segmentsBegin,
+              const FormatStringSegment               *segmentsEnd)
 {
-    processImp(out, fmtStr, args);
+    processImp(out, fmtStr, args, segmentsBegin, segmentsEnd);
     return out;
 }
 
 template <class t_CHAR>
 template <class t_OUT, class t_CONTEXT>
 t_OUT Format_Imp_Processor<t_CHAR>::process(
-                                    t_OUT                               out,
-                                    bsl::basic_string_view<t_CHAR>      fmtStr,
-                                    const basic_format_args<t_CONTEXT>& args)
+                           t_OUT                               out,
+                           bsl::basic_string_view<t_CHAR>      fmtStr,
+                           const basic_format_args<t_CONTEXT>& args,
+                           const FormatStringSegment          *segmentsBegin,
+                           const FormatStringSegment          *segmentsEnd)
 {
     Format_ContextOutputIteratorImpl<t_CHAR, t_OUT> wrappedOut(out);
     Format_ContextOutputIteratorRef<t_CHAR>         wrappedOutRef(&wrappedOut);
-    processImp(wrappedOutRef, fmtStr, args);
+    processImp(wrappedOutRef, fmtStr, args, segmentsBegin, segmentsEnd);
     return out;
 }
 
@@ -3020,7 +3110,12 @@ typename bsl::enable_if<
 format_to(t_OUT                          out,
           BSLFMT_FORMAT_STRING_PARAMETER fmtStr)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args());
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args()),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 0
 
@@ -3033,7 +3128,12 @@ format_to(t_OUT                          out,
           BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
           const t_ARGS_01& args_01)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 1
 
@@ -3048,8 +3148,13 @@ format_to(t_OUT                          out,
           const t_ARGS_01& args_01,
           const t_ARGS_02& args_02)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 2
 
@@ -3066,9 +3171,14 @@ format_to(t_OUT                          out,
           const t_ARGS_02& args_02,
           const t_ARGS_03& args_03)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02,
-                                                                  args_03));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 3
 
@@ -3087,10 +3197,15 @@ format_to(t_OUT                          out,
           const t_ARGS_03& args_03,
           const t_ARGS_04& args_04)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02,
-                                                                  args_03,
-                                                                  args_04));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 4
 
@@ -3111,11 +3226,16 @@ format_to(t_OUT                          out,
           const t_ARGS_04& args_04,
           const t_ARGS_05& args_05)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02,
-                                                                  args_03,
-                                                                  args_04,
-                                                                  args_05));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 5
 
@@ -3138,12 +3258,17 @@ format_to(t_OUT                          out,
           const t_ARGS_05& args_05,
           const t_ARGS_06& args_06)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02,
-                                                                  args_03,
-                                                                  args_04,
-                                                                  args_05,
-                                                                  args_06));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 6
 
@@ -3168,13 +3293,18 @@ format_to(t_OUT                          out,
           const t_ARGS_06& args_06,
           const t_ARGS_07& args_07)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02,
-                                                                  args_03,
-                                                                  args_04,
-                                                                  args_05,
-                                                                  args_06,
-                                                                  args_07));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 7
 
@@ -3201,14 +3331,19 @@ format_to(t_OUT                          out,
           const t_ARGS_07& args_07,
           const t_ARGS_08& args_08)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02,
-                                                                  args_03,
-                                                                  args_04,
-                                                                  args_05,
-                                                                  args_06,
-                                                                  args_07,
-                                                                  args_08));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 8
 
@@ -3237,15 +3372,20 @@ format_to(t_OUT                          out,
           const t_ARGS_08& args_08,
           const t_ARGS_09& args_09)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02,
-                                                                  args_03,
-                                                                  args_04,
-                                                                  args_05,
-                                                                  args_06,
-                                                                  args_07,
-                                                                  args_08,
-                                                                  args_09));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08,
+                                                                   args_09)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 9
 
@@ -3276,16 +3416,21 @@ format_to(t_OUT                          out,
           const t_ARGS_09& args_09,
           const t_ARGS_10& args_10)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                                  args_02,
-                                                                  args_03,
-                                                                  args_04,
-                                                                  args_05,
-                                                                  args_06,
-                                                                  args_07,
-                                                                  args_08,
-                                                                  args_09,
-                                                                  args_10));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08,
+                                                                   args_09,
+                                                                   args_10)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 10
 
@@ -3298,7 +3443,12 @@ typename bsl::enable_if<
 format_to(t_OUT                           out,
           BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args());
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args()),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 0
 
@@ -3311,7 +3461,12 @@ format_to(t_OUT                           out,
           BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
           const t_ARGS_01& args_01)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01));
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 1
 
@@ -3326,8 +3481,13 @@ format_to(t_OUT                           out,
           const t_ARGS_01& args_01,
           const t_ARGS_02& args_02)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                   args_02));
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 2
 
@@ -3344,9 +3504,14 @@ format_to(t_OUT                           out,
           const t_ARGS_02& args_02,
           const t_ARGS_03& args_03)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
                                                                    args_02,
-                                                                   args_03));
+                                                                   args_03)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 3
 
@@ -3365,10 +3530,15 @@ format_to(t_OUT                           out,
           const t_ARGS_03& args_03,
           const t_ARGS_04& args_04)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
                                                                    args_02,
                                                                    args_03,
-                                                                   args_04));
+                                                                   args_04)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 4
 
@@ -3389,11 +3559,16 @@ format_to(t_OUT                           out,
           const t_ARGS_04& args_04,
           const t_ARGS_05& args_05)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
                                                                    args_02,
                                                                    args_03,
                                                                    args_04,
-                                                                   args_05));
+                                                                   args_05)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 5
 
@@ -3416,12 +3591,17 @@ format_to(t_OUT                           out,
           const t_ARGS_05& args_05,
           const t_ARGS_06& args_06)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
                                                                    args_02,
                                                                    args_03,
                                                                    args_04,
                                                                    args_05,
-                                                                   args_06));
+                                                                   args_06)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 6
 
@@ -3446,13 +3626,18 @@ format_to(t_OUT                           out,
           const t_ARGS_06& args_06,
           const t_ARGS_07& args_07)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
                                                                    args_02,
                                                                    args_03,
                                                                    args_04,
                                                                    args_05,
                                                                    args_06,
-                                                                   args_07));
+                                                                   args_07)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 7
 
@@ -3479,14 +3664,19 @@ format_to(t_OUT                           out,
           const t_ARGS_07& args_07,
           const t_ARGS_08& args_08)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
                                                                    args_02,
                                                                    args_03,
                                                                    args_04,
                                                                    args_05,
                                                                    args_06,
                                                                    args_07,
-                                                                   args_08));
+                                                                   args_08)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 8
 
@@ -3515,7 +3705,10 @@ format_to(t_OUT                           out,
           const t_ARGS_08& args_08,
           const t_ARGS_09& args_09)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
                                                                    args_02,
                                                                    args_03,
                                                                    args_04,
@@ -3523,7 +3716,9 @@ format_to(t_OUT                           out,
                                                                    args_06,
                                                                    args_07,
                                                                    args_08,
-                                                                   args_09));
+                                                                   args_09)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 9
 
@@ -3554,7 +3749,10 @@ format_to(t_OUT                           out,
           const t_ARGS_09& args_09,
           const t_ARGS_10& args_10)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args_01,
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
                                                                    args_02,
                                                                    args_03,
                                                                    args_04,
@@ -3563,7 +3761,9 @@ format_to(t_OUT                           out,
                                                                    args_07,
                                                                    args_08,
                                                                    args_09,
-                                                                   args_10));
+                                                                   args_10)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 10
 
@@ -3572,9 +3772,12 @@ format_to(t_OUT                           out,
 void format_to(bsl::string                    *out,
                BSLFMT_FORMAT_STRING_PARAMETER  fmtStr)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args());
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args()),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 0
 
@@ -3584,9 +3787,12 @@ void format_to(bsl::string                    *out,
                BSLFMT_FORMAT_STRING_PARAMETER  fmtStr,
                const t_ARGS_01& args_01)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 1
 
@@ -3598,10 +3804,13 @@ void format_to(bsl::string                    *out,
                const t_ARGS_01& args_01,
                const t_ARGS_02& args_02)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 2
 
@@ -3615,11 +3824,14 @@ void format_to(bsl::string                    *out,
                const t_ARGS_02& args_02,
                const t_ARGS_03& args_03)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02,
-                                        args_03));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 3
 
@@ -3635,12 +3847,15 @@ void format_to(bsl::string                    *out,
                const t_ARGS_03& args_03,
                const t_ARGS_04& args_04)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02,
-                                        args_03,
-                                        args_04));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 4
 
@@ -3658,13 +3873,16 @@ void format_to(bsl::string                    *out,
                const t_ARGS_04& args_04,
                const t_ARGS_05& args_05)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02,
-                                        args_03,
-                                        args_04,
-                                        args_05));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 5
 
@@ -3684,14 +3902,17 @@ void format_to(bsl::string                    *out,
                const t_ARGS_05& args_05,
                const t_ARGS_06& args_06)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02,
-                                        args_03,
-                                        args_04,
-                                        args_05,
-                                        args_06));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 6
 
@@ -3713,15 +3934,18 @@ void format_to(bsl::string                    *out,
                const t_ARGS_06& args_06,
                const t_ARGS_07& args_07)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02,
-                                        args_03,
-                                        args_04,
-                                        args_05,
-                                        args_06,
-                                        args_07));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 7
 
@@ -3745,16 +3969,19 @@ void format_to(bsl::string                    *out,
                const t_ARGS_07& args_07,
                const t_ARGS_08& args_08)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02,
-                                        args_03,
-                                        args_04,
-                                        args_05,
-                                        args_06,
-                                        args_07,
-                                        args_08));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 8
 
@@ -3780,17 +4007,20 @@ void format_to(bsl::string                    *out,
                const t_ARGS_08& args_08,
                const t_ARGS_09& args_09)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02,
-                                        args_03,
-                                        args_04,
-                                        args_05,
-                                        args_06,
-                                        args_07,
-                                        args_08,
-                                        args_09));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08,
+                                                                   args_09)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 9
 
@@ -3818,18 +4048,21 @@ void format_to(bsl::string                    *out,
                const t_ARGS_09& args_09,
                const t_ARGS_10& args_10)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args_01,
-                                        args_02,
-                                        args_03,
-                                        args_04,
-                                        args_05,
-                                        args_06,
-                                        args_07,
-                                        args_08,
-                                        args_09,
-                                        args_10));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08,
+                                                                   args_09,
+                                                                   args_10)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 10
 
@@ -3838,9 +4071,12 @@ void format_to(bsl::string                    *out,
 void format_to(bsl::wstring                    *out,
                BSLFMT_FORMAT_WSTRING_PARAMETER  fmtStr)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args());
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args()),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 0
 
@@ -3850,9 +4086,12 @@ void format_to(bsl::wstring                    *out,
                BSLFMT_FORMAT_WSTRING_PARAMETER  fmtStr,
                const t_ARGS_01& args_01)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 1
 
@@ -3864,10 +4103,13 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_01& args_01,
                const t_ARGS_02& args_02)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 2
 
@@ -3881,11 +4123,14 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_02& args_02,
                const t_ARGS_03& args_03)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02,
-                                         args_03));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02,
+                                                                   args_03)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 3
 
@@ -3901,12 +4146,15 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_03& args_03,
                const t_ARGS_04& args_04)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02,
-                                         args_03,
-                                         args_04));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 4
 
@@ -3924,13 +4172,16 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_04& args_04,
                const t_ARGS_05& args_05)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02,
-                                         args_03,
-                                         args_04,
-                                         args_05));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 5
 
@@ -3950,14 +4201,17 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_05& args_05,
                const t_ARGS_06& args_06)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02,
-                                         args_03,
-                                         args_04,
-                                         args_05,
-                                         args_06));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 6
 
@@ -3979,15 +4233,18 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_06& args_06,
                const t_ARGS_07& args_07)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02,
-                                         args_03,
-                                         args_04,
-                                         args_05,
-                                         args_06,
-                                         args_07));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 7
 
@@ -4011,16 +4268,19 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_07& args_07,
                const t_ARGS_08& args_08)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02,
-                                         args_03,
-                                         args_04,
-                                         args_05,
-                                         args_06,
-                                         args_07,
-                                         args_08));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 8
 
@@ -4046,17 +4306,20 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_08& args_08,
                const t_ARGS_09& args_09)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02,
-                                         args_03,
-                                         args_04,
-                                         args_05,
-                                         args_06,
-                                         args_07,
-                                         args_08,
-                                         args_09));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08,
+                                                                   args_09)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 9
 
@@ -4084,18 +4347,21 @@ void format_to(bsl::wstring                    *out,
                const t_ARGS_09& args_09,
                const t_ARGS_10& args_10)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args_01,
-                                         args_02,
-                                         args_03,
-                                         args_04,
-                                         args_05,
-                                         args_06,
-                                         args_07,
-                                         args_08,
-                                         args_09,
-                                         args_10));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args_01,
+                                                                   args_02,
+                                                                   args_03,
+                                                                   args_04,
+                                                                   args_05,
+                                                                   args_06,
+                                                                   args_07,
+                                                                   args_08,
+                                                                   args_09,
+                                                                   args_10)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 10
 
@@ -4104,7 +4370,7 @@ void format_to(bsl::wstring                    *out,
 bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args());
+    bslfmt::format_to(&result, fmtStr);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 0
@@ -4115,7 +4381,7 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_01& args_01)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01));
+    bslfmt::format_to(&result, fmtStr, args_01);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 1
@@ -4128,8 +4394,8 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_02& args_02)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 2
@@ -4144,9 +4410,9 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_03& args_03)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 3
@@ -4163,10 +4429,10 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_04& args_04)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 4
@@ -4185,11 +4451,11 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_05& args_05)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 5
@@ -4210,12 +4476,12 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_06& args_06)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 6
@@ -4238,13 +4504,13 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_07& args_07)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06,
-                                                               args_07));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 7
@@ -4269,14 +4535,14 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_08& args_08)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06,
-                                                               args_07,
-                                                               args_08));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 8
@@ -4303,15 +4569,15 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_09& args_09)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06,
-                                                               args_07,
-                                                               args_08,
-                                                               args_09));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08,
+                                       args_09);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 9
@@ -4340,16 +4606,16 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
                                                       const t_ARGS_10& args_10)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06,
-                                                               args_07,
-                                                               args_08,
-                                                               args_09,
-                                                               args_10));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08,
+                                       args_09,
+                                       args_10);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 10
@@ -4359,7 +4625,7 @@ bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
 bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args());
+    bslfmt::format_to(&result, fmtStr);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 0
@@ -4370,7 +4636,7 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_01& args_01)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01));
+    bslfmt::format_to(&result, fmtStr, args_01);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 1
@@ -4383,8 +4649,8 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_02& args_02)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 2
@@ -4399,9 +4665,9 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_03& args_03)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 3
@@ -4418,10 +4684,10 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_04& args_04)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 4
@@ -4440,11 +4706,11 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_05& args_05)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 5
@@ -4465,12 +4731,12 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_06& args_06)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 6
@@ -4493,13 +4759,13 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_07& args_07)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06,
-                                                                args_07));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 7
@@ -4524,14 +4790,14 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_08& args_08)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06,
-                                                                args_07,
-                                                                args_08));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 8
@@ -4558,15 +4824,15 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_09& args_09)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06,
-                                                                args_07,
-                                                                args_08,
-                                                                args_09));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08,
+                                       args_09);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 9
@@ -4595,16 +4861,16 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS_10& args_10)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06,
-                                                                args_07,
-                                                                args_08,
-                                                                args_09,
-                                                                args_10));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08,
+                                       args_09,
+                                       args_10);
     return result;
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 10
@@ -4615,7 +4881,7 @@ bsl::string format(bsl::allocator<char>           alloc,
                    BSLFMT_FORMAT_STRING_PARAMETER fmtStr)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args());
+    bslfmt::format_to(&result, fmtStr);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 0
@@ -4627,7 +4893,7 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_01& args_01)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01));
+    bslfmt::format_to(&result, fmtStr, args_01);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 1
@@ -4641,8 +4907,8 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_02& args_02)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 2
@@ -4658,9 +4924,9 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_03& args_03)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 3
@@ -4678,10 +4944,10 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_04& args_04)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 4
@@ -4701,11 +4967,11 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_05& args_05)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 5
@@ -4727,12 +4993,12 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_06& args_06)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 6
@@ -4756,13 +5022,13 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_07& args_07)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06,
-                                                               args_07));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 7
@@ -4788,14 +5054,14 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_08& args_08)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06,
-                                                               args_07,
-                                                               args_08));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 8
@@ -4823,15 +5089,15 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_09& args_09)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06,
-                                                               args_07,
-                                                               args_08,
-                                                               args_09));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08,
+                                       args_09);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 9
@@ -4861,16 +5127,16 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS_10& args_10)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args_01,
-                                                               args_02,
-                                                               args_03,
-                                                               args_04,
-                                                               args_05,
-                                                               args_06,
-                                                               args_07,
-                                                               args_08,
-                                                               args_09,
-                                                               args_10));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08,
+                                       args_09,
+                                       args_10);
     return bsl::string(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 10
@@ -4881,7 +5147,7 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args());
+    bslfmt::format_to(&result, fmtStr);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 0
@@ -4893,7 +5159,7 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_01& args_01)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01));
+    bslfmt::format_to(&result, fmtStr, args_01);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 1
@@ -4907,8 +5173,8 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_02& args_02)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 2
@@ -4924,9 +5190,9 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_03& args_03)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 3
@@ -4944,10 +5210,10 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_04& args_04)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 4
@@ -4967,11 +5233,11 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_05& args_05)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 5
@@ -4993,12 +5259,12 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_06& args_06)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 6
@@ -5022,13 +5288,13 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_07& args_07)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06,
-                                                                args_07));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 7
@@ -5054,14 +5320,14 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_08& args_08)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06,
-                                                                args_07,
-                                                                args_08));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 8
@@ -5089,15 +5355,15 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_09& args_09)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06,
-                                                                args_07,
-                                                                args_08,
-                                                                args_09));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08,
+                                       args_09);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 9
@@ -5127,16 +5393,16 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS_10& args_10)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args_01,
-                                                                args_02,
-                                                                args_03,
-                                                                args_04,
-                                                                args_05,
-                                                                args_06,
-                                                                args_07,
-                                                                args_08,
-                                                                args_09,
-                                                                args_10));
+    bslfmt::format_to(&result, fmtStr, args_01,
+                                       args_02,
+                                       args_03,
+                                       args_04,
+                                       args_05,
+                                       args_06,
+                                       args_07,
+                                       args_08,
+                                       args_09,
+                                       args_10);
     return bsl::wstring(result, alloc);
 }
 #endif  // BSLFMT_FORMAT_IMP_VARIADIC_LIMIT_B >= 10
@@ -6615,7 +6881,12 @@ format_to(t_OUT                          out,
           BSLFMT_FORMAT_STRING_PARAMETER fmtStr,
           const t_ARGS&...               args)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_format_args(args...));
+    return Format_Imp_Processor<char>::process(
+                                      out,
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args...)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 
 template <class t_OUT, class... t_ARGS>
@@ -6626,7 +6897,12 @@ format_to(t_OUT                           out,
           BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
           const t_ARGS&...                args)
 {
-    return vformat_to(out, fmtStr.get(), bslfmt::make_wformat_args(args...));
+    return Format_Imp_Processor<wchar_t>::process(
+                                    out,
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args...)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 
 template <class... t_ARGS>
@@ -6634,9 +6910,12 @@ void format_to(bsl::string                    *out,
                BSLFMT_FORMAT_STRING_PARAMETER  fmtStr,
                const t_ARGS&...                args)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_format_args(args...));
+    Format_Imp_Processor<char>::process(
+                                      bsl::back_inserter(*out),
+                                      fmtStr.get(),
+                                      format_args(make_format_args(args...)),
+                                      fmtStr.segmentsBegin(),
+                                      fmtStr.segmentsEnd());
 }
 
 template <class... t_ARGS>
@@ -6644,16 +6923,19 @@ void format_to(bsl::wstring                    *out,
                BSLFMT_FORMAT_WSTRING_PARAMETER  fmtStr,
                const t_ARGS&...                 args)
 {
-    vformat_to(bsl::back_inserter(*out),
-               fmtStr.get(),
-               bslfmt::make_wformat_args(args...));
+    Format_Imp_Processor<wchar_t>::process(
+                                    bsl::back_inserter(*out),
+                                    fmtStr.get(),
+                                    wformat_args(make_wformat_args(args...)),
+                                    fmtStr.segmentsBegin(),
+                                    fmtStr.segmentsEnd());
 }
 
 template <class... t_ARGS>
 bsl::string format(BSLFMT_FORMAT_STRING_PARAMETER fmtStr, const t_ARGS&...args)
 {
     bsl::string result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args...));
+    bslfmt::format_to(&result, fmtStr, args...);
     return result;
 }
 
@@ -6662,7 +6944,7 @@ bsl::wstring format(BSLFMT_FORMAT_WSTRING_PARAMETER fmtStr,
                     const t_ARGS&...                args)
 {
     bsl::wstring result;
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args...));
+    bslfmt::format_to(&result, fmtStr, args...);
     return result;
 }
 
@@ -6672,7 +6954,7 @@ bsl::string format(bsl::allocator<char>           alloc,
                    const t_ARGS&...               args)
 {
     bsl::string result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_format_args(args...));
+    bslfmt::format_to(&result, fmtStr, args...);
     return bsl::string(result, alloc);
 }
 
@@ -6682,7 +6964,7 @@ bsl::wstring format(bsl::allocator<wchar_t>         alloc,
                     const t_ARGS&...                args)
 {
     bsl::wstring result(alloc);
-    vformat_to(&result, fmtStr.get(), bslfmt::make_wformat_args(args...));
+    bslfmt::format_to(&result, fmtStr, args...);
     return bsl::wstring(result, alloc);
 }
 
@@ -27,9 +27,21 @@ BSLS_IDENT("$Id: $")
 // * Under C++17 and earlier, by limiting construction to a `const t_CHAR*` we
 //   can limit the number of scenarios which would fail to compile under C++20
 //   but succeed under earlier versions.
-// * It is possible to perform compile-time checking of the format string when
-//   compiled under C++20, in the same way as `std::format_string` (not yet
-//   implemented).
+// * Under C++20 the format string is split into its literal text and
+//   replacement fields at compile time (see `bslfmt_formatstringparser`), so
+//   that the `bslfmt::format` family of functions need not re-scan it on every
+//   call.
+//
+// Unlike `std::format_string`, this type does not check the format
+// specifications against the argument types at compile time, as the `parse`
+// method of a `formatter` is not required to be `constexpr`.  An invalid
+// format string is reported by the formatting functions, which throw
+// `format_error`.
+//
+// Under C++20 the segments are stored within the object, which has room for
+// one more segment than there are arguments: enough for any format string
+// that uses each argument once and has no escaped braces.  Longer format
+// strings are scanned by the formatting functions on every call.
 //
 // Suppression of the argument deduction that would normally result in a
 // compile-time error requires that we use intermediate template aliases for
@@ -82,6 +94,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslscm_version.h>
 
+#include <bslfmt_formatstringparser.h>
+
 #include <bsls_compilerfeatures.h>
 #include <bsls_libraryfeatures.h>
 #include <bsls_keyword.h>
@@ -110,18 +124,32 @@ struct Format_String_TestUpdater;
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP20_BASELINE_LIBRARY)
 
 /// Type that wraps a `basic_string_view` for use by formatting function.  The
-/// constructor performs additional compile-time checks of the format string
-/// provided (not yet implemented).
+/// constructor splits the format string provided into segments that the
+/// formatting functions can process without re-scanning the string.
 template <class t_CHAR, class... t_ARGS>
 class basic_format_string {
   private:
+    // PRIVATE TYPES
+    typedef FormatStringSegmentBuffer<sizeof...(t_ARGS) + 1> SegmentBuffer;
+
     // DATA
     bsl::basic_string_view<t_CHAR> d_formatString;  // the wrapped string
 
+    SegmentBuffer                  d_segments;      // `d_formatString` split
+                                                    // at compile time
+
     // FRIENDS
     template <class t_INNER_CHAR>
     friend struct Format_String_TestUpdater;
 
+    // PRIVATE MANIPULATORS
+
+    /// Split `d_formatString` into `d_segments`.  Leave `d_segments` not
+    /// compiled if the string is malformed (so that the error is reported by
+    /// the formatting functions) or has more segments than `d_segments` can
+    /// hold.
+    constexpr void compile();
+
   public:
     // CREATORS
 
@@ -139,6 +167,16 @@ class basic_format_string {
 
     /// Return the wrapped `basic_string_view` contained by this instance.
     BSLS_KEYWORD_CONSTEXPR bsl::basic_string_view<t_CHAR> get() const;
+
+    /// Return the address of the first of the segments into which the
+    /// wrapped string was split at compile time, or 0 if the string could not
+    /// be split (e.g., because it is malformed).
+    constexpr const FormatStringSegment *segmentsBegin() const;
+
+    /// Return the address one past the last of the segments into which the
+    /// wrapped string was split at compile time, or 0 if the string could not
+    /// be split (e.g., because it is malformed).
+    constexpr const FormatStringSegment *segmentsEnd() const;
 };
 
 #elif defined(BSLS_COMPILERFEATURES_SUPPORT_ALIAS_TEMPLATES) &&               \
@@ -164,6 +202,14 @@ class basic_format_string {
 
     /// Return the wrapped `basic_string_view` contained by this instance.
     BSLS_KEYWORD_CONSTEXPR bsl::basic_string_view<t_CHAR> get() const;
+
+    /// Return 0, as the wrapped string is not split at compile time prior to
+    /// C++20.
+    BSLS_KEYWORD_CONSTEXPR const FormatStringSegment *segmentsBegin() const;
+
+    /// Return 0, as the wrapped string is not split at compile time prior to
+    /// C++20.
+    BSLS_KEYWORD_CONSTEXPR const FormatStringSegment *segmentsEnd() const;
 };
 
 #else // C++03
@@ -188,6 +234,14 @@ class basic_format_string {
 
     /// Return the wrapped `basic_string_view` contained by this instance.
     BSLS_KEYWORD_CONSTEXPR bsl::basic_string_view<t_CHAR> get() const;
+
+    /// Return 0, as the wrapped string is not split at compile time prior to
+    /// C++20.
+    BSLS_KEYWORD_CONSTEXPR const FormatStringSegment *segmentsBegin() const;
+
+    /// Return 0, as the wrapped string is not split at compile time prior to
+    /// C++20.
+    BSLS_KEYWORD_CONSTEXPR const FormatStringSegment *segmentsEnd() const;
 };
 
 #endif
@@ -223,12 +277,12 @@ template <class t_CHAR>
 struct Format_String_TestUpdater
 {
     /// Update the string contained in the specified `out` to the specified
-    /// `value`.
+    /// `value`, re-splitting it into segments where `out` holds them.
     template <class t_FORMATSTRING>
     static void update(t_FORMATSTRING *out, const t_CHAR *value);
 
     /// Update the string contained in the specified `out` to the specified
-    /// `value`.
+    /// `value`, re-splitting it into segments where `out` holds them.
     template <class t_FORMATSTRING>
     static void update(t_FORMATSTRING                 *out,
                        bsl::basic_string_view<t_CHAR>  value);
@@ -251,6 +305,18 @@ consteval basic_format_string<t_CHAR, t_ARGS...>::basic_format_string(
                                                               const t_STR& str)
 : d_formatString(str)
 {
+    compile();
+}
+
+// PRIVATE MANIPULATORS
+template <class t_CHAR, class... t_ARGS>
+constexpr void basic_format_string<t_CHAR, t_ARGS...>::compile()
+{
+    d_segments.clear();
+    if (FormatStringParserEnums::e_SUCCESS !=
+              FormatStringParser<t_CHAR>::parse(&d_segments, d_formatString)) {
+        d_segments.reset();
+    }
 }
 
 // ACCESSORS
@@ -262,6 +328,22 @@ basic_format_string<t_CHAR, t_ARGS...>::get() const
     return d_formatString;
 }
 
+template <class t_CHAR, class... t_ARGS>
+inline
+constexpr const FormatStringSegment *
+basic_format_string<t_CHAR, t_ARGS...>::segmentsBegin() const
+{
+    return d_segments.begin();
+}
+
+template <class t_CHAR, class... t_ARGS>
+inline
+constexpr const FormatStringSegment *
+basic_format_string<t_CHAR, t_ARGS...>::segmentsEnd() const
+{
+    return d_segments.end();
+}
+
 #elif defined(BSLS_COMPILERFEATURES_SUPPORT_ALIAS_TEMPLATES) &&               \
     defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
 
@@ -280,6 +362,22 @@ basic_format_string<t_CHAR, t_ARGS...>::get() const
     return d_formatString;
 }
 
+template <class t_CHAR, class... t_ARGS>
+inline
+BSLS_KEYWORD_CONSTEXPR const FormatStringSegment *
+basic_format_string<t_CHAR, t_ARGS...>::segmentsBegin() const
+{
+    return 0;
+}
+
+template <class t_CHAR, class... t_ARGS>
+inline
+BSLS_KEYWORD_CONSTEXPR const FormatStringSegment *
+basic_format_string<t_CHAR, t_ARGS...>::segmentsEnd() const
+{
+    return 0;
+}
+
 #else // C++03
 
 template <class t_CHAR>
@@ -297,6 +395,22 @@ basic_format_string<t_CHAR>::get() const
     return d_formatString;
 }
 
+template <class t_CHAR>
+inline
+BSLS_KEYWORD_CONSTEXPR const FormatStringSegment *
+basic_format_string<t_CHAR>::segmentsBegin() const
+{
+    return 0;
+}
+
+template <class t_CHAR>
+inline
+BSLS_KEYWORD_CONSTEXPR const FormatStringSegment *
+basic_format_string<t_CHAR>::segmentsEnd() const
+{
+    return 0;
+}
+
 #endif
 
                      // -------------------------------
@@ -308,7 +422,7 @@ template <class t_FORMATSTRING>
 void Format_String_TestUpdater<t_CHAR>::update(t_FORMATSTRING *out,
                                                const t_CHAR   *value)
 {
-    out->d_formatString = value;
+    update(out, bsl::basic_string_view<t_CHAR>(value));
 }
 
 template <class t_CHAR>
@@ -318,6 +432,9 @@ void Format_String_TestUpdater<t_CHAR>::update(
                                          bsl::basic_string_view<t_CHAR>  value)
 {
     out->d_formatString = value;
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP20_BASELINE_LIBRARY)
+    out->compile();
+#endif
 }
 
 }  // close package namespace
@@ -35,7 +35,9 @@ using namespace BloombergLP;
 // [ 9] operator=(const basic_format_string &);
 //
 // ACCESSORS
-// [ 4] TBD
+// [ 4] bsl::basic_string_view<t_CHAR> get() const;
+// [ 4] const FormatStringSegment *segmentsBegin() const;
+// [ 4] const FormatStringSegment *segmentsEnd() const;
 //
 // FREE FUNCTIONS
 // [ 8] swap(basic_format_string &, basic_format_string &);
@@ -351,19 +353,128 @@ int main(int argc, char **argv)
                    "\n======================\n");
       } break;
       case 4: {
-        // --------------------------------------------
+        // --------------------------------------------------------------------
         // TESTING BASIC ACCESSORS
         //
         // Concerns:
+        //: 1 `get` returns the wrapped string.
+        //:
+        //: 2 Under C++20 a well-formed string is split into segments at
+        //:   compile time, and `segmentsBegin` and `segmentsEnd` return the
+        //:   bounds of those segments.
+        //:
+        //: 3 Under C++20 a malformed string, or one having too many segments,
+        //:   still compiles, and both segment accessors return 0.
+        //:
+        //: 4 Prior to C++20 both segment accessors return 0.
+        //:
+        //: 5 `Format_String_TestUpdater` re-splits the updated string.
+        //:
+        //: 6 Under C++20 an object has room for one more segment than there
+        //:   are arguments, and so its size grows with the number of
+        //:   arguments.
         //
         // Plan:
+        //: 1 Construct objects from literals and check the accessors.
+        //:   (C-1..4)
+        //:
+        //: 2 Update an object with `Format_String_TestUpdater` and check the
+        //:   accessors again.  (C-5)
+        //:
+        //: 3 Construct objects from strings having one more, and two more,
+        //:   segments than arguments, and check the accessors.  Compare the
+        //:   sizes of objects for different numbers of arguments.  (C-6)
         //
         // Testing:
-        //   TBD
-        // --------------------------------------------
+        //   bsl::basic_string_view<t_CHAR> get() const;
+        //   const FormatStringSegment *segmentsBegin() const;
+        //   const FormatStringSegment *segmentsEnd() const;
+        // --------------------------------------------------------------------
         if (verbose)
             printf("\nTESTING BASIC ACCESSORS"
                    "\n=======================\n");
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_ALIAS_TEMPLATES) &&                 \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        typedef bslfmt::format_string<int, int>  FormatString;
+        typedef bslfmt::wformat_string<int, int> WFormatString;
+#else
+        typedef bslfmt::format_string            FormatString;
+        typedef bslfmt::wformat_string           WFormatString;
+#endif
+
+        const FormatString  X("a{}b{1:>4}");
+        const WFormatString WX(L"{{{}}}");
+        const FormatString  BAD("{:}}");
+        const FormatString  LONG("{}{}{}{}{}{}{}{}{}");
+
+        ASSERT(X.get()    == "a{}b{1:>4}");
+        ASSERT(WX.get()   == L"{{{}}}");
+        ASSERT(BAD.get()  == "{:}}");
+        ASSERT(LONG.get() == "{}{}{}{}{}{}{}{}{}");
+
+        ASSERT(0 == BAD.segmentsBegin());
+        ASSERT(0 == BAD.segmentsEnd());
+        ASSERT(0 == LONG.segmentsBegin());
+        ASSERT(0 == LONG.segmentsEnd());
+
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP20_BASELINE_LIBRARY)
+        ASSERT(0 != X.segmentsBegin());
+        ASSERT(2 == X.segmentsEnd() - X.segmentsBegin());
+        ASSERT(bslfmt::FormatStringSegment::k_AUTOMATIC_ID ==
+                                                 X.segmentsBegin()[0].d_argId);
+        ASSERT(1 == X.segmentsBegin()[1].d_argId);
+        ASSERT(7 == X.segmentsBegin()[1].d_specBegin);
+        ASSERT(9 == X.segmentsBegin()[1].d_specEnd);
+
+        ASSERT(0 != WX.segmentsBegin());
+        ASSERT(3 == WX.segmentsEnd() - WX.segmentsBegin());
+#else
+        ASSERT(0 == X.segmentsBegin());
+        ASSERT(0 == X.segmentsEnd());
+        ASSERT(0 == WX.segmentsBegin());
+        ASSERT(0 == WX.segmentsEnd());
+#endif
+
+        if (verbose) printf("\tTesting `Format_String_TestUpdater`.\n");
+        {
+            FormatString mY("{}");  const FormatString& Y = mY;
+
+            bslfmt::Format_String_TestUpdater<char>::update(&mY, "{:}}");
+
+            ASSERT(Y.get() == "{:}}");
+            ASSERT(0       == Y.segmentsBegin());
+
+            bslfmt::Format_String_TestUpdater<char>::update(&mY, "x{}y{}");
+
+            ASSERT(Y.get() == "x{}y{}");
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP20_BASELINE_LIBRARY)
+            ASSERT(2 == Y.segmentsEnd() - Y.segmentsBegin());
+#else
+            ASSERT(0 == Y.segmentsBegin());
+#endif
+        }
+
+        if (verbose) printf("\tTesting segment capacity.\n");
+        {
+            const FormatString FITS("{}{}{}");
+            const FormatString OVER("{}{}{}{}");
+
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP20_BASELINE_LIBRARY)
+            ASSERT(3 == FITS.segmentsEnd() - FITS.segmentsBegin());
+
+            typedef bslfmt::format_string<int> OneArgString;
+            typedef bslfmt::format_string<int, int, int, int, int, int, int,
+                                          int> EightArgString;
+
+            ASSERT(sizeof(OneArgString) < sizeof(FormatString));
+            ASSERT(sizeof(FormatString) < sizeof(EightArgString));
+#else
+            ASSERT(0 == FITS.segmentsBegin());
+#endif
+            ASSERT(0 == OVER.segmentsBegin());
+            ASSERT(0 == OVER.segmentsEnd());
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
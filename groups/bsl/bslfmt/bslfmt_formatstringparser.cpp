@@ -0,0 +1,48 @@
+// bslfmt_formatstringparser.cpp                                      -*-C++-*-
+
+#include <bslfmt_formatstringparser.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslfmt_formatstringparser_cpp, "$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bslfmt {
+
+                       // ------------------------------
+                       // struct FormatStringParserEnums
+                       // ------------------------------
+
+// CLASS METHODS
+const char *FormatStringParserEnums::toAscii(Status status)
+{
+    switch (status) {
+      case e_SUCCESS:               return "success";
+      case e_UNMATCHED_OPEN_BRACE:  return "unmatched {";
+      case e_UNESCAPED_CLOSE_BRACE: return "} must be escaped";
+      case e_MISSING_SEPARATOR:     return "Separator ':' missing";
+      case e_UNTERMINATED_FIELD:    return "unterminated replacement field";
+      case e_ARG_ID_TOO_LARGE:      return "arg id too large";
+      case e_STRING_TOO_LONG:       return "format string too long";
+      case e_CAPACITY_EXCEEDED:     return "too many segments";
+    }
+    return "(* UNKNOWN *)";
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,501 @@
+// bslfmt_formatstringparser.h                                        -*-C++-*-
+
+#ifndef INCLUDED_BSLFMT_FORMATSTRINGPARSER
+#define INCLUDED_BSLFMT_FORMATSTRINGPARSER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a utility to split a format string into its segments.
+//
+//@CLASSES:
+//  bslfmt::FormatStringSegment: literal text and replacement field offsets
+//  bslfmt::FormatStringSegmentBuffer: fixed-capacity sequence of segments
+//  bslfmt::FormatStringParserEnums: namespace for format string parse status
+//  bslfmt::FormatStringParser: utility to split format strings into segments
+//
+//@SEE_ALSO: bslfmt_format_string, bslfmt_format_imp, bslfmt_compiledformat
+//
+//@DESCRIPTION: This component provides a utility, `FormatStringParser`, that
+// performs the top-level scan of a format string (as described by
+// [format.string] in the Standard) once, and records the result as a sequence
+// of `FormatStringSegment` objects.  Each segment describes a run of literal
+// text (with `{{` and `}}` escapes already resolved) optionally followed by a
+// single replacement field, the latter given as an argument id and the
+// offsets of its (unparsed) format specification.  The formatting loop in
+// `bslfmt_format_imp` can then write each literal run in a single operation
+// and jump straight to the format specification of each field, instead of
+// re-scanning the format string character by character on every call.
+//
+// The format specifications themselves are *not* validated: they are left to
+// the `parse` method of the `formatter` of the corresponding argument type,
+// which is called when formatting.  (Although the argument types are known at
+// compile time, `formatter::parse` is not required to be `constexpr`, so the
+// specifications cannot, in general, be checked by a `consteval` function.)
+// Nor does the parser know the number of arguments, so argument ids are
+// range-checked only when formatting.
+//
+// `FormatStringParser::parse` is `constexpr` (from C++14 onwards) so that it
+// can run inside the `consteval` constructor of `bslfmt::basic_format_string`.
+// Segments are delivered to a caller-supplied "sink", which is any type
+// providing a `constexpr` member function:
+// ```
+// bool append(const FormatStringSegment& segment);
+// ```
+// that returns `false` if the segment cannot be stored.
+// `FormatStringSegmentBuffer` is such a sink, whose fixed capacity is a
+// template parameter, suitable for embedding in objects created at compile
+// time.
+//
+// Offsets are stored as `int`, so format strings longer than `INT_MAX`
+// characters are rejected with `e_STRING_TOO_LONG`.
+//
+// This component is for use within `bslfmt` only.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Splitting a Format String
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we want to see how a format string will be processed.  First, we
+// parse it into a buffer:
+// ```
+// bslfmt::FormatStringSegmentBuffer<8> buffer;
+// buffer.clear();
+//
+// int rc = bslfmt::FormatStringParser<char>::parse(&buffer,
+//                                                  "x={0:>4} {{y}}={1}");
+// assert(bslfmt::FormatStringParserEnums::e_SUCCESS == rc);
+// assert(4 == buffer.size());
+// ```
+// Then, we inspect the segments.  The first holds the literal "x=" followed
+// by the field with id 0, whose specification is ">4":
+// ```
+// const bslfmt::FormatStringSegment *segment = buffer.begin();
+// assert(0 == segment->d_literalBegin);
+// assert(2 == segment->d_literalEnd);
+// assert(0 == segment->d_argId);
+// assert(5 == segment->d_specBegin);
+// assert(7 == segment->d_specEnd);
+// ```
+// Next, the escaped braces are split so that each segment refers to a
+// contiguous run of the original string ending with a single brace:
+// ```
+// ++segment;
+// assert(8  == segment->d_literalBegin);         // " {"
+// assert(10 == segment->d_literalEnd);
+// assert(bslfmt::FormatStringSegment::k_NO_FIELD == segment->d_argId);
+//
+// ++segment;
+// assert(11 == segment->d_literalBegin);         // "y}"
+// assert(13 == segment->d_literalEnd);
+// assert(bslfmt::FormatStringSegment::k_NO_FIELD == segment->d_argId);
+// ```
+// Finally, the last segment holds "=" and the field with id 1, which has an
+// empty specification:
+// ```
+// ++segment;
+// assert(14 == segment->d_literalBegin);
+// assert(15 == segment->d_literalEnd);
+// assert(1  == segment->d_argId);
+// assert(segment->d_specBegin == segment->d_specEnd);
+// ```
+// An invalid format string is reported through the return value:
+// ```
+// buffer.clear();
+// rc = bslfmt::FormatStringParser<char>::parse(&buffer, "{0");
+// assert(bslfmt::FormatStringParserEnums::e_UNMATCHED_OPEN_BRACE == rc);
+// ```
+
+#include <bslscm_version.h>
+
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <bslstl_stringview.h>
+
+#include <limits.h>             // 'INT_MAX'
+
+namespace BloombergLP {
+namespace bslfmt {
+
+                         // ==========================
+                         // struct FormatStringSegment
+                         // ==========================
+
+/// This simple aggregate describes a run of literal text within a format
+/// string followed, optionally, by a single replacement field.  All offsets
+/// are in characters from the start of the format string.
+struct FormatStringSegment {
+    // TYPES
+    enum {
+        k_NO_FIELD       = -2,  // `d_argId` value: no replacement field
+        k_AUTOMATIC_ID   = -1   // `d_argId` value: automatic numbering
+    };
+
+    // PUBLIC DATA
+    int d_literalBegin;  // offset of the first literal character
+    int d_literalEnd;    // offset one past the last literal character
+    int d_argId;         // manual id, `k_AUTOMATIC_ID` or `k_NO_FIELD`
+    int d_specBegin;     // offset of the format specification
+    int d_specEnd;       // offset of the closing `}` of the field
+};
+
+                      // ===============================
+                      // class FormatStringSegmentBuffer
+                      // ===============================
+
+/// This class provides a fixed-capacity, `constexpr`-usable sequence of
+/// `FormatStringSegment` objects that can be used as the sink of
+/// `FormatStringParser::parse`.  A buffer is either *compiled*, holding the
+/// complete segment sequence of some format string, or not, in which case
+/// the sequence is unusable (e.g., because the format string was invalid or
+/// had too many segments).  A default-constructed buffer is not compiled.
+/// The maximum number of segments held is given by the (template parameter)
+/// `t_CAPACITY`, which must be positive.
+template <int t_CAPACITY>
+class FormatStringSegmentBuffer {
+  public:
+    // TYPES
+    enum {
+        k_CAPACITY = t_CAPACITY  // maximum number of segments held
+    };
+
+  private:
+    // DATA
+    FormatStringSegment d_segments[k_CAPACITY];  // segments held
+    int                 d_numSegments;           // number of segments, or -1
+                                                 // if not compiled
+
+  public:
+    // CREATORS
+
+    /// Create an empty buffer that is not compiled.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 FormatStringSegmentBuffer();
+
+    // MANIPULATORS
+
+    /// Append the specified `segment` to this buffer.  Return `true` on
+    /// success, and `false` (leaving this buffer unchanged) if this buffer is
+    /// full or is not compiled.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 bool append(
+                                           const FormatStringSegment& segment);
+
+    /// Remove all segments from this buffer and mark it as compiled.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 void clear();
+
+    /// Remove all segments from this buffer and mark it as not compiled.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 void reset();
+
+    // ACCESSORS
+
+    /// Return the address of the first segment held by this buffer, or 0 if
+    /// this buffer is not compiled.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 const FormatStringSegment *begin() const;
+
+    /// Return the address one past the last segment held by this buffer, or
+    /// 0 if this buffer is not compiled.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 const FormatStringSegment *end() const;
+
+    /// Return `true` if this buffer holds the complete segment sequence of a
+    /// format string, and `false` otherwise.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 bool isCompiled() const;
+
+    /// Return the number of segments held by this buffer.
+    BSLS_KEYWORD_CONSTEXPR_CPP14 int size() const;
+};
+
+                       // ==============================
+                       // struct FormatStringParserEnums
+                       // ==============================
+
+/// This `struct` provides a namespace for the status values returned by
+/// `FormatStringParser::parse`.
+struct FormatStringParserEnums {
+    // TYPES
+    enum Status {
+        e_SUCCESS = 0,             // the string was split successfully
+        e_UNMATCHED_OPEN_BRACE,    // `{` at the end of the string
+        e_UNESCAPED_CLOSE_BRACE,   // `}` not followed by `}`
+        e_MISSING_SEPARATOR,       // arg id not followed by `:` or `}`
+        e_UNTERMINATED_FIELD,      // no `}` closing a replacement field
+        e_ARG_ID_TOO_LARGE,        // manual arg id does not fit in an `int`
+        e_STRING_TOO_LONG,         // string longer than `INT_MAX`
+        e_CAPACITY_EXCEEDED        // the sink refused a segment
+    };
+
+    // CLASS METHODS
+
+    /// Return the non-modifiable string description of the specified
+    /// `status`, matching the message of the `format_error` thrown by the
+    /// formatting functions for the same condition where there is one, or
+    /// "(* UNKNOWN *)" if `status` is not a valid enumerator.
+    static const char *toAscii(Status status);
+};
+
+                         // ========================
+                         // class FormatStringParser
+                         // ========================
+
+/// This `struct` provides a namespace for a function splitting a format
+/// string of character type `t_CHAR` into `FormatStringSegment` objects.
+template <class t_CHAR>
+struct FormatStringParser : public FormatStringParserEnums {
+    // CLASS METHODS
+
+    /// Split the specified `formatString` into segments, passing each one in
+    /// turn to the `append` method of the specified `sink`.  Return
+    /// `e_SUCCESS` on success, and another `Status` value describing the
+    /// first problem found otherwise, in which case the segments already
+    /// delivered to `sink` are incomplete.  Format specifications are not
+    /// validated.
+    template <class t_SINK>
+    static BSLS_KEYWORD_CONSTEXPR_CPP14 int parse(
+                               t_SINK                         *sink,
+                               bsl::basic_string_view<t_CHAR>  formatString);
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class FormatStringSegmentBuffer
+                      // -------------------------------
+
+// CREATORS
+template <int t_CAPACITY>
+inline
+BSLS_KEYWORD_CONSTEXPR_CPP14
+FormatStringSegmentBuffer<t_CAPACITY>::FormatStringSegmentBuffer()
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+: d_segments{}  // some compilers do not treat `()` as initializing every
+                // element during constant evaluation
+#else
+: d_segments()
+#endif
+, d_numSegments(-1)
+{
+}
+
+// MANIPULATORS
+template <int t_CAPACITY>
+inline
+BSLS_KEYWORD_CONSTEXPR_CPP14
+bool FormatStringSegmentBuffer<t_CAPACITY>::append(
+                                            const FormatStringSegment& segment)
+{
+    if (d_numSegments < 0 || k_CAPACITY == d_numSegments) {
+        return false;                                                 // RETURN
+    }
+    d_segments[d_numSegments++] = segment;
+    return true;
+}
+
+template <int t_CAPACITY>
+inline
+BSLS_KEYWORD_CONSTEXPR_CPP14
+void FormatStringSegmentBuffer<t_CAPACITY>::clear()
+{
+    d_numSegments = 0;
+}
+
+template <int t_CAPACITY>
+inline
+BSLS_KEYWORD_CONSTEXPR_CPP14
+void FormatStringSegmentBuffer<t_CAPACITY>::reset()
+{
+    d_numSegments = -1;
+}
+
+// ACCESSORS
+template <int t_CAPACITY>
+inline
+BSLS_KEYWORD_CONSTEXPR_CPP14
+const FormatStringSegment *FormatStringSegmentBuffer<t_CAPACITY>::begin() const
+{
+    return d_numSegments < 0 ? 0 : d_segments;
+}
+
+template <int t_CAPACITY>
+inline
+BSLS_KEYWORD_CONSTEXPR_CPP14
+const FormatStringSegment *FormatStringSegmentBuffer<t_CAPACITY>::end() const
+{
+    return d_numSegments < 0 ? 0 : d_segments + d_numSegments;
+}
+
+template <int t_CAPACITY>
+inline
+BSLS_KEYWORD_CONSTEXPR_CPP14
+bool FormatStringSegmentBuffer<t_CAPACITY>::isCompiled() const
+{
+    return 0 <= d_numSegments;
+}
+
+template <int t_CAPACITY>
+inline
+BSLS_KEYWORD_CONSTEXPR_CPP14
+int FormatStringSegmentBuffer<t_CAPACITY>::size() const
+{
+    return d_numSegments < 0 ? 0 : d_numSegments;
+}
+
+                         // ------------------------
+                         // class FormatStringParser
+                         // ------------------------
+
+// CLASS METHODS
+template <class t_CHAR>
+template <class t_SINK>
+BSLS_KEYWORD_CONSTEXPR_CPP14
+int FormatStringParser<t_CHAR>::parse(
+                                t_SINK                         *sink,
+                                bsl::basic_string_view<t_CHAR>  formatString)
+{
+    if (formatString.size() > static_cast<size_t>(INT_MAX)) {
+        return e_STRING_TOO_LONG;                                     // RETURN
+    }
+
+    const int length       = static_cast<int>(formatString.size());
+    int       literalBegin = 0;
+    int       pos          = 0;
+
+    while (pos < length) {
+        const t_CHAR ch = formatString[pos];
+
+        if ('}' == ch) {
+            // Must be escaped: emit the literal up to and including the
+            // first brace.
+
+            if (pos + 1 == length || '}' != formatString[pos + 1]) {
+                return e_UNESCAPED_CLOSE_BRACE;                       // RETURN
+            }
+            const FormatStringSegment segment = {
+                literalBegin, pos + 1, FormatStringSegment::k_NO_FIELD, 0, 0
+            };
+            if (!sink->append(segment)) {
+                return e_CAPACITY_EXCEEDED;                           // RETURN
+            }
+            pos          += 2;
+            literalBegin  = pos;
+            continue;                                               // CONTINUE
+        }
+
+        if ('{' != ch) {
+            ++pos;
+            continue;                                               // CONTINUE
+        }
+
+        const int literalEnd = pos;
+
+        ++pos;
+        if (pos == length) {
+            return e_UNMATCHED_OPEN_BRACE;                            // RETURN
+        }
+
+        if ('{' == formatString[pos]) {
+            // Escaped `{`: emit the literal up to and including the first
+            // brace.
+
+            const FormatStringSegment segment = {
+                literalBegin, pos, FormatStringSegment::k_NO_FIELD, 0, 0
+            };
+            if (!sink->append(segment)) {
+                return e_CAPACITY_EXCEEDED;                           // RETURN
+            }
+            ++pos;
+            literalBegin = pos;
+            continue;                                               // CONTINUE
+        }
+
+        int argId = FormatStringSegment::k_AUTOMATIC_ID;
+        if ('0' <= formatString[pos] && formatString[pos] <= '9') {
+            argId = 0;
+            while (pos < length &&
+                   '0' <= formatString[pos] && formatString[pos] <= '9') {
+                const int digit = static_cast<int>(formatString[pos] - '0');
+                if (argId > (INT_MAX - digit) / 10) {
+                    return e_ARG_ID_TOO_LARGE;                        // RETURN
+                }
+                argId = 10 * argId + digit;
+                ++pos;
+            }
+            if (pos == length) {
+                return e_UNMATCHED_OPEN_BRACE;                        // RETURN
+            }
+        }
+
+        // Separator between arg id and format specification
+
+        if (':' == formatString[pos]) {
+            ++pos;
+        }
+        else if ('}' != formatString[pos]) {
+            return e_MISSING_SEPARATOR;                               // RETURN
+        }
+
+        // Find the closing brace, skipping nested replacement fields (such
+        // as dynamic widths) within the format specification.
+
+        const int specBegin = pos;
+        int       depth     = 0;
+        while (pos < length) {
+            if ('{' == formatString[pos]) {
+                ++depth;
+            }
+            else if ('}' == formatString[pos]) {
+                if (0 == depth) {
+                    break;                                             // BREAK
+                }
+                --depth;
+            }
+            ++pos;
+        }
+        if (pos == length) {
+            return e_UNTERMINATED_FIELD;                              // RETURN
+        }
+
+        const FormatStringSegment segment = {
+            literalBegin, literalEnd, argId, specBegin, pos
+        };
+        if (!sink->append(segment)) {
+            return e_CAPACITY_EXCEEDED;                               // RETURN
+        }
+        ++pos;
+        literalBegin = pos;
+    }
+
+    if (literalBegin < length) {
+        const FormatStringSegment segment = {
+            literalBegin, length, FormatStringSegment::k_NO_FIELD, 0, 0
+        };
+        if (!sink->append(segment)) {
+            return e_CAPACITY_EXCEEDED;                               // RETURN
+        }
+    }
+
+    return e_SUCCESS;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // INCLUDED_BSLFMT_FORMATSTRINGPARSER
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
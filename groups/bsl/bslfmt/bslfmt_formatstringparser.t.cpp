@@ -0,0 +1,686 @@
+// bslfmt_formatstringparser.t.cpp                                    -*-C++-*-
+#include <bslfmt_formatstringparser.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <bslstl_string.h>
+#include <bslstl_stringview.h>
+
+#include <stdio.h>   // `printf`
+#include <stdlib.h>  // `atoi`
+#include <string.h>  // `strcmp`
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a simple aggregate, a fixed-capacity
+// container of those aggregates, and a `constexpr` parsing function that
+// splits a format string into a sequence of them.  The parsing function is
+// tested with a table of format strings whose expected split is rendered
+// back into a readable string, for both `char` and `wchar_t`.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] int FormatStringParser::parse(t_SINK *, basic_string_view);
+// [ 4] const char *FormatStringParserEnums::toAscii(Status);
+//
+// FormatStringSegmentBuffer
+// [ 2] FormatStringSegmentBuffer();
+// [ 2] bool append(const FormatStringSegment&);
+// [ 2] void clear();
+// [ 2] void reset();
+// [ 2] const FormatStringSegment *begin() const;
+// [ 2] const FormatStringSegment *end() const;
+// [ 2] bool isCompiled() const;
+// [ 2] int size() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONSTANT EVALUATION
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q BSLS_BSLTESTUTIL_Q    // Quote identifier literally.
+#define P BSLS_BSLTESTUTIL_P    // Print identifier and value.
+#define P_ BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslfmt::FormatStringSegment       Segment;
+typedef bslfmt::FormatStringSegmentBuffer<8> Buffer;
+typedef bslfmt::FormatStringParserEnums   Enums;
+
+// ============================================================================
+//                     GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// This sink type records up to 32 segments, and can be told to refuse
+/// segments after a given number have been accepted.
+class TestSink {
+    // DATA
+    Segment d_segments[32];
+    int     d_numSegments;
+    int     d_limit;
+
+  public:
+    // CREATORS
+    explicit TestSink(int limit = 32)
+    : d_numSegments(0)
+    , d_limit(limit)
+    {
+    }
+
+    // MANIPULATORS
+    bool append(const Segment& segment)
+    {
+        if (d_numSegments == d_limit) {
+            return false;                                             // RETURN
+        }
+        d_segments[d_numSegments++] = segment;
+        return true;
+    }
+
+    // ACCESSORS
+    const Segment *begin() const { return d_segments; }
+    const Segment *end() const { return d_segments + d_numSegments; }
+};
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return a narrow rendering of the segments in the specified range
+/// [`begin`, `end`) over the specified `fmt`: each literal run is copied,
+/// and each field is shown as `[<id>:<spec>]`, where `<id>` is `A` for
+/// automatic numbering.
+template <class t_CHAR>
+bsl::string render(const Segment                  *begin,
+                   const Segment                  *end,
+                   bsl::basic_string_view<t_CHAR>  fmt)
+{
+    bsl::string result;
+    for (const Segment *s = begin; s != end; ++s) {
+        for (int i = s->d_literalBegin; i < s->d_literalEnd; ++i) {
+            result.push_back(static_cast<char>(fmt[i]));
+        }
+        if (Segment::k_NO_FIELD == s->d_argId) {
+            continue;                                               // CONTINUE
+        }
+        result.push_back('[');
+        if (Segment::k_AUTOMATIC_ID == s->d_argId) {
+            result.push_back('A');
+        }
+        else {
+            char buffer[16];
+            sprintf(buffer, "%d", s->d_argId);
+            result += buffer;
+        }
+        result.push_back(':');
+        for (int i = s->d_specBegin; i < s->d_specEnd; ++i) {
+            result.push_back(static_cast<char>(fmt[i]));
+        }
+        result.push_back(']');
+    }
+    return result;
+}
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR_CPP14
+/// Return the number of segments of the specified `fmt`, or -1 if it could
+/// not be compiled into a `FormatStringSegmentBuffer`.
+constexpr int constantNumSegments(const char *fmt)
+{
+    Buffer buffer;
+    buffer.clear();
+    if (0 != bslfmt::FormatStringParser<char>::parse(
+                                          &buffer,
+                                          bsl::basic_string_view<char>(fmt))) {
+        return -1;                                                    // RETURN
+    }
+    return buffer.size();
+}
+#endif
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;  (void)veryVeryVerbose;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No global memory is allocated after `main` starts.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) {  case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace `assert` with
+        //:   `ASSERT`, and insert `if (veryVerbose)` before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Example 1: Splitting a Format String
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we want to see how a format string will be processed.  First, we
+// parse it into a buffer:
+// ```
+        bslfmt::FormatStringSegmentBuffer<8> buffer;
+        buffer.clear();
+
+        int rc = bslfmt::FormatStringParser<char>::parse(&buffer,
+                                                         "x={0:>4} {{y}}={1}");
+        ASSERT(bslfmt::FormatStringParserEnums::e_SUCCESS == rc);
+        ASSERT(4 == buffer.size());
+// ```
+// Then, we inspect the segments.  The first holds the literal "x=" followed
+// by the field with id 0, whose specification is ">4":
+// ```
+        const bslfmt::FormatStringSegment *segment = buffer.begin();
+        ASSERT(0 == segment->d_literalBegin);
+        ASSERT(2 == segment->d_literalEnd);
+        ASSERT(0 == segment->d_argId);
+        ASSERT(5 == segment->d_specBegin);
+        ASSERT(7 == segment->d_specEnd);
+// ```
+// Next, the escaped braces are split so that each segment refers to a
+// contiguous run of the original string ending with a single brace:
+// ```
+        ++segment;
+        ASSERT(8  == segment->d_literalBegin);         // " {"
+        ASSERT(10 == segment->d_literalEnd);
+        ASSERT(bslfmt::FormatStringSegment::k_NO_FIELD == segment->d_argId);
+
+        ++segment;
+        ASSERT(11 == segment->d_literalBegin);         // "y}"
+        ASSERT(13 == segment->d_literalEnd);
+        ASSERT(bslfmt::FormatStringSegment::k_NO_FIELD == segment->d_argId);
+// ```
+// Finally, the last segment holds "=" and the field with id 1, which has an
+// empty specification:
+// ```
+        ++segment;
+        ASSERT(14 == segment->d_literalBegin);
+        ASSERT(15 == segment->d_literalEnd);
+        ASSERT(1  == segment->d_argId);
+        ASSERT(segment->d_specBegin == segment->d_specEnd);
+// ```
+// An invalid format string is reported through the return value:
+// ```
+        buffer.clear();
+        rc = bslfmt::FormatStringParser<char>::parse(&buffer, "{0");
+        ASSERT(bslfmt::FormatStringParserEnums::e_UNMATCHED_OPEN_BRACE == rc);
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `toAscii`
+        //
+        // Concerns:
+        //: 1 Each enumerator has a distinct description.
+        //:
+        //: 2 The description of each error shared with the formatting
+        //:   functions matches the message of the `format_error` they throw.
+        //:
+        //: 3 Out-of-range values are described as "(* UNKNOWN *)".
+        //
+        // Plan:
+        //: 1 Compare the result of `toAscii` for each enumerator, and for two
+        //:   invalid values, with the expected string.  (C-1..3)
+        //
+        // Testing:
+        //   const char *FormatStringParserEnums::toAscii(Status);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `toAscii`"
+                            "\n=================\n");
+
+        static const struct {
+            int         d_line;
+            int         d_status;
+            const char *d_expected;
+        } DATA[] = {
+            { L_, Enums::e_SUCCESS,               "success"                 },
+            { L_, Enums::e_UNMATCHED_OPEN_BRACE,  "unmatched {"             },
+            { L_, Enums::e_UNESCAPED_CLOSE_BRACE, "} must be escaped"       },
+            { L_, Enums::e_MISSING_SEPARATOR,     "Separator ':' missing"   },
+            { L_, Enums::e_UNTERMINATED_FIELD,
+                                            "unterminated replacement field" },
+            { L_, Enums::e_ARG_ID_TOO_LARGE,      "arg id too large"        },
+            { L_, Enums::e_STRING_TOO_LONG,       "format string too long"  },
+            { L_, Enums::e_CAPACITY_EXCEEDED,     "too many segments"       },
+            { L_, -1,                             "(* UNKNOWN *)"           },
+            { L_, 100,                            "(* UNKNOWN *)"           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const int         STATUS   = DATA[ti].d_status;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            const char *result = Enums::toAscii(
+                                           static_cast<Enums::Status>(STATUS));
+
+            if (veryVerbose) { T_ P_(STATUS) P(result) }
+
+            ASSERTV(LINE, result, EXPECTED, 0 == strcmp(EXPECTED, result));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `parse`
+        //
+        // Concerns:
+        //: 1 Literal text is delivered as runs ending just before each
+        //:   replacement field, with `{{` and `}}` each contributing a single
+        //:   brace.
+        //:
+        //: 2 Automatic and manual argument ids are recorded, as is the
+        //:   (unvalidated) format specification following an optional `:`.
+        //:
+        //: 3 Nested replacement fields in a format specification do not end
+        //:   the enclosing field.
+        //:
+        //: 4 Each kind of malformed string is reported with the appropriate
+        //:   status.
+        //:
+        //: 5 A sink refusing a segment results in `e_CAPACITY_EXCEEDED`.
+        //:
+        //: 6 `parse` works for both `char` and `wchar_t`.
+        //:
+        //: 7 `parse` can be evaluated at compile time where C++14 `constexpr`
+        //:   is supported.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of format strings
+        //:   as `char` and `wchar_t` into a `TestSink`, and compare the
+        //:   status and the rendered segments with the expected values.
+        //:   (C-1..4, 6)
+        //:
+        //: 2 Parse a string with a sink that accepts a limited number of
+        //:   segments.  (C-5)
+        //:
+        //: 3 Use a `constexpr` function calling `parse` in `static_assert`
+        //:   expressions.  (C-7)
+        //
+        // Testing:
+        //   int FormatStringParser::parse(t_SINK *, basic_string_view);
+        //   CONSTANT EVALUATION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `parse`"
+                            "\n===============\n");
+
+        const int OK     = Enums::e_SUCCESS;
+        const int OPEN   = Enums::e_UNMATCHED_OPEN_BRACE;
+        const int CLOSE  = Enums::e_UNESCAPED_CLOSE_BRACE;
+        const int SEP    = Enums::e_MISSING_SEPARATOR;
+        const int UNTERM = Enums::e_UNTERMINATED_FIELD;
+        const int BIG_ID = Enums::e_ARG_ID_TOO_LARGE;
+
+        static const struct {
+            int         d_line;
+            const char *d_format;
+            int         d_status;
+            const char *d_expected;   // rendered segments on success
+        } DATA[] = {
+            //LINE  FORMAT            STATUS  EXPECTED
+            //----  ----------------  ------  ------------------
+            { L_,   "",               OK,     ""                 },
+            { L_,   "abc",            OK,     "abc"              },
+            { L_,   "{}",             OK,     "[A:]"             },
+            { L_,   "{:}",            OK,     "[A:]"             },
+            { L_,   "a{}b",           OK,     "a[A:]b"           },
+            { L_,   "{}{}",           OK,     "[A:][A:]"         },
+            { L_,   "{0}",            OK,     "[0:]"             },
+            { L_,   "{12:x}",         OK,     "[12:x]"           },
+            { L_,   "{:*^10.3f}",     OK,     "[A:*^10.3f]"      },
+            { L_,   "{{",             OK,     "{"                },
+            { L_,   "}}",             OK,     "}"                },
+            { L_,   "a{{b}}c",        OK,     "a{b}c"            },
+            { L_,   "{{}}",           OK,     "{}"               },
+            { L_,   "{{{}}}",         OK,     "{[A:]}"           },
+            { L_,   "{:{}}",          OK,     "[A:{}]"           },
+            { L_,   "{0:{1}.{2}}x",   OK,     "[0:{1}.{2}]x"     },
+            { L_,   "{:}}",           CLOSE,  ""                 },
+            { L_,   "{",              OPEN,   ""                 },
+            { L_,   "ab{",            OPEN,   ""                 },
+            { L_,   "{0",             OPEN,   ""                 },
+            { L_,   "}",              CLOSE,  ""                 },
+            { L_,   "a}b",            CLOSE,  ""                 },
+            { L_,   "{0x}",           SEP,    ""                 },
+            { L_,   "{x}",            SEP,    ""                 },
+            { L_,   "{:",             UNTERM, ""                 },
+            { L_,   "{0:x",           UNTERM, ""                 },
+            { L_,   "{:{}",           UNTERM, ""                 },
+            { L_,   "{2147483647}",   OK,     "[2147483647:]"    },
+            { L_,   "{9999999999}",   BIG_ID, ""                 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const FORMAT   = DATA[ti].d_format;
+            const int         STATUS   = DATA[ti].d_status;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            if (veryVerbose) { T_ P_(LINE) P(FORMAT) }
+
+            {
+                TestSink sink;
+
+                const int rc = bslfmt::FormatStringParser<char>::parse(
+                                         &sink,
+                                         bsl::basic_string_view<char>(FORMAT));
+                ASSERTV(LINE, rc, STATUS, STATUS == rc);
+                if (Enums::e_SUCCESS == rc) {
+                    const bsl::string result = render(
+                                         sink.begin(),
+                                         sink.end(),
+                                         bsl::basic_string_view<char>(FORMAT));
+                    ASSERTV(LINE,
+                            result.c_str(),
+                            EXPECTED,
+                            EXPECTED == result);
+                }
+            }
+            {
+                bsl::wstring wideFormat;
+                for (const char *p = FORMAT; *p; ++p) {
+                    wideFormat.push_back(static_cast<wchar_t>(*p));
+                }
+                const bsl::basic_string_view<wchar_t> WIDE(wideFormat.data(),
+                                                           wideFormat.size());
+
+                TestSink sink;
+
+                const int rc = bslfmt::FormatStringParser<wchar_t>::parse(
+                                                                       &sink,
+                                                                       WIDE);
+                ASSERTV(LINE, rc, STATUS, STATUS == rc);
+                if (Enums::e_SUCCESS == rc) {
+                    const bsl::string result = render(sink.begin(),
+                                                      sink.end(),
+                                                      WIDE);
+                    ASSERTV(LINE,
+                            result.c_str(),
+                            EXPECTED,
+                            EXPECTED == result);
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting a sink refusing segments.\n");
+        {
+            const bsl::basic_string_view<char> FORMAT("a{}b{}c");
+
+            for (int limit = 0; limit <= 3; ++limit) {
+                TestSink sink(limit);
+
+                const int rc = bslfmt::FormatStringParser<char>::parse(&sink,
+                                                                       FORMAT);
+                ASSERTV(limit, rc, 3 == limit
+                                   ? Enums::e_SUCCESS == rc
+                                   : Enums::e_CAPACITY_EXCEEDED == rc);
+            }
+        }
+
+        if (verbose) printf("\tTesting constant evaluation.\n");
+        {
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR_CPP14
+            static_assert(0  == constantNumSegments(""),          "");
+            static_assert(1  == constantNumSegments("x={}"),      "");
+            static_assert(3  == constantNumSegments("{{{0}}}"),   "");
+            static_assert(-1 == constantNumSegments("{"),         "");
+            static_assert(-1 == constantNumSegments("{}{}{}{}{}{}{}{}{}"),
+                          "");
+#endif
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `FormatStringSegmentBuffer`
+        //
+        // Concerns:
+        //: 1 A default-constructed buffer is empty and not compiled, refuses
+        //:   segments, and has null `begin` and `end`.
+        //:
+        //: 2 After `clear` the buffer is empty and compiled, and accepts up to
+        //:   `k_CAPACITY` segments, which are accessible in order through
+        //:   `begin` and `end`.
+        //:
+        //: 3 `reset` makes the buffer empty and not compiled, with null
+        //:   `begin` and `end`.
+        //:
+        //: 4 `k_CAPACITY` is the template parameter of the buffer.
+        //
+        // Plan:
+        //: 1 Exercise each manipulator and verify the state of the buffer
+        //:   using the accessors.  (C-1..3)
+        //:
+        //: 2 Fill a buffer of capacity 1 and verify that it refuses a second
+        //:   segment.  (C-4)
+        //
+        // Testing:
+        //   FormatStringSegmentBuffer();
+        //   bool append(const FormatStringSegment&);
+        //   void clear();
+        //   void reset();
+        //   const FormatStringSegment *begin() const;
+        //   const FormatStringSegment *end() const;
+        //   bool isCompiled() const;
+        //   int size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `FormatStringSegmentBuffer`"
+                            "\n===================================\n");
+
+        Buffer mX;  const Buffer& X = mX;
+
+        ASSERT(false == X.isCompiled());
+        ASSERT(0     == X.size());
+        ASSERT(0     == X.begin());
+        ASSERT(0     == X.end());
+
+        const Segment SEGMENT = { 0, 1, Segment::k_NO_FIELD, 0, 0 };
+
+        ASSERT(false == mX.append(SEGMENT));
+        ASSERT(0     == X.size());
+
+        mX.clear();
+
+        ASSERT(true      == X.isCompiled());
+        ASSERT(0         == X.size());
+        ASSERT(X.begin() == X.end());
+
+        for (int i = 0; i < Buffer::k_CAPACITY; ++i) {
+            const Segment S = { i, i + 1, i, i + 2, i + 3 };
+
+            ASSERTV(i, mX.append(S));
+            ASSERTV(i, i + 1 == X.size());
+            ASSERTV(i, X.begin() + i + 1 == X.end());
+        }
+
+        ASSERT(false              == mX.append(SEGMENT));
+        ASSERT(Buffer::k_CAPACITY == X.size());
+        ASSERT(true               == X.isCompiled());
+
+        for (int i = 0; i < Buffer::k_CAPACITY; ++i) {
+            const Segment& S = X.begin()[i];
+
+            ASSERTV(i, i     == S.d_literalBegin);
+            ASSERTV(i, i + 1 == S.d_literalEnd);
+            ASSERTV(i, i     == S.d_argId);
+            ASSERTV(i, i + 2 == S.d_specBegin);
+            ASSERTV(i, i + 3 == S.d_specEnd);
+        }
+
+        mX.clear();
+
+        ASSERT(true == X.isCompiled());
+        ASSERT(0    == X.size());
+
+        ASSERT(true == mX.append(SEGMENT));
+        ASSERT(1    == X.size());
+
+        mX.reset();
+
+        ASSERT(false == X.isCompiled());
+        ASSERT(0     == X.size());
+        ASSERT(0     == X.begin());
+        ASSERT(0     == X.end());
+
+        if (verbose) printf("\tTesting a buffer of capacity 1.\n");
+        {
+            typedef bslfmt::FormatStringSegmentBuffer<1> SmallBuffer;
+
+            ASSERT(1 == SmallBuffer::k_CAPACITY);
+
+            SmallBuffer mY;  const SmallBuffer& Y = mY;
+
+            mY.clear();
+
+            ASSERT(true  == mY.append(SEGMENT));
+            ASSERT(false == mY.append(SEGMENT));
+            ASSERT(1     == Y.size());
+            ASSERT(true  == Y.isCompiled());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Parse a few format strings and check the resulting segments.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Buffer buffer;
+        buffer.clear();
+
+        ASSERT(Enums::e_SUCCESS == bslfmt::FormatStringParser<char>::parse(
+                                                        &buffer,
+                                                        "The answer is {}."));
+        ASSERT(2 == buffer.size());
+        ASSERT(Segment::k_AUTOMATIC_ID == buffer.begin()[0].d_argId);
+        ASSERT(Segment::k_NO_FIELD     == buffer.begin()[1].d_argId);
+
+        buffer.clear();
+
+        ASSERT(Enums::e_UNESCAPED_CLOSE_BRACE ==
+               bslfmt::FormatStringParser<wchar_t>::parse(&buffer, L"}{"));
+      } break;
+      default: {
+        printf("WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        printf("Error, non-zero test status = %d .\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
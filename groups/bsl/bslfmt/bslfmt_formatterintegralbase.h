@@ -27,6 +27,7 @@ BSLS_IDENT("$Id: $")
 #include <bslfmt_formatterbase.h>
 #include <bslfmt_formattercharutil.h>
 #include <bslfmt_padutil.h>
+#include <bslfmt_putrangeutil.h>
 #include <bslfmt_standardformatspecification.h>
 
 #include <bslalg_numericformatterutil.h>
@@ -582,7 +583,7 @@ FormatterIntegralBase<t_VALUE, t_CHAR>::outputValue(
 
     // value
 
-    outIterator = bsl::copy(valueBegin, valueEnd, outIterator);
+    outIterator = PutRangeUtil::copy(valueBegin, valueEnd, outIterator);
 
     // right padding
 
@@ -66,6 +66,7 @@ BSLS_IDENT("$Id: $")
 #include <bslfmt_formaterror.h>
 #include <bslfmt_formatterbase.h>
 #include <bslfmt_padutil.h>
+#include <bslfmt_putrangeutil.h>
 #include <bslfmt_standardformatspecification.h>
 
 #include <bslalg_numericformatterutil.h>
@@ -632,9 +633,9 @@ FormatterString_Imp<t_CHAR, t_CHAR_TRAITS>::formatImpl(
     const StringView pad(finalSpec.filler(), finalSpec.numFillerCharacters());
     outIterator = PadUtil::pad(outIterator, leftPadFillerCopies, pad);
 
-    outIterator = bsl::copy(value.begin(),
-                            value.begin() + charactersOfInputUsed,
-                            outIterator);
+    outIterator = PutRangeUtil::copy(value.data(),
+                                     value.data() + charactersOfInputUsed,
+                                     outIterator);
 
     outIterator = PadUtil::pad(outIterator, rightPadFillerCopies, pad);
 
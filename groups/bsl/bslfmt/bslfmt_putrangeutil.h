@@ -0,0 +1,240 @@
+// bslfmt_putrangeutil.h                                              -*-C++-*-
+
+#ifndef INCLUDED_BSLFMT_PUTRANGEUTIL
+#define INCLUDED_BSLFMT_PUTRANGEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a trait and utility for writing spans to output iterators.
+//
+//@CLASSES:
+//  bslfmt::HasPutRange: trait for output iterators accepting whole spans
+//  bslfmt::PutRangeUtil: utility writing a span to any output iterator
+//
+//@SEE_ALSO: bslfmt_format, bslfmt_formatterstring
+//
+//@DESCRIPTION: This component provides a trait, `bslfmt::HasPutRange`, that
+// an output iterator type can declare to indicate that it can write a
+// contiguous span of characters in a single operation, and a utility,
+// `bslfmt::PutRangeUtil`, whose `copy` function writes a span to an output
+// iterator using that operation when available, and `bsl::copy` otherwise.
+//
+// The formatting functions of `bslfmt` write runs of literal text and the
+// bodies of strings and numbers through `PutRangeUtil::copy`, so an output
+// iterator writing into a chunked buffer (e.g., a stream buffer or a
+// `bdlbb::Blob`) can copy each such run with one `memcpy` per chunk rather
+// than handling it character by character.
+//
+// An output iterator type, `ITER`, having the `HasPutRange` trait provides
+// the following member function, where `CHAR` is the character type written
+// through the iterator:
+// ```
+// void putRange(const CHAR *begin, const CHAR *end);
+// ```
+// Calling `it.putRange(begin, end)` must have the same effect as:
+// ```
+// for (; begin != end; ++begin) {
+//     *it = *begin;
+//     ++it;
+// }
+// ```
+// The trait is associated with a type using the nested trait mechanism (see
+// `bslmf_nestedtraitdeclaration`), or by specializing `HasPutRange` for it.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Defining an Output Iterator Accepting Spans
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an output iterator that appends to a buffer, and we want
+// runs of characters written through `PutRangeUtil::copy` to be appended in
+// one operation.  First, we define the iterator, declaring the `HasPutRange`
+// trait and providing the `putRange` method:
+// ```
+// class AppendIterator {
+//     // DATA
+//     bsl::string *d_buffer_p;
+//     int         *d_numPutRangeCalls_p;
+//
+//   public:
+//     // TYPES
+//     typedef bsl::output_iterator_tag iterator_category;
+//     typedef void                     value_type;
+//     typedef bsl::ptrdiff_t           difference_type;
+//     typedef void                     pointer;
+//     typedef void                     reference;
+//
+//     // TRAITS
+//     BSLMF_NESTED_TRAIT_DECLARATION(AppendIterator, bslfmt::HasPutRange);
+//
+//     // CREATORS
+//     AppendIterator(bsl::string *buffer, int *numPutRangeCalls)
+//     : d_buffer_p(buffer)
+//     , d_numPutRangeCalls_p(numPutRangeCalls)
+//     {
+//     }
+//
+//     // MANIPULATORS
+//     AppendIterator& operator*() { return *this; }
+//     AppendIterator& operator++() { return *this; }
+//     AppendIterator& operator++(int) { return *this; }
+//     AppendIterator& operator=(char c)
+//     {
+//         d_buffer_p->push_back(c);
+//         return *this;
+//     }
+//
+//     void putRange(const char *begin, const char *end)
+//     {
+//         d_buffer_p->append(begin, end);
+//         ++*d_numPutRangeCalls_p;
+//     }
+// };
+// ```
+// Then, we write a span to it using `PutRangeUtil::copy`, and observe that
+// it was written with a single call to `putRange`:
+// ```
+// bsl::string    buffer;
+// int            numCalls = 0;
+// AppendIterator it(&buffer, &numCalls);
+//
+// const char text[] = "Hello, world";
+// it = bslfmt::PutRangeUtil::copy(text, text + sizeof text - 1, it);
+//
+// assert("Hello, world" == buffer);
+// assert(1              == numCalls);
+// ```
+// Finally, we note that iterators without the trait, such as pointers, are
+// handled as `bsl::copy` would:
+// ```
+// char  array[16];
+// char *end = bslfmt::PutRangeUtil::copy(text, text + 5, array);
+// assert(array + 5 == end);
+// assert(0 == bsl::memcmp(array, "Hello", 5));
+// ```
+
+#include <bslscm_version.h>
+
+#include <bslmf_detectnestedtrait.h>
+#include <bslmf_integralconstant.h>
+
+#include <bslstl_algorithm.h>
+
+namespace BloombergLP {
+namespace bslfmt {
+
+                            // ==================
+                            // struct HasPutRange
+                            // ==================
+
+/// This `struct` template implements a meta-function to determine whether
+/// the (template parameter) output iterator type `t_TYPE` provides a
+/// `putRange` method writing a contiguous span of characters.  This trait
+/// derives from `bsl::true_type` if `t_TYPE` was declared with this trait,
+/// and from `bsl::false_type` otherwise.
+template <class t_TYPE>
+struct HasPutRange : bslmf::DetectNestedTrait<t_TYPE, HasPutRange> {
+};
+
+                            // ===================
+                            // struct PutRangeUtil
+                            // ===================
+
+/// This `struct` provides a namespace for a function writing a contiguous
+/// span of characters to an output iterator.
+struct PutRangeUtil {
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Write the characters in the specified range [`begin`, `end`) to the
+    /// specified `out` with a single call to its `putRange` method, and
+    /// return `out`.
+    template <class t_CHAR, class t_ITER>
+    static t_ITER copyImp(const t_CHAR *begin,
+                          const t_CHAR *end,
+                          t_ITER        out,
+                          bsl::true_type);
+
+    /// Write the characters in the specified range [`begin`, `end`) to the
+    /// specified `out` one character at a time, and return an iterator one
+    /// past the last character written.
+    template <class t_CHAR, class t_ITER>
+    static t_ITER copyImp(const t_CHAR *begin,
+                          const t_CHAR *end,
+                          t_ITER        out,
+                          bsl::false_type);
+
+  public:
+    // CLASS METHODS
+
+    /// Write the characters in the specified range [`begin`, `end`) to the
+    /// specified output iterator `out`, and return an iterator one past the
+    /// last character written.  If `t_ITER` has the `HasPutRange` trait the
+    /// range is written with a single call to `out.putRange`; otherwise, it
+    /// is written as if by `bsl::copy`.
+    template <class t_CHAR, class t_ITER>
+    static t_ITER copy(const t_CHAR *begin, const t_CHAR *end, t_ITER out);
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct PutRangeUtil
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class t_CHAR, class t_ITER>
+inline
+t_ITER PutRangeUtil::copyImp(const t_CHAR *begin,
+                             const t_CHAR *end,
+                             t_ITER        out,
+                             bsl::true_type)
+{
+    if (begin != end) {
+        out.putRange(begin, end);
+    }
+    return out;
+}
+
+template <class t_CHAR, class t_ITER>
+inline
+t_ITER PutRangeUtil::copyImp(const t_CHAR *begin,
+                             const t_CHAR *end,
+                             t_ITER        out,
+                             bsl::false_type)
+{
+    return bsl::copy(begin, end, out);
+}
+
+// CLASS METHODS
+template <class t_CHAR, class t_ITER>
+inline
+t_ITER PutRangeUtil::copy(const t_CHAR *begin, const t_CHAR *end, t_ITER out)
+{
+    return copyImp(begin, end, out, HasPutRange<t_ITER>());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // INCLUDED_BSLFMT_PUTRANGEUTIL
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,535 @@
+// bslfmt_putrangeutil.t.cpp                                          -*-C++-*-
+#include <bslfmt_putrangeutil.h>
+
+#include <bslfmt_format.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_string.h>
+
+#include <stddef.h>  // `ptrdiff_t`
+#include <stdio.h>   // `printf`
+#include <stdlib.h>  // `atoi`
+#include <string.h>  // `memcmp`
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a trait and a function dispatching on
+// it.  We check the trait for types with and without the nested trait
+// declaration, then check that `copy` calls `putRange` exactly once for
+// iterators having the trait and behaves as `bsl::copy` for others.  Finally
+// we check that the formatting functions of `bslfmt` hand whole spans to an
+// iterator having the trait.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] t_ITER PutRangeUtil::copy(const t_CHAR *, const t_CHAR *, t_ITER);
+//
+// TRAITS
+// [ 2] HasPutRange<t_TYPE>
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: FORMATTING WRITES SPANS WITH `putRange`
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q BSLS_BSLTESTUTIL_Q    // Quote identifier literally.
+#define P BSLS_BSLTESTUTIL_P    // Print identifier and value.
+#define P_ BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// This output iterator appends to a string and counts the characters
+/// written one at a time and the calls to `putRange`.
+template <class t_CHAR>
+class CountingIterator {
+    // DATA
+    bsl::basic_string<t_CHAR> *d_buffer_p;
+    int                       *d_numPuts_p;
+    int                       *d_numPutRanges_p;
+
+  public:
+    // TYPES
+    typedef bsl::output_iterator_tag iterator_category;
+    typedef void                     value_type;
+    typedef ptrdiff_t                difference_type;
+    typedef void                     pointer;
+    typedef void                     reference;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CountingIterator, bslfmt::HasPutRange);
+
+    // CREATORS
+    CountingIterator(bsl::basic_string<t_CHAR> *buffer,
+                     int                       *numPuts,
+                     int                       *numPutRanges)
+    : d_buffer_p(buffer)
+    , d_numPuts_p(numPuts)
+    , d_numPutRanges_p(numPutRanges)
+    {
+    }
+
+    // MANIPULATORS
+    CountingIterator& operator*() { return *this; }
+    CountingIterator& operator++() { return *this; }
+    CountingIterator& operator++(int) { return *this; }
+
+    CountingIterator& operator=(t_CHAR c)
+    {
+        d_buffer_p->push_back(c);
+        ++*d_numPuts_p;
+        return *this;
+    }
+
+    void putRange(const t_CHAR *begin, const t_CHAR *end)
+    {
+        d_buffer_p->append(begin, end);
+        ++*d_numPutRanges_p;
+    }
+};
+
+typedef CountingIterator<char>    Iter;
+typedef CountingIterator<wchar_t> WIter;
+
+/// This class has a `putRange` method but does not declare the trait.
+struct UndeclaredIterator {
+    void putRange(const char *, const char *) {}
+};
+
+/// This class is associated with the trait by specialization.
+struct SpecializedIterator {
+};
+
+namespace BloombergLP {
+namespace bslfmt {
+
+template <>
+struct HasPutRange<SpecializedIterator> : bsl::true_type {
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Defining an Output Iterator Accepting Spans
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an output iterator that appends to a buffer, and we want
+// runs of characters written through `PutRangeUtil::copy` to be appended in
+// one operation.  First, we define the iterator, declaring the `HasPutRange`
+// trait and providing the `putRange` method:
+// ```
+class AppendIterator {
+    // DATA
+    bsl::string *d_buffer_p;
+    int         *d_numPutRangeCalls_p;
+
+  public:
+    // TYPES
+    typedef bsl::output_iterator_tag iterator_category;
+    typedef void                     value_type;
+    typedef ptrdiff_t                difference_type;
+    typedef void                     pointer;
+    typedef void                     reference;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AppendIterator, bslfmt::HasPutRange);
+
+    // CREATORS
+    AppendIterator(bsl::string *buffer, int *numPutRangeCalls)
+    : d_buffer_p(buffer)
+    , d_numPutRangeCalls_p(numPutRangeCalls)
+    {
+    }
+
+    // MANIPULATORS
+    AppendIterator& operator*() { return *this; }
+    AppendIterator& operator++() { return *this; }
+    AppendIterator& operator++(int) { return *this; }
+    AppendIterator& operator=(char c)
+    {
+        d_buffer_p->push_back(c);
+        return *this;
+    }
+
+    void putRange(const char *begin, const char *end)
+    {
+        d_buffer_p->append(begin, end);
+        ++*d_numPutRangeCalls_p;
+    }
+};
+// ```
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;  (void)veryVeryVerbose;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No global memory is allocated after `main` starts.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) {  case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace `assert` with
+        //:   `ASSERT`, and insert `if (veryVerbose)` before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we write a span to it using `PutRangeUtil::copy`, and observe that
+// it was written with a single call to `putRange`:
+// ```
+        bsl::string    buffer;
+        int            numCalls = 0;
+        AppendIterator it(&buffer, &numCalls);
+
+        const char text[] = "Hello, world";
+        it = bslfmt::PutRangeUtil::copy(text, text + sizeof text - 1, it);
+
+        ASSERT("Hello, world" == buffer);
+        ASSERT(1              == numCalls);
+// ```
+// Finally, we note that iterators without the trait, such as pointers, are
+// handled as `bsl::copy` would:
+// ```
+        char  array[16];
+        char *end = bslfmt::PutRangeUtil::copy(text, text + 5, array);
+        ASSERT(array + 5 == end);
+        ASSERT(0 == memcmp(array, "Hello", 5));
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: FORMATTING WRITES SPANS WITH `putRange`
+        //
+        // Concerns:
+        //: 1 Literal text between replacement fields, and the bodies of
+        //:   formatted strings and integers, reach an output iterator having
+        //:   the trait through `putRange`.
+        //:
+        //: 2 The output is the same as when formatting to a string.
+        //:
+        //: 3 Empty spans are not passed to `putRange`.
+        //
+        // Plan:
+        //: 1 Format to a `CountingIterator` and check the output and the
+        //:   number of calls of each kind.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: FORMATTING WRITES SPANS WITH `putRange`
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nCONCERN: FORMATTING WRITES SPANS WITH `putRange`"
+                   "\n================================================\n");
+
+        {
+            bsl::string buffer;
+            int         numPuts      = 0;
+            int         numPutRanges = 0;
+
+            bslfmt::format_to(Iter(&buffer, &numPuts, &numPutRanges),
+                              "id={} name={} end",
+                              12345,
+                              "widget");
+
+            ASSERTV(buffer.c_str(), "id=12345 name=widget end" == buffer);
+            ASSERTV(numPuts,      0 == numPuts);
+            ASSERTV(numPutRanges, 5 == numPutRanges);
+        }
+        {
+            bsl::string buffer;
+            int         numPuts      = 0;
+            int         numPutRanges = 0;
+
+            bslfmt::format_to(Iter(&buffer, &numPuts, &numPutRanges),
+                              "{}{}",
+                              "",
+                              7);
+
+            ASSERTV(buffer.c_str(), "7" == buffer);
+            ASSERTV(numPuts,      0 == numPuts);
+            ASSERTV(numPutRanges, 1 == numPutRanges);
+        }
+        {
+            bsl::string buffer;
+            int         numPuts      = 0;
+            int         numPutRanges = 0;
+
+            bslfmt::format_to(Iter(&buffer, &numPuts, &numPutRanges),
+                              "[{:>5}]",
+                              "ab");
+
+            ASSERTV(buffer.c_str(), "[   ab]" == buffer);
+            ASSERTV(numPutRanges, 3 == numPutRanges);
+        }
+        {
+            bsl::wstring buffer;
+            int          numPuts      = 0;
+            int          numPutRanges = 0;
+
+            bslfmt::format_to(WIter(&buffer, &numPuts, &numPutRanges),
+                              L"x={} y={}",
+                              -42,
+                              L"why");
+
+            ASSERT(L"x=-42 y=why" == buffer);
+            ASSERTV(numPutRanges, 4 == numPutRanges);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `copy`
+        //
+        // Concerns:
+        //: 1 For an iterator having the trait, `copy` calls `putRange` once
+        //:   with the whole range, and returns the iterator.
+        //:
+        //: 2 For an empty range, `putRange` is not called.
+        //:
+        //: 3 For an iterator without the trait, `copy` writes every character
+        //:   and returns an iterator one past the last one written.
+        //:
+        //: 4 Both `char` and `wchar_t` ranges are supported.
+        //
+        // Plan:
+        //: 1 Copy ranges of various lengths to a `CountingIterator`, to
+        //:   pointers, and to `bsl::back_insert_iterator` objects, and check
+        //:   the results.  (C-1..4)
+        //
+        // Testing:
+        //   t_ITER PutRangeUtil::copy(const t_CHAR *, const t_CHAR *, ITER);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `copy`"
+                            "\n==============\n");
+
+        const char    SRC[]  = "0123456789abcdef";
+        const wchar_t WSRC[] = L"0123456789abcdef";
+
+        for (int len = 0; len <= 16; ++len) {
+            if (veryVerbose) { T_ P(len) }
+
+            bsl::string buffer;
+            int         numPuts      = 0;
+            int         numPutRanges = 0;
+
+            bslfmt::PutRangeUtil::copy(SRC,
+                                       SRC + len,
+                                       Iter(&buffer, &numPuts, &numPutRanges));
+
+            ASSERTV(len, bsl::string(SRC, len) == buffer);
+            ASSERTV(len, numPuts, 0 == numPuts);
+            ASSERTV(len, numPutRanges, (len ? 1 : 0) == numPutRanges);
+
+            bsl::wstring wbuffer;
+            numPutRanges = 0;
+
+            WIter wit(&wbuffer, &numPuts, &numPutRanges);
+            bslfmt::PutRangeUtil::copy(WSRC, WSRC + len, wit);
+
+            ASSERTV(len, bsl::wstring(WSRC, len) == wbuffer);
+            ASSERTV(len, numPutRanges, (len ? 1 : 0) == numPutRanges);
+
+            char        array[17] = {};
+            const char *end = bslfmt::PutRangeUtil::copy(SRC,
+                                                         SRC + len,
+                                                         array);
+            ASSERTV(len, array + len == end);
+            ASSERTV(len, 0 == memcmp(array, SRC, len));
+
+            bsl::string string;
+            bslfmt::PutRangeUtil::copy(SRC,
+                                       SRC + len,
+                                       bsl::back_inserter(string));
+            ASSERTV(len, bsl::string(SRC, len) == string);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `HasPutRange`
+        //
+        // Concerns:
+        //: 1 The trait is `true` for types declaring it with the nested trait
+        //:   mechanism, and for types for which it is specialized.
+        //:
+        //: 2 The trait is `false` for other types, including pointers and
+        //:   types having a `putRange` method without declaring the trait.
+        //:
+        //: 3 The trait is the same for cv-qualified types.
+        //
+        // Plan:
+        //: 1 Check `HasPutRange<TYPE>::value` for a set of types.  (C-1..3)
+        //
+        // Testing:
+        //   HasPutRange<t_TYPE>
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `HasPutRange`"
+                            "\n=====================\n");
+
+        ASSERT( bslfmt::HasPutRange<CountingIterator<char> >::value);
+        ASSERT( bslfmt::HasPutRange<CountingIterator<wchar_t> >::value);
+        ASSERT( bslfmt::HasPutRange<const CountingIterator<char> >::value);
+        ASSERT( bslfmt::HasPutRange<AppendIterator>::value);
+        ASSERT( bslfmt::HasPutRange<SpecializedIterator>::value);
+
+        ASSERT(!bslfmt::HasPutRange<UndeclaredIterator>::value);
+        ASSERT(!bslfmt::HasPutRange<char *>::value);
+        ASSERT(!bslfmt::HasPutRange<int>::value);
+        ASSERT(!bslfmt::HasPutRange<
+                        bsl::back_insert_iterator<bsl::string> >::value);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Copy a range to iterators with and without the trait.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bsl::string buffer;
+        int         numPuts      = 0;
+        int         numPutRanges = 0;
+
+        const char TEXT[] = "abc";
+        bslfmt::PutRangeUtil::copy(TEXT,
+                                   TEXT + 3,
+                                   Iter(&buffer, &numPuts, &numPutRanges));
+        ASSERT("abc" == buffer);
+        ASSERT(1     == numPutRanges);
+
+        char array[3];
+        ASSERT(array + 3 ==
+                         bslfmt::PutRangeUtil::copy(TEXT, TEXT + 3, array));
+      } break;
+      default: {
+        printf("WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        printf("Error, non-zero test status = %d .\n", testStatus);
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------